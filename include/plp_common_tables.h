@@ -47,6 +47,20 @@ extern const int32_t twiddleCoef_1024_q32[1536];
 extern const int32_t twiddleCoef_2048_q32[3072];
 extern const int32_t twiddleCoef_4096_q32[6144];
 
+extern const int16_t twiddleCoef_dct_32_q16[128];
+extern const int16_t twiddleCoef_dct_64_q16[256];
+extern const int16_t twiddleCoef_dct_128_q16[512];
+extern const int16_t twiddleCoef_dct_256_q16[1024];
+extern const int16_t twiddleCoef_dct_512_q16[2048];
+extern const int16_t twiddleCoef_dct_1024_q16[4096];
+
+extern const int32_t twiddleCoef_dct_32_q32[128];
+extern const int32_t twiddleCoef_dct_64_q32[256];
+extern const int32_t twiddleCoef_dct_128_q32[512];
+extern const int32_t twiddleCoef_dct_256_q32[1024];
+extern const int32_t twiddleCoef_dct_512_q32[2048];
+extern const int32_t twiddleCoef_dct_1024_q32[4096];
+
 #define PLPBITREVINDEXTABLE_FIXED_16_TABLE_LENGTH ((uint16_t)12)
 #define PLPBITREVINDEXTABLE_FIXED_32_TABLE_LENGTH ((uint16_t)24)
 #define PLPBITREVINDEXTABLE_FIXED_64_TABLE_LENGTH ((uint16_t)56)
@@ -90,4 +104,8 @@ extern const uint16_t startingIndices_fb_32[32];
 extern const float32_t values_fb_32[245];
 
 extern const float32_t hannWindow_f32_len512[512];
+
+extern const int16_t values_fb_32_q16[245];
+extern const int16_t hannWindow_q16_len512[512];
+extern const uint16_t log2Table_q16[33];
 #endif // PLP_COMMON_TABLES_H
@@ -0,0 +1,2098 @@
+/* ----------------------------------------------------------------------
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_small.h
+ * Description:  Fixed-size matrix kernels (2x2, 3x3 and 4x4)
+ *
+ * $Date:        19. Oct 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * This file is generated by test/mrWolf/gen_mat_small.py, do not edit it by hand.
+ */
+
+#ifndef __PLP_MAT_SMALL_H__
+#define __PLP_MAT_SMALL_H__
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @defgroup MatSmall Fixed-size Matrix Operations
+  Fully unrolled kernels for the multiplication, transposition, inversion and determinant of 2x2,
+  3x3 and 4x4 matrices, e.g. for rotations and quaternions. At these sizes, the loop setup and the
+  remainder handling of the generic kernels cost more than the arithmetic. The kernels are static
+  inline functions of this header, include it to call them directly with a known size, e.g.
+  plp_mat_mult_3x3x1_f32 to rotate a vector.
+
+  The glue code of plp_mat_mult, plp_mat_mult_trans, plp_mat_trans and plp_mat_inv uses the
+  dispatchers at the end of this header (e.g. plp_mat_mult_small_f32), which call the fixed-size
+  kernel when the dimensions match one of them. The multiplications compute the same sums in the
+  same order as the generic kernels, the fixed-point versions round and shift every product like
+  plp_mat_mult_q32. The inversion uses the adjugate matrix instead of Gauss-Jordan elimination.
+
+  The kernels can be used on the fabric controller and on the cluster. The inputs and the output
+  must not overlap, except for the transposition and the inversion, which read all the inputs
+  first.
+ */
+
+/**
+  @addtogroup MatSmall
+  @{
+ */
+
+/**
+  @brief      2x2x2 matrix multiplication of 32-bit integer matrices.
+  @param[in]  pSrcA  points to the first input matrix (2x2)
+  @param[in]  pSrcB  points to the second input matrix (2x2)
+  @param[out] pDstC  points to the output matrix (2x2)
+  @return     none
+ */
+
+static inline void plp_mat_mult_2x2x2_i32(const int32_t *__restrict__ pSrcA,
+                                          const int32_t *__restrict__ pSrcB,
+                                          int32_t *__restrict__ pDstC) {
+    pDstC[0] = pSrcA[0] * pSrcB[0] + pSrcA[1] * pSrcB[2];
+    pDstC[1] = pSrcA[0] * pSrcB[1] + pSrcA[1] * pSrcB[3];
+    pDstC[2] = pSrcA[2] * pSrcB[0] + pSrcA[3] * pSrcB[2];
+    pDstC[3] = pSrcA[2] * pSrcB[1] + pSrcA[3] * pSrcB[3];
+}
+
+/**
+  @brief      3x3x3 matrix multiplication of 32-bit integer matrices.
+  @param[in]  pSrcA  points to the first input matrix (3x3)
+  @param[in]  pSrcB  points to the second input matrix (3x3)
+  @param[out] pDstC  points to the output matrix (3x3)
+  @return     none
+ */
+
+static inline void plp_mat_mult_3x3x3_i32(const int32_t *__restrict__ pSrcA,
+                                          const int32_t *__restrict__ pSrcB,
+                                          int32_t *__restrict__ pDstC) {
+    pDstC[0] = pSrcA[0] * pSrcB[0] + pSrcA[1] * pSrcB[3] + pSrcA[2] * pSrcB[6];
+    pDstC[1] = pSrcA[0] * pSrcB[1] + pSrcA[1] * pSrcB[4] + pSrcA[2] * pSrcB[7];
+    pDstC[2] = pSrcA[0] * pSrcB[2] + pSrcA[1] * pSrcB[5] + pSrcA[2] * pSrcB[8];
+    pDstC[3] = pSrcA[3] * pSrcB[0] + pSrcA[4] * pSrcB[3] + pSrcA[5] * pSrcB[6];
+    pDstC[4] = pSrcA[3] * pSrcB[1] + pSrcA[4] * pSrcB[4] + pSrcA[5] * pSrcB[7];
+    pDstC[5] = pSrcA[3] * pSrcB[2] + pSrcA[4] * pSrcB[5] + pSrcA[5] * pSrcB[8];
+    pDstC[6] = pSrcA[6] * pSrcB[0] + pSrcA[7] * pSrcB[3] + pSrcA[8] * pSrcB[6];
+    pDstC[7] = pSrcA[6] * pSrcB[1] + pSrcA[7] * pSrcB[4] + pSrcA[8] * pSrcB[7];
+    pDstC[8] = pSrcA[6] * pSrcB[2] + pSrcA[7] * pSrcB[5] + pSrcA[8] * pSrcB[8];
+}
+
+/**
+  @brief      4x4x4 matrix multiplication of 32-bit integer matrices.
+  @param[in]  pSrcA  points to the first input matrix (4x4)
+  @param[in]  pSrcB  points to the second input matrix (4x4)
+  @param[out] pDstC  points to the output matrix (4x4)
+  @return     none
+ */
+
+static inline void plp_mat_mult_4x4x4_i32(const int32_t *__restrict__ pSrcA,
+                                          const int32_t *__restrict__ pSrcB,
+                                          int32_t *__restrict__ pDstC) {
+    pDstC[0] = pSrcA[0] * pSrcB[0] + pSrcA[1] * pSrcB[4] + pSrcA[2] * pSrcB[8] +
+               pSrcA[3] * pSrcB[12];
+    pDstC[1] = pSrcA[0] * pSrcB[1] + pSrcA[1] * pSrcB[5] + pSrcA[2] * pSrcB[9] +
+               pSrcA[3] * pSrcB[13];
+    pDstC[2] = pSrcA[0] * pSrcB[2] + pSrcA[1] * pSrcB[6] + pSrcA[2] * pSrcB[10] +
+               pSrcA[3] * pSrcB[14];
+    pDstC[3] = pSrcA[0] * pSrcB[3] + pSrcA[1] * pSrcB[7] + pSrcA[2] * pSrcB[11] +
+               pSrcA[3] * pSrcB[15];
+    pDstC[4] = pSrcA[4] * pSrcB[0] + pSrcA[5] * pSrcB[4] + pSrcA[6] * pSrcB[8] +
+               pSrcA[7] * pSrcB[12];
+    pDstC[5] = pSrcA[4] * pSrcB[1] + pSrcA[5] * pSrcB[5] + pSrcA[6] * pSrcB[9] +
+               pSrcA[7] * pSrcB[13];
+    pDstC[6] = pSrcA[4] * pSrcB[2] + pSrcA[5] * pSrcB[6] + pSrcA[6] * pSrcB[10] +
+               pSrcA[7] * pSrcB[14];
+    pDstC[7] = pSrcA[4] * pSrcB[3] + pSrcA[5] * pSrcB[7] + pSrcA[6] * pSrcB[11] +
+               pSrcA[7] * pSrcB[15];
+    pDstC[8] = pSrcA[8] * pSrcB[0] + pSrcA[9] * pSrcB[4] + pSrcA[10] * pSrcB[8] +
+               pSrcA[11] * pSrcB[12];
+    pDstC[9] = pSrcA[8] * pSrcB[1] + pSrcA[9] * pSrcB[5] + pSrcA[10] * pSrcB[9] +
+               pSrcA[11] * pSrcB[13];
+    pDstC[10] = pSrcA[8] * pSrcB[2] + pSrcA[9] * pSrcB[6] + pSrcA[10] * pSrcB[10] +
+                pSrcA[11] * pSrcB[14];
+    pDstC[11] = pSrcA[8] * pSrcB[3] + pSrcA[9] * pSrcB[7] + pSrcA[10] * pSrcB[11] +
+                pSrcA[11] * pSrcB[15];
+    pDstC[12] = pSrcA[12] * pSrcB[0] + pSrcA[13] * pSrcB[4] + pSrcA[14] * pSrcB[8] +
+                pSrcA[15] * pSrcB[12];
+    pDstC[13] = pSrcA[12] * pSrcB[1] + pSrcA[13] * pSrcB[5] + pSrcA[14] * pSrcB[9] +
+                pSrcA[15] * pSrcB[13];
+    pDstC[14] = pSrcA[12] * pSrcB[2] + pSrcA[13] * pSrcB[6] + pSrcA[14] * pSrcB[10] +
+                pSrcA[15] * pSrcB[14];
+    pDstC[15] = pSrcA[12] * pSrcB[3] + pSrcA[13] * pSrcB[7] + pSrcA[14] * pSrcB[11] +
+                pSrcA[15] * pSrcB[15];
+}
+
+/**
+  @brief      2x2x1 matrix multiplication of 32-bit integer matrices.
+  @param[in]  pSrcA  points to the first input matrix (2x2)
+  @param[in]  pSrcB  points to the second input matrix (2x1)
+  @param[out] pDstC  points to the output matrix (2x1)
+  @return     none
+ */
+
+static inline void plp_mat_mult_2x2x1_i32(const int32_t *__restrict__ pSrcA,
+                                          const int32_t *__restrict__ pSrcB,
+                                          int32_t *__restrict__ pDstC) {
+    pDstC[0] = pSrcA[0] * pSrcB[0] + pSrcA[1] * pSrcB[1];
+    pDstC[1] = pSrcA[2] * pSrcB[0] + pSrcA[3] * pSrcB[1];
+}
+
+/**
+  @brief      3x3x1 matrix multiplication of 32-bit integer matrices.
+  @param[in]  pSrcA  points to the first input matrix (3x3)
+  @param[in]  pSrcB  points to the second input matrix (3x1)
+  @param[out] pDstC  points to the output matrix (3x1)
+  @return     none
+ */
+
+static inline void plp_mat_mult_3x3x1_i32(const int32_t *__restrict__ pSrcA,
+                                          const int32_t *__restrict__ pSrcB,
+                                          int32_t *__restrict__ pDstC) {
+    pDstC[0] = pSrcA[0] * pSrcB[0] + pSrcA[1] * pSrcB[1] + pSrcA[2] * pSrcB[2];
+    pDstC[1] = pSrcA[3] * pSrcB[0] + pSrcA[4] * pSrcB[1] + pSrcA[5] * pSrcB[2];
+    pDstC[2] = pSrcA[6] * pSrcB[0] + pSrcA[7] * pSrcB[1] + pSrcA[8] * pSrcB[2];
+}
+
+/**
+  @brief      4x4x1 matrix multiplication of 32-bit integer matrices.
+  @param[in]  pSrcA  points to the first input matrix (4x4)
+  @param[in]  pSrcB  points to the second input matrix (4x1)
+  @param[out] pDstC  points to the output matrix (4x1)
+  @return     none
+ */
+
+static inline void plp_mat_mult_4x4x1_i32(const int32_t *__restrict__ pSrcA,
+                                          const int32_t *__restrict__ pSrcB,
+                                          int32_t *__restrict__ pDstC) {
+    pDstC[0] = pSrcA[0] * pSrcB[0] + pSrcA[1] * pSrcB[1] + pSrcA[2] * pSrcB[2] +
+               pSrcA[3] * pSrcB[3];
+    pDstC[1] = pSrcA[4] * pSrcB[0] + pSrcA[5] * pSrcB[1] + pSrcA[6] * pSrcB[2] +
+               pSrcA[7] * pSrcB[3];
+    pDstC[2] = pSrcA[8] * pSrcB[0] + pSrcA[9] * pSrcB[1] + pSrcA[10] * pSrcB[2] +
+               pSrcA[11] * pSrcB[3];
+    pDstC[3] = pSrcA[12] * pSrcB[0] + pSrcA[13] * pSrcB[1] + pSrcA[14] * pSrcB[2] +
+               pSrcA[15] * pSrcB[3];
+}
+
+/**
+  @brief      2x2x2 matrix transposed matrix multiplication of 32-bit integer matrices.
+  @param[in]  pSrcA  points to the first input matrix (2x2)
+  @param[in]  pSrcB  points to the second input matrix (2x2), which is transposed
+  @param[out] pDstC  points to the output matrix (2x2)
+  @return     none
+ */
+
+static inline void plp_mat_mult_trans_2x2x2_i32(const int32_t *__restrict__ pSrcA,
+                                                const int32_t *__restrict__ pSrcB,
+                                                int32_t *__restrict__ pDstC) {
+    pDstC[0] = pSrcA[0] * pSrcB[0] + pSrcA[1] * pSrcB[1];
+    pDstC[1] = pSrcA[0] * pSrcB[2] + pSrcA[1] * pSrcB[3];
+    pDstC[2] = pSrcA[2] * pSrcB[0] + pSrcA[3] * pSrcB[1];
+    pDstC[3] = pSrcA[2] * pSrcB[2] + pSrcA[3] * pSrcB[3];
+}
+
+/**
+  @brief      3x3x3 matrix transposed matrix multiplication of 32-bit integer matrices.
+  @param[in]  pSrcA  points to the first input matrix (3x3)
+  @param[in]  pSrcB  points to the second input matrix (3x3), which is transposed
+  @param[out] pDstC  points to the output matrix (3x3)
+  @return     none
+ */
+
+static inline void plp_mat_mult_trans_3x3x3_i32(const int32_t *__restrict__ pSrcA,
+                                                const int32_t *__restrict__ pSrcB,
+                                                int32_t *__restrict__ pDstC) {
+    pDstC[0] = pSrcA[0] * pSrcB[0] + pSrcA[1] * pSrcB[1] + pSrcA[2] * pSrcB[2];
+    pDstC[1] = pSrcA[0] * pSrcB[3] + pSrcA[1] * pSrcB[4] + pSrcA[2] * pSrcB[5];
+    pDstC[2] = pSrcA[0] * pSrcB[6] + pSrcA[1] * pSrcB[7] + pSrcA[2] * pSrcB[8];
+    pDstC[3] = pSrcA[3] * pSrcB[0] + pSrcA[4] * pSrcB[1] + pSrcA[5] * pSrcB[2];
+    pDstC[4] = pSrcA[3] * pSrcB[3] + pSrcA[4] * pSrcB[4] + pSrcA[5] * pSrcB[5];
+    pDstC[5] = pSrcA[3] * pSrcB[6] + pSrcA[4] * pSrcB[7] + pSrcA[5] * pSrcB[8];
+    pDstC[6] = pSrcA[6] * pSrcB[0] + pSrcA[7] * pSrcB[1] + pSrcA[8] * pSrcB[2];
+    pDstC[7] = pSrcA[6] * pSrcB[3] + pSrcA[7] * pSrcB[4] + pSrcA[8] * pSrcB[5];
+    pDstC[8] = pSrcA[6] * pSrcB[6] + pSrcA[7] * pSrcB[7] + pSrcA[8] * pSrcB[8];
+}
+
+/**
+  @brief      4x4x4 matrix transposed matrix multiplication of 32-bit integer matrices.
+  @param[in]  pSrcA  points to the first input matrix (4x4)
+  @param[in]  pSrcB  points to the second input matrix (4x4), which is transposed
+  @param[out] pDstC  points to the output matrix (4x4)
+  @return     none
+ */
+
+static inline void plp_mat_mult_trans_4x4x4_i32(const int32_t *__restrict__ pSrcA,
+                                                const int32_t *__restrict__ pSrcB,
+                                                int32_t *__restrict__ pDstC) {
+    pDstC[0] = pSrcA[0] * pSrcB[0] + pSrcA[1] * pSrcB[1] + pSrcA[2] * pSrcB[2] +
+               pSrcA[3] * pSrcB[3];
+    pDstC[1] = pSrcA[0] * pSrcB[4] + pSrcA[1] * pSrcB[5] + pSrcA[2] * pSrcB[6] +
+               pSrcA[3] * pSrcB[7];
+    pDstC[2] = pSrcA[0] * pSrcB[8] + pSrcA[1] * pSrcB[9] + pSrcA[2] * pSrcB[10] +
+               pSrcA[3] * pSrcB[11];
+    pDstC[3] = pSrcA[0] * pSrcB[12] + pSrcA[1] * pSrcB[13] + pSrcA[2] * pSrcB[14] +
+               pSrcA[3] * pSrcB[15];
+    pDstC[4] = pSrcA[4] * pSrcB[0] + pSrcA[5] * pSrcB[1] + pSrcA[6] * pSrcB[2] +
+               pSrcA[7] * pSrcB[3];
+    pDstC[5] = pSrcA[4] * pSrcB[4] + pSrcA[5] * pSrcB[5] + pSrcA[6] * pSrcB[6] +
+               pSrcA[7] * pSrcB[7];
+    pDstC[6] = pSrcA[4] * pSrcB[8] + pSrcA[5] * pSrcB[9] + pSrcA[6] * pSrcB[10] +
+               pSrcA[7] * pSrcB[11];
+    pDstC[7] = pSrcA[4] * pSrcB[12] + pSrcA[5] * pSrcB[13] + pSrcA[6] * pSrcB[14] +
+               pSrcA[7] * pSrcB[15];
+    pDstC[8] = pSrcA[8] * pSrcB[0] + pSrcA[9] * pSrcB[1] + pSrcA[10] * pSrcB[2] +
+               pSrcA[11] * pSrcB[3];
+    pDstC[9] = pSrcA[8] * pSrcB[4] + pSrcA[9] * pSrcB[5] + pSrcA[10] * pSrcB[6] +
+               pSrcA[11] * pSrcB[7];
+    pDstC[10] = pSrcA[8] * pSrcB[8] + pSrcA[9] * pSrcB[9] + pSrcA[10] * pSrcB[10] +
+                pSrcA[11] * pSrcB[11];
+    pDstC[11] = pSrcA[8] * pSrcB[12] + pSrcA[9] * pSrcB[13] + pSrcA[10] * pSrcB[14] +
+                pSrcA[11] * pSrcB[15];
+    pDstC[12] = pSrcA[12] * pSrcB[0] + pSrcA[13] * pSrcB[1] + pSrcA[14] * pSrcB[2] +
+                pSrcA[15] * pSrcB[3];
+    pDstC[13] = pSrcA[12] * pSrcB[4] + pSrcA[13] * pSrcB[5] + pSrcA[14] * pSrcB[6] +
+                pSrcA[15] * pSrcB[7];
+    pDstC[14] = pSrcA[12] * pSrcB[8] + pSrcA[13] * pSrcB[9] + pSrcA[14] * pSrcB[10] +
+                pSrcA[15] * pSrcB[11];
+    pDstC[15] = pSrcA[12] * pSrcB[12] + pSrcA[13] * pSrcB[13] + pSrcA[14] * pSrcB[14] +
+                pSrcA[15] * pSrcB[15];
+}
+
+/**
+  @brief      2x2x2 matrix multiplication of 32-bit fixed-point matrices.
+  @param[in]  pSrcA  points to the first input matrix (2x2)
+  @param[in]  pSrcB  points to the second input matrix (2x2)
+  @param[in]  shift  amount of bits to shift the products to the right
+  @param[out] pDstC  points to the output matrix (2x2)
+  @return     none
+ */
+
+static inline void plp_mat_mult_2x2x2_q32(const int32_t *__restrict__ pSrcA,
+                                          const int32_t *__restrict__ pSrcB,
+                                          uint32_t shift,
+                                          int32_t *__restrict__ pDstC) {
+    int32_t round = (1 << shift) >> 1;
+
+    pDstC[0] = ((pSrcA[0] * pSrcB[0] + round) >> shift) + ((pSrcA[1] * pSrcB[2] + round) >> shift);
+    pDstC[1] = ((pSrcA[0] * pSrcB[1] + round) >> shift) + ((pSrcA[1] * pSrcB[3] + round) >> shift);
+    pDstC[2] = ((pSrcA[2] * pSrcB[0] + round) >> shift) + ((pSrcA[3] * pSrcB[2] + round) >> shift);
+    pDstC[3] = ((pSrcA[2] * pSrcB[1] + round) >> shift) + ((pSrcA[3] * pSrcB[3] + round) >> shift);
+}
+
+/**
+  @brief      3x3x3 matrix multiplication of 32-bit fixed-point matrices.
+  @param[in]  pSrcA  points to the first input matrix (3x3)
+  @param[in]  pSrcB  points to the second input matrix (3x3)
+  @param[in]  shift  amount of bits to shift the products to the right
+  @param[out] pDstC  points to the output matrix (3x3)
+  @return     none
+ */
+
+static inline void plp_mat_mult_3x3x3_q32(const int32_t *__restrict__ pSrcA,
+                                          const int32_t *__restrict__ pSrcB,
+                                          uint32_t shift,
+                                          int32_t *__restrict__ pDstC) {
+    int32_t round = (1 << shift) >> 1;
+
+    pDstC[0] = ((pSrcA[0] * pSrcB[0] + round) >> shift) + ((pSrcA[1] * pSrcB[3] + round) >> shift) +
+               ((pSrcA[2] * pSrcB[6] + round) >> shift);
+    pDstC[1] = ((pSrcA[0] * pSrcB[1] + round) >> shift) + ((pSrcA[1] * pSrcB[4] + round) >> shift) +
+               ((pSrcA[2] * pSrcB[7] + round) >> shift);
+    pDstC[2] = ((pSrcA[0] * pSrcB[2] + round) >> shift) + ((pSrcA[1] * pSrcB[5] + round) >> shift) +
+               ((pSrcA[2] * pSrcB[8] + round) >> shift);
+    pDstC[3] = ((pSrcA[3] * pSrcB[0] + round) >> shift) + ((pSrcA[4] * pSrcB[3] + round) >> shift) +
+               ((pSrcA[5] * pSrcB[6] + round) >> shift);
+    pDstC[4] = ((pSrcA[3] * pSrcB[1] + round) >> shift) + ((pSrcA[4] * pSrcB[4] + round) >> shift) +
+               ((pSrcA[5] * pSrcB[7] + round) >> shift);
+    pDstC[5] = ((pSrcA[3] * pSrcB[2] + round) >> shift) + ((pSrcA[4] * pSrcB[5] + round) >> shift) +
+               ((pSrcA[5] * pSrcB[8] + round) >> shift);
+    pDstC[6] = ((pSrcA[6] * pSrcB[0] + round) >> shift) + ((pSrcA[7] * pSrcB[3] + round) >> shift) +
+               ((pSrcA[8] * pSrcB[6] + round) >> shift);
+    pDstC[7] = ((pSrcA[6] * pSrcB[1] + round) >> shift) + ((pSrcA[7] * pSrcB[4] + round) >> shift) +
+               ((pSrcA[8] * pSrcB[7] + round) >> shift);
+    pDstC[8] = ((pSrcA[6] * pSrcB[2] + round) >> shift) + ((pSrcA[7] * pSrcB[5] + round) >> shift) +
+               ((pSrcA[8] * pSrcB[8] + round) >> shift);
+}
+
+/**
+  @brief      4x4x4 matrix multiplication of 32-bit fixed-point matrices.
+  @param[in]  pSrcA  points to the first input matrix (4x4)
+  @param[in]  pSrcB  points to the second input matrix (4x4)
+  @param[in]  shift  amount of bits to shift the products to the right
+  @param[out] pDstC  points to the output matrix (4x4)
+  @return     none
+ */
+
+static inline void plp_mat_mult_4x4x4_q32(const int32_t *__restrict__ pSrcA,
+                                          const int32_t *__restrict__ pSrcB,
+                                          uint32_t shift,
+                                          int32_t *__restrict__ pDstC) {
+    int32_t round = (1 << shift) >> 1;
+
+    pDstC[0] = ((pSrcA[0] * pSrcB[0] + round) >> shift) + ((pSrcA[1] * pSrcB[4] + round) >> shift) +
+               ((pSrcA[2] * pSrcB[8] + round) >> shift) + ((pSrcA[3] * pSrcB[12] + round) >> shift);
+    pDstC[1] = ((pSrcA[0] * pSrcB[1] + round) >> shift) + ((pSrcA[1] * pSrcB[5] + round) >> shift) +
+               ((pSrcA[2] * pSrcB[9] + round) >> shift) + ((pSrcA[3] * pSrcB[13] + round) >> shift);
+    pDstC[2] = ((pSrcA[0] * pSrcB[2] + round) >> shift) + ((pSrcA[1] * pSrcB[6] + round) >> shift) +
+               ((pSrcA[2] * pSrcB[10] + round) >> shift) +
+               ((pSrcA[3] * pSrcB[14] + round) >> shift);
+    pDstC[3] = ((pSrcA[0] * pSrcB[3] + round) >> shift) + ((pSrcA[1] * pSrcB[7] + round) >> shift) +
+               ((pSrcA[2] * pSrcB[11] + round) >> shift) +
+               ((pSrcA[3] * pSrcB[15] + round) >> shift);
+    pDstC[4] = ((pSrcA[4] * pSrcB[0] + round) >> shift) + ((pSrcA[5] * pSrcB[4] + round) >> shift) +
+               ((pSrcA[6] * pSrcB[8] + round) >> shift) + ((pSrcA[7] * pSrcB[12] + round) >> shift);
+    pDstC[5] = ((pSrcA[4] * pSrcB[1] + round) >> shift) + ((pSrcA[5] * pSrcB[5] + round) >> shift) +
+               ((pSrcA[6] * pSrcB[9] + round) >> shift) + ((pSrcA[7] * pSrcB[13] + round) >> shift);
+    pDstC[6] = ((pSrcA[4] * pSrcB[2] + round) >> shift) + ((pSrcA[5] * pSrcB[6] + round) >> shift) +
+               ((pSrcA[6] * pSrcB[10] + round) >> shift) +
+               ((pSrcA[7] * pSrcB[14] + round) >> shift);
+    pDstC[7] = ((pSrcA[4] * pSrcB[3] + round) >> shift) + ((pSrcA[5] * pSrcB[7] + round) >> shift) +
+               ((pSrcA[6] * pSrcB[11] + round) >> shift) +
+               ((pSrcA[7] * pSrcB[15] + round) >> shift);
+    pDstC[8] = ((pSrcA[8] * pSrcB[0] + round) >> shift) + ((pSrcA[9] * pSrcB[4] + round) >> shift) +
+               ((pSrcA[10] * pSrcB[8] + round) >> shift) +
+               ((pSrcA[11] * pSrcB[12] + round) >> shift);
+    pDstC[9] = ((pSrcA[8] * pSrcB[1] + round) >> shift) + ((pSrcA[9] * pSrcB[5] + round) >> shift) +
+               ((pSrcA[10] * pSrcB[9] + round) >> shift) +
+               ((pSrcA[11] * pSrcB[13] + round) >> shift);
+    pDstC[10] = ((pSrcA[8] * pSrcB[2] + round) >> shift) +
+                ((pSrcA[9] * pSrcB[6] + round) >> shift) +
+                ((pSrcA[10] * pSrcB[10] + round) >> shift) +
+                ((pSrcA[11] * pSrcB[14] + round) >> shift);
+    pDstC[11] = ((pSrcA[8] * pSrcB[3] + round) >> shift) +
+                ((pSrcA[9] * pSrcB[7] + round) >> shift) +
+                ((pSrcA[10] * pSrcB[11] + round) >> shift) +
+                ((pSrcA[11] * pSrcB[15] + round) >> shift);
+    pDstC[12] = ((pSrcA[12] * pSrcB[0] + round) >> shift) +
+                ((pSrcA[13] * pSrcB[4] + round) >> shift) +
+                ((pSrcA[14] * pSrcB[8] + round) >> shift) +
+                ((pSrcA[15] * pSrcB[12] + round) >> shift);
+    pDstC[13] = ((pSrcA[12] * pSrcB[1] + round) >> shift) +
+                ((pSrcA[13] * pSrcB[5] + round) >> shift) +
+                ((pSrcA[14] * pSrcB[9] + round) >> shift) +
+                ((pSrcA[15] * pSrcB[13] + round) >> shift);
+    pDstC[14] = ((pSrcA[12] * pSrcB[2] + round) >> shift) +
+                ((pSrcA[13] * pSrcB[6] + round) >> shift) +
+                ((pSrcA[14] * pSrcB[10] + round) >> shift) +
+                ((pSrcA[15] * pSrcB[14] + round) >> shift);
+    pDstC[15] = ((pSrcA[12] * pSrcB[3] + round) >> shift) +
+                ((pSrcA[13] * pSrcB[7] + round) >> shift) +
+                ((pSrcA[14] * pSrcB[11] + round) >> shift) +
+                ((pSrcA[15] * pSrcB[15] + round) >> shift);
+}
+
+/**
+  @brief      2x2x1 matrix multiplication of 32-bit fixed-point matrices.
+  @param[in]  pSrcA  points to the first input matrix (2x2)
+  @param[in]  pSrcB  points to the second input matrix (2x1)
+  @param[in]  shift  amount of bits to shift the products to the right
+  @param[out] pDstC  points to the output matrix (2x1)
+  @return     none
+ */
+
+static inline void plp_mat_mult_2x2x1_q32(const int32_t *__restrict__ pSrcA,
+                                          const int32_t *__restrict__ pSrcB,
+                                          uint32_t shift,
+                                          int32_t *__restrict__ pDstC) {
+    int32_t round = (1 << shift) >> 1;
+
+    pDstC[0] = ((pSrcA[0] * pSrcB[0] + round) >> shift) + ((pSrcA[1] * pSrcB[1] + round) >> shift);
+    pDstC[1] = ((pSrcA[2] * pSrcB[0] + round) >> shift) + ((pSrcA[3] * pSrcB[1] + round) >> shift);
+}
+
+/**
+  @brief      3x3x1 matrix multiplication of 32-bit fixed-point matrices.
+  @param[in]  pSrcA  points to the first input matrix (3x3)
+  @param[in]  pSrcB  points to the second input matrix (3x1)
+  @param[in]  shift  amount of bits to shift the products to the right
+  @param[out] pDstC  points to the output matrix (3x1)
+  @return     none
+ */
+
+static inline void plp_mat_mult_3x3x1_q32(const int32_t *__restrict__ pSrcA,
+                                          const int32_t *__restrict__ pSrcB,
+                                          uint32_t shift,
+                                          int32_t *__restrict__ pDstC) {
+    int32_t round = (1 << shift) >> 1;
+
+    pDstC[0] = ((pSrcA[0] * pSrcB[0] + round) >> shift) + ((pSrcA[1] * pSrcB[1] + round) >> shift) +
+               ((pSrcA[2] * pSrcB[2] + round) >> shift);
+    pDstC[1] = ((pSrcA[3] * pSrcB[0] + round) >> shift) + ((pSrcA[4] * pSrcB[1] + round) >> shift) +
+               ((pSrcA[5] * pSrcB[2] + round) >> shift);
+    pDstC[2] = ((pSrcA[6] * pSrcB[0] + round) >> shift) + ((pSrcA[7] * pSrcB[1] + round) >> shift) +
+               ((pSrcA[8] * pSrcB[2] + round) >> shift);
+}
+
+/**
+  @brief      4x4x1 matrix multiplication of 32-bit fixed-point matrices.
+  @param[in]  pSrcA  points to the first input matrix (4x4)
+  @param[in]  pSrcB  points to the second input matrix (4x1)
+  @param[in]  shift  amount of bits to shift the products to the right
+  @param[out] pDstC  points to the output matrix (4x1)
+  @return     none
+ */
+
+static inline void plp_mat_mult_4x4x1_q32(const int32_t *__restrict__ pSrcA,
+                                          const int32_t *__restrict__ pSrcB,
+                                          uint32_t shift,
+                                          int32_t *__restrict__ pDstC) {
+    int32_t round = (1 << shift) >> 1;
+
+    pDstC[0] = ((pSrcA[0] * pSrcB[0] + round) >> shift) + ((pSrcA[1] * pSrcB[1] + round) >> shift) +
+               ((pSrcA[2] * pSrcB[2] + round) >> shift) + ((pSrcA[3] * pSrcB[3] + round) >> shift);
+    pDstC[1] = ((pSrcA[4] * pSrcB[0] + round) >> shift) + ((pSrcA[5] * pSrcB[1] + round) >> shift) +
+               ((pSrcA[6] * pSrcB[2] + round) >> shift) + ((pSrcA[7] * pSrcB[3] + round) >> shift);
+    pDstC[2] = ((pSrcA[8] * pSrcB[0] + round) >> shift) + ((pSrcA[9] * pSrcB[1] + round) >> shift) +
+               ((pSrcA[10] * pSrcB[2] + round) >> shift) +
+               ((pSrcA[11] * pSrcB[3] + round) >> shift);
+    pDstC[3] = ((pSrcA[12] * pSrcB[0] + round) >> shift) +
+               ((pSrcA[13] * pSrcB[1] + round) >> shift) +
+               ((pSrcA[14] * pSrcB[2] + round) >> shift) +
+               ((pSrcA[15] * pSrcB[3] + round) >> shift);
+}
+
+/**
+  @brief      2x2x2 matrix transposed matrix multiplication of 32-bit fixed-point matrices.
+  @param[in]  pSrcA  points to the first input matrix (2x2)
+  @param[in]  pSrcB  points to the second input matrix (2x2), which is transposed
+  @param[in]  shift  amount of bits to shift the products to the right
+  @param[out] pDstC  points to the output matrix (2x2)
+  @return     none
+ */
+
+static inline void plp_mat_mult_trans_2x2x2_q32(const int32_t *__restrict__ pSrcA,
+                                                const int32_t *__restrict__ pSrcB,
+                                                uint32_t shift,
+                                                int32_t *__restrict__ pDstC) {
+    int32_t round = (1 << shift) >> 1;
+
+    pDstC[0] = ((pSrcA[0] * pSrcB[0] + round) >> shift) + ((pSrcA[1] * pSrcB[1] + round) >> shift);
+    pDstC[1] = ((pSrcA[0] * pSrcB[2] + round) >> shift) + ((pSrcA[1] * pSrcB[3] + round) >> shift);
+    pDstC[2] = ((pSrcA[2] * pSrcB[0] + round) >> shift) + ((pSrcA[3] * pSrcB[1] + round) >> shift);
+    pDstC[3] = ((pSrcA[2] * pSrcB[2] + round) >> shift) + ((pSrcA[3] * pSrcB[3] + round) >> shift);
+}
+
+/**
+  @brief      3x3x3 matrix transposed matrix multiplication of 32-bit fixed-point matrices.
+  @param[in]  pSrcA  points to the first input matrix (3x3)
+  @param[in]  pSrcB  points to the second input matrix (3x3), which is transposed
+  @param[in]  shift  amount of bits to shift the products to the right
+  @param[out] pDstC  points to the output matrix (3x3)
+  @return     none
+ */
+
+static inline void plp_mat_mult_trans_3x3x3_q32(const int32_t *__restrict__ pSrcA,
+                                                const int32_t *__restrict__ pSrcB,
+                                                uint32_t shift,
+                                                int32_t *__restrict__ pDstC) {
+    int32_t round = (1 << shift) >> 1;
+
+    pDstC[0] = ((pSrcA[0] * pSrcB[0] + round) >> shift) + ((pSrcA[1] * pSrcB[1] + round) >> shift) +
+               ((pSrcA[2] * pSrcB[2] + round) >> shift);
+    pDstC[1] = ((pSrcA[0] * pSrcB[3] + round) >> shift) + ((pSrcA[1] * pSrcB[4] + round) >> shift) +
+               ((pSrcA[2] * pSrcB[5] + round) >> shift);
+    pDstC[2] = ((pSrcA[0] * pSrcB[6] + round) >> shift) + ((pSrcA[1] * pSrcB[7] + round) >> shift) +
+               ((pSrcA[2] * pSrcB[8] + round) >> shift);
+    pDstC[3] = ((pSrcA[3] * pSrcB[0] + round) >> shift) + ((pSrcA[4] * pSrcB[1] + round) >> shift) +
+               ((pSrcA[5] * pSrcB[2] + round) >> shift);
+    pDstC[4] = ((pSrcA[3] * pSrcB[3] + round) >> shift) + ((pSrcA[4] * pSrcB[4] + round) >> shift) +
+               ((pSrcA[5] * pSrcB[5] + round) >> shift);
+    pDstC[5] = ((pSrcA[3] * pSrcB[6] + round) >> shift) + ((pSrcA[4] * pSrcB[7] + round) >> shift) +
+               ((pSrcA[5] * pSrcB[8] + round) >> shift);
+    pDstC[6] = ((pSrcA[6] * pSrcB[0] + round) >> shift) + ((pSrcA[7] * pSrcB[1] + round) >> shift) +
+               ((pSrcA[8] * pSrcB[2] + round) >> shift);
+    pDstC[7] = ((pSrcA[6] * pSrcB[3] + round) >> shift) + ((pSrcA[7] * pSrcB[4] + round) >> shift) +
+               ((pSrcA[8] * pSrcB[5] + round) >> shift);
+    pDstC[8] = ((pSrcA[6] * pSrcB[6] + round) >> shift) + ((pSrcA[7] * pSrcB[7] + round) >> shift) +
+               ((pSrcA[8] * pSrcB[8] + round) >> shift);
+}
+
+/**
+  @brief      4x4x4 matrix transposed matrix multiplication of 32-bit fixed-point matrices.
+  @param[in]  pSrcA  points to the first input matrix (4x4)
+  @param[in]  pSrcB  points to the second input matrix (4x4), which is transposed
+  @param[in]  shift  amount of bits to shift the products to the right
+  @param[out] pDstC  points to the output matrix (4x4)
+  @return     none
+ */
+
+static inline void plp_mat_mult_trans_4x4x4_q32(const int32_t *__restrict__ pSrcA,
+                                                const int32_t *__restrict__ pSrcB,
+                                                uint32_t shift,
+                                                int32_t *__restrict__ pDstC) {
+    int32_t round = (1 << shift) >> 1;
+
+    pDstC[0] = ((pSrcA[0] * pSrcB[0] + round) >> shift) + ((pSrcA[1] * pSrcB[1] + round) >> shift) +
+               ((pSrcA[2] * pSrcB[2] + round) >> shift) + ((pSrcA[3] * pSrcB[3] + round) >> shift);
+    pDstC[1] = ((pSrcA[0] * pSrcB[4] + round) >> shift) + ((pSrcA[1] * pSrcB[5] + round) >> shift) +
+               ((pSrcA[2] * pSrcB[6] + round) >> shift) + ((pSrcA[3] * pSrcB[7] + round) >> shift);
+    pDstC[2] = ((pSrcA[0] * pSrcB[8] + round) >> shift) + ((pSrcA[1] * pSrcB[9] + round) >> shift) +
+               ((pSrcA[2] * pSrcB[10] + round) >> shift) +
+               ((pSrcA[3] * pSrcB[11] + round) >> shift);
+    pDstC[3] = ((pSrcA[0] * pSrcB[12] + round) >> shift) +
+               ((pSrcA[1] * pSrcB[13] + round) >> shift) +
+               ((pSrcA[2] * pSrcB[14] + round) >> shift) +
+               ((pSrcA[3] * pSrcB[15] + round) >> shift);
+    pDstC[4] = ((pSrcA[4] * pSrcB[0] + round) >> shift) + ((pSrcA[5] * pSrcB[1] + round) >> shift) +
+               ((pSrcA[6] * pSrcB[2] + round) >> shift) + ((pSrcA[7] * pSrcB[3] + round) >> shift);
+    pDstC[5] = ((pSrcA[4] * pSrcB[4] + round) >> shift) + ((pSrcA[5] * pSrcB[5] + round) >> shift) +
+               ((pSrcA[6] * pSrcB[6] + round) >> shift) + ((pSrcA[7] * pSrcB[7] + round) >> shift);
+    pDstC[6] = ((pSrcA[4] * pSrcB[8] + round) >> shift) + ((pSrcA[5] * pSrcB[9] + round) >> shift) +
+               ((pSrcA[6] * pSrcB[10] + round) >> shift) +
+               ((pSrcA[7] * pSrcB[11] + round) >> shift);
+    pDstC[7] = ((pSrcA[4] * pSrcB[12] + round) >> shift) +
+               ((pSrcA[5] * pSrcB[13] + round) >> shift) +
+               ((pSrcA[6] * pSrcB[14] + round) >> shift) +
+               ((pSrcA[7] * pSrcB[15] + round) >> shift);
+    pDstC[8] = ((pSrcA[8] * pSrcB[0] + round) >> shift) + ((pSrcA[9] * pSrcB[1] + round) >> shift) +
+               ((pSrcA[10] * pSrcB[2] + round) >> shift) +
+               ((pSrcA[11] * pSrcB[3] + round) >> shift);
+    pDstC[9] = ((pSrcA[8] * pSrcB[4] + round) >> shift) + ((pSrcA[9] * pSrcB[5] + round) >> shift) +
+               ((pSrcA[10] * pSrcB[6] + round) >> shift) +
+               ((pSrcA[11] * pSrcB[7] + round) >> shift);
+    pDstC[10] = ((pSrcA[8] * pSrcB[8] + round) >> shift) +
+                ((pSrcA[9] * pSrcB[9] + round) >> shift) +
+                ((pSrcA[10] * pSrcB[10] + round) >> shift) +
+                ((pSrcA[11] * pSrcB[11] + round) >> shift);
+    pDstC[11] = ((pSrcA[8] * pSrcB[12] + round) >> shift) +
+                ((pSrcA[9] * pSrcB[13] + round) >> shift) +
+                ((pSrcA[10] * pSrcB[14] + round) >> shift) +
+                ((pSrcA[11] * pSrcB[15] + round) >> shift);
+    pDstC[12] = ((pSrcA[12] * pSrcB[0] + round) >> shift) +
+                ((pSrcA[13] * pSrcB[1] + round) >> shift) +
+                ((pSrcA[14] * pSrcB[2] + round) >> shift) +
+                ((pSrcA[15] * pSrcB[3] + round) >> shift);
+    pDstC[13] = ((pSrcA[12] * pSrcB[4] + round) >> shift) +
+                ((pSrcA[13] * pSrcB[5] + round) >> shift) +
+                ((pSrcA[14] * pSrcB[6] + round) >> shift) +
+                ((pSrcA[15] * pSrcB[7] + round) >> shift);
+    pDstC[14] = ((pSrcA[12] * pSrcB[8] + round) >> shift) +
+                ((pSrcA[13] * pSrcB[9] + round) >> shift) +
+                ((pSrcA[14] * pSrcB[10] + round) >> shift) +
+                ((pSrcA[15] * pSrcB[11] + round) >> shift);
+    pDstC[15] = ((pSrcA[12] * pSrcB[12] + round) >> shift) +
+                ((pSrcA[13] * pSrcB[13] + round) >> shift) +
+                ((pSrcA[14] * pSrcB[14] + round) >> shift) +
+                ((pSrcA[15] * pSrcB[15] + round) >> shift);
+}
+
+/**
+  @brief      2x2x2 matrix multiplication of 16-bit fixed-point matrices.
+  @param[in]  pSrcA  points to the first input matrix (2x2)
+  @param[in]  pSrcB  points to the second input matrix (2x2)
+  @param[in]  shift  amount of bits to shift the products to the right
+  @param[out] pDstC  points to the output matrix (2x2)
+  @return     none
+ */
+
+static inline void plp_mat_mult_2x2x2_q16(const int16_t *__restrict__ pSrcA,
+                                          const int16_t *__restrict__ pSrcB,
+                                          uint32_t shift,
+                                          int16_t *__restrict__ pDstC) {
+    int32_t round = (1 << shift) >> 1;
+
+    pDstC[0] = (int16_t)((((int32_t)pSrcA[0] * pSrcB[0] + round) >> shift) +
+                         (((int32_t)pSrcA[1] * pSrcB[2] + round) >> shift));
+    pDstC[1] = (int16_t)((((int32_t)pSrcA[0] * pSrcB[1] + round) >> shift) +
+                         (((int32_t)pSrcA[1] * pSrcB[3] + round) >> shift));
+    pDstC[2] = (int16_t)((((int32_t)pSrcA[2] * pSrcB[0] + round) >> shift) +
+                         (((int32_t)pSrcA[3] * pSrcB[2] + round) >> shift));
+    pDstC[3] = (int16_t)((((int32_t)pSrcA[2] * pSrcB[1] + round) >> shift) +
+                         (((int32_t)pSrcA[3] * pSrcB[3] + round) >> shift));
+}
+
+/**
+  @brief      3x3x3 matrix multiplication of 16-bit fixed-point matrices.
+  @param[in]  pSrcA  points to the first input matrix (3x3)
+  @param[in]  pSrcB  points to the second input matrix (3x3)
+  @param[in]  shift  amount of bits to shift the products to the right
+  @param[out] pDstC  points to the output matrix (3x3)
+  @return     none
+ */
+
+static inline void plp_mat_mult_3x3x3_q16(const int16_t *__restrict__ pSrcA,
+                                          const int16_t *__restrict__ pSrcB,
+                                          uint32_t shift,
+                                          int16_t *__restrict__ pDstC) {
+    int32_t round = (1 << shift) >> 1;
+
+    pDstC[0] = (int16_t)((((int32_t)pSrcA[0] * pSrcB[0] + round) >> shift) +
+                         (((int32_t)pSrcA[1] * pSrcB[3] + round) >> shift) +
+                         (((int32_t)pSrcA[2] * pSrcB[6] + round) >> shift));
+    pDstC[1] = (int16_t)((((int32_t)pSrcA[0] * pSrcB[1] + round) >> shift) +
+                         (((int32_t)pSrcA[1] * pSrcB[4] + round) >> shift) +
+                         (((int32_t)pSrcA[2] * pSrcB[7] + round) >> shift));
+    pDstC[2] = (int16_t)((((int32_t)pSrcA[0] * pSrcB[2] + round) >> shift) +
+                         (((int32_t)pSrcA[1] * pSrcB[5] + round) >> shift) +
+                         (((int32_t)pSrcA[2] * pSrcB[8] + round) >> shift));
+    pDstC[3] = (int16_t)((((int32_t)pSrcA[3] * pSrcB[0] + round) >> shift) +
+                         (((int32_t)pSrcA[4] * pSrcB[3] + round) >> shift) +
+                         (((int32_t)pSrcA[5] * pSrcB[6] + round) >> shift));
+    pDstC[4] = (int16_t)((((int32_t)pSrcA[3] * pSrcB[1] + round) >> shift) +
+                         (((int32_t)pSrcA[4] * pSrcB[4] + round) >> shift) +
+                         (((int32_t)pSrcA[5] * pSrcB[7] + round) >> shift));
+    pDstC[5] = (int16_t)((((int32_t)pSrcA[3] * pSrcB[2] + round) >> shift) +
+                         (((int32_t)pSrcA[4] * pSrcB[5] + round) >> shift) +
+                         (((int32_t)pSrcA[5] * pSrcB[8] + round) >> shift));
+    pDstC[6] = (int16_t)((((int32_t)pSrcA[6] * pSrcB[0] + round) >> shift) +
+                         (((int32_t)pSrcA[7] * pSrcB[3] + round) >> shift) +
+                         (((int32_t)pSrcA[8] * pSrcB[6] + round) >> shift));
+    pDstC[7] = (int16_t)((((int32_t)pSrcA[6] * pSrcB[1] + round) >> shift) +
+                         (((int32_t)pSrcA[7] * pSrcB[4] + round) >> shift) +
+                         (((int32_t)pSrcA[8] * pSrcB[7] + round) >> shift));
+    pDstC[8] = (int16_t)((((int32_t)pSrcA[6] * pSrcB[2] + round) >> shift) +
+                         (((int32_t)pSrcA[7] * pSrcB[5] + round) >> shift) +
+                         (((int32_t)pSrcA[8] * pSrcB[8] + round) >> shift));
+}
+
+/**
+  @brief      4x4x4 matrix multiplication of 16-bit fixed-point matrices.
+  @param[in]  pSrcA  points to the first input matrix (4x4)
+  @param[in]  pSrcB  points to the second input matrix (4x4)
+  @param[in]  shift  amount of bits to shift the products to the right
+  @param[out] pDstC  points to the output matrix (4x4)
+  @return     none
+ */
+
+static inline void plp_mat_mult_4x4x4_q16(const int16_t *__restrict__ pSrcA,
+                                          const int16_t *__restrict__ pSrcB,
+                                          uint32_t shift,
+                                          int16_t *__restrict__ pDstC) {
+    int32_t round = (1 << shift) >> 1;
+
+    pDstC[0] = (int16_t)((((int32_t)pSrcA[0] * pSrcB[0] + round) >> shift) +
+                         (((int32_t)pSrcA[1] * pSrcB[4] + round) >> shift) +
+                         (((int32_t)pSrcA[2] * pSrcB[8] + round) >> shift) +
+                         (((int32_t)pSrcA[3] * pSrcB[12] + round) >> shift));
+    pDstC[1] = (int16_t)((((int32_t)pSrcA[0] * pSrcB[1] + round) >> shift) +
+                         (((int32_t)pSrcA[1] * pSrcB[5] + round) >> shift) +
+                         (((int32_t)pSrcA[2] * pSrcB[9] + round) >> shift) +
+                         (((int32_t)pSrcA[3] * pSrcB[13] + round) >> shift));
+    pDstC[2] = (int16_t)((((int32_t)pSrcA[0] * pSrcB[2] + round) >> shift) +
+                         (((int32_t)pSrcA[1] * pSrcB[6] + round) >> shift) +
+                         (((int32_t)pSrcA[2] * pSrcB[10] + round) >> shift) +
+                         (((int32_t)pSrcA[3] * pSrcB[14] + round) >> shift));
+    pDstC[3] = (int16_t)((((int32_t)pSrcA[0] * pSrcB[3] + round) >> shift) +
+                         (((int32_t)pSrcA[1] * pSrcB[7] + round) >> shift) +
+                         (((int32_t)pSrcA[2] * pSrcB[11] + round) >> shift) +
+                         (((int32_t)pSrcA[3] * pSrcB[15] + round) >> shift));
+    pDstC[4] = (int16_t)((((int32_t)pSrcA[4] * pSrcB[0] + round) >> shift) +
+                         (((int32_t)pSrcA[5] * pSrcB[4] + round) >> shift) +
+                         (((int32_t)pSrcA[6] * pSrcB[8] + round) >> shift) +
+                         (((int32_t)pSrcA[7] * pSrcB[12] + round) >> shift));
+    pDstC[5] = (int16_t)((((int32_t)pSrcA[4] * pSrcB[1] + round) >> shift) +
+                         (((int32_t)pSrcA[5] * pSrcB[5] + round) >> shift) +
+                         (((int32_t)pSrcA[6] * pSrcB[9] + round) >> shift) +
+                         (((int32_t)pSrcA[7] * pSrcB[13] + round) >> shift));
+    pDstC[6] = (int16_t)((((int32_t)pSrcA[4] * pSrcB[2] + round) >> shift) +
+                         (((int32_t)pSrcA[5] * pSrcB[6] + round) >> shift) +
+                         (((int32_t)pSrcA[6] * pSrcB[10] + round) >> shift) +
+                         (((int32_t)pSrcA[7] * pSrcB[14] + round) >> shift));
+    pDstC[7] = (int16_t)((((int32_t)pSrcA[4] * pSrcB[3] + round) >> shift) +
+                         (((int32_t)pSrcA[5] * pSrcB[7] + round) >> shift) +
+                         (((int32_t)pSrcA[6] * pSrcB[11] + round) >> shift) +
+                         (((int32_t)pSrcA[7] * pSrcB[15] + round) >> shift));
+    pDstC[8] = (int16_t)((((int32_t)pSrcA[8] * pSrcB[0] + round) >> shift) +
+                         (((int32_t)pSrcA[9] * pSrcB[4] + round) >> shift) +
+                         (((int32_t)pSrcA[10] * pSrcB[8] + round) >> shift) +
+                         (((int32_t)pSrcA[11] * pSrcB[12] + round) >> shift));
+    pDstC[9] = (int16_t)((((int32_t)pSrcA[8] * pSrcB[1] + round) >> shift) +
+                         (((int32_t)pSrcA[9] * pSrcB[5] + round) >> shift) +
+                         (((int32_t)pSrcA[10] * pSrcB[9] + round) >> shift) +
+                         (((int32_t)pSrcA[11] * pSrcB[13] + round) >> shift));
+    pDstC[10] = (int16_t)((((int32_t)pSrcA[8] * pSrcB[2] + round) >> shift) +
+                          (((int32_t)pSrcA[9] * pSrcB[6] + round) >> shift) +
+                          (((int32_t)pSrcA[10] * pSrcB[10] + round) >> shift) +
+                          (((int32_t)pSrcA[11] * pSrcB[14] + round) >> shift));
+    pDstC[11] = (int16_t)((((int32_t)pSrcA[8] * pSrcB[3] + round) >> shift) +
+                          (((int32_t)pSrcA[9] * pSrcB[7] + round) >> shift) +
+                          (((int32_t)pSrcA[10] * pSrcB[11] + round) >> shift) +
+                          (((int32_t)pSrcA[11] * pSrcB[15] + round) >> shift));
+    pDstC[12] = (int16_t)((((int32_t)pSrcA[12] * pSrcB[0] + round) >> shift) +
+                          (((int32_t)pSrcA[13] * pSrcB[4] + round) >> shift) +
+                          (((int32_t)pSrcA[14] * pSrcB[8] + round) >> shift) +
+                          (((int32_t)pSrcA[15] * pSrcB[12] + round) >> shift));
+    pDstC[13] = (int16_t)((((int32_t)pSrcA[12] * pSrcB[1] + round) >> shift) +
+                          (((int32_t)pSrcA[13] * pSrcB[5] + round) >> shift) +
+                          (((int32_t)pSrcA[14] * pSrcB[9] + round) >> shift) +
+                          (((int32_t)pSrcA[15] * pSrcB[13] + round) >> shift));
+    pDstC[14] = (int16_t)((((int32_t)pSrcA[12] * pSrcB[2] + round) >> shift) +
+                          (((int32_t)pSrcA[13] * pSrcB[6] + round) >> shift) +
+                          (((int32_t)pSrcA[14] * pSrcB[10] + round) >> shift) +
+                          (((int32_t)pSrcA[15] * pSrcB[14] + round) >> shift));
+    pDstC[15] = (int16_t)((((int32_t)pSrcA[12] * pSrcB[3] + round) >> shift) +
+                          (((int32_t)pSrcA[13] * pSrcB[7] + round) >> shift) +
+                          (((int32_t)pSrcA[14] * pSrcB[11] + round) >> shift) +
+                          (((int32_t)pSrcA[15] * pSrcB[15] + round) >> shift));
+}
+
+/**
+  @brief      2x2x1 matrix multiplication of 16-bit fixed-point matrices.
+  @param[in]  pSrcA  points to the first input matrix (2x2)
+  @param[in]  pSrcB  points to the second input matrix (2x1)
+  @param[in]  shift  amount of bits to shift the products to the right
+  @param[out] pDstC  points to the output matrix (2x1)
+  @return     none
+ */
+
+static inline void plp_mat_mult_2x2x1_q16(const int16_t *__restrict__ pSrcA,
+                                          const int16_t *__restrict__ pSrcB,
+                                          uint32_t shift,
+                                          int16_t *__restrict__ pDstC) {
+    int32_t round = (1 << shift) >> 1;
+
+    pDstC[0] = (int16_t)((((int32_t)pSrcA[0] * pSrcB[0] + round) >> shift) +
+                         (((int32_t)pSrcA[1] * pSrcB[1] + round) >> shift));
+    pDstC[1] = (int16_t)((((int32_t)pSrcA[2] * pSrcB[0] + round) >> shift) +
+                         (((int32_t)pSrcA[3] * pSrcB[1] + round) >> shift));
+}
+
+/**
+  @brief      3x3x1 matrix multiplication of 16-bit fixed-point matrices.
+  @param[in]  pSrcA  points to the first input matrix (3x3)
+  @param[in]  pSrcB  points to the second input matrix (3x1)
+  @param[in]  shift  amount of bits to shift the products to the right
+  @param[out] pDstC  points to the output matrix (3x1)
+  @return     none
+ */
+
+static inline void plp_mat_mult_3x3x1_q16(const int16_t *__restrict__ pSrcA,
+                                          const int16_t *__restrict__ pSrcB,
+                                          uint32_t shift,
+                                          int16_t *__restrict__ pDstC) {
+    int32_t round = (1 << shift) >> 1;
+
+    pDstC[0] = (int16_t)((((int32_t)pSrcA[0] * pSrcB[0] + round) >> shift) +
+                         (((int32_t)pSrcA[1] * pSrcB[1] + round) >> shift) +
+                         (((int32_t)pSrcA[2] * pSrcB[2] + round) >> shift));
+    pDstC[1] = (int16_t)((((int32_t)pSrcA[3] * pSrcB[0] + round) >> shift) +
+                         (((int32_t)pSrcA[4] * pSrcB[1] + round) >> shift) +
+                         (((int32_t)pSrcA[5] * pSrcB[2] + round) >> shift));
+    pDstC[2] = (int16_t)((((int32_t)pSrcA[6] * pSrcB[0] + round) >> shift) +
+                         (((int32_t)pSrcA[7] * pSrcB[1] + round) >> shift) +
+                         (((int32_t)pSrcA[8] * pSrcB[2] + round) >> shift));
+}
+
+/**
+  @brief      4x4x1 matrix multiplication of 16-bit fixed-point matrices.
+  @param[in]  pSrcA  points to the first input matrix (4x4)
+  @param[in]  pSrcB  points to the second input matrix (4x1)
+  @param[in]  shift  amount of bits to shift the products to the right
+  @param[out] pDstC  points to the output matrix (4x1)
+  @return     none
+ */
+
+static inline void plp_mat_mult_4x4x1_q16(const int16_t *__restrict__ pSrcA,
+                                          const int16_t *__restrict__ pSrcB,
+                                          uint32_t shift,
+                                          int16_t *__restrict__ pDstC) {
+    int32_t round = (1 << shift) >> 1;
+
+    pDstC[0] = (int16_t)((((int32_t)pSrcA[0] * pSrcB[0] + round) >> shift) +
+                         (((int32_t)pSrcA[1] * pSrcB[1] + round) >> shift) +
+                         (((int32_t)pSrcA[2] * pSrcB[2] + round) >> shift) +
+                         (((int32_t)pSrcA[3] * pSrcB[3] + round) >> shift));
+    pDstC[1] = (int16_t)((((int32_t)pSrcA[4] * pSrcB[0] + round) >> shift) +
+                         (((int32_t)pSrcA[5] * pSrcB[1] + round) >> shift) +
+                         (((int32_t)pSrcA[6] * pSrcB[2] + round) >> shift) +
+                         (((int32_t)pSrcA[7] * pSrcB[3] + round) >> shift));
+    pDstC[2] = (int16_t)((((int32_t)pSrcA[8] * pSrcB[0] + round) >> shift) +
+                         (((int32_t)pSrcA[9] * pSrcB[1] + round) >> shift) +
+                         (((int32_t)pSrcA[10] * pSrcB[2] + round) >> shift) +
+                         (((int32_t)pSrcA[11] * pSrcB[3] + round) >> shift));
+    pDstC[3] = (int16_t)((((int32_t)pSrcA[12] * pSrcB[0] + round) >> shift) +
+                         (((int32_t)pSrcA[13] * pSrcB[1] + round) >> shift) +
+                         (((int32_t)pSrcA[14] * pSrcB[2] + round) >> shift) +
+                         (((int32_t)pSrcA[15] * pSrcB[3] + round) >> shift));
+}
+
+/**
+  @brief      2x2x2 matrix transposed matrix multiplication of 16-bit fixed-point matrices.
+  @param[in]  pSrcA  points to the first input matrix (2x2)
+  @param[in]  pSrcB  points to the second input matrix (2x2), which is transposed
+  @param[in]  shift  amount of bits to shift the products to the right
+  @param[out] pDstC  points to the output matrix (2x2)
+  @return     none
+ */
+
+static inline void plp_mat_mult_trans_2x2x2_q16(const int16_t *__restrict__ pSrcA,
+                                                const int16_t *__restrict__ pSrcB,
+                                                uint32_t shift,
+                                                int16_t *__restrict__ pDstC) {
+    int32_t round = (1 << shift) >> 1;
+
+    pDstC[0] = (int16_t)((((int32_t)pSrcA[0] * pSrcB[0] + round) >> shift) +
+                         (((int32_t)pSrcA[1] * pSrcB[1] + round) >> shift));
+    pDstC[1] = (int16_t)((((int32_t)pSrcA[0] * pSrcB[2] + round) >> shift) +
+                         (((int32_t)pSrcA[1] * pSrcB[3] + round) >> shift));
+    pDstC[2] = (int16_t)((((int32_t)pSrcA[2] * pSrcB[0] + round) >> shift) +
+                         (((int32_t)pSrcA[3] * pSrcB[1] + round) >> shift));
+    pDstC[3] = (int16_t)((((int32_t)pSrcA[2] * pSrcB[2] + round) >> shift) +
+                         (((int32_t)pSrcA[3] * pSrcB[3] + round) >> shift));
+}
+
+/**
+  @brief      3x3x3 matrix transposed matrix multiplication of 16-bit fixed-point matrices.
+  @param[in]  pSrcA  points to the first input matrix (3x3)
+  @param[in]  pSrcB  points to the second input matrix (3x3), which is transposed
+  @param[in]  shift  amount of bits to shift the products to the right
+  @param[out] pDstC  points to the output matrix (3x3)
+  @return     none
+ */
+
+static inline void plp_mat_mult_trans_3x3x3_q16(const int16_t *__restrict__ pSrcA,
+                                                const int16_t *__restrict__ pSrcB,
+                                                uint32_t shift,
+                                                int16_t *__restrict__ pDstC) {
+    int32_t round = (1 << shift) >> 1;
+
+    pDstC[0] = (int16_t)((((int32_t)pSrcA[0] * pSrcB[0] + round) >> shift) +
+                         (((int32_t)pSrcA[1] * pSrcB[1] + round) >> shift) +
+                         (((int32_t)pSrcA[2] * pSrcB[2] + round) >> shift));
+    pDstC[1] = (int16_t)((((int32_t)pSrcA[0] * pSrcB[3] + round) >> shift) +
+                         (((int32_t)pSrcA[1] * pSrcB[4] + round) >> shift) +
+                         (((int32_t)pSrcA[2] * pSrcB[5] + round) >> shift));
+    pDstC[2] = (int16_t)((((int32_t)pSrcA[0] * pSrcB[6] + round) >> shift) +
+                         (((int32_t)pSrcA[1] * pSrcB[7] + round) >> shift) +
+                         (((int32_t)pSrcA[2] * pSrcB[8] + round) >> shift));
+    pDstC[3] = (int16_t)((((int32_t)pSrcA[3] * pSrcB[0] + round) >> shift) +
+                         (((int32_t)pSrcA[4] * pSrcB[1] + round) >> shift) +
+                         (((int32_t)pSrcA[5] * pSrcB[2] + round) >> shift));
+    pDstC[4] = (int16_t)((((int32_t)pSrcA[3] * pSrcB[3] + round) >> shift) +
+                         (((int32_t)pSrcA[4] * pSrcB[4] + round) >> shift) +
+                         (((int32_t)pSrcA[5] * pSrcB[5] + round) >> shift));
+    pDstC[5] = (int16_t)((((int32_t)pSrcA[3] * pSrcB[6] + round) >> shift) +
+                         (((int32_t)pSrcA[4] * pSrcB[7] + round) >> shift) +
+                         (((int32_t)pSrcA[5] * pSrcB[8] + round) >> shift));
+    pDstC[6] = (int16_t)((((int32_t)pSrcA[6] * pSrcB[0] + round) >> shift) +
+                         (((int32_t)pSrcA[7] * pSrcB[1] + round) >> shift) +
+                         (((int32_t)pSrcA[8] * pSrcB[2] + round) >> shift));
+    pDstC[7] = (int16_t)((((int32_t)pSrcA[6] * pSrcB[3] + round) >> shift) +
+                         (((int32_t)pSrcA[7] * pSrcB[4] + round) >> shift) +
+                         (((int32_t)pSrcA[8] * pSrcB[5] + round) >> shift));
+    pDstC[8] = (int16_t)((((int32_t)pSrcA[6] * pSrcB[6] + round) >> shift) +
+                         (((int32_t)pSrcA[7] * pSrcB[7] + round) >> shift) +
+                         (((int32_t)pSrcA[8] * pSrcB[8] + round) >> shift));
+}
+
+/**
+  @brief      4x4x4 matrix transposed matrix multiplication of 16-bit fixed-point matrices.
+  @param[in]  pSrcA  points to the first input matrix (4x4)
+  @param[in]  pSrcB  points to the second input matrix (4x4), which is transposed
+  @param[in]  shift  amount of bits to shift the products to the right
+  @param[out] pDstC  points to the output matrix (4x4)
+  @return     none
+ */
+
+static inline void plp_mat_mult_trans_4x4x4_q16(const int16_t *__restrict__ pSrcA,
+                                                const int16_t *__restrict__ pSrcB,
+                                                uint32_t shift,
+                                                int16_t *__restrict__ pDstC) {
+    int32_t round = (1 << shift) >> 1;
+
+    pDstC[0] = (int16_t)((((int32_t)pSrcA[0] * pSrcB[0] + round) >> shift) +
+                         (((int32_t)pSrcA[1] * pSrcB[1] + round) >> shift) +
+                         (((int32_t)pSrcA[2] * pSrcB[2] + round) >> shift) +
+                         (((int32_t)pSrcA[3] * pSrcB[3] + round) >> shift));
+    pDstC[1] = (int16_t)((((int32_t)pSrcA[0] * pSrcB[4] + round) >> shift) +
+                         (((int32_t)pSrcA[1] * pSrcB[5] + round) >> shift) +
+                         (((int32_t)pSrcA[2] * pSrcB[6] + round) >> shift) +
+                         (((int32_t)pSrcA[3] * pSrcB[7] + round) >> shift));
+    pDstC[2] = (int16_t)((((int32_t)pSrcA[0] * pSrcB[8] + round) >> shift) +
+                         (((int32_t)pSrcA[1] * pSrcB[9] + round) >> shift) +
+                         (((int32_t)pSrcA[2] * pSrcB[10] + round) >> shift) +
+                         (((int32_t)pSrcA[3] * pSrcB[11] + round) >> shift));
+    pDstC[3] = (int16_t)((((int32_t)pSrcA[0] * pSrcB[12] + round) >> shift) +
+                         (((int32_t)pSrcA[1] * pSrcB[13] + round) >> shift) +
+                         (((int32_t)pSrcA[2] * pSrcB[14] + round) >> shift) +
+                         (((int32_t)pSrcA[3] * pSrcB[15] + round) >> shift));
+    pDstC[4] = (int16_t)((((int32_t)pSrcA[4] * pSrcB[0] + round) >> shift) +
+                         (((int32_t)pSrcA[5] * pSrcB[1] + round) >> shift) +
+                         (((int32_t)pSrcA[6] * pSrcB[2] + round) >> shift) +
+                         (((int32_t)pSrcA[7] * pSrcB[3] + round) >> shift));
+    pDstC[5] = (int16_t)((((int32_t)pSrcA[4] * pSrcB[4] + round) >> shift) +
+                         (((int32_t)pSrcA[5] * pSrcB[5] + round) >> shift) +
+                         (((int32_t)pSrcA[6] * pSrcB[6] + round) >> shift) +
+                         (((int32_t)pSrcA[7] * pSrcB[7] + round) >> shift));
+    pDstC[6] = (int16_t)((((int32_t)pSrcA[4] * pSrcB[8] + round) >> shift) +
+                         (((int32_t)pSrcA[5] * pSrcB[9] + round) >> shift) +
+                         (((int32_t)pSrcA[6] * pSrcB[10] + round) >> shift) +
+                         (((int32_t)pSrcA[7] * pSrcB[11] + round) >> shift));
+    pDstC[7] = (int16_t)((((int32_t)pSrcA[4] * pSrcB[12] + round) >> shift) +
+                         (((int32_t)pSrcA[5] * pSrcB[13] + round) >> shift) +
+                         (((int32_t)pSrcA[6] * pSrcB[14] + round) >> shift) +
+                         (((int32_t)pSrcA[7] * pSrcB[15] + round) >> shift));
+    pDstC[8] = (int16_t)((((int32_t)pSrcA[8] * pSrcB[0] + round) >> shift) +
+                         (((int32_t)pSrcA[9] * pSrcB[1] + round) >> shift) +
+                         (((int32_t)pSrcA[10] * pSrcB[2] + round) >> shift) +
+                         (((int32_t)pSrcA[11] * pSrcB[3] + round) >> shift));
+    pDstC[9] = (int16_t)((((int32_t)pSrcA[8] * pSrcB[4] + round) >> shift) +
+                         (((int32_t)pSrcA[9] * pSrcB[5] + round) >> shift) +
+                         (((int32_t)pSrcA[10] * pSrcB[6] + round) >> shift) +
+                         (((int32_t)pSrcA[11] * pSrcB[7] + round) >> shift));
+    pDstC[10] = (int16_t)((((int32_t)pSrcA[8] * pSrcB[8] + round) >> shift) +
+                          (((int32_t)pSrcA[9] * pSrcB[9] + round) >> shift) +
+                          (((int32_t)pSrcA[10] * pSrcB[10] + round) >> shift) +
+                          (((int32_t)pSrcA[11] * pSrcB[11] + round) >> shift));
+    pDstC[11] = (int16_t)((((int32_t)pSrcA[8] * pSrcB[12] + round) >> shift) +
+                          (((int32_t)pSrcA[9] * pSrcB[13] + round) >> shift) +
+                          (((int32_t)pSrcA[10] * pSrcB[14] + round) >> shift) +
+                          (((int32_t)pSrcA[11] * pSrcB[15] + round) >> shift));
+    pDstC[12] = (int16_t)((((int32_t)pSrcA[12] * pSrcB[0] + round) >> shift) +
+                          (((int32_t)pSrcA[13] * pSrcB[1] + round) >> shift) +
+                          (((int32_t)pSrcA[14] * pSrcB[2] + round) >> shift) +
+                          (((int32_t)pSrcA[15] * pSrcB[3] + round) >> shift));
+    pDstC[13] = (int16_t)((((int32_t)pSrcA[12] * pSrcB[4] + round) >> shift) +
+                          (((int32_t)pSrcA[13] * pSrcB[5] + round) >> shift) +
+                          (((int32_t)pSrcA[14] * pSrcB[6] + round) >> shift) +
+                          (((int32_t)pSrcA[15] * pSrcB[7] + round) >> shift));
+    pDstC[14] = (int16_t)((((int32_t)pSrcA[12] * pSrcB[8] + round) >> shift) +
+                          (((int32_t)pSrcA[13] * pSrcB[9] + round) >> shift) +
+                          (((int32_t)pSrcA[14] * pSrcB[10] + round) >> shift) +
+                          (((int32_t)pSrcA[15] * pSrcB[11] + round) >> shift));
+    pDstC[15] = (int16_t)((((int32_t)pSrcA[12] * pSrcB[12] + round) >> shift) +
+                          (((int32_t)pSrcA[13] * pSrcB[13] + round) >> shift) +
+                          (((int32_t)pSrcA[14] * pSrcB[14] + round) >> shift) +
+                          (((int32_t)pSrcA[15] * pSrcB[15] + round) >> shift));
+}
+
+/**
+  @brief      2x2x2 matrix multiplication of 32-bit floating-point matrices.
+  @param[in]  pSrcA  points to the first input matrix (2x2)
+  @param[in]  pSrcB  points to the second input matrix (2x2)
+  @param[out] pDstC  points to the output matrix (2x2)
+  @return     none
+ */
+
+static inline void plp_mat_mult_2x2x2_f32(const float *__restrict__ pSrcA,
+                                          const float *__restrict__ pSrcB,
+                                          float *__restrict__ pDstC) {
+    pDstC[0] = pSrcA[0] * pSrcB[0] + pSrcA[1] * pSrcB[2];
+    pDstC[1] = pSrcA[0] * pSrcB[1] + pSrcA[1] * pSrcB[3];
+    pDstC[2] = pSrcA[2] * pSrcB[0] + pSrcA[3] * pSrcB[2];
+    pDstC[3] = pSrcA[2] * pSrcB[1] + pSrcA[3] * pSrcB[3];
+}
+
+/**
+  @brief      3x3x3 matrix multiplication of 32-bit floating-point matrices.
+  @param[in]  pSrcA  points to the first input matrix (3x3)
+  @param[in]  pSrcB  points to the second input matrix (3x3)
+  @param[out] pDstC  points to the output matrix (3x3)
+  @return     none
+ */
+
+static inline void plp_mat_mult_3x3x3_f32(const float *__restrict__ pSrcA,
+                                          const float *__restrict__ pSrcB,
+                                          float *__restrict__ pDstC) {
+    pDstC[0] = pSrcA[0] * pSrcB[0] + pSrcA[1] * pSrcB[3] + pSrcA[2] * pSrcB[6];
+    pDstC[1] = pSrcA[0] * pSrcB[1] + pSrcA[1] * pSrcB[4] + pSrcA[2] * pSrcB[7];
+    pDstC[2] = pSrcA[0] * pSrcB[2] + pSrcA[1] * pSrcB[5] + pSrcA[2] * pSrcB[8];
+    pDstC[3] = pSrcA[3] * pSrcB[0] + pSrcA[4] * pSrcB[3] + pSrcA[5] * pSrcB[6];
+    pDstC[4] = pSrcA[3] * pSrcB[1] + pSrcA[4] * pSrcB[4] + pSrcA[5] * pSrcB[7];
+    pDstC[5] = pSrcA[3] * pSrcB[2] + pSrcA[4] * pSrcB[5] + pSrcA[5] * pSrcB[8];
+    pDstC[6] = pSrcA[6] * pSrcB[0] + pSrcA[7] * pSrcB[3] + pSrcA[8] * pSrcB[6];
+    pDstC[7] = pSrcA[6] * pSrcB[1] + pSrcA[7] * pSrcB[4] + pSrcA[8] * pSrcB[7];
+    pDstC[8] = pSrcA[6] * pSrcB[2] + pSrcA[7] * pSrcB[5] + pSrcA[8] * pSrcB[8];
+}
+
+/**
+  @brief      4x4x4 matrix multiplication of 32-bit floating-point matrices.
+  @param[in]  pSrcA  points to the first input matrix (4x4)
+  @param[in]  pSrcB  points to the second input matrix (4x4)
+  @param[out] pDstC  points to the output matrix (4x4)
+  @return     none
+ */
+
+static inline void plp_mat_mult_4x4x4_f32(const float *__restrict__ pSrcA,
+                                          const float *__restrict__ pSrcB,
+                                          float *__restrict__ pDstC) {
+    pDstC[0] = pSrcA[0] * pSrcB[0] + pSrcA[1] * pSrcB[4] + pSrcA[2] * pSrcB[8] +
+               pSrcA[3] * pSrcB[12];
+    pDstC[1] = pSrcA[0] * pSrcB[1] + pSrcA[1] * pSrcB[5] + pSrcA[2] * pSrcB[9] +
+               pSrcA[3] * pSrcB[13];
+    pDstC[2] = pSrcA[0] * pSrcB[2] + pSrcA[1] * pSrcB[6] + pSrcA[2] * pSrcB[10] +
+               pSrcA[3] * pSrcB[14];
+    pDstC[3] = pSrcA[0] * pSrcB[3] + pSrcA[1] * pSrcB[7] + pSrcA[2] * pSrcB[11] +
+               pSrcA[3] * pSrcB[15];
+    pDstC[4] = pSrcA[4] * pSrcB[0] + pSrcA[5] * pSrcB[4] + pSrcA[6] * pSrcB[8] +
+               pSrcA[7] * pSrcB[12];
+    pDstC[5] = pSrcA[4] * pSrcB[1] + pSrcA[5] * pSrcB[5] + pSrcA[6] * pSrcB[9] +
+               pSrcA[7] * pSrcB[13];
+    pDstC[6] = pSrcA[4] * pSrcB[2] + pSrcA[5] * pSrcB[6] + pSrcA[6] * pSrcB[10] +
+               pSrcA[7] * pSrcB[14];
+    pDstC[7] = pSrcA[4] * pSrcB[3] + pSrcA[5] * pSrcB[7] + pSrcA[6] * pSrcB[11] +
+               pSrcA[7] * pSrcB[15];
+    pDstC[8] = pSrcA[8] * pSrcB[0] + pSrcA[9] * pSrcB[4] + pSrcA[10] * pSrcB[8] +
+               pSrcA[11] * pSrcB[12];
+    pDstC[9] = pSrcA[8] * pSrcB[1] + pSrcA[9] * pSrcB[5] + pSrcA[10] * pSrcB[9] +
+               pSrcA[11] * pSrcB[13];
+    pDstC[10] = pSrcA[8] * pSrcB[2] + pSrcA[9] * pSrcB[6] + pSrcA[10] * pSrcB[10] +
+                pSrcA[11] * pSrcB[14];
+    pDstC[11] = pSrcA[8] * pSrcB[3] + pSrcA[9] * pSrcB[7] + pSrcA[10] * pSrcB[11] +
+                pSrcA[11] * pSrcB[15];
+    pDstC[12] = pSrcA[12] * pSrcB[0] + pSrcA[13] * pSrcB[4] + pSrcA[14] * pSrcB[8] +
+                pSrcA[15] * pSrcB[12];
+    pDstC[13] = pSrcA[12] * pSrcB[1] + pSrcA[13] * pSrcB[5] + pSrcA[14] * pSrcB[9] +
+                pSrcA[15] * pSrcB[13];
+    pDstC[14] = pSrcA[12] * pSrcB[2] + pSrcA[13] * pSrcB[6] + pSrcA[14] * pSrcB[10] +
+                pSrcA[15] * pSrcB[14];
+    pDstC[15] = pSrcA[12] * pSrcB[3] + pSrcA[13] * pSrcB[7] + pSrcA[14] * pSrcB[11] +
+                pSrcA[15] * pSrcB[15];
+}
+
+/**
+  @brief      2x2x1 matrix multiplication of 32-bit floating-point matrices.
+  @param[in]  pSrcA  points to the first input matrix (2x2)
+  @param[in]  pSrcB  points to the second input matrix (2x1)
+  @param[out] pDstC  points to the output matrix (2x1)
+  @return     none
+ */
+
+static inline void plp_mat_mult_2x2x1_f32(const float *__restrict__ pSrcA,
+                                          const float *__restrict__ pSrcB,
+                                          float *__restrict__ pDstC) {
+    pDstC[0] = pSrcA[0] * pSrcB[0] + pSrcA[1] * pSrcB[1];
+    pDstC[1] = pSrcA[2] * pSrcB[0] + pSrcA[3] * pSrcB[1];
+}
+
+/**
+  @brief      3x3x1 matrix multiplication of 32-bit floating-point matrices.
+  @param[in]  pSrcA  points to the first input matrix (3x3)
+  @param[in]  pSrcB  points to the second input matrix (3x1)
+  @param[out] pDstC  points to the output matrix (3x1)
+  @return     none
+ */
+
+static inline void plp_mat_mult_3x3x1_f32(const float *__restrict__ pSrcA,
+                                          const float *__restrict__ pSrcB,
+                                          float *__restrict__ pDstC) {
+    pDstC[0] = pSrcA[0] * pSrcB[0] + pSrcA[1] * pSrcB[1] + pSrcA[2] * pSrcB[2];
+    pDstC[1] = pSrcA[3] * pSrcB[0] + pSrcA[4] * pSrcB[1] + pSrcA[5] * pSrcB[2];
+    pDstC[2] = pSrcA[6] * pSrcB[0] + pSrcA[7] * pSrcB[1] + pSrcA[8] * pSrcB[2];
+}
+
+/**
+  @brief      4x4x1 matrix multiplication of 32-bit floating-point matrices.
+  @param[in]  pSrcA  points to the first input matrix (4x4)
+  @param[in]  pSrcB  points to the second input matrix (4x1)
+  @param[out] pDstC  points to the output matrix (4x1)
+  @return     none
+ */
+
+static inline void plp_mat_mult_4x4x1_f32(const float *__restrict__ pSrcA,
+                                          const float *__restrict__ pSrcB,
+                                          float *__restrict__ pDstC) {
+    pDstC[0] = pSrcA[0] * pSrcB[0] + pSrcA[1] * pSrcB[1] + pSrcA[2] * pSrcB[2] +
+               pSrcA[3] * pSrcB[3];
+    pDstC[1] = pSrcA[4] * pSrcB[0] + pSrcA[5] * pSrcB[1] + pSrcA[6] * pSrcB[2] +
+               pSrcA[7] * pSrcB[3];
+    pDstC[2] = pSrcA[8] * pSrcB[0] + pSrcA[9] * pSrcB[1] + pSrcA[10] * pSrcB[2] +
+               pSrcA[11] * pSrcB[3];
+    pDstC[3] = pSrcA[12] * pSrcB[0] + pSrcA[13] * pSrcB[1] + pSrcA[14] * pSrcB[2] +
+               pSrcA[15] * pSrcB[3];
+}
+
+/**
+  @brief      2x2x2 matrix transposed matrix multiplication of 32-bit floating-point matrices.
+  @param[in]  pSrcA  points to the first input matrix (2x2)
+  @param[in]  pSrcB  points to the second input matrix (2x2), which is transposed
+  @param[out] pDstC  points to the output matrix (2x2)
+  @return     none
+ */
+
+static inline void plp_mat_mult_trans_2x2x2_f32(const float *__restrict__ pSrcA,
+                                                const float *__restrict__ pSrcB,
+                                                float *__restrict__ pDstC) {
+    pDstC[0] = pSrcA[0] * pSrcB[0] + pSrcA[1] * pSrcB[1];
+    pDstC[1] = pSrcA[0] * pSrcB[2] + pSrcA[1] * pSrcB[3];
+    pDstC[2] = pSrcA[2] * pSrcB[0] + pSrcA[3] * pSrcB[1];
+    pDstC[3] = pSrcA[2] * pSrcB[2] + pSrcA[3] * pSrcB[3];
+}
+
+/**
+  @brief      3x3x3 matrix transposed matrix multiplication of 32-bit floating-point matrices.
+  @param[in]  pSrcA  points to the first input matrix (3x3)
+  @param[in]  pSrcB  points to the second input matrix (3x3), which is transposed
+  @param[out] pDstC  points to the output matrix (3x3)
+  @return     none
+ */
+
+static inline void plp_mat_mult_trans_3x3x3_f32(const float *__restrict__ pSrcA,
+                                                const float *__restrict__ pSrcB,
+                                                float *__restrict__ pDstC) {
+    pDstC[0] = pSrcA[0] * pSrcB[0] + pSrcA[1] * pSrcB[1] + pSrcA[2] * pSrcB[2];
+    pDstC[1] = pSrcA[0] * pSrcB[3] + pSrcA[1] * pSrcB[4] + pSrcA[2] * pSrcB[5];
+    pDstC[2] = pSrcA[0] * pSrcB[6] + pSrcA[1] * pSrcB[7] + pSrcA[2] * pSrcB[8];
+    pDstC[3] = pSrcA[3] * pSrcB[0] + pSrcA[4] * pSrcB[1] + pSrcA[5] * pSrcB[2];
+    pDstC[4] = pSrcA[3] * pSrcB[3] + pSrcA[4] * pSrcB[4] + pSrcA[5] * pSrcB[5];
+    pDstC[5] = pSrcA[3] * pSrcB[6] + pSrcA[4] * pSrcB[7] + pSrcA[5] * pSrcB[8];
+    pDstC[6] = pSrcA[6] * pSrcB[0] + pSrcA[7] * pSrcB[1] + pSrcA[8] * pSrcB[2];
+    pDstC[7] = pSrcA[6] * pSrcB[3] + pSrcA[7] * pSrcB[4] + pSrcA[8] * pSrcB[5];
+    pDstC[8] = pSrcA[6] * pSrcB[6] + pSrcA[7] * pSrcB[7] + pSrcA[8] * pSrcB[8];
+}
+
+/**
+  @brief      4x4x4 matrix transposed matrix multiplication of 32-bit floating-point matrices.
+  @param[in]  pSrcA  points to the first input matrix (4x4)
+  @param[in]  pSrcB  points to the second input matrix (4x4), which is transposed
+  @param[out] pDstC  points to the output matrix (4x4)
+  @return     none
+ */
+
+static inline void plp_mat_mult_trans_4x4x4_f32(const float *__restrict__ pSrcA,
+                                                const float *__restrict__ pSrcB,
+                                                float *__restrict__ pDstC) {
+    pDstC[0] = pSrcA[0] * pSrcB[0] + pSrcA[1] * pSrcB[1] + pSrcA[2] * pSrcB[2] +
+               pSrcA[3] * pSrcB[3];
+    pDstC[1] = pSrcA[0] * pSrcB[4] + pSrcA[1] * pSrcB[5] + pSrcA[2] * pSrcB[6] +
+               pSrcA[3] * pSrcB[7];
+    pDstC[2] = pSrcA[0] * pSrcB[8] + pSrcA[1] * pSrcB[9] + pSrcA[2] * pSrcB[10] +
+               pSrcA[3] * pSrcB[11];
+    pDstC[3] = pSrcA[0] * pSrcB[12] + pSrcA[1] * pSrcB[13] + pSrcA[2] * pSrcB[14] +
+               pSrcA[3] * pSrcB[15];
+    pDstC[4] = pSrcA[4] * pSrcB[0] + pSrcA[5] * pSrcB[1] + pSrcA[6] * pSrcB[2] +
+               pSrcA[7] * pSrcB[3];
+    pDstC[5] = pSrcA[4] * pSrcB[4] + pSrcA[5] * pSrcB[5] + pSrcA[6] * pSrcB[6] +
+               pSrcA[7] * pSrcB[7];
+    pDstC[6] = pSrcA[4] * pSrcB[8] + pSrcA[5] * pSrcB[9] + pSrcA[6] * pSrcB[10] +
+               pSrcA[7] * pSrcB[11];
+    pDstC[7] = pSrcA[4] * pSrcB[12] + pSrcA[5] * pSrcB[13] + pSrcA[6] * pSrcB[14] +
+               pSrcA[7] * pSrcB[15];
+    pDstC[8] = pSrcA[8] * pSrcB[0] + pSrcA[9] * pSrcB[1] + pSrcA[10] * pSrcB[2] +
+               pSrcA[11] * pSrcB[3];
+    pDstC[9] = pSrcA[8] * pSrcB[4] + pSrcA[9] * pSrcB[5] + pSrcA[10] * pSrcB[6] +
+               pSrcA[11] * pSrcB[7];
+    pDstC[10] = pSrcA[8] * pSrcB[8] + pSrcA[9] * pSrcB[9] + pSrcA[10] * pSrcB[10] +
+                pSrcA[11] * pSrcB[11];
+    pDstC[11] = pSrcA[8] * pSrcB[12] + pSrcA[9] * pSrcB[13] + pSrcA[10] * pSrcB[14] +
+                pSrcA[11] * pSrcB[15];
+    pDstC[12] = pSrcA[12] * pSrcB[0] + pSrcA[13] * pSrcB[1] + pSrcA[14] * pSrcB[2] +
+                pSrcA[15] * pSrcB[3];
+    pDstC[13] = pSrcA[12] * pSrcB[4] + pSrcA[13] * pSrcB[5] + pSrcA[14] * pSrcB[6] +
+                pSrcA[15] * pSrcB[7];
+    pDstC[14] = pSrcA[12] * pSrcB[8] + pSrcA[13] * pSrcB[9] + pSrcA[14] * pSrcB[10] +
+                pSrcA[15] * pSrcB[11];
+    pDstC[15] = pSrcA[12] * pSrcB[12] + pSrcA[13] * pSrcB[13] + pSrcA[14] * pSrcB[14] +
+                pSrcA[15] * pSrcB[15];
+}
+
+/**
+  @brief      2x2 matrix transposition of 32-bit integer (and fixed-point) matrices.
+  @param[in]  pSrc  points to the input matrix, may be equal to pDst
+  @param[out] pDst  points to the output matrix
+  @return     none
+ */
+
+static inline void plp_mat_trans_2x2_i32(const int32_t *pSrc,
+                                         int32_t *pDst) {
+    int32_t a00 = pSrc[0];
+    int32_t a01 = pSrc[1];
+    int32_t a10 = pSrc[2];
+    int32_t a11 = pSrc[3];
+
+    pDst[0] = a00;
+    pDst[1] = a10;
+    pDst[2] = a01;
+    pDst[3] = a11;
+}
+
+/**
+  @brief      3x3 matrix transposition of 32-bit integer (and fixed-point) matrices.
+  @param[in]  pSrc  points to the input matrix, may be equal to pDst
+  @param[out] pDst  points to the output matrix
+  @return     none
+ */
+
+static inline void plp_mat_trans_3x3_i32(const int32_t *pSrc,
+                                         int32_t *pDst) {
+    int32_t a00 = pSrc[0];
+    int32_t a01 = pSrc[1];
+    int32_t a02 = pSrc[2];
+    int32_t a10 = pSrc[3];
+    int32_t a11 = pSrc[4];
+    int32_t a12 = pSrc[5];
+    int32_t a20 = pSrc[6];
+    int32_t a21 = pSrc[7];
+    int32_t a22 = pSrc[8];
+
+    pDst[0] = a00;
+    pDst[1] = a10;
+    pDst[2] = a20;
+    pDst[3] = a01;
+    pDst[4] = a11;
+    pDst[5] = a21;
+    pDst[6] = a02;
+    pDst[7] = a12;
+    pDst[8] = a22;
+}
+
+/**
+  @brief      4x4 matrix transposition of 32-bit integer (and fixed-point) matrices.
+  @param[in]  pSrc  points to the input matrix, may be equal to pDst
+  @param[out] pDst  points to the output matrix
+  @return     none
+ */
+
+static inline void plp_mat_trans_4x4_i32(const int32_t *pSrc,
+                                         int32_t *pDst) {
+    int32_t a00 = pSrc[0];
+    int32_t a01 = pSrc[1];
+    int32_t a02 = pSrc[2];
+    int32_t a03 = pSrc[3];
+    int32_t a10 = pSrc[4];
+    int32_t a11 = pSrc[5];
+    int32_t a12 = pSrc[6];
+    int32_t a13 = pSrc[7];
+    int32_t a20 = pSrc[8];
+    int32_t a21 = pSrc[9];
+    int32_t a22 = pSrc[10];
+    int32_t a23 = pSrc[11];
+    int32_t a30 = pSrc[12];
+    int32_t a31 = pSrc[13];
+    int32_t a32 = pSrc[14];
+    int32_t a33 = pSrc[15];
+
+    pDst[0] = a00;
+    pDst[1] = a10;
+    pDst[2] = a20;
+    pDst[3] = a30;
+    pDst[4] = a01;
+    pDst[5] = a11;
+    pDst[6] = a21;
+    pDst[7] = a31;
+    pDst[8] = a02;
+    pDst[9] = a12;
+    pDst[10] = a22;
+    pDst[11] = a32;
+    pDst[12] = a03;
+    pDst[13] = a13;
+    pDst[14] = a23;
+    pDst[15] = a33;
+}
+
+/**
+  @brief      2x2 matrix transposition of 16-bit integer (and fixed-point) matrices.
+  @param[in]  pSrc  points to the input matrix, may be equal to pDst
+  @param[out] pDst  points to the output matrix
+  @return     none
+ */
+
+static inline void plp_mat_trans_2x2_i16(const int16_t *pSrc,
+                                         int16_t *pDst) {
+    int16_t a00 = pSrc[0];
+    int16_t a01 = pSrc[1];
+    int16_t a10 = pSrc[2];
+    int16_t a11 = pSrc[3];
+
+    pDst[0] = a00;
+    pDst[1] = a10;
+    pDst[2] = a01;
+    pDst[3] = a11;
+}
+
+/**
+  @brief      3x3 matrix transposition of 16-bit integer (and fixed-point) matrices.
+  @param[in]  pSrc  points to the input matrix, may be equal to pDst
+  @param[out] pDst  points to the output matrix
+  @return     none
+ */
+
+static inline void plp_mat_trans_3x3_i16(const int16_t *pSrc,
+                                         int16_t *pDst) {
+    int16_t a00 = pSrc[0];
+    int16_t a01 = pSrc[1];
+    int16_t a02 = pSrc[2];
+    int16_t a10 = pSrc[3];
+    int16_t a11 = pSrc[4];
+    int16_t a12 = pSrc[5];
+    int16_t a20 = pSrc[6];
+    int16_t a21 = pSrc[7];
+    int16_t a22 = pSrc[8];
+
+    pDst[0] = a00;
+    pDst[1] = a10;
+    pDst[2] = a20;
+    pDst[3] = a01;
+    pDst[4] = a11;
+    pDst[5] = a21;
+    pDst[6] = a02;
+    pDst[7] = a12;
+    pDst[8] = a22;
+}
+
+/**
+  @brief      4x4 matrix transposition of 16-bit integer (and fixed-point) matrices.
+  @param[in]  pSrc  points to the input matrix, may be equal to pDst
+  @param[out] pDst  points to the output matrix
+  @return     none
+ */
+
+static inline void plp_mat_trans_4x4_i16(const int16_t *pSrc,
+                                         int16_t *pDst) {
+    int16_t a00 = pSrc[0];
+    int16_t a01 = pSrc[1];
+    int16_t a02 = pSrc[2];
+    int16_t a03 = pSrc[3];
+    int16_t a10 = pSrc[4];
+    int16_t a11 = pSrc[5];
+    int16_t a12 = pSrc[6];
+    int16_t a13 = pSrc[7];
+    int16_t a20 = pSrc[8];
+    int16_t a21 = pSrc[9];
+    int16_t a22 = pSrc[10];
+    int16_t a23 = pSrc[11];
+    int16_t a30 = pSrc[12];
+    int16_t a31 = pSrc[13];
+    int16_t a32 = pSrc[14];
+    int16_t a33 = pSrc[15];
+
+    pDst[0] = a00;
+    pDst[1] = a10;
+    pDst[2] = a20;
+    pDst[3] = a30;
+    pDst[4] = a01;
+    pDst[5] = a11;
+    pDst[6] = a21;
+    pDst[7] = a31;
+    pDst[8] = a02;
+    pDst[9] = a12;
+    pDst[10] = a22;
+    pDst[11] = a32;
+    pDst[12] = a03;
+    pDst[13] = a13;
+    pDst[14] = a23;
+    pDst[15] = a33;
+}
+
+/**
+  @brief      2x2 matrix transposition of 32-bit floating-point matrices.
+  @param[in]  pSrc  points to the input matrix, may be equal to pDst
+  @param[out] pDst  points to the output matrix
+  @return     none
+ */
+
+static inline void plp_mat_trans_2x2_f32(const float *pSrc,
+                                         float *pDst) {
+    float a00 = pSrc[0];
+    float a01 = pSrc[1];
+    float a10 = pSrc[2];
+    float a11 = pSrc[3];
+
+    pDst[0] = a00;
+    pDst[1] = a10;
+    pDst[2] = a01;
+    pDst[3] = a11;
+}
+
+/**
+  @brief      3x3 matrix transposition of 32-bit floating-point matrices.
+  @param[in]  pSrc  points to the input matrix, may be equal to pDst
+  @param[out] pDst  points to the output matrix
+  @return     none
+ */
+
+static inline void plp_mat_trans_3x3_f32(const float *pSrc,
+                                         float *pDst) {
+    float a00 = pSrc[0];
+    float a01 = pSrc[1];
+    float a02 = pSrc[2];
+    float a10 = pSrc[3];
+    float a11 = pSrc[4];
+    float a12 = pSrc[5];
+    float a20 = pSrc[6];
+    float a21 = pSrc[7];
+    float a22 = pSrc[8];
+
+    pDst[0] = a00;
+    pDst[1] = a10;
+    pDst[2] = a20;
+    pDst[3] = a01;
+    pDst[4] = a11;
+    pDst[5] = a21;
+    pDst[6] = a02;
+    pDst[7] = a12;
+    pDst[8] = a22;
+}
+
+/**
+  @brief      4x4 matrix transposition of 32-bit floating-point matrices.
+  @param[in]  pSrc  points to the input matrix, may be equal to pDst
+  @param[out] pDst  points to the output matrix
+  @return     none
+ */
+
+static inline void plp_mat_trans_4x4_f32(const float *pSrc,
+                                         float *pDst) {
+    float a00 = pSrc[0];
+    float a01 = pSrc[1];
+    float a02 = pSrc[2];
+    float a03 = pSrc[3];
+    float a10 = pSrc[4];
+    float a11 = pSrc[5];
+    float a12 = pSrc[6];
+    float a13 = pSrc[7];
+    float a20 = pSrc[8];
+    float a21 = pSrc[9];
+    float a22 = pSrc[10];
+    float a23 = pSrc[11];
+    float a30 = pSrc[12];
+    float a31 = pSrc[13];
+    float a32 = pSrc[14];
+    float a33 = pSrc[15];
+
+    pDst[0] = a00;
+    pDst[1] = a10;
+    pDst[2] = a20;
+    pDst[3] = a30;
+    pDst[4] = a01;
+    pDst[5] = a11;
+    pDst[6] = a21;
+    pDst[7] = a31;
+    pDst[8] = a02;
+    pDst[9] = a12;
+    pDst[10] = a22;
+    pDst[11] = a32;
+    pDst[12] = a03;
+    pDst[13] = a13;
+    pDst[14] = a23;
+    pDst[15] = a33;
+}
+
+/**
+  @brief      Determinant of a 2x2 32-bit floating-point matrix.
+  @param[in]  pSrc  points to the input matrix
+  @return     determinant of the matrix
+ */
+
+static inline float plp_mat_det_2x2_f32(const float *pSrc) {
+    float a00 = pSrc[0];
+    float a01 = pSrc[1];
+    float a10 = pSrc[2];
+    float a11 = pSrc[3];
+
+    float det = a00 * a11 - a01 * a10;
+
+    return det;
+}
+
+/**
+  @brief      Determinant of a 3x3 32-bit floating-point matrix.
+  @param[in]  pSrc  points to the input matrix
+  @return     determinant of the matrix
+ */
+
+static inline float plp_mat_det_3x3_f32(const float *pSrc) {
+    float a00 = pSrc[0];
+    float a01 = pSrc[1];
+    float a02 = pSrc[2];
+    float a10 = pSrc[3];
+    float a11 = pSrc[4];
+    float a12 = pSrc[5];
+    float a20 = pSrc[6];
+    float a21 = pSrc[7];
+    float a22 = pSrc[8];
+
+    float c00 = a11 * a22 - a12 * a21;
+    float c01 = a12 * a20 - a10 * a22;
+    float c02 = a10 * a21 - a11 * a20;
+    float det = a00 * c00 + a01 * c01 + a02 * c02;
+
+    return det;
+}
+
+/**
+  @brief      Determinant of a 4x4 32-bit floating-point matrix.
+  @param[in]  pSrc  points to the input matrix
+  @return     determinant of the matrix
+ */
+
+static inline float plp_mat_det_4x4_f32(const float *pSrc) {
+    float a00 = pSrc[0];
+    float a01 = pSrc[1];
+    float a02 = pSrc[2];
+    float a03 = pSrc[3];
+    float a10 = pSrc[4];
+    float a11 = pSrc[5];
+    float a12 = pSrc[6];
+    float a13 = pSrc[7];
+    float a20 = pSrc[8];
+    float a21 = pSrc[9];
+    float a22 = pSrc[10];
+    float a23 = pSrc[11];
+    float a30 = pSrc[12];
+    float a31 = pSrc[13];
+    float a32 = pSrc[14];
+    float a33 = pSrc[15];
+
+    float s0 = a00 * a11 - a10 * a01;
+    float s1 = a00 * a12 - a10 * a02;
+    float s2 = a00 * a13 - a10 * a03;
+    float s3 = a01 * a12 - a11 * a02;
+    float s4 = a01 * a13 - a11 * a03;
+    float s5 = a02 * a13 - a12 * a03;
+    float c5 = a22 * a33 - a32 * a23;
+    float c4 = a21 * a33 - a31 * a23;
+    float c3 = a21 * a32 - a31 * a22;
+    float c2 = a20 * a33 - a30 * a23;
+    float c1 = a20 * a32 - a30 * a22;
+    float c0 = a20 * a31 - a30 * a21;
+    float det = s0 * c5 - s1 * c4 + s2 * c3 + s3 * c2 - s4 * c1 + s5 * c0;
+
+    return det;
+}
+
+/**
+  @brief      2x2 matrix inversion of 32-bit floating-point matrices.
+  @param[in]  pSrc  points to the input matrix, may be equal to pDst
+  @param[out] pDst  points to the output matrix
+  @return     0: Success, 1: Matrix is singular (pDst is not modified)
+ */
+
+static inline int plp_mat_inv_2x2_f32(const float *pSrc,
+                                      float *pDst) {
+    float a00 = pSrc[0];
+    float a01 = pSrc[1];
+    float a10 = pSrc[2];
+    float a11 = pSrc[3];
+
+    float det = a00 * a11 - a01 * a10;
+
+    if (det == 0.0f) {
+        return 1;
+    }
+
+    float invDet = 1.0f / det;
+
+    pDst[0] = a11 * invDet;
+    pDst[1] = -a01 * invDet;
+    pDst[2] = -a10 * invDet;
+    pDst[3] = a00 * invDet;
+    return 0;
+}
+
+/**
+  @brief      3x3 matrix inversion of 32-bit floating-point matrices.
+  @param[in]  pSrc  points to the input matrix, may be equal to pDst
+  @param[out] pDst  points to the output matrix
+  @return     0: Success, 1: Matrix is singular (pDst is not modified)
+ */
+
+static inline int plp_mat_inv_3x3_f32(const float *pSrc,
+                                      float *pDst) {
+    float a00 = pSrc[0];
+    float a01 = pSrc[1];
+    float a02 = pSrc[2];
+    float a10 = pSrc[3];
+    float a11 = pSrc[4];
+    float a12 = pSrc[5];
+    float a20 = pSrc[6];
+    float a21 = pSrc[7];
+    float a22 = pSrc[8];
+
+    float c00 = a11 * a22 - a12 * a21;
+    float c01 = a12 * a20 - a10 * a22;
+    float c02 = a10 * a21 - a11 * a20;
+    float det = a00 * c00 + a01 * c01 + a02 * c02;
+
+    if (det == 0.0f) {
+        return 1;
+    }
+
+    float invDet = 1.0f / det;
+
+    pDst[0] = c00 * invDet;
+    pDst[1] = (a02 * a21 - a01 * a22) * invDet;
+    pDst[2] = (a01 * a12 - a02 * a11) * invDet;
+    pDst[3] = c01 * invDet;
+    pDst[4] = (a00 * a22 - a02 * a20) * invDet;
+    pDst[5] = (a02 * a10 - a00 * a12) * invDet;
+    pDst[6] = c02 * invDet;
+    pDst[7] = (a01 * a20 - a00 * a21) * invDet;
+    pDst[8] = (a00 * a11 - a01 * a10) * invDet;
+    return 0;
+}
+
+/**
+  @brief      4x4 matrix inversion of 32-bit floating-point matrices.
+  @param[in]  pSrc  points to the input matrix, may be equal to pDst
+  @param[out] pDst  points to the output matrix
+  @return     0: Success, 1: Matrix is singular (pDst is not modified)
+ */
+
+static inline int plp_mat_inv_4x4_f32(const float *pSrc,
+                                      float *pDst) {
+    float a00 = pSrc[0];
+    float a01 = pSrc[1];
+    float a02 = pSrc[2];
+    float a03 = pSrc[3];
+    float a10 = pSrc[4];
+    float a11 = pSrc[5];
+    float a12 = pSrc[6];
+    float a13 = pSrc[7];
+    float a20 = pSrc[8];
+    float a21 = pSrc[9];
+    float a22 = pSrc[10];
+    float a23 = pSrc[11];
+    float a30 = pSrc[12];
+    float a31 = pSrc[13];
+    float a32 = pSrc[14];
+    float a33 = pSrc[15];
+
+    float s0 = a00 * a11 - a10 * a01;
+    float s1 = a00 * a12 - a10 * a02;
+    float s2 = a00 * a13 - a10 * a03;
+    float s3 = a01 * a12 - a11 * a02;
+    float s4 = a01 * a13 - a11 * a03;
+    float s5 = a02 * a13 - a12 * a03;
+    float c5 = a22 * a33 - a32 * a23;
+    float c4 = a21 * a33 - a31 * a23;
+    float c3 = a21 * a32 - a31 * a22;
+    float c2 = a20 * a33 - a30 * a23;
+    float c1 = a20 * a32 - a30 * a22;
+    float c0 = a20 * a31 - a30 * a21;
+    float det = s0 * c5 - s1 * c4 + s2 * c3 + s3 * c2 - s4 * c1 + s5 * c0;
+
+    if (det == 0.0f) {
+        return 1;
+    }
+
+    float invDet = 1.0f / det;
+
+    pDst[0] = (a11 * c5 - a12 * c4 + a13 * c3) * invDet;
+    pDst[1] = (-a01 * c5 + a02 * c4 - a03 * c3) * invDet;
+    pDst[2] = (a31 * s5 - a32 * s4 + a33 * s3) * invDet;
+    pDst[3] = (-a21 * s5 + a22 * s4 - a23 * s3) * invDet;
+    pDst[4] = (-a10 * c5 + a12 * c2 - a13 * c1) * invDet;
+    pDst[5] = (a00 * c5 - a02 * c2 + a03 * c1) * invDet;
+    pDst[6] = (-a30 * s5 + a32 * s2 - a33 * s1) * invDet;
+    pDst[7] = (a20 * s5 - a22 * s2 + a23 * s1) * invDet;
+    pDst[8] = (a10 * c4 - a11 * c2 + a13 * c0) * invDet;
+    pDst[9] = (-a00 * c4 + a01 * c2 - a03 * c0) * invDet;
+    pDst[10] = (a30 * s4 - a31 * s2 + a33 * s0) * invDet;
+    pDst[11] = (-a20 * s4 + a21 * s2 - a23 * s0) * invDet;
+    pDst[12] = (-a10 * c3 + a11 * c1 - a12 * c0) * invDet;
+    pDst[13] = (a00 * c3 - a01 * c1 + a02 * c0) * invDet;
+    pDst[14] = (-a30 * s3 + a31 * s1 - a32 * s0) * invDet;
+    pDst[15] = (a20 * s3 - a21 * s1 + a22 * s0) * invDet;
+    return 0;
+}
+
+/**
+  @brief      Calls the fixed-size kernel of plp_mat_mult if MxNxO is one of the generated sizes.
+  @param[in]  pSrcA  points to the first input matrix (MxN)
+  @param[in]  pSrcB  points to the second input matrix (NxO)
+  @param[in]  M      height of the first input matrix and of the output
+  @param[in]  N      width of the first input matrix
+  @param[in]  O      width of the output
+  @param[out] pDstC  points to the output matrix (MxO)
+  @return     1 if the output has been computed, 0 if the size is not supported
+ */
+
+static inline int plp_mat_mult_small_i32(const int32_t *__restrict__ pSrcA,
+                                         const int32_t *__restrict__ pSrcB,
+                                         uint32_t M,
+                                         uint32_t N,
+                                         uint32_t O,
+                                         int32_t *__restrict__ pDstC) {
+    if (M == 2 && N == 2 && O == 2) {
+        plp_mat_mult_2x2x2_i32(pSrcA, pSrcB, pDstC);
+    } else if (M == 3 && N == 3 && O == 3) {
+        plp_mat_mult_3x3x3_i32(pSrcA, pSrcB, pDstC);
+    } else if (M == 4 && N == 4 && O == 4) {
+        plp_mat_mult_4x4x4_i32(pSrcA, pSrcB, pDstC);
+    } else if (M == 2 && N == 2 && O == 1) {
+        plp_mat_mult_2x2x1_i32(pSrcA, pSrcB, pDstC);
+    } else if (M == 3 && N == 3 && O == 1) {
+        plp_mat_mult_3x3x1_i32(pSrcA, pSrcB, pDstC);
+    } else if (M == 4 && N == 4 && O == 1) {
+        plp_mat_mult_4x4x1_i32(pSrcA, pSrcB, pDstC);
+    } else {
+        return 0;
+    }
+    return 1;
+}
+
+/**
+  @brief      Calls the fixed-size kernel of plp_mat_mult_trans if MxNxO is one of the generated
+              sizes.
+  @param[in]  pSrcA  points to the first input matrix (MxN)
+  @param[in]  pSrcB  points to the second input matrix (OxN, transposed)
+  @param[in]  M      height of the first input matrix and of the output
+  @param[in]  N      width of the first input matrix
+  @param[in]  O      width of the output
+  @param[out] pDstC  points to the output matrix (MxO)
+  @return     1 if the output has been computed, 0 if the size is not supported
+ */
+
+static inline int plp_mat_mult_trans_small_i32(const int32_t *__restrict__ pSrcA,
+                                               const int32_t *__restrict__ pSrcB,
+                                               uint32_t M,
+                                               uint32_t N,
+                                               uint32_t O,
+                                               int32_t *__restrict__ pDstC) {
+    if (M == 2 && N == 2 && O == 2) {
+        plp_mat_mult_trans_2x2x2_i32(pSrcA, pSrcB, pDstC);
+    } else if (M == 3 && N == 3 && O == 3) {
+        plp_mat_mult_trans_3x3x3_i32(pSrcA, pSrcB, pDstC);
+    } else if (M == 4 && N == 4 && O == 4) {
+        plp_mat_mult_trans_4x4x4_i32(pSrcA, pSrcB, pDstC);
+    } else if (M == 2 && N == 2 && O == 1) {
+        plp_mat_mult_2x2x1_i32(pSrcA, pSrcB, pDstC);
+    } else if (M == 3 && N == 3 && O == 1) {
+        plp_mat_mult_3x3x1_i32(pSrcA, pSrcB, pDstC);
+    } else if (M == 4 && N == 4 && O == 1) {
+        plp_mat_mult_4x4x1_i32(pSrcA, pSrcB, pDstC);
+    } else {
+        return 0;
+    }
+    return 1;
+}
+
+/**
+  @brief      Calls the fixed-size kernel of plp_mat_mult if MxNxO is one of the generated sizes.
+  @param[in]  pSrcA  points to the first input matrix (MxN)
+  @param[in]  pSrcB  points to the second input matrix (NxO)
+  @param[in]  M      height of the first input matrix and of the output
+  @param[in]  N      width of the first input matrix
+  @param[in]  O      width of the output
+  @param[in]  shift  amount of bits to shift the products to the right
+  @param[out] pDstC  points to the output matrix (MxO)
+  @return     1 if the output has been computed, 0 if the size is not supported
+ */
+
+static inline int plp_mat_mult_small_q32(const int32_t *__restrict__ pSrcA,
+                                         const int32_t *__restrict__ pSrcB,
+                                         uint32_t M,
+                                         uint32_t N,
+                                         uint32_t O,
+                                         uint32_t shift,
+                                         int32_t *__restrict__ pDstC) {
+    if (M == 2 && N == 2 && O == 2) {
+        plp_mat_mult_2x2x2_q32(pSrcA, pSrcB, shift, pDstC);
+    } else if (M == 3 && N == 3 && O == 3) {
+        plp_mat_mult_3x3x3_q32(pSrcA, pSrcB, shift, pDstC);
+    } else if (M == 4 && N == 4 && O == 4) {
+        plp_mat_mult_4x4x4_q32(pSrcA, pSrcB, shift, pDstC);
+    } else if (M == 2 && N == 2 && O == 1) {
+        plp_mat_mult_2x2x1_q32(pSrcA, pSrcB, shift, pDstC);
+    } else if (M == 3 && N == 3 && O == 1) {
+        plp_mat_mult_3x3x1_q32(pSrcA, pSrcB, shift, pDstC);
+    } else if (M == 4 && N == 4 && O == 1) {
+        plp_mat_mult_4x4x1_q32(pSrcA, pSrcB, shift, pDstC);
+    } else {
+        return 0;
+    }
+    return 1;
+}
+
+/**
+  @brief      Calls the fixed-size kernel of plp_mat_mult_trans if MxNxO is one of the generated
+              sizes.
+  @param[in]  pSrcA  points to the first input matrix (MxN)
+  @param[in]  pSrcB  points to the second input matrix (OxN, transposed)
+  @param[in]  M      height of the first input matrix and of the output
+  @param[in]  N      width of the first input matrix
+  @param[in]  O      width of the output
+  @param[in]  shift  amount of bits to shift the products to the right
+  @param[out] pDstC  points to the output matrix (MxO)
+  @return     1 if the output has been computed, 0 if the size is not supported
+ */
+
+static inline int plp_mat_mult_trans_small_q32(const int32_t *__restrict__ pSrcA,
+                                               const int32_t *__restrict__ pSrcB,
+                                               uint32_t M,
+                                               uint32_t N,
+                                               uint32_t O,
+                                               uint32_t shift,
+                                               int32_t *__restrict__ pDstC) {
+    if (M == 2 && N == 2 && O == 2) {
+        plp_mat_mult_trans_2x2x2_q32(pSrcA, pSrcB, shift, pDstC);
+    } else if (M == 3 && N == 3 && O == 3) {
+        plp_mat_mult_trans_3x3x3_q32(pSrcA, pSrcB, shift, pDstC);
+    } else if (M == 4 && N == 4 && O == 4) {
+        plp_mat_mult_trans_4x4x4_q32(pSrcA, pSrcB, shift, pDstC);
+    } else if (M == 2 && N == 2 && O == 1) {
+        plp_mat_mult_2x2x1_q32(pSrcA, pSrcB, shift, pDstC);
+    } else if (M == 3 && N == 3 && O == 1) {
+        plp_mat_mult_3x3x1_q32(pSrcA, pSrcB, shift, pDstC);
+    } else if (M == 4 && N == 4 && O == 1) {
+        plp_mat_mult_4x4x1_q32(pSrcA, pSrcB, shift, pDstC);
+    } else {
+        return 0;
+    }
+    return 1;
+}
+
+/**
+  @brief      Calls the fixed-size kernel of plp_mat_mult if MxNxO is one of the generated sizes.
+  @param[in]  pSrcA  points to the first input matrix (MxN)
+  @param[in]  pSrcB  points to the second input matrix (NxO)
+  @param[in]  M      height of the first input matrix and of the output
+  @param[in]  N      width of the first input matrix
+  @param[in]  O      width of the output
+  @param[in]  shift  amount of bits to shift the products to the right
+  @param[out] pDstC  points to the output matrix (MxO)
+  @return     1 if the output has been computed, 0 if the size is not supported
+ */
+
+static inline int plp_mat_mult_small_q16(const int16_t *__restrict__ pSrcA,
+                                         const int16_t *__restrict__ pSrcB,
+                                         uint32_t M,
+                                         uint32_t N,
+                                         uint32_t O,
+                                         uint32_t shift,
+                                         int16_t *__restrict__ pDstC) {
+    if (M == 2 && N == 2 && O == 2) {
+        plp_mat_mult_2x2x2_q16(pSrcA, pSrcB, shift, pDstC);
+    } else if (M == 3 && N == 3 && O == 3) {
+        plp_mat_mult_3x3x3_q16(pSrcA, pSrcB, shift, pDstC);
+    } else if (M == 4 && N == 4 && O == 4) {
+        plp_mat_mult_4x4x4_q16(pSrcA, pSrcB, shift, pDstC);
+    } else if (M == 2 && N == 2 && O == 1) {
+        plp_mat_mult_2x2x1_q16(pSrcA, pSrcB, shift, pDstC);
+    } else if (M == 3 && N == 3 && O == 1) {
+        plp_mat_mult_3x3x1_q16(pSrcA, pSrcB, shift, pDstC);
+    } else if (M == 4 && N == 4 && O == 1) {
+        plp_mat_mult_4x4x1_q16(pSrcA, pSrcB, shift, pDstC);
+    } else {
+        return 0;
+    }
+    return 1;
+}
+
+/**
+  @brief      Calls the fixed-size kernel of plp_mat_mult_trans if MxNxO is one of the generated
+              sizes.
+  @param[in]  pSrcA  points to the first input matrix (MxN)
+  @param[in]  pSrcB  points to the second input matrix (OxN, transposed)
+  @param[in]  M      height of the first input matrix and of the output
+  @param[in]  N      width of the first input matrix
+  @param[in]  O      width of the output
+  @param[in]  shift  amount of bits to shift the products to the right
+  @param[out] pDstC  points to the output matrix (MxO)
+  @return     1 if the output has been computed, 0 if the size is not supported
+ */
+
+static inline int plp_mat_mult_trans_small_q16(const int16_t *__restrict__ pSrcA,
+                                               const int16_t *__restrict__ pSrcB,
+                                               uint32_t M,
+                                               uint32_t N,
+                                               uint32_t O,
+                                               uint32_t shift,
+                                               int16_t *__restrict__ pDstC) {
+    if (M == 2 && N == 2 && O == 2) {
+        plp_mat_mult_trans_2x2x2_q16(pSrcA, pSrcB, shift, pDstC);
+    } else if (M == 3 && N == 3 && O == 3) {
+        plp_mat_mult_trans_3x3x3_q16(pSrcA, pSrcB, shift, pDstC);
+    } else if (M == 4 && N == 4 && O == 4) {
+        plp_mat_mult_trans_4x4x4_q16(pSrcA, pSrcB, shift, pDstC);
+    } else if (M == 2 && N == 2 && O == 1) {
+        plp_mat_mult_2x2x1_q16(pSrcA, pSrcB, shift, pDstC);
+    } else if (M == 3 && N == 3 && O == 1) {
+        plp_mat_mult_3x3x1_q16(pSrcA, pSrcB, shift, pDstC);
+    } else if (M == 4 && N == 4 && O == 1) {
+        plp_mat_mult_4x4x1_q16(pSrcA, pSrcB, shift, pDstC);
+    } else {
+        return 0;
+    }
+    return 1;
+}
+
+/**
+  @brief      Calls the fixed-size kernel of plp_mat_mult if MxNxO is one of the generated sizes.
+  @param[in]  pSrcA  points to the first input matrix (MxN)
+  @param[in]  pSrcB  points to the second input matrix (NxO)
+  @param[in]  M      height of the first input matrix and of the output
+  @param[in]  N      width of the first input matrix
+  @param[in]  O      width of the output
+  @param[out] pDstC  points to the output matrix (MxO)
+  @return     1 if the output has been computed, 0 if the size is not supported
+ */
+
+static inline int plp_mat_mult_small_f32(const float *__restrict__ pSrcA,
+                                         const float *__restrict__ pSrcB,
+                                         uint32_t M,
+                                         uint32_t N,
+                                         uint32_t O,
+                                         float *__restrict__ pDstC) {
+    if (M == 2 && N == 2 && O == 2) {
+        plp_mat_mult_2x2x2_f32(pSrcA, pSrcB, pDstC);
+    } else if (M == 3 && N == 3 && O == 3) {
+        plp_mat_mult_3x3x3_f32(pSrcA, pSrcB, pDstC);
+    } else if (M == 4 && N == 4 && O == 4) {
+        plp_mat_mult_4x4x4_f32(pSrcA, pSrcB, pDstC);
+    } else if (M == 2 && N == 2 && O == 1) {
+        plp_mat_mult_2x2x1_f32(pSrcA, pSrcB, pDstC);
+    } else if (M == 3 && N == 3 && O == 1) {
+        plp_mat_mult_3x3x1_f32(pSrcA, pSrcB, pDstC);
+    } else if (M == 4 && N == 4 && O == 1) {
+        plp_mat_mult_4x4x1_f32(pSrcA, pSrcB, pDstC);
+    } else {
+        return 0;
+    }
+    return 1;
+}
+
+/**
+  @brief      Calls the fixed-size kernel of plp_mat_mult_trans if MxNxO is one of the generated
+              sizes.
+  @param[in]  pSrcA  points to the first input matrix (MxN)
+  @param[in]  pSrcB  points to the second input matrix (OxN, transposed)
+  @param[in]  M      height of the first input matrix and of the output
+  @param[in]  N      width of the first input matrix
+  @param[in]  O      width of the output
+  @param[out] pDstC  points to the output matrix (MxO)
+  @return     1 if the output has been computed, 0 if the size is not supported
+ */
+
+static inline int plp_mat_mult_trans_small_f32(const float *__restrict__ pSrcA,
+                                               const float *__restrict__ pSrcB,
+                                               uint32_t M,
+                                               uint32_t N,
+                                               uint32_t O,
+                                               float *__restrict__ pDstC) {
+    if (M == 2 && N == 2 && O == 2) {
+        plp_mat_mult_trans_2x2x2_f32(pSrcA, pSrcB, pDstC);
+    } else if (M == 3 && N == 3 && O == 3) {
+        plp_mat_mult_trans_3x3x3_f32(pSrcA, pSrcB, pDstC);
+    } else if (M == 4 && N == 4 && O == 4) {
+        plp_mat_mult_trans_4x4x4_f32(pSrcA, pSrcB, pDstC);
+    } else if (M == 2 && N == 2 && O == 1) {
+        plp_mat_mult_2x2x1_f32(pSrcA, pSrcB, pDstC);
+    } else if (M == 3 && N == 3 && O == 1) {
+        plp_mat_mult_3x3x1_f32(pSrcA, pSrcB, pDstC);
+    } else if (M == 4 && N == 4 && O == 1) {
+        plp_mat_mult_4x4x1_f32(pSrcA, pSrcB, pDstC);
+    } else {
+        return 0;
+    }
+    return 1;
+}
+
+/**
+  @brief      Calls the fixed-size kernel of plp_mat_trans if MxN is one of the generated sizes.
+  @param[in]  pSrc  points to the input matrix (MxN)
+  @param[in]  M     height of the input matrix
+  @param[in]  N     width of the input matrix
+  @param[out] pDst  points to the output matrix (NxM)
+  @return     1 if the output has been computed, 0 if the size is not supported
+ */
+
+static inline int plp_mat_trans_small_i32(const int32_t *pSrc,
+                                          uint32_t M,
+                                          uint32_t N,
+                                          int32_t *pDst) {
+    if (M == 2 && N == 2) {
+        plp_mat_trans_2x2_i32(pSrc, pDst);
+    } else if (M == 3 && N == 3) {
+        plp_mat_trans_3x3_i32(pSrc, pDst);
+    } else if (M == 4 && N == 4) {
+        plp_mat_trans_4x4_i32(pSrc, pDst);
+    } else {
+        return 0;
+    }
+    return 1;
+}
+
+/**
+  @brief      Calls the fixed-size kernel of plp_mat_trans if MxN is one of the generated sizes.
+  @param[in]  pSrc  points to the input matrix (MxN)
+  @param[in]  M     height of the input matrix
+  @param[in]  N     width of the input matrix
+  @param[out] pDst  points to the output matrix (NxM)
+  @return     1 if the output has been computed, 0 if the size is not supported
+ */
+
+static inline int plp_mat_trans_small_i16(const int16_t *pSrc,
+                                          uint32_t M,
+                                          uint32_t N,
+                                          int16_t *pDst) {
+    if (M == 2 && N == 2) {
+        plp_mat_trans_2x2_i16(pSrc, pDst);
+    } else if (M == 3 && N == 3) {
+        plp_mat_trans_3x3_i16(pSrc, pDst);
+    } else if (M == 4 && N == 4) {
+        plp_mat_trans_4x4_i16(pSrc, pDst);
+    } else {
+        return 0;
+    }
+    return 1;
+}
+
+/**
+  @brief      Calls the fixed-size kernel of plp_mat_trans if MxN is one of the generated sizes.
+  @param[in]  pSrc  points to the input matrix (MxN)
+  @param[in]  M     height of the input matrix
+  @param[in]  N     width of the input matrix
+  @param[out] pDst  points to the output matrix (NxM)
+  @return     1 if the output has been computed, 0 if the size is not supported
+ */
+
+static inline int plp_mat_trans_small_f32(const float *pSrc,
+                                          uint32_t M,
+                                          uint32_t N,
+                                          float *pDst) {
+    if (M == 2 && N == 2) {
+        plp_mat_trans_2x2_f32(pSrc, pDst);
+    } else if (M == 3 && N == 3) {
+        plp_mat_trans_3x3_f32(pSrc, pDst);
+    } else if (M == 4 && N == 4) {
+        plp_mat_trans_4x4_f32(pSrc, pDst);
+    } else {
+        return 0;
+    }
+    return 1;
+}
+
+/**
+  @brief      Calls the fixed-size kernel of plp_mat_inv if NxN is one of the generated sizes.
+  @param[in]  pSrc  points to the input matrix
+  @param[in]  N     width and height of the matrices
+  @param[out] pDst  points to the output matrix
+  @return     0: Success, 1: Matrix is singular, 2: size not supported
+ */
+
+static inline int plp_mat_inv_small_f32(const float *pSrc,
+                                        uint32_t N,
+                                        float *pDst) {
+    if (N == 2) {
+        return plp_mat_inv_2x2_f32(pSrc, pDst);
+    } else if (N == 3) {
+        return plp_mat_inv_3x3_f32(pSrc, pDst);
+    } else if (N == 4) {
+        return plp_mat_inv_4x4_f32(pSrc, pDst);
+    } else {
+        return 2;
+    }
+}
+
+/**
+  @} end of MatSmall group
+ */
+
+#endif // __PLP_MAT_SMALL_H__
@@ -273,6 +273,317 @@ typedef struct {
     uint8_t coresPerVector;
 } plp_conv_tree_add_instance;
 
+/** -------------------------------------------------------
+    @struct plp_fir_decimate_instance_q16
+    @brief Instance structure for the 16-bit fixed-point polyphase FIR decimator.
+    @param[in]  M         decimation factor
+    @param[in]  numTaps   number of filter coefficients
+    @param[in]  pCoeffs   points to the coefficients in time-reversed order, i.e.
+                          <code>pCoeffs[i] = h[numTaps - 1 - i]</code>
+    @param[in]  pState    points to the state buffer of length <code>numTaps - 1 + blockSize</code>
+    @param[in]  fracBits  number of fractional bits of the coefficients
+*/
+typedef struct {
+    uint8_t M;
+    uint16_t numTaps;
+    const int16_t *pCoeffs;
+    int16_t *pState;
+    uint32_t fracBits;
+} plp_fir_decimate_instance_q16;
+
+/** -------------------------------------------------------
+    @struct plp_fir_decimate_instance_q32
+    @brief Instance structure for the 32-bit fixed-point polyphase FIR decimator.
+    @param[in]  M         decimation factor
+    @param[in]  numTaps   number of filter coefficients
+    @param[in]  pCoeffs   points to the coefficients in time-reversed order, i.e.
+                          <code>pCoeffs[i] = h[numTaps - 1 - i]</code>
+    @param[in]  pState    points to the state buffer of length <code>numTaps - 1 + blockSize</code>
+    @param[in]  fracBits  number of fractional bits of the coefficients
+*/
+typedef struct {
+    uint8_t M;
+    uint16_t numTaps;
+    const int32_t *pCoeffs;
+    int32_t *pState;
+    uint32_t fracBits;
+} plp_fir_decimate_instance_q32;
+
+/** -------------------------------------------------------
+    @struct plp_fir_decimate_instance_f32
+    @brief Instance structure for the floating-point polyphase FIR decimator.
+    @param[in]  M         decimation factor
+    @param[in]  numTaps   number of filter coefficients
+    @param[in]  pCoeffs   points to the coefficients in time-reversed order, i.e.
+                          <code>pCoeffs[i] = h[numTaps - 1 - i]</code>
+    @param[in]  pState    points to the state buffer of length <code>numTaps - 1 + blockSize</code>
+*/
+typedef struct {
+    uint8_t M;
+    uint16_t numTaps;
+    const float32_t *pCoeffs;
+    float32_t *pState;
+} plp_fir_decimate_instance_f32;
+
+/** -------------------------------------------------------
+    @struct plp_fir_interpolate_instance_q16
+    @brief Instance structure for the 16-bit fixed-point polyphase FIR interpolator.
+    @param[in]  L            interpolation factor
+    @param[in]  phaseLength  number of coefficients of each polyphase filter (numTaps / L)
+    @param[in]  pCoeffs      points to the L polyphase filters, each of them in time-reversed
+                             order, i.e. <code>pCoeffs[p * phaseLength + i] =
+                             h[p + (phaseLength - 1 - i) * L]</code>
+    @param[in]  pState       points to the state buffer of length
+                             <code>phaseLength - 1 + blockSize</code>
+    @param[in]  fracBits     number of fractional bits of the coefficients
+*/
+typedef struct {
+    uint8_t L;
+    uint16_t phaseLength;
+    const int16_t *pCoeffs;
+    int16_t *pState;
+    uint32_t fracBits;
+} plp_fir_interpolate_instance_q16;
+
+/** -------------------------------------------------------
+    @struct plp_fir_interpolate_instance_q32
+    @brief Instance structure for the 32-bit fixed-point polyphase FIR interpolator.
+    @param[in]  L            interpolation factor
+    @param[in]  phaseLength  number of coefficients of each polyphase filter (numTaps / L)
+    @param[in]  pCoeffs      points to the L polyphase filters, each of them in time-reversed
+                             order, i.e. <code>pCoeffs[p * phaseLength + i] =
+                             h[p + (phaseLength - 1 - i) * L]</code>
+    @param[in]  pState       points to the state buffer of length
+                             <code>phaseLength - 1 + blockSize</code>
+    @param[in]  fracBits     number of fractional bits of the coefficients
+*/
+typedef struct {
+    uint8_t L;
+    uint16_t phaseLength;
+    const int32_t *pCoeffs;
+    int32_t *pState;
+    uint32_t fracBits;
+} plp_fir_interpolate_instance_q32;
+
+/** -------------------------------------------------------
+    @struct plp_fir_interpolate_instance_f32
+    @brief Instance structure for the floating-point polyphase FIR interpolator.
+    @param[in]  L            interpolation factor
+    @param[in]  phaseLength  number of coefficients of each polyphase filter (numTaps / L)
+    @param[in]  pCoeffs      points to the L polyphase filters, each of them in time-reversed
+                             order, i.e. <code>pCoeffs[p * phaseLength + i] =
+                             h[p + (phaseLength - 1 - i) * L]</code>
+    @param[in]  pState       points to the state buffer of length
+                             <code>phaseLength - 1 + blockSize</code>
+*/
+typedef struct {
+    uint8_t L;
+    uint16_t phaseLength;
+    const float32_t *pCoeffs;
+    float32_t *pState;
+} plp_fir_interpolate_instance_f32;
+
+/** -------------------------------------------------------
+    @brief Instance structure for the parallel 16-bit fixed-point FIR decimator and interpolator.
+    @param[in]  pCoeffs   points to the coefficients (plp_fir_decimate_instance_q16 or
+                          plp_fir_interpolate_instance_q16)
+    @param[in]  pSrc      points to the beginning of the state buffer
+    @param[in]  numTaps   number of coefficients (decimator) or length of each phase (interpolator)
+    @param[in]  factor    decimation factor M or interpolation factor L
+    @param[in]  fracBits  number of fractional bits of the coefficients
+    @param[in]  blkSize   number of outputs (decimator) or inputs (interpolator)
+    @param[in]  nPE       number of parallel processing units
+    @param[out] pDst      points to the output buffer
+*/
+typedef struct {
+    const int16_t *pCoeffs;
+    const int16_t *pSrc;
+    uint32_t numTaps;
+    uint32_t factor;
+    uint32_t fracBits;
+    uint32_t blkSize;
+    uint32_t nPE;
+    int16_t *pDst;
+} plp_fir_multirate_instance_q16;
+
+/** -------------------------------------------------------
+    @brief Instance structure for the parallel 32-bit fixed-point FIR decimator and interpolator.
+    @param[in]  pCoeffs   points to the coefficients (plp_fir_decimate_instance_q32 or
+                          plp_fir_interpolate_instance_q32)
+    @param[in]  pSrc      points to the beginning of the state buffer
+    @param[in]  numTaps   number of coefficients (decimator) or length of each phase (interpolator)
+    @param[in]  factor    decimation factor M or interpolation factor L
+    @param[in]  fracBits  number of fractional bits of the coefficients
+    @param[in]  blkSize   number of outputs (decimator) or inputs (interpolator)
+    @param[in]  nPE       number of parallel processing units
+    @param[out] pDst      points to the output buffer
+*/
+typedef struct {
+    const int32_t *pCoeffs;
+    const int32_t *pSrc;
+    uint32_t numTaps;
+    uint32_t factor;
+    uint32_t fracBits;
+    uint32_t blkSize;
+    uint32_t nPE;
+    int32_t *pDst;
+} plp_fir_multirate_instance_q32;
+
+/** -------------------------------------------------------
+    @brief Instance structure for the parallel floating-point FIR decimator and interpolator.
+    @param[in]  pCoeffs   points to the coefficients (plp_fir_decimate_instance_f32 or
+                          plp_fir_interpolate_instance_f32)
+    @param[in]  pSrc      points to the beginning of the state buffer
+    @param[in]  numTaps   number of coefficients (decimator) or length of each phase (interpolator)
+    @param[in]  factor    decimation factor M or interpolation factor L
+    @param[in]  blkSize   number of outputs (decimator) or inputs (interpolator)
+    @param[in]  nPE       number of parallel processing units
+    @param[out] pDst      points to the output buffer
+*/
+typedef struct {
+    const float32_t *pCoeffs;
+    const float32_t *pSrc;
+    uint32_t numTaps;
+    uint32_t factor;
+    uint32_t blkSize;
+    uint32_t nPE;
+    float32_t *pDst;
+} plp_fir_multirate_instance_f32;
+
+/** -------------------------------------------------------
+    @struct plp_lms_instance_q16
+    @brief Instance structure for the 16-bit fixed-point LMS, NLMS and block LMS filters.
+    @param[in]     numTaps   number of filter coefficients
+    @param[in]     pState    points to the state buffer of length <code>numTaps - 1 +
+                             blockSize</code>
+    @param[in,out] pCoeffs   points to the coefficients in time-reversed order, i.e.
+                             <code>pCoeffs[i] = h[numTaps - 1 - i]</code>, updated in place
+    @param[in]     mu        step size
+    @param[in]     fracBits  number of fractional bits of the coefficients and mu
+*/
+typedef struct {
+    uint16_t numTaps;
+    int16_t *pState;
+    int16_t *pCoeffs;
+    int16_t mu;
+    uint32_t fracBits;
+} plp_lms_instance_q16;
+
+/** -------------------------------------------------------
+    @struct plp_lms_instance_q32
+    @brief Instance structure for the 32-bit fixed-point LMS, NLMS and block LMS filters.
+    @param[in]     numTaps   number of filter coefficients
+    @param[in]     pState    points to the state buffer of length <code>numTaps - 1 +
+                             blockSize</code>
+    @param[in,out] pCoeffs   points to the coefficients in time-reversed order, i.e.
+                             <code>pCoeffs[i] = h[numTaps - 1 - i]</code>, updated in place
+    @param[in]     mu        step size
+    @param[in]     fracBits  number of fractional bits of the coefficients and mu
+    @param[in]     delta     regularization of the NLMS filter, added to the energy of the delay
+                             line with fracBits fractional bits, must be positive
+*/
+typedef struct {
+    uint16_t numTaps;
+    int32_t *pState;
+    int32_t *pCoeffs;
+    int32_t mu;
+    uint32_t fracBits;
+    int32_t delta;
+} plp_lms_instance_q32;
+
+/** -------------------------------------------------------
+    @struct plp_lms_instance_f32
+    @brief Instance structure for the floating-point LMS, NLMS and block LMS filters.
+    @param[in]     numTaps   number of filter coefficients
+    @param[in]     pState    points to the state buffer of length <code>numTaps - 1 +
+                             blockSize</code>
+    @param[in,out] pCoeffs   points to the coefficients in time-reversed order, i.e.
+                             <code>pCoeffs[i] = h[numTaps - 1 - i]</code>, updated in place
+    @param[in]     mu        step size
+*/
+typedef struct {
+    uint16_t numTaps;
+    float32_t *pState;
+    float32_t *pCoeffs;
+    float32_t mu;
+} plp_lms_instance_f32;
+
+/** -------------------------------------------------------
+    @brief Instance structure for the parallel 16-bit fixed-point block LMS filter.
+    @param[in]     pSrc      points to the beginning of the state buffer
+    @param[in,out] pCoeffs   points to the coefficients in time-reversed order
+    @param[in]     numTaps   number of filter coefficients
+    @param[in]     mu        step size
+    @param[in]     fracBits  number of fractional bits of the coefficients and mu
+    @param[in]     pRef      points to the reference samples
+    @param[in]     blkSize   number of samples
+    @param[in]     nPE       number of parallel processing units
+    @param[out]    pOut      points to the output samples
+    @param[out]    pErr      points to the error samples
+*/
+typedef struct {
+    const int16_t *pSrc;
+    int16_t *pCoeffs;
+    uint32_t numTaps;
+    int16_t mu;
+    uint32_t fracBits;
+    const int16_t *pRef;
+    uint32_t blkSize;
+    uint32_t nPE;
+    int16_t *pOut;
+    int16_t *pErr;
+} plp_lms_block_instance_q16;
+
+/** -------------------------------------------------------
+    @brief Instance structure for the parallel 32-bit fixed-point block LMS filter.
+    @param[in]     pSrc      points to the beginning of the state buffer
+    @param[in,out] pCoeffs   points to the coefficients in time-reversed order
+    @param[in]     numTaps   number of filter coefficients
+    @param[in]     mu        step size
+    @param[in]     fracBits  number of fractional bits of the coefficients and mu
+    @param[in]     pRef      points to the reference samples
+    @param[in]     blkSize   number of samples
+    @param[in]     nPE       number of parallel processing units
+    @param[out]    pOut      points to the output samples
+    @param[out]    pErr      points to the error samples
+*/
+typedef struct {
+    const int32_t *pSrc;
+    int32_t *pCoeffs;
+    uint32_t numTaps;
+    int32_t mu;
+    uint32_t fracBits;
+    const int32_t *pRef;
+    uint32_t blkSize;
+    uint32_t nPE;
+    int32_t *pOut;
+    int32_t *pErr;
+} plp_lms_block_instance_q32;
+
+/** -------------------------------------------------------
+    @brief Instance structure for the parallel floating-point block LMS filter.
+    @param[in]     pSrc      points to the beginning of the state buffer
+    @param[in,out] pCoeffs   points to the coefficients in time-reversed order
+    @param[in]     numTaps   number of filter coefficients
+    @param[in]     mu        step size
+    @param[in]     pRef      points to the reference samples
+    @param[in]     blkSize   number of samples
+    @param[in]     nPE       number of parallel processing units
+    @param[out]    pOut      points to the output samples
+    @param[out]    pErr      points to the error samples
+*/
+typedef struct {
+    const float32_t *pSrc;
+    float32_t *pCoeffs;
+    uint32_t numTaps;
+    float32_t mu;
+    const float32_t *pRef;
+    uint32_t blkSize;
+    uint32_t nPE;
+    float32_t *pOut;
+    float32_t *pErr;
+} plp_lms_block_instance_f32;
+
 /**
  * @brief Instance structure for the fixed-point CFFT/CIFFT function.
  * @param[in]   fftLen              length of the FFT
@@ -308,6 +619,43 @@ typedef struct {
     uint32_t nPE;
 } plp_cfft_instance_q16_parallel;
 
+/**
+ * @brief Instance structure for the parallel Stockham CFFT Q16
+ * @param[in]       S                   points to the cfft_q16 struct
+ * @param[in]       pSrc                points to the input buffer of size <code>2*fftLen</code>
+ * @param[in]       pBuf                points to a temporary buffer of size <code>2*fftLen</code>
+ * @param[out]      pDst                points to the output buffer of size <code>2*fftLen</code>
+ * @param[in]       nPE                 number of cores to use
+ */
+typedef struct {
+    const plp_cfft_instance_q16 *S;
+    const int16_t *pSrc;
+    int16_t *pBuf;
+    int16_t *pDst;
+    uint32_t nPE;
+} plp_cfft_stockham_instance_q16_parallel;
+
+/**
+ * @brief Instance structure for the parallel block-floating-point CFFT Q16
+ * @param[in]       S                   points to the cfft_q16 struct
+ * @param[in,out]   p1                  points to the complex data buffer of size
+ * <code>2*fftLen</code>. Processing occurs in-place.
+ * @param[in]       bitReverseFlag      flag that enables (bitReverseFlag=1) of disables
+ * (bitReverseFlag=0) bit reversal of output.
+ * @param[out]      pExponent           points to the exponent of the output block
+ * @param[in]       pRange              points to a buffer of <code>2*nPE</code> values, used to
+ * exchange the maximum magnitudes between the cores
+ * @param[in]       nPE                 number of cores to use
+ */
+typedef struct {
+    const plp_cfft_instance_q16 *S;
+    int16_t *p1;
+    uint8_t bitReverseFlag;
+    int32_t *pExponent;
+    int32_t *pRange;
+    uint32_t nPE;
+} plp_cfft_bfp_instance_q16_parallel;
+
 /**
  * @brief Instance structure for the fixed-point CFFT/CIFFT function.
  * @param[in]   fftLen              length of the FFT
@@ -322,6 +670,96 @@ typedef struct {
     uint16_t bitRevLength;       /*< bit reversal table length. */
 } plp_cfft_instance_q32;
 
+/**
+ * @brief Instance structure for the parallel fixed-point CFFT/CIFFT function.
+ * @param[in]   S                   points to the instance of the 32bit quantized CFFT structure
+ * @param[in,out] p1                points to the complex data buffer
+ * @param[in]   ifftFlag            flag that selects forward or inverse transform
+ * @param[in]   bitReverseFlag      flag that enables or disables the bit reversal of the output
+ * @param[in]   fracBits            decimal point for right shift
+ * @param[in]   nPE                 number of cores
+ */
+typedef struct {
+    const plp_cfft_instance_q32 *S;
+    int32_t *p1;
+    uint8_t ifftFlag;
+    uint8_t bitReverseFlag;
+    uint32_t fracBits;
+    uint32_t nPE;
+} plp_cfft_instance_q32_parallel;
+
+/**
+ * @brief Instance structure for the fixed-point RFFT function.
+ * @param[in]   fftLenReal          length of the real FFT
+ * @param[in]   pCfft               points to the CFFT instance of length <code>fftLenReal/2</code>
+ * @param[in]   pTwiddleRFFT        points to the twiddle factors (cos, sin) of length
+ * <code>fftLenReal</code>, of which the first <code>fftLenReal/4+1</code> are used
+ */
+typedef struct {
+    uint16_t fftLenReal;                /*< length of the real FFT. */
+    const plp_cfft_instance_q16 *pCfft; /*< points to the complex FFT instance. */
+    const int16_t *pTwiddleRFFT;        /*< points to the twiddle factors of the split. */
+} plp_rfft_instance_q16;
+
+/**
+ * @brief Instance structure for the parallel RFFT Q16
+ * @param[in]   S       points to the RFFT instance
+ * @param[in]   pSrc    points to the real input buffer of size <code>fftLenReal</code>
+ * @param[in]   nPE     number of cores to use
+ * @param[out]  pDst    points to the complex output buffer of size <code>fftLenReal+2</code>
+ */
+typedef struct {
+    const plp_rfft_instance_q16 *S;
+    const int16_t *pSrc;
+    uint32_t nPE;
+    int16_t *pDst;
+} plp_rfft_instance_q16_parallel;
+
+/**
+ * @brief Instance structure for the fixed-point RFFT function.
+ * @param[in]   fftLenReal          length of the real FFT
+ * @param[in]   pCfft               points to the CFFT instance of length <code>fftLenReal/2</code>
+ * @param[in]   pTwiddleRFFT        points to the twiddle factors (cos, sin) of length
+ * <code>fftLenReal</code>, of which the first <code>fftLenReal/4+1</code> are used
+ */
+typedef struct {
+    uint16_t fftLenReal;                /*< length of the real FFT. */
+    const plp_cfft_instance_q32 *pCfft; /*< points to the complex FFT instance. */
+    const int32_t *pTwiddleRFFT;        /*< points to the twiddle factors of the split. */
+} plp_rfft_instance_q32;
+
+/**
+ * @brief Instance structure for the fixed-point DCT functions (DCT-II, its inverse and DCT-IV).
+ * @param[in]   dctLen          length of the DCT
+ * @param[in]   pCfft           points to the CFFT instance of length <code>dctLen/2</code>
+ * @param[in]   pTwiddleRFFT    points to the twiddle factors (cos, sin) of the real FFT of length
+ * <code>dctLen</code>, of which the first <code>dctLen/4+1</code> are used
+ * @param[in]   pTwiddleDCT     points to the twiddle factors (cos, sin) of angle
+ * <code>m*pi/(4*dctLen)</code>, for <code>m = 0..2*dctLen-1</code>
+ */
+typedef struct {
+    uint16_t dctLen;                    /*< length of the DCT. */
+    const plp_cfft_instance_q16 *pCfft; /*< points to the complex FFT instance. */
+    const int16_t *pTwiddleRFFT;        /*< points to the twiddle factors of the split. */
+    const int16_t *pTwiddleDCT;         /*< points to the twiddle factors of the rotations. */
+} plp_dct_instance_q16;
+
+/**
+ * @brief Instance structure for the fixed-point DCT functions (DCT-II, its inverse and DCT-IV).
+ * @param[in]   dctLen          length of the DCT
+ * @param[in]   pCfft           points to the CFFT instance of length <code>dctLen/2</code>
+ * @param[in]   pTwiddleRFFT    points to the twiddle factors (cos, sin) of the real FFT of length
+ * <code>dctLen</code>, of which the first <code>dctLen/4+1</code> are used
+ * @param[in]   pTwiddleDCT     points to the twiddle factors (cos, sin) of angle
+ * <code>m*pi/(4*dctLen)</code>, for <code>m = 0..2*dctLen-1</code>
+ */
+typedef struct {
+    uint16_t dctLen;                    /*< length of the DCT. */
+    const plp_cfft_instance_q32 *pCfft; /*< points to the complex FFT instance. */
+    const int32_t *pTwiddleRFFT;        /*< points to the twiddle factors of the split. */
+    const int32_t *pTwiddleDCT;         /*< points to the twiddle factors of the rotations. */
+} plp_dct_instance_q32;
+
 /** -------------------------------------------------------
     @struct plp_fft_instance_f32
     @brief Instance structure for floating-point FFT
@@ -359,6 +797,314 @@ typedef struct {
     float32_t *pDst;
 } plp_fft_instance_f32_parallel;
 
+/** -------------------------------------------------------
+    @struct plp_fft_stockham_instance_f32_parallel
+    @brief Instance structure for floating-point Stockham FFT (parallel version)
+    @param[in]  S         pointer to a plp_fft_instance_f32 data structure (FFT parameters)
+    @param[in]  pSrc      pointer to the input data buffer
+    @param[in]  pBuf      pointer to the temporary buffer of 2*FFTLength values
+    @param[in]  nPE       number of cores
+    @param[out] pDst      pointer to the output data buffer
+*/
+typedef struct {
+    const plp_fft_instance_f32 *S;
+    const float32_t *pSrc;
+    float32_t *pBuf;
+    uint32_t nPE;
+    float32_t *pDst;
+} plp_fft_stockham_instance_f32_parallel;
+
+/** -------------------------------------------------------
+    @struct plp_fft_batch_instance
+    @brief Instance structure for the batched FFTs (plp_cfft_batch_* and plp_rfft_batch_*)
+    @param[in]  S               pointer to the FFT instance of the data type (e.g.
+                                plp_fft_instance_f32 or plp_cfft_instance_q16)
+    @param[in]  pSrc            pointer to the first input frame
+    @param[out] pDst            pointer to the first output frame, equal to pSrc for in-place FFTs
+    @param[in]  count           number of transforms
+    @param[in]  srcStride       distance between two input frames, in values of the data type
+    @param[in]  dstStride       distance between two output frames, in values of the data type
+    @param[in]  ifftFlag        flag that selects forward or inverse transform (fixed-point CFFT)
+    @param[in]  bitReverseFlag  flag that enables the bit reversal of the output (fixed-point CFFT)
+    @param[in]  fracBits        decimal point of the input (fixed-point CFFT)
+    @param[in]  pBuf            pointer to the L1 buffer for the DMA transfers, or NULL
+    @param[in]  nPE             number of cores
+*/
+typedef struct {
+    const void *S;
+    const void *pSrc;
+    void *pDst;
+    uint32_t count;
+    uint32_t srcStride;
+    uint32_t dstStride;
+    uint8_t ifftFlag;
+    uint8_t bitReverseFlag;
+    uint32_t fracBits;
+    void *pBuf;
+    uint32_t nPE;
+} plp_fft_batch_instance;
+
+/**
+    @brief Window functions generated by plp_stft_init_f32 (periodic windows, as used for
+    spectral analysis)
+*/
+typedef enum {
+    PLP_WINDOW_RECTANGULAR,
+    PLP_WINDOW_HANN,
+    PLP_WINDOW_HAMMING,
+    PLP_WINDOW_BLACKMAN
+} plp_window_type;
+
+/**
+    @brief Output of the STFT for each frequency bin: complex value (real, imag), magnitude |X| or
+    power |X|^2
+*/
+typedef enum {
+    PLP_STFT_COMPLEX,
+    PLP_STFT_MAGNITUDE,
+    PLP_STFT_POWER
+} plp_stft_output;
+
+/** -------------------------------------------------------
+    @struct plp_stft_instance_f32
+    @brief Instance structure for the floating-point short-time Fourier transform, initialized
+    with plp_stft_init_f32.
+    @param[in]  S            points to the floating-point FFT instance, its FFTLength is the
+                             frame length. plp_stft_f32 enables its bit reversal.
+    @param[in]  pWindow      points to the analysis window of FFTLength values
+    @param[in]  hopLen       number of samples between the beginning of two frames
+    @param[in]  outType      output of each frequency bin (plp_stft_output)
+    @param[in]  frameStride  distance between two frames in the output, in output values (a
+                             complex value counts as one)
+    @param[in]  binStride    distance between two frequency bins in the output, in output values
+*/
+typedef struct {
+    const plp_fft_instance_f32 *S;
+    const float32_t *pWindow;
+    uint32_t hopLen;
+    plp_stft_output outType;
+    uint32_t frameStride;
+    uint32_t binStride;
+} plp_stft_instance_f32;
+
+/** -------------------------------------------------------
+    @struct plp_stft_instance_f32_parallel
+    @brief Parallel instance structure for the floating-point short-time Fourier transform
+    @param[in]  S        points to the STFT instance
+    @param[in]  pSrc     points to the first sample of the first frame
+    @param[in]  nFrames  number of frames
+    @param[in]  pBuf     points to the temporary buffer of 3*FFTLength*nPE floats
+    @param[in]  nPE      number of cores
+    @param[out] pDst     points to the output of the first frame
+*/
+typedef struct {
+    const plp_stft_instance_f32 *S;
+    const float32_t *pSrc;
+    uint32_t nFrames;
+    float32_t *pBuf;
+    uint32_t nPE;
+    float32_t *pDst;
+} plp_stft_instance_f32_parallel;
+
+/** -------------------------------------------------------
+    @struct plp_goertzel_instance_f32
+    @brief Instance structure for the floating-point Goertzel algorithm, initialized with
+    plp_goertzel_init_f32.
+    @param[in]  nBins    number of frequency bins
+    @param[in]  pCoeffs  cos(w) and sin(w) of the frequency of every bin
+*/
+typedef struct {
+    uint32_t nBins;
+    const float32_t *pCoeffs;
+} plp_goertzel_instance_f32;
+
+/** -------------------------------------------------------
+    @struct plp_goertzel_instance_q16
+    @brief Instance structure for the 16-bit fix-point Goertzel algorithm, initialized with
+    plp_goertzel_init_q16.
+    @param[in]  nBins    number of frequency bins
+    @param[in]  pCoeffs  cos(w) and sin(w) of the frequency of every bin in Q2.30 format
+*/
+typedef struct {
+    uint32_t nBins;
+    const int32_t *pCoeffs;
+} plp_goertzel_instance_q16;
+
+/** -------------------------------------------------------
+    @struct plp_goertzel_instance_q32
+    @brief Instance structure for the 32-bit fix-point Goertzel algorithm, initialized with
+    plp_goertzel_init_q32.
+    @param[in]  nBins    number of frequency bins
+    @param[in]  pCoeffs  cos(w) and sin(w) of the frequency of every bin in Q2.30 format
+*/
+typedef struct {
+    uint32_t nBins;
+    const int32_t *pCoeffs;
+} plp_goertzel_instance_q32;
+
+/** -------------------------------------------------------
+    @struct plp_goertzel_instance_parallel
+    @brief Parallel instance structure for the Goertzel algorithm
+    @param[in]  S          points to the Goertzel instance (plp_goertzel_instance_*)
+    @param[in]  pSrc       points to the block of input samples
+    @param[in]  blockSize  number of samples
+    @param[in]  shift      amount to shift the samples to the right (fix-point)
+    @param[in]  nPE        number of cores
+    @param[out] pDst       points to the output, real and imaginary part of every bin
+*/
+typedef struct {
+    const void *S;
+    const void *pSrc;
+    uint32_t blockSize;
+    uint32_t shift;
+    uint32_t nPE;
+    void *pDst;
+} plp_goertzel_instance_parallel;
+
+/** -------------------------------------------------------
+    @struct plp_sdft_instance_f32
+    @brief Instance structure for the floating-point sliding DFT, initialized with
+    plp_sdft_init_f32.
+    @param[in]  N          length of the window
+    @param[in]  nBins      number of frequency bins
+    @param[in]  pBins      indices of the bins, in [0, N)
+    @param[in]  pTwiddles  cos(2 pi m / N) and sin(2 pi m / N) for m = 0, ..., N-1
+    @param[in]  pWindow    circular buffer of the last N samples
+    @param[in]  pState     real and imaginary part of the state of every bin
+    @param[in]  pos        position of the next sample in the window
+*/
+typedef struct {
+    uint32_t N;
+    uint32_t nBins;
+    const uint32_t *pBins;
+    const float32_t *pTwiddles;
+    float32_t *pWindow;
+    float32_t *pState;
+    uint32_t pos;
+} plp_sdft_instance_f32;
+
+/** -------------------------------------------------------
+    @struct plp_sdft_instance_q16
+    @brief Instance structure for the 16-bit fix-point sliding DFT, initialized with
+    plp_sdft_init_q16.
+    @param[in]  N          length of the window
+    @param[in]  nBins      number of frequency bins
+    @param[in]  pBins      indices of the bins, in [0, N)
+    @param[in]  pTwiddles  cos(2 pi m / N) and sin(2 pi m / N) for m = 0, ..., N-1 in Q1.15
+    @param[in]  pWindow    circular buffer of the last N samples
+    @param[in]  pState     real and imaginary part of the state of every bin in Q2.30
+    @param[in]  pos        position of the next sample in the window
+*/
+typedef struct {
+    uint32_t N;
+    uint32_t nBins;
+    const uint32_t *pBins;
+    const int16_t *pTwiddles;
+    int16_t *pWindow;
+    int64_t *pState;
+    uint32_t pos;
+} plp_sdft_instance_q16;
+
+/** -------------------------------------------------------
+    @struct plp_psd_welch_instance_f32
+    @brief Instance structure for the floating-point Welch power spectral density, initialized
+    with plp_psd_welch_init_f32.
+    @param[in]  S        points to the floating-point FFT instance, its FFTLength is the segment
+                         length. plp_psd_welch_f32 enables its bit reversal.
+    @param[in]  pWindow  points to the window of FFTLength values
+    @param[in]  hopLen   number of samples between the beginning of two segments
+    @param[in]  norm     1 / sum(w^2) of the window
+*/
+typedef struct {
+    const plp_fft_instance_f32 *S;
+    const float32_t *pWindow;
+    uint32_t hopLen;
+    float32_t norm;
+} plp_psd_welch_instance_f32;
+
+/** -------------------------------------------------------
+    @struct plp_psd_welch_instance_f32_parallel
+    @brief Parallel instance structure for the floating-point Welch power spectral density
+    @param[in]  S          points to the Welch PSD instance
+    @param[in]  pSrc       points to the first sample of the first segment
+    @param[in]  nSegments  number of segments
+    @param[in]  pBuf       points to the temporary buffer of 4*FFTLength*nPE floats
+    @param[in]  nPE        number of cores
+    @param[out] pDst       points to the output of FFTLength / 2 + 1 bins
+*/
+typedef struct {
+    const plp_psd_welch_instance_f32 *S;
+    const float32_t *pSrc;
+    uint32_t nSegments;
+    float32_t *pBuf;
+    uint32_t nPE;
+    float32_t *pDst;
+} plp_psd_welch_instance_f32_parallel;
+
+/** -------------------------------------------------------
+    @struct plp_psd_welch_instance_q16
+    @brief Instance structure for the 16-bit fix-point Welch power spectral density, initialized
+    with plp_psd_welch_init_q16.
+    @param[in]  S        points to the 16-bit RFFT instance, its fftLenReal is the segment length
+    @param[in]  pWindow  points to the window of fftLenReal values in Q1.15
+    @param[in]  hopLen   number of samples between the beginning of two segments
+    @param[in]  norm     fftLenReal^2 / sum(w^2) of the window in Q16.16
+*/
+typedef struct {
+    const plp_rfft_instance_q16 *S;
+    const int16_t *pWindow;
+    uint32_t hopLen;
+    uint32_t norm;
+} plp_psd_welch_instance_q16;
+
+/** -------------------------------------------------------
+    @struct plp_psd_welch_instance_q16_parallel
+    @brief Parallel instance structure for the 16-bit fix-point Welch power spectral density
+    @param[in]  S          points to the Welch PSD instance
+    @param[in]  pSrc       points to the first sample of the first segment
+    @param[in]  nSegments  number of segments
+    @param[in]  pBuf       points to the temporary buffer of (4*fftLenReal+8)*nPE values
+    @param[in]  nPE        number of cores
+    @param[out] pDst       points to the output of fftLenReal / 2 + 1 bins in Q17.15
+*/
+typedef struct {
+    const plp_psd_welch_instance_q16 *S;
+    const int16_t *pSrc;
+    uint32_t nSegments;
+    int16_t *pBuf;
+    uint32_t nPE;
+    int32_t *pDst;
+} plp_psd_welch_instance_q16_parallel;
+
+/** -------------------------------------------------------
+    @struct plp_hilbert_fir_instance_f32
+    @brief Instance structure for the floating-point FIR Hilbert transformer, initialized with
+    plp_hilbert_fir_init_f32.
+    @param[in]  numPairs  number of coefficients, the delay is 2*numPairs - 1 samples
+    @param[in]  pCoeffs   points to the coefficients of the odd distances 1, 3, ..., 2*numPairs - 1
+    @param[in]  pState    points to the state buffer of 4*numPairs - 2 + blockSize samples
+*/
+typedef struct {
+    uint32_t numPairs;
+    const float32_t *pCoeffs;
+    float32_t *pState;
+} plp_hilbert_fir_instance_f32;
+
+/** -------------------------------------------------------
+    @struct plp_hilbert_fir_instance_q16
+    @brief Instance structure for the 16-bit fix-point FIR Hilbert transformer, initialized with
+    plp_hilbert_fir_init_q16.
+    @param[in]  numPairs  number of coefficients, the delay is 2*numPairs - 1 samples
+    @param[in]  pCoeffs   points to the coefficients of the odd distances 1, 3, ..., 2*numPairs - 1
+                          in Q1.15
+    @param[in]  pState    points to the state buffer of 4*numPairs - 2 + blockSize samples
+*/
+typedef struct {
+    uint32_t numPairs;
+    const int16_t *pCoeffs;
+    int16_t *pState;
+} plp_hilbert_fir_instance_q16;
+
 /** -------------------------------------------------------
     @struct plp_triangular_filter_f32
     @brief structure containing non-zero values of triangular filterbanks
@@ -377,6 +1123,25 @@ typedef struct {
     const uint8_t nFilters;
 } plp_triangular_filter_f32;
 
+/** -------------------------------------------------------
+    @struct plp_triangular_filter_q16
+    @brief structure containing non-zero values of triangular filterbanks in fixed-point
+    @param  V               pointer to an array containing all non-zero filter
+                            coefficients of the triangular filters in Q1.15
+                            (non-negative)
+    @param  firstValue      pointer to array containing indexes of the
+                            first non-zero coefficients of the filters
+    @param  filterLength    pointer to array containing lengths of the
+                            non-zero region of each filter
+    @param  nFilters        total amount of triangular filters (n_mels)
+*/
+typedef struct {
+    const int16_t *V;
+    const uint16_t *firstValue;
+    const uint16_t *filterLength;
+    const uint8_t nFilters;
+} plp_triangular_filter_q16;
+
 /** -------------------------------------------------------
     @struct Complex_type_f32
     @brief Helper type to represent complex values with float32 components.
@@ -455,84 +1220,382 @@ typedef struct {
 } plp_mat_mult_instance_q8;
 
 /** -------------------------------------------------------
- * @brief Instance structure for 16-bit fix-point parallel matrix multiplication.
+ * @brief Requantization of the 32-bit accumulators of an 8-bit matrix multiplication. Row m of
+ *        the output is computed as clamp((acc + pBias[m]) * pMult[m] >> pShift[m], outMin, outMax),
+ *        with rounding. pBias may be NULL. A ReLU activation is obtained with outMin = 0.
  */
 typedef struct {
-    const int16_t *__restrict__ pSrcA;
-    const int16_t *__restrict__ pSrcB;
+    const int32_t *pBias;
+    const int32_t *pMult;
+    const uint32_t *pShift;
+    int32_t outMin;
+    int32_t outMax;
+} plp_requant_params_i8;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for 8-bit parallel matrix multiplication with requantization.
+ */
+typedef struct {
+    const int8_t *__restrict__ pSrcA;
+    const int8_t *__restrict__ pSrcB;
     uint32_t M;
     uint32_t N;
     uint32_t O;
-    uint32_t shift;
+    uint32_t strideA;
+    uint32_t strideB;
+    uint32_t strideC;
+    const plp_requant_params_i8 *pParams;
     uint32_t nPE;
-    int16_t *__restrict__ pDstC;
-} plp_mat_mult_instance_q16;
+    int8_t *__restrict__ pDstC;
+} plp_mat_mult_requant_instance_i8;
 
 /** -------------------------------------------------------
- * @brief Instance structure for 32-bit fix-point parallel matrix multiplication.
+ * @brief Instance structure for 32-bit integer parallel matrix-vector multiplication.
  */
 typedef struct {
     const int32_t *__restrict__ pSrcA;
-    const int32_t *__restrict__ pSrcB;
+    const int32_t *__restrict__ pSrcX;
     uint32_t M;
     uint32_t N;
-    uint32_t O;
-    uint32_t shift;
     uint32_t nPE;
-    int32_t *__restrict__ pDstC;
-} plp_mat_mult_instance_q32;
+    int32_t *__restrict__ pDstY;
+} plp_mat_vec_instance_i32;
 
 /** -------------------------------------------------------
- * @brief Instance structure for integer parallel complex matrix matrix multiplication.
+ * @brief Instance structure for 16-bit integer parallel matrix-vector multiplication.
  */
 typedef struct {
-    const int8_t *__restrict__ pSrcA;
-    const int8_t *__restrict__ pSrcB;
+    const int16_t *__restrict__ pSrcA;
+    const int16_t *__restrict__ pSrcX;
     uint32_t M;
     uint32_t N;
-    uint32_t O;
     uint32_t nPE;
-    int32_t *__restrict__ pDstC;
-} plp_mat_mult_cmplx_instance_i8;
+    int32_t *__restrict__ pDstY;
+} plp_mat_vec_instance_i16;
 
 /** -------------------------------------------------------
- * @brief Instance structure for integer parallel complex matrix matrix multiplication.
+ * @brief Instance structure for 8-bit integer parallel matrix-vector multiplication.
  */
 typedef struct {
-    const int16_t *__restrict__ pSrcA;
-    const int16_t *__restrict__ pSrcB;
+    const int8_t *__restrict__ pSrcA;
+    const int8_t *__restrict__ pSrcX;
     uint32_t M;
     uint32_t N;
-    uint32_t O;
     uint32_t nPE;
-    int32_t *__restrict__ pDstC;
-} plp_mat_mult_cmplx_instance_i16;
+    int32_t *__restrict__ pDstY;
+} plp_mat_vec_instance_i8;
 
 /** -------------------------------------------------------
- * @brief Instance structure for integer parallel complex matrix matrix multiplication.
+ * @brief Instance structure for 32-bit fix-point parallel matrix-vector multiplication.
  */
 typedef struct {
     const int32_t *__restrict__ pSrcA;
-    const int32_t *__restrict__ pSrcB;
+    const int32_t *__restrict__ pSrcX;
     uint32_t M;
     uint32_t N;
-    uint32_t O;
+    uint32_t shift;
     uint32_t nPE;
-    int32_t *__restrict__ pDstC;
-} plp_mat_mult_cmplx_instance_i32;
+    int32_t *__restrict__ pDstY;
+} plp_mat_vec_instance_q32;
 
 /** -------------------------------------------------------
- * @brief Instance structure for floating-point parallel complex matrix matrix multiplication.
+ * @brief Instance structure for 16-bit fix-point parallel matrix-vector multiplication.
  */
 typedef struct {
-    const float *__restrict__ pSrcA;
-    const float *__restrict__ pSrcB;
+    const int16_t *__restrict__ pSrcA;
+    const int16_t *__restrict__ pSrcX;
     uint32_t M;
     uint32_t N;
-    uint32_t O;
+    uint32_t shift;
     uint32_t nPE;
-    float *__restrict__ pDstC;
-} plp_mat_mult_cmplx_instance_f32;
+    int16_t *__restrict__ pDstY;
+} plp_mat_vec_instance_q16;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for 8-bit fix-point parallel matrix-vector multiplication.
+ */
+typedef struct {
+    const int8_t *__restrict__ pSrcA;
+    const int8_t *__restrict__ pSrcX;
+    uint32_t M;
+    uint32_t N;
+    uint32_t shift;
+    uint32_t nPE;
+    int8_t *__restrict__ pDstY;
+} plp_mat_vec_instance_q8;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for 32-bit floating-point parallel matrix-vector multiplication.
+ */
+typedef struct {
+    const float *__restrict__ pSrcA;
+    const float *__restrict__ pSrcX;
+    uint32_t M;
+    uint32_t N;
+    uint32_t nPE;
+    float *__restrict__ pDstY;
+} plp_mat_vec_instance_f32;
+
+/** -------------------------------------------------------
+    @struct plp_mat_batch_instance
+    @brief Instance structure for the batched matrix operations (plp_mat_mult_batch_*,
+           plp_mat_mult_trans_batch_* and plp_mat_add_batch_*)
+    @param[in]  pSrcA    pointer to the first matrix of the batch of first operands
+    @param[in]  pSrcB    pointer to the first matrix of the batch of second operands
+    @param[in]  M        height of the first operands and of the outputs
+    @param[in]  N        width of the first operands
+    @param[in]  O        width of the outputs (not used by the addition)
+    @param[in]  count    number of matrices in the batch
+    @param[in]  strideA  distance between two first operands, in values of the data type
+    @param[in]  strideB  distance between two second operands, in values of the data type
+    @param[in]  strideC  distance between two outputs, in values of the data type
+    @param[in]  nPE      number of cores
+    @param[out] pDstC    pointer to the first matrix of the batch of outputs
+*/
+typedef struct {
+    const void *pSrcA;
+    const void *pSrcB;
+    uint32_t M;
+    uint32_t N;
+    uint32_t O;
+    uint32_t count;
+    uint32_t strideA;
+    uint32_t strideB;
+    uint32_t strideC;
+    uint32_t nPE;
+    void *pDstC;
+} plp_mat_batch_instance;
+
+/** -------------------------------------------------------
+    @struct plp_mat_inv_batch_instance_f32
+    @brief Instance structure for the batched matrix inversion of 32-bit floating-point matrices
+    @param[in]  pSrc       pointer to the first matrix of the batch of inputs, modified
+    @param[in]  N          width and height of the matrices
+    @param[in]  count      number of matrices in the batch
+    @param[in]  strideSrc  distance between two inputs, in elements
+    @param[in]  strideDst  distance between two outputs, in elements
+    @param[in]  nPE        number of cores
+    @param[out] pDst       pointer to the first matrix of the batch of outputs
+    @param[out] singular   set to 1 by the kernel if at least one matrix is singular
+*/
+typedef struct {
+    float *__restrict__ pSrc;
+    uint32_t N;
+    uint32_t count;
+    uint32_t strideSrc;
+    uint32_t strideDst;
+    uint32_t nPE;
+    float *__restrict__ pDst;
+    uint32_t singular;
+} plp_mat_inv_batch_instance_f32;
+
+/** -------------------------------------------------------
+    @struct plp_sparse_csr_f32
+    @brief Sparse matrix of 32-bit floating-point values in compressed sparse row (CSR) format
+    @param[in]  pValues  non-zero values of the matrix, row after row
+    @param[in]  pColIdx  column of every value of pValues
+    @param[in]  pRowPtr  index of the first value of every row in pValues, with nRows + 1 entries
+                         (pRowPtr[0] = 0, and pRowPtr[nRows] is the number of non-zero values)
+    @param[in]  nRows    number of rows
+    @param[in]  nCols    number of columns
+*/
+typedef struct {
+    const float *pValues;
+    const uint16_t *pColIdx;
+    const uint32_t *pRowPtr;
+    uint32_t nRows;
+    uint32_t nCols;
+} plp_sparse_csr_f32;
+
+/** -------------------------------------------------------
+    @struct plp_sparse_csr_q16
+    @brief Sparse matrix of 16-bit fix-point values in compressed sparse row (CSR) format
+    @param[in]  pValues  non-zero values of the matrix, row after row
+    @param[in]  pColIdx  column of every value of pValues
+    @param[in]  pRowPtr  index of the first value of every row in pValues, with nRows + 1 entries
+                         (pRowPtr[0] = 0, and pRowPtr[nRows] is the number of non-zero values)
+    @param[in]  nRows    number of rows
+    @param[in]  nCols    number of columns
+*/
+typedef struct {
+    const int16_t *pValues;
+    const uint16_t *pColIdx;
+    const uint32_t *pRowPtr;
+    uint32_t nRows;
+    uint32_t nCols;
+} plp_sparse_csr_q16;
+
+/** -------------------------------------------------------
+    @struct plp_sparse_csr_q8
+    @brief Sparse matrix of 8-bit fix-point values in compressed sparse row (CSR) format
+    @param[in]  pValues  non-zero values of the matrix, row after row
+    @param[in]  pColIdx  column of every value of pValues
+    @param[in]  pRowPtr  index of the first value of every row in pValues, with nRows + 1 entries
+                         (pRowPtr[0] = 0, and pRowPtr[nRows] is the number of non-zero values)
+    @param[in]  nRows    number of rows
+    @param[in]  nCols    number of columns
+*/
+typedef struct {
+    const int8_t *pValues;
+    const uint16_t *pColIdx;
+    const uint32_t *pRowPtr;
+    uint32_t nRows;
+    uint32_t nCols;
+} plp_sparse_csr_q8;
+
+/** -------------------------------------------------------
+    @struct plp_sparse_ell_f32
+    @brief Sparse matrix of 32-bit floating-point values in ELLPACK (ELL) format
+    @param[in]  pValues  width values of every row, row after row (nRows * width values). Rows with
+                         less non-zero values are padded with zeros
+    @param[in]  pColIdx  column of every value of pValues, any valid column (e.g. 0) for the padding
+    @param[in]  nRows    number of rows
+    @param[in]  nCols    number of columns
+    @param[in]  width    number of values per row, i.e. the largest number of non-zero values in a
+                         row
+*/
+typedef struct {
+    const float *pValues;
+    const uint16_t *pColIdx;
+    uint32_t nRows;
+    uint32_t nCols;
+    uint32_t width;
+} plp_sparse_ell_f32;
+
+/** -------------------------------------------------------
+    @struct plp_sparse_ell_q16
+    @brief Sparse matrix of 16-bit fix-point values in ELLPACK (ELL) format
+    @param[in]  pValues  width values of every row, row after row (nRows * width values). Rows with
+                         less non-zero values are padded with zeros
+    @param[in]  pColIdx  column of every value of pValues, any valid column (e.g. 0) for the padding
+    @param[in]  nRows    number of rows
+    @param[in]  nCols    number of columns
+    @param[in]  width    number of values per row, i.e. the largest number of non-zero values in a
+                         row
+*/
+typedef struct {
+    const int16_t *pValues;
+    const uint16_t *pColIdx;
+    uint32_t nRows;
+    uint32_t nCols;
+    uint32_t width;
+} plp_sparse_ell_q16;
+
+/** -------------------------------------------------------
+    @struct plp_sparse_ell_q8
+    @brief Sparse matrix of 8-bit fix-point values in ELLPACK (ELL) format
+    @param[in]  pValues  width values of every row, row after row (nRows * width values). Rows with
+                         less non-zero values are padded with zeros
+    @param[in]  pColIdx  column of every value of pValues, any valid column (e.g. 0) for the padding
+    @param[in]  nRows    number of rows
+    @param[in]  nCols    number of columns
+    @param[in]  width    number of values per row, i.e. the largest number of non-zero values in a
+                         row
+*/
+typedef struct {
+    const int8_t *pValues;
+    const uint16_t *pColIdx;
+    uint32_t nRows;
+    uint32_t nCols;
+    uint32_t width;
+} plp_sparse_ell_q8;
+
+/** -------------------------------------------------------
+    @struct plp_spmv_instance
+    @brief Instance structure for the parallel sparse matrix-vector multiplications
+    @param[in]  S      points to the sparse matrix (plp_sparse_csr_* or plp_sparse_ell_*)
+    @param[in]  pSrc   points to the input vector
+    @param[in]  shift  amount to shift the accumulated result to the right (fix-point)
+    @param[in]  nPE    number of cores
+    @param[out] pDst   points to the output vector
+*/
+typedef struct {
+    const void *S;
+    const void *pSrc;
+    uint32_t shift;
+    uint32_t nPE;
+    void *pDst;
+} plp_spmv_instance;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for 16-bit fix-point parallel matrix multiplication.
+ */
+typedef struct {
+    const int16_t *__restrict__ pSrcA;
+    const int16_t *__restrict__ pSrcB;
+    uint32_t M;
+    uint32_t N;
+    uint32_t O;
+    uint32_t shift;
+    uint32_t nPE;
+    int16_t *__restrict__ pDstC;
+} plp_mat_mult_instance_q16;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for 32-bit fix-point parallel matrix multiplication.
+ */
+typedef struct {
+    const int32_t *__restrict__ pSrcA;
+    const int32_t *__restrict__ pSrcB;
+    uint32_t M;
+    uint32_t N;
+    uint32_t O;
+    uint32_t shift;
+    uint32_t nPE;
+    int32_t *__restrict__ pDstC;
+} plp_mat_mult_instance_q32;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for integer parallel complex matrix matrix multiplication.
+ */
+typedef struct {
+    const int8_t *__restrict__ pSrcA;
+    const int8_t *__restrict__ pSrcB;
+    uint32_t M;
+    uint32_t N;
+    uint32_t O;
+    uint32_t nPE;
+    int32_t *__restrict__ pDstC;
+} plp_mat_mult_cmplx_instance_i8;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for integer parallel complex matrix matrix multiplication.
+ */
+typedef struct {
+    const int16_t *__restrict__ pSrcA;
+    const int16_t *__restrict__ pSrcB;
+    uint32_t M;
+    uint32_t N;
+    uint32_t O;
+    uint32_t nPE;
+    int32_t *__restrict__ pDstC;
+} plp_mat_mult_cmplx_instance_i16;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for integer parallel complex matrix matrix multiplication.
+ */
+typedef struct {
+    const int32_t *__restrict__ pSrcA;
+    const int32_t *__restrict__ pSrcB;
+    uint32_t M;
+    uint32_t N;
+    uint32_t O;
+    uint32_t nPE;
+    int32_t *__restrict__ pDstC;
+} plp_mat_mult_cmplx_instance_i32;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for floating-point parallel complex matrix matrix multiplication.
+ */
+typedef struct {
+    const float *__restrict__ pSrcA;
+    const float *__restrict__ pSrcB;
+    uint32_t M;
+    uint32_t N;
+    uint32_t O;
+    uint32_t nPE;
+    float *__restrict__ pDstC;
+} plp_mat_mult_cmplx_instance_f32;
 
 /** -------------------------------------------------------
  * @brief Instance structure for 8-bit fix-point parallel complex matrix matrix multiplication.
@@ -1630,6 +2693,98 @@ uint32_t plp_dwt_max_level(uint32_t sig_len, uint32_t wavelet_len);
 
 uint32_t plp_dwt_dec_len(uint32_t sig_len, uint32_t wavelet_len, uint32_t level);
 
+/** -------------------------------------------------------
+    @brief Value for the nPE argument of the parallel glue code which lets the library choose the
+    number of cores based on the problem size (see plp_npe_auto).
+*/
+#define PLP_NPE_AUTO 0
+
+/** -------------------------------------------------------
+    @struct plp_npe_cost_model
+    @brief Cost model used to select the number of cores of a parallel kernel.
+    The single-core execution time is modeled as <code>opCycles * nOps / 16</code>, and the
+    parallel execution time on p cores as <code>forkCycles + opCycles * nOps * ceil(nUnits / p) /
+    (16 * nUnits)</code>, where nUnits is the number of independent work items the parallel kernel
+    distributes over the cores.
+    @param  opCycles    cycles per operation on a single core, in Q4 fixed-point format
+    @param  forkCycles  fixed cycles spent for forking the team and for the final barrier
+*/
+typedef struct {
+    uint16_t opCycles;
+    uint16_t forkCycles;
+} plp_npe_cost_model;
+
+#ifdef PLP_PROFILE
+
+#ifndef PLP_PROFILE_NB_CORES
+#define PLP_PROFILE_NB_CORES 8 // maximum number of cluster cores
+#endif
+
+/** -------------------------------------------------------
+    @struct plp_profile_counters
+    @brief Performance counters accumulated by the profiling mode (PLP_PROFILE).
+    @param  calls    number of calls (or forks, for the counters of a parallel kernel)
+    @param  cycles   number of cycles
+    @param  instr    number of executed instructions
+    @param  ldStall  number of load stalls
+*/
+typedef struct {
+    uint32_t calls;
+    uint64_t cycles;
+    uint64_t instr;
+    uint64_t ldStall;
+} plp_profile_counters;
+
+/** -------------------------------------------------------
+    @struct plp_profile_entry
+    @brief Profile of one glue function, collected when the library is built with PLP_PROFILE.
+    @param  name        name of the glue function
+    @param  registered  set once the entry is linked into the profile table
+    @param  core        counters of the glue function, per calling core. The cluster cores use the
+                        index hal_core_id(), the fabric controller the index PLP_PROFILE_NB_CORES.
+    @param  fork        counters of each core while executing the parallel kernels forked by the
+                        glue function, to expose load imbalance
+    @param  next        next entry in the profile table
+*/
+typedef struct plp_profile_entry {
+    const char *name;
+    uint32_t registered;
+    plp_profile_counters core[PLP_PROFILE_NB_CORES + 1];
+    plp_profile_counters fork[PLP_PROFILE_NB_CORES];
+    struct plp_profile_entry *next;
+} plp_profile_entry;
+
+/** -------------------------------------------------------
+    @struct plp_profile_scope
+    @brief Counter values at the beginning of a profiled call (internal to PLP_PROFILE_FUNCTION).
+*/
+typedef struct {
+    plp_profile_entry *entry;
+    plp_profile_entry *parent;
+    uint32_t cycles;
+    uint32_t instr;
+    uint32_t ldStall;
+} plp_profile_scope;
+
+plp_profile_scope plp_profile_begin(plp_profile_entry *entry);
+
+void plp_profile_end(plp_profile_scope *scope);
+
+/** -------------------------------------------------------
+    @brief Instruments the enclosing glue function. The counters are read when the function is
+    entered and again on every return path (using the cleanup attribute of GCC).
+*/
+#define PLP_PROFILE_FUNCTION()                                                                     \
+    static plp_profile_entry __plp_profile_entry = { .name = __func__ };                           \
+    plp_profile_scope __plp_profile_scope __attribute__((cleanup(plp_profile_end))) =              \
+        plp_profile_begin(&__plp_profile_entry)
+
+#else
+
+#define PLP_PROFILE_FUNCTION()
+
+#endif
+
 /** -------------------------------------------------------
     @brief Glue code for parallel dot product of 32-bit integer vectors.
     @param[in]  pSrcA      points to the first input vector
@@ -3112,6 +4267,59 @@ void plp_copy_f32s_rv32im(float32_t *__restrict__ pSrc,
                            float32_t *__restrict__ pDst,
                            uint32_t blockSize);
 
+/** -------------------------------------------------------
+    @brief      Selects the number of cores for a parallel kernel based on a cost model.
+    @param[in]  model   points to the cost model of the parallel kernel
+    @param[in]  nOps    number of operations (e.g. MACs) of the problem
+    @param[in]  nUnits  number of independent work items distributed over the cores
+    @return     number of cores to use, between 1 and hal_cl_nb_pe_cores()
+*/
+
+uint32_t plp_npe_auto(const plp_npe_cost_model *model, uint32_t nOps, uint32_t nUnits);
+
+#ifdef PLP_PROFILE
+
+/** -------------------------------------------------------
+    @brief      Returns the first entry of the profile table, the other entries follow by the next
+                pointer. Only functions that were called at least once are in the table.
+    @return     first entry, or NULL if no profiled function was called yet
+*/
+
+const plp_profile_entry *plp_profile_first(void);
+
+/** -------------------------------------------------------
+    @brief      Searches the profile table for a glue function.
+    @param[in]  name  name of the glue function, e.g. "plp_dot_prod_i32"
+    @return     entry of the function, or NULL if it was not called yet
+*/
+
+const plp_profile_entry *plp_profile_find(const char *name);
+
+/** -------------------------------------------------------
+    @brief      Sums the counters of an entry over all calling cores.
+    @param[in]  entry  entry of the profile table
+    @param[out] pRes   sum of the counters
+    @return     none
+*/
+
+void plp_profile_total(const plp_profile_entry *entry, plp_profile_counters *pRes);
+
+/** -------------------------------------------------------
+    @brief      Clears the counters of all entries in the profile table.
+    @return     none
+*/
+
+void plp_profile_reset(void);
+
+/** -------------------------------------------------------
+    @brief      Prints the profile table, including the per-core counters of parallel kernels.
+    @return     none
+*/
+
+void plp_profile_dump(void);
+
+#endif
+
 /** -------------------------------------------------------
     @brief      Glue code for mean value of a 32-bit float vector.
     @param[in]  pSrc       points to the input vector
@@ -5168,3484 +6376,8164 @@ void plp_conv_parallel_OLA(uint32_t nPE,
 void plp_conv_parallel_OLA_kernel(void *task_args);
 
 /** -------------------------------------------------------
-   @brief      Glue code for matrix matrix multiplication of a 32-bit integer matrices.
-   @param[in]  pSrcA points to first the input matrix
-   @param[in]  pSrcB points to second the input matrix
-   @param[in]  M     Height of first matrix
-   @param[in]  N     Width of first and heigt of second matrix
-   @param[in]  O     Width of second matrix
-   @param[out] pDstC Output is written here
-   @return     none
-*/
+  @brief Initialization of the 16-bit fixed-point polyphase FIR decimator.
+  @param[out] S         points to the instance structure
+  @param[in]  M         decimation factor
+  @param[in]  numTaps   number of filter coefficients
+  @param[in]  pCoeffs   points to the coefficients in time-reversed order
+  @param[in]  pState    points to the state buffer of length numTaps - 1 + blockSize
+  @param[in]  fracBits  number of fractional bits of the coefficients
+  @return     none
+ */
 
-void plp_mat_mult_i32(const int32_t *__restrict__ pSrcA,
-                      const int32_t *__restrict__ pSrcB,
-                      uint32_t M,
-                      uint32_t N,
-                      uint32_t O,
-                      int32_t *__restrict__ pDstC);
+void plp_fir_decimate_init_q16(plp_fir_decimate_instance_q16 *S,
+                               uint8_t M,
+                               uint16_t numTaps,
+                               const int16_t *pCoeffs,
+                               int16_t *pState,
+                               uint32_t fracBits);
 
 /** -------------------------------------------------------
-   @brief      Matrix matrix multiplication of a 32-bit integer matrices for RV32IM extension.
-   @param[in]  pSrcA points to first the input matrix
-   @param[in]  pSrcB points to second the input matrix
-   @param[in]  M     Height of first matrix
-   @param[in]  N     Width of first and heigt of second matrix
-   @param[in]  O     Width of second matrix
-   @param[out] pDstC Output is written here
-   @return     none
-*/
+  @brief Glue code for the 16-bit fixed-point polyphase FIR decimator.
+  @param[in]  S          points to the instance structure
+  @param[in]  pSrc       points to the input block
+  @param[in]  blockSize  number of input samples, must be a multiple of M
+  @param[out] pDst       points to the output block of length blockSize / M
+  @return     none
+ */
 
-void plp_mat_mult_i32s_rv32im(const int32_t *__restrict__ pSrcA,
-                              const int32_t *__restrict__ pSrcB,
-                              uint32_t M,
-                              uint32_t N,
-                              uint32_t O,
-                              int32_t *__restrict__ pDstC);
+void plp_fir_decimate_q16(const plp_fir_decimate_instance_q16 *S,
+                          const int16_t *__restrict__ pSrc,
+                          uint32_t blockSize,
+                          int16_t *__restrict__ pDst);
 
 /** -------------------------------------------------------
-   @brief      Matrix matrix multiplication of a 32-bit integer matrices for XPULPV2 extension.
-   @param[in]  pSrcA points to first the input matrix
-   @param[in]  pSrcB points to second the input matrix
-   @param[in]  M     Height of first matrix
-   @param[in]  N     Width of first and heigt of second matrix
-   @param[in]  O     Width of second matrix
-   @param[out] pDstC Output is written here
-   @return     none
-*/
+  @brief Glue code for the parallel 16-bit fixed-point polyphase FIR decimator.
+  @param[in]  S          points to the instance structure
+  @param[in]  pSrc       points to the input block
+  @param[in]  blockSize  number of input samples, must be a multiple of M
+  @param[in]  nPE        number of cores to compute on
+  @param[out] pDst       points to the output block of length blockSize / M
+  @return     none
+ */
 
-void plp_mat_mult_i32s_xpulpv2(const int32_t *__restrict__ pSrcA,
-                               const int32_t *__restrict__ pSrcB,
-                               uint32_t M,
-                               uint32_t N,
-                               uint32_t O,
-                               int32_t *__restrict__ pDstC);
+void plp_fir_decimate_q16_parallel(const plp_fir_decimate_instance_q16 *S,
+                                   const int16_t *__restrict__ pSrc,
+                                   uint32_t blockSize,
+                                   uint32_t nPE,
+                                   int16_t *__restrict__ pDst);
 
 /** -------------------------------------------------------
-   @brief      Glue code for matrix matrix multiplication of a 16-bit integer matrices.
-   @param[in]  pSrcA points to first the input matrix
-   @param[in]  pSrcB points to second the input matrix
-   @param[in]  M     Height of first matrix
-   @param[in]  N     Width of first and heigt of second matrix
-   @param[in]  O     Width of second matrix
-   @param[out] pDstC Output is written here
-   @return     none
-*/
+  @brief FIR decimation of 16-bit fixed-point vectors kernel for RV32IM extension.
+  @param[in]  pSrc      points to the input samples, including the numTaps - 1 past samples
+  @param[in]  pCoeffs   points to the coefficients in time-reversed order
+  @param[in]  numTaps   number of filter coefficients
+  @param[in]  M         decimation factor
+  @param[in]  fracBits  number of fractional bits of the coefficients
+  @param[in]  blkSize   number of output samples
+  @param[out] pDst      points to the output samples
+  @return     none
+ */
 
-void plp_mat_mult_i16(const int16_t *__restrict__ pSrcA,
-                      const int16_t *__restrict__ pSrcB,
-                      uint32_t M,
-                      uint32_t N,
-                      uint32_t O,
-                      int32_t *__restrict__ pDstC);
+void plp_fir_decimate_q16s_rv32im(const int16_t *__restrict__ pSrc,
+                                  const int16_t *__restrict__ pCoeffs,
+                                  uint32_t numTaps,
+                                  uint32_t M,
+                                  uint32_t fracBits,
+                                  uint32_t blkSize,
+                                  int16_t *__restrict__ pDst);
 
 /** -------------------------------------------------------
-   @brief      Matrix matrix multiplication of a 16-bit integer matrices for RV32IM extension.
-   @param[in]  pSrcA points to first the input matrix
-   @param[in]  pSrcB points to second the input matrix
-   @param[in]  M     Height of first matrix
-   @param[in]  N     Width of first and heigt of second matrix
-   @param[in]  O     Width of second matrix
-   @param[out] pDstC Output is written here
-   @return     none
-*/
+  @brief FIR decimation of 16-bit fixed-point vectors kernel for XPULPV2 extension.
+  @param[in]  pSrc      points to the input samples, including the numTaps - 1 past samples
+  @param[in]  pCoeffs   points to the coefficients in time-reversed order
+  @param[in]  numTaps   number of filter coefficients
+  @param[in]  M         decimation factor
+  @param[in]  fracBits  number of fractional bits of the coefficients
+  @param[in]  blkSize   number of output samples
+  @param[out] pDst      points to the output samples
+  @return     none
+ */
 
-void plp_mat_mult_i16s_rv32im(const int16_t *__restrict__ pSrcA,
-                              const int16_t *__restrict__ pSrcB,
-                              uint32_t M,
-                              uint32_t N,
-                              uint32_t O,
-                              int32_t *__restrict__ pDstC);
+void plp_fir_decimate_q16s_xpulpv2(const int16_t *__restrict__ pSrc,
+                                   const int16_t *__restrict__ pCoeffs,
+                                   uint32_t numTaps,
+                                   uint32_t M,
+                                   uint32_t fracBits,
+                                   uint32_t blkSize,
+                                   int16_t *__restrict__ pDst);
 
 /** -------------------------------------------------------
-   @brief      Matrix matrix multiplication of a 16-bit integer matrices for XPULPV2 extension.
-   @param[in]  pSrcA points to first the input matrix
-   @param[in]  pSrcB points to second the input matrix
-   @param[in]  M     Height of first matrix
-   @param[in]  N     Width of first and heigt of second matrix
-   @param[in]  O     Width of second matrix
-   @param[out] pDstC Output is written here
-   @return     none
-
-   @par Exploiting SIMD instructions
-   The 16 bit values are packed two each into 32 bit vectors and then the two dot products are
-   performed on 32 bit vectors, with 32 bit accumulator.
-*/
+  @brief Parallel FIR decimation of 16-bit fixed-point vectors kernel for XPULPV2 extension.
+  @param[in]  task_args  pointer to plp_fir_multirate_instance_q16 struct initialized by
+                         plp_fir_decimate_q16_parallel
+  @return     none
+ */
 
-void plp_mat_mult_i16s_xpulpv2(const int16_t *__restrict__ pSrcA,
-                               const int16_t *__restrict__ pSrcB,
-                               uint32_t M,
-                               uint32_t N,
-                               uint32_t O,
-                               int32_t *__restrict__ pDstC);
+void plp_fir_decimate_q16p_xpulpv2(void *task_args);
 
 /** -------------------------------------------------------
-   @brief      Glue code for matrix matrix multiplication of a 8-bit integer matrices.
-   @param[in]  pSrcA points to first the input matrix
-   @param[in]  pSrcB points to second the input matrix
-   @param[in]  M     Height of first matrix
-   @param[in]  N     Width of first and heigt of second matrix
-   @param[in]  O     Width of second matrix
-   @param[out] pDstC Output is written here
-   @return     none
-*/
+  @brief Initialization of the 16-bit fixed-point polyphase FIR interpolator.
+  @param[out] S         points to the instance structure
+  @param[in]  L         interpolation factor
+  @param[in]  numTaps   number of filter coefficients, must be a multiple of L
+  @param[in]  pCoeffs   points to the polyphase coefficients, see
+                        plp_fir_interpolate_instance_q16
+  @param[in]  pState    points to the state buffer of length numTaps / L - 1 + blockSize
+  @param[in]  fracBits  number of fractional bits of the coefficients
+  @return     none
+ */
 
-void plp_mat_mult_i8(const int8_t *__restrict__ pSrcA,
-                     const int8_t *__restrict__ pSrcB,
-                     uint32_t M,
-                     uint32_t N,
-                     uint32_t O,
-                     int32_t *__restrict__ pDstC);
+void plp_fir_interpolate_init_q16(plp_fir_interpolate_instance_q16 *S,
+                                  uint8_t L,
+                                  uint16_t numTaps,
+                                  const int16_t *pCoeffs,
+                                  int16_t *pState,
+                                  uint32_t fracBits);
 
 /** -------------------------------------------------------
-   @brief      Matrix matrix multiplication of a 8-bit integer matrices for RV32IM extension.
-   @param[in]  pSrcA points to first the input matrix
-   @param[in]  pSrcB points to second the input matrix
-   @param[in]  M     Height of first matrix
-   @param[in]  N     Width of first and heigt of second matrix
-   @param[in]  O     Width of second matrix
-   @param[out] pDstC Output is written here
-   @return     none
-*/
+  @brief Glue code for the 16-bit fixed-point polyphase FIR interpolator.
+  @param[in]  S          points to the instance structure
+  @param[in]  pSrc       points to the input block
+  @param[in]  blockSize  number of input samples
+  @param[out] pDst       points to the output block of length blockSize * L
+  @return     none
+ */
 
-void plp_mat_mult_i8s_rv32im(const int8_t *__restrict__ pSrcA,
-                             const int8_t *__restrict__ pSrcB,
-                             uint32_t M,
-                             uint32_t N,
-                             uint32_t O,
-                             int32_t *__restrict__ pDstC);
+void plp_fir_interpolate_q16(const plp_fir_interpolate_instance_q16 *S,
+                             const int16_t *__restrict__ pSrc,
+                             uint32_t blockSize,
+                             int16_t *__restrict__ pDst);
 
 /** -------------------------------------------------------
-   @brief      Matrix matrix multiplication of a 8-bit integer matrices for XPULPV2 extension.
-   @param[in]  pSrcA points to first the input matrix
-   @param[in]  pSrcB points to second the input matrix
-   @param[in]  M     Height of first matrix
-   @param[in]  N     Width of first and heigt of second matrix
-   @param[in]  O     Width of second matrix
-   @param[out] pDstC Output is written here
-   @return     none
-
-   @par Exploiting SIMD instructions
-   The 8 bit values are packed four each into 32 bit vectors and then the four dot products are
-   performed on 32 bit vectors, with 32 bit accumulator.
-*/
+  @brief Glue code for the parallel 16-bit fixed-point polyphase FIR interpolator.
+  @param[in]  S          points to the instance structure
+  @param[in]  pSrc       points to the input block
+  @param[in]  blockSize  number of input samples
+  @param[in]  nPE        number of cores to compute on
+  @param[out] pDst       points to the output block of length blockSize * L
+  @return     none
+ */
 
-void plp_mat_mult_i8s_xpulpv2(const int8_t *__restrict__ pSrcA,
-                              const int8_t *__restrict__ pSrcB,
-                              uint32_t M,
-                              uint32_t N,
-                              uint32_t O,
-                              int32_t *__restrict__ pDstC);
+void plp_fir_interpolate_q16_parallel(const plp_fir_interpolate_instance_q16 *S,
+                                      const int16_t *__restrict__ pSrc,
+                                      uint32_t blockSize,
+                                      uint32_t nPE,
+                                      int16_t *__restrict__ pDst);
 
 /** -------------------------------------------------------
-   @brief      Glue code for parallel matrix matrix multiplication of a 32-bit integer matrices.
-   @param[in]  pSrcA points to first the input matrix
-   @param[in]  pSrcB points to second the input matrix
-   @param[in]  M     Height of first matrix
-   @param[in]  N     Width of first and heigt of second matrix
-   @param[in]  O     Width of second matrix
-   @param[in]  nPE   Number of cores to use
-   @param[out] pDstC Output is written here
-   @return     none
-*/
+  @brief FIR interpolation of 16-bit fixed-point vectors kernel for RV32IM extension.
+  @param[in]  pSrc         points to the input samples, including the phaseLength - 1 past
+                           samples
+  @param[in]  pCoeffs      points to the polyphase coefficients
+  @param[in]  phaseLength  number of coefficients of each polyphase filter
+  @param[in]  L            interpolation factor
+  @param[in]  fracBits     number of fractional bits of the coefficients
+  @param[in]  blkSize      number of input samples
+  @param[out] pDst         points to the output samples
+  @return     none
+ */
 
-void plp_mat_mult_i32_parallel(const int32_t *__restrict__ pSrcA,
-                               const int32_t *__restrict__ pSrcB,
-                               uint32_t M,
-                               uint32_t N,
-                               uint32_t O,
-                               uint32_t nPE,
-                               int32_t *__restrict__ pDstC);
+void plp_fir_interpolate_q16s_rv32im(const int16_t *__restrict__ pSrc,
+                                     const int16_t *__restrict__ pCoeffs,
+                                     uint32_t phaseLength,
+                                     uint32_t L,
+                                     uint32_t fracBits,
+                                     uint32_t blkSize,
+                                     int16_t *__restrict__ pDst);
 
 /** -------------------------------------------------------
-   @brief      Parallel matrix matrix multiplication of a 32-bit integer matrices for XPULPV2
-               extension.
-   @param[in]  args  pointer to plp_mat_mult_instance_i32 struct initialized by
-                     plp_mat_mult_i32_parallel
-   @return     none
-*/
+  @brief FIR interpolation of 16-bit fixed-point vectors kernel for XPULPV2 extension.
+  @param[in]  pSrc         points to the input samples, including the phaseLength - 1 past
+                           samples
+  @param[in]  pCoeffs      points to the polyphase coefficients
+  @param[in]  phaseLength  number of coefficients of each polyphase filter
+  @param[in]  L            interpolation factor
+  @param[in]  fracBits     number of fractional bits of the coefficients
+  @param[in]  blkSize      number of input samples
+  @param[out] pDst         points to the output samples
+  @return     none
+ */
 
-void plp_mat_mult_i32p_xpulpv2(void *args);
+void plp_fir_interpolate_q16s_xpulpv2(const int16_t *__restrict__ pSrc,
+                                      const int16_t *__restrict__ pCoeffs,
+                                      uint32_t phaseLength,
+                                      uint32_t L,
+                                      uint32_t fracBits,
+                                      uint32_t blkSize,
+                                      int16_t *__restrict__ pDst);
 
 /** -------------------------------------------------------
-   @brief      Glue code for parallel matrix matrix multiplication of a 16-bit integer matrices.
-   @param[in]  pSrcA points to first the input matrix
-   @param[in]  pSrcB points to second the input matrix
-   @param[in]  M     Height of first matrix
-   @param[in]  N     Width of first and heigt of second matrix
-   @param[in]  O     Width of second matrix
-   @param[in]  nPE   Number of cores to use
-   @param[out] pDstC Output is written here
-   @return     none
-*/
+  @brief Parallel FIR interpolation of 16-bit fixed-point vectors kernel for XPULPV2 extension.
+  @param[in]  task_args  pointer to plp_fir_multirate_instance_q16 struct initialized by
+                         plp_fir_interpolate_q16_parallel
+  @return     none
+ */
 
-void plp_mat_mult_i16_parallel(const int16_t *__restrict__ pSrcA,
-                               const int16_t *__restrict__ pSrcB,
-                               uint32_t M,
-                               uint32_t N,
-                               uint32_t O,
-                               uint32_t nPE,
-                               int32_t *__restrict__ pDstC);
+void plp_fir_interpolate_q16p_xpulpv2(void *task_args);
 
 /** -------------------------------------------------------
-    @brief Parallel matrix multiplication of 16-bit integer matrices kernel for XPULPV2 extension.
-    @param[in]  args  pointer to plp_mat_mult_instance_i16 struct initialized by
-                      plp_mat_mult_i16_parallel
-    @return     none
-
-    @par Exploiting SIMD instructions
-    The 16 bit values are packed two each into 32 bit vectors and then the two dot products are
-    performed on 32 bit vectors, with 32 bit accumulator.
-*/
+  @brief Initialization of the 32-bit fixed-point polyphase FIR decimator.
+  @param[out] S         points to the instance structure
+  @param[in]  M         decimation factor
+  @param[in]  numTaps   number of filter coefficients
+  @param[in]  pCoeffs   points to the coefficients in time-reversed order
+  @param[in]  pState    points to the state buffer of length numTaps - 1 + blockSize
+  @param[in]  fracBits  number of fractional bits of the coefficients
+  @return     none
+ */
 
-void plp_mat_mult_i16p_xpulpv2(void *args);
+void plp_fir_decimate_init_q32(plp_fir_decimate_instance_q32 *S,
+                               uint8_t M,
+                               uint16_t numTaps,
+                               const int32_t *pCoeffs,
+                               int32_t *pState,
+                               uint32_t fracBits);
 
 /** -------------------------------------------------------
-   @brief      Glue code for parallel matrix matrix multiplication of a 8-bit integer matrices.
-   @param[in]  pSrcA points to first the input matrix
-   @param[in]  pSrcB points to second the input matrix
-   @param[in]  M     Height of first matrix
-   @param[in]  N     Width of first and heigt of second matrix
-   @param[in]  O     Width of second matrix
-   @param[in]  nPE   Number of cores to use
-   @param[out] pDstC Output is written here
-   @return     none
-*/
+  @brief Glue code for the 32-bit fixed-point polyphase FIR decimator.
+  @param[in]  S          points to the instance structure
+  @param[in]  pSrc       points to the input block
+  @param[in]  blockSize  number of input samples, must be a multiple of M
+  @param[out] pDst       points to the output block of length blockSize / M
+  @return     none
+ */
 
-void plp_mat_mult_i8_parallel(const int8_t *__restrict__ pSrcA,
-                              const int8_t *__restrict__ pSrcB,
-                              uint32_t M,
-                              uint32_t N,
-                              uint32_t O,
-                              uint32_t nPE,
-                              int32_t *__restrict__ pDstC);
+void plp_fir_decimate_q32(const plp_fir_decimate_instance_q32 *S,
+                          const int32_t *__restrict__ pSrc,
+                          uint32_t blockSize,
+                          int32_t *__restrict__ pDst);
 
 /** -------------------------------------------------------
-   @brief      Glue code for matrix matrix multiplication of a 32-bit floating-point matrices.
-   @param[in]  pSrcA points to first the input matrix
-   @param[in]  pSrcB points to second the input matrix
-   @param[in]  M     Height of first matrix
-   @param[in]  N     Width of first and heigt of second matrix
-   @param[in]  O     Width of second matrix
-   @param[out] pDstC Output is written here
-   @return     none
-*/
+  @brief Glue code for the parallel 32-bit fixed-point polyphase FIR decimator.
+  @param[in]  S          points to the instance structure
+  @param[in]  pSrc       points to the input block
+  @param[in]  blockSize  number of input samples, must be a multiple of M
+  @param[in]  nPE        number of cores to compute on
+  @param[out] pDst       points to the output block of length blockSize / M
+  @return     none
+ */
 
-void plp_mat_mult_f32(const float *__restrict__ pSrcA,
-                      const float *__restrict__ pSrcB,
-                      uint32_t M,
-                      uint32_t N,
-                      uint32_t O,
-                      float *__restrict__ pDstC);
+void plp_fir_decimate_q32_parallel(const plp_fir_decimate_instance_q32 *S,
+                                   const int32_t *__restrict__ pSrc,
+                                   uint32_t blockSize,
+                                   uint32_t nPE,
+                                   int32_t *__restrict__ pDst);
 
 /** -------------------------------------------------------
-   @brief      Matrix matrix multiplication of a 32-bit floating-point matrices for XPULPV2
-               extension.
-   @param[in]  pSrcA points to first the input matrix
-   @param[in]  pSrcB points to second the input matrix
-   @param[in]  M     Height of first matrix
-   @param[in]  N     Width of first and heigt of second matrix
-   @param[in]  O     Width of second matrix
-   @param[out] pDstC Output is written here
-   @return     none
-*/
+  @brief FIR decimation of 32-bit fixed-point vectors kernel for RV32IM extension.
+  @param[in]  pSrc      points to the input samples, including the numTaps - 1 past samples
+  @param[in]  pCoeffs   points to the coefficients in time-reversed order
+  @param[in]  numTaps   number of filter coefficients
+  @param[in]  M         decimation factor
+  @param[in]  fracBits  number of fractional bits of the coefficients
+  @param[in]  blkSize   number of output samples
+  @param[out] pDst      points to the output samples
+  @return     none
+ */
 
-void plp_mat_mult_f32s_xpulpv2(const float *__restrict__ pSrcA,
-                               const float *__restrict__ pSrcB,
-                               uint32_t M,
-                               uint32_t N,
-                               uint32_t O,
-                               float *__restrict__ pDstC);
+void plp_fir_decimate_q32s_rv32im(const int32_t *__restrict__ pSrc,
+                                  const int32_t *__restrict__ pCoeffs,
+                                  uint32_t numTaps,
+                                  uint32_t M,
+                                  uint32_t fracBits,
+                                  uint32_t blkSize,
+                                  int32_t *__restrict__ pDst);
 
 /** -------------------------------------------------------
-   @brief      Glue code for parallel matrix matrix multiplication of a 32-bit floating-point
-   matrices.
-   @param[in]  pSrcA points to first the input matrix
-   @param[in]  pSrcB points to second the input matrix
-   @param[in]  M     Height of first matrix
-   @param[in]  N     Width of first and heigt of second matrix
-   @param[in]  O     Width of second matrix
-   @param[in]  nPE   Number of cores to use
-   @param[out] pDstC Output is written here
-   @return     none
-*/
+  @brief FIR decimation of 32-bit fixed-point vectors kernel for XPULPV2 extension.
+  @param[in]  pSrc      points to the input samples, including the numTaps - 1 past samples
+  @param[in]  pCoeffs   points to the coefficients in time-reversed order
+  @param[in]  numTaps   number of filter coefficients
+  @param[in]  M         decimation factor
+  @param[in]  fracBits  number of fractional bits of the coefficients
+  @param[in]  blkSize   number of output samples
+  @param[out] pDst      points to the output samples
+  @return     none
+ */
 
-void plp_mat_mult_f32_parallel(const float *__restrict__ pSrcA,
-                               const float *__restrict__ pSrcB,
-                               uint32_t M,
-                               uint32_t N,
-                               uint32_t O,
-                               uint32_t nPE,
-                               float *__restrict__ pDstC);
+void plp_fir_decimate_q32s_xpulpv2(const int32_t *__restrict__ pSrc,
+                                   const int32_t *__restrict__ pCoeffs,
+                                   uint32_t numTaps,
+                                   uint32_t M,
+                                   uint32_t fracBits,
+                                   uint32_t blkSize,
+                                   int32_t *__restrict__ pDst);
 
 /** -------------------------------------------------------
-    @brief      Parallel matrix multiplication of 32-bit floating-point matrices kernel for XPULPV2
-                extension.
-    @param[in]  args  pointer to plp_mat_mult_instance_f32 struct initialized by
-                      plp_mat_mult_f32_parallel
-    @return     none
-*/
+  @brief Parallel FIR decimation of 32-bit fixed-point vectors kernel for XPULPV2 extension.
+  @param[in]  task_args  pointer to plp_fir_multirate_instance_q32 struct initialized by
+                         plp_fir_decimate_q32_parallel
+  @return     none
+ */
 
-void plp_mat_mult_f32p_xpulpv2(void *args);
+void plp_fir_decimate_q32p_xpulpv2(void *task_args);
 
 /** -------------------------------------------------------
-   @brief      Parallel matrix multiplication of 8-bit integer matrices kernel for XPULPV2
-               extension.
-   @param[in]  args  pointer to plp_mat_mult_instance_i8 struct initialized by
-                     plp_mat_mult_i8_parallel
-   @return     none
-
-   @par Exploiting SIMD instructions
-   The 8 bit values are packed four each into 32 bit vectors and then the four dot products are
-   performed on 32 bit vectors, with 32 bit accumulator.
-*/
+  @brief Initialization of the 32-bit fixed-point polyphase FIR interpolator.
+  @param[out] S         points to the instance structure
+  @param[in]  L         interpolation factor
+  @param[in]  numTaps   number of filter coefficients, must be a multiple of L
+  @param[in]  pCoeffs   points to the polyphase coefficients, see
+                        plp_fir_interpolate_instance_q32
+  @param[in]  pState    points to the state buffer of length numTaps / L - 1 + blockSize
+  @param[in]  fracBits  number of fractional bits of the coefficients
+  @return     none
+ */
 
-void plp_mat_mult_i8p_xpulpv2(void *args);
+void plp_fir_interpolate_init_q32(plp_fir_interpolate_instance_q32 *S,
+                                  uint8_t L,
+                                  uint16_t numTaps,
+                                  const int32_t *pCoeffs,
+                                  int32_t *pState,
+                                  uint32_t fracBits);
 
 /** -------------------------------------------------------
-   @brief      Glue code for matrix matrix multiplication of a 32-bit fix-point matrices.
-   @param[in]  pSrcA points to first the input matrix
-   @param[in]  pSrcB points to second the input matrix
-   @param[in]  M     Height of first matrix
-   @param[in]  N     Width of first and heigt of second matrix
-   @param[in]  O     Width of second matrix
-   @param[in]  shift Amount to shift the result of each multiplication.
-   @param[out] pDstC Output is written here
-   @return     none
+  @brief Glue code for the 32-bit fixed-point polyphase FIR interpolator.
+  @param[in]  S          points to the instance structure
+  @param[in]  pSrc       points to the input block
+  @param[in]  blockSize  number of input samples
+  @param[out] pDst       points to the output block of length blockSize * L
+  @return     none
+ */
 
-   @par Fix-Point and Shifting
-   The result will be shifted by the parameter `shift` to the right (multiplied
-   by 2^-shift). Assume that matrix A is represented as pSrcA * 2^-x, and matrix
-   B as pSrcB * 2^-y (in other words, A has it's x last digits after the binary
-   point). Then, the output is represented as pDstC * 2^-(x + y - shift).
+void plp_fir_interpolate_q32(const plp_fir_interpolate_instance_q32 *S,
+                             const int32_t *__restrict__ pSrc,
+                             uint32_t blockSize,
+                             int32_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief Glue code for the parallel 32-bit fixed-point polyphase FIR interpolator.
+  @param[in]  S          points to the instance structure
+  @param[in]  pSrc       points to the input block
+  @param[in]  blockSize  number of input samples
+  @param[in]  nPE        number of cores to compute on
+  @param[out] pDst       points to the output block of length blockSize * L
+  @return     none
  */
 
-void plp_mat_mult_q32(const int32_t *__restrict__ pSrcA,
-                      const int32_t *__restrict__ pSrcB,
-                      uint32_t M,
-                      uint32_t N,
-                      uint32_t O,
-                      uint32_t shift,
-                      int32_t *__restrict__ pDstC);
+void plp_fir_interpolate_q32_parallel(const plp_fir_interpolate_instance_q32 *S,
+                                      const int32_t *__restrict__ pSrc,
+                                      uint32_t blockSize,
+                                      uint32_t nPE,
+                                      int32_t *__restrict__ pDst);
 
 /** -------------------------------------------------------
-   @brief      Glue code for parallel matrix matrix multiplication of a 32-bit fix-point
-               matrices.
-   @param[in]  pSrcA points to first the input matrix
-   @param[in]  pSrcB points to second the input matrix
-   @param[in]  M     Height of first matrix
-   @param[in]  N     Width of first and heigt of second matrix
-   @param[in]  O     Width of second matrix
-   @param[in]  shift Amount to shift the result of each multiplication.
-   @param[in]  nPE   Number of cores to use
-   @param[out] pDstC Output is written here
-   @return     none
+  @brief FIR interpolation of 32-bit fixed-point vectors kernel for RV32IM extension.
+  @param[in]  pSrc         points to the input samples, including the phaseLength - 1 past
+                           samples
+  @param[in]  pCoeffs      points to the polyphase coefficients
+  @param[in]  phaseLength  number of coefficients of each polyphase filter
+  @param[in]  L            interpolation factor
+  @param[in]  fracBits     number of fractional bits of the coefficients
+  @param[in]  blkSize      number of input samples
+  @param[out] pDst         points to the output samples
+  @return     none
+ */
 
-   @par Fix-Point and Shifting
-   The result will be shifted by the parameter `shift` to the right (multiplied
-   by 2^-shift). Assume that matrix A is represented as pSrcA * 2^-x, and matrix
-   B as pSrcB * 2^-y (in other words, A has it's x last digits after the binary
-   point). Then, the output is represented as pDstC * 2^-(x + y - shift).
+void plp_fir_interpolate_q32s_rv32im(const int32_t *__restrict__ pSrc,
+                                     const int32_t *__restrict__ pCoeffs,
+                                     uint32_t phaseLength,
+                                     uint32_t L,
+                                     uint32_t fracBits,
+                                     uint32_t blkSize,
+                                     int32_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief FIR interpolation of 32-bit fixed-point vectors kernel for XPULPV2 extension.
+  @param[in]  pSrc         points to the input samples, including the phaseLength - 1 past
+                           samples
+  @param[in]  pCoeffs      points to the polyphase coefficients
+  @param[in]  phaseLength  number of coefficients of each polyphase filter
+  @param[in]  L            interpolation factor
+  @param[in]  fracBits     number of fractional bits of the coefficients
+  @param[in]  blkSize      number of input samples
+  @param[out] pDst         points to the output samples
+  @return     none
  */
 
-void plp_mat_mult_q32_parallel(const int32_t *__restrict__ pSrcA,
-                               const int32_t *__restrict__ pSrcB,
-                               uint32_t M,
-                               uint32_t N,
-                               uint32_t O,
-                               uint32_t shift,
-                               uint32_t nPE,
-                               int32_t *__restrict__ pDstC);
+void plp_fir_interpolate_q32s_xpulpv2(const int32_t *__restrict__ pSrc,
+                                      const int32_t *__restrict__ pCoeffs,
+                                      uint32_t phaseLength,
+                                      uint32_t L,
+                                      uint32_t fracBits,
+                                      uint32_t blkSize,
+                                      int32_t *__restrict__ pDst);
 
 /** -------------------------------------------------------
-   @brief      Matrix matrix multiplication of a 32-bit fix-point matrices for RV32IM extension.
-   @param[in]  pSrcA points to first the input matrix
-   @param[in]  pSrcB points to second the input matrix
-   @param[in]  M     Height of first matrix
-   @param[in]  N     Width of first and heigt of second matrix
-   @param[in]  O     Width of second matrix
-   @param[in]  shift Amount to shift the result of each multiplication.
-   @param[out] pDstC Output is written here
-   @return     none
+  @brief Parallel FIR interpolation of 32-bit fixed-point vectors kernel for XPULPV2 extension.
+  @param[in]  task_args  pointer to plp_fir_multirate_instance_q32 struct initialized by
+                         plp_fir_interpolate_q32_parallel
+  @return     none
+ */
 
-   @par Fix-Point and Shifting
-   The result will be shifted by the parameter `shift` to the right (multiplied
-   by 2^-shift). Assume that matrix A is represented as pSrcA * 2^-x, and matrix
-   B as pSrcB * 2^-y (in other words, A has it's x last digits after the binary
-   point). Then, the output is represented as pDstC * 2^-(x + y - shift).
-*/
+void plp_fir_interpolate_q32p_xpulpv2(void *task_args);
 
-void plp_mat_mult_q32s_rv32im(const int32_t *__restrict__ pSrcA,
-                              const int32_t *__restrict__ pSrcB,
-                              uint32_t M,
-                              uint32_t N,
-                              uint32_t O,
-                              uint32_t shift,
-                              int32_t *__restrict__ pDstC);
+/** -------------------------------------------------------
+  @brief Initialization of the floating-point polyphase FIR decimator.
+  @param[out] S         points to the instance structure
+  @param[in]  M         decimation factor
+  @param[in]  numTaps   number of filter coefficients
+  @param[in]  pCoeffs   points to the coefficients in time-reversed order
+  @param[in]  pState    points to the state buffer of length numTaps - 1 + blockSize
+  @return     none
+ */
+
+void plp_fir_decimate_init_f32(plp_fir_decimate_instance_f32 *S,
+                               uint8_t M,
+                               uint16_t numTaps,
+                               const float32_t *pCoeffs,
+                               float32_t *pState);
 
 /** -------------------------------------------------------
-   @brief      Matrix matrix multiplication of a 32-bit fix-point matrices for XPULPV2 extension.
-   @param[in]  pSrcA points to first the input matrix
-   @param[in]  pSrcB points to second the input matrix
-   @param[in]  M     Height of first matrix
-   @param[in]  N     Width of first and heigt of second matrix
-   @param[in]  O     Width of second matrix
-   @param[in]  shift Amount to shift the result of each multiplication.
-   @param[out] pDstC Output is written here
-   @return     none
+  @brief Glue code for the floating-point polyphase FIR decimator.
+  @param[in]  S          points to the instance structure
+  @param[in]  pSrc       points to the input block
+  @param[in]  blockSize  number of input samples, must be a multiple of M
+  @param[out] pDst       points to the output block of length blockSize / M
+  @return     none
+ */
 
-   @par Fix-Point and Shifting
-   The result will be shifted by the parameter `shift` to the right (multiplied
-   by 2^-shift). Assume that matrix A is represented as pSrcA * 2^-x, and matrix
-   B as pSrcB * 2^-y (in other words, A has it's x last digits after the binary
-   point). Then, the output is represented as pDstC * 2^-(x + y - shift).
-*/
+void plp_fir_decimate_f32(const plp_fir_decimate_instance_f32 *S,
+                          const float32_t *__restrict__ pSrc,
+                          uint32_t blockSize,
+                          float32_t *__restrict__ pDst);
 
-void plp_mat_mult_q32s_xpulpv2(const int32_t *__restrict__ pSrcA,
-                               const int32_t *__restrict__ pSrcB,
-                               uint32_t M,
-                               uint32_t N,
-                               uint32_t O,
-                               uint32_t shift,
-                               int32_t *__restrict__ pDstC);
+/** -------------------------------------------------------
+  @brief Glue code for the parallel floating-point polyphase FIR decimator.
+  @param[in]  S          points to the instance structure
+  @param[in]  pSrc       points to the input block
+  @param[in]  blockSize  number of input samples, must be a multiple of M
+  @param[in]  nPE        number of cores to compute on
+  @param[out] pDst       points to the output block of length blockSize / M
+  @return     none
+ */
+
+void plp_fir_decimate_f32_parallel(const plp_fir_decimate_instance_f32 *S,
+                                   const float32_t *__restrict__ pSrc,
+                                   uint32_t blockSize,
+                                   uint32_t nPE,
+                                   float32_t *__restrict__ pDst);
 
 /** -------------------------------------------------------
-    @brief Parallel matrix multiplication of 32-bit fix-point matrices kernel for XPULPV2 extension.
-    @param[in]  args  pointer to plp_mat_mult_instance_q32 struct initialized by
-                      plp_mat_mult_q32_parallel
-    @return     none
-*/
+  @brief FIR decimation of floating-point vectors kernel for XPULPV2 extension.
+  @param[in]  pSrc      points to the input samples, including the numTaps - 1 past samples
+  @param[in]  pCoeffs   points to the coefficients in time-reversed order
+  @param[in]  numTaps   number of filter coefficients
+  @param[in]  M         decimation factor
+  @param[in]  blkSize   number of output samples
+  @param[out] pDst      points to the output samples
+  @return     none
+ */
 
-void plp_mat_mult_q32p_xpulpv2(void *args);
+void plp_fir_decimate_f32s_xpulpv2(const float32_t *__restrict__ pSrc,
+                                   const float32_t *__restrict__ pCoeffs,
+                                   uint32_t numTaps,
+                                   uint32_t M,
+                                   uint32_t blkSize,
+                                   float32_t *__restrict__ pDst);
 
 /** -------------------------------------------------------
-   @brief      Glue code for matrix matrix multiplication of a 16-bit fix-point matrices.
-   @param[in]  pSrcA points to first the input matrix
-   @param[in]  pSrcB points to second the input matrix
-   @param[in]  M     Height of first matrix
-   @param[in]  N     Width of first and heigt of second matrix
-   @param[in]  O     Width of second matrix
-   @param[in]  shift Amount to shift the result of each multiplication.
-   @param[out] pDstC Output is written here
-   @return     none
+  @brief Parallel FIR decimation of floating-point vectors kernel for XPULPV2 extension.
+  @param[in]  task_args  pointer to plp_fir_multirate_instance_f32 struct initialized by
+                         plp_fir_decimate_f32_parallel
+  @return     none
+ */
 
-   @par Fix-Point and Shifting
-   The result will be shifted by the parameter `shift` to the right (multiplied
-   by 2^-shift). Assume that matrix A is represented as pSrcA * 2^-x, and matrix
-   B as pSrcB * 2^-y (in other words, A has it's x last digits after the binary
-   point). Then, the output is represented as pDstC * 2^-(x + y - shift).
+void plp_fir_decimate_f32p_xpulpv2(void *task_args);
 
-   The output of the matrix multiplication will also be stored as an 16-bit array.
-   Set the `shift` parameter such that no overflow ocurrs.
+/** -------------------------------------------------------
+  @brief Initialization of the floating-point polyphase FIR interpolator.
+  @param[out] S         points to the instance structure
+  @param[in]  L         interpolation factor
+  @param[in]  numTaps   number of filter coefficients, must be a multiple of L
+  @param[in]  pCoeffs   points to the polyphase coefficients, see
+                        plp_fir_interpolate_instance_f32
+  @param[in]  pState    points to the state buffer of length numTaps / L - 1 + blockSize
+  @return     none
  */
 
-void plp_mat_mult_q16(const int16_t *__restrict__ pSrcA,
-                      const int16_t *__restrict__ pSrcB,
-                      uint32_t M,
-                      uint32_t N,
-                      uint32_t O,
-                      uint32_t shift,
-                      int16_t *__restrict__ pDstC);
+void plp_fir_interpolate_init_f32(plp_fir_interpolate_instance_f32 *S,
+                                  uint8_t L,
+                                  uint16_t numTaps,
+                                  const float32_t *pCoeffs,
+                                  float32_t *pState);
 
 /** -------------------------------------------------------
-   @brief      Glue code for parallel matrix matrix multiplication of a 16-bit fix-point
-  matrices.
-   @param[in]  pSrcA points to first the input matrix
-   @param[in]  pSrcB points to second the input matrix
-   @param[in]  M     Height of first matrix
-   @param[in]  N     Width of first and heigt of second matrix
-   @param[in]  O     Width of second matrix
-   @param[in]  shift Amount to shift the result of each multiplication.
-   @param[in]  nPE   Number of cores to use
-   @param[out] pDstC Output is written here
-   @return     none
+  @brief Glue code for the floating-point polyphase FIR interpolator.
+  @param[in]  S          points to the instance structure
+  @param[in]  pSrc       points to the input block
+  @param[in]  blockSize  number of input samples
+  @param[out] pDst       points to the output block of length blockSize * L
+  @return     none
+ */
 
-   @par Fix-Point and Shifting
-   The result will be shifted by the parameter `shift` to the right (multiplied
-   by 2^-shift). Assume that matrix A is represented as pSrcA * 2^-x, and matrix
-   B as pSrcB * 2^-y (in other words, A has it's x last digits after the binary
-   point). Then, the output is represented as pDstC * 2^-(x + y - shift).
+void plp_fir_interpolate_f32(const plp_fir_interpolate_instance_f32 *S,
+                             const float32_t *__restrict__ pSrc,
+                             uint32_t blockSize,
+                             float32_t *__restrict__ pDst);
 
-   The output of the matrix multiplication will also be stored as an 16-bit array.
-   Set the `shift` parameter such that no overflow ocurrs.
+/** -------------------------------------------------------
+  @brief Glue code for the parallel floating-point polyphase FIR interpolator.
+  @param[in]  S          points to the instance structure
+  @param[in]  pSrc       points to the input block
+  @param[in]  blockSize  number of input samples
+  @param[in]  nPE        number of cores to compute on
+  @param[out] pDst       points to the output block of length blockSize * L
+  @return     none
  */
 
-void plp_mat_mult_q16_parallel(const int16_t *__restrict__ pSrcA,
-                               const int16_t *__restrict__ pSrcB,
-                               uint32_t M,
-                               uint32_t N,
-                               uint32_t O,
-                               uint32_t shift,
-                               uint32_t nPE,
-                               int16_t *__restrict__ pDstC);
+void plp_fir_interpolate_f32_parallel(const plp_fir_interpolate_instance_f32 *S,
+                                      const float32_t *__restrict__ pSrc,
+                                      uint32_t blockSize,
+                                      uint32_t nPE,
+                                      float32_t *__restrict__ pDst);
 
 /** -------------------------------------------------------
-   @brief      Matrix matrix multiplication of a 16-bit fix-point matrices for RV32IM extension.
-   @param[in]  pSrcA points to first the input matrix
-   @param[in]  pSrcB points to second the input matrix
-   @param[in]  M     Height of first matrix
-   @param[in]  N     Width of first and heigt of second matrix
-   @param[in]  O     Width of second matrix
-   @param[in]  shift Amount to shift the result of each multiplication.
-   @param[out] pDstC Output is written here
-   @return     none
+  @brief FIR interpolation of floating-point vectors kernel for XPULPV2 extension.
+  @param[in]  pSrc         points to the input samples, including the phaseLength - 1 past
+                           samples
+  @param[in]  pCoeffs      points to the polyphase coefficients
+  @param[in]  phaseLength  number of coefficients of each polyphase filter
+  @param[in]  L            interpolation factor
+  @param[in]  blkSize      number of input samples
+  @param[out] pDst         points to the output samples
+  @return     none
+ */
 
-   @par Fix-Point and Shifting
-   The result will be shifted by the parameter `shift` to the right (multiplied
-   by 2^-shift). Assume that matrix A is represented as pSrcA * 2^-x, and matrix
-   B as pSrcB * 2^-y (in other words, A has it's x last digits after the binary
-   point). Then, the output is represented as pDstC * 2^-(x + y - shift).
+void plp_fir_interpolate_f32s_xpulpv2(const float32_t *__restrict__ pSrc,
+                                      const float32_t *__restrict__ pCoeffs,
+                                      uint32_t phaseLength,
+                                      uint32_t L,
+                                      uint32_t blkSize,
+                                      float32_t *__restrict__ pDst);
 
-   The output of the matrix multiplication will also be stored as an 16-bit array.
-   Set the `shift` parameter such that no overflow ocurrs.
-*/
+/** -------------------------------------------------------
+  @brief Parallel FIR interpolation of floating-point vectors kernel for XPULPV2 extension.
+  @param[in]  task_args  pointer to plp_fir_multirate_instance_f32 struct initialized by
+                         plp_fir_interpolate_f32_parallel
+  @return     none
+ */
 
-void plp_mat_mult_q16s_rv32im(const int16_t *__restrict__ pSrcA,
-                              const int16_t *__restrict__ pSrcB,
-                              uint32_t M,
-                              uint32_t N,
-                              uint32_t O,
-                              uint32_t shift,
-                              int16_t *__restrict__ pDstC);
+void plp_fir_interpolate_f32p_xpulpv2(void *task_args);
 
 /** -------------------------------------------------------
-   @brief      Matrix matrix multiplication of a 16-bit fix-point matrices for XPULPV2 extension.
-   @param[in]  pSrcA points to first the input matrix
-   @param[in]  pSrcB points to second the input matrix
-   @param[in]  M     Height of first matrix
-   @param[in]  N     Width of first and heigt of second matrix
-   @param[in]  O     Width of second matrix
-   @param[in]  shift Amount to shift the result of each multiplication.
-   @param[out] pDstC Output is written here
-   @return     none
+  @brief Initialization of the 16-bit fixed-point LMS and NLMS filters.
+  @param[out] S         points to the instance structure
+  @param[in]  numTaps   number of filter coefficients
+  @param[in]  pCoeffs   points to the initial coefficients in time-reversed order, they are
+                        updated in place
+  @param[in]  pState    points to the state buffer of length numTaps - 1 + blockSize
+  @param[in]  mu        step size
+  @param[in]  fracBits  number of fractional bits of the coefficients and mu
+  @return     none
+ */
 
-   @par Fix-Point and Shifting
-   The result will be shifted by the parameter `shift` to the right (multiplied
-   by 2^-shift). Assume that matrix A is represented as pSrcA * 2^-x, and matrix
-   B as pSrcB * 2^-y (in other words, A has it's x last digits after the binary
-   point). Then, the output is represented as pDstC * 2^-(x + y - shift).
+void plp_lms_init_q16(plp_lms_instance_q16 *S,
+                      uint16_t numTaps,
+                      int16_t *pCoeffs,
+                      int16_t *pState,
+                      int16_t mu,
+                      uint32_t fracBits);
 
-   The output of the matrix multiplication will also be stored as an 16-bit array.
-   Set the `shift` parameter such that no overflow ocurrs.
-*/
+/** -------------------------------------------------------
+  @brief Glue code for the 16-bit fixed-point LMS filter.
+  @param[in]  S          points to the instance structure
+  @param[in]  pSrc       points to the input block
+  @param[in]  pRef       points to the reference block
+  @param[in]  blockSize  number of samples
+  @param[out] pOut       points to the output block
+  @param[out] pErr       points to the error block
+  @return     none
+ */
 
-void plp_mat_mult_q16s_xpulpv2(const int16_t *__restrict__ pSrcA,
-                               const int16_t *__restrict__ pSrcB,
-                               uint32_t M,
-                               uint32_t N,
-                               uint32_t O,
-                               uint32_t shift,
-                               int16_t *__restrict__ pDstC);
+void plp_lms_q16(const plp_lms_instance_q16 *S,
+                 const int16_t *__restrict__ pSrc,
+                 const int16_t *__restrict__ pRef,
+                 uint32_t blockSize,
+                 int16_t *__restrict__ pOut,
+                 int16_t *__restrict__ pErr);
 
 /** -------------------------------------------------------
-    @brief Parallel matrix multiplication of 16-bit fix-point matrices kernel for XPULPV2 extension.
-    @param[in]  args  pointer to plp_mat_mult_instance_q16 struct initialized by
-                      plp_mat_mult_q16_parallel
-    @return     none
-*/
+  @brief Glue code for the 16-bit fixed-point NLMS filter.
+  @param[in]  S          points to the instance structure
+  @param[in]  pSrc       points to the input block
+  @param[in]  pRef       points to the reference block
+  @param[in]  blockSize  number of samples
+  @param[out] pOut       points to the output block
+  @param[out] pErr       points to the error block
+  @return     none
+ */
 
-void plp_mat_mult_q16p_xpulpv2(void *args);
+void plp_nlms_q16(const plp_lms_instance_q16 *S,
+                  const int16_t *__restrict__ pSrc,
+                  const int16_t *__restrict__ pRef,
+                  uint32_t blockSize,
+                  int16_t *__restrict__ pOut,
+                  int16_t *__restrict__ pErr);
 
 /** -------------------------------------------------------
-   @brief      Glue code for matrix matrix multiplication of a 8-bit fix-point matrices.
-   @param[in]  pSrcA points to first the input matrix
-   @param[in]  pSrcB points to second the input matrix
-   @param[in]  M     Height of first matrix
-   @param[in]  N     Width of first and heigt of second matrix
-   @param[in]  O     Width of second matrix
-   @param[in]  shift Amount to shift the result of each multiplication.
-   @param[out] pDstC Output is written here
-   @return     none
+  @brief Glue code for the parallel 16-bit fixed-point block LMS filter. The coefficients are
+  updated once per call, with the gradient of the whole block.
+  @param[in]  S          points to the instance structure
+  @param[in]  pSrc       points to the input block
+  @param[in]  pRef       points to the reference block
+  @param[in]  blockSize  number of samples
+  @param[in]  nPE        number of cores to compute on
+  @param[out] pOut       points to the output block
+  @param[out] pErr       points to the error block
+  @return     none
+ */
 
-   @par Fix-Point and Shifting
-   The result will be shifted by the parameter `shift` to the right (multiplied
-   by 2^-shift). Assume that matrix A is represented as pSrcA * 2^-x, and matrix
-   B as pSrcB * 2^-y (in other words, A has it's x last digits after the binary
-   point). Then, the output is represented as pDstC * 2^-(x + y - shift).
+void plp_lms_block_q16_parallel(const plp_lms_instance_q16 *S,
+                                const int16_t *__restrict__ pSrc,
+                                const int16_t *__restrict__ pRef,
+                                uint32_t blockSize,
+                                uint32_t nPE,
+                                int16_t *__restrict__ pOut,
+                                int16_t *__restrict__ pErr);
+
+/** -------------------------------------------------------
+  @brief LMS filter of 16-bit fixed-point vectors kernel for RV32IM extension.
+  @param[in]     pSrc      points to the input samples, including the numTaps - 1 past samples
+  @param[in,out] pCoeffs   points to the coefficients in time-reversed order
+  @param[in]     numTaps   number of filter coefficients
+  @param[in]     mu        step size
+  @param[in]     fracBits  number of fractional bits of the coefficients and mu
+  @param[in]     pRef      points to the reference samples
+  @param[in]     blkSize   number of samples
+  @param[out]    pOut      points to the output samples
+  @param[out]    pErr      points to the error samples
+  @return        none
+ */
 
-   The output of the matrix multiplication will also be stored as an 8-bit array.
-   Set the `shift` parameter such that no overflow ocurrs.
+void plp_lms_q16s_rv32im(const int16_t *__restrict__ pSrc,
+                         int16_t *__restrict__ pCoeffs,
+                         uint32_t numTaps,
+                         int16_t mu,
+                         uint32_t fracBits,
+                         const int16_t *__restrict__ pRef,
+                         uint32_t blkSize,
+                         int16_t *__restrict__ pOut,
+                         int16_t *__restrict__ pErr);
+
+/** -------------------------------------------------------
+  @brief LMS filter of 16-bit fixed-point vectors kernel for XPULPV2 extension.
+  @param[in]     pSrc      points to the input samples, including the numTaps - 1 past samples
+  @param[in,out] pCoeffs   points to the coefficients in time-reversed order
+  @param[in]     numTaps   number of filter coefficients
+  @param[in]     mu        step size
+  @param[in]     fracBits  number of fractional bits of the coefficients and mu
+  @param[in]     pRef      points to the reference samples
+  @param[in]     blkSize   number of samples
+  @param[out]    pOut      points to the output samples
+  @param[out]    pErr      points to the error samples
+  @return        none
  */
 
-void plp_mat_mult_q8(const int8_t *__restrict__ pSrcA,
-                     const int8_t *__restrict__ pSrcB,
-                     uint32_t M,
-                     uint32_t N,
-                     uint32_t O,
-                     uint32_t shift,
-                     int8_t *__restrict__ pDstC);
+void plp_lms_q16s_xpulpv2(const int16_t *__restrict__ pSrc,
+                          int16_t *__restrict__ pCoeffs,
+                          uint32_t numTaps,
+                          int16_t mu,
+                          uint32_t fracBits,
+                          const int16_t *__restrict__ pRef,
+                          uint32_t blkSize,
+                          int16_t *__restrict__ pOut,
+                          int16_t *__restrict__ pErr);
+
+/** -------------------------------------------------------
+  @brief NLMS filter of 16-bit fixed-point vectors kernel for RV32IM extension.
+  @param[in]     pSrc      points to the input samples, including the numTaps - 1 past samples
+  @param[in,out] pCoeffs   points to the coefficients in time-reversed order
+  @param[in]     numTaps   number of filter coefficients
+  @param[in]     mu        step size
+  @param[in]     fracBits  number of fractional bits of the coefficients and mu
+  @param[in]     pRef      points to the reference samples
+  @param[in]     blkSize   number of samples
+  @param[out]    pOut      points to the output samples
+  @param[out]    pErr      points to the error samples
+  @return        none
+ */
+
+void plp_nlms_q16s_rv32im(const int16_t *__restrict__ pSrc,
+                          int16_t *__restrict__ pCoeffs,
+                          uint32_t numTaps,
+                          int16_t mu,
+                          uint32_t fracBits,
+                          const int16_t *__restrict__ pRef,
+                          uint32_t blkSize,
+                          int16_t *__restrict__ pOut,
+                          int16_t *__restrict__ pErr);
+
+/** -------------------------------------------------------
+  @brief NLMS filter of 16-bit fixed-point vectors kernel for XPULPV2 extension.
+  @param[in]     pSrc      points to the input samples, including the numTaps - 1 past samples
+  @param[in,out] pCoeffs   points to the coefficients in time-reversed order
+  @param[in]     numTaps   number of filter coefficients
+  @param[in]     mu        step size
+  @param[in]     fracBits  number of fractional bits of the coefficients and mu
+  @param[in]     pRef      points to the reference samples
+  @param[in]     blkSize   number of samples
+  @param[out]    pOut      points to the output samples
+  @param[out]    pErr      points to the error samples
+  @return        none
+ */
+
+void plp_nlms_q16s_xpulpv2(const int16_t *__restrict__ pSrc,
+                           int16_t *__restrict__ pCoeffs,
+                           uint32_t numTaps,
+                           int16_t mu,
+                           uint32_t fracBits,
+                           const int16_t *__restrict__ pRef,
+                           uint32_t blkSize,
+                           int16_t *__restrict__ pOut,
+                           int16_t *__restrict__ pErr);
 
 /** -------------------------------------------------------
-   @brief      Glue code for parallel matrix matrix multiplication of a 8-bit fix-point matrices.
+  @brief Parallel block LMS filter of 16-bit fixed-point vectors kernel for XPULPV2 extension.
+  First, each core computes the outputs and errors of a contiguous part of the block with the
+  coefficients of the beginning of the block. After a barrier, each core updates a contiguous
+  part of the coefficients with the correlation of the errors and the samples of the whole block.
+  @param[in]  task_args  pointer to plp_lms_block_instance_q16 struct initialized by
+                         plp_lms_block_q16_parallel
+  @return     none
+ */
+
+void plp_lms_block_q16p_xpulpv2(void *task_args);
+
+/** -------------------------------------------------------
+  @brief Initialization of the 32-bit fixed-point LMS and NLMS filters.
+  @param[out] S         points to the instance structure
+  @param[in]  numTaps   number of filter coefficients
+  @param[in]  pCoeffs   points to the initial coefficients in time-reversed order, they are
+                        updated in place
+  @param[in]  pState    points to the state buffer of length numTaps - 1 + blockSize
+  @param[in]  mu        step size
+  @param[in]  fracBits  number of fractional bits of the coefficients and mu
+  @param[in]  delta     regularization of the NLMS filter, added to the energy of the delay line
+                        with fracBits fractional bits, must be positive
+  @return     none
+ */
+
+void plp_lms_init_q32(plp_lms_instance_q32 *S,
+                      uint16_t numTaps,
+                      int32_t *pCoeffs,
+                      int32_t *pState,
+                      int32_t mu,
+                      uint32_t fracBits,
+                      int32_t delta);
+
+/** -------------------------------------------------------
+  @brief Glue code for the 32-bit fixed-point LMS filter.
+  @param[in]  S          points to the instance structure
+  @param[in]  pSrc       points to the input block
+  @param[in]  pRef       points to the reference block
+  @param[in]  blockSize  number of samples
+  @param[out] pOut       points to the output block
+  @param[out] pErr       points to the error block
+  @return     none
+ */
+
+void plp_lms_q32(const plp_lms_instance_q32 *S,
+                 const int32_t *__restrict__ pSrc,
+                 const int32_t *__restrict__ pRef,
+                 uint32_t blockSize,
+                 int32_t *__restrict__ pOut,
+                 int32_t *__restrict__ pErr);
+
+/** -------------------------------------------------------
+  @brief Glue code for the 32-bit fixed-point NLMS filter.
+  @param[in]  S          points to the instance structure
+  @param[in]  pSrc       points to the input block
+  @param[in]  pRef       points to the reference block
+  @param[in]  blockSize  number of samples
+  @param[out] pOut       points to the output block
+  @param[out] pErr       points to the error block
+  @return     none
+ */
+
+void plp_nlms_q32(const plp_lms_instance_q32 *S,
+                  const int32_t *__restrict__ pSrc,
+                  const int32_t *__restrict__ pRef,
+                  uint32_t blockSize,
+                  int32_t *__restrict__ pOut,
+                  int32_t *__restrict__ pErr);
+
+/** -------------------------------------------------------
+  @brief Glue code for the parallel 32-bit fixed-point block LMS filter. The coefficients are
+  updated once per call, with the gradient of the whole block.
+  @param[in]  S          points to the instance structure
+  @param[in]  pSrc       points to the input block
+  @param[in]  pRef       points to the reference block
+  @param[in]  blockSize  number of samples
+  @param[in]  nPE        number of cores to compute on
+  @param[out] pOut       points to the output block
+  @param[out] pErr       points to the error block
+  @return     none
+ */
+
+void plp_lms_block_q32_parallel(const plp_lms_instance_q32 *S,
+                                const int32_t *__restrict__ pSrc,
+                                const int32_t *__restrict__ pRef,
+                                uint32_t blockSize,
+                                uint32_t nPE,
+                                int32_t *__restrict__ pOut,
+                                int32_t *__restrict__ pErr);
+
+/** -------------------------------------------------------
+  @brief LMS filter of 32-bit fixed-point vectors kernel for RV32IM extension.
+  @param[in]     pSrc      points to the input samples, including the numTaps - 1 past samples
+  @param[in,out] pCoeffs   points to the coefficients in time-reversed order
+  @param[in]     numTaps   number of filter coefficients
+  @param[in]     mu        step size
+  @param[in]     fracBits  number of fractional bits of the coefficients and mu
+  @param[in]     pRef      points to the reference samples
+  @param[in]     blkSize   number of samples
+  @param[out]    pOut      points to the output samples
+  @param[out]    pErr      points to the error samples
+  @return        none
+ */
+
+void plp_lms_q32s_rv32im(const int32_t *__restrict__ pSrc,
+                         int32_t *__restrict__ pCoeffs,
+                         uint32_t numTaps,
+                         int32_t mu,
+                         uint32_t fracBits,
+                         const int32_t *__restrict__ pRef,
+                         uint32_t blkSize,
+                         int32_t *__restrict__ pOut,
+                         int32_t *__restrict__ pErr);
+
+/** -------------------------------------------------------
+  @brief LMS filter of 32-bit fixed-point vectors kernel for XPULPV2 extension.
+  @param[in]     pSrc      points to the input samples, including the numTaps - 1 past samples
+  @param[in,out] pCoeffs   points to the coefficients in time-reversed order
+  @param[in]     numTaps   number of filter coefficients
+  @param[in]     mu        step size
+  @param[in]     fracBits  number of fractional bits of the coefficients and mu
+  @param[in]     pRef      points to the reference samples
+  @param[in]     blkSize   number of samples
+  @param[out]    pOut      points to the output samples
+  @param[out]    pErr      points to the error samples
+  @return        none
+ */
+
+void plp_lms_q32s_xpulpv2(const int32_t *__restrict__ pSrc,
+                          int32_t *__restrict__ pCoeffs,
+                          uint32_t numTaps,
+                          int32_t mu,
+                          uint32_t fracBits,
+                          const int32_t *__restrict__ pRef,
+                          uint32_t blkSize,
+                          int32_t *__restrict__ pOut,
+                          int32_t *__restrict__ pErr);
+
+/** -------------------------------------------------------
+  @brief NLMS filter of 32-bit fixed-point vectors kernel for RV32IM extension.
+  @param[in]     pSrc      points to the input samples, including the numTaps - 1 past samples
+  @param[in,out] pCoeffs   points to the coefficients in time-reversed order
+  @param[in]     numTaps   number of filter coefficients
+  @param[in]     mu        step size
+  @param[in]     delta     regularization, added to the energy of the delay line
+  @param[in]     fracBits  number of fractional bits of the coefficients and mu
+  @param[in]     pRef      points to the reference samples
+  @param[in]     blkSize   number of samples
+  @param[out]    pOut      points to the output samples
+  @param[out]    pErr      points to the error samples
+  @return        none
+ */
+
+void plp_nlms_q32s_rv32im(const int32_t *__restrict__ pSrc,
+                          int32_t *__restrict__ pCoeffs,
+                          uint32_t numTaps,
+                          int32_t mu,
+                          int32_t delta,
+                          uint32_t fracBits,
+                          const int32_t *__restrict__ pRef,
+                          uint32_t blkSize,
+                          int32_t *__restrict__ pOut,
+                          int32_t *__restrict__ pErr);
+
+/** -------------------------------------------------------
+  @brief NLMS filter of 32-bit fixed-point vectors kernel for XPULPV2 extension.
+  @param[in]     pSrc      points to the input samples, including the numTaps - 1 past samples
+  @param[in,out] pCoeffs   points to the coefficients in time-reversed order
+  @param[in]     numTaps   number of filter coefficients
+  @param[in]     mu        step size
+  @param[in]     delta     regularization, added to the energy of the delay line
+  @param[in]     fracBits  number of fractional bits of the coefficients and mu
+  @param[in]     pRef      points to the reference samples
+  @param[in]     blkSize   number of samples
+  @param[out]    pOut      points to the output samples
+  @param[out]    pErr      points to the error samples
+  @return        none
+ */
+
+void plp_nlms_q32s_xpulpv2(const int32_t *__restrict__ pSrc,
+                           int32_t *__restrict__ pCoeffs,
+                           uint32_t numTaps,
+                           int32_t mu,
+                           int32_t delta,
+                           uint32_t fracBits,
+                           const int32_t *__restrict__ pRef,
+                           uint32_t blkSize,
+                           int32_t *__restrict__ pOut,
+                           int32_t *__restrict__ pErr);
+
+/** -------------------------------------------------------
+  @brief Parallel block LMS filter of 32-bit fixed-point vectors kernel for XPULPV2 extension.
+  First, each core computes the outputs and errors of a contiguous part of the block with the
+  coefficients of the beginning of the block. After a barrier, each core updates a contiguous
+  part of the coefficients with the correlation of the errors and the samples of the whole block.
+  @param[in]  task_args  pointer to plp_lms_block_instance_q32 struct initialized by
+                         plp_lms_block_q32_parallel
+  @return     none
+ */
+
+void plp_lms_block_q32p_xpulpv2(void *task_args);
+
+/** -------------------------------------------------------
+  @brief Initialization of the floating-point LMS and NLMS filters.
+  @param[out] S         points to the instance structure
+  @param[in]  numTaps   number of filter coefficients
+  @param[in]  pCoeffs   points to the initial coefficients in time-reversed order, they are
+                        updated in place
+  @param[in]  pState    points to the state buffer of length numTaps - 1 + blockSize
+  @param[in]  mu        step size
+  @return     none
+ */
+
+void plp_lms_init_f32(plp_lms_instance_f32 *S,
+                      uint16_t numTaps,
+                      float32_t *pCoeffs,
+                      float32_t *pState,
+                      float32_t mu);
+
+/** -------------------------------------------------------
+  @brief Glue code for the floating-point LMS filter.
+  @param[in]  S          points to the instance structure
+  @param[in]  pSrc       points to the input block
+  @param[in]  pRef       points to the reference block
+  @param[in]  blockSize  number of samples
+  @param[out] pOut       points to the output block
+  @param[out] pErr       points to the error block
+  @return     none
+ */
+
+void plp_lms_f32(const plp_lms_instance_f32 *S,
+                 const float32_t *__restrict__ pSrc,
+                 const float32_t *__restrict__ pRef,
+                 uint32_t blockSize,
+                 float32_t *__restrict__ pOut,
+                 float32_t *__restrict__ pErr);
+
+/** -------------------------------------------------------
+  @brief Glue code for the floating-point NLMS filter.
+  @param[in]  S          points to the instance structure
+  @param[in]  pSrc       points to the input block
+  @param[in]  pRef       points to the reference block
+  @param[in]  blockSize  number of samples
+  @param[out] pOut       points to the output block
+  @param[out] pErr       points to the error block
+  @return     none
+ */
+
+void plp_nlms_f32(const plp_lms_instance_f32 *S,
+                  const float32_t *__restrict__ pSrc,
+                  const float32_t *__restrict__ pRef,
+                  uint32_t blockSize,
+                  float32_t *__restrict__ pOut,
+                  float32_t *__restrict__ pErr);
+
+/** -------------------------------------------------------
+  @brief Glue code for the parallel floating-point block LMS filter. The coefficients are
+  updated once per call, with the gradient of the whole block.
+  @param[in]  S          points to the instance structure
+  @param[in]  pSrc       points to the input block
+  @param[in]  pRef       points to the reference block
+  @param[in]  blockSize  number of samples
+  @param[in]  nPE        number of cores to compute on
+  @param[out] pOut       points to the output block
+  @param[out] pErr       points to the error block
+  @return     none
+ */
+
+void plp_lms_block_f32_parallel(const plp_lms_instance_f32 *S,
+                                const float32_t *__restrict__ pSrc,
+                                const float32_t *__restrict__ pRef,
+                                uint32_t blockSize,
+                                uint32_t nPE,
+                                float32_t *__restrict__ pOut,
+                                float32_t *__restrict__ pErr);
+
+/** -------------------------------------------------------
+  @brief LMS filter of floating-point vectors kernel for XPULPV2 extension.
+  @param[in]     pSrc      points to the input samples, including the numTaps - 1 past samples
+  @param[in,out] pCoeffs   points to the coefficients in time-reversed order
+  @param[in]     numTaps   number of filter coefficients
+  @param[in]     mu        step size
+  @param[in]     pRef      points to the reference samples
+  @param[in]     blkSize   number of samples
+  @param[out]    pOut      points to the output samples
+  @param[out]    pErr      points to the error samples
+  @return        none
+ */
+
+void plp_lms_f32s_xpulpv2(const float32_t *__restrict__ pSrc,
+                          float32_t *__restrict__ pCoeffs,
+                          uint32_t numTaps,
+                          float32_t mu,
+                          const float32_t *__restrict__ pRef,
+                          uint32_t blkSize,
+                          float32_t *__restrict__ pOut,
+                          float32_t *__restrict__ pErr);
+
+/** -------------------------------------------------------
+  @brief NLMS filter of floating-point vectors kernel for XPULPV2 extension.
+  @param[in]     pSrc      points to the input samples, including the numTaps - 1 past samples
+  @param[in,out] pCoeffs   points to the coefficients in time-reversed order
+  @param[in]     numTaps   number of filter coefficients
+  @param[in]     mu        step size
+  @param[in]     pRef      points to the reference samples
+  @param[in]     blkSize   number of samples
+  @param[out]    pOut      points to the output samples
+  @param[out]    pErr      points to the error samples
+  @return        none
+ */
+
+void plp_nlms_f32s_xpulpv2(const float32_t *__restrict__ pSrc,
+                           float32_t *__restrict__ pCoeffs,
+                           uint32_t numTaps,
+                           float32_t mu,
+                           const float32_t *__restrict__ pRef,
+                           uint32_t blkSize,
+                           float32_t *__restrict__ pOut,
+                           float32_t *__restrict__ pErr);
+
+/** -------------------------------------------------------
+  @brief Parallel block LMS filter of floating-point vectors kernel for XPULPV2 extension.
+  First, each core computes the outputs and errors of a contiguous part of the block with the
+  coefficients of the beginning of the block. After a barrier, each core updates a contiguous
+  part of the coefficients with the correlation of the errors and the samples of the whole block.
+  @param[in]  task_args  pointer to plp_lms_block_instance_f32 struct initialized by
+                         plp_lms_block_f32_parallel
+  @return     none
+ */
+
+void plp_lms_block_f32p_xpulpv2(void *task_args);
+
+/** -------------------------------------------------------
+   @brief      Glue code for matrix matrix multiplication of a 32-bit integer matrices.
    @param[in]  pSrcA points to first the input matrix
    @param[in]  pSrcB points to second the input matrix
    @param[in]  M     Height of first matrix
    @param[in]  N     Width of first and heigt of second matrix
    @param[in]  O     Width of second matrix
-   @param[in]  shift Amount to shift the result of each multiplication.
-   @param[in]  nPE   Number of cores to use
    @param[out] pDstC Output is written here
    @return     none
+*/
 
-   @par Fix-Point and Shifting
-   The result will be shifted by the parameter `shift` to the right (multiplied
-   by 2^-shift). Assume that matrix A is represented as pSrcA * 2^-x, and matrix
-   B as pSrcB * 2^-y (in other words, A has it's x last digits after the binary
-   point). Then, the output is represented as pDstC * 2^-(x + y - shift).
+void plp_mat_mult_i32(const int32_t *__restrict__ pSrcA,
+                      const int32_t *__restrict__ pSrcB,
+                      uint32_t M,
+                      uint32_t N,
+                      uint32_t O,
+                      int32_t *__restrict__ pDstC);
 
-   The output of the matrix multiplication will also be stored as an 8-bit array.
-   Set the `shift` parameter such that no overflow ocurrs.
- */
+/** -------------------------------------------------------
+   @brief      Matrix matrix multiplication of a 32-bit integer matrices for RV32IM extension.
+   @param[in]  pSrcA points to first the input matrix
+   @param[in]  pSrcB points to second the input matrix
+   @param[in]  M     Height of first matrix
+   @param[in]  N     Width of first and heigt of second matrix
+   @param[in]  O     Width of second matrix
+   @param[out] pDstC Output is written here
+   @return     none
+*/
 
-void plp_mat_mult_q8_parallel(const int8_t *__restrict__ pSrcA,
-                              const int8_t *__restrict__ pSrcB,
+void plp_mat_mult_i32s_rv32im(const int32_t *__restrict__ pSrcA,
+                              const int32_t *__restrict__ pSrcB,
                               uint32_t M,
                               uint32_t N,
                               uint32_t O,
-                              uint32_t shift,
-                              uint32_t nPE,
-                              int8_t *__restrict__ pDstC);
+                              int32_t *__restrict__ pDstC);
 
 /** -------------------------------------------------------
-   @brief      Matrix matrix multiplication of a 8-bit fix-point matrices for RV32IM extension.
+   @brief      Matrix matrix multiplication of a 32-bit integer matrices for XPULPV2 extension.
    @param[in]  pSrcA points to first the input matrix
    @param[in]  pSrcB points to second the input matrix
    @param[in]  M     Height of first matrix
    @param[in]  N     Width of first and heigt of second matrix
    @param[in]  O     Width of second matrix
-   @param[in]  shift Amount to shift the result of each multiplication.
    @param[out] pDstC Output is written here
    @return     none
-
-   @par Fix-Point and Shifting
-   The result will be shifted by the parameter `shift` to the right (multiplied
-   by 2^-shift). Assume that matrix A is represented as pSrcA * 2^-x, and matrix
-   B as pSrcB * 2^-y (in other words, A has it's x last digits after the binary
-   point). Then, the output is represented as pDstC * 2^-(x + y - shift).
-
-   The output of the matrix multiplication will also be stored as an 8-bit array.
-   Set the `shift` parameter such that no overflow ocurrs.
 */
 
-void plp_mat_mult_q8s_rv32im(const int8_t *__restrict__ pSrcA,
-                             const int8_t *__restrict__ pSrcB,
-                             uint32_t M,
-                             uint32_t N,
-                             uint32_t O,
-                             uint32_t shift,
-                             int8_t *__restrict__ pDstC);
+void plp_mat_mult_i32s_xpulpv2(const int32_t *__restrict__ pSrcA,
+                               const int32_t *__restrict__ pSrcB,
+                               uint32_t M,
+                               uint32_t N,
+                               uint32_t O,
+                               int32_t *__restrict__ pDstC);
 
 /** -------------------------------------------------------
-   @brief      Matrix matrix multiplication of a 8-bit fix-point matrices for XPULPV2 extension.
+   @brief      Glue code for matrix matrix multiplication of a 16-bit integer matrices.
    @param[in]  pSrcA points to first the input matrix
    @param[in]  pSrcB points to second the input matrix
    @param[in]  M     Height of first matrix
    @param[in]  N     Width of first and heigt of second matrix
    @param[in]  O     Width of second matrix
-   @param[in]  shift Amount to shift the result of each multiplication.
    @param[out] pDstC Output is written here
    @return     none
+*/
 
-   @par Fix-Point and Shifting
-   The result will be shifted by the parameter `shift` to the right (multiplied
-   by 2^-shift). Assume that matrix A is represented as pSrcA * 2^-x, and matrix
-   B as pSrcB * 2^-y (in other words, A has it's x last digits after the binary
-   point). Then, the output is represented as pDstC * 2^-(x + y - shift).
+void plp_mat_mult_i16(const int16_t *__restrict__ pSrcA,
+                      const int16_t *__restrict__ pSrcB,
+                      uint32_t M,
+                      uint32_t N,
+                      uint32_t O,
+                      int32_t *__restrict__ pDstC);
 
-   The output of the matrix multiplication will also be stored as an 8-bit array.
-   Set the `shift` parameter such that no overflow ocurrs.
+/** -------------------------------------------------------
+   @brief      Matrix matrix multiplication of a 16-bit integer matrices for RV32IM extension.
+   @param[in]  pSrcA points to first the input matrix
+   @param[in]  pSrcB points to second the input matrix
+   @param[in]  M     Height of first matrix
+   @param[in]  N     Width of first and heigt of second matrix
+   @param[in]  O     Width of second matrix
+   @param[out] pDstC Output is written here
+   @return     none
 */
 
-void plp_mat_mult_q8s_xpulpv2(const int8_t *__restrict__ pSrcA,
-                              const int8_t *__restrict__ pSrcB,
+void plp_mat_mult_i16s_rv32im(const int16_t *__restrict__ pSrcA,
+                              const int16_t *__restrict__ pSrcB,
                               uint32_t M,
                               uint32_t N,
                               uint32_t O,
-                              uint32_t shift,
-                              int8_t *__restrict__ pDstC);
+                              int32_t *__restrict__ pDstC);
 
 /** -------------------------------------------------------
-    @brief Parallel matrix multiplication of 8-bit fix-point matrices kernel for XPULPV2 extension.
-    @param[in]  args  pointer to plp_mat_mult_instance_q8 struct initialized by
-                      plp_mat_mult_q8_parallel
-    @return     none
+   @brief      Matrix matrix multiplication of a 16-bit integer matrices for XPULPV2 extension.
+   @param[in]  pSrcA points to first the input matrix
+   @param[in]  pSrcB points to second the input matrix
+   @param[in]  M     Height of first matrix
+   @param[in]  N     Width of first and heigt of second matrix
+   @param[in]  O     Width of second matrix
+   @param[out] pDstC Output is written here
+   @return     none
+
+   @par Exploiting SIMD instructions
+   The 16 bit values are packed two each into 32 bit vectors and then the two dot products are
+   performed on 32 bit vectors, with 32 bit accumulator.
 */
 
-void plp_mat_mult_q8p_xpulpv2(void *args);
+void plp_mat_mult_i16s_xpulpv2(const int16_t *__restrict__ pSrcA,
+                               const int16_t *__restrict__ pSrcB,
+                               uint32_t M,
+                               uint32_t N,
+                               uint32_t O,
+                               int32_t *__restrict__ pDstC);
 
 /** -------------------------------------------------------
-  @brief      Glue code of matrix matrix multiplication for complex 32-bit integers
-  @param[in]  pSrcA Points to the first input matrix of shape MxN
-  @param[in]  pSrcB Points to the second input matrix of shape NxO
-  @param[in]  M     Height of matrix SrcA and DstC
-  @param[in]  N     Width of matrix SrcA and height of matrix SrcB
-  @param[in]  O     Width of matrix SrcB and DstC
-  @param[out] pDstC Points to the output matrix of shape MxO
-  @return     none
+   @brief      Glue code for matrix matrix multiplication of a 8-bit integer matrices.
+   @param[in]  pSrcA points to first the input matrix
+   @param[in]  pSrcB points to second the input matrix
+   @param[in]  M     Height of first matrix
+   @param[in]  N     Width of first and heigt of second matrix
+   @param[in]  O     Width of second matrix
+   @param[out] pDstC Output is written here
+   @return     none
 */
 
-void plp_mat_mult_cmplx_i32(const int32_t *__restrict__ pSrcA,
-                            const int32_t *__restrict__ pSrcB,
-                            uint32_t M,
-                            uint32_t N,
-                            uint32_t O,
-                            int32_t *__restrict__ pDstC);
+void plp_mat_mult_i8(const int8_t *__restrict__ pSrcA,
+                     const int8_t *__restrict__ pSrcB,
+                     uint32_t M,
+                     uint32_t N,
+                     uint32_t O,
+                     int32_t *__restrict__ pDstC);
 
 /** -------------------------------------------------------
-  @brief      Matrix matrix multiplication for complex 32-bit integers on RV32IM
-  @param[in]  pSrcA Points to the first input matrix of shape MxN
-  @param[in]  pSrcB Points to the second input matrix of shape NxO
-  @param[in]  M     Height of matrix SrcA and DstC
-  @param[in]  N     Width of matrix SrcA and height of matrix SrcB
-  @param[in]  O     Width of matrix SrcB and DstC
-  @param[out] pDstC Points to the output matrix of shape MxO
-  @return     none
+   @brief      Matrix matrix multiplication of a 8-bit integer matrices for RV32IM extension.
+   @param[in]  pSrcA points to first the input matrix
+   @param[in]  pSrcB points to second the input matrix
+   @param[in]  M     Height of first matrix
+   @param[in]  N     Width of first and heigt of second matrix
+   @param[in]  O     Width of second matrix
+   @param[out] pDstC Output is written here
+   @return     none
 */
 
-void plp_mat_mult_cmplx_i32s_rv32im(const int32_t *__restrict__ pSrcA,
-                                    const int32_t *__restrict__ pSrcB,
-                                    uint32_t M,
-                                    uint32_t N,
-                                    uint32_t O,
-                                    int32_t *__restrict__ pDstC);
+void plp_mat_mult_i8s_rv32im(const int8_t *__restrict__ pSrcA,
+                             const int8_t *__restrict__ pSrcB,
+                             uint32_t M,
+                             uint32_t N,
+                             uint32_t O,
+                             int32_t *__restrict__ pDstC);
 
 /** -------------------------------------------------------
-  @brief      Matrix matrix multiplication for complex 32-bit integers on XpulpV2
-  @param[in]  pSrcA Points to the first input matrix of shape MxN
-  @param[in]  pSrcB Points to the second input matrix of shape NxO
-  @param[in]  M     Height of matrix SrcA and DstC
-  @param[in]  N     Width of matrix SrcA and height of matrix SrcB
-  @param[in]  O     Width of matrix SrcB and DstC
-  @param[out] pDstC Points to the output matrix of shape MxO
-  @return     none
-*/
-
-void plp_mat_mult_cmplx_i32s_xpulpv2(const int32_t *__restrict__ pSrcA,
-                                     const int32_t *__restrict__ pSrcB,
-                                     uint32_t M,
-                                     uint32_t N,
-                                     uint32_t O,
-                                     int32_t *__restrict__ pDstC);
+   @brief      Matrix matrix multiplication of a 8-bit integer matrices for XPULPV2 extension.
+   @param[in]  pSrcA points to first the input matrix
+   @param[in]  pSrcB points to second the input matrix
+   @param[in]  M     Height of first matrix
+   @param[in]  N     Width of first and heigt of second matrix
+   @param[in]  O     Width of second matrix
+   @param[out] pDstC Output is written here
+   @return     none
 
-/** -------------------------------------------------------
-  @brief      Glue code of parallel matrix matrix multiplication for complex 32-bit integers
-  @param[in]  pSrcA Points to the first input matrix of shape MxN
-  @param[in]  pSrcB Points to the second input matrix of shape NxO
-  @param[in]  M     Height of matrix SrcA and DstC
-  @param[in]  N     Width of matrix SrcA and height of matrix SrcB
-  @param[in]  O     Width of matrix SrcB and DstC
-  @param[in]  nPE   Number of cores to use for computation
-  @param[out] pDstC Points to the output matrix of shape MxO
-  @return     none
+   @par Exploiting SIMD instructions
+   The 8 bit values are packed four each into 32 bit vectors and then the four dot products are
+   performed on 32 bit vectors, with 32 bit accumulator.
 */
 
-void plp_mat_mult_cmplx_i32_parallel(const int32_t *__restrict__ pSrcA,
-                                     const int32_t *__restrict__ pSrcB,
-                                     uint32_t M,
-                                     uint32_t N,
-                                     uint32_t O,
-                                     uint32_t nPE,
-                                     int32_t *__restrict__ pDstC);
+void plp_mat_mult_i8s_xpulpv2(const int8_t *__restrict__ pSrcA,
+                              const int8_t *__restrict__ pSrcB,
+                              uint32_t M,
+                              uint32_t N,
+                              uint32_t O,
+                              int32_t *__restrict__ pDstC);
 
 /** -------------------------------------------------------
-  @brief      parallel matrix matrix multiplication for complex 32-bit integers on XpulpV2
-  @param[in]  args  pointer to plp_mat_mult_cmplx_instance_i32 struct initialized by
-                    plp_mat_mult_cmplx_i32_parallel
-  @return     none
+   @brief      Glue code for parallel matrix matrix multiplication of a 32-bit integer matrices.
+   @param[in]  pSrcA points to first the input matrix
+   @param[in]  pSrcB points to second the input matrix
+   @param[in]  M     Height of first matrix
+   @param[in]  N     Width of first and heigt of second matrix
+   @param[in]  O     Width of second matrix
+   @param[in]  nPE   Number of cores to use (or PLP_NPE_AUTO)
+   @param[out] pDstC Output is written here
+   @return     none
 */
 
-void plp_mat_mult_cmplx_i32p_xpulpv2(void *args);
+void plp_mat_mult_i32_parallel(const int32_t *__restrict__ pSrcA,
+                               const int32_t *__restrict__ pSrcB,
+                               uint32_t M,
+                               uint32_t N,
+                               uint32_t O,
+                               uint32_t nPE,
+                               int32_t *__restrict__ pDstC);
 
 /** -------------------------------------------------------
-  @brief      Glue code of matrix matrix multiplication for complex 16-bit integers
-  @param[in]  pSrcA Points to the first input matrix of shape MxN
-  @param[in]  pSrcB Points to the second input matrix of shape NxO
-  @param[in]  M     Height of matrix SrcA and DstC
-  @param[in]  N     Width of matrix SrcA and height of matrix SrcB
-  @param[in]  O     Width of matrix SrcB and DstC
-  @param[out] pDstC Points to the output matrix of shape MxO
-  @return     none
+   @brief      Parallel matrix matrix multiplication of a 32-bit integer matrices for XPULPV2
+               extension.
+   @param[in]  args  pointer to plp_mat_mult_instance_i32 struct initialized by
+                     plp_mat_mult_i32_parallel
+   @return     none
 */
 
-void plp_mat_mult_cmplx_i16(const int16_t *__restrict__ pSrcA,
-                            const int16_t *__restrict__ pSrcB,
-                            uint32_t M,
-                            uint32_t N,
-                            uint32_t O,
-                            int32_t *__restrict__ pDstC);
+void plp_mat_mult_i32p_xpulpv2(void *args);
 
 /** -------------------------------------------------------
-  @brief      Matrix matrix multiplication for complex 16-bit integers on RV32IM
-  @param[in]  pSrcA Points to the first input matrix of shape MxN
-  @param[in]  pSrcB Points to the second input matrix of shape NxO
-  @param[in]  M     Height of matrix SrcA and DstC
-  @param[in]  N     Width of matrix SrcA and height of matrix SrcB
-  @param[in]  O     Width of matrix SrcB and DstC
-  @param[out] pDstC Points to the output matrix of shape MxO
-  @return     none
+   @brief      Glue code for parallel matrix matrix multiplication of a 16-bit integer matrices.
+   @param[in]  pSrcA points to first the input matrix
+   @param[in]  pSrcB points to second the input matrix
+   @param[in]  M     Height of first matrix
+   @param[in]  N     Width of first and heigt of second matrix
+   @param[in]  O     Width of second matrix
+   @param[in]  nPE   Number of cores to use (or PLP_NPE_AUTO)
+   @param[out] pDstC Output is written here
+   @return     none
 */
 
-void plp_mat_mult_cmplx_i16s_rv32im(const int16_t *__restrict__ pSrcA,
-                                    const int16_t *__restrict__ pSrcB,
-                                    uint32_t M,
-                                    uint32_t N,
-                                    uint32_t O,
-                                    int32_t *__restrict__ pDstC);
+void plp_mat_mult_i16_parallel(const int16_t *__restrict__ pSrcA,
+                               const int16_t *__restrict__ pSrcB,
+                               uint32_t M,
+                               uint32_t N,
+                               uint32_t O,
+                               uint32_t nPE,
+                               int32_t *__restrict__ pDstC);
 
 /** -------------------------------------------------------
-  @brief      Matrix matrix multiplication for complex 16-bit integers on XpulpV2
-  @param[in]  pSrcA Points to the first input matrix of shape MxN
-  @param[in]  pSrcB Points to the second input matrix of shape NxO
-  @param[in]  M     Height of matrix SrcA and DstC
-  @param[in]  N     Width of matrix SrcA and height of matrix SrcB
-  @param[in]  O     Width of matrix SrcB and DstC
-  @param[out] pDstC Points to the output matrix of shape MxO
-  @return     none
+    @brief Parallel matrix multiplication of 16-bit integer matrices kernel for XPULPV2 extension.
+    @param[in]  args  pointer to plp_mat_mult_instance_i16 struct initialized by
+                      plp_mat_mult_i16_parallel
+    @return     none
 
-  @par Exploiting SIMD instructions
-  The 16 bit values are packed two each into 32 bit vectors and then the two dot products are
-  performed on 32 bit vectors, with 32 bit accumulator.
+    @par Exploiting SIMD instructions
+    The 16 bit values are packed two each into 32 bit vectors and then the two dot products are
+    performed on 32 bit vectors, with 32 bit accumulator.
 */
 
-void plp_mat_mult_cmplx_i16s_xpulpv2(const int16_t *__restrict__ pSrcA,
-                                     const int16_t *__restrict__ pSrcB,
-                                     uint32_t M,
-                                     uint32_t N,
-                                     uint32_t O,
-                                     int32_t *__restrict__ pDstC);
+void plp_mat_mult_i16p_xpulpv2(void *args);
 
 /** -------------------------------------------------------
-  @brief      Glue code of parallel matrix matrix multiplication for complex 16-bit integers
-  @param[in]  pSrcA Points to the first input matrix of shape MxN
-  @param[in]  pSrcB Points to the second input matrix of shape NxO
-  @param[in]  M     Height of matrix SrcA and DstC
-  @param[in]  N     Width of matrix SrcA and height of matrix SrcB
-  @param[in]  O     Width of matrix SrcB and DstC
-  @param[in]  nPE   Number of cores to use for computation
-  @param[out] pDstC Points to the output matrix of shape MxO
-  @return     none
+   @brief      Glue code for parallel matrix matrix multiplication of a 8-bit integer matrices.
+   @param[in]  pSrcA points to first the input matrix
+   @param[in]  pSrcB points to second the input matrix
+   @param[in]  M     Height of first matrix
+   @param[in]  N     Width of first and heigt of second matrix
+   @param[in]  O     Width of second matrix
+   @param[in]  nPE   Number of cores to use (or PLP_NPE_AUTO)
+   @param[out] pDstC Output is written here
+   @return     none
 */
 
-void plp_mat_mult_cmplx_i16_parallel(const int16_t *__restrict__ pSrcA,
-                                     const int16_t *__restrict__ pSrcB,
-                                     uint32_t M,
-                                     uint32_t N,
-                                     uint32_t O,
-                                     uint32_t nPE,
-                                     int32_t *__restrict__ pDstC);
+void plp_mat_mult_i8_parallel(const int8_t *__restrict__ pSrcA,
+                              const int8_t *__restrict__ pSrcB,
+                              uint32_t M,
+                              uint32_t N,
+                              uint32_t O,
+                              uint32_t nPE,
+                              int32_t *__restrict__ pDstC);
 
 /** -------------------------------------------------------
-  @brief      parallel matrix matrix multiplication for complex 16-bit integers on XpulpV2
-  @param[in]  args  pointer to plp_mat_mult_cmplx_instance_i16 struct initialized by
-                    plp_mat_mult_cmplx_i16_parallel
-  @return     none
-
-  @par Exploiting SIMD instructions
-  The 16 bit values are packed two each into 32 bit vectors and then the two dot products are
-  performed on 32 bit vectors, with 32 bit accumulator.
+   @brief      Glue code for matrix matrix multiplication of a 32-bit floating-point matrices.
+   @param[in]  pSrcA points to first the input matrix
+   @param[in]  pSrcB points to second the input matrix
+   @param[in]  M     Height of first matrix
+   @param[in]  N     Width of first and heigt of second matrix
+   @param[in]  O     Width of second matrix
+   @param[out] pDstC Output is written here
+   @return     none
 */
 
-void plp_mat_mult_cmplx_i16p_xpulpv2(void *args);
+void plp_mat_mult_f32(const float *__restrict__ pSrcA,
+                      const float *__restrict__ pSrcB,
+                      uint32_t M,
+                      uint32_t N,
+                      uint32_t O,
+                      float *__restrict__ pDstC);
 
 /** -------------------------------------------------------
-  @brief      Glue code of matrix matrix multiplication for complex 8-bit integers
-  @param[in]  pSrcA Points to the first input matrix of shape MxN
-  @param[in]  pSrcB Points to the second input matrix of shape NxO
-  @param[in]  M     Height of matrix SrcA and DstC
-  @param[in]  N     Width of matrix SrcA and height of matrix SrcB
-  @param[in]  O     Width of matrix SrcB and DstC
-  @param[out] pDstC Points to the output matrix of shape MxO
-  @return     none
+   @brief      Matrix matrix multiplication of a 32-bit floating-point matrices for XPULPV2
+               extension.
+   @param[in]  pSrcA points to first the input matrix
+   @param[in]  pSrcB points to second the input matrix
+   @param[in]  M     Height of first matrix
+   @param[in]  N     Width of first and heigt of second matrix
+   @param[in]  O     Width of second matrix
+   @param[out] pDstC Output is written here
+   @return     none
 */
 
-void plp_mat_mult_cmplx_i8(const int8_t *__restrict__ pSrcA,
-                           const int8_t *__restrict__ pSrcB,
-                           uint32_t M,
-                           uint32_t N,
-                           uint32_t O,
-                           int32_t *__restrict__ pDstC);
-
+void plp_mat_mult_f32s_xpulpv2(const float *__restrict__ pSrcA,
+                               const float *__restrict__ pSrcB,
+                               uint32_t M,
+                               uint32_t N,
+                               uint32_t O,
+                               float *__restrict__ pDstC);
+
 /** -------------------------------------------------------
-  @brief      Matrix matrix multiplication for complex 8-bit integers on RV32IM
-  @param[in]  pSrcA Points to the first input matrix of shape MxN
-  @param[in]  pSrcB Points to the second input matrix of shape NxO
-  @param[in]  M     Height of matrix SrcA and DstC
-  @param[in]  N     Width of matrix SrcA and height of matrix SrcB
-  @param[in]  O     Width of matrix SrcB and DstC
-  @param[out] pDstC Points to the output matrix of shape MxO
-  @return     none
+   @brief      Glue code for parallel matrix matrix multiplication of a 32-bit floating-point
+   matrices.
+   @param[in]  pSrcA points to first the input matrix
+   @param[in]  pSrcB points to second the input matrix
+   @param[in]  M     Height of first matrix
+   @param[in]  N     Width of first and heigt of second matrix
+   @param[in]  O     Width of second matrix
+   @param[in]  nPE   Number of cores to use (or PLP_NPE_AUTO)
+   @param[out] pDstC Output is written here
+   @return     none
 */
 
-void plp_mat_mult_cmplx_i8s_rv32im(const int8_t *__restrict__ pSrcA,
-                                   const int8_t *__restrict__ pSrcB,
-                                   uint32_t M,
-                                   uint32_t N,
-                                   uint32_t O,
-                                   int32_t *__restrict__ pDstC);
+void plp_mat_mult_f32_parallel(const float *__restrict__ pSrcA,
+                               const float *__restrict__ pSrcB,
+                               uint32_t M,
+                               uint32_t N,
+                               uint32_t O,
+                               uint32_t nPE,
+                               float *__restrict__ pDstC);
 
 /** -------------------------------------------------------
-  @brief      Matrix matrix multiplication for complex 8-bit integers on XpulpV2
-  @param[in]  pSrcA Points to the first input matrix of shape MxN
-  @param[in]  pSrcB Points to the second input matrix of shape NxO
-  @param[in]  M     Height of matrix SrcA and DstC
-  @param[in]  N     Width of matrix SrcA and height of matrix SrcB
-  @param[in]  O     Width of matrix SrcB and DstC
-  @param[out] pDstC Points to the output matrix of shape MxO
-  @return     none
-
-  @par Exploiting SIMD instructions
-  The 8 bit values are packed four each into 32 bit vectors and then the four dot products are
-  performed on 32 bit vectors, with 32 bit accumulator.
+    @brief      Parallel matrix multiplication of 32-bit floating-point matrices kernel for XPULPV2
+                extension.
+    @param[in]  args  pointer to plp_mat_mult_instance_f32 struct initialized by
+                      plp_mat_mult_f32_parallel
+    @return     none
 */
 
-void plp_mat_mult_cmplx_i8s_xpulpv2(const int8_t *__restrict__ pSrcA,
-                                    const int8_t *__restrict__ pSrcB,
-                                    uint32_t M,
-                                    uint32_t N,
-                                    uint32_t O,
-                                    int32_t *__restrict__ pDstC);
+void plp_mat_mult_f32p_xpulpv2(void *args);
 
 /** -------------------------------------------------------
-  @brief      Glue code of parallel matrix matrix multiplication for complex 8-bit integers
-  @param[in]  pSrcA Points to the first input matrix of shape MxN
-  @param[in]  pSrcB Points to the second input matrix of shape NxO
-  @param[in]  M     Height of matrix SrcA and DstC
-  @param[in]  N     Width of matrix SrcA and height of matrix SrcB
-  @param[in]  O     Width of matrix SrcB and DstC
-  @param[in]  nPE   Number of cores to use for computation
-  @param[out] pDstC Points to the output matrix of shape MxO
-  @return     none
+   @brief      Parallel matrix multiplication of 8-bit integer matrices kernel for XPULPV2
+               extension.
+   @param[in]  args  pointer to plp_mat_mult_instance_i8 struct initialized by
+                     plp_mat_mult_i8_parallel
+   @return     none
+
+   @par Exploiting SIMD instructions
+   The 8 bit values are packed four each into 32 bit vectors and then the four dot products are
+   performed on 32 bit vectors, with 32 bit accumulator.
 */
 
-void plp_mat_mult_cmplx_i8_parallel(const int8_t *__restrict__ pSrcA,
-                                    const int8_t *__restrict__ pSrcB,
-                                    uint32_t M,
-                                    uint32_t N,
-                                    uint32_t O,
-                                    uint32_t nPE,
-                                    int32_t *__restrict__ pDstC);
+void plp_mat_mult_i8p_xpulpv2(void *args);
 
 /** -------------------------------------------------------
-  @brief      parallel matrix matrix multiplication for complex 8-bit integers on XpulpV2
-  @param[in]  args  pointer to plp_mat_mult_cmplx_instance_i8 struct initialized by
-                    plp_mat_mult_cmplx_i8_parallel
-  @return     none
+   @brief      Glue code for matrix matrix multiplication of a 32-bit fix-point matrices.
+   @param[in]  pSrcA points to first the input matrix
+   @param[in]  pSrcB points to second the input matrix
+   @param[in]  M     Height of first matrix
+   @param[in]  N     Width of first and heigt of second matrix
+   @param[in]  O     Width of second matrix
+   @param[in]  shift Amount to shift the result of each multiplication.
+   @param[out] pDstC Output is written here
+   @return     none
 
-  @par Exploiting SIMD instructions
-  The 8 bit values are packed four each into 32 bit vectors and then the four dot products are
-  performed on 32 bit vectors, with 32 bit accumulator.
-*/
+   @par Fix-Point and Shifting
+   The result will be shifted by the parameter `shift` to the right (multiplied
+   by 2^-shift). Assume that matrix A is represented as pSrcA * 2^-x, and matrix
+   B as pSrcB * 2^-y (in other words, A has it's x last digits after the binary
+   point). Then, the output is represented as pDstC * 2^-(x + y - shift).
+ */
 
-void plp_mat_mult_cmplx_i8p_xpulpv2(void *args);
+void plp_mat_mult_q32(const int32_t *__restrict__ pSrcA,
+                      const int32_t *__restrict__ pSrcB,
+                      uint32_t M,
+                      uint32_t N,
+                      uint32_t O,
+                      uint32_t shift,
+                      int32_t *__restrict__ pDstC);
 
 /** -------------------------------------------------------
-  @brief      Glue code of matrix matrix multiplication for complex 32-bit floats
-  @param[in]  pSrcA Points to the first input matrix of shape MxN
-  @param[in]  pSrcB Points to the second input matrix of shape NxO
-  @param[in]  M     Height of matrix SrcA and DstC
-  @param[in]  N     Width of matrix SrcA and height of matrix SrcB
-  @param[in]  O     Width of matrix SrcB and DstC
-  @param[out] pDstC Points to the output matrix of shape MxO
-  @return     none
-*/
+   @brief      Glue code for parallel matrix matrix multiplication of a 32-bit fix-point
+               matrices.
+   @param[in]  pSrcA points to first the input matrix
+   @param[in]  pSrcB points to second the input matrix
+   @param[in]  M     Height of first matrix
+   @param[in]  N     Width of first and heigt of second matrix
+   @param[in]  O     Width of second matrix
+   @param[in]  shift Amount to shift the result of each multiplication.
+   @param[in]  nPE   Number of cores to use (or PLP_NPE_AUTO)
+   @param[out] pDstC Output is written here
+   @return     none
 
-void plp_mat_mult_cmplx_f32(const float *__restrict__ pSrcA,
-                            const float *__restrict__ pSrcB,
-                            uint32_t M,
-                            uint32_t N,
-                            uint32_t O,
-                            float *__restrict__ pDstC);
+   @par Fix-Point and Shifting
+   The result will be shifted by the parameter `shift` to the right (multiplied
+   by 2^-shift). Assume that matrix A is represented as pSrcA * 2^-x, and matrix
+   B as pSrcB * 2^-y (in other words, A has it's x last digits after the binary
+   point). Then, the output is represented as pDstC * 2^-(x + y - shift).
+ */
+
+void plp_mat_mult_q32_parallel(const int32_t *__restrict__ pSrcA,
+                               const int32_t *__restrict__ pSrcB,
+                               uint32_t M,
+                               uint32_t N,
+                               uint32_t O,
+                               uint32_t shift,
+                               uint32_t nPE,
+                               int32_t *__restrict__ pDstC);
 
 /** -------------------------------------------------------
-  @brief      Matrix matrix multiplication for complex 32-bit floats on XpulpV2
-  @param[in]  pSrcA Points to the first input matrix of shape MxN
-  @param[in]  pSrcB Points to the second input matrix of shape NxO
-  @param[in]  M     Height of matrix SrcA and DstC
-  @param[in]  N     Width of matrix SrcA and height of matrix SrcB
-  @param[in]  O     Width of matrix SrcB and DstC
-  @param[out] pDstC Points to the output matrix of shape MxO
-  @return     none
+   @brief      Matrix matrix multiplication of a 32-bit fix-point matrices for RV32IM extension.
+   @param[in]  pSrcA points to first the input matrix
+   @param[in]  pSrcB points to second the input matrix
+   @param[in]  M     Height of first matrix
+   @param[in]  N     Width of first and heigt of second matrix
+   @param[in]  O     Width of second matrix
+   @param[in]  shift Amount to shift the result of each multiplication.
+   @param[out] pDstC Output is written here
+   @return     none
+
+   @par Fix-Point and Shifting
+   The result will be shifted by the parameter `shift` to the right (multiplied
+   by 2^-shift). Assume that matrix A is represented as pSrcA * 2^-x, and matrix
+   B as pSrcB * 2^-y (in other words, A has it's x last digits after the binary
+   point). Then, the output is represented as pDstC * 2^-(x + y - shift).
 */
 
-void plp_mat_mult_cmplx_f32s_xpulpv2(const float *__restrict__ pSrcA,
-                                     const float *__restrict__ pSrcB,
-                                     uint32_t M,
-                                     uint32_t N,
-                                     uint32_t O,
-                                     float *__restrict__ pDstC);
+void plp_mat_mult_q32s_rv32im(const int32_t *__restrict__ pSrcA,
+                              const int32_t *__restrict__ pSrcB,
+                              uint32_t M,
+                              uint32_t N,
+                              uint32_t O,
+                              uint32_t shift,
+                              int32_t *__restrict__ pDstC);
 
 /** -------------------------------------------------------
-  @brief      Glue code of parallel matrix matrix multiplication for complex 32-bit floats
-  @param[in]  pSrcA Points to the first input matrix of shape MxN
-  @param[in]  pSrcB Points to the second input matrix of shape NxO
-  @param[in]  M     Height of matrix SrcA and DstC
-  @param[in]  N     Width of matrix SrcA and height of matrix SrcB
-  @param[in]  O     Width of matrix SrcB and DstC
-  @param[in]  nPE   Number of cores to use for computation
-  @param[out] pDstC Points to the output matrix of shape MxO
-  @return     none
+   @brief      Matrix matrix multiplication of a 32-bit fix-point matrices for XPULPV2 extension.
+   @param[in]  pSrcA points to first the input matrix
+   @param[in]  pSrcB points to second the input matrix
+   @param[in]  M     Height of first matrix
+   @param[in]  N     Width of first and heigt of second matrix
+   @param[in]  O     Width of second matrix
+   @param[in]  shift Amount to shift the result of each multiplication.
+   @param[out] pDstC Output is written here
+   @return     none
+
+   @par Fix-Point and Shifting
+   The result will be shifted by the parameter `shift` to the right (multiplied
+   by 2^-shift). Assume that matrix A is represented as pSrcA * 2^-x, and matrix
+   B as pSrcB * 2^-y (in other words, A has it's x last digits after the binary
+   point). Then, the output is represented as pDstC * 2^-(x + y - shift).
 */
 
-void plp_mat_mult_cmplx_f32_parallel(const float *__restrict__ pSrcA,
-                                     const float *__restrict__ pSrcB,
-                                     uint32_t M,
-                                     uint32_t N,
-                                     uint32_t O,
-                                     uint32_t nPE,
-                                     float *__restrict__ pDstC);
+void plp_mat_mult_q32s_xpulpv2(const int32_t *__restrict__ pSrcA,
+                               const int32_t *__restrict__ pSrcB,
+                               uint32_t M,
+                               uint32_t N,
+                               uint32_t O,
+                               uint32_t shift,
+                               int32_t *__restrict__ pDstC);
 
 /** -------------------------------------------------------
-  @brief      parallel matrix matrix multiplication for complex 32-bit floats on XpulpV2
-  @param[in]  args  pointer to plp_mat_mult_cmplx_instance_f32 struct initialized by
-                    plp_mat_mult_cmplx_f32_parallel
-  @return     none
+    @brief Parallel matrix multiplication of 32-bit fix-point matrices kernel for XPULPV2 extension.
+    @param[in]  args  pointer to plp_mat_mult_instance_q32 struct initialized by
+                      plp_mat_mult_q32_parallel
+    @return     none
 */
 
-void plp_mat_mult_cmplx_f32p_xpulpv2(void *args);
+void plp_mat_mult_q32p_xpulpv2(void *args);
 
 /** -------------------------------------------------------
-  @brief      Glue code of matrix matrix multiplication for complex 32-bit fix-point
-  @param[in]  pSrcA Points to the first input matrix of shape MxN
-  @param[in]  pSrcB Points to the second input matrix of shape NxO
-  @param[in]  M     Height of matrix SrcA and DstC
-  @param[in]  N     Width of matrix SrcA and height of matrix SrcB
-  @param[in]  O     Width of matrix SrcB and DstC
-  @param[in]  shift Amount to shift the result of each multiplication ot the right
-  @param[out] pDstC Points to the output matrix of shape MxO
-  @return     none
-
-  @par Fix-Point
-  Fix-Point and Shifting
-  The result will be shifted by the parameter `shift` to the right (which corresponds to a
-  multiplication by `2^-shift`). Assume that matrix A is represente as `pSrcA * 2^-x` and matrix B
-  as `pSrcB * 2^-y` (which means that A has `x`, and B has `y` bits after the binary point). Then,
-  the output matrix C is represented as `pDstC * 2^-(x + y - shift)`.
-  The output matrix is also stored with the same number of bits as the inputs. Set the
-  `shift` parameter such that no overflow occurrs.
-*/
+   @brief      Glue code for matrix matrix multiplication of a 16-bit fix-point matrices.
+   @param[in]  pSrcA points to first the input matrix
+   @param[in]  pSrcB points to second the input matrix
+   @param[in]  M     Height of first matrix
+   @param[in]  N     Width of first and heigt of second matrix
+   @param[in]  O     Width of second matrix
+   @param[in]  shift Amount to shift the result of each multiplication.
+   @param[out] pDstC Output is written here
+   @return     none
 
-void plp_mat_mult_cmplx_q32(const int32_t *__restrict__ pSrcA,
-                            const int32_t *__restrict__ pSrcB,
-                            uint32_t M,
-                            uint32_t N,
-                            uint32_t O,
-                            uint32_t shift,
-                            int32_t *__restrict__ pDstC);
+   @par Fix-Point and Shifting
+   The result will be shifted by the parameter `shift` to the right (multiplied
+   by 2^-shift). Assume that matrix A is represented as pSrcA * 2^-x, and matrix
+   B as pSrcB * 2^-y (in other words, A has it's x last digits after the binary
+   point). Then, the output is represented as pDstC * 2^-(x + y - shift).
+
+   The output of the matrix multiplication will also be stored as an 16-bit array.
+   Set the `shift` parameter such that no overflow ocurrs.
+ */
+
+void plp_mat_mult_q16(const int16_t *__restrict__ pSrcA,
+                      const int16_t *__restrict__ pSrcB,
+                      uint32_t M,
+                      uint32_t N,
+                      uint32_t O,
+                      uint32_t shift,
+                      int16_t *__restrict__ pDstC);
 
 /** -------------------------------------------------------
-  @brief      Matrix matrix multiplication for complex 32-bit fix-point on RV32IM
-  @param[in]  pSrcA Points to the first input matrix of shape MxN
-  @param[in]  pSrcB Points to the second input matrix of shape NxO
-  @param[in]  M     Height of matrix SrcA and DstC
-  @param[in]  N     Width of matrix SrcA and height of matrix SrcB
-  @param[in]  O     Width of matrix SrcB and DstC
-  @param[in]  shift Amount to shift the result of each multiplication ot the right
-  @param[out] pDstC Points to the output matrix of shape MxO
-  @return     none
+   @brief      Glue code for parallel matrix matrix multiplication of a 16-bit fix-point
+  matrices.
+   @param[in]  pSrcA points to first the input matrix
+   @param[in]  pSrcB points to second the input matrix
+   @param[in]  M     Height of first matrix
+   @param[in]  N     Width of first and heigt of second matrix
+   @param[in]  O     Width of second matrix
+   @param[in]  shift Amount to shift the result of each multiplication.
+   @param[in]  nPE   Number of cores to use (or PLP_NPE_AUTO)
+   @param[out] pDstC Output is written here
+   @return     none
 
-  @par Fix-Point
-  Fix-Point and Shifting
-  The result will be shifted by the parameter `shift` to the right (which corresponds to a
-  multiplication by `2^-shift`). Assume that matrix A is represente as `pSrcA * 2^-x` and matrix B
-  as `pSrcB * 2^-y` (which means that A has `x`, and B has `y` bits after the binary point). Then,
-  the output matrix C is represented as `pDstC * 2^-(x + y - shift)`.
-  The output matrix is also stored with the same number of bits as the inputs. Set the
-  `shift` parameter such that no overflow occurrs.
-*/
+   @par Fix-Point and Shifting
+   The result will be shifted by the parameter `shift` to the right (multiplied
+   by 2^-shift). Assume that matrix A is represented as pSrcA * 2^-x, and matrix
+   B as pSrcB * 2^-y (in other words, A has it's x last digits after the binary
+   point). Then, the output is represented as pDstC * 2^-(x + y - shift).
 
-void plp_mat_mult_cmplx_q32s_rv32im(const int32_t *__restrict__ pSrcA,
-                                    const int32_t *__restrict__ pSrcB,
-                                    uint32_t M,
-                                    uint32_t N,
-                                    uint32_t O,
-                                    uint32_t shift,
-                                    int32_t *__restrict__ pDstC);
+   The output of the matrix multiplication will also be stored as an 16-bit array.
+   Set the `shift` parameter such that no overflow ocurrs.
+ */
+
+void plp_mat_mult_q16_parallel(const int16_t *__restrict__ pSrcA,
+                               const int16_t *__restrict__ pSrcB,
+                               uint32_t M,
+                               uint32_t N,
+                               uint32_t O,
+                               uint32_t shift,
+                               uint32_t nPE,
+                               int16_t *__restrict__ pDstC);
 
 /** -------------------------------------------------------
-  @brief      Matrix matrix multiplication for complex 32-bit fix-point on XpulpV2
-  @param[in]  pSrcA Points to the first input matrix of shape MxN
-  @param[in]  pSrcB Points to the second input matrix of shape NxO
-  @param[in]  M     Height of matrix SrcA and DstC
-  @param[in]  N     Width of matrix SrcA and height of matrix SrcB
-  @param[in]  O     Width of matrix SrcB and DstC
-  @param[in]  shift Amount to shift the result of each multiplication ot the right
-  @param[out] pDstC Points to the output matrix of shape MxO
-  @return     none
+   @brief      Matrix matrix multiplication of a 16-bit fix-point matrices for RV32IM extension.
+   @param[in]  pSrcA points to first the input matrix
+   @param[in]  pSrcB points to second the input matrix
+   @param[in]  M     Height of first matrix
+   @param[in]  N     Width of first and heigt of second matrix
+   @param[in]  O     Width of second matrix
+   @param[in]  shift Amount to shift the result of each multiplication.
+   @param[out] pDstC Output is written here
+   @return     none
 
-  @par Fix-Point
-  Fix-Point and Shifting
-  The result will be shifted by the parameter `shift` to the right (which corresponds to a
-  multiplication by `2^-shift`). Assume that matrix A is represente as `pSrcA * 2^-x` and matrix B
-  as `pSrcB * 2^-y` (which means that A has `x`, and B has `y` bits after the binary point). Then,
-  the output matrix C is represented as `pDstC * 2^-(x + y - shift)`.
-  The output matrix is also stored with the same number of bits as the inputs. Set the
-  `shift` parameter such that no overflow occurrs.
+   @par Fix-Point and Shifting
+   The result will be shifted by the parameter `shift` to the right (multiplied
+   by 2^-shift). Assume that matrix A is represented as pSrcA * 2^-x, and matrix
+   B as pSrcB * 2^-y (in other words, A has it's x last digits after the binary
+   point). Then, the output is represented as pDstC * 2^-(x + y - shift).
+
+   The output of the matrix multiplication will also be stored as an 16-bit array.
+   Set the `shift` parameter such that no overflow ocurrs.
 */
 
-void plp_mat_mult_cmplx_q32s_xpulpv2(const int32_t *__restrict__ pSrcA,
-                                     const int32_t *__restrict__ pSrcB,
-                                     uint32_t M,
-                                     uint32_t N,
-                                     uint32_t O,
-                                     uint32_t shift,
-                                     int32_t *__restrict__ pDstC);
+void plp_mat_mult_q16s_rv32im(const int16_t *__restrict__ pSrcA,
+                              const int16_t *__restrict__ pSrcB,
+                              uint32_t M,
+                              uint32_t N,
+                              uint32_t O,
+                              uint32_t shift,
+                              int16_t *__restrict__ pDstC);
 
 /** -------------------------------------------------------
-  @brief      Glue code of parallel matrix matrix multiplication for complex 32-bit fix-point
-  @param[in]  pSrcA Points to the first input matrix of shape MxN
-  @param[in]  pSrcB Points to the second input matrix of shape NxO
-  @param[in]  M     Height of matrix SrcA and DstC
-  @param[in]  N     Width of matrix SrcA and height of matrix SrcB
-  @param[in]  O     Width of matrix SrcB and DstC
-  @param[in]  shift Amount to shift the result of each multiplication ot the right
-  @param[in]  nPE   Number of cores to use for computation
-  @param[out] pDstC Points to the output matrix of shape MxO
-  @return     none
+   @brief      Matrix matrix multiplication of a 16-bit fix-point matrices for XPULPV2 extension.
+   @param[in]  pSrcA points to first the input matrix
+   @param[in]  pSrcB points to second the input matrix
+   @param[in]  M     Height of first matrix
+   @param[in]  N     Width of first and heigt of second matrix
+   @param[in]  O     Width of second matrix
+   @param[in]  shift Amount to shift the result of each multiplication.
+   @param[out] pDstC Output is written here
+   @return     none
 
-  @par Fix-Point
-  Fix-Point and Shifting
-  The result will be shifted by the parameter `shift` to the right (which corresponds to a
-  multiplication by `2^-shift`). Assume that matrix A is represente as `pSrcA * 2^-x` and matrix B
-  as `pSrcB * 2^-y` (which means that A has `x`, and B has `y` bits after the binary point). Then,
-  the output matrix C is represented as `pDstC * 2^-(x + y - shift)`.
-  The output matrix is also stored with the same number of bits as the inputs. Set the
-  `shift` parameter such that no overflow occurrs.
+   @par Fix-Point and Shifting
+   The result will be shifted by the parameter `shift` to the right (multiplied
+   by 2^-shift). Assume that matrix A is represented as pSrcA * 2^-x, and matrix
+   B as pSrcB * 2^-y (in other words, A has it's x last digits after the binary
+   point). Then, the output is represented as pDstC * 2^-(x + y - shift).
+
+   The output of the matrix multiplication will also be stored as an 16-bit array.
+   Set the `shift` parameter such that no overflow ocurrs.
 */
 
-void plp_mat_mult_cmplx_q32_parallel(const int32_t *__restrict__ pSrcA,
-                                     const int32_t *__restrict__ pSrcB,
-                                     uint32_t M,
-                                     uint32_t N,
-                                     uint32_t O,
-                                     uint32_t shift,
-                                     uint32_t nPE,
-                                     int32_t *__restrict__ pDstC);
+void plp_mat_mult_q16s_xpulpv2(const int16_t *__restrict__ pSrcA,
+                               const int16_t *__restrict__ pSrcB,
+                               uint32_t M,
+                               uint32_t N,
+                               uint32_t O,
+                               uint32_t shift,
+                               int16_t *__restrict__ pDstC);
 
 /** -------------------------------------------------------
-  @brief      parallel matrix matrix multiplication for complex 32-bit fix-point on XpulpV2
-  @param[in]  args  pointer to plp_mat_mult_cmplx_instance_q32 struct initialized by
-                    plp_mat_mult_cmplx_q32_parallel
-  @return     none
-
-  @par Fix-Point
-  Fix-Point and Shifting
-  The result will be shifted by the parameter `shift` to the right (which corresponds to a
-  multiplication by `2^-shift`). Assume that matrix A is represente as `pSrcA * 2^-x` and matrix B
-  as `pSrcB * 2^-y` (which means that A has `x`, and B has `y` bits after the binary point). Then,
-  the output matrix C is represented as `pDstC * 2^-(x + y - shift)`.
-  The output matrix is also stored with the same number of bits as the inputs. Set the
-  `shift` parameter such that no overflow occurrs.
+    @brief Parallel matrix multiplication of 16-bit fix-point matrices kernel for XPULPV2 extension.
+    @param[in]  args  pointer to plp_mat_mult_instance_q16 struct initialized by
+                      plp_mat_mult_q16_parallel
+    @return     none
 */
 
-void plp_mat_mult_cmplx_q32p_xpulpv2(void *args);
+void plp_mat_mult_q16p_xpulpv2(void *args);
 
 /** -------------------------------------------------------
-  @brief      Glue code of matrix matrix multiplication for complex 16-bit fix-point
-  @param[in]  pSrcA Points to the first input matrix of shape MxN
-  @param[in]  pSrcB Points to the second input matrix of shape NxO
-  @param[in]  M     Height of matrix SrcA and DstC
-  @param[in]  N     Width of matrix SrcA and height of matrix SrcB
-  @param[in]  O     Width of matrix SrcB and DstC
-  @param[in]  shift Amount to shift the result of each multiplication ot the right
-  @param[out] pDstC Points to the output matrix of shape MxO
-  @return     none
+   @brief      Glue code for matrix matrix multiplication of a 8-bit fix-point matrices.
+   @param[in]  pSrcA points to first the input matrix
+   @param[in]  pSrcB points to second the input matrix
+   @param[in]  M     Height of first matrix
+   @param[in]  N     Width of first and heigt of second matrix
+   @param[in]  O     Width of second matrix
+   @param[in]  shift Amount to shift the result of each multiplication.
+   @param[out] pDstC Output is written here
+   @return     none
 
-  @par Fix-Point
-  Fix-Point and Shifting
-  The result will be shifted by the parameter `shift` to the right (which corresponds to a
-  multiplication by `2^-shift`). Assume that matrix A is represente as `pSrcA * 2^-x` and matrix B
-  as `pSrcB * 2^-y` (which means that A has `x`, and B has `y` bits after the binary point). Then,
-  the output matrix C is represented as `pDstC * 2^-(x + y - shift)`.
-  The output matrix is also stored with the same number of bits as the inputs. Set the
-  `shift` parameter such that no overflow occurrs.
-*/
+   @par Fix-Point and Shifting
+   The result will be shifted by the parameter `shift` to the right (multiplied
+   by 2^-shift). Assume that matrix A is represented as pSrcA * 2^-x, and matrix
+   B as pSrcB * 2^-y (in other words, A has it's x last digits after the binary
+   point). Then, the output is represented as pDstC * 2^-(x + y - shift).
 
-void plp_mat_mult_cmplx_q16(const int16_t *__restrict__ pSrcA,
-                            const int16_t *__restrict__ pSrcB,
-                            uint32_t M,
-                            uint32_t N,
-                            uint32_t O,
-                            uint32_t shift,
-                            int16_t *__restrict__ pDstC);
+   The output of the matrix multiplication will also be stored as an 8-bit array.
+   Set the `shift` parameter such that no overflow ocurrs.
+ */
+
+void plp_mat_mult_q8(const int8_t *__restrict__ pSrcA,
+                     const int8_t *__restrict__ pSrcB,
+                     uint32_t M,
+                     uint32_t N,
+                     uint32_t O,
+                     uint32_t shift,
+                     int8_t *__restrict__ pDstC);
 
 /** -------------------------------------------------------
-  @brief      Matrix matrix multiplication for complex 16-bit fix-point on RV32IM
-  @param[in]  pSrcA Points to the first input matrix of shape MxN
-  @param[in]  pSrcB Points to the second input matrix of shape NxO
-  @param[in]  M     Height of matrix SrcA and DstC
-  @param[in]  N     Width of matrix SrcA and height of matrix SrcB
-  @param[in]  O     Width of matrix SrcB and DstC
-  @param[in]  shift Amount to shift the result of each multiplication ot the right
-  @param[out] pDstC Points to the output matrix of shape MxO
-  @return     none
+   @brief      Glue code for parallel matrix matrix multiplication of a 8-bit fix-point matrices.
+   @param[in]  pSrcA points to first the input matrix
+   @param[in]  pSrcB points to second the input matrix
+   @param[in]  M     Height of first matrix
+   @param[in]  N     Width of first and heigt of second matrix
+   @param[in]  O     Width of second matrix
+   @param[in]  shift Amount to shift the result of each multiplication.
+   @param[in]  nPE   Number of cores to use (or PLP_NPE_AUTO)
+   @param[out] pDstC Output is written here
+   @return     none
 
-  @par Fix-Point
-  Fix-Point and Shifting
-  The result will be shifted by the parameter `shift` to the right (which corresponds to a
-  multiplication by `2^-shift`). Assume that matrix A is represente as `pSrcA * 2^-x` and matrix B
-  as `pSrcB * 2^-y` (which means that A has `x`, and B has `y` bits after the binary point). Then,
-  the output matrix C is represented as `pDstC * 2^-(x + y - shift)`.
-  The output matrix is also stored with the same number of bits as the inputs. Set the
-  `shift` parameter such that no overflow occurrs.
-*/
+   @par Fix-Point and Shifting
+   The result will be shifted by the parameter `shift` to the right (multiplied
+   by 2^-shift). Assume that matrix A is represented as pSrcA * 2^-x, and matrix
+   B as pSrcB * 2^-y (in other words, A has it's x last digits after the binary
+   point). Then, the output is represented as pDstC * 2^-(x + y - shift).
 
-void plp_mat_mult_cmplx_q16s_rv32im(const int16_t *__restrict__ pSrcA,
-                                    const int16_t *__restrict__ pSrcB,
-                                    uint32_t M,
-                                    uint32_t N,
-                                    uint32_t O,
-                                    uint32_t shift,
-                                    int16_t *__restrict__ pDstC);
+   The output of the matrix multiplication will also be stored as an 8-bit array.
+   Set the `shift` parameter such that no overflow ocurrs.
+ */
+
+void plp_mat_mult_q8_parallel(const int8_t *__restrict__ pSrcA,
+                              const int8_t *__restrict__ pSrcB,
+                              uint32_t M,
+                              uint32_t N,
+                              uint32_t O,
+                              uint32_t shift,
+                              uint32_t nPE,
+                              int8_t *__restrict__ pDstC);
 
 /** -------------------------------------------------------
-  @brief      Matrix matrix multiplication for complex 16-bit fix-point on XpulpV2
-  @param[in]  pSrcA Points to the first input matrix of shape MxN
-  @param[in]  pSrcB Points to the second input matrix of shape NxO
-  @param[in]  M     Height of matrix SrcA and DstC
-  @param[in]  N     Width of matrix SrcA and height of matrix SrcB
-  @param[in]  O     Width of matrix SrcB and DstC
-  @param[in]  shift Amount to shift the result of each multiplication ot the right
-  @param[out] pDstC Points to the output matrix of shape MxO
-  @return     none
+   @brief      Matrix matrix multiplication of a 8-bit fix-point matrices for RV32IM extension.
+   @param[in]  pSrcA points to first the input matrix
+   @param[in]  pSrcB points to second the input matrix
+   @param[in]  M     Height of first matrix
+   @param[in]  N     Width of first and heigt of second matrix
+   @param[in]  O     Width of second matrix
+   @param[in]  shift Amount to shift the result of each multiplication.
+   @param[out] pDstC Output is written here
+   @return     none
 
-  @par Fix-Point
-  Fix-Point and Shifting
-  The result will be shifted by the parameter `shift` to the right (which corresponds to a
-  multiplication by `2^-shift`). Assume that matrix A is represente as `pSrcA * 2^-x` and matrix B
-  as `pSrcB * 2^-y` (which means that A has `x`, and B has `y` bits after the binary point). Then,
-  the output matrix C is represented as `pDstC * 2^-(x + y - shift)`.
-  The output matrix is also stored with the same number of bits as the inputs. Set the
-  `shift` parameter such that no overflow occurrs.
+   @par Fix-Point and Shifting
+   The result will be shifted by the parameter `shift` to the right (multiplied
+   by 2^-shift). Assume that matrix A is represented as pSrcA * 2^-x, and matrix
+   B as pSrcB * 2^-y (in other words, A has it's x last digits after the binary
+   point). Then, the output is represented as pDstC * 2^-(x + y - shift).
 
-  @par Exploiting SIMD instructions
-  The 16 bit values are packed two each into 32 bit vectors and then the two dot products are
-  performed on 32 bit vectors, with 32 bit accumulator.
+   The output of the matrix multiplication will also be stored as an 8-bit array.
+   Set the `shift` parameter such that no overflow ocurrs.
 */
 
-void plp_mat_mult_cmplx_q16s_xpulpv2(const int16_t *__restrict__ pSrcA,
-                                     const int16_t *__restrict__ pSrcB,
-                                     uint32_t M,
-                                     uint32_t N,
-                                     uint32_t O,
-                                     uint32_t shift,
-                                     int16_t *__restrict__ pDstC);
+void plp_mat_mult_q8s_rv32im(const int8_t *__restrict__ pSrcA,
+                             const int8_t *__restrict__ pSrcB,
+                             uint32_t M,
+                             uint32_t N,
+                             uint32_t O,
+                             uint32_t shift,
+                             int8_t *__restrict__ pDstC);
 
 /** -------------------------------------------------------
-  @brief      Glue code of parallel matrix matrix multiplication for complex 16-bit fix-point
-  @param[in]  pSrcA Points to the first input matrix of shape MxN
-  @param[in]  pSrcB Points to the second input matrix of shape NxO
-  @param[in]  M     Height of matrix SrcA and DstC
-  @param[in]  N     Width of matrix SrcA and height of matrix SrcB
-  @param[in]  O     Width of matrix SrcB and DstC
-  @param[in]  shift Amount to shift the result of each multiplication ot the right
-  @param[in]  nPE   Number of cores to use for computation
-  @param[out] pDstC Points to the output matrix of shape MxO
-  @return     none
+   @brief      Matrix matrix multiplication of a 8-bit fix-point matrices for XPULPV2 extension.
+   @param[in]  pSrcA points to first the input matrix
+   @param[in]  pSrcB points to second the input matrix
+   @param[in]  M     Height of first matrix
+   @param[in]  N     Width of first and heigt of second matrix
+   @param[in]  O     Width of second matrix
+   @param[in]  shift Amount to shift the result of each multiplication.
+   @param[out] pDstC Output is written here
+   @return     none
 
-  @par Fix-Point
-  Fix-Point and Shifting
-  The result will be shifted by the parameter `shift` to the right (which corresponds to a
-  multiplication by `2^-shift`). Assume that matrix A is represente as `pSrcA * 2^-x` and matrix B
-  as `pSrcB * 2^-y` (which means that A has `x`, and B has `y` bits after the binary point). Then,
-  the output matrix C is represented as `pDstC * 2^-(x + y - shift)`.
-  The output matrix is also stored with the same number of bits as the inputs. Set the
-  `shift` parameter such that no overflow occurrs.
+   @par Fix-Point and Shifting
+   The result will be shifted by the parameter `shift` to the right (multiplied
+   by 2^-shift). Assume that matrix A is represented as pSrcA * 2^-x, and matrix
+   B as pSrcB * 2^-y (in other words, A has it's x last digits after the binary
+   point). Then, the output is represented as pDstC * 2^-(x + y - shift).
+
+   The output of the matrix multiplication will also be stored as an 8-bit array.
+   Set the `shift` parameter such that no overflow ocurrs.
 */
 
-void plp_mat_mult_cmplx_q16_parallel(const int16_t *__restrict__ pSrcA,
-                                     const int16_t *__restrict__ pSrcB,
-                                     uint32_t M,
-                                     uint32_t N,
-                                     uint32_t O,
-                                     uint32_t shift,
-                                     uint32_t nPE,
-                                     int16_t *__restrict__ pDstC);
+void plp_mat_mult_q8s_xpulpv2(const int8_t *__restrict__ pSrcA,
+                              const int8_t *__restrict__ pSrcB,
+                              uint32_t M,
+                              uint32_t N,
+                              uint32_t O,
+                              uint32_t shift,
+                              int8_t *__restrict__ pDstC);
 
 /** -------------------------------------------------------
-  @brief      parallel matrix matrix multiplication for complex 16-bit fix-point on XpulpV2
-  @param[in]  args  pointer to plp_mat_mult_cmplx_instance_q16 struct initialized by
-                    plp_mat_mult_cmplx_q16_parallel
-  @return     none
+    @brief Parallel matrix multiplication of 8-bit fix-point matrices kernel for XPULPV2 extension.
+    @param[in]  args  pointer to plp_mat_mult_instance_q8 struct initialized by
+                      plp_mat_mult_q8_parallel
+    @return     none
+*/
 
-  @par Fix-Point
-  Fix-Point and Shifting
-  The result will be shifted by the parameter `shift` to the right (which corresponds to a
-  multiplication by `2^-shift`). Assume that matrix A is represente as `pSrcA * 2^-x` and matrix B
-  as `pSrcB * 2^-y` (which means that A has `x`, and B has `y` bits after the binary point). Then,
-  the output matrix C is represented as `pDstC * 2^-(x + y - shift)`.
-  The output matrix is also stored with the same number of bits as the inputs. Set the
-  `shift` parameter such that no overflow occurrs.
+void plp_mat_mult_q8p_xpulpv2(void *args);
 
-  @par Exploiting SIMD instructions
-  The 16 bit values are packed two each into 32 bit vectors and then the two dot products are
-  performed on 32 bit vectors, with 32 bit accumulator.
+/** -------------------------------------------------------
+   @brief      Number of elements of the 8-bit matrix B of size NxO, packed by plp_mat_pack_b_i8
+               or plp_mat_pack_b_q8.
 */
 
-void plp_mat_mult_cmplx_q16p_xpulpv2(void *args);
+#define PLP_MAT_PACK_B_I8_SIZE(N, O) (16 * (((N) + 3) / 4) * (((O) + 3) / 4))
 
 /** -------------------------------------------------------
-  @brief      Glue code of matrix matrix multiplication for complex 8-bit fix-point
-  @param[in]  pSrcA Points to the first input matrix of shape MxN
-  @param[in]  pSrcB Points to the second input matrix of shape NxO
-  @param[in]  M     Height of matrix SrcA and DstC
-  @param[in]  N     Width of matrix SrcA and height of matrix SrcB
-  @param[in]  O     Width of matrix SrcB and DstC
-  @param[in]  shift Amount to shift the result of each multiplication ot the right
-  @param[out] pDstC Points to the output matrix of shape MxO
-  @return     none
-
-  @par Fix-Point
-  Fix-Point and Shifting
-  The result will be shifted by the parameter `shift` to the right (which corresponds to a
-  multiplication by `2^-shift`). Assume that matrix A is represente as `pSrcA * 2^-x` and matrix B
-  as `pSrcB * 2^-y` (which means that A has `x`, and B has `y` bits after the binary point). Then,
-  the output matrix C is represented as `pDstC * 2^-(x + y - shift)`.
-  The output matrix is also stored with the same number of bits as the inputs. Set the
-  `shift` parameter such that no overflow occurrs.
+   @brief      Number of elements of the 16-bit matrix B of size NxO, packed by plp_mat_pack_b_i16
+               or plp_mat_pack_b_q16.
 */
 
-void plp_mat_mult_cmplx_q8(const int8_t *__restrict__ pSrcA,
-                           const int8_t *__restrict__ pSrcB,
-                           uint32_t M,
-                           uint32_t N,
-                           uint32_t O,
-                           uint32_t shift,
-                           int8_t *__restrict__ pDstC);
+#define PLP_MAT_PACK_B_I16_SIZE(N, O) (4 * (((N) + 1) / 2) * (((O) + 1) / 2))
 
 /** -------------------------------------------------------
-  @brief      Matrix matrix multiplication for complex 8-bit fix-point on RV32IM
-  @param[in]  pSrcA Points to the first input matrix of shape MxN
-  @param[in]  pSrcB Points to the second input matrix of shape NxO
-  @param[in]  M     Height of matrix SrcA and DstC
-  @param[in]  N     Width of matrix SrcA and height of matrix SrcB
-  @param[in]  O     Width of matrix SrcB and DstC
-  @param[in]  shift Amount to shift the result of each multiplication ot the right
-  @param[out] pDstC Points to the output matrix of shape MxO
-  @return     none
-
-  @par Fix-Point
-  Fix-Point and Shifting
-  The result will be shifted by the parameter `shift` to the right (which corresponds to a
-  multiplication by `2^-shift`). Assume that matrix A is represente as `pSrcA * 2^-x` and matrix B
-  as `pSrcB * 2^-y` (which means that A has `x`, and B has `y` bits after the binary point). Then,
-  the output matrix C is represented as `pDstC * 2^-(x + y - shift)`.
-  The output matrix is also stored with the same number of bits as the inputs. Set the
-  `shift` parameter such that no overflow occurrs.
+   @brief      Packs the 8-bit integer matrix B for plp_mat_mult_packed_i8.
+   @param[in]  pSrcB    points to the matrix B of size NxO
+   @param[in]  N        height of the matrix B
+   @param[in]  O        width of the matrix B
+   @param[out] pPackedB points to the packed matrix, of size PLP_MAT_PACK_B_I8_SIZE(N, O)
+   @return     none
 */
 
-void plp_mat_mult_cmplx_q8s_rv32im(const int8_t *__restrict__ pSrcA,
-                                   const int8_t *__restrict__ pSrcB,
-                                   uint32_t M,
-                                   uint32_t N,
-                                   uint32_t O,
-                                   uint32_t shift,
-                                   int8_t *__restrict__ pDstC);
+void plp_mat_pack_b_i8(const int8_t *__restrict__ pSrcB,
+                       uint32_t N,
+                       uint32_t O,
+                       int8_t *__restrict__ pPackedB);
 
 /** -------------------------------------------------------
-  @brief      Matrix matrix multiplication for complex 8-bit fix-point on XpulpV2
-  @param[in]  pSrcA Points to the first input matrix of shape MxN
-  @param[in]  pSrcB Points to the second input matrix of shape NxO
-  @param[in]  M     Height of matrix SrcA and DstC
-  @param[in]  N     Width of matrix SrcA and height of matrix SrcB
-  @param[in]  O     Width of matrix SrcB and DstC
-  @param[in]  shift Amount to shift the result of each multiplication ot the right
-  @param[out] pDstC Points to the output matrix of shape MxO
-  @return     none
+   @brief      Glue code of matrix matrix multiplication of 8-bit integer matrices with packed B.
+   @param[in]  pSrcA    points to the first input matrix
+   @param[in]  pPackedB points to the second input matrix, packed by plp_mat_pack_b_i8
+   @param[in]  M        Height of first matrix
+   @param[in]  N        Width of first and heigt of second matrix
+   @param[in]  O        Width of second matrix
+   @param[out] pDstC    Output is written here
+   @return     none
+*/
 
-  @par Fix-Point
-  Fix-Point and Shifting
-  The result will be shifted by the parameter `shift` to the right (which corresponds to a
-  multiplication by `2^-shift`). Assume that matrix A is represente as `pSrcA * 2^-x` and matrix B
-  as `pSrcB * 2^-y` (which means that A has `x`, and B has `y` bits after the binary point). Then,
-  the output matrix C is represented as `pDstC * 2^-(x + y - shift)`.
-  The output matrix is also stored with the same number of bits as the inputs. Set the
-  `shift` parameter such that no overflow occurrs.
+void plp_mat_mult_packed_i8(const int8_t *__restrict__ pSrcA,
+                            const int8_t *__restrict__ pPackedB,
+                            uint32_t M,
+                            uint32_t N,
+                            uint32_t O,
+                            int32_t *__restrict__ pDstC);
 
-  @par Exploiting SIMD instructions
-  The 8 bit values are packed four each into 32 bit vectors and then the four dot products are
-  performed on 32 bit vectors, with 32 bit accumulator.
+/** -------------------------------------------------------
+   @brief      Glue code of parallel matrix matrix multiplication of 8-bit integer matrices with
+               packed B.
+   @param[in]  pSrcA    points to the first input matrix
+   @param[in]  pPackedB points to the second input matrix, packed by plp_mat_pack_b_i8
+   @param[in]  M        Height of first matrix
+   @param[in]  N        Width of first and heigt of second matrix
+   @param[in]  O        Width of second matrix
+   @param[in]  nPE      Number of cores to use (or PLP_NPE_AUTO)
+   @param[out] pDstC    Output is written here
+   @return     none
 */
 
-void plp_mat_mult_cmplx_q8s_xpulpv2(const int8_t *__restrict__ pSrcA,
-                                    const int8_t *__restrict__ pSrcB,
-                                    uint32_t M,
-                                    uint32_t N,
-                                    uint32_t O,
-                                    uint32_t shift,
-                                    int8_t *__restrict__ pDstC);
+void plp_mat_mult_packed_i8_parallel(const int8_t *__restrict__ pSrcA,
+                                     const int8_t *__restrict__ pPackedB,
+                                     uint32_t M,
+                                     uint32_t N,
+                                     uint32_t O,
+                                     uint32_t nPE,
+                                     int32_t *__restrict__ pDstC);
 
 /** -------------------------------------------------------
-  @brief      Glue code of parallel matrix matrix multiplication for complex 8-bit fix-point
-  @param[in]  pSrcA Points to the first input matrix of shape MxN
-  @param[in]  pSrcB Points to the second input matrix of shape NxO
-  @param[in]  M     Height of matrix SrcA and DstC
-  @param[in]  N     Width of matrix SrcA and height of matrix SrcB
-  @param[in]  O     Width of matrix SrcB and DstC
-  @param[in]  shift Amount to shift the result of each multiplication ot the right
-  @param[in]  nPE   Number of cores to use for computation
-  @param[out] pDstC Points to the output matrix of shape MxO
-  @return     none
-
-  @par Fix-Point
-  Fix-Point and Shifting
-  The result will be shifted by the parameter `shift` to the right (which corresponds to a
-  multiplication by `2^-shift`). Assume that matrix A is represente as `pSrcA * 2^-x` and matrix B
-  as `pSrcB * 2^-y` (which means that A has `x`, and B has `y` bits after the binary point). Then,
-  the output matrix C is represented as `pDstC * 2^-(x + y - shift)`.
-  The output matrix is also stored with the same number of bits as the inputs. Set the
-  `shift` parameter such that no overflow occurrs.
+   @brief      Matrix matrix multiplication of 8-bit integer matrices with packed B for RV32IM
+               extension.
+   @param[in]  pSrcA    points to the first input matrix
+   @param[in]  pPackedB points to the second input matrix, packed by plp_mat_pack_b_i8
+   @param[in]  M        Height of first matrix
+   @param[in]  N        Width of first and heigt of second matrix
+   @param[in]  O        Width of second matrix
+   @param[out] pDstC    Output is written here
+   @return     none
 */
 
-void plp_mat_mult_cmplx_q8_parallel(const int8_t *__restrict__ pSrcA,
-                                    const int8_t *__restrict__ pSrcB,
+void plp_mat_mult_packed_i8s_rv32im(const int8_t *__restrict__ pSrcA,
+                                    const int8_t *__restrict__ pPackedB,
                                     uint32_t M,
                                     uint32_t N,
                                     uint32_t O,
-                                    uint32_t shift,
-                                    uint32_t nPE,
-                                    int8_t *__restrict__ pDstC);
-
-/** -------------------------------------------------------
-  @brief      parallel matrix matrix multiplication for complex 8-bit fix-point on XpulpV2
-  @param[in]  args  pointer to plp_mat_mult_cmplx_instance_q8 struct initialized by
-                    plp_mat_mult_cmplx_q8_parallel
-  @return     none
-
-  @par Fix-Point
-  Fix-Point and Shifting
-  The result will be shifted by the parameter `shift` to the right (which corresponds to a
-  multiplication by `2^-shift`). Assume that matrix A is represente as `pSrcA * 2^-x` and matrix B
-  as `pSrcB * 2^-y` (which means that A has `x`, and B has `y` bits after the binary point). Then,
-  the output matrix C is represented as `pDstC * 2^-(x + y - shift)`.
-  The output matrix is also stored with the same number of bits as the inputs. Set the
-  `shift` parameter such that no overflow occurrs.
-
-  @par Exploiting SIMD instructions
-  The 8 bit values are packed four each into 32 bit vectors and then the four dot products are
-  performed on 32 bit vectors, with 32 bit accumulator.
-*/
-
-void plp_mat_mult_cmplx_q8p_xpulpv2(void *args);
+                                    int32_t *__restrict__ pDstC);
 
 /** -------------------------------------------------------
-   @brief      Glue code for matrix transposed matrix multiplication of a 32-bit integer
-               matrices.
-   @param[in]  pSrcA points to first the input matrix
-   @param[in]  pSrcB points to second the input matrix
-   @param[in]  M     Height of first matrix
-   @param[in]  N     Width of first and heigt of second matrix
-   @param[in]  O     Width of second matrix
-   @param[out] pDstC Output is written here
+   @brief      Matrix matrix multiplication of 8-bit integer matrices with packed B for XPULPV2
+               extension.
+   @param[in]  pSrcA    points to the first input matrix
+   @param[in]  pPackedB points to the second input matrix, packed by plp_mat_pack_b_i8
+   @param[in]  M        Height of first matrix
+   @param[in]  N        Width of first and heigt of second matrix
+   @param[in]  O        Width of second matrix
+   @param[out] pDstC    Output is written here
    @return     none
 */
 
-void plp_mat_mult_trans_i32(const int32_t *__restrict__ pSrcA,
-                            const int32_t *__restrict__ pSrcB,
-                            uint32_t M,
-                            uint32_t N,
-                            uint32_t O,
-                            int32_t *__restrict__ pDstC);
+void plp_mat_mult_packed_i8s_xpulpv2(const int8_t *__restrict__ pSrcA,
+                                     const int8_t *__restrict__ pPackedB,
+                                     uint32_t M,
+                                     uint32_t N,
+                                     uint32_t O,
+                                     int32_t *__restrict__ pDstC);
 
 /** -------------------------------------------------------
-   @brief      Matrix transposed matrix multiplication of a 32-bit integer matrices for RV32IM
-               extension.
-   @param[in]  pSrcA points to first the input matrix
-   @param[in]  pSrcB points to second the input matrix
-   @param[in]  M     Height of first matrix
-   @param[in]  N     Width of first and heigt of second matrix
-   @param[in]  O     Width of second matrix
-   @param[out] pDstC Output is written here
+   @brief      Parallel matrix multiplication of 8-bit integer matrices with packed B kernel for
+               XPULPV2 extension.
+   @param[in]  args  pointer to plp_mat_mult_instance_i8 struct initialized by
+                     plp_mat_mult_packed_i8_parallel
    @return     none
 */
 
-void plp_mat_mult_trans_i32s_rv32im(const int32_t *__restrict__ pSrcA,
-                                    const int32_t *__restrict__ pSrcB,
-                                    uint32_t M,
-                                    uint32_t N,
-                                    uint32_t O,
-                                    int32_t *__restrict__ pDstC);
+void plp_mat_mult_packed_i8p_xpulpv2(void *args);
 
 /** -------------------------------------------------------
-   @brief      Matrix transposed matrix multiplication of a 32-bit integer matrices for XPULPV2
-               extension.
-   @param[in]  pSrcA points to first the input matrix
-   @param[in]  pSrcB points to second the input matrix
-   @param[in]  M     Height of first matrix
-   @param[in]  N     Width of first and heigt of second matrix
-   @param[in]  O     Width of second matrix
-   @param[out] pDstC Output is written here
+   @brief      Packs the 16-bit integer matrix B for plp_mat_mult_packed_i16.
+   @param[in]  pSrcB    points to the matrix B of size NxO
+   @param[in]  N        height of the matrix B
+   @param[in]  O        width of the matrix B
+   @param[out] pPackedB points to the packed matrix, of size PLP_MAT_PACK_B_I16_SIZE(N, O)
    @return     none
 */
 
-void plp_mat_mult_trans_i32s_xpulpv2(const int32_t *__restrict__ pSrcA,
-                                     const int32_t *__restrict__ pSrcB,
-                                     uint32_t M,
-                                     uint32_t N,
-                                     uint32_t O,
-                                     int32_t *__restrict__ pDstC);
+void plp_mat_pack_b_i16(const int16_t *__restrict__ pSrcB,
+                        uint32_t N,
+                        uint32_t O,
+                        int16_t *__restrict__ pPackedB);
 
 /** -------------------------------------------------------
-   @brief      Glue code for matrix transposed matrix multiplication of a 16-bit integer
-               matrices.
-   @param[in]  pSrcA points to first the input matrix
-   @param[in]  pSrcB points to second the input matrix
-   @param[in]  M     Height of first matrix
-   @param[in]  N     Width of first and heigt of second matrix
-   @param[in]  O     Width of second matrix
-   @param[out] pDstC Output is written here
+   @brief      Glue code of matrix matrix multiplication of 16-bit integer matrices with packed B.
+   @param[in]  pSrcA    points to the first input matrix
+   @param[in]  pPackedB points to the second input matrix, packed by plp_mat_pack_b_i16
+   @param[in]  M        Height of first matrix
+   @param[in]  N        Width of first and heigt of second matrix
+   @param[in]  O        Width of second matrix
+   @param[out] pDstC    Output is written here
    @return     none
 */
 
-void plp_mat_mult_trans_i16(const int16_t *__restrict__ pSrcA,
-                            const int16_t *__restrict__ pSrcB,
-                            uint32_t M,
-                            uint32_t N,
-                            uint32_t O,
-                            int32_t *__restrict__ pDstC);
+void plp_mat_mult_packed_i16(const int16_t *__restrict__ pSrcA,
+                             const int16_t *__restrict__ pPackedB,
+                             uint32_t M,
+                             uint32_t N,
+                             uint32_t O,
+                             int32_t *__restrict__ pDstC);
 
 /** -------------------------------------------------------
-   @brief      Matrix transposed matrix multiplication of a 16-bit integer matrices for RV32IM
-               extension.
-   @param[in]  pSrcA points to first the input matrix
-   @param[in]  pSrcB points to second the input matrix
-   @param[in]  M     Height of first matrix
-   @param[in]  N     Width of first and heigt of second matrix
-   @param[in]  O     Width of second matrix
-   @param[out] pDstC Output is written here
+   @brief      Glue code of parallel matrix matrix multiplication of 16-bit integer matrices with
+               packed B.
+   @param[in]  pSrcA    points to the first input matrix
+   @param[in]  pPackedB points to the second input matrix, packed by plp_mat_pack_b_i16
+   @param[in]  M        Height of first matrix
+   @param[in]  N        Width of first and heigt of second matrix
+   @param[in]  O        Width of second matrix
+   @param[in]  nPE      Number of cores to use (or PLP_NPE_AUTO)
+   @param[out] pDstC    Output is written here
    @return     none
 */
 
-void plp_mat_mult_trans_i16s_rv32im(const int16_t *__restrict__ pSrcA,
-                                    const int16_t *__restrict__ pSrcB,
-                                    uint32_t M,
-                                    uint32_t N,
-                                    uint32_t O,
-                                    int32_t *__restrict__ pDstC);
+void plp_mat_mult_packed_i16_parallel(const int16_t *__restrict__ pSrcA,
+                                      const int16_t *__restrict__ pPackedB,
+                                      uint32_t M,
+                                      uint32_t N,
+                                      uint32_t O,
+                                      uint32_t nPE,
+                                      int32_t *__restrict__ pDstC);
 
 /** -------------------------------------------------------
-   @brief      Matrix transposed matrix multiplication of a 16-bit integer matrices for XPULPV2
+   @brief      Matrix matrix multiplication of 16-bit integer matrices with packed B for RV32IM
                extension.
-   @param[in]  pSrcA points to first the input matrix
-   @param[in]  pSrcB points to second the input matrix
-   @param[in]  M     Height of first matrix
-   @param[in]  N     Width of first and heigt of second matrix
-   @param[in]  O     Width of second matrix
-   @param[out] pDstC Output is written here
+   @param[in]  pSrcA    points to the first input matrix
+   @param[in]  pPackedB points to the second input matrix, packed by plp_mat_pack_b_i16
+   @param[in]  M        Height of first matrix
+   @param[in]  N        Width of first and heigt of second matrix
+   @param[in]  O        Width of second matrix
+   @param[out] pDstC    Output is written here
    @return     none
-
-   @par Exploiting SIMD instructions
-   The 16 bit values are packed two each into 32 bit vectors and then the two dot products are
-   performed on 32 bit vectors, with 32 bit accumulator.
 */
 
-void plp_mat_mult_trans_i16s_xpulpv2(const int16_t *__restrict__ pSrcA,
-                                     const int16_t *__restrict__ pSrcB,
+void plp_mat_mult_packed_i16s_rv32im(const int16_t *__restrict__ pSrcA,
+                                     const int16_t *__restrict__ pPackedB,
                                      uint32_t M,
                                      uint32_t N,
                                      uint32_t O,
                                      int32_t *__restrict__ pDstC);
 
 /** -------------------------------------------------------
-   @brief      Glue code for matrix transposed matrix multiplication of a 8-bit integer matrices.
-   @param[in]  pSrcA points to first the input matrix
-   @param[in]  pSrcB points to second the input matrix
-   @param[in]  M     Height of first matrix
-   @param[in]  N     Width of first and heigt of second matrix
-   @param[in]  O     Width of second matrix
-   @param[out] pDstC Output is written here
+   @brief      Matrix matrix multiplication of 16-bit integer matrices with packed B for XPULPV2
+               extension.
+   @param[in]  pSrcA    points to the first input matrix
+   @param[in]  pPackedB points to the second input matrix, packed by plp_mat_pack_b_i16
+   @param[in]  M        Height of first matrix
+   @param[in]  N        Width of first and heigt of second matrix
+   @param[in]  O        Width of second matrix
+   @param[out] pDstC    Output is written here
    @return     none
 */
 
-void plp_mat_mult_trans_i8(const int8_t *__restrict__ pSrcA,
-                           const int8_t *__restrict__ pSrcB,
-                           uint32_t M,
-                           uint32_t N,
-                           uint32_t O,
-                           int32_t *__restrict__ pDstC);
+void plp_mat_mult_packed_i16s_xpulpv2(const int16_t *__restrict__ pSrcA,
+                                      const int16_t *__restrict__ pPackedB,
+                                      uint32_t M,
+                                      uint32_t N,
+                                      uint32_t O,
+                                      int32_t *__restrict__ pDstC);
 
 /** -------------------------------------------------------
-   @brief      Matrix transposed matrix multiplication of a 8-bit integer matrices for RV32IM
-   extension.
-   @param[in]  pSrcA points to first the input matrix
-   @param[in]  pSrcB points to second the input matrix
-   @param[in]  M     Height of first matrix
-   @param[in]  N     Width of first and heigt of second matrix
-   @param[in]  O     Width of second matrix
-   @param[out] pDstC Output is written here
+   @brief      Parallel matrix multiplication of 16-bit integer matrices with packed B kernel for
+               XPULPV2 extension.
+   @param[in]  args  pointer to plp_mat_mult_instance_i16 struct initialized by
+                     plp_mat_mult_packed_i16_parallel
    @return     none
 */
 
-void plp_mat_mult_trans_i8s_rv32im(const int8_t *__restrict__ pSrcA,
-                                   const int8_t *__restrict__ pSrcB,
-                                   uint32_t M,
-                                   uint32_t N,
-                                   uint32_t O,
-                                   int32_t *__restrict__ pDstC);
+void plp_mat_mult_packed_i16p_xpulpv2(void *args);
 
 /** -------------------------------------------------------
-   @brief      Matrix transposed matrix multiplication of a 8-bit integer matrices for XPULPV2
-   extension.
-   @param[in]  pSrcA points to first the input matrix
-   @param[in]  pSrcB points to second the input matrix
-   @param[in]  M     Height of first matrix
-   @param[in]  N     Width of first and heigt of second matrix
-   @param[in]  O     Width of second matrix
-   @param[out] pDstC Output is written here
+   @brief      Packs the 8-bit fix-point matrix B for plp_mat_mult_packed_q8.
+   @param[in]  pSrcB    points to the matrix B of size NxO
+   @param[in]  N        height of the matrix B
+   @param[in]  O        width of the matrix B
+   @param[out] pPackedB points to the packed matrix, of size PLP_MAT_PACK_B_I8_SIZE(N, O)
    @return     none
+*/
 
-   @par Exploiting SIMD instructions
-   The 8 bit values are packed four each into 32 bit vectors and then the four dot products are
-   performed on 32 bit vectors, with 32 bit accumulator.
+void plp_mat_pack_b_q8(const int8_t *__restrict__ pSrcB,
+                       uint32_t N,
+                       uint32_t O,
+                       int8_t *__restrict__ pPackedB);
+
+/** -------------------------------------------------------
+   @brief      Glue code of matrix matrix multiplication of 8-bit fix-point matrices with packed B.
+   @param[in]  pSrcA    points to the first input matrix
+   @param[in]  pPackedB points to the second input matrix, packed by plp_mat_pack_b_q8
+   @param[in]  M        Height of first matrix
+   @param[in]  N        Width of first and heigt of second matrix
+   @param[in]  O        Width of second matrix
+   @param[in]  shift    Amount to shift the result of the accumulation.
+   @param[out] pDstC    Output is written here
+   @return     none
+
+   @par Fix-Point and Shifting
+   The products are accumulated exactly in 32 bits, and the sum is rounded once
+   (in contrast to plp_mat_mult_q8, which rounds every product).
 */
 
-void plp_mat_mult_trans_i8s_xpulpv2(const int8_t *__restrict__ pSrcA,
-                                    const int8_t *__restrict__ pSrcB,
-                                    uint32_t M,
-                                    uint32_t N,
-                                    uint32_t O,
-                                    int32_t *__restrict__ pDstC);
+void plp_mat_mult_packed_q8(const int8_t *__restrict__ pSrcA,
+                            const int8_t *__restrict__ pPackedB,
+                            uint32_t M,
+                            uint32_t N,
+                            uint32_t O,
+                            uint32_t shift,
+                            int8_t *__restrict__ pDstC);
 
 /** -------------------------------------------------------
-   @brief      Glue code for parallel matrix matrix multiplication of a 32-bit integer matrices.
-   @param[in]  pSrcA points to first the input matrix
-   @param[in]  pSrcB points to second the input matrix
-   @param[in]  M     Height of first matrix
-   @param[in]  N     Width of first and heigt of second matrix
-   @param[in]  O     Width of second matrix
-   @param[in]  nPE   Number of cores to use
-   @param[out] pDstC Output is written here
+   @brief      Glue code of parallel matrix matrix multiplication of 8-bit fix-point matrices with
+               packed B.
+   @param[in]  pSrcA    points to the first input matrix
+   @param[in]  pPackedB points to the second input matrix, packed by plp_mat_pack_b_q8
+   @param[in]  M        Height of first matrix
+   @param[in]  N        Width of first and heigt of second matrix
+   @param[in]  O        Width of second matrix
+   @param[in]  shift    Amount to shift the result of the accumulation.
+   @param[in]  nPE      Number of cores to use (or PLP_NPE_AUTO)
+   @param[out] pDstC    Output is written here
    @return     none
+
+   @par Fix-Point and Shifting
+   The products are accumulated exactly in 32 bits, and the sum is rounded once
+   (in contrast to plp_mat_mult_q8, which rounds every product).
 */
 
-void plp_mat_mult_trans_i32_parallel(const int32_t *__restrict__ pSrcA,
-                                     const int32_t *__restrict__ pSrcB,
+void plp_mat_mult_packed_q8_parallel(const int8_t *__restrict__ pSrcA,
+                                     const int8_t *__restrict__ pPackedB,
                                      uint32_t M,
                                      uint32_t N,
                                      uint32_t O,
+                                     uint32_t shift,
                                      uint32_t nPE,
-                                     int32_t *__restrict__ pDstC);
+                                     int8_t *__restrict__ pDstC);
 
 /** -------------------------------------------------------
-   @brief      Parallel matrix transposed matrix multiplication of a 32-bit integer matrices for
-               RV32IM extension.
-   @param[in]  args  pointer to plp_mat_mult_instance_i32 struct initialized by
-                     plp_mat_mult_i32_parallel
+   @brief      Matrix matrix multiplication of 8-bit fix-point matrices with packed B for RV32IM
+               extension.
+   @param[in]  pSrcA    points to the first input matrix
+   @param[in]  pPackedB points to the second input matrix, packed by plp_mat_pack_b_q8
+   @param[in]  M        Height of first matrix
+   @param[in]  N        Width of first and heigt of second matrix
+   @param[in]  O        Width of second matrix
+   @param[in]  shift    Amount to shift the result of the accumulation.
+   @param[out] pDstC    Output is written here
    @return     none
 */
 
-void plp_mat_mult_trans_i32p_xpulpv2(void *args);
+void plp_mat_mult_packed_q8s_rv32im(const int8_t *__restrict__ pSrcA,
+                                    const int8_t *__restrict__ pPackedB,
+                                    uint32_t M,
+                                    uint32_t N,
+                                    uint32_t O,
+                                    uint32_t shift,
+                                    int8_t *__restrict__ pDstC);
 
 /** -------------------------------------------------------
-   @brief      Glue code for parallel matrix transposed matrix multiplication of a 16-bit integer
-               matrices.
-   @param[in]  pSrcA points to first the input matrix
-   @param[in]  pSrcB points to second the input matrix
-   @param[in]  M     Height of first matrix
-   @param[in]  N     Width of first and heigt of second matrix
-   @param[in]  O     Width of second matrix
-   @param[in]  nPE   Number of cores to use
-   @param[out] pDstC Output is written here
+   @brief      Matrix matrix multiplication of 8-bit fix-point matrices with packed B for XPULPV2
+               extension.
+   @param[in]  pSrcA    points to the first input matrix
+   @param[in]  pPackedB points to the second input matrix, packed by plp_mat_pack_b_q8
+   @param[in]  M        Height of first matrix
+   @param[in]  N        Width of first and heigt of second matrix
+   @param[in]  O        Width of second matrix
+   @param[in]  shift    Amount to shift the result of the accumulation.
+   @param[out] pDstC    Output is written here
    @return     none
 */
 
-void plp_mat_mult_trans_i16_parallel(const int16_t *__restrict__ pSrcA,
-                                     const int16_t *__restrict__ pSrcB,
+void plp_mat_mult_packed_q8s_xpulpv2(const int8_t *__restrict__ pSrcA,
+                                     const int8_t *__restrict__ pPackedB,
                                      uint32_t M,
                                      uint32_t N,
                                      uint32_t O,
-                                     uint32_t nPE,
-                                     int32_t *__restrict__ pDstC);
+                                     uint32_t shift,
+                                     int8_t *__restrict__ pDstC);
 
 /** -------------------------------------------------------
-   @brief      Parallel matrix transposed matrix multiplication of a 16-bit integer matrices for
+   @brief      Parallel matrix multiplication of 8-bit fix-point matrices with packed B kernel for
                XPULPV2 extension.
-   @param[in]  args  pointer to plp_mat_mult_instance_i16 struct initialized by
-                     plp_mat_mult_i16_parallel
+   @param[in]  args  pointer to plp_mat_mult_instance_q8 struct initialized by
+                     plp_mat_mult_packed_q8_parallel
    @return     none
-
-   @par Exploiting SIMD instructions
-   The 16 bit values are packed two each into 32 bit vectors and then the two dot products are
-   performed on 32 bit vectors, with 32 bit accumulator.
 */
 
-void plp_mat_mult_trans_i16p_xpulpv2(void *args);
+void plp_mat_mult_packed_q8p_xpulpv2(void *args);
 
 /** -------------------------------------------------------
-   @brief      Glue code for parallel matrix transposed matrix multiplication of a 8-bit integer
-               matrices.
-   @param[in]  pSrcA points to first the input matrix
-   @param[in]  pSrcB points to second the input matrix
-   @param[in]  M     Height of first matrix
-   @param[in]  N     Width of first and heigt of second matrix
-   @param[in]  O     Width of second matrix
-   @param[in]  nPE   Number of cores to use
-   @param[out] pDstC Output is written here
+   @brief      Packs the 16-bit fix-point matrix B for plp_mat_mult_packed_q16.
+   @param[in]  pSrcB    points to the matrix B of size NxO
+   @param[in]  N        height of the matrix B
+   @param[in]  O        width of the matrix B
+   @param[out] pPackedB points to the packed matrix, of size PLP_MAT_PACK_B_I16_SIZE(N, O)
    @return     none
 */
 
-void plp_mat_mult_trans_i8_parallel(const int8_t *__restrict__ pSrcA,
-                                    const int8_t *__restrict__ pSrcB,
-                                    uint32_t M,
-                                    uint32_t N,
-                                    uint32_t O,
-                                    uint32_t nPE,
-                                    int32_t *__restrict__ pDstC);
+void plp_mat_pack_b_q16(const int16_t *__restrict__ pSrcB,
+                        uint32_t N,
+                        uint32_t O,
+                        int16_t *__restrict__ pPackedB);
 
 /** -------------------------------------------------------
-   @brief      Parallel matrix transposed matrix multiplication of a 8-bit integer matrices for
-               XPULPV2 extension.
-   @param[in]  args  pointer to plp_mat_mult_instance_i8 struct initialized by
-                     plp_mat_mult_i8_parallel
+   @brief      Glue code of matrix matrix multiplication of 16-bit fix-point matrices with packed B.
+   @param[in]  pSrcA    points to the first input matrix
+   @param[in]  pPackedB points to the second input matrix, packed by plp_mat_pack_b_q16
+   @param[in]  M        Height of first matrix
+   @param[in]  N        Width of first and heigt of second matrix
+   @param[in]  O        Width of second matrix
+   @param[in]  shift    Amount to shift the result of the accumulation.
+   @param[out] pDstC    Output is written here
    @return     none
 
-   @par Exploiting SIMD instructions
-   The 8 bit values are packed four each into 32 bit vectors and then the four dot products are
-   performed on 32 bit vectors, with 32 bit accumulator.
+   @par Fix-Point and Shifting
+   The products are accumulated exactly in 32 bits, and the sum is rounded once
+   (in contrast to plp_mat_mult_q16, which rounds every product).
 */
 
-void plp_mat_mult_trans_i8p_xpulpv2(void *args);
+void plp_mat_mult_packed_q16(const int16_t *__restrict__ pSrcA,
+                             const int16_t *__restrict__ pPackedB,
+                             uint32_t M,
+                             uint32_t N,
+                             uint32_t O,
+                             uint32_t shift,
+                             int16_t *__restrict__ pDstC);
 
 /** -------------------------------------------------------
-   @brief      Glue code for matrix transposed matrix multiplication of a 32-bit fix-point
-               matrices.
-   @param[in]  pSrcA points to first the input matrix
-   @param[in]  pSrcB points to second the input matrix
-   @param[in]  M     Height of first matrix
-   @param[in]  N     Width of first and heigt of second matrix
-   @param[in]  O     Width of second matrix
-   @param[in]  shift Amount to shift the result of each multiplication.
-   @param[out] pDstC Output is written here
+   @brief      Glue code of parallel matrix matrix multiplication of 16-bit fix-point matrices with
+               packed B.
+   @param[in]  pSrcA    points to the first input matrix
+   @param[in]  pPackedB points to the second input matrix, packed by plp_mat_pack_b_q16
+   @param[in]  M        Height of first matrix
+   @param[in]  N        Width of first and heigt of second matrix
+   @param[in]  O        Width of second matrix
+   @param[in]  shift    Amount to shift the result of the accumulation.
+   @param[in]  nPE      Number of cores to use (or PLP_NPE_AUTO)
+   @param[out] pDstC    Output is written here
    @return     none
 
    @par Fix-Point and Shifting
-   The result will be shifted by the parameter `shift` to the right (multiplied
-   by 2^-shift). Assume that matrix A is represented as pSrcA * 2^-x, and matrix
-   B as pSrcB * 2^-y (in other words, A has it's x last digits after the binary
-   point). Then, the output is represented as pDstC * 2^-(x + y - shift).
- */
+   The products are accumulated exactly in 32 bits, and the sum is rounded once
+   (in contrast to plp_mat_mult_q16, which rounds every product).
+*/
 
-void plp_mat_mult_trans_q32(const int32_t *__restrict__ pSrcA,
-                            const int32_t *__restrict__ pSrcB,
-                            uint32_t M,
-                            uint32_t N,
-                            uint32_t O,
-                            uint32_t shift,
-                            int32_t *__restrict__ pDstC);
+void plp_mat_mult_packed_q16_parallel(const int16_t *__restrict__ pSrcA,
+                                      const int16_t *__restrict__ pPackedB,
+                                      uint32_t M,
+                                      uint32_t N,
+                                      uint32_t O,
+                                      uint32_t shift,
+                                      uint32_t nPE,
+                                      int16_t *__restrict__ pDstC);
 
 /** -------------------------------------------------------
-   @brief      Glue code for parallel matrix transposed matrix multiplication of a 32-bit
-               fix-point matrices.
-   @param[in]  pSrcA points to first the input matrix
-   @param[in]  pSrcB points to second the input matrix
-   @param[in]  M     Height of first matrix
-   @param[in]  N     Width of first and heigt of second matrix
-   @param[in]  O     Width of second matrix
-   @param[in]  shift Amount to shift the result of each multiplication.
-   @param[in]  nPE   Number of cores to use
-   @param[out] pDstC Output is written here
+   @brief      Matrix matrix multiplication of 16-bit fix-point matrices with packed B for RV32IM
+               extension.
+   @param[in]  pSrcA    points to the first input matrix
+   @param[in]  pPackedB points to the second input matrix, packed by plp_mat_pack_b_q16
+   @param[in]  M        Height of first matrix
+   @param[in]  N        Width of first and heigt of second matrix
+   @param[in]  O        Width of second matrix
+   @param[in]  shift    Amount to shift the result of the accumulation.
+   @param[out] pDstC    Output is written here
    @return     none
+*/
 
-   @par Fix-Point and Shifting
-   The result will be shifted by the parameter `shift` to the right (multiplied
-   by 2^-shift). Assume that matrix A is represented as pSrcA * 2^-x, and matrix
-   B as pSrcB * 2^-y (in other words, A has it's x last digits after the binary
-   point). Then, the output is represented as pDstC * 2^-(x + y - shift).
- */
-
-void plp_mat_mult_trans_q32_parallel(const int32_t *__restrict__ pSrcA,
-                                     const int32_t *__restrict__ pSrcB,
+void plp_mat_mult_packed_q16s_rv32im(const int16_t *__restrict__ pSrcA,
+                                     const int16_t *__restrict__ pPackedB,
                                      uint32_t M,
                                      uint32_t N,
                                      uint32_t O,
                                      uint32_t shift,
-                                     uint32_t nPE,
-                                     int32_t *__restrict__ pDstC);
+                                     int16_t *__restrict__ pDstC);
 
 /** -------------------------------------------------------
-   @brief      matrix transposed matrix multiplication of a 32-bit fix-point matrices for RV32IM
+   @brief      Matrix matrix multiplication of 16-bit fix-point matrices with packed B for XPULPV2
                extension.
-   @param[in]  pSrcA points to first the input matrix
-   @param[in]  pSrcB points to second the input matrix
-   @param[in]  M     Height of first matrix
-   @param[in]  N     Width of first and heigt of second matrix
-   @param[in]  O     Width of second matrix
-   @param[in]  shift Amount to shift the result of each multiplication.
-   @param[out] pDstC Output is written here
+   @param[in]  pSrcA    points to the first input matrix
+   @param[in]  pPackedB points to the second input matrix, packed by plp_mat_pack_b_q16
+   @param[in]  M        Height of first matrix
+   @param[in]  N        Width of first and heigt of second matrix
+   @param[in]  O        Width of second matrix
+   @param[in]  shift    Amount to shift the result of the accumulation.
+   @param[out] pDstC    Output is written here
    @return     none
-
-   @par Fix-Point and Shifting
-   The result will be shifted by the parameter `shift` to the right (multiplied
-   by 2^-shift). Assume that matrix A is represented as pSrcA * 2^-x, and matrix
-   B as pSrcB * 2^-y (in other words, A has it's x last digits after the binary
-   point). Then, the output is represented as pDstC * 2^-(x + y - shift).
 */
 
-void plp_mat_mult_trans_q32s_rv32im(const int32_t *__restrict__ pSrcA,
-                                    const int32_t *__restrict__ pSrcB,
-                                    uint32_t M,
-                                    uint32_t N,
-                                    uint32_t O,
-                                    uint32_t shift,
-                                    int32_t *__restrict__ pDstC);
+void plp_mat_mult_packed_q16s_xpulpv2(const int16_t *__restrict__ pSrcA,
+                                      const int16_t *__restrict__ pPackedB,
+                                      uint32_t M,
+                                      uint32_t N,
+                                      uint32_t O,
+                                      uint32_t shift,
+                                      int16_t *__restrict__ pDstC);
 
 /** -------------------------------------------------------
-   @brief      matrix transposed matrix multiplication of a 32-bit fix-point matrices for XPULPV2
-               extension.
-   @param[in]  pSrcA points to first the input matrix
-   @param[in]  pSrcB points to second the input matrix
-   @param[in]  M     Height of first matrix
-   @param[in]  N     Width of first and heigt of second matrix
-   @param[in]  O     Width of second matrix
-   @param[in]  shift Amount to shift the result of each multiplication.
-   @param[out] pDstC Output is written here
+   @brief      Parallel matrix multiplication of 16-bit fix-point matrices with packed B kernel for
+               XPULPV2 extension.
+   @param[in]  args  pointer to plp_mat_mult_instance_q16 struct initialized by
+                     plp_mat_mult_packed_q16_parallel
    @return     none
-
-   @par Fix-Point and Shifting
-   The result will be shifted by the parameter `shift` to the right (multiplied
-   by 2^-shift). Assume that matrix A is represented as pSrcA * 2^-x, and matrix
-   B as pSrcB * 2^-y (in other words, A has it's x last digits after the binary
-   point). Then, the output is represented as pDstC * 2^-(x + y - shift).
 */
 
-void plp_mat_mult_trans_q32s_xpulpv2(const int32_t *__restrict__ pSrcA,
-                                     const int32_t *__restrict__ pSrcB,
-                                     uint32_t M,
-                                     uint32_t N,
-                                     uint32_t O,
-                                     uint32_t shift,
-                                     int32_t *__restrict__ pDstC);
+void plp_mat_mult_packed_q16p_xpulpv2(void *args);
 
 /** -------------------------------------------------------
-    @brief      Parallel matrix transposed matrix multiplication of 32-bit fix-point matrices kernel
-                for XPULPV2 extension.
-    @param[in]  args  pointer to plp_mat_mult_instance_q32 struct initialized by
-                      plp_mat_mult_trans_q32_parallel
-    @return     none
+   @brief      Glue code of matrix matrix multiplication of 8-bit integer matrices, with the
+               requantization of the output to 8 bits (bias, scaling and clamping).
+   @param[in]  pSrcA    points to the first input matrix
+   @param[in]  pSrcB    points to the second input matrix
+   @param[in]  M        Height of first matrix
+   @param[in]  N        Width of first and heigt of second matrix
+   @param[in]  O        Width of second matrix
+   @param[in]  pParams  points to the requantization parameters (per row of the output)
+   @param[out] pDstC    Output is written here
+   @return     none
 */
 
-void plp_mat_mult_trans_q32p_xpulpv2(void *args);
+void plp_mat_mult_requant_i8(const int8_t *__restrict__ pSrcA,
+                             const int8_t *__restrict__ pSrcB,
+                             uint32_t M,
+                             uint32_t N,
+                             uint32_t O,
+                             const plp_requant_params_i8 *pParams,
+                             int8_t *__restrict__ pDstC);
 
 /** -------------------------------------------------------
-   @brief      Glue code for matrix transposed matrix multiplication of a 16-bit fix-point
-               matrices.
-   @param[in]  pSrcA points to first the input matrix
-   @param[in]  pSrcB points to second the input matrix
-   @param[in]  M     Height of first matrix
-   @param[in]  N     Width of first and heigt of second matrix
-   @param[in]  O     Width of second matrix
-   @param[in]  shift Amount to shift the result of each multiplication.
-   @param[out] pDstC Output is written here
+   @brief      Glue code of parallel matrix matrix multiplication of 8-bit integer matrices,
+               with the requantization of the output to 8 bits.
+   @param[in]  pSrcA    points to the first input matrix
+   @param[in]  pSrcB    points to the second input matrix
+   @param[in]  M        Height of first matrix
+   @param[in]  N        Width of first and heigt of second matrix
+   @param[in]  O        Width of second matrix
+   @param[in]  pParams  points to the requantization parameters (per row of the output)
+   @param[in]  nPE      Number of cores to use (or PLP_NPE_AUTO)
+   @param[out] pDstC    Output is written here
    @return     none
+*/
 
-   @par Fix-Point and Shifting
-   The result will be shifted by the parameter `shift` to the right (multiplied
-   by 2^-shift). Assume that matrix A is represented as pSrcA * 2^-x, and matrix
-   B as pSrcB * 2^-y (in other words, A has it's x last digits after the binary
-   point). Then, the output is represented as pDstC * 2^-(x + y - shift).
-
-   The output of the matrix multiplication will also be stored as an 16-bit array.
-   Set the `shift` parameter such that no overflow ocurrs.
- */
+void plp_mat_mult_requant_i8_parallel(const int8_t *__restrict__ pSrcA,
+                                      const int8_t *__restrict__ pSrcB,
+                                      uint32_t M,
+                                      uint32_t N,
+                                      uint32_t O,
+                                      const plp_requant_params_i8 *pParams,
+                                      uint32_t nPE,
+                                      int8_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      Glue code of strided matrix matrix multiplication of 8-bit integer matrices,
+               with the requantization of the output to 8 bits.
+   @param[in]  pSrcA    points to the first input matrix
+   @param[in]  pSrcB    points to the second input matrix
+   @param[in]  M        Height of first matrix
+   @param[in]  N        Width of first and heigt of second matrix
+   @param[in]  O        Width of second matrix
+   @param[in]  strideA  Stride of matrix A (elements between each row)
+   @param[in]  strideB  Stride of matrix B (elements between each row)
+   @param[in]  strideC  Stride of output matrix (elements between each row)
+   @param[in]  pParams  points to the requantization parameters (per row of the output)
+   @param[out] pDstC    Output is written here
+   @return     none
+*/
 
-void plp_mat_mult_trans_q16(const int16_t *__restrict__ pSrcA,
-                            const int16_t *__restrict__ pSrcB,
-                            uint32_t M,
-                            uint32_t N,
-                            uint32_t O,
-                            uint32_t shift,
-                            int16_t *__restrict__ pDstC);
+void plp_mat_mult_requant_stride_i8(const int8_t *__restrict__ pSrcA,
+                                    const int8_t *__restrict__ pSrcB,
+                                    uint32_t M,
+                                    uint32_t N,
+                                    uint32_t O,
+                                    uint32_t strideA,
+                                    uint32_t strideB,
+                                    uint32_t strideC,
+                                    const plp_requant_params_i8 *pParams,
+                                    int8_t *__restrict__ pDstC);
 
 /** -------------------------------------------------------
-   @brief      Glue code for parallel matrix transposed matrix multiplication of a 16-bit
-               fix-point matrices.
-   @param[in]  pSrcA points to first the input matrix
-   @param[in]  pSrcB points to second the input matrix
-   @param[in]  M     Height of first matrix
-   @param[in]  N     Width of first and heigt of second matrix
-   @param[in]  O     Width of second matrix
-   @param[in]  shift Amount to shift the result of each multiplication.
-   @param[in]  nPE   Number of cores to use
-   @param[out] pDstC Output is written here
+   @brief      Glue code of parallel strided matrix matrix multiplication of 8-bit integer
+               matrices, with the requantization of the output to 8 bits.
+   @param[in]  pSrcA    points to the first input matrix
+   @param[in]  pSrcB    points to the second input matrix
+   @param[in]  M        Height of first matrix
+   @param[in]  N        Width of first and heigt of second matrix
+   @param[in]  O        Width of second matrix
+   @param[in]  strideA  Stride of matrix A (elements between each row)
+   @param[in]  strideB  Stride of matrix B (elements between each row)
+   @param[in]  strideC  Stride of output matrix (elements between each row)
+   @param[in]  pParams  points to the requantization parameters (per row of the output)
+   @param[in]  nPE      Number of cores to use (or PLP_NPE_AUTO)
+   @param[out] pDstC    Output is written here
    @return     none
+*/
 
-   @par Fix-Point and Shifting
-   The result will be shifted by the parameter `shift` to the right (multiplied
-   by 2^-shift). Assume that matrix A is represented as pSrcA * 2^-x, and matrix
-   B as pSrcB * 2^-y (in other words, A has it's x last digits after the binary
-   point). Then, the output is represented as pDstC * 2^-(x + y - shift).
-
-   The output of the matrix multiplication will also be stored as an 16-bit array.
-   Set the `shift` parameter such that no overflow ocurrs.
- */
+void plp_mat_mult_requant_stride_i8_parallel(const int8_t *__restrict__ pSrcA,
+                                             const int8_t *__restrict__ pSrcB,
+                                             uint32_t M,
+                                             uint32_t N,
+                                             uint32_t O,
+                                             uint32_t strideA,
+                                             uint32_t strideB,
+                                             uint32_t strideC,
+                                             const plp_requant_params_i8 *pParams,
+                                             uint32_t nPE,
+                                             int8_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      Strided matrix matrix multiplication of 8-bit integer matrices with
+               requantization for RV32IM extension.
+   @param[in]  pSrcA    points to the first input matrix
+   @param[in]  pSrcB    points to the second input matrix
+   @param[in]  M        Height of first matrix
+   @param[in]  N        Width of first and heigt of second matrix
+   @param[in]  O        Width of second matrix
+   @param[in]  strideA  Stride of matrix A (elements between each row)
+   @param[in]  strideB  Stride of matrix B (elements between each row)
+   @param[in]  strideC  Stride of output matrix (elements between each row)
+   @param[in]  pParams  points to the requantization parameters (per row of the output)
+   @param[out] pDstC    Output is written here
+   @return     none
+*/
 
-void plp_mat_mult_trans_q16_parallel(const int16_t *__restrict__ pSrcA,
-                                     const int16_t *__restrict__ pSrcB,
+void plp_mat_mult_requant_i8s_rv32im(const int8_t *__restrict__ pSrcA,
+                                     const int8_t *__restrict__ pSrcB,
                                      uint32_t M,
                                      uint32_t N,
                                      uint32_t O,
-                                     uint32_t shift,
-                                     uint32_t nPE,
-                                     int16_t *__restrict__ pDstC);
+                                     uint32_t strideA,
+                                     uint32_t strideB,
+                                     uint32_t strideC,
+                                     const plp_requant_params_i8 *pParams,
+                                     int8_t *__restrict__ pDstC);
 
 /** -------------------------------------------------------
-   @brief      matrix transposed matrix multiplication of a 16-bit fix-point matrices for RV32IM
-               extension.
-   @param[in]  pSrcA points to first the input matrix
-   @param[in]  pSrcB points to second the input matrix
-   @param[in]  M     Height of first matrix
-   @param[in]  N     Width of first and heigt of second matrix
-   @param[in]  O     Width of second matrix
-   @param[in]  shift Amount to shift the result of each multiplication.
-   @param[out] pDstC Output is written here
+   @brief      Strided matrix matrix multiplication of 8-bit integer matrices with
+               requantization for XPULPV2 extension.
+   @param[in]  pSrcA    points to the first input matrix
+   @param[in]  pSrcB    points to the second input matrix
+   @param[in]  M        Height of first matrix
+   @param[in]  N        Width of first and heigt of second matrix
+   @param[in]  O        Width of second matrix
+   @param[in]  strideA  Stride of matrix A (elements between each row)
+   @param[in]  strideB  Stride of matrix B (elements between each row)
+   @param[in]  strideC  Stride of output matrix (elements between each row)
+   @param[in]  pParams  points to the requantization parameters (per row of the output)
+   @param[out] pDstC    Output is written here
    @return     none
+*/
 
-   @par Fix-Point and Shifting
-   The result will be shifted by the parameter `shift` to the right (multiplied
-   by 2^-shift). Assume that matrix A is represented as pSrcA * 2^-x, and matrix
-   B as pSrcB * 2^-y (in other words, A has it's x last digits after the binary
-   point). Then, the output is represented as pDstC * 2^-(x + y - shift).
+void plp_mat_mult_requant_i8s_xpulpv2(const int8_t *__restrict__ pSrcA,
+                                      const int8_t *__restrict__ pSrcB,
+                                      uint32_t M,
+                                      uint32_t N,
+                                      uint32_t O,
+                                      uint32_t strideA,
+                                      uint32_t strideB,
+                                      uint32_t strideC,
+                                      const plp_requant_params_i8 *pParams,
+                                      int8_t *__restrict__ pDstC);
 
-   The output of the matrix multiplication will also be stored as an 16-bit array.
-   Set the `shift` parameter such that no overflow ocurrs.
+/** -------------------------------------------------------
+   @brief      Parallel matrix matrix multiplication of 8-bit integer matrices with
+               requantization for XPULPV2 extension.
+   @param[in]  args  pointer to plp_mat_mult_requant_instance_i8 struct initialized by
+                     plp_mat_mult_requant_i8_parallel or plp_mat_mult_requant_stride_i8_parallel
+   @return     none
 */
 
-void plp_mat_mult_trans_q16s_rv32im(const int16_t *__restrict__ pSrcA,
-                                    const int16_t *__restrict__ pSrcB,
-                                    uint32_t M,
-                                    uint32_t N,
-                                    uint32_t O,
-                                    uint32_t shift,
-                                    int16_t *__restrict__ pDstC);
+void plp_mat_mult_requant_i8p_xpulpv2(void *args);
 
 /** -------------------------------------------------------
-   @brief      matrix transposed matrix multiplication of a 16-bit fix-point matrices for XPULPV2
-               extension.
-   @param[in]  pSrcA points to first the input matrix
-   @param[in]  pSrcB points to second the input matrix
-   @param[in]  M     Height of first matrix
-   @param[in]  N     Width of first and heigt of second matrix
-   @param[in]  O     Width of second matrix
-   @param[in]  shift Amount to shift the result of each multiplication.
-   @param[out] pDstC Output is written here
-   @return     none
+  @brief      Glue code for matrix-vector multiplication of 32-bit integer matrices.
+  @param[in]  pSrcA     points to the input matrix of shape MxN
+  @param[in]  pSrcX     points to the input vector of length N
+  @param[in]  M         height of the input matrix and length of the output vector
+  @param[in]  N         width of the input matrix and length of the input vector
+  @param[out] pDstY     points to the output vector of length M
+  @return     none
+*/
 
-   @par Fix-Point and Shifting
-   The result will be shifted by the parameter `shift` to the right (multiplied
-   by 2^-shift). Assume that matrix A is represented as pSrcA * 2^-x, and matrix
-   B as pSrcB * 2^-y (in other words, A has it's x last digits after the binary
-   point). Then, the output is represented as pDstC * 2^-(x + y - shift).
+void plp_mat_vec_i32(const int32_t *__restrict__ pSrcA,
+                     const int32_t *__restrict__ pSrcX,
+                     uint32_t M,
+                     uint32_t N,
+                     int32_t *__restrict__ pDstY);
 
-   The output of the matrix multiplication will also be stored as an 16-bit array.
-   Set the `shift` parameter such that no overflow ocurrs.
+/** -------------------------------------------------------
+  @brief      Glue code for parallel matrix-vector multiplication of 32-bit integer matrices.
+  @param[in]  pSrcA     points to the input matrix of shape MxN
+  @param[in]  pSrcX     points to the input vector of length N
+  @param[in]  M         height of the input matrix and length of the output vector
+  @param[in]  N         width of the input matrix and length of the input vector
+  @param[in]  nPE       Number of cores to use (or PLP_NPE_AUTO)
+  @param[out] pDstY     points to the output vector of length M
+  @return     none
 */
 
-void plp_mat_mult_trans_q16s_xpulpv2(const int16_t *__restrict__ pSrcA,
-                                     const int16_t *__restrict__ pSrcB,
-                                     uint32_t M,
-                                     uint32_t N,
-                                     uint32_t O,
-                                     uint32_t shift,
-                                     int16_t *__restrict__ pDstC);
+void plp_mat_vec_i32_parallel(const int32_t *__restrict__ pSrcA,
+                              const int32_t *__restrict__ pSrcX,
+                              uint32_t M,
+                              uint32_t N,
+                              uint32_t nPE,
+                              int32_t *__restrict__ pDstY);
 
 /** -------------------------------------------------------
-    @brief      Parallel matrix transposed matrix multiplication of 16-bit fix-point matrices kernel
-                for XPULPV2 extension.
-    @param[in]  args  pointer to plp_mat_mult_instance_q16 struct initialized by
-                      plp_mat_mult_trans_q16_parallel
-    @return     none
+  @brief      matrix-vector multiplication of 32-bit integer matrices for RV32IM extension.
+  @param[in]  pSrcA     points to the input matrix of shape MxN
+  @param[in]  pSrcX     points to the input vector of length N
+  @param[in]  M         height of the input matrix and length of the output vector
+  @param[in]  N         width of the input matrix and length of the input vector
+  @param[out] pDstY     points to the output vector of length M
+  @return     none
 */
 
-void plp_mat_mult_trans_q16p_xpulpv2(void *args);
+void plp_mat_vec_i32s_rv32im(const int32_t *__restrict__ pSrcA,
+                             const int32_t *__restrict__ pSrcX,
+                             uint32_t M,
+                             uint32_t N,
+                             int32_t *__restrict__ pDstY);
 
 /** -------------------------------------------------------
-   @brief      Glue code for matrix transposed matrix multiplication of a 8-bit fix-point
-               matrices.
-   @param[in]  pSrcA points to first the input matrix
-   @param[in]  pSrcB points to second the input matrix
-   @param[in]  M     Height of first matrix
-   @param[in]  N     Width of first and heigt of second matrix
-   @param[in]  O     Width of second matrix
-   @param[in]  shift Amount to shift the result of each multiplication.
-   @param[out] pDstC Output is written here
-   @return     none
+  @brief      matrix-vector multiplication of 32-bit integer matrices for XPULPV2 extension.
+  @param[in]  pSrcA     points to the input matrix of shape MxN
+  @param[in]  pSrcX     points to the input vector of length N
+  @param[in]  M         height of the input matrix and length of the output vector
+  @param[in]  N         width of the input matrix and length of the input vector
+  @param[out] pDstY     points to the output vector of length M
+  @return     none
+*/
 
-   @par Fix-Point and Shifting
-   The result will be shifted by the parameter `shift` to the right (multiplied
-   by 2^-shift). Assume that matrix A is represented as pSrcA * 2^-x, and matrix
-   B as pSrcB * 2^-y (in other words, A has it's x last digits after the binary
-   point). Then, the output is represented as pDstC * 2^-(x + y - shift).
+void plp_mat_vec_i32s_xpulpv2(const int32_t *__restrict__ pSrcA,
+                              const int32_t *__restrict__ pSrcX,
+                              uint32_t M,
+                              uint32_t N,
+                              int32_t *__restrict__ pDstY);
 
-   The output of the matrix multiplication will also be stored as an 8-bit array.
-   Set the `shift` parameter such that no overflow ocurrs.
- */
+/** -------------------------------------------------------
+  @brief      Parallel matrix-vector multiplication of 32-bit integer matrices for XPULPV2
+              extension.
+  @param[in]  args  pointer to plp_mat_vec_instance_i32 struct initialized by
+                    plp_mat_vec_i32_parallel
+  @return     none
+*/
 
-void plp_mat_mult_trans_q8(const int8_t *__restrict__ pSrcA,
-                           const int8_t *__restrict__ pSrcB,
-                           uint32_t M,
-                           uint32_t N,
-                           uint32_t O,
-                           uint32_t shift,
-                           int8_t *__restrict__ pDstC);
+void plp_mat_vec_i32p_xpulpv2(void *args);
 
 /** -------------------------------------------------------
-   @brief      Glue code for parallel matrix transposed matrix multiplication of a 8-bit
-               fix-point matrices.
-   @param[in]  pSrcA points to first the input matrix
-   @param[in]  pSrcB points to second the input matrix
-   @param[in]  M     Height of first matrix
-   @param[in]  N     Width of first and heigt of second matrix
-   @param[in]  O     Width of second matrix
-   @param[in]  shift Amount to shift the result of each multiplication.
-   @param[in]  nPE   Number of cores to use
-   @param[out] pDstC Output is written here
-   @return     none
+  @brief      Glue code for matrix-vector multiplication of 16-bit integer matrices.
+  @param[in]  pSrcA     points to the input matrix of shape MxN
+  @param[in]  pSrcX     points to the input vector of length N
+  @param[in]  M         height of the input matrix and length of the output vector
+  @param[in]  N         width of the input matrix and length of the input vector
+  @param[out] pDstY     points to the output vector of length M
+  @return     none
+*/
 
-   @par Fix-Point and Shifting
-   The result will be shifted by the parameter `shift` to the right (multiplied
-   by 2^-shift). Assume that matrix A is represented as pSrcA * 2^-x, and matrix
-   B as pSrcB * 2^-y (in other words, A has it's x last digits after the binary
-   point). Then, the output is represented as pDstC * 2^-(x + y - shift).
+void plp_mat_vec_i16(const int16_t *__restrict__ pSrcA,
+                     const int16_t *__restrict__ pSrcX,
+                     uint32_t M,
+                     uint32_t N,
+                     int32_t *__restrict__ pDstY);
 
-   The output of the matrix multiplication will also be stored as an 8-bit array.
-   Set the `shift` parameter such that no overflow ocurrs.
- */
+/** -------------------------------------------------------
+  @brief      Glue code for parallel matrix-vector multiplication of 16-bit integer matrices.
+  @param[in]  pSrcA     points to the input matrix of shape MxN
+  @param[in]  pSrcX     points to the input vector of length N
+  @param[in]  M         height of the input matrix and length of the output vector
+  @param[in]  N         width of the input matrix and length of the input vector
+  @param[in]  nPE       Number of cores to use (or PLP_NPE_AUTO)
+  @param[out] pDstY     points to the output vector of length M
+  @return     none
+*/
 
-void plp_mat_mult_trans_q8_parallel(const int8_t *__restrict__ pSrcA,
-                                    const int8_t *__restrict__ pSrcB,
-                                    uint32_t M,
-                                    uint32_t N,
-                                    uint32_t O,
-                                    uint32_t shift,
-                                    uint32_t nPE,
-                                    int8_t *__restrict__ pDstC);
+void plp_mat_vec_i16_parallel(const int16_t *__restrict__ pSrcA,
+                              const int16_t *__restrict__ pSrcX,
+                              uint32_t M,
+                              uint32_t N,
+                              uint32_t nPE,
+                              int32_t *__restrict__ pDstY);
 
 /** -------------------------------------------------------
-   @brief      matrix transposed matrix multiplication of a 8-bit fix-point matrices for RV32IM
-               extension.
-   @param[in]  pSrcA points to first the input matrix
-   @param[in]  pSrcB points to second the input matrix
-   @param[in]  M     Height of first matrix
-   @param[in]  N     Width of first and heigt of second matrix
-   @param[in]  O     Width of second matrix
-   @param[in]  shift Amount to shift the result of each multiplication.
-   @param[out] pDstC Output is written here
-   @return     none
+  @brief      matrix-vector multiplication of 16-bit integer matrices for RV32IM extension.
+  @param[in]  pSrcA     points to the input matrix of shape MxN
+  @param[in]  pSrcX     points to the input vector of length N
+  @param[in]  M         height of the input matrix and length of the output vector
+  @param[in]  N         width of the input matrix and length of the input vector
+  @param[out] pDstY     points to the output vector of length M
+  @return     none
+*/
 
-   @par Fix-Point and Shifting
-   The result will be shifted by the parameter `shift` to the right (multiplied
-   by 2^-shift). Assume that matrix A is represented as pSrcA * 2^-x, and matrix
-   B as pSrcB * 2^-y (in other words, A has it's x last digits after the binary
-   point). Then, the output is represented as pDstC * 2^-(x + y - shift).
+void plp_mat_vec_i16s_rv32im(const int16_t *__restrict__ pSrcA,
+                             const int16_t *__restrict__ pSrcX,
+                             uint32_t M,
+                             uint32_t N,
+                             int32_t *__restrict__ pDstY);
 
-   The output of the matrix multiplication will also be stored as an 8-bit array.
-   Set the `shift` parameter such that no overflow ocurrs.
+/** -------------------------------------------------------
+  @brief      matrix-vector multiplication of 16-bit integer matrices for XPULPV2 extension.
+  @param[in]  pSrcA     points to the input matrix of shape MxN
+  @param[in]  pSrcX     points to the input vector of length N
+  @param[in]  M         height of the input matrix and length of the output vector
+  @param[in]  N         width of the input matrix and length of the input vector
+  @param[out] pDstY     points to the output vector of length M
+  @return     none
 */
 
-void plp_mat_mult_trans_q8s_rv32im(const int8_t *__restrict__ pSrcA,
-                                   const int8_t *__restrict__ pSrcB,
-                                   uint32_t M,
-                                   uint32_t N,
-                                   uint32_t O,
-                                   uint32_t shift,
-                                   int8_t *__restrict__ pDstC);
+void plp_mat_vec_i16s_xpulpv2(const int16_t *__restrict__ pSrcA,
+                              const int16_t *__restrict__ pSrcX,
+                              uint32_t M,
+                              uint32_t N,
+                              int32_t *__restrict__ pDstY);
 
 /** -------------------------------------------------------
-   @brief      matrix transposed matrix multiplication of a 8-bit fix-point matrices for XPULPV2
-               extension.
-   @param[in]  pSrcA points to first the input matrix
-   @param[in]  pSrcB points to second the input matrix
-   @param[in]  M     Height of first matrix
-   @param[in]  N     Width of first and heigt of second matrix
-   @param[in]  O     Width of second matrix
-   @param[in]  shift Amount to shift the result of each multiplication.
-   @param[out] pDstC Output is written here
-   @return     none
+  @brief      Parallel matrix-vector multiplication of 16-bit integer matrices for XPULPV2
+              extension.
+  @param[in]  args  pointer to plp_mat_vec_instance_i16 struct initialized by
+                    plp_mat_vec_i16_parallel
+  @return     none
+*/
 
-   @par Fix-Point and Shifting
-   The result will be shifted by the parameter `shift` to the right (multiplied
-   by 2^-shift). Assume that matrix A is represented as pSrcA * 2^-x, and matrix
-   B as pSrcB * 2^-y (in other words, A has it's x last digits after the binary
-   point). Then, the output is represented as pDstC * 2^-(x + y - shift).
+void plp_mat_vec_i16p_xpulpv2(void *args);
 
-   The output of the matrix multiplication will also be stored as an 8-bit array.
-   Set the `shift` parameter such that no overflow ocurrs.
+/** -------------------------------------------------------
+  @brief      Glue code for matrix-vector multiplication of 8-bit integer matrices.
+  @param[in]  pSrcA     points to the input matrix of shape MxN
+  @param[in]  pSrcX     points to the input vector of length N
+  @param[in]  M         height of the input matrix and length of the output vector
+  @param[in]  N         width of the input matrix and length of the input vector
+  @param[out] pDstY     points to the output vector of length M
+  @return     none
 */
 
-void plp_mat_mult_trans_q8s_xpulpv2(const int8_t *__restrict__ pSrcA,
-                                    const int8_t *__restrict__ pSrcB,
-                                    uint32_t M,
-                                    uint32_t N,
-                                    uint32_t O,
-                                    uint32_t shift,
-                                    int8_t *__restrict__ pDstC);
+void plp_mat_vec_i8(const int8_t *__restrict__ pSrcA,
+                    const int8_t *__restrict__ pSrcX,
+                    uint32_t M,
+                    uint32_t N,
+                    int32_t *__restrict__ pDstY);
 
 /** -------------------------------------------------------
-    @brief      Parallel matrix transposed matrix multiplication of 8-bit fix-point matrices kernel
-                for XPULPV2 extension.
-    @param[in]  args  pointer to plp_mat_mult_instance_q8 struct initialized by
-                      plp_mat_mult_trans_q8_parallel
-    @return     none
+  @brief      Glue code for parallel matrix-vector multiplication of 8-bit integer matrices.
+  @param[in]  pSrcA     points to the input matrix of shape MxN
+  @param[in]  pSrcX     points to the input vector of length N
+  @param[in]  M         height of the input matrix and length of the output vector
+  @param[in]  N         width of the input matrix and length of the input vector
+  @param[in]  nPE       Number of cores to use (or PLP_NPE_AUTO)
+  @param[out] pDstY     points to the output vector of length M
+  @return     none
 */
 
-void plp_mat_mult_trans_q8p_xpulpv2(void *args);
+void plp_mat_vec_i8_parallel(const int8_t *__restrict__ pSrcA,
+                             const int8_t *__restrict__ pSrcX,
+                             uint32_t M,
+                             uint32_t N,
+                             uint32_t nPE,
+                             int32_t *__restrict__ pDstY);
 
 /** -------------------------------------------------------
-   @brief      Glue code for matrix transposed matrix multiplication of a 32-bit floating-point
-               matrices.
-   @param[in]  pSrcA points to first the input matrix
-   @param[in]  pSrcB points to second the input matrix
-   @param[in]  M     Height of first matrix
-   @param[in]  N     Width of first and heigt of second matrix
-   @param[in]  O     Width of second matrix
-   @param[out] pDstC Output is written here
-   @return     none
+  @brief      matrix-vector multiplication of 8-bit integer matrices for RV32IM extension.
+  @param[in]  pSrcA     points to the input matrix of shape MxN
+  @param[in]  pSrcX     points to the input vector of length N
+  @param[in]  M         height of the input matrix and length of the output vector
+  @param[in]  N         width of the input matrix and length of the input vector
+  @param[out] pDstY     points to the output vector of length M
+  @return     none
 */
 
-void plp_mat_mult_trans_f32(const float *__restrict__ pSrcA,
-                            const float *__restrict__ pSrcB,
+void plp_mat_vec_i8s_rv32im(const int8_t *__restrict__ pSrcA,
+                            const int8_t *__restrict__ pSrcX,
                             uint32_t M,
                             uint32_t N,
-                            uint32_t O,
-                            float *__restrict__ pDstC);
+                            int32_t *__restrict__ pDstY);
 
 /** -------------------------------------------------------
-   @brief      matrix transposed matrix multiplication of a 32-bit floating-point matrices for
-               XPULPV2 extension.
-   @param[in]  pSrcA points to first the input matrix
-   @param[in]  pSrcB points to second the input matrix
-   @param[in]  M     Height of first matrix
-   @param[in]  N     Width of first and heigt of second matrix
-   @param[in]  O     Width of second matrix
-   @param[out] pDstC Output is written here
-   @return     none
+  @brief      matrix-vector multiplication of 8-bit integer matrices for XPULPV2 extension.
+  @param[in]  pSrcA     points to the input matrix of shape MxN
+  @param[in]  pSrcX     points to the input vector of length N
+  @param[in]  M         height of the input matrix and length of the output vector
+  @param[in]  N         width of the input matrix and length of the input vector
+  @param[out] pDstY     points to the output vector of length M
+  @return     none
 */
 
-void plp_mat_mult_trans_f32s_xpulpv2(const float *__restrict__ pSrcA,
-                                     const float *__restrict__ pSrcB,
-                                     uint32_t M,
-                                     uint32_t N,
-                                     uint32_t O,
-                                     float *__restrict__ pDstC);
+void plp_mat_vec_i8s_xpulpv2(const int8_t *__restrict__ pSrcA,
+                             const int8_t *__restrict__ pSrcX,
+                             uint32_t M,
+                             uint32_t N,
+                             int32_t *__restrict__ pDstY);
 
 /** -------------------------------------------------------
-   @brief      Glue code for parallel matrix transposed matrix multiplication of a 32-bit
-               floating-point matrices.
-   @param[in]  pSrcA points to first the input matrix
-   @param[in]  pSrcB points to second the input matrix
-   @param[in]  M     Height of first matrix
-   @param[in]  N     Width of first and heigt of second matrix
-   @param[in]  O     Width of second matrix
-   @param[in]  nPE   Number of cores to use
-   @param[out] pDstC Output is written here
-   @return     none
+  @brief      Parallel matrix-vector multiplication of 8-bit integer matrices for XPULPV2 extension.
+  @param[in]  args  pointer to plp_mat_vec_instance_i8 struct initialized by
+                    plp_mat_vec_i8_parallel
+  @return     none
 */
 
-void plp_mat_mult_trans_f32_parallel(const float *__restrict__ pSrcA,
-                                     const float *__restrict__ pSrcB,
-                                     uint32_t M,
-                                     uint32_t N,
-                                     uint32_t O,
-                                     uint32_t nPE,
-                                     float *__restrict__ pDstC);
+void plp_mat_vec_i8p_xpulpv2(void *args);
 
 /** -------------------------------------------------------
-    @brief      Parallel matrix transposed matrix multiplication of 32-bit floating-point matrices
-                kernel for XPULPV2 extension.
-    @param[in]  args  pointer to plp_mat_mult_instance_f32 struct initialized by
-                      plp_mat_mult_trans_f32_parallel
-    @return     none
+  @brief      Glue code for matrix-vector multiplication of 32-bit fix-point matrices.
+  @param[in]  pSrcA     points to the input matrix of shape MxN
+  @param[in]  pSrcX     points to the input vector of length N
+  @param[in]  M         height of the input matrix and length of the output vector
+  @param[in]  N         width of the input matrix and length of the input vector
+  @param[in]  shift     Amount to shift the accumulated result to the right
+  @param[out] pDstY     points to the output vector of length M
+  @return     none
 */
 
-void plp_mat_mult_trans_f32p_xpulpv2(void *args);
+void plp_mat_vec_q32(const int32_t *__restrict__ pSrcA,
+                     const int32_t *__restrict__ pSrcX,
+                     uint32_t M,
+                     uint32_t N,
+                     uint32_t shift,
+                     int32_t *__restrict__ pDstY);
 
 /** -------------------------------------------------------
-  @brief      Glue code of matrix transpose matrix multiplication for complex 32-bit integers
-  @param[in]  pSrcA Points to the first input matrix of shape MxN
-  @param[in]  pSrcB Points to the second input matrix of shape OxN
-  @param[in]  M     Height of matrix SrcA and DstC
-  @param[in]  N     Width of matrix SrcA and SrcB
-  @param[in]  O     Height of matrix SrcB and width of matrix DstC
-  @param[out] pDstC Points to the output matrix of shape MxO
+  @brief      Glue code for parallel matrix-vector multiplication of 32-bit fix-point matrices.
+  @param[in]  pSrcA     points to the input matrix of shape MxN
+  @param[in]  pSrcX     points to the input vector of length N
+  @param[in]  M         height of the input matrix and length of the output vector
+  @param[in]  N         width of the input matrix and length of the input vector
+  @param[in]  shift     Amount to shift the accumulated result to the right
+  @param[in]  nPE       Number of cores to use (or PLP_NPE_AUTO)
+  @param[out] pDstY     points to the output vector of length M
   @return     none
 */
 
-void plp_mat_mult_trans_cmplx_i32(const int32_t *__restrict__ pSrcA,
-                                  const int32_t *__restrict__ pSrcB,
-                                  uint32_t M,
-                                  uint32_t N,
-                                  uint32_t O,
-                                  int32_t *__restrict__ pDstC);
+void plp_mat_vec_q32_parallel(const int32_t *__restrict__ pSrcA,
+                              const int32_t *__restrict__ pSrcX,
+                              uint32_t M,
+                              uint32_t N,
+                              uint32_t shift,
+                              uint32_t nPE,
+                              int32_t *__restrict__ pDstY);
 
 /** -------------------------------------------------------
-  @brief      matrix transpose matrix multiplication for complex 32-bit integers on RV32IM
-  @param[in]  pSrcA Points to the first input matrix of shape MxN
-  @param[in]  pSrcB Points to the second input matrix of shape OxN
-  @param[in]  M     Height of matrix SrcA and DstC
-  @param[in]  N     Width of matrix SrcA and SrcB
-  @param[in]  O     Height of matrix SrcB and width of matrix DstC
-  @param[out] pDstC Points to the output matrix of shape MxO
+  @brief      matrix-vector multiplication of 32-bit fix-point matrices for RV32IM extension.
+  @param[in]  pSrcA     points to the input matrix of shape MxN
+  @param[in]  pSrcX     points to the input vector of length N
+  @param[in]  M         height of the input matrix and length of the output vector
+  @param[in]  N         width of the input matrix and length of the input vector
+  @param[in]  shift     Amount to shift the accumulated result to the right
+  @param[out] pDstY     points to the output vector of length M
   @return     none
 */
 
-void plp_mat_mult_trans_cmplx_i32s_rv32im(const int32_t *__restrict__ pSrcA,
-                                          const int32_t *__restrict__ pSrcB,
-                                          uint32_t M,
-                                          uint32_t N,
-                                          uint32_t O,
-                                          int32_t *__restrict__ pDstC);
+void plp_mat_vec_q32s_rv32im(const int32_t *__restrict__ pSrcA,
+                             const int32_t *__restrict__ pSrcX,
+                             uint32_t M,
+                             uint32_t N,
+                             uint32_t shift,
+                             int32_t *__restrict__ pDstY);
 
 /** -------------------------------------------------------
-  @brief      matrix transpose matrix multiplication for complex 32-bit integers on XpulpV2
-  @param[in]  pSrcA Points to the first input matrix of shape MxN
-  @param[in]  pSrcB Points to the second input matrix of shape OxN
-  @param[in]  M     Height of matrix SrcA and DstC
-  @param[in]  N     Width of matrix SrcA and SrcB
-  @param[in]  O     Height of matrix SrcB and width of matrix DstC
-  @param[out] pDstC Points to the output matrix of shape MxO
+  @brief      matrix-vector multiplication of 32-bit fix-point matrices for XPULPV2 extension.
+  @param[in]  pSrcA     points to the input matrix of shape MxN
+  @param[in]  pSrcX     points to the input vector of length N
+  @param[in]  M         height of the input matrix and length of the output vector
+  @param[in]  N         width of the input matrix and length of the input vector
+  @param[in]  shift     Amount to shift the accumulated result to the right
+  @param[out] pDstY     points to the output vector of length M
   @return     none
 */
 
-void plp_mat_mult_trans_cmplx_i32s_xpulpv2(const int32_t *__restrict__ pSrcA,
-                                           const int32_t *__restrict__ pSrcB,
-                                           uint32_t M,
-                                           uint32_t N,
-                                           uint32_t O,
-                                           int32_t *__restrict__ pDstC);
+void plp_mat_vec_q32s_xpulpv2(const int32_t *__restrict__ pSrcA,
+                              const int32_t *__restrict__ pSrcX,
+                              uint32_t M,
+                              uint32_t N,
+                              uint32_t shift,
+                              int32_t *__restrict__ pDstY);
 
 /** -------------------------------------------------------
-  @brief      Glue code of parallel matrix transpose matrix multiplication for complex 32-bit
-              integers
-  @param[in]  pSrcA Points to the first input matrix of shape MxN
-  @param[in]  pSrcB Points to the second input matrix of shape OxN
-  @param[in]  M     Height of matrix SrcA and DstC
-  @param[in]  N     Width of matrix SrcA and SrcB
-  @param[in]  O     Height of matrix SrcB and width of matrix DstC
-  @param[in]  nPE   Number of cores to use for computation
-  @param[out] pDstC Points to the output matrix of shape MxO
+  @brief      Parallel matrix-vector multiplication of 32-bit fix-point matrices for XPULPV2
+              extension.
+  @param[in]  args  pointer to plp_mat_vec_instance_q32 struct initialized by
+                    plp_mat_vec_q32_parallel
   @return     none
 */
 
-void plp_mat_mult_trans_cmplx_i32_parallel(const int32_t *__restrict__ pSrcA,
-                                           const int32_t *__restrict__ pSrcB,
-                                           uint32_t M,
-                                           uint32_t N,
-                                           uint32_t O,
-                                           uint32_t nPE,
-                                           int32_t *__restrict__ pDstC);
+void plp_mat_vec_q32p_xpulpv2(void *args);
 
 /** -------------------------------------------------------
-  @brief      parallel matrix transpose matrix multiplication for complex 32-bit integers on XpulpV2
-  @param[in]  args  pointer to plp_mat_mult_cmplx_instance_i32 struct initialized by
-                    plp_mat_mult_trans_cmplx_i32_parallel
+  @brief      Glue code for matrix-vector multiplication of 16-bit fix-point matrices.
+  @param[in]  pSrcA     points to the input matrix of shape MxN
+  @param[in]  pSrcX     points to the input vector of length N
+  @param[in]  M         height of the input matrix and length of the output vector
+  @param[in]  N         width of the input matrix and length of the input vector
+  @param[in]  shift     Amount to shift the accumulated result to the right
+  @param[out] pDstY     points to the output vector of length M
   @return     none
 */
 
-void plp_mat_mult_trans_cmplx_i32p_xpulpv2(void *args);
+void plp_mat_vec_q16(const int16_t *__restrict__ pSrcA,
+                     const int16_t *__restrict__ pSrcX,
+                     uint32_t M,
+                     uint32_t N,
+                     uint32_t shift,
+                     int16_t *__restrict__ pDstY);
 
 /** -------------------------------------------------------
-  @brief      Glue code of matrix transpose matrix multiplication for complex 16-bit integers
-  @param[in]  pSrcA Points to the first input matrix of shape MxN
-  @param[in]  pSrcB Points to the second input matrix of shape OxN
-  @param[in]  M     Height of matrix SrcA and DstC
-  @param[in]  N     Width of matrix SrcA and SrcB
-  @param[in]  O     Height of matrix SrcB and width of matrix DstC
-  @param[out] pDstC Points to the output matrix of shape MxO
+  @brief      Glue code for parallel matrix-vector multiplication of 16-bit fix-point matrices.
+  @param[in]  pSrcA     points to the input matrix of shape MxN
+  @param[in]  pSrcX     points to the input vector of length N
+  @param[in]  M         height of the input matrix and length of the output vector
+  @param[in]  N         width of the input matrix and length of the input vector
+  @param[in]  shift     Amount to shift the accumulated result to the right
+  @param[in]  nPE       Number of cores to use (or PLP_NPE_AUTO)
+  @param[out] pDstY     points to the output vector of length M
   @return     none
 */
 
-void plp_mat_mult_trans_cmplx_i16(const int16_t *__restrict__ pSrcA,
-                                  const int16_t *__restrict__ pSrcB,
-                                  uint32_t M,
-                                  uint32_t N,
-                                  uint32_t O,
-                                  int32_t *__restrict__ pDstC);
+void plp_mat_vec_q16_parallel(const int16_t *__restrict__ pSrcA,
+                              const int16_t *__restrict__ pSrcX,
+                              uint32_t M,
+                              uint32_t N,
+                              uint32_t shift,
+                              uint32_t nPE,
+                              int16_t *__restrict__ pDstY);
 
 /** -------------------------------------------------------
-  @brief      matrix transpose matrix multiplication for complex 16-bit integers on RV32IM
-  @param[in]  pSrcA Points to the first input matrix of shape MxN
-  @param[in]  pSrcB Points to the second input matrix of shape OxN
-  @param[in]  M     Height of matrix SrcA and DstC
-  @param[in]  N     Width of matrix SrcA and SrcB
-  @param[in]  O     Height of matrix SrcB and width of matrix DstC
-  @param[out] pDstC Points to the output matrix of shape MxO
+  @brief      matrix-vector multiplication of 16-bit fix-point matrices for RV32IM extension.
+  @param[in]  pSrcA     points to the input matrix of shape MxN
+  @param[in]  pSrcX     points to the input vector of length N
+  @param[in]  M         height of the input matrix and length of the output vector
+  @param[in]  N         width of the input matrix and length of the input vector
+  @param[in]  shift     Amount to shift the accumulated result to the right
+  @param[out] pDstY     points to the output vector of length M
   @return     none
 */
 
-void plp_mat_mult_trans_cmplx_i16s_rv32im(const int16_t *__restrict__ pSrcA,
-                                          const int16_t *__restrict__ pSrcB,
-                                          uint32_t M,
-                                          uint32_t N,
-                                          uint32_t O,
-                                          int32_t *__restrict__ pDstC);
+void plp_mat_vec_q16s_rv32im(const int16_t *__restrict__ pSrcA,
+                             const int16_t *__restrict__ pSrcX,
+                             uint32_t M,
+                             uint32_t N,
+                             uint32_t shift,
+                             int16_t *__restrict__ pDstY);
 
 /** -------------------------------------------------------
-  @brief      matrix transpose matrix multiplication for complex 16-bit integers on XpulpV2
-  @param[in]  pSrcA Points to the first input matrix of shape MxN
-  @param[in]  pSrcB Points to the second input matrix of shape OxN
-  @param[in]  M     Height of matrix SrcA and DstC
-  @param[in]  N     Width of matrix SrcA and SrcB
-  @param[in]  O     Height of matrix SrcB and width of matrix DstC
-  @param[out] pDstC Points to the output matrix of shape MxO
+  @brief      matrix-vector multiplication of 16-bit fix-point matrices for XPULPV2 extension.
+  @param[in]  pSrcA     points to the input matrix of shape MxN
+  @param[in]  pSrcX     points to the input vector of length N
+  @param[in]  M         height of the input matrix and length of the output vector
+  @param[in]  N         width of the input matrix and length of the input vector
+  @param[in]  shift     Amount to shift the accumulated result to the right
+  @param[out] pDstY     points to the output vector of length M
   @return     none
-
-  @par Exploiting SIMD instructions
-  The 16 bit values are packed two each into 32 bit vectors and then the two dot products are
-  performed on 32 bit vectors, with 32 bit accumulator.
 */
 
-void plp_mat_mult_trans_cmplx_i16s_xpulpv2(const int16_t *__restrict__ pSrcA,
-                                           const int16_t *__restrict__ pSrcB,
-                                           uint32_t M,
-                                           uint32_t N,
-                                           uint32_t O,
-                                           int32_t *__restrict__ pDstC);
+void plp_mat_vec_q16s_xpulpv2(const int16_t *__restrict__ pSrcA,
+                              const int16_t *__restrict__ pSrcX,
+                              uint32_t M,
+                              uint32_t N,
+                              uint32_t shift,
+                              int16_t *__restrict__ pDstY);
 
 /** -------------------------------------------------------
-  @brief      Glue code of parallel matrix transpose matrix multiplication for complex 16-bit
-              integers
-  @param[in]  pSrcA Points to the first input matrix of shape MxN
-  @param[in]  pSrcB Points to the second input matrix of shape OxN
-  @param[in]  M     Height of matrix SrcA and DstC
-  @param[in]  N     Width of matrix SrcA and SrcB
-  @param[in]  O     Height of matrix SrcB and width of matrix DstC
-  @param[in]  nPE   Number of cores to use for computation
-  @param[out] pDstC Points to the output matrix of shape MxO
+  @brief      Parallel matrix-vector multiplication of 16-bit fix-point matrices for XPULPV2
+              extension.
+  @param[in]  args  pointer to plp_mat_vec_instance_q16 struct initialized by
+                    plp_mat_vec_q16_parallel
   @return     none
 */
 
-void plp_mat_mult_trans_cmplx_i16_parallel(const int16_t *__restrict__ pSrcA,
-                                           const int16_t *__restrict__ pSrcB,
-                                           uint32_t M,
-                                           uint32_t N,
-                                           uint32_t O,
-                                           uint32_t nPE,
-                                           int32_t *__restrict__ pDstC);
+void plp_mat_vec_q16p_xpulpv2(void *args);
 
 /** -------------------------------------------------------
-  @brief      parallel matrix transpose matrix multiplication for complex 16-bit integers on XpulpV2
-  @param[in]  args  pointer to plp_mat_mult_cmplx_instance_i16 struct initialized by
-                    plp_mat_mult_trans_cmplx_i16_parallel
+  @brief      Glue code for matrix-vector multiplication of 8-bit fix-point matrices.
+  @param[in]  pSrcA     points to the input matrix of shape MxN
+  @param[in]  pSrcX     points to the input vector of length N
+  @param[in]  M         height of the input matrix and length of the output vector
+  @param[in]  N         width of the input matrix and length of the input vector
+  @param[in]  shift     Amount to shift the accumulated result to the right
+  @param[out] pDstY     points to the output vector of length M
   @return     none
-
-  @par Exploiting SIMD instructions
-  The 16 bit values are packed two each into 32 bit vectors and then the two dot products are
-  performed on 32 bit vectors, with 32 bit accumulator.
 */
 
-void plp_mat_mult_trans_cmplx_i16p_xpulpv2(void *args);
+void plp_mat_vec_q8(const int8_t *__restrict__ pSrcA,
+                    const int8_t *__restrict__ pSrcX,
+                    uint32_t M,
+                    uint32_t N,
+                    uint32_t shift,
+                    int8_t *__restrict__ pDstY);
 
 /** -------------------------------------------------------
-  @brief      Glue code of matrix transpose matrix multiplication for complex 8-bit integers
-  @param[in]  pSrcA Points to the first input matrix of shape MxN
-  @param[in]  pSrcB Points to the second input matrix of shape OxN
-  @param[in]  M     Height of matrix SrcA and DstC
-  @param[in]  N     Width of matrix SrcA and SrcB
-  @param[in]  O     Height of matrix SrcB and width of matrix DstC
-  @param[out] pDstC Points to the output matrix of shape MxO
+  @brief      Glue code for parallel matrix-vector multiplication of 8-bit fix-point matrices.
+  @param[in]  pSrcA     points to the input matrix of shape MxN
+  @param[in]  pSrcX     points to the input vector of length N
+  @param[in]  M         height of the input matrix and length of the output vector
+  @param[in]  N         width of the input matrix and length of the input vector
+  @param[in]  shift     Amount to shift the accumulated result to the right
+  @param[in]  nPE       Number of cores to use (or PLP_NPE_AUTO)
+  @param[out] pDstY     points to the output vector of length M
   @return     none
 */
 
-void plp_mat_mult_trans_cmplx_i8(const int8_t *__restrict__ pSrcA,
-                                 const int8_t *__restrict__ pSrcB,
-                                 uint32_t M,
-                                 uint32_t N,
-                                 uint32_t O,
-                                 int32_t *__restrict__ pDstC);
+void plp_mat_vec_q8_parallel(const int8_t *__restrict__ pSrcA,
+                             const int8_t *__restrict__ pSrcX,
+                             uint32_t M,
+                             uint32_t N,
+                             uint32_t shift,
+                             uint32_t nPE,
+                             int8_t *__restrict__ pDstY);
 
 /** -------------------------------------------------------
-  @brief      matrix transpose matrix multiplication for complex 8-bit integers on RV32IM
-  @param[in]  pSrcA Points to the first input matrix of shape MxN
-  @param[in]  pSrcB Points to the second input matrix of shape OxN
-  @param[in]  M     Height of matrix SrcA and DstC
-  @param[in]  N     Width of matrix SrcA and SrcB
-  @param[in]  O     Height of matrix SrcB and width of matrix DstC
-  @param[out] pDstC Points to the output matrix of shape MxO
+  @brief      matrix-vector multiplication of 8-bit fix-point matrices for RV32IM extension.
+  @param[in]  pSrcA     points to the input matrix of shape MxN
+  @param[in]  pSrcX     points to the input vector of length N
+  @param[in]  M         height of the input matrix and length of the output vector
+  @param[in]  N         width of the input matrix and length of the input vector
+  @param[in]  shift     Amount to shift the accumulated result to the right
+  @param[out] pDstY     points to the output vector of length M
   @return     none
 */
 
-void plp_mat_mult_trans_cmplx_i8s_rv32im(const int8_t *__restrict__ pSrcA,
-                                         const int8_t *__restrict__ pSrcB,
-                                         uint32_t M,
-                                         uint32_t N,
-                                         uint32_t O,
-                                         int32_t *__restrict__ pDstC);
+void plp_mat_vec_q8s_rv32im(const int8_t *__restrict__ pSrcA,
+                            const int8_t *__restrict__ pSrcX,
+                            uint32_t M,
+                            uint32_t N,
+                            uint32_t shift,
+                            int8_t *__restrict__ pDstY);
 
 /** -------------------------------------------------------
-  @brief      matrix transpose matrix multiplication for complex 8-bit integers on XpulpV2
-  @param[in]  pSrcA Points to the first input matrix of shape MxN
-  @param[in]  pSrcB Points to the second input matrix of shape OxN
-  @param[in]  M     Height of matrix SrcA and DstC
-  @param[in]  N     Width of matrix SrcA and SrcB
-  @param[in]  O     Height of matrix SrcB and width of matrix DstC
-  @param[out] pDstC Points to the output matrix of shape MxO
+  @brief      matrix-vector multiplication of 8-bit fix-point matrices for XPULPV2 extension.
+  @param[in]  pSrcA     points to the input matrix of shape MxN
+  @param[in]  pSrcX     points to the input vector of length N
+  @param[in]  M         height of the input matrix and length of the output vector
+  @param[in]  N         width of the input matrix and length of the input vector
+  @param[in]  shift     Amount to shift the accumulated result to the right
+  @param[out] pDstY     points to the output vector of length M
   @return     none
-
-  @par Exploiting SIMD instructions
-  The 8 bit values are packed four each into 32 bit vectors and then the four dot products are
-  performed on 32 bit vectors, with 32 bit accumulator.
 */
 
-void plp_mat_mult_trans_cmplx_i8s_xpulpv2(const int8_t *__restrict__ pSrcA,
-                                          const int8_t *__restrict__ pSrcB,
-                                          uint32_t M,
-                                          uint32_t N,
-                                          uint32_t O,
-                                          int32_t *__restrict__ pDstC);
+void plp_mat_vec_q8s_xpulpv2(const int8_t *__restrict__ pSrcA,
+                             const int8_t *__restrict__ pSrcX,
+                             uint32_t M,
+                             uint32_t N,
+                             uint32_t shift,
+                             int8_t *__restrict__ pDstY);
 
 /** -------------------------------------------------------
-  @brief      Glue code of parallel matrix transpose matrix multiplication for complex 8-bit
-              integers
-  @param[in]  pSrcA Points to the first input matrix of shape MxN
-  @param[in]  pSrcB Points to the second input matrix of shape OxN
-  @param[in]  M     Height of matrix SrcA and DstC
-  @param[in]  N     Width of matrix SrcA and SrcB
-  @param[in]  O     Height of matrix SrcB and width of matrix DstC
-  @param[in]  nPE   Number of cores to use for computation
-  @param[out] pDstC Points to the output matrix of shape MxO
+  @brief      Parallel matrix-vector multiplication of 8-bit fix-point matrices for XPULPV2
+              extension.
+  @param[in]  args  pointer to plp_mat_vec_instance_q8 struct initialized by
+                    plp_mat_vec_q8_parallel
   @return     none
 */
 
-void plp_mat_mult_trans_cmplx_i8_parallel(const int8_t *__restrict__ pSrcA,
-                                          const int8_t *__restrict__ pSrcB,
-                                          uint32_t M,
-                                          uint32_t N,
-                                          uint32_t O,
-                                          uint32_t nPE,
-                                          int32_t *__restrict__ pDstC);
+void plp_mat_vec_q8p_xpulpv2(void *args);
 
 /** -------------------------------------------------------
-  @brief      parallel matrix transpose matrix multiplication for complex 8-bit integers on XpulpV2
-  @param[in]  args  pointer to plp_mat_mult_cmplx_instance_i8 struct initialized by
-                    plp_mat_mult_trans_cmplx_i8_parallel
+  @brief      Glue code for matrix-vector multiplication of 32-bit floating-point matrices.
+  @param[in]  pSrcA     points to the input matrix of shape MxN
+  @param[in]  pSrcX     points to the input vector of length N
+  @param[in]  M         height of the input matrix and length of the output vector
+  @param[in]  N         width of the input matrix and length of the input vector
+  @param[out] pDstY     points to the output vector of length M
   @return     none
-
-  @par Exploiting SIMD instructions
-  The 8 bit values are packed four each into 32 bit vectors and then the four dot products are
-  performed on 32 bit vectors, with 32 bit accumulator.
 */
 
-void plp_mat_mult_trans_cmplx_i8p_xpulpv2(void *args);
+void plp_mat_vec_f32(const float *__restrict__ pSrcA,
+                     const float *__restrict__ pSrcX,
+                     uint32_t M,
+                     uint32_t N,
+                     float *__restrict__ pDstY);
 
 /** -------------------------------------------------------
-  @brief      Glue code of matrix transpose matrix multiplication for complex 32-bit floats
-  @param[in]  pSrcA Points to the first input matrix of shape MxN
-  @param[in]  pSrcB Points to the second input matrix of shape OxN
-  @param[in]  M     Height of matrix SrcA and DstC
-  @param[in]  N     Width of matrix SrcA and SrcB
-  @param[in]  O     Height of matrix SrcB and width of matrix DstC
-  @param[out] pDstC Points to the output matrix of shape MxO
+  @brief      Glue code for parallel matrix-vector multiplication of 32-bit floating-point matrices.
+  @param[in]  pSrcA     points to the input matrix of shape MxN
+  @param[in]  pSrcX     points to the input vector of length N
+  @param[in]  M         height of the input matrix and length of the output vector
+  @param[in]  N         width of the input matrix and length of the input vector
+  @param[in]  nPE       Number of cores to use (or PLP_NPE_AUTO)
+  @param[out] pDstY     points to the output vector of length M
   @return     none
 */
 
-void plp_mat_mult_trans_cmplx_f32(const float *__restrict__ pSrcA,
-                                  const float *__restrict__ pSrcB,
-                                  uint32_t M,
-                                  uint32_t N,
-                                  uint32_t O,
-                                  float *__restrict__ pDstC);
+void plp_mat_vec_f32_parallel(const float *__restrict__ pSrcA,
+                              const float *__restrict__ pSrcX,
+                              uint32_t M,
+                              uint32_t N,
+                              uint32_t nPE,
+                              float *__restrict__ pDstY);
 
 /** -------------------------------------------------------
-  @brief      matrix transpose matrix multiplication for complex 32-bit floats on XpulpV2
-  @param[in]  pSrcA Points to the first input matrix of shape MxN
-  @param[in]  pSrcB Points to the second input matrix of shape OxN
-  @param[in]  M     Height of matrix SrcA and DstC
-  @param[in]  N     Width of matrix SrcA and SrcB
-  @param[in]  O     Height of matrix SrcB and width of matrix DstC
-  @param[out] pDstC Points to the output matrix of shape MxO
+  @brief      matrix-vector multiplication of 32-bit floating-point matrices for XPULPV2 extension.
+  @param[in]  pSrcA     points to the input matrix of shape MxN
+  @param[in]  pSrcX     points to the input vector of length N
+  @param[in]  M         height of the input matrix and length of the output vector
+  @param[in]  N         width of the input matrix and length of the input vector
+  @param[out] pDstY     points to the output vector of length M
   @return     none
 */
 
-void plp_mat_mult_trans_cmplx_f32s_xpulpv2(const float *__restrict__ pSrcA,
-                                           const float *__restrict__ pSrcB,
-                                           uint32_t M,
-                                           uint32_t N,
-                                           uint32_t O,
-                                           float *__restrict__ pDstC);
+void plp_mat_vec_f32s_xpulpv2(const float *__restrict__ pSrcA,
+                              const float *__restrict__ pSrcX,
+                              uint32_t M,
+                              uint32_t N,
+                              float *__restrict__ pDstY);
 
 /** -------------------------------------------------------
-  @brief      Glue code of parallel matrix transpose matrix multiplication for complex 32-bit floats
-  @param[in]  pSrcA Points to the first input matrix of shape MxN
-  @param[in]  pSrcB Points to the second input matrix of shape OxN
-  @param[in]  M     Height of matrix SrcA and DstC
-  @param[in]  N     Width of matrix SrcA and SrcB
-  @param[in]  O     Height of matrix SrcB and width of matrix DstC
-  @param[in]  nPE   Number of cores to use for computation
-  @param[out] pDstC Points to the output matrix of shape MxO
+  @brief      Parallel matrix-vector multiplication of 32-bit floating-point matrices for XPULPV2
+              extension.
+  @param[in]  args  pointer to plp_mat_vec_instance_f32 struct initialized by
+                    plp_mat_vec_f32_parallel
   @return     none
 */
 
-void plp_mat_mult_trans_cmplx_f32_parallel(const float *__restrict__ pSrcA,
-                                           const float *__restrict__ pSrcB,
-                                           uint32_t M,
-                                           uint32_t N,
-                                           uint32_t O,
-                                           uint32_t nPE,
-                                           float *__restrict__ pDstC);
+void plp_mat_vec_f32p_xpulpv2(void *args);
 
 /** -------------------------------------------------------
-  @brief      parallel matrix transpose matrix multiplication for complex 32-bit floats on XpulpV2
-  @param[in]  args  pointer to plp_mat_mult_cmplx_instance_f32 struct initialized by
-                    plp_mat_mult_trans_cmplx_f32_parallel
+  @brief      Glue code for transposed matrix-vector multiplication of 32-bit integer matrices.
+  @param[in]  pSrcA     points to the input matrix of shape MxN
+  @param[in]  pSrcX     points to the input vector of length M
+  @param[in]  M         height of the input matrix and length of the input vector
+  @param[in]  N         width of the input matrix and length of the output vector
+  @param[out] pDstY     points to the output vector of length N
   @return     none
 */
 
-void plp_mat_mult_trans_cmplx_f32p_xpulpv2(void *args);
+void plp_mat_vec_trans_i32(const int32_t *__restrict__ pSrcA,
+                           const int32_t *__restrict__ pSrcX,
+                           uint32_t M,
+                           uint32_t N,
+                           int32_t *__restrict__ pDstY);
 
 /** -------------------------------------------------------
-  @brief      Glue code of matrix transpose matrix multiplication for complex 32-bit fix-point
-  @param[in]  pSrcA Points to the first input matrix of shape MxN
-  @param[in]  pSrcB Points to the second input matrix of shape OxN
-  @param[in]  M     Height of matrix SrcA and DstC
-  @param[in]  N     Width of matrix SrcA and SrcB
-  @param[in]  O     Height of matrix SrcB and width of matrix DstC
-  @param[in]  shift Amount to shift the result of each multiplication ot the right
-  @param[out] pDstC Points to the output matrix of shape MxO
+  @brief      Glue code for parallel transposed matrix-vector multiplication of 32-bit integer
+              matrices.
+  @param[in]  pSrcA     points to the input matrix of shape MxN
+  @param[in]  pSrcX     points to the input vector of length M
+  @param[in]  M         height of the input matrix and length of the input vector
+  @param[in]  N         width of the input matrix and length of the output vector
+  @param[in]  nPE       Number of cores to use (or PLP_NPE_AUTO)
+  @param[out] pDstY     points to the output vector of length N
   @return     none
+*/
 
-  @par Fix-Point
-  Fix-Point and Shifting
-  The result will be shifted by the parameter `shift` to the right (which corresponds to a
-  multiplication by `2^-shift`). Assume that matrix A is represente as `pSrcA * 2^-x` and matrix B
-  as `pSrcB * 2^-y` (which means that A has `x`, and B has `y` bits after the binary point). Then,
-  the output matrix C is represented as `pDstC * 2^-(x + y - shift)`.
-  The output matrix is also stored with the same number of bits as the inputs. Set the
-  `shift` parameter such that no overflow occurrs.
+void plp_mat_vec_trans_i32_parallel(const int32_t *__restrict__ pSrcA,
+                                    const int32_t *__restrict__ pSrcX,
+                                    uint32_t M,
+                                    uint32_t N,
+                                    uint32_t nPE,
+                                    int32_t *__restrict__ pDstY);
+
+/** -------------------------------------------------------
+  @brief      transposed matrix-vector multiplication of 32-bit integer matrices for RV32IM
+              extension.
+  @param[in]  pSrcA     points to the input matrix of shape MxN
+  @param[in]  pSrcX     points to the input vector of length M
+  @param[in]  M         height of the input matrix and length of the input vector
+  @param[in]  N         width of the input matrix and length of the output vector
+  @param[out] pDstY     points to the output vector of length N
+  @return     none
 */
 
-void plp_mat_mult_trans_cmplx_q32(const int32_t *__restrict__ pSrcA,
-                                  const int32_t *__restrict__ pSrcB,
+void plp_mat_vec_trans_i32s_rv32im(const int32_t *__restrict__ pSrcA,
+                                   const int32_t *__restrict__ pSrcX,
+                                   uint32_t M,
+                                   uint32_t N,
+                                   int32_t *__restrict__ pDstY);
+
+/** -------------------------------------------------------
+  @brief      transposed matrix-vector multiplication of 32-bit integer matrices for XPULPV2
+              extension.
+  @param[in]  pSrcA     points to the input matrix of shape MxN
+  @param[in]  pSrcX     points to the input vector of length M
+  @param[in]  M         height of the input matrix and length of the input vector
+  @param[in]  N         width of the input matrix and length of the output vector
+  @param[out] pDstY     points to the output vector of length N
+  @return     none
+*/
+
+void plp_mat_vec_trans_i32s_xpulpv2(const int32_t *__restrict__ pSrcA,
+                                    const int32_t *__restrict__ pSrcX,
+                                    uint32_t M,
+                                    uint32_t N,
+                                    int32_t *__restrict__ pDstY);
+
+/** -------------------------------------------------------
+  @brief      Parallel transposed matrix-vector multiplication of 32-bit integer matrices for
+              XPULPV2 extension.
+  @param[in]  args  pointer to plp_mat_vec_instance_i32 struct initialized by
+                    plp_mat_vec_trans_i32_parallel
+  @return     none
+*/
+
+void plp_mat_vec_trans_i32p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+  @brief      Glue code for transposed matrix-vector multiplication of 16-bit integer matrices.
+  @param[in]  pSrcA     points to the input matrix of shape MxN
+  @param[in]  pSrcX     points to the input vector of length M
+  @param[in]  M         height of the input matrix and length of the input vector
+  @param[in]  N         width of the input matrix and length of the output vector
+  @param[out] pDstY     points to the output vector of length N
+  @return     none
+*/
+
+void plp_mat_vec_trans_i16(const int16_t *__restrict__ pSrcA,
+                           const int16_t *__restrict__ pSrcX,
+                           uint32_t M,
+                           uint32_t N,
+                           int32_t *__restrict__ pDstY);
+
+/** -------------------------------------------------------
+  @brief      Glue code for parallel transposed matrix-vector multiplication of 16-bit integer
+              matrices.
+  @param[in]  pSrcA     points to the input matrix of shape MxN
+  @param[in]  pSrcX     points to the input vector of length M
+  @param[in]  M         height of the input matrix and length of the input vector
+  @param[in]  N         width of the input matrix and length of the output vector
+  @param[in]  nPE       Number of cores to use (or PLP_NPE_AUTO)
+  @param[out] pDstY     points to the output vector of length N
+  @return     none
+*/
+
+void plp_mat_vec_trans_i16_parallel(const int16_t *__restrict__ pSrcA,
+                                    const int16_t *__restrict__ pSrcX,
+                                    uint32_t M,
+                                    uint32_t N,
+                                    uint32_t nPE,
+                                    int32_t *__restrict__ pDstY);
+
+/** -------------------------------------------------------
+  @brief      transposed matrix-vector multiplication of 16-bit integer matrices for RV32IM
+              extension.
+  @param[in]  pSrcA     points to the input matrix of shape MxN
+  @param[in]  pSrcX     points to the input vector of length M
+  @param[in]  M         height of the input matrix and length of the input vector
+  @param[in]  N         width of the input matrix and length of the output vector
+  @param[out] pDstY     points to the output vector of length N
+  @return     none
+*/
+
+void plp_mat_vec_trans_i16s_rv32im(const int16_t *__restrict__ pSrcA,
+                                   const int16_t *__restrict__ pSrcX,
+                                   uint32_t M,
+                                   uint32_t N,
+                                   int32_t *__restrict__ pDstY);
+
+/** -------------------------------------------------------
+  @brief      transposed matrix-vector multiplication of 16-bit integer matrices for XPULPV2
+              extension.
+  @param[in]  pSrcA     points to the input matrix of shape MxN
+  @param[in]  pSrcX     points to the input vector of length M
+  @param[in]  M         height of the input matrix and length of the input vector
+  @param[in]  N         width of the input matrix and length of the output vector
+  @param[out] pDstY     points to the output vector of length N
+  @return     none
+*/
+
+void plp_mat_vec_trans_i16s_xpulpv2(const int16_t *__restrict__ pSrcA,
+                                    const int16_t *__restrict__ pSrcX,
+                                    uint32_t M,
+                                    uint32_t N,
+                                    int32_t *__restrict__ pDstY);
+
+/** -------------------------------------------------------
+  @brief      Parallel transposed matrix-vector multiplication of 16-bit integer matrices for
+              XPULPV2 extension.
+  @param[in]  args  pointer to plp_mat_vec_instance_i16 struct initialized by
+                    plp_mat_vec_trans_i16_parallel
+  @return     none
+*/
+
+void plp_mat_vec_trans_i16p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+  @brief      Glue code for transposed matrix-vector multiplication of 8-bit integer matrices.
+  @param[in]  pSrcA     points to the input matrix of shape MxN
+  @param[in]  pSrcX     points to the input vector of length M
+  @param[in]  M         height of the input matrix and length of the input vector
+  @param[in]  N         width of the input matrix and length of the output vector
+  @param[out] pDstY     points to the output vector of length N
+  @return     none
+*/
+
+void plp_mat_vec_trans_i8(const int8_t *__restrict__ pSrcA,
+                          const int8_t *__restrict__ pSrcX,
+                          uint32_t M,
+                          uint32_t N,
+                          int32_t *__restrict__ pDstY);
+
+/** -------------------------------------------------------
+  @brief      Glue code for parallel transposed matrix-vector multiplication of 8-bit integer
+              matrices.
+  @param[in]  pSrcA     points to the input matrix of shape MxN
+  @param[in]  pSrcX     points to the input vector of length M
+  @param[in]  M         height of the input matrix and length of the input vector
+  @param[in]  N         width of the input matrix and length of the output vector
+  @param[in]  nPE       Number of cores to use (or PLP_NPE_AUTO)
+  @param[out] pDstY     points to the output vector of length N
+  @return     none
+*/
+
+void plp_mat_vec_trans_i8_parallel(const int8_t *__restrict__ pSrcA,
+                                   const int8_t *__restrict__ pSrcX,
+                                   uint32_t M,
+                                   uint32_t N,
+                                   uint32_t nPE,
+                                   int32_t *__restrict__ pDstY);
+
+/** -------------------------------------------------------
+  @brief      transposed matrix-vector multiplication of 8-bit integer matrices for RV32IM
+              extension.
+  @param[in]  pSrcA     points to the input matrix of shape MxN
+  @param[in]  pSrcX     points to the input vector of length M
+  @param[in]  M         height of the input matrix and length of the input vector
+  @param[in]  N         width of the input matrix and length of the output vector
+  @param[out] pDstY     points to the output vector of length N
+  @return     none
+*/
+
+void plp_mat_vec_trans_i8s_rv32im(const int8_t *__restrict__ pSrcA,
+                                  const int8_t *__restrict__ pSrcX,
+                                  uint32_t M,
+                                  uint32_t N,
+                                  int32_t *__restrict__ pDstY);
+
+/** -------------------------------------------------------
+  @brief      transposed matrix-vector multiplication of 8-bit integer matrices for XPULPV2
+              extension.
+  @param[in]  pSrcA     points to the input matrix of shape MxN
+  @param[in]  pSrcX     points to the input vector of length M
+  @param[in]  M         height of the input matrix and length of the input vector
+  @param[in]  N         width of the input matrix and length of the output vector
+  @param[out] pDstY     points to the output vector of length N
+  @return     none
+*/
+
+void plp_mat_vec_trans_i8s_xpulpv2(const int8_t *__restrict__ pSrcA,
+                                   const int8_t *__restrict__ pSrcX,
+                                   uint32_t M,
+                                   uint32_t N,
+                                   int32_t *__restrict__ pDstY);
+
+/** -------------------------------------------------------
+  @brief      Parallel transposed matrix-vector multiplication of 8-bit integer matrices for
+              XPULPV2 extension.
+  @param[in]  args  pointer to plp_mat_vec_instance_i8 struct initialized by
+                    plp_mat_vec_trans_i8_parallel
+  @return     none
+*/
+
+void plp_mat_vec_trans_i8p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+  @brief      Glue code for transposed matrix-vector multiplication of 32-bit fix-point matrices.
+  @param[in]  pSrcA     points to the input matrix of shape MxN
+  @param[in]  pSrcX     points to the input vector of length M
+  @param[in]  M         height of the input matrix and length of the input vector
+  @param[in]  N         width of the input matrix and length of the output vector
+  @param[in]  shift     Amount to shift the accumulated result to the right
+  @param[out] pDstY     points to the output vector of length N
+  @return     none
+*/
+
+void plp_mat_vec_trans_q32(const int32_t *__restrict__ pSrcA,
+                           const int32_t *__restrict__ pSrcX,
+                           uint32_t M,
+                           uint32_t N,
+                           uint32_t shift,
+                           int32_t *__restrict__ pDstY);
+
+/** -------------------------------------------------------
+  @brief      Glue code for parallel transposed matrix-vector multiplication of 32-bit fix-point
+              matrices.
+  @param[in]  pSrcA     points to the input matrix of shape MxN
+  @param[in]  pSrcX     points to the input vector of length M
+  @param[in]  M         height of the input matrix and length of the input vector
+  @param[in]  N         width of the input matrix and length of the output vector
+  @param[in]  shift     Amount to shift the accumulated result to the right
+  @param[in]  nPE       Number of cores to use (or PLP_NPE_AUTO)
+  @param[out] pDstY     points to the output vector of length N
+  @return     none
+*/
+
+void plp_mat_vec_trans_q32_parallel(const int32_t *__restrict__ pSrcA,
+                                    const int32_t *__restrict__ pSrcX,
+                                    uint32_t M,
+                                    uint32_t N,
+                                    uint32_t shift,
+                                    uint32_t nPE,
+                                    int32_t *__restrict__ pDstY);
+
+/** -------------------------------------------------------
+  @brief      transposed matrix-vector multiplication of 32-bit fix-point matrices for RV32IM
+              extension.
+  @param[in]  pSrcA     points to the input matrix of shape MxN
+  @param[in]  pSrcX     points to the input vector of length M
+  @param[in]  M         height of the input matrix and length of the input vector
+  @param[in]  N         width of the input matrix and length of the output vector
+  @param[in]  shift     Amount to shift the accumulated result to the right
+  @param[out] pDstY     points to the output vector of length N
+  @return     none
+*/
+
+void plp_mat_vec_trans_q32s_rv32im(const int32_t *__restrict__ pSrcA,
+                                   const int32_t *__restrict__ pSrcX,
+                                   uint32_t M,
+                                   uint32_t N,
+                                   uint32_t shift,
+                                   int32_t *__restrict__ pDstY);
+
+/** -------------------------------------------------------
+  @brief      transposed matrix-vector multiplication of 32-bit fix-point matrices for XPULPV2
+              extension.
+  @param[in]  pSrcA     points to the input matrix of shape MxN
+  @param[in]  pSrcX     points to the input vector of length M
+  @param[in]  M         height of the input matrix and length of the input vector
+  @param[in]  N         width of the input matrix and length of the output vector
+  @param[in]  shift     Amount to shift the accumulated result to the right
+  @param[out] pDstY     points to the output vector of length N
+  @return     none
+*/
+
+void plp_mat_vec_trans_q32s_xpulpv2(const int32_t *__restrict__ pSrcA,
+                                    const int32_t *__restrict__ pSrcX,
+                                    uint32_t M,
+                                    uint32_t N,
+                                    uint32_t shift,
+                                    int32_t *__restrict__ pDstY);
+
+/** -------------------------------------------------------
+  @brief      Parallel transposed matrix-vector multiplication of 32-bit fix-point matrices for
+              XPULPV2 extension.
+  @param[in]  args  pointer to plp_mat_vec_instance_q32 struct initialized by
+                    plp_mat_vec_trans_q32_parallel
+  @return     none
+*/
+
+void plp_mat_vec_trans_q32p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+  @brief      Glue code for transposed matrix-vector multiplication of 16-bit fix-point matrices.
+  @param[in]  pSrcA     points to the input matrix of shape MxN
+  @param[in]  pSrcX     points to the input vector of length M
+  @param[in]  M         height of the input matrix and length of the input vector
+  @param[in]  N         width of the input matrix and length of the output vector
+  @param[in]  shift     Amount to shift the accumulated result to the right
+  @param[out] pDstY     points to the output vector of length N
+  @return     none
+*/
+
+void plp_mat_vec_trans_q16(const int16_t *__restrict__ pSrcA,
+                           const int16_t *__restrict__ pSrcX,
+                           uint32_t M,
+                           uint32_t N,
+                           uint32_t shift,
+                           int16_t *__restrict__ pDstY);
+
+/** -------------------------------------------------------
+  @brief      Glue code for parallel transposed matrix-vector multiplication of 16-bit fix-point
+              matrices.
+  @param[in]  pSrcA     points to the input matrix of shape MxN
+  @param[in]  pSrcX     points to the input vector of length M
+  @param[in]  M         height of the input matrix and length of the input vector
+  @param[in]  N         width of the input matrix and length of the output vector
+  @param[in]  shift     Amount to shift the accumulated result to the right
+  @param[in]  nPE       Number of cores to use (or PLP_NPE_AUTO)
+  @param[out] pDstY     points to the output vector of length N
+  @return     none
+*/
+
+void plp_mat_vec_trans_q16_parallel(const int16_t *__restrict__ pSrcA,
+                                    const int16_t *__restrict__ pSrcX,
+                                    uint32_t M,
+                                    uint32_t N,
+                                    uint32_t shift,
+                                    uint32_t nPE,
+                                    int16_t *__restrict__ pDstY);
+
+/** -------------------------------------------------------
+  @brief      transposed matrix-vector multiplication of 16-bit fix-point matrices for RV32IM
+              extension.
+  @param[in]  pSrcA     points to the input matrix of shape MxN
+  @param[in]  pSrcX     points to the input vector of length M
+  @param[in]  M         height of the input matrix and length of the input vector
+  @param[in]  N         width of the input matrix and length of the output vector
+  @param[in]  shift     Amount to shift the accumulated result to the right
+  @param[out] pDstY     points to the output vector of length N
+  @return     none
+*/
+
+void plp_mat_vec_trans_q16s_rv32im(const int16_t *__restrict__ pSrcA,
+                                   const int16_t *__restrict__ pSrcX,
+                                   uint32_t M,
+                                   uint32_t N,
+                                   uint32_t shift,
+                                   int16_t *__restrict__ pDstY);
+
+/** -------------------------------------------------------
+  @brief      transposed matrix-vector multiplication of 16-bit fix-point matrices for XPULPV2
+              extension.
+  @param[in]  pSrcA     points to the input matrix of shape MxN
+  @param[in]  pSrcX     points to the input vector of length M
+  @param[in]  M         height of the input matrix and length of the input vector
+  @param[in]  N         width of the input matrix and length of the output vector
+  @param[in]  shift     Amount to shift the accumulated result to the right
+  @param[out] pDstY     points to the output vector of length N
+  @return     none
+*/
+
+void plp_mat_vec_trans_q16s_xpulpv2(const int16_t *__restrict__ pSrcA,
+                                    const int16_t *__restrict__ pSrcX,
+                                    uint32_t M,
+                                    uint32_t N,
+                                    uint32_t shift,
+                                    int16_t *__restrict__ pDstY);
+
+/** -------------------------------------------------------
+  @brief      Parallel transposed matrix-vector multiplication of 16-bit fix-point matrices for
+              XPULPV2 extension.
+  @param[in]  args  pointer to plp_mat_vec_instance_q16 struct initialized by
+                    plp_mat_vec_trans_q16_parallel
+  @return     none
+*/
+
+void plp_mat_vec_trans_q16p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+  @brief      Glue code for transposed matrix-vector multiplication of 8-bit fix-point matrices.
+  @param[in]  pSrcA     points to the input matrix of shape MxN
+  @param[in]  pSrcX     points to the input vector of length M
+  @param[in]  M         height of the input matrix and length of the input vector
+  @param[in]  N         width of the input matrix and length of the output vector
+  @param[in]  shift     Amount to shift the accumulated result to the right
+  @param[out] pDstY     points to the output vector of length N
+  @return     none
+*/
+
+void plp_mat_vec_trans_q8(const int8_t *__restrict__ pSrcA,
+                          const int8_t *__restrict__ pSrcX,
+                          uint32_t M,
+                          uint32_t N,
+                          uint32_t shift,
+                          int8_t *__restrict__ pDstY);
+
+/** -------------------------------------------------------
+  @brief      Glue code for parallel transposed matrix-vector multiplication of 8-bit fix-point
+              matrices.
+  @param[in]  pSrcA     points to the input matrix of shape MxN
+  @param[in]  pSrcX     points to the input vector of length M
+  @param[in]  M         height of the input matrix and length of the input vector
+  @param[in]  N         width of the input matrix and length of the output vector
+  @param[in]  shift     Amount to shift the accumulated result to the right
+  @param[in]  nPE       Number of cores to use (or PLP_NPE_AUTO)
+  @param[out] pDstY     points to the output vector of length N
+  @return     none
+*/
+
+void plp_mat_vec_trans_q8_parallel(const int8_t *__restrict__ pSrcA,
+                                   const int8_t *__restrict__ pSrcX,
+                                   uint32_t M,
+                                   uint32_t N,
+                                   uint32_t shift,
+                                   uint32_t nPE,
+                                   int8_t *__restrict__ pDstY);
+
+/** -------------------------------------------------------
+  @brief      transposed matrix-vector multiplication of 8-bit fix-point matrices for RV32IM
+              extension.
+  @param[in]  pSrcA     points to the input matrix of shape MxN
+  @param[in]  pSrcX     points to the input vector of length M
+  @param[in]  M         height of the input matrix and length of the input vector
+  @param[in]  N         width of the input matrix and length of the output vector
+  @param[in]  shift     Amount to shift the accumulated result to the right
+  @param[out] pDstY     points to the output vector of length N
+  @return     none
+*/
+
+void plp_mat_vec_trans_q8s_rv32im(const int8_t *__restrict__ pSrcA,
+                                  const int8_t *__restrict__ pSrcX,
                                   uint32_t M,
                                   uint32_t N,
-                                  uint32_t O,
                                   uint32_t shift,
-                                  int32_t *__restrict__ pDstC);
+                                  int8_t *__restrict__ pDstY);
 
 /** -------------------------------------------------------
-  @brief      matrix transpose matrix multiplication for complex 32-bit fix-point on RV32IM
-  @param[in]  pSrcA Points to the first input matrix of shape MxN
-  @param[in]  pSrcB Points to the second input matrix of shape OxN
-  @param[in]  M     Height of matrix SrcA and DstC
-  @param[in]  N     Width of matrix SrcA and SrcB
-  @param[in]  O     Height of matrix SrcB and width of matrix DstC
-  @param[in]  shift Amount to shift the result of each multiplication ot the right
-  @param[out] pDstC Points to the output matrix of shape MxO
+  @brief      transposed matrix-vector multiplication of 8-bit fix-point matrices for XPULPV2
+              extension.
+  @param[in]  pSrcA     points to the input matrix of shape MxN
+  @param[in]  pSrcX     points to the input vector of length M
+  @param[in]  M         height of the input matrix and length of the input vector
+  @param[in]  N         width of the input matrix and length of the output vector
+  @param[in]  shift     Amount to shift the accumulated result to the right
+  @param[out] pDstY     points to the output vector of length N
+  @return     none
+*/
+
+void plp_mat_vec_trans_q8s_xpulpv2(const int8_t *__restrict__ pSrcA,
+                                   const int8_t *__restrict__ pSrcX,
+                                   uint32_t M,
+                                   uint32_t N,
+                                   uint32_t shift,
+                                   int8_t *__restrict__ pDstY);
+
+/** -------------------------------------------------------
+  @brief      Parallel transposed matrix-vector multiplication of 8-bit fix-point matrices for
+              XPULPV2 extension.
+  @param[in]  args  pointer to plp_mat_vec_instance_q8 struct initialized by
+                    plp_mat_vec_trans_q8_parallel
+  @return     none
+*/
+
+void plp_mat_vec_trans_q8p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+  @brief      Glue code for transposed matrix-vector multiplication of 32-bit floating-point
+              matrices.
+  @param[in]  pSrcA     points to the input matrix of shape MxN
+  @param[in]  pSrcX     points to the input vector of length M
+  @param[in]  M         height of the input matrix and length of the input vector
+  @param[in]  N         width of the input matrix and length of the output vector
+  @param[out] pDstY     points to the output vector of length N
+  @return     none
+*/
+
+void plp_mat_vec_trans_f32(const float *__restrict__ pSrcA,
+                           const float *__restrict__ pSrcX,
+                           uint32_t M,
+                           uint32_t N,
+                           float *__restrict__ pDstY);
+
+/** -------------------------------------------------------
+  @brief      Glue code for parallel transposed matrix-vector multiplication of 32-bit
+              floating-point matrices.
+  @param[in]  pSrcA     points to the input matrix of shape MxN
+  @param[in]  pSrcX     points to the input vector of length M
+  @param[in]  M         height of the input matrix and length of the input vector
+  @param[in]  N         width of the input matrix and length of the output vector
+  @param[in]  nPE       Number of cores to use (or PLP_NPE_AUTO)
+  @param[out] pDstY     points to the output vector of length N
+  @return     none
+*/
+
+void plp_mat_vec_trans_f32_parallel(const float *__restrict__ pSrcA,
+                                    const float *__restrict__ pSrcX,
+                                    uint32_t M,
+                                    uint32_t N,
+                                    uint32_t nPE,
+                                    float *__restrict__ pDstY);
+
+/** -------------------------------------------------------
+  @brief      transposed matrix-vector multiplication of 32-bit floating-point matrices for XPULPV2
+              extension.
+  @param[in]  pSrcA     points to the input matrix of shape MxN
+  @param[in]  pSrcX     points to the input vector of length M
+  @param[in]  M         height of the input matrix and length of the input vector
+  @param[in]  N         width of the input matrix and length of the output vector
+  @param[out] pDstY     points to the output vector of length N
+  @return     none
+*/
+
+void plp_mat_vec_trans_f32s_xpulpv2(const float *__restrict__ pSrcA,
+                                    const float *__restrict__ pSrcX,
+                                    uint32_t M,
+                                    uint32_t N,
+                                    float *__restrict__ pDstY);
+
+/** -------------------------------------------------------
+  @brief      Parallel transposed matrix-vector multiplication of 32-bit floating-point matrices
+              for XPULPV2 extension.
+  @param[in]  args  pointer to plp_mat_vec_instance_f32 struct initialized by
+                    plp_mat_vec_trans_f32_parallel
+  @return     none
+*/
+
+void plp_mat_vec_trans_f32p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+  @brief      Glue code for batched matrix multiplication of 32-bit integer
+              matrices.
+  @param[in]  pSrcA     points to the first matrix of the batch of first operands (MxN)
+  @param[in]  pSrcB     points to the first matrix of the batch of second operands (NxO)
+  @param[in]  M         height of the first operands and of the outputs
+  @param[in]  N         width of the first operands
+  @param[in]  O         width of the outputs
+  @param[in]  count     number of matrices in the batch
+  @param[in]  strideA   distance between two first operands in elements
+  @param[in]  strideB   distance between two second operands in elements, 0 to share one
+  @param[in]  strideC   distance between two outputs in elements
+  @param[in]  nPE       Number of cores to use (or PLP_NPE_AUTO)
+  @param[out] pDstC     points to the first matrix of the batch of outputs
   @return     none
+*/
+
+void plp_mat_mult_batch_i32(const int32_t *__restrict__ pSrcA,
+                            const int32_t *__restrict__ pSrcB,
+                            uint32_t M,
+                            uint32_t N,
+                            uint32_t O,
+                            uint32_t count,
+                            uint32_t strideA,
+                            uint32_t strideB,
+                            uint32_t strideC,
+                            uint32_t nPE,
+                            int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+  @brief      Parallel batched matrix multiplication of 32-bit integer
+              matrices kernel for XPULPV2 extension.
+  @param[in]  args  pointer to plp_mat_batch_instance struct initialized by
+                    plp_mat_mult_batch_i32
+  @return     none
+*/
+
+void plp_mat_mult_batch_i32p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+  @brief      Glue code for batched matrix multiplication of 32-bit floating-point
+              matrices.
+  @param[in]  pSrcA     points to the first matrix of the batch of first operands (MxN)
+  @param[in]  pSrcB     points to the first matrix of the batch of second operands (NxO)
+  @param[in]  M         height of the first operands and of the outputs
+  @param[in]  N         width of the first operands
+  @param[in]  O         width of the outputs
+  @param[in]  count     number of matrices in the batch
+  @param[in]  strideA   distance between two first operands in elements
+  @param[in]  strideB   distance between two second operands in elements, 0 to share one
+  @param[in]  strideC   distance between two outputs in elements
+  @param[in]  nPE       Number of cores to use (or PLP_NPE_AUTO)
+  @param[out] pDstC     points to the first matrix of the batch of outputs
+  @return     none
+*/
+
+void plp_mat_mult_batch_f32(const float *__restrict__ pSrcA,
+                            const float *__restrict__ pSrcB,
+                            uint32_t M,
+                            uint32_t N,
+                            uint32_t O,
+                            uint32_t count,
+                            uint32_t strideA,
+                            uint32_t strideB,
+                            uint32_t strideC,
+                            uint32_t nPE,
+                            float *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+  @brief      Parallel batched matrix multiplication of 32-bit floating-point
+              matrices kernel for XPULPV2 extension.
+  @param[in]  args  pointer to plp_mat_batch_instance struct initialized by
+                    plp_mat_mult_batch_f32
+  @return     none
+*/
+
+void plp_mat_mult_batch_f32p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+  @brief      Glue code for batched matrix transposed matrix multiplication of 32-bit integer
+              matrices.
+  @param[in]  pSrcA     points to the first matrix of the batch of first operands (MxN)
+  @param[in]  pSrcB     points to the first matrix of the batch of second operands, which
+                        are transposed (OxN)
+  @param[in]  M         height of the first operands and of the outputs
+  @param[in]  N         width of the first operands
+  @param[in]  O         width of the outputs
+  @param[in]  count     number of matrices in the batch
+  @param[in]  strideA   distance between two first operands in elements
+  @param[in]  strideB   distance between two second operands in elements, 0 to share one
+  @param[in]  strideC   distance between two outputs in elements
+  @param[in]  nPE       Number of cores to use (or PLP_NPE_AUTO)
+  @param[out] pDstC     points to the first matrix of the batch of outputs
+  @return     none
+*/
+
+void plp_mat_mult_trans_batch_i32(const int32_t *__restrict__ pSrcA,
+                                  const int32_t *__restrict__ pSrcB,
+                                  uint32_t M,
+                                  uint32_t N,
+                                  uint32_t O,
+                                  uint32_t count,
+                                  uint32_t strideA,
+                                  uint32_t strideB,
+                                  uint32_t strideC,
+                                  uint32_t nPE,
+                                  int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+  @brief      Parallel batched matrix transposed matrix multiplication of 32-bit integer
+              matrices kernel for XPULPV2 extension.
+  @param[in]  args  pointer to plp_mat_batch_instance struct initialized by
+                    plp_mat_mult_trans_batch_i32
+  @return     none
+*/
+
+void plp_mat_mult_trans_batch_i32p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+  @brief      Glue code for batched matrix transposed matrix multiplication of 32-bit floating-point
+              matrices.
+  @param[in]  pSrcA     points to the first matrix of the batch of first operands (MxN)
+  @param[in]  pSrcB     points to the first matrix of the batch of second operands, which
+                        are transposed (OxN)
+  @param[in]  M         height of the first operands and of the outputs
+  @param[in]  N         width of the first operands
+  @param[in]  O         width of the outputs
+  @param[in]  count     number of matrices in the batch
+  @param[in]  strideA   distance between two first operands in elements
+  @param[in]  strideB   distance between two second operands in elements, 0 to share one
+  @param[in]  strideC   distance between two outputs in elements
+  @param[in]  nPE       Number of cores to use (or PLP_NPE_AUTO)
+  @param[out] pDstC     points to the first matrix of the batch of outputs
+  @return     none
+*/
+
+void plp_mat_mult_trans_batch_f32(const float *__restrict__ pSrcA,
+                                  const float *__restrict__ pSrcB,
+                                  uint32_t M,
+                                  uint32_t N,
+                                  uint32_t O,
+                                  uint32_t count,
+                                  uint32_t strideA,
+                                  uint32_t strideB,
+                                  uint32_t strideC,
+                                  uint32_t nPE,
+                                  float *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+  @brief      Parallel batched matrix transposed matrix multiplication of 32-bit floating-point
+              matrices kernel for XPULPV2 extension.
+  @param[in]  args  pointer to plp_mat_batch_instance struct initialized by
+                    plp_mat_mult_trans_batch_f32
+  @return     none
+*/
+
+void plp_mat_mult_trans_batch_f32p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+  @brief      Glue code for batched matrix addition of 32-bit integer matrices.
+  @param[in]  pSrcA     points to the first matrix of the batch of first operands
+  @param[in]  pSrcB     points to the first matrix of the batch of second operands
+  @param[in]  M         height of the matrices
+  @param[in]  N         width of the matrices
+  @param[in]  count     number of matrices in the batch
+  @param[in]  strideA   distance between two first operands in elements
+  @param[in]  strideB   distance between two second operands in elements, 0 to share one
+  @param[in]  strideC   distance between two outputs in elements
+  @param[in]  nPE       Number of cores to use (or PLP_NPE_AUTO)
+  @param[out] pDstC     points to the first matrix of the batch of outputs
+  @return     none
+*/
+
+void plp_mat_add_batch_i32(const int32_t *__restrict__ pSrcA,
+                           const int32_t *__restrict__ pSrcB,
+                           uint32_t M,
+                           uint32_t N,
+                           uint32_t count,
+                           uint32_t strideA,
+                           uint32_t strideB,
+                           uint32_t strideC,
+                           uint32_t nPE,
+                           int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+  @brief      Parallel batched matrix addition of 32-bit integer matrices kernel for
+              XPULPV2 extension.
+  @param[in]  args  pointer to plp_mat_batch_instance struct initialized by
+                    plp_mat_add_batch_i32
+  @return     none
+*/
+
+void plp_mat_add_batch_i32p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+  @brief      Glue code for batched matrix addition of 32-bit floating-point matrices.
+  @param[in]  pSrcA     points to the first matrix of the batch of first operands
+  @param[in]  pSrcB     points to the first matrix of the batch of second operands
+  @param[in]  M         height of the matrices
+  @param[in]  N         width of the matrices
+  @param[in]  count     number of matrices in the batch
+  @param[in]  strideA   distance between two first operands in elements
+  @param[in]  strideB   distance between two second operands in elements, 0 to share one
+  @param[in]  strideC   distance between two outputs in elements
+  @param[in]  nPE       Number of cores to use (or PLP_NPE_AUTO)
+  @param[out] pDstC     points to the first matrix of the batch of outputs
+  @return     none
+*/
+
+void plp_mat_add_batch_f32(const float *__restrict__ pSrcA,
+                           const float *__restrict__ pSrcB,
+                           uint32_t M,
+                           uint32_t N,
+                           uint32_t count,
+                           uint32_t strideA,
+                           uint32_t strideB,
+                           uint32_t strideC,
+                           uint32_t nPE,
+                           float *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+  @brief      Parallel batched matrix addition of 32-bit floating-point matrices kernel for
+              XPULPV2 extension.
+  @param[in]  args  pointer to plp_mat_batch_instance struct initialized by
+                    plp_mat_add_batch_f32
+  @return     none
+*/
+
+void plp_mat_add_batch_f32p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+  @brief      Glue code for batched matrix inversion of 32-bit floating-point matrices.
+  @param[in]  pSrc       points to the first matrix of the batch of inputs (NxN), modified
+  @param[in]  N          width and height of the matrices
+  @param[in]  count      number of matrices in the batch
+  @param[in]  strideSrc  distance between two inputs in elements
+  @param[in]  strideDst  distance between two outputs in elements
+  @param[in]  nPE        Number of cores to use (or PLP_NPE_AUTO)
+  @param[out] pDst       points to the first matrix of the batch of outputs
+  @return     0: Success, 1: at least one matrix is singular, 2: operation not supported
+*/
+
+int plp_mat_inv_batch_f32(float *__restrict__ pSrc,
+                          uint32_t N,
+                          uint32_t count,
+                          uint32_t strideSrc,
+                          uint32_t strideDst,
+                          uint32_t nPE,
+                          float *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      Parallel batched matrix inversion of 32-bit floating-point matrices kernel
+              for XPULPV2 extension.
+  @param[in]  args  pointer to plp_mat_inv_batch_instance_f32 struct initialized by
+                    plp_mat_inv_batch_f32
+  @return     none
+*/
+
+void plp_mat_inv_batch_f32p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+  @brief      Glue code for sparse matrix-vector multiplication of 32-bit floating-point matrices
+              in CSR format.
+  @param[in]  S         points to the sparse matrix of shape nRows x nCols in CSR format
+  @param[in]  pSrc      points to the input vector of length nCols
+  @param[out] pDst      points to the output vector of length nRows
+  @return     none
+*/
+
+void plp_spmv_csr_f32(const plp_sparse_csr_f32 *__restrict__ S,
+                      const float *__restrict__ pSrc,
+                      float *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      Glue code for parallel sparse matrix-vector multiplication of 32-bit floating-point
+              matrices in CSR format.
+  @param[in]  S         points to the sparse matrix of shape nRows x nCols in CSR format
+  @param[in]  pSrc      points to the input vector of length nCols
+  @param[in]  nPE       Number of cores to use
+  @param[out] pDst      points to the output vector of length nRows
+  @return     none
+*/
+
+void plp_spmv_csr_f32_parallel(const plp_sparse_csr_f32 *__restrict__ S,
+                               const float *__restrict__ pSrc,
+                               uint32_t nPE,
+                               float *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      Sparse matrix-vector multiplication of 32-bit floating-point matrices in CSR format
+              kernel for XPULPV2 extension.
+  @param[in]  S         points to the sparse matrix of shape nRows x nCols in CSR format
+  @param[in]  pSrc      points to the input vector of length nCols
+  @param[out] pDst      points to the output vector of length nRows
+  @return     none
+*/
+
+void plp_spmv_csr_f32s_xpulpv2(const plp_sparse_csr_f32 *__restrict__ S,
+                               const float *__restrict__ pSrc,
+                               float *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      Parallel sparse matrix-vector multiplication of 32-bit floating-point matrices in CSR
+              format kernel for XPULPV2 extension.
+  @param[in]  args  pointer to plp_spmv_instance struct initialized by
+                    plp_spmv_csr_f32_parallel
+  @return     none
+*/
+
+void plp_spmv_csr_f32p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+  @brief      Glue code for sparse matrix-vector multiplication of 16-bit fix-point matrices in CSR
+              format.
+  @param[in]  S         points to the sparse matrix of shape nRows x nCols in CSR format
+  @param[in]  pSrc      points to the input vector of length nCols
+  @param[in]  shift     Amount to shift the accumulated result to the right
+  @param[out] pDst      points to the output vector of length nRows
+  @return     none
+*/
+
+void plp_spmv_csr_q16(const plp_sparse_csr_q16 *__restrict__ S,
+                      const int16_t *__restrict__ pSrc,
+                      uint32_t shift,
+                      int16_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      Glue code for parallel sparse matrix-vector multiplication of 16-bit fix-point
+              matrices in CSR format.
+  @param[in]  S         points to the sparse matrix of shape nRows x nCols in CSR format
+  @param[in]  pSrc      points to the input vector of length nCols
+  @param[in]  shift     Amount to shift the accumulated result to the right
+  @param[in]  nPE       Number of cores to use
+  @param[out] pDst      points to the output vector of length nRows
+  @return     none
+*/
+
+void plp_spmv_csr_q16_parallel(const plp_sparse_csr_q16 *__restrict__ S,
+                               const int16_t *__restrict__ pSrc,
+                               uint32_t shift,
+                               uint32_t nPE,
+                               int16_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      Sparse matrix-vector multiplication of 16-bit fix-point matrices in CSR format kernel
+              for RV32IM extension.
+  @param[in]  S         points to the sparse matrix of shape nRows x nCols in CSR format
+  @param[in]  pSrc      points to the input vector of length nCols
+  @param[in]  shift     Amount to shift the accumulated result to the right
+  @param[out] pDst      points to the output vector of length nRows
+  @return     none
+*/
+
+void plp_spmv_csr_q16s_rv32im(const plp_sparse_csr_q16 *__restrict__ S,
+                              const int16_t *__restrict__ pSrc,
+                              uint32_t shift,
+                              int16_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      Sparse matrix-vector multiplication of 16-bit fix-point matrices in CSR format kernel
+              for XPULPV2 extension.
+  @param[in]  S         points to the sparse matrix of shape nRows x nCols in CSR format
+  @param[in]  pSrc      points to the input vector of length nCols
+  @param[in]  shift     Amount to shift the accumulated result to the right
+  @param[out] pDst      points to the output vector of length nRows
+  @return     none
+*/
+
+void plp_spmv_csr_q16s_xpulpv2(const plp_sparse_csr_q16 *__restrict__ S,
+                               const int16_t *__restrict__ pSrc,
+                               uint32_t shift,
+                               int16_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      Parallel sparse matrix-vector multiplication of 16-bit fix-point matrices in CSR
+              format kernel for XPULPV2 extension.
+  @param[in]  args  pointer to plp_spmv_instance struct initialized by
+                    plp_spmv_csr_q16_parallel
+  @return     none
+*/
+
+void plp_spmv_csr_q16p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+  @brief      Glue code for sparse matrix-vector multiplication of 8-bit fix-point matrices in CSR
+              format.
+  @param[in]  S         points to the sparse matrix of shape nRows x nCols in CSR format
+  @param[in]  pSrc      points to the input vector of length nCols
+  @param[in]  shift     Amount to shift the accumulated result to the right
+  @param[out] pDst      points to the output vector of length nRows
+  @return     none
+*/
+
+void plp_spmv_csr_q8(const plp_sparse_csr_q8 *__restrict__ S,
+                     const int8_t *__restrict__ pSrc,
+                     uint32_t shift,
+                     int8_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      Glue code for parallel sparse matrix-vector multiplication of 8-bit fix-point
+              matrices in CSR format.
+  @param[in]  S         points to the sparse matrix of shape nRows x nCols in CSR format
+  @param[in]  pSrc      points to the input vector of length nCols
+  @param[in]  shift     Amount to shift the accumulated result to the right
+  @param[in]  nPE       Number of cores to use
+  @param[out] pDst      points to the output vector of length nRows
+  @return     none
+*/
+
+void plp_spmv_csr_q8_parallel(const plp_sparse_csr_q8 *__restrict__ S,
+                              const int8_t *__restrict__ pSrc,
+                              uint32_t shift,
+                              uint32_t nPE,
+                              int8_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      Sparse matrix-vector multiplication of 8-bit fix-point matrices in CSR format kernel
+              for RV32IM extension.
+  @param[in]  S         points to the sparse matrix of shape nRows x nCols in CSR format
+  @param[in]  pSrc      points to the input vector of length nCols
+  @param[in]  shift     Amount to shift the accumulated result to the right
+  @param[out] pDst      points to the output vector of length nRows
+  @return     none
+*/
+
+void plp_spmv_csr_q8s_rv32im(const plp_sparse_csr_q8 *__restrict__ S,
+                             const int8_t *__restrict__ pSrc,
+                             uint32_t shift,
+                             int8_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      Sparse matrix-vector multiplication of 8-bit fix-point matrices in CSR format kernel
+              for XPULPV2 extension.
+  @param[in]  S         points to the sparse matrix of shape nRows x nCols in CSR format
+  @param[in]  pSrc      points to the input vector of length nCols
+  @param[in]  shift     Amount to shift the accumulated result to the right
+  @param[out] pDst      points to the output vector of length nRows
+  @return     none
+*/
+
+void plp_spmv_csr_q8s_xpulpv2(const plp_sparse_csr_q8 *__restrict__ S,
+                              const int8_t *__restrict__ pSrc,
+                              uint32_t shift,
+                              int8_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      Parallel sparse matrix-vector multiplication of 8-bit fix-point matrices in CSR
+              format kernel for XPULPV2 extension.
+  @param[in]  args  pointer to plp_spmv_instance struct initialized by
+                    plp_spmv_csr_q8_parallel
+  @return     none
+*/
+
+void plp_spmv_csr_q8p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+  @brief      Glue code for sparse matrix-vector multiplication of 32-bit floating-point matrices
+              in ELL format.
+  @param[in]  S         points to the sparse matrix of shape nRows x nCols in ELL format
+  @param[in]  pSrc      points to the input vector of length nCols
+  @param[out] pDst      points to the output vector of length nRows
+  @return     none
+*/
+
+void plp_spmv_ell_f32(const plp_sparse_ell_f32 *__restrict__ S,
+                      const float *__restrict__ pSrc,
+                      float *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      Glue code for parallel sparse matrix-vector multiplication of 32-bit floating-point
+              matrices in ELL format.
+  @param[in]  S         points to the sparse matrix of shape nRows x nCols in ELL format
+  @param[in]  pSrc      points to the input vector of length nCols
+  @param[in]  nPE       Number of cores to use
+  @param[out] pDst      points to the output vector of length nRows
+  @return     none
+*/
+
+void plp_spmv_ell_f32_parallel(const plp_sparse_ell_f32 *__restrict__ S,
+                               const float *__restrict__ pSrc,
+                               uint32_t nPE,
+                               float *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      Sparse matrix-vector multiplication of 32-bit floating-point matrices in ELL format
+              kernel for XPULPV2 extension.
+  @param[in]  S         points to the sparse matrix of shape nRows x nCols in ELL format
+  @param[in]  pSrc      points to the input vector of length nCols
+  @param[out] pDst      points to the output vector of length nRows
+  @return     none
+*/
+
+void plp_spmv_ell_f32s_xpulpv2(const plp_sparse_ell_f32 *__restrict__ S,
+                               const float *__restrict__ pSrc,
+                               float *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      Parallel sparse matrix-vector multiplication of 32-bit floating-point matrices in ELL
+              format kernel for XPULPV2 extension.
+  @param[in]  args  pointer to plp_spmv_instance struct initialized by
+                    plp_spmv_ell_f32_parallel
+  @return     none
+*/
+
+void plp_spmv_ell_f32p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+  @brief      Glue code for sparse matrix-vector multiplication of 16-bit fix-point matrices in ELL
+              format.
+  @param[in]  S         points to the sparse matrix of shape nRows x nCols in ELL format
+  @param[in]  pSrc      points to the input vector of length nCols
+  @param[in]  shift     Amount to shift the accumulated result to the right
+  @param[out] pDst      points to the output vector of length nRows
+  @return     none
+*/
+
+void plp_spmv_ell_q16(const plp_sparse_ell_q16 *__restrict__ S,
+                      const int16_t *__restrict__ pSrc,
+                      uint32_t shift,
+                      int16_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      Glue code for parallel sparse matrix-vector multiplication of 16-bit fix-point
+              matrices in ELL format.
+  @param[in]  S         points to the sparse matrix of shape nRows x nCols in ELL format
+  @param[in]  pSrc      points to the input vector of length nCols
+  @param[in]  shift     Amount to shift the accumulated result to the right
+  @param[in]  nPE       Number of cores to use
+  @param[out] pDst      points to the output vector of length nRows
+  @return     none
+*/
+
+void plp_spmv_ell_q16_parallel(const plp_sparse_ell_q16 *__restrict__ S,
+                               const int16_t *__restrict__ pSrc,
+                               uint32_t shift,
+                               uint32_t nPE,
+                               int16_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      Sparse matrix-vector multiplication of 16-bit fix-point matrices in ELL format kernel
+              for RV32IM extension.
+  @param[in]  S         points to the sparse matrix of shape nRows x nCols in ELL format
+  @param[in]  pSrc      points to the input vector of length nCols
+  @param[in]  shift     Amount to shift the accumulated result to the right
+  @param[out] pDst      points to the output vector of length nRows
+  @return     none
+*/
+
+void plp_spmv_ell_q16s_rv32im(const plp_sparse_ell_q16 *__restrict__ S,
+                              const int16_t *__restrict__ pSrc,
+                              uint32_t shift,
+                              int16_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      Sparse matrix-vector multiplication of 16-bit fix-point matrices in ELL format kernel
+              for XPULPV2 extension.
+  @param[in]  S         points to the sparse matrix of shape nRows x nCols in ELL format
+  @param[in]  pSrc      points to the input vector of length nCols
+  @param[in]  shift     Amount to shift the accumulated result to the right
+  @param[out] pDst      points to the output vector of length nRows
+  @return     none
+*/
+
+void plp_spmv_ell_q16s_xpulpv2(const plp_sparse_ell_q16 *__restrict__ S,
+                               const int16_t *__restrict__ pSrc,
+                               uint32_t shift,
+                               int16_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      Parallel sparse matrix-vector multiplication of 16-bit fix-point matrices in ELL
+              format kernel for XPULPV2 extension.
+  @param[in]  args  pointer to plp_spmv_instance struct initialized by
+                    plp_spmv_ell_q16_parallel
+  @return     none
+*/
+
+void plp_spmv_ell_q16p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+  @brief      Glue code for sparse matrix-vector multiplication of 8-bit fix-point matrices in ELL
+              format.
+  @param[in]  S         points to the sparse matrix of shape nRows x nCols in ELL format
+  @param[in]  pSrc      points to the input vector of length nCols
+  @param[in]  shift     Amount to shift the accumulated result to the right
+  @param[out] pDst      points to the output vector of length nRows
+  @return     none
+*/
+
+void plp_spmv_ell_q8(const plp_sparse_ell_q8 *__restrict__ S,
+                     const int8_t *__restrict__ pSrc,
+                     uint32_t shift,
+                     int8_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      Glue code for parallel sparse matrix-vector multiplication of 8-bit fix-point
+              matrices in ELL format.
+  @param[in]  S         points to the sparse matrix of shape nRows x nCols in ELL format
+  @param[in]  pSrc      points to the input vector of length nCols
+  @param[in]  shift     Amount to shift the accumulated result to the right
+  @param[in]  nPE       Number of cores to use
+  @param[out] pDst      points to the output vector of length nRows
+  @return     none
+*/
+
+void plp_spmv_ell_q8_parallel(const plp_sparse_ell_q8 *__restrict__ S,
+                              const int8_t *__restrict__ pSrc,
+                              uint32_t shift,
+                              uint32_t nPE,
+                              int8_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      Sparse matrix-vector multiplication of 8-bit fix-point matrices in ELL format kernel
+              for RV32IM extension.
+  @param[in]  S         points to the sparse matrix of shape nRows x nCols in ELL format
+  @param[in]  pSrc      points to the input vector of length nCols
+  @param[in]  shift     Amount to shift the accumulated result to the right
+  @param[out] pDst      points to the output vector of length nRows
+  @return     none
+*/
+
+void plp_spmv_ell_q8s_rv32im(const plp_sparse_ell_q8 *__restrict__ S,
+                             const int8_t *__restrict__ pSrc,
+                             uint32_t shift,
+                             int8_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      Sparse matrix-vector multiplication of 8-bit fix-point matrices in ELL format kernel
+              for XPULPV2 extension.
+  @param[in]  S         points to the sparse matrix of shape nRows x nCols in ELL format
+  @param[in]  pSrc      points to the input vector of length nCols
+  @param[in]  shift     Amount to shift the accumulated result to the right
+  @param[out] pDst      points to the output vector of length nRows
+  @return     none
+*/
+
+void plp_spmv_ell_q8s_xpulpv2(const plp_sparse_ell_q8 *__restrict__ S,
+                              const int8_t *__restrict__ pSrc,
+                              uint32_t shift,
+                              int8_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      Parallel sparse matrix-vector multiplication of 8-bit fix-point matrices in ELL
+              format kernel for XPULPV2 extension.
+  @param[in]  args  pointer to plp_spmv_instance struct initialized by
+                    plp_spmv_ell_q8_parallel
+  @return     none
+*/
+
+void plp_spmv_ell_q8p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+  @brief      Glue code of matrix matrix multiplication for complex 32-bit integers
+  @param[in]  pSrcA Points to the first input matrix of shape MxN
+  @param[in]  pSrcB Points to the second input matrix of shape NxO
+  @param[in]  M     Height of matrix SrcA and DstC
+  @param[in]  N     Width of matrix SrcA and height of matrix SrcB
+  @param[in]  O     Width of matrix SrcB and DstC
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
+*/
+
+void plp_mat_mult_cmplx_i32(const int32_t *__restrict__ pSrcA,
+                            const int32_t *__restrict__ pSrcB,
+                            uint32_t M,
+                            uint32_t N,
+                            uint32_t O,
+                            int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+  @brief      Matrix matrix multiplication for complex 32-bit integers on RV32IM
+  @param[in]  pSrcA Points to the first input matrix of shape MxN
+  @param[in]  pSrcB Points to the second input matrix of shape NxO
+  @param[in]  M     Height of matrix SrcA and DstC
+  @param[in]  N     Width of matrix SrcA and height of matrix SrcB
+  @param[in]  O     Width of matrix SrcB and DstC
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
+*/
+
+void plp_mat_mult_cmplx_i32s_rv32im(const int32_t *__restrict__ pSrcA,
+                                    const int32_t *__restrict__ pSrcB,
+                                    uint32_t M,
+                                    uint32_t N,
+                                    uint32_t O,
+                                    int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+  @brief      Matrix matrix multiplication for complex 32-bit integers on XpulpV2
+  @param[in]  pSrcA Points to the first input matrix of shape MxN
+  @param[in]  pSrcB Points to the second input matrix of shape NxO
+  @param[in]  M     Height of matrix SrcA and DstC
+  @param[in]  N     Width of matrix SrcA and height of matrix SrcB
+  @param[in]  O     Width of matrix SrcB and DstC
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
+*/
+
+void plp_mat_mult_cmplx_i32s_xpulpv2(const int32_t *__restrict__ pSrcA,
+                                     const int32_t *__restrict__ pSrcB,
+                                     uint32_t M,
+                                     uint32_t N,
+                                     uint32_t O,
+                                     int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+  @brief      Glue code of parallel matrix matrix multiplication for complex 32-bit integers
+  @param[in]  pSrcA Points to the first input matrix of shape MxN
+  @param[in]  pSrcB Points to the second input matrix of shape NxO
+  @param[in]  M     Height of matrix SrcA and DstC
+  @param[in]  N     Width of matrix SrcA and height of matrix SrcB
+  @param[in]  O     Width of matrix SrcB and DstC
+  @param[in]  nPE   Number of cores to use for computation (or PLP_NPE_AUTO)
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
+*/
+
+void plp_mat_mult_cmplx_i32_parallel(const int32_t *__restrict__ pSrcA,
+                                     const int32_t *__restrict__ pSrcB,
+                                     uint32_t M,
+                                     uint32_t N,
+                                     uint32_t O,
+                                     uint32_t nPE,
+                                     int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+  @brief      parallel matrix matrix multiplication for complex 32-bit integers on XpulpV2
+  @param[in]  args  pointer to plp_mat_mult_cmplx_instance_i32 struct initialized by
+                    plp_mat_mult_cmplx_i32_parallel
+  @return     none
+*/
+
+void plp_mat_mult_cmplx_i32p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+  @brief      Glue code of matrix matrix multiplication for complex 16-bit integers
+  @param[in]  pSrcA Points to the first input matrix of shape MxN
+  @param[in]  pSrcB Points to the second input matrix of shape NxO
+  @param[in]  M     Height of matrix SrcA and DstC
+  @param[in]  N     Width of matrix SrcA and height of matrix SrcB
+  @param[in]  O     Width of matrix SrcB and DstC
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
+*/
+
+void plp_mat_mult_cmplx_i16(const int16_t *__restrict__ pSrcA,
+                            const int16_t *__restrict__ pSrcB,
+                            uint32_t M,
+                            uint32_t N,
+                            uint32_t O,
+                            int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+  @brief      Matrix matrix multiplication for complex 16-bit integers on RV32IM
+  @param[in]  pSrcA Points to the first input matrix of shape MxN
+  @param[in]  pSrcB Points to the second input matrix of shape NxO
+  @param[in]  M     Height of matrix SrcA and DstC
+  @param[in]  N     Width of matrix SrcA and height of matrix SrcB
+  @param[in]  O     Width of matrix SrcB and DstC
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
+*/
+
+void plp_mat_mult_cmplx_i16s_rv32im(const int16_t *__restrict__ pSrcA,
+                                    const int16_t *__restrict__ pSrcB,
+                                    uint32_t M,
+                                    uint32_t N,
+                                    uint32_t O,
+                                    int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+  @brief      Matrix matrix multiplication for complex 16-bit integers on XpulpV2
+  @param[in]  pSrcA Points to the first input matrix of shape MxN
+  @param[in]  pSrcB Points to the second input matrix of shape NxO
+  @param[in]  M     Height of matrix SrcA and DstC
+  @param[in]  N     Width of matrix SrcA and height of matrix SrcB
+  @param[in]  O     Width of matrix SrcB and DstC
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
+
+  @par Exploiting SIMD instructions
+  The 16 bit values are packed two each into 32 bit vectors and then the two dot products are
+  performed on 32 bit vectors, with 32 bit accumulator.
+*/
+
+void plp_mat_mult_cmplx_i16s_xpulpv2(const int16_t *__restrict__ pSrcA,
+                                     const int16_t *__restrict__ pSrcB,
+                                     uint32_t M,
+                                     uint32_t N,
+                                     uint32_t O,
+                                     int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+  @brief      Glue code of parallel matrix matrix multiplication for complex 16-bit integers
+  @param[in]  pSrcA Points to the first input matrix of shape MxN
+  @param[in]  pSrcB Points to the second input matrix of shape NxO
+  @param[in]  M     Height of matrix SrcA and DstC
+  @param[in]  N     Width of matrix SrcA and height of matrix SrcB
+  @param[in]  O     Width of matrix SrcB and DstC
+  @param[in]  nPE   Number of cores to use for computation (or PLP_NPE_AUTO)
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
+*/
+
+void plp_mat_mult_cmplx_i16_parallel(const int16_t *__restrict__ pSrcA,
+                                     const int16_t *__restrict__ pSrcB,
+                                     uint32_t M,
+                                     uint32_t N,
+                                     uint32_t O,
+                                     uint32_t nPE,
+                                     int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+  @brief      parallel matrix matrix multiplication for complex 16-bit integers on XpulpV2
+  @param[in]  args  pointer to plp_mat_mult_cmplx_instance_i16 struct initialized by
+                    plp_mat_mult_cmplx_i16_parallel
+  @return     none
+
+  @par Exploiting SIMD instructions
+  The 16 bit values are packed two each into 32 bit vectors and then the two dot products are
+  performed on 32 bit vectors, with 32 bit accumulator.
+*/
+
+void plp_mat_mult_cmplx_i16p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+  @brief      Glue code of matrix matrix multiplication for complex 8-bit integers
+  @param[in]  pSrcA Points to the first input matrix of shape MxN
+  @param[in]  pSrcB Points to the second input matrix of shape NxO
+  @param[in]  M     Height of matrix SrcA and DstC
+  @param[in]  N     Width of matrix SrcA and height of matrix SrcB
+  @param[in]  O     Width of matrix SrcB and DstC
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
+*/
+
+void plp_mat_mult_cmplx_i8(const int8_t *__restrict__ pSrcA,
+                           const int8_t *__restrict__ pSrcB,
+                           uint32_t M,
+                           uint32_t N,
+                           uint32_t O,
+                           int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+  @brief      Matrix matrix multiplication for complex 8-bit integers on RV32IM
+  @param[in]  pSrcA Points to the first input matrix of shape MxN
+  @param[in]  pSrcB Points to the second input matrix of shape NxO
+  @param[in]  M     Height of matrix SrcA and DstC
+  @param[in]  N     Width of matrix SrcA and height of matrix SrcB
+  @param[in]  O     Width of matrix SrcB and DstC
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
+*/
+
+void plp_mat_mult_cmplx_i8s_rv32im(const int8_t *__restrict__ pSrcA,
+                                   const int8_t *__restrict__ pSrcB,
+                                   uint32_t M,
+                                   uint32_t N,
+                                   uint32_t O,
+                                   int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+  @brief      Matrix matrix multiplication for complex 8-bit integers on XpulpV2
+  @param[in]  pSrcA Points to the first input matrix of shape MxN
+  @param[in]  pSrcB Points to the second input matrix of shape NxO
+  @param[in]  M     Height of matrix SrcA and DstC
+  @param[in]  N     Width of matrix SrcA and height of matrix SrcB
+  @param[in]  O     Width of matrix SrcB and DstC
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
+
+  @par Exploiting SIMD instructions
+  The 8 bit values are packed four each into 32 bit vectors and then the four dot products are
+  performed on 32 bit vectors, with 32 bit accumulator.
+*/
+
+void plp_mat_mult_cmplx_i8s_xpulpv2(const int8_t *__restrict__ pSrcA,
+                                    const int8_t *__restrict__ pSrcB,
+                                    uint32_t M,
+                                    uint32_t N,
+                                    uint32_t O,
+                                    int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+  @brief      Glue code of parallel matrix matrix multiplication for complex 8-bit integers
+  @param[in]  pSrcA Points to the first input matrix of shape MxN
+  @param[in]  pSrcB Points to the second input matrix of shape NxO
+  @param[in]  M     Height of matrix SrcA and DstC
+  @param[in]  N     Width of matrix SrcA and height of matrix SrcB
+  @param[in]  O     Width of matrix SrcB and DstC
+  @param[in]  nPE   Number of cores to use for computation (or PLP_NPE_AUTO)
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
+*/
+
+void plp_mat_mult_cmplx_i8_parallel(const int8_t *__restrict__ pSrcA,
+                                    const int8_t *__restrict__ pSrcB,
+                                    uint32_t M,
+                                    uint32_t N,
+                                    uint32_t O,
+                                    uint32_t nPE,
+                                    int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+  @brief      parallel matrix matrix multiplication for complex 8-bit integers on XpulpV2
+  @param[in]  args  pointer to plp_mat_mult_cmplx_instance_i8 struct initialized by
+                    plp_mat_mult_cmplx_i8_parallel
+  @return     none
+
+  @par Exploiting SIMD instructions
+  The 8 bit values are packed four each into 32 bit vectors and then the four dot products are
+  performed on 32 bit vectors, with 32 bit accumulator.
+*/
+
+void plp_mat_mult_cmplx_i8p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+  @brief      Glue code of matrix matrix multiplication for complex 32-bit floats
+  @param[in]  pSrcA Points to the first input matrix of shape MxN
+  @param[in]  pSrcB Points to the second input matrix of shape NxO
+  @param[in]  M     Height of matrix SrcA and DstC
+  @param[in]  N     Width of matrix SrcA and height of matrix SrcB
+  @param[in]  O     Width of matrix SrcB and DstC
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
+*/
+
+void plp_mat_mult_cmplx_f32(const float *__restrict__ pSrcA,
+                            const float *__restrict__ pSrcB,
+                            uint32_t M,
+                            uint32_t N,
+                            uint32_t O,
+                            float *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+  @brief      Matrix matrix multiplication for complex 32-bit floats on XpulpV2
+  @param[in]  pSrcA Points to the first input matrix of shape MxN
+  @param[in]  pSrcB Points to the second input matrix of shape NxO
+  @param[in]  M     Height of matrix SrcA and DstC
+  @param[in]  N     Width of matrix SrcA and height of matrix SrcB
+  @param[in]  O     Width of matrix SrcB and DstC
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
+*/
+
+void plp_mat_mult_cmplx_f32s_xpulpv2(const float *__restrict__ pSrcA,
+                                     const float *__restrict__ pSrcB,
+                                     uint32_t M,
+                                     uint32_t N,
+                                     uint32_t O,
+                                     float *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+  @brief      Glue code of parallel matrix matrix multiplication for complex 32-bit floats
+  @param[in]  pSrcA Points to the first input matrix of shape MxN
+  @param[in]  pSrcB Points to the second input matrix of shape NxO
+  @param[in]  M     Height of matrix SrcA and DstC
+  @param[in]  N     Width of matrix SrcA and height of matrix SrcB
+  @param[in]  O     Width of matrix SrcB and DstC
+  @param[in]  nPE   Number of cores to use for computation (or PLP_NPE_AUTO)
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
+*/
+
+void plp_mat_mult_cmplx_f32_parallel(const float *__restrict__ pSrcA,
+                                     const float *__restrict__ pSrcB,
+                                     uint32_t M,
+                                     uint32_t N,
+                                     uint32_t O,
+                                     uint32_t nPE,
+                                     float *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+  @brief      parallel matrix matrix multiplication for complex 32-bit floats on XpulpV2
+  @param[in]  args  pointer to plp_mat_mult_cmplx_instance_f32 struct initialized by
+                    plp_mat_mult_cmplx_f32_parallel
+  @return     none
+*/
+
+void plp_mat_mult_cmplx_f32p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+  @brief      Glue code of matrix matrix multiplication for complex 32-bit fix-point
+  @param[in]  pSrcA Points to the first input matrix of shape MxN
+  @param[in]  pSrcB Points to the second input matrix of shape NxO
+  @param[in]  M     Height of matrix SrcA and DstC
+  @param[in]  N     Width of matrix SrcA and height of matrix SrcB
+  @param[in]  O     Width of matrix SrcB and DstC
+  @param[in]  shift Amount to shift the result of each multiplication ot the right
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
+
+  @par Fix-Point
+  Fix-Point and Shifting
+  The result will be shifted by the parameter `shift` to the right (which corresponds to a
+  multiplication by `2^-shift`). Assume that matrix A is represente as `pSrcA * 2^-x` and matrix B
+  as `pSrcB * 2^-y` (which means that A has `x`, and B has `y` bits after the binary point). Then,
+  the output matrix C is represented as `pDstC * 2^-(x + y - shift)`.
+  The output matrix is also stored with the same number of bits as the inputs. Set the
+  `shift` parameter such that no overflow occurrs.
+*/
+
+void plp_mat_mult_cmplx_q32(const int32_t *__restrict__ pSrcA,
+                            const int32_t *__restrict__ pSrcB,
+                            uint32_t M,
+                            uint32_t N,
+                            uint32_t O,
+                            uint32_t shift,
+                            int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+  @brief      Matrix matrix multiplication for complex 32-bit fix-point on RV32IM
+  @param[in]  pSrcA Points to the first input matrix of shape MxN
+  @param[in]  pSrcB Points to the second input matrix of shape NxO
+  @param[in]  M     Height of matrix SrcA and DstC
+  @param[in]  N     Width of matrix SrcA and height of matrix SrcB
+  @param[in]  O     Width of matrix SrcB and DstC
+  @param[in]  shift Amount to shift the result of each multiplication ot the right
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
+
+  @par Fix-Point
+  Fix-Point and Shifting
+  The result will be shifted by the parameter `shift` to the right (which corresponds to a
+  multiplication by `2^-shift`). Assume that matrix A is represente as `pSrcA * 2^-x` and matrix B
+  as `pSrcB * 2^-y` (which means that A has `x`, and B has `y` bits after the binary point). Then,
+  the output matrix C is represented as `pDstC * 2^-(x + y - shift)`.
+  The output matrix is also stored with the same number of bits as the inputs. Set the
+  `shift` parameter such that no overflow occurrs.
+*/
+
+void plp_mat_mult_cmplx_q32s_rv32im(const int32_t *__restrict__ pSrcA,
+                                    const int32_t *__restrict__ pSrcB,
+                                    uint32_t M,
+                                    uint32_t N,
+                                    uint32_t O,
+                                    uint32_t shift,
+                                    int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+  @brief      Matrix matrix multiplication for complex 32-bit fix-point on XpulpV2
+  @param[in]  pSrcA Points to the first input matrix of shape MxN
+  @param[in]  pSrcB Points to the second input matrix of shape NxO
+  @param[in]  M     Height of matrix SrcA and DstC
+  @param[in]  N     Width of matrix SrcA and height of matrix SrcB
+  @param[in]  O     Width of matrix SrcB and DstC
+  @param[in]  shift Amount to shift the result of each multiplication ot the right
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
+
+  @par Fix-Point
+  Fix-Point and Shifting
+  The result will be shifted by the parameter `shift` to the right (which corresponds to a
+  multiplication by `2^-shift`). Assume that matrix A is represente as `pSrcA * 2^-x` and matrix B
+  as `pSrcB * 2^-y` (which means that A has `x`, and B has `y` bits after the binary point). Then,
+  the output matrix C is represented as `pDstC * 2^-(x + y - shift)`.
+  The output matrix is also stored with the same number of bits as the inputs. Set the
+  `shift` parameter such that no overflow occurrs.
+*/
+
+void plp_mat_mult_cmplx_q32s_xpulpv2(const int32_t *__restrict__ pSrcA,
+                                     const int32_t *__restrict__ pSrcB,
+                                     uint32_t M,
+                                     uint32_t N,
+                                     uint32_t O,
+                                     uint32_t shift,
+                                     int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+  @brief      Glue code of parallel matrix matrix multiplication for complex 32-bit fix-point
+  @param[in]  pSrcA Points to the first input matrix of shape MxN
+  @param[in]  pSrcB Points to the second input matrix of shape NxO
+  @param[in]  M     Height of matrix SrcA and DstC
+  @param[in]  N     Width of matrix SrcA and height of matrix SrcB
+  @param[in]  O     Width of matrix SrcB and DstC
+  @param[in]  shift Amount to shift the result of each multiplication ot the right
+  @param[in]  nPE   Number of cores to use for computation (or PLP_NPE_AUTO)
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
+
+  @par Fix-Point
+  Fix-Point and Shifting
+  The result will be shifted by the parameter `shift` to the right (which corresponds to a
+  multiplication by `2^-shift`). Assume that matrix A is represente as `pSrcA * 2^-x` and matrix B
+  as `pSrcB * 2^-y` (which means that A has `x`, and B has `y` bits after the binary point). Then,
+  the output matrix C is represented as `pDstC * 2^-(x + y - shift)`.
+  The output matrix is also stored with the same number of bits as the inputs. Set the
+  `shift` parameter such that no overflow occurrs.
+*/
+
+void plp_mat_mult_cmplx_q32_parallel(const int32_t *__restrict__ pSrcA,
+                                     const int32_t *__restrict__ pSrcB,
+                                     uint32_t M,
+                                     uint32_t N,
+                                     uint32_t O,
+                                     uint32_t shift,
+                                     uint32_t nPE,
+                                     int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+  @brief      parallel matrix matrix multiplication for complex 32-bit fix-point on XpulpV2
+  @param[in]  args  pointer to plp_mat_mult_cmplx_instance_q32 struct initialized by
+                    plp_mat_mult_cmplx_q32_parallel
+  @return     none
+
+  @par Fix-Point
+  Fix-Point and Shifting
+  The result will be shifted by the parameter `shift` to the right (which corresponds to a
+  multiplication by `2^-shift`). Assume that matrix A is represente as `pSrcA * 2^-x` and matrix B
+  as `pSrcB * 2^-y` (which means that A has `x`, and B has `y` bits after the binary point). Then,
+  the output matrix C is represented as `pDstC * 2^-(x + y - shift)`.
+  The output matrix is also stored with the same number of bits as the inputs. Set the
+  `shift` parameter such that no overflow occurrs.
+*/
+
+void plp_mat_mult_cmplx_q32p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+  @brief      Glue code of matrix matrix multiplication for complex 16-bit fix-point
+  @param[in]  pSrcA Points to the first input matrix of shape MxN
+  @param[in]  pSrcB Points to the second input matrix of shape NxO
+  @param[in]  M     Height of matrix SrcA and DstC
+  @param[in]  N     Width of matrix SrcA and height of matrix SrcB
+  @param[in]  O     Width of matrix SrcB and DstC
+  @param[in]  shift Amount to shift the result of each multiplication ot the right
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
+
+  @par Fix-Point
+  Fix-Point and Shifting
+  The result will be shifted by the parameter `shift` to the right (which corresponds to a
+  multiplication by `2^-shift`). Assume that matrix A is represente as `pSrcA * 2^-x` and matrix B
+  as `pSrcB * 2^-y` (which means that A has `x`, and B has `y` bits after the binary point). Then,
+  the output matrix C is represented as `pDstC * 2^-(x + y - shift)`.
+  The output matrix is also stored with the same number of bits as the inputs. Set the
+  `shift` parameter such that no overflow occurrs.
+*/
+
+void plp_mat_mult_cmplx_q16(const int16_t *__restrict__ pSrcA,
+                            const int16_t *__restrict__ pSrcB,
+                            uint32_t M,
+                            uint32_t N,
+                            uint32_t O,
+                            uint32_t shift,
+                            int16_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+  @brief      Matrix matrix multiplication for complex 16-bit fix-point on RV32IM
+  @param[in]  pSrcA Points to the first input matrix of shape MxN
+  @param[in]  pSrcB Points to the second input matrix of shape NxO
+  @param[in]  M     Height of matrix SrcA and DstC
+  @param[in]  N     Width of matrix SrcA and height of matrix SrcB
+  @param[in]  O     Width of matrix SrcB and DstC
+  @param[in]  shift Amount to shift the result of each multiplication ot the right
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
+
+  @par Fix-Point
+  Fix-Point and Shifting
+  The result will be shifted by the parameter `shift` to the right (which corresponds to a
+  multiplication by `2^-shift`). Assume that matrix A is represente as `pSrcA * 2^-x` and matrix B
+  as `pSrcB * 2^-y` (which means that A has `x`, and B has `y` bits after the binary point). Then,
+  the output matrix C is represented as `pDstC * 2^-(x + y - shift)`.
+  The output matrix is also stored with the same number of bits as the inputs. Set the
+  `shift` parameter such that no overflow occurrs.
+*/
+
+void plp_mat_mult_cmplx_q16s_rv32im(const int16_t *__restrict__ pSrcA,
+                                    const int16_t *__restrict__ pSrcB,
+                                    uint32_t M,
+                                    uint32_t N,
+                                    uint32_t O,
+                                    uint32_t shift,
+                                    int16_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+  @brief      Matrix matrix multiplication for complex 16-bit fix-point on XpulpV2
+  @param[in]  pSrcA Points to the first input matrix of shape MxN
+  @param[in]  pSrcB Points to the second input matrix of shape NxO
+  @param[in]  M     Height of matrix SrcA and DstC
+  @param[in]  N     Width of matrix SrcA and height of matrix SrcB
+  @param[in]  O     Width of matrix SrcB and DstC
+  @param[in]  shift Amount to shift the result of each multiplication ot the right
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
+
+  @par Fix-Point
+  Fix-Point and Shifting
+  The result will be shifted by the parameter `shift` to the right (which corresponds to a
+  multiplication by `2^-shift`). Assume that matrix A is represente as `pSrcA * 2^-x` and matrix B
+  as `pSrcB * 2^-y` (which means that A has `x`, and B has `y` bits after the binary point). Then,
+  the output matrix C is represented as `pDstC * 2^-(x + y - shift)`.
+  The output matrix is also stored with the same number of bits as the inputs. Set the
+  `shift` parameter such that no overflow occurrs.
+
+  @par Exploiting SIMD instructions
+  The 16 bit values are packed two each into 32 bit vectors and then the two dot products are
+  performed on 32 bit vectors, with 32 bit accumulator.
+*/
+
+void plp_mat_mult_cmplx_q16s_xpulpv2(const int16_t *__restrict__ pSrcA,
+                                     const int16_t *__restrict__ pSrcB,
+                                     uint32_t M,
+                                     uint32_t N,
+                                     uint32_t O,
+                                     uint32_t shift,
+                                     int16_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+  @brief      Glue code of parallel matrix matrix multiplication for complex 16-bit fix-point
+  @param[in]  pSrcA Points to the first input matrix of shape MxN
+  @param[in]  pSrcB Points to the second input matrix of shape NxO
+  @param[in]  M     Height of matrix SrcA and DstC
+  @param[in]  N     Width of matrix SrcA and height of matrix SrcB
+  @param[in]  O     Width of matrix SrcB and DstC
+  @param[in]  shift Amount to shift the result of each multiplication ot the right
+  @param[in]  nPE   Number of cores to use for computation (or PLP_NPE_AUTO)
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
+
+  @par Fix-Point
+  Fix-Point and Shifting
+  The result will be shifted by the parameter `shift` to the right (which corresponds to a
+  multiplication by `2^-shift`). Assume that matrix A is represente as `pSrcA * 2^-x` and matrix B
+  as `pSrcB * 2^-y` (which means that A has `x`, and B has `y` bits after the binary point). Then,
+  the output matrix C is represented as `pDstC * 2^-(x + y - shift)`.
+  The output matrix is also stored with the same number of bits as the inputs. Set the
+  `shift` parameter such that no overflow occurrs.
+*/
+
+void plp_mat_mult_cmplx_q16_parallel(const int16_t *__restrict__ pSrcA,
+                                     const int16_t *__restrict__ pSrcB,
+                                     uint32_t M,
+                                     uint32_t N,
+                                     uint32_t O,
+                                     uint32_t shift,
+                                     uint32_t nPE,
+                                     int16_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+  @brief      parallel matrix matrix multiplication for complex 16-bit fix-point on XpulpV2
+  @param[in]  args  pointer to plp_mat_mult_cmplx_instance_q16 struct initialized by
+                    plp_mat_mult_cmplx_q16_parallel
+  @return     none
+
+  @par Fix-Point
+  Fix-Point and Shifting
+  The result will be shifted by the parameter `shift` to the right (which corresponds to a
+  multiplication by `2^-shift`). Assume that matrix A is represente as `pSrcA * 2^-x` and matrix B
+  as `pSrcB * 2^-y` (which means that A has `x`, and B has `y` bits after the binary point). Then,
+  the output matrix C is represented as `pDstC * 2^-(x + y - shift)`.
+  The output matrix is also stored with the same number of bits as the inputs. Set the
+  `shift` parameter such that no overflow occurrs.
+
+  @par Exploiting SIMD instructions
+  The 16 bit values are packed two each into 32 bit vectors and then the two dot products are
+  performed on 32 bit vectors, with 32 bit accumulator.
+*/
+
+void plp_mat_mult_cmplx_q16p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+  @brief      Glue code of matrix matrix multiplication for complex 8-bit fix-point
+  @param[in]  pSrcA Points to the first input matrix of shape MxN
+  @param[in]  pSrcB Points to the second input matrix of shape NxO
+  @param[in]  M     Height of matrix SrcA and DstC
+  @param[in]  N     Width of matrix SrcA and height of matrix SrcB
+  @param[in]  O     Width of matrix SrcB and DstC
+  @param[in]  shift Amount to shift the result of each multiplication ot the right
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
+
+  @par Fix-Point
+  Fix-Point and Shifting
+  The result will be shifted by the parameter `shift` to the right (which corresponds to a
+  multiplication by `2^-shift`). Assume that matrix A is represente as `pSrcA * 2^-x` and matrix B
+  as `pSrcB * 2^-y` (which means that A has `x`, and B has `y` bits after the binary point). Then,
+  the output matrix C is represented as `pDstC * 2^-(x + y - shift)`.
+  The output matrix is also stored with the same number of bits as the inputs. Set the
+  `shift` parameter such that no overflow occurrs.
+*/
+
+void plp_mat_mult_cmplx_q8(const int8_t *__restrict__ pSrcA,
+                           const int8_t *__restrict__ pSrcB,
+                           uint32_t M,
+                           uint32_t N,
+                           uint32_t O,
+                           uint32_t shift,
+                           int8_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+  @brief      Matrix matrix multiplication for complex 8-bit fix-point on RV32IM
+  @param[in]  pSrcA Points to the first input matrix of shape MxN
+  @param[in]  pSrcB Points to the second input matrix of shape NxO
+  @param[in]  M     Height of matrix SrcA and DstC
+  @param[in]  N     Width of matrix SrcA and height of matrix SrcB
+  @param[in]  O     Width of matrix SrcB and DstC
+  @param[in]  shift Amount to shift the result of each multiplication ot the right
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
+
+  @par Fix-Point
+  Fix-Point and Shifting
+  The result will be shifted by the parameter `shift` to the right (which corresponds to a
+  multiplication by `2^-shift`). Assume that matrix A is represente as `pSrcA * 2^-x` and matrix B
+  as `pSrcB * 2^-y` (which means that A has `x`, and B has `y` bits after the binary point). Then,
+  the output matrix C is represented as `pDstC * 2^-(x + y - shift)`.
+  The output matrix is also stored with the same number of bits as the inputs. Set the
+  `shift` parameter such that no overflow occurrs.
+*/
+
+void plp_mat_mult_cmplx_q8s_rv32im(const int8_t *__restrict__ pSrcA,
+                                   const int8_t *__restrict__ pSrcB,
+                                   uint32_t M,
+                                   uint32_t N,
+                                   uint32_t O,
+                                   uint32_t shift,
+                                   int8_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+  @brief      Matrix matrix multiplication for complex 8-bit fix-point on XpulpV2
+  @param[in]  pSrcA Points to the first input matrix of shape MxN
+  @param[in]  pSrcB Points to the second input matrix of shape NxO
+  @param[in]  M     Height of matrix SrcA and DstC
+  @param[in]  N     Width of matrix SrcA and height of matrix SrcB
+  @param[in]  O     Width of matrix SrcB and DstC
+  @param[in]  shift Amount to shift the result of each multiplication ot the right
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
+
+  @par Fix-Point
+  Fix-Point and Shifting
+  The result will be shifted by the parameter `shift` to the right (which corresponds to a
+  multiplication by `2^-shift`). Assume that matrix A is represente as `pSrcA * 2^-x` and matrix B
+  as `pSrcB * 2^-y` (which means that A has `x`, and B has `y` bits after the binary point). Then,
+  the output matrix C is represented as `pDstC * 2^-(x + y - shift)`.
+  The output matrix is also stored with the same number of bits as the inputs. Set the
+  `shift` parameter such that no overflow occurrs.
+
+  @par Exploiting SIMD instructions
+  The 8 bit values are packed four each into 32 bit vectors and then the four dot products are
+  performed on 32 bit vectors, with 32 bit accumulator.
+*/
+
+void plp_mat_mult_cmplx_q8s_xpulpv2(const int8_t *__restrict__ pSrcA,
+                                    const int8_t *__restrict__ pSrcB,
+                                    uint32_t M,
+                                    uint32_t N,
+                                    uint32_t O,
+                                    uint32_t shift,
+                                    int8_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+  @brief      Glue code of parallel matrix matrix multiplication for complex 8-bit fix-point
+  @param[in]  pSrcA Points to the first input matrix of shape MxN
+  @param[in]  pSrcB Points to the second input matrix of shape NxO
+  @param[in]  M     Height of matrix SrcA and DstC
+  @param[in]  N     Width of matrix SrcA and height of matrix SrcB
+  @param[in]  O     Width of matrix SrcB and DstC
+  @param[in]  shift Amount to shift the result of each multiplication ot the right
+  @param[in]  nPE   Number of cores to use for computation (or PLP_NPE_AUTO)
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
+
+  @par Fix-Point
+  Fix-Point and Shifting
+  The result will be shifted by the parameter `shift` to the right (which corresponds to a
+  multiplication by `2^-shift`). Assume that matrix A is represente as `pSrcA * 2^-x` and matrix B
+  as `pSrcB * 2^-y` (which means that A has `x`, and B has `y` bits after the binary point). Then,
+  the output matrix C is represented as `pDstC * 2^-(x + y - shift)`.
+  The output matrix is also stored with the same number of bits as the inputs. Set the
+  `shift` parameter such that no overflow occurrs.
+*/
+
+void plp_mat_mult_cmplx_q8_parallel(const int8_t *__restrict__ pSrcA,
+                                    const int8_t *__restrict__ pSrcB,
+                                    uint32_t M,
+                                    uint32_t N,
+                                    uint32_t O,
+                                    uint32_t shift,
+                                    uint32_t nPE,
+                                    int8_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+  @brief      parallel matrix matrix multiplication for complex 8-bit fix-point on XpulpV2
+  @param[in]  args  pointer to plp_mat_mult_cmplx_instance_q8 struct initialized by
+                    plp_mat_mult_cmplx_q8_parallel
+  @return     none
+
+  @par Fix-Point
+  Fix-Point and Shifting
+  The result will be shifted by the parameter `shift` to the right (which corresponds to a
+  multiplication by `2^-shift`). Assume that matrix A is represente as `pSrcA * 2^-x` and matrix B
+  as `pSrcB * 2^-y` (which means that A has `x`, and B has `y` bits after the binary point). Then,
+  the output matrix C is represented as `pDstC * 2^-(x + y - shift)`.
+  The output matrix is also stored with the same number of bits as the inputs. Set the
+  `shift` parameter such that no overflow occurrs.
+
+  @par Exploiting SIMD instructions
+  The 8 bit values are packed four each into 32 bit vectors and then the four dot products are
+  performed on 32 bit vectors, with 32 bit accumulator.
+*/
+
+void plp_mat_mult_cmplx_q8p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+   @brief      Glue code for matrix transposed matrix multiplication of a 32-bit integer
+               matrices.
+   @param[in]  pSrcA points to first the input matrix
+   @param[in]  pSrcB points to second the input matrix
+   @param[in]  M     Height of first matrix
+   @param[in]  N     Width of first and heigt of second matrix
+   @param[in]  O     Width of second matrix
+   @param[out] pDstC Output is written here
+   @return     none
+*/
+
+void plp_mat_mult_trans_i32(const int32_t *__restrict__ pSrcA,
+                            const int32_t *__restrict__ pSrcB,
+                            uint32_t M,
+                            uint32_t N,
+                            uint32_t O,
+                            int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      Matrix transposed matrix multiplication of a 32-bit integer matrices for RV32IM
+               extension.
+   @param[in]  pSrcA points to first the input matrix
+   @param[in]  pSrcB points to second the input matrix
+   @param[in]  M     Height of first matrix
+   @param[in]  N     Width of first and heigt of second matrix
+   @param[in]  O     Width of second matrix
+   @param[out] pDstC Output is written here
+   @return     none
+*/
+
+void plp_mat_mult_trans_i32s_rv32im(const int32_t *__restrict__ pSrcA,
+                                    const int32_t *__restrict__ pSrcB,
+                                    uint32_t M,
+                                    uint32_t N,
+                                    uint32_t O,
+                                    int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      Matrix transposed matrix multiplication of a 32-bit integer matrices for XPULPV2
+               extension.
+   @param[in]  pSrcA points to first the input matrix
+   @param[in]  pSrcB points to second the input matrix
+   @param[in]  M     Height of first matrix
+   @param[in]  N     Width of first and heigt of second matrix
+   @param[in]  O     Width of second matrix
+   @param[out] pDstC Output is written here
+   @return     none
+*/
+
+void plp_mat_mult_trans_i32s_xpulpv2(const int32_t *__restrict__ pSrcA,
+                                     const int32_t *__restrict__ pSrcB,
+                                     uint32_t M,
+                                     uint32_t N,
+                                     uint32_t O,
+                                     int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      Glue code for matrix transposed matrix multiplication of a 16-bit integer
+               matrices.
+   @param[in]  pSrcA points to first the input matrix
+   @param[in]  pSrcB points to second the input matrix
+   @param[in]  M     Height of first matrix
+   @param[in]  N     Width of first and heigt of second matrix
+   @param[in]  O     Width of second matrix
+   @param[out] pDstC Output is written here
+   @return     none
+*/
+
+void plp_mat_mult_trans_i16(const int16_t *__restrict__ pSrcA,
+                            const int16_t *__restrict__ pSrcB,
+                            uint32_t M,
+                            uint32_t N,
+                            uint32_t O,
+                            int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      Matrix transposed matrix multiplication of a 16-bit integer matrices for RV32IM
+               extension.
+   @param[in]  pSrcA points to first the input matrix
+   @param[in]  pSrcB points to second the input matrix
+   @param[in]  M     Height of first matrix
+   @param[in]  N     Width of first and heigt of second matrix
+   @param[in]  O     Width of second matrix
+   @param[out] pDstC Output is written here
+   @return     none
+*/
+
+void plp_mat_mult_trans_i16s_rv32im(const int16_t *__restrict__ pSrcA,
+                                    const int16_t *__restrict__ pSrcB,
+                                    uint32_t M,
+                                    uint32_t N,
+                                    uint32_t O,
+                                    int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      Matrix transposed matrix multiplication of a 16-bit integer matrices for XPULPV2
+               extension.
+   @param[in]  pSrcA points to first the input matrix
+   @param[in]  pSrcB points to second the input matrix
+   @param[in]  M     Height of first matrix
+   @param[in]  N     Width of first and heigt of second matrix
+   @param[in]  O     Width of second matrix
+   @param[out] pDstC Output is written here
+   @return     none
+
+   @par Exploiting SIMD instructions
+   The 16 bit values are packed two each into 32 bit vectors and then the two dot products are
+   performed on 32 bit vectors, with 32 bit accumulator.
+*/
+
+void plp_mat_mult_trans_i16s_xpulpv2(const int16_t *__restrict__ pSrcA,
+                                     const int16_t *__restrict__ pSrcB,
+                                     uint32_t M,
+                                     uint32_t N,
+                                     uint32_t O,
+                                     int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      Glue code for matrix transposed matrix multiplication of a 8-bit integer matrices.
+   @param[in]  pSrcA points to first the input matrix
+   @param[in]  pSrcB points to second the input matrix
+   @param[in]  M     Height of first matrix
+   @param[in]  N     Width of first and heigt of second matrix
+   @param[in]  O     Width of second matrix
+   @param[out] pDstC Output is written here
+   @return     none
+*/
+
+void plp_mat_mult_trans_i8(const int8_t *__restrict__ pSrcA,
+                           const int8_t *__restrict__ pSrcB,
+                           uint32_t M,
+                           uint32_t N,
+                           uint32_t O,
+                           int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      Matrix transposed matrix multiplication of a 8-bit integer matrices for RV32IM
+   extension.
+   @param[in]  pSrcA points to first the input matrix
+   @param[in]  pSrcB points to second the input matrix
+   @param[in]  M     Height of first matrix
+   @param[in]  N     Width of first and heigt of second matrix
+   @param[in]  O     Width of second matrix
+   @param[out] pDstC Output is written here
+   @return     none
+*/
+
+void plp_mat_mult_trans_i8s_rv32im(const int8_t *__restrict__ pSrcA,
+                                   const int8_t *__restrict__ pSrcB,
+                                   uint32_t M,
+                                   uint32_t N,
+                                   uint32_t O,
+                                   int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      Matrix transposed matrix multiplication of a 8-bit integer matrices for XPULPV2
+   extension.
+   @param[in]  pSrcA points to first the input matrix
+   @param[in]  pSrcB points to second the input matrix
+   @param[in]  M     Height of first matrix
+   @param[in]  N     Width of first and heigt of second matrix
+   @param[in]  O     Width of second matrix
+   @param[out] pDstC Output is written here
+   @return     none
+
+   @par Exploiting SIMD instructions
+   The 8 bit values are packed four each into 32 bit vectors and then the four dot products are
+   performed on 32 bit vectors, with 32 bit accumulator.
+*/
+
+void plp_mat_mult_trans_i8s_xpulpv2(const int8_t *__restrict__ pSrcA,
+                                    const int8_t *__restrict__ pSrcB,
+                                    uint32_t M,
+                                    uint32_t N,
+                                    uint32_t O,
+                                    int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      Glue code for parallel matrix matrix multiplication of a 32-bit integer matrices.
+   @param[in]  pSrcA points to first the input matrix
+   @param[in]  pSrcB points to second the input matrix
+   @param[in]  M     Height of first matrix
+   @param[in]  N     Width of first and heigt of second matrix
+   @param[in]  O     Width of second matrix
+   @param[in]  nPE   Number of cores to use (or PLP_NPE_AUTO)
+   @param[out] pDstC Output is written here
+   @return     none
+*/
+
+void plp_mat_mult_trans_i32_parallel(const int32_t *__restrict__ pSrcA,
+                                     const int32_t *__restrict__ pSrcB,
+                                     uint32_t M,
+                                     uint32_t N,
+                                     uint32_t O,
+                                     uint32_t nPE,
+                                     int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      Parallel matrix transposed matrix multiplication of a 32-bit integer matrices for
+               RV32IM extension.
+   @param[in]  args  pointer to plp_mat_mult_instance_i32 struct initialized by
+                     plp_mat_mult_i32_parallel
+   @return     none
+*/
+
+void plp_mat_mult_trans_i32p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+   @brief      Glue code for parallel matrix transposed matrix multiplication of a 16-bit integer
+               matrices.
+   @param[in]  pSrcA points to first the input matrix
+   @param[in]  pSrcB points to second the input matrix
+   @param[in]  M     Height of first matrix
+   @param[in]  N     Width of first and heigt of second matrix
+   @param[in]  O     Width of second matrix
+   @param[in]  nPE   Number of cores to use (or PLP_NPE_AUTO)
+   @param[out] pDstC Output is written here
+   @return     none
+*/
+
+void plp_mat_mult_trans_i16_parallel(const int16_t *__restrict__ pSrcA,
+                                     const int16_t *__restrict__ pSrcB,
+                                     uint32_t M,
+                                     uint32_t N,
+                                     uint32_t O,
+                                     uint32_t nPE,
+                                     int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      Parallel matrix transposed matrix multiplication of a 16-bit integer matrices for
+               XPULPV2 extension.
+   @param[in]  args  pointer to plp_mat_mult_instance_i16 struct initialized by
+                     plp_mat_mult_i16_parallel
+   @return     none
+
+   @par Exploiting SIMD instructions
+   The 16 bit values are packed two each into 32 bit vectors and then the two dot products are
+   performed on 32 bit vectors, with 32 bit accumulator.
+*/
+
+void plp_mat_mult_trans_i16p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+   @brief      Glue code for parallel matrix transposed matrix multiplication of a 8-bit integer
+               matrices.
+   @param[in]  pSrcA points to first the input matrix
+   @param[in]  pSrcB points to second the input matrix
+   @param[in]  M     Height of first matrix
+   @param[in]  N     Width of first and heigt of second matrix
+   @param[in]  O     Width of second matrix
+   @param[in]  nPE   Number of cores to use (or PLP_NPE_AUTO)
+   @param[out] pDstC Output is written here
+   @return     none
+*/
+
+void plp_mat_mult_trans_i8_parallel(const int8_t *__restrict__ pSrcA,
+                                    const int8_t *__restrict__ pSrcB,
+                                    uint32_t M,
+                                    uint32_t N,
+                                    uint32_t O,
+                                    uint32_t nPE,
+                                    int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      Parallel matrix transposed matrix multiplication of a 8-bit integer matrices for
+               XPULPV2 extension.
+   @param[in]  args  pointer to plp_mat_mult_instance_i8 struct initialized by
+                     plp_mat_mult_i8_parallel
+   @return     none
+
+   @par Exploiting SIMD instructions
+   The 8 bit values are packed four each into 32 bit vectors and then the four dot products are
+   performed on 32 bit vectors, with 32 bit accumulator.
+*/
+
+void plp_mat_mult_trans_i8p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+   @brief      Glue code for matrix transposed matrix multiplication of a 32-bit fix-point
+               matrices.
+   @param[in]  pSrcA points to first the input matrix
+   @param[in]  pSrcB points to second the input matrix
+   @param[in]  M     Height of first matrix
+   @param[in]  N     Width of first and heigt of second matrix
+   @param[in]  O     Width of second matrix
+   @param[in]  shift Amount to shift the result of each multiplication.
+   @param[out] pDstC Output is written here
+   @return     none
+
+   @par Fix-Point and Shifting
+   The result will be shifted by the parameter `shift` to the right (multiplied
+   by 2^-shift). Assume that matrix A is represented as pSrcA * 2^-x, and matrix
+   B as pSrcB * 2^-y (in other words, A has it's x last digits after the binary
+   point). Then, the output is represented as pDstC * 2^-(x + y - shift).
+ */
+
+void plp_mat_mult_trans_q32(const int32_t *__restrict__ pSrcA,
+                            const int32_t *__restrict__ pSrcB,
+                            uint32_t M,
+                            uint32_t N,
+                            uint32_t O,
+                            uint32_t shift,
+                            int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      Glue code for parallel matrix transposed matrix multiplication of a 32-bit
+               fix-point matrices.
+   @param[in]  pSrcA points to first the input matrix
+   @param[in]  pSrcB points to second the input matrix
+   @param[in]  M     Height of first matrix
+   @param[in]  N     Width of first and heigt of second matrix
+   @param[in]  O     Width of second matrix
+   @param[in]  shift Amount to shift the result of each multiplication.
+   @param[in]  nPE   Number of cores to use (or PLP_NPE_AUTO)
+   @param[out] pDstC Output is written here
+   @return     none
+
+   @par Fix-Point and Shifting
+   The result will be shifted by the parameter `shift` to the right (multiplied
+   by 2^-shift). Assume that matrix A is represented as pSrcA * 2^-x, and matrix
+   B as pSrcB * 2^-y (in other words, A has it's x last digits after the binary
+   point). Then, the output is represented as pDstC * 2^-(x + y - shift).
+ */
+
+void plp_mat_mult_trans_q32_parallel(const int32_t *__restrict__ pSrcA,
+                                     const int32_t *__restrict__ pSrcB,
+                                     uint32_t M,
+                                     uint32_t N,
+                                     uint32_t O,
+                                     uint32_t shift,
+                                     uint32_t nPE,
+                                     int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      matrix transposed matrix multiplication of a 32-bit fix-point matrices for RV32IM
+               extension.
+   @param[in]  pSrcA points to first the input matrix
+   @param[in]  pSrcB points to second the input matrix
+   @param[in]  M     Height of first matrix
+   @param[in]  N     Width of first and heigt of second matrix
+   @param[in]  O     Width of second matrix
+   @param[in]  shift Amount to shift the result of each multiplication.
+   @param[out] pDstC Output is written here
+   @return     none
+
+   @par Fix-Point and Shifting
+   The result will be shifted by the parameter `shift` to the right (multiplied
+   by 2^-shift). Assume that matrix A is represented as pSrcA * 2^-x, and matrix
+   B as pSrcB * 2^-y (in other words, A has it's x last digits after the binary
+   point). Then, the output is represented as pDstC * 2^-(x + y - shift).
+*/
+
+void plp_mat_mult_trans_q32s_rv32im(const int32_t *__restrict__ pSrcA,
+                                    const int32_t *__restrict__ pSrcB,
+                                    uint32_t M,
+                                    uint32_t N,
+                                    uint32_t O,
+                                    uint32_t shift,
+                                    int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      matrix transposed matrix multiplication of a 32-bit fix-point matrices for XPULPV2
+               extension.
+   @param[in]  pSrcA points to first the input matrix
+   @param[in]  pSrcB points to second the input matrix
+   @param[in]  M     Height of first matrix
+   @param[in]  N     Width of first and heigt of second matrix
+   @param[in]  O     Width of second matrix
+   @param[in]  shift Amount to shift the result of each multiplication.
+   @param[out] pDstC Output is written here
+   @return     none
+
+   @par Fix-Point and Shifting
+   The result will be shifted by the parameter `shift` to the right (multiplied
+   by 2^-shift). Assume that matrix A is represented as pSrcA * 2^-x, and matrix
+   B as pSrcB * 2^-y (in other words, A has it's x last digits after the binary
+   point). Then, the output is represented as pDstC * 2^-(x + y - shift).
+*/
+
+void plp_mat_mult_trans_q32s_xpulpv2(const int32_t *__restrict__ pSrcA,
+                                     const int32_t *__restrict__ pSrcB,
+                                     uint32_t M,
+                                     uint32_t N,
+                                     uint32_t O,
+                                     uint32_t shift,
+                                     int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+    @brief      Parallel matrix transposed matrix multiplication of 32-bit fix-point matrices kernel
+                for XPULPV2 extension.
+    @param[in]  args  pointer to plp_mat_mult_instance_q32 struct initialized by
+                      plp_mat_mult_trans_q32_parallel
+    @return     none
+*/
+
+void plp_mat_mult_trans_q32p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+   @brief      Glue code for matrix transposed matrix multiplication of a 16-bit fix-point
+               matrices.
+   @param[in]  pSrcA points to first the input matrix
+   @param[in]  pSrcB points to second the input matrix
+   @param[in]  M     Height of first matrix
+   @param[in]  N     Width of first and heigt of second matrix
+   @param[in]  O     Width of second matrix
+   @param[in]  shift Amount to shift the result of each multiplication.
+   @param[out] pDstC Output is written here
+   @return     none
+
+   @par Fix-Point and Shifting
+   The result will be shifted by the parameter `shift` to the right (multiplied
+   by 2^-shift). Assume that matrix A is represented as pSrcA * 2^-x, and matrix
+   B as pSrcB * 2^-y (in other words, A has it's x last digits after the binary
+   point). Then, the output is represented as pDstC * 2^-(x + y - shift).
+
+   The output of the matrix multiplication will also be stored as an 16-bit array.
+   Set the `shift` parameter such that no overflow ocurrs.
+ */
+
+void plp_mat_mult_trans_q16(const int16_t *__restrict__ pSrcA,
+                            const int16_t *__restrict__ pSrcB,
+                            uint32_t M,
+                            uint32_t N,
+                            uint32_t O,
+                            uint32_t shift,
+                            int16_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      Glue code for parallel matrix transposed matrix multiplication of a 16-bit
+               fix-point matrices.
+   @param[in]  pSrcA points to first the input matrix
+   @param[in]  pSrcB points to second the input matrix
+   @param[in]  M     Height of first matrix
+   @param[in]  N     Width of first and heigt of second matrix
+   @param[in]  O     Width of second matrix
+   @param[in]  shift Amount to shift the result of each multiplication.
+   @param[in]  nPE   Number of cores to use (or PLP_NPE_AUTO)
+   @param[out] pDstC Output is written here
+   @return     none
+
+   @par Fix-Point and Shifting
+   The result will be shifted by the parameter `shift` to the right (multiplied
+   by 2^-shift). Assume that matrix A is represented as pSrcA * 2^-x, and matrix
+   B as pSrcB * 2^-y (in other words, A has it's x last digits after the binary
+   point). Then, the output is represented as pDstC * 2^-(x + y - shift).
+
+   The output of the matrix multiplication will also be stored as an 16-bit array.
+   Set the `shift` parameter such that no overflow ocurrs.
+ */
+
+void plp_mat_mult_trans_q16_parallel(const int16_t *__restrict__ pSrcA,
+                                     const int16_t *__restrict__ pSrcB,
+                                     uint32_t M,
+                                     uint32_t N,
+                                     uint32_t O,
+                                     uint32_t shift,
+                                     uint32_t nPE,
+                                     int16_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      matrix transposed matrix multiplication of a 16-bit fix-point matrices for RV32IM
+               extension.
+   @param[in]  pSrcA points to first the input matrix
+   @param[in]  pSrcB points to second the input matrix
+   @param[in]  M     Height of first matrix
+   @param[in]  N     Width of first and heigt of second matrix
+   @param[in]  O     Width of second matrix
+   @param[in]  shift Amount to shift the result of each multiplication.
+   @param[out] pDstC Output is written here
+   @return     none
+
+   @par Fix-Point and Shifting
+   The result will be shifted by the parameter `shift` to the right (multiplied
+   by 2^-shift). Assume that matrix A is represented as pSrcA * 2^-x, and matrix
+   B as pSrcB * 2^-y (in other words, A has it's x last digits after the binary
+   point). Then, the output is represented as pDstC * 2^-(x + y - shift).
+
+   The output of the matrix multiplication will also be stored as an 16-bit array.
+   Set the `shift` parameter such that no overflow ocurrs.
+*/
+
+void plp_mat_mult_trans_q16s_rv32im(const int16_t *__restrict__ pSrcA,
+                                    const int16_t *__restrict__ pSrcB,
+                                    uint32_t M,
+                                    uint32_t N,
+                                    uint32_t O,
+                                    uint32_t shift,
+                                    int16_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      matrix transposed matrix multiplication of a 16-bit fix-point matrices for XPULPV2
+               extension.
+   @param[in]  pSrcA points to first the input matrix
+   @param[in]  pSrcB points to second the input matrix
+   @param[in]  M     Height of first matrix
+   @param[in]  N     Width of first and heigt of second matrix
+   @param[in]  O     Width of second matrix
+   @param[in]  shift Amount to shift the result of each multiplication.
+   @param[out] pDstC Output is written here
+   @return     none
+
+   @par Fix-Point and Shifting
+   The result will be shifted by the parameter `shift` to the right (multiplied
+   by 2^-shift). Assume that matrix A is represented as pSrcA * 2^-x, and matrix
+   B as pSrcB * 2^-y (in other words, A has it's x last digits after the binary
+   point). Then, the output is represented as pDstC * 2^-(x + y - shift).
+
+   The output of the matrix multiplication will also be stored as an 16-bit array.
+   Set the `shift` parameter such that no overflow ocurrs.
+*/
+
+void plp_mat_mult_trans_q16s_xpulpv2(const int16_t *__restrict__ pSrcA,
+                                     const int16_t *__restrict__ pSrcB,
+                                     uint32_t M,
+                                     uint32_t N,
+                                     uint32_t O,
+                                     uint32_t shift,
+                                     int16_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+    @brief      Parallel matrix transposed matrix multiplication of 16-bit fix-point matrices kernel
+                for XPULPV2 extension.
+    @param[in]  args  pointer to plp_mat_mult_instance_q16 struct initialized by
+                      plp_mat_mult_trans_q16_parallel
+    @return     none
+*/
+
+void plp_mat_mult_trans_q16p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+   @brief      Glue code for matrix transposed matrix multiplication of a 8-bit fix-point
+               matrices.
+   @param[in]  pSrcA points to first the input matrix
+   @param[in]  pSrcB points to second the input matrix
+   @param[in]  M     Height of first matrix
+   @param[in]  N     Width of first and heigt of second matrix
+   @param[in]  O     Width of second matrix
+   @param[in]  shift Amount to shift the result of each multiplication.
+   @param[out] pDstC Output is written here
+   @return     none
+
+   @par Fix-Point and Shifting
+   The result will be shifted by the parameter `shift` to the right (multiplied
+   by 2^-shift). Assume that matrix A is represented as pSrcA * 2^-x, and matrix
+   B as pSrcB * 2^-y (in other words, A has it's x last digits after the binary
+   point). Then, the output is represented as pDstC * 2^-(x + y - shift).
+
+   The output of the matrix multiplication will also be stored as an 8-bit array.
+   Set the `shift` parameter such that no overflow ocurrs.
+ */
+
+void plp_mat_mult_trans_q8(const int8_t *__restrict__ pSrcA,
+                           const int8_t *__restrict__ pSrcB,
+                           uint32_t M,
+                           uint32_t N,
+                           uint32_t O,
+                           uint32_t shift,
+                           int8_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      Glue code for parallel matrix transposed matrix multiplication of a 8-bit
+               fix-point matrices.
+   @param[in]  pSrcA points to first the input matrix
+   @param[in]  pSrcB points to second the input matrix
+   @param[in]  M     Height of first matrix
+   @param[in]  N     Width of first and heigt of second matrix
+   @param[in]  O     Width of second matrix
+   @param[in]  shift Amount to shift the result of each multiplication.
+   @param[in]  nPE   Number of cores to use (or PLP_NPE_AUTO)
+   @param[out] pDstC Output is written here
+   @return     none
+
+   @par Fix-Point and Shifting
+   The result will be shifted by the parameter `shift` to the right (multiplied
+   by 2^-shift). Assume that matrix A is represented as pSrcA * 2^-x, and matrix
+   B as pSrcB * 2^-y (in other words, A has it's x last digits after the binary
+   point). Then, the output is represented as pDstC * 2^-(x + y - shift).
+
+   The output of the matrix multiplication will also be stored as an 8-bit array.
+   Set the `shift` parameter such that no overflow ocurrs.
+ */
+
+void plp_mat_mult_trans_q8_parallel(const int8_t *__restrict__ pSrcA,
+                                    const int8_t *__restrict__ pSrcB,
+                                    uint32_t M,
+                                    uint32_t N,
+                                    uint32_t O,
+                                    uint32_t shift,
+                                    uint32_t nPE,
+                                    int8_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      matrix transposed matrix multiplication of a 8-bit fix-point matrices for RV32IM
+               extension.
+   @param[in]  pSrcA points to first the input matrix
+   @param[in]  pSrcB points to second the input matrix
+   @param[in]  M     Height of first matrix
+   @param[in]  N     Width of first and heigt of second matrix
+   @param[in]  O     Width of second matrix
+   @param[in]  shift Amount to shift the result of each multiplication.
+   @param[out] pDstC Output is written here
+   @return     none
+
+   @par Fix-Point and Shifting
+   The result will be shifted by the parameter `shift` to the right (multiplied
+   by 2^-shift). Assume that matrix A is represented as pSrcA * 2^-x, and matrix
+   B as pSrcB * 2^-y (in other words, A has it's x last digits after the binary
+   point). Then, the output is represented as pDstC * 2^-(x + y - shift).
+
+   The output of the matrix multiplication will also be stored as an 8-bit array.
+   Set the `shift` parameter such that no overflow ocurrs.
+*/
+
+void plp_mat_mult_trans_q8s_rv32im(const int8_t *__restrict__ pSrcA,
+                                   const int8_t *__restrict__ pSrcB,
+                                   uint32_t M,
+                                   uint32_t N,
+                                   uint32_t O,
+                                   uint32_t shift,
+                                   int8_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      matrix transposed matrix multiplication of a 8-bit fix-point matrices for XPULPV2
+               extension.
+   @param[in]  pSrcA points to first the input matrix
+   @param[in]  pSrcB points to second the input matrix
+   @param[in]  M     Height of first matrix
+   @param[in]  N     Width of first and heigt of second matrix
+   @param[in]  O     Width of second matrix
+   @param[in]  shift Amount to shift the result of each multiplication.
+   @param[out] pDstC Output is written here
+   @return     none
+
+   @par Fix-Point and Shifting
+   The result will be shifted by the parameter `shift` to the right (multiplied
+   by 2^-shift). Assume that matrix A is represented as pSrcA * 2^-x, and matrix
+   B as pSrcB * 2^-y (in other words, A has it's x last digits after the binary
+   point). Then, the output is represented as pDstC * 2^-(x + y - shift).
+
+   The output of the matrix multiplication will also be stored as an 8-bit array.
+   Set the `shift` parameter such that no overflow ocurrs.
+*/
+
+void plp_mat_mult_trans_q8s_xpulpv2(const int8_t *__restrict__ pSrcA,
+                                    const int8_t *__restrict__ pSrcB,
+                                    uint32_t M,
+                                    uint32_t N,
+                                    uint32_t O,
+                                    uint32_t shift,
+                                    int8_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+    @brief      Parallel matrix transposed matrix multiplication of 8-bit fix-point matrices kernel
+                for XPULPV2 extension.
+    @param[in]  args  pointer to plp_mat_mult_instance_q8 struct initialized by
+                      plp_mat_mult_trans_q8_parallel
+    @return     none
+*/
+
+void plp_mat_mult_trans_q8p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+   @brief      Glue code for matrix transposed matrix multiplication of a 32-bit floating-point
+               matrices.
+   @param[in]  pSrcA points to first the input matrix
+   @param[in]  pSrcB points to second the input matrix
+   @param[in]  M     Height of first matrix
+   @param[in]  N     Width of first and heigt of second matrix
+   @param[in]  O     Width of second matrix
+   @param[out] pDstC Output is written here
+   @return     none
+*/
+
+void plp_mat_mult_trans_f32(const float *__restrict__ pSrcA,
+                            const float *__restrict__ pSrcB,
+                            uint32_t M,
+                            uint32_t N,
+                            uint32_t O,
+                            float *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      matrix transposed matrix multiplication of a 32-bit floating-point matrices for
+               XPULPV2 extension.
+   @param[in]  pSrcA points to first the input matrix
+   @param[in]  pSrcB points to second the input matrix
+   @param[in]  M     Height of first matrix
+   @param[in]  N     Width of first and heigt of second matrix
+   @param[in]  O     Width of second matrix
+   @param[out] pDstC Output is written here
+   @return     none
+*/
+
+void plp_mat_mult_trans_f32s_xpulpv2(const float *__restrict__ pSrcA,
+                                     const float *__restrict__ pSrcB,
+                                     uint32_t M,
+                                     uint32_t N,
+                                     uint32_t O,
+                                     float *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      Glue code for parallel matrix transposed matrix multiplication of a 32-bit
+               floating-point matrices.
+   @param[in]  pSrcA points to first the input matrix
+   @param[in]  pSrcB points to second the input matrix
+   @param[in]  M     Height of first matrix
+   @param[in]  N     Width of first and heigt of second matrix
+   @param[in]  O     Width of second matrix
+   @param[in]  nPE   Number of cores to use (or PLP_NPE_AUTO)
+   @param[out] pDstC Output is written here
+   @return     none
+*/
+
+void plp_mat_mult_trans_f32_parallel(const float *__restrict__ pSrcA,
+                                     const float *__restrict__ pSrcB,
+                                     uint32_t M,
+                                     uint32_t N,
+                                     uint32_t O,
+                                     uint32_t nPE,
+                                     float *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+    @brief      Parallel matrix transposed matrix multiplication of 32-bit floating-point matrices
+                kernel for XPULPV2 extension.
+    @param[in]  args  pointer to plp_mat_mult_instance_f32 struct initialized by
+                      plp_mat_mult_trans_f32_parallel
+    @return     none
+*/
+
+void plp_mat_mult_trans_f32p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+  @brief      Glue code of matrix transpose matrix multiplication for complex 32-bit integers
+  @param[in]  pSrcA Points to the first input matrix of shape MxN
+  @param[in]  pSrcB Points to the second input matrix of shape OxN
+  @param[in]  M     Height of matrix SrcA and DstC
+  @param[in]  N     Width of matrix SrcA and SrcB
+  @param[in]  O     Height of matrix SrcB and width of matrix DstC
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
+*/
+
+void plp_mat_mult_trans_cmplx_i32(const int32_t *__restrict__ pSrcA,
+                                  const int32_t *__restrict__ pSrcB,
+                                  uint32_t M,
+                                  uint32_t N,
+                                  uint32_t O,
+                                  int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+  @brief      matrix transpose matrix multiplication for complex 32-bit integers on RV32IM
+  @param[in]  pSrcA Points to the first input matrix of shape MxN
+  @param[in]  pSrcB Points to the second input matrix of shape OxN
+  @param[in]  M     Height of matrix SrcA and DstC
+  @param[in]  N     Width of matrix SrcA and SrcB
+  @param[in]  O     Height of matrix SrcB and width of matrix DstC
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
+*/
+
+void plp_mat_mult_trans_cmplx_i32s_rv32im(const int32_t *__restrict__ pSrcA,
+                                          const int32_t *__restrict__ pSrcB,
+                                          uint32_t M,
+                                          uint32_t N,
+                                          uint32_t O,
+                                          int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+  @brief      matrix transpose matrix multiplication for complex 32-bit integers on XpulpV2
+  @param[in]  pSrcA Points to the first input matrix of shape MxN
+  @param[in]  pSrcB Points to the second input matrix of shape OxN
+  @param[in]  M     Height of matrix SrcA and DstC
+  @param[in]  N     Width of matrix SrcA and SrcB
+  @param[in]  O     Height of matrix SrcB and width of matrix DstC
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
+*/
+
+void plp_mat_mult_trans_cmplx_i32s_xpulpv2(const int32_t *__restrict__ pSrcA,
+                                           const int32_t *__restrict__ pSrcB,
+                                           uint32_t M,
+                                           uint32_t N,
+                                           uint32_t O,
+                                           int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+  @brief      Glue code of parallel matrix transpose matrix multiplication for complex 32-bit
+              integers
+  @param[in]  pSrcA Points to the first input matrix of shape MxN
+  @param[in]  pSrcB Points to the second input matrix of shape OxN
+  @param[in]  M     Height of matrix SrcA and DstC
+  @param[in]  N     Width of matrix SrcA and SrcB
+  @param[in]  O     Height of matrix SrcB and width of matrix DstC
+  @param[in]  nPE   Number of cores to use for computation (or PLP_NPE_AUTO)
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
+*/
+
+void plp_mat_mult_trans_cmplx_i32_parallel(const int32_t *__restrict__ pSrcA,
+                                           const int32_t *__restrict__ pSrcB,
+                                           uint32_t M,
+                                           uint32_t N,
+                                           uint32_t O,
+                                           uint32_t nPE,
+                                           int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+  @brief      parallel matrix transpose matrix multiplication for complex 32-bit integers on XpulpV2
+  @param[in]  args  pointer to plp_mat_mult_cmplx_instance_i32 struct initialized by
+                    plp_mat_mult_trans_cmplx_i32_parallel
+  @return     none
+*/
+
+void plp_mat_mult_trans_cmplx_i32p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+  @brief      Glue code of matrix transpose matrix multiplication for complex 16-bit integers
+  @param[in]  pSrcA Points to the first input matrix of shape MxN
+  @param[in]  pSrcB Points to the second input matrix of shape OxN
+  @param[in]  M     Height of matrix SrcA and DstC
+  @param[in]  N     Width of matrix SrcA and SrcB
+  @param[in]  O     Height of matrix SrcB and width of matrix DstC
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
+*/
+
+void plp_mat_mult_trans_cmplx_i16(const int16_t *__restrict__ pSrcA,
+                                  const int16_t *__restrict__ pSrcB,
+                                  uint32_t M,
+                                  uint32_t N,
+                                  uint32_t O,
+                                  int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+  @brief      matrix transpose matrix multiplication for complex 16-bit integers on RV32IM
+  @param[in]  pSrcA Points to the first input matrix of shape MxN
+  @param[in]  pSrcB Points to the second input matrix of shape OxN
+  @param[in]  M     Height of matrix SrcA and DstC
+  @param[in]  N     Width of matrix SrcA and SrcB
+  @param[in]  O     Height of matrix SrcB and width of matrix DstC
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
+*/
+
+void plp_mat_mult_trans_cmplx_i16s_rv32im(const int16_t *__restrict__ pSrcA,
+                                          const int16_t *__restrict__ pSrcB,
+                                          uint32_t M,
+                                          uint32_t N,
+                                          uint32_t O,
+                                          int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+  @brief      matrix transpose matrix multiplication for complex 16-bit integers on XpulpV2
+  @param[in]  pSrcA Points to the first input matrix of shape MxN
+  @param[in]  pSrcB Points to the second input matrix of shape OxN
+  @param[in]  M     Height of matrix SrcA and DstC
+  @param[in]  N     Width of matrix SrcA and SrcB
+  @param[in]  O     Height of matrix SrcB and width of matrix DstC
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
+
+  @par Exploiting SIMD instructions
+  The 16 bit values are packed two each into 32 bit vectors and then the two dot products are
+  performed on 32 bit vectors, with 32 bit accumulator.
+*/
+
+void plp_mat_mult_trans_cmplx_i16s_xpulpv2(const int16_t *__restrict__ pSrcA,
+                                           const int16_t *__restrict__ pSrcB,
+                                           uint32_t M,
+                                           uint32_t N,
+                                           uint32_t O,
+                                           int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+  @brief      Glue code of parallel matrix transpose matrix multiplication for complex 16-bit
+              integers
+  @param[in]  pSrcA Points to the first input matrix of shape MxN
+  @param[in]  pSrcB Points to the second input matrix of shape OxN
+  @param[in]  M     Height of matrix SrcA and DstC
+  @param[in]  N     Width of matrix SrcA and SrcB
+  @param[in]  O     Height of matrix SrcB and width of matrix DstC
+  @param[in]  nPE   Number of cores to use for computation (or PLP_NPE_AUTO)
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
+*/
+
+void plp_mat_mult_trans_cmplx_i16_parallel(const int16_t *__restrict__ pSrcA,
+                                           const int16_t *__restrict__ pSrcB,
+                                           uint32_t M,
+                                           uint32_t N,
+                                           uint32_t O,
+                                           uint32_t nPE,
+                                           int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+  @brief      parallel matrix transpose matrix multiplication for complex 16-bit integers on XpulpV2
+  @param[in]  args  pointer to plp_mat_mult_cmplx_instance_i16 struct initialized by
+                    plp_mat_mult_trans_cmplx_i16_parallel
+  @return     none
+
+  @par Exploiting SIMD instructions
+  The 16 bit values are packed two each into 32 bit vectors and then the two dot products are
+  performed on 32 bit vectors, with 32 bit accumulator.
+*/
+
+void plp_mat_mult_trans_cmplx_i16p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+  @brief      Glue code of matrix transpose matrix multiplication for complex 8-bit integers
+  @param[in]  pSrcA Points to the first input matrix of shape MxN
+  @param[in]  pSrcB Points to the second input matrix of shape OxN
+  @param[in]  M     Height of matrix SrcA and DstC
+  @param[in]  N     Width of matrix SrcA and SrcB
+  @param[in]  O     Height of matrix SrcB and width of matrix DstC
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
+*/
+
+void plp_mat_mult_trans_cmplx_i8(const int8_t *__restrict__ pSrcA,
+                                 const int8_t *__restrict__ pSrcB,
+                                 uint32_t M,
+                                 uint32_t N,
+                                 uint32_t O,
+                                 int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+  @brief      matrix transpose matrix multiplication for complex 8-bit integers on RV32IM
+  @param[in]  pSrcA Points to the first input matrix of shape MxN
+  @param[in]  pSrcB Points to the second input matrix of shape OxN
+  @param[in]  M     Height of matrix SrcA and DstC
+  @param[in]  N     Width of matrix SrcA and SrcB
+  @param[in]  O     Height of matrix SrcB and width of matrix DstC
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
+*/
+
+void plp_mat_mult_trans_cmplx_i8s_rv32im(const int8_t *__restrict__ pSrcA,
+                                         const int8_t *__restrict__ pSrcB,
+                                         uint32_t M,
+                                         uint32_t N,
+                                         uint32_t O,
+                                         int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+  @brief      matrix transpose matrix multiplication for complex 8-bit integers on XpulpV2
+  @param[in]  pSrcA Points to the first input matrix of shape MxN
+  @param[in]  pSrcB Points to the second input matrix of shape OxN
+  @param[in]  M     Height of matrix SrcA and DstC
+  @param[in]  N     Width of matrix SrcA and SrcB
+  @param[in]  O     Height of matrix SrcB and width of matrix DstC
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
+
+  @par Exploiting SIMD instructions
+  The 8 bit values are packed four each into 32 bit vectors and then the four dot products are
+  performed on 32 bit vectors, with 32 bit accumulator.
+*/
+
+void plp_mat_mult_trans_cmplx_i8s_xpulpv2(const int8_t *__restrict__ pSrcA,
+                                          const int8_t *__restrict__ pSrcB,
+                                          uint32_t M,
+                                          uint32_t N,
+                                          uint32_t O,
+                                          int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+  @brief      Glue code of parallel matrix transpose matrix multiplication for complex 8-bit
+              integers
+  @param[in]  pSrcA Points to the first input matrix of shape MxN
+  @param[in]  pSrcB Points to the second input matrix of shape OxN
+  @param[in]  M     Height of matrix SrcA and DstC
+  @param[in]  N     Width of matrix SrcA and SrcB
+  @param[in]  O     Height of matrix SrcB and width of matrix DstC
+  @param[in]  nPE   Number of cores to use for computation (or PLP_NPE_AUTO)
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
+*/
+
+void plp_mat_mult_trans_cmplx_i8_parallel(const int8_t *__restrict__ pSrcA,
+                                          const int8_t *__restrict__ pSrcB,
+                                          uint32_t M,
+                                          uint32_t N,
+                                          uint32_t O,
+                                          uint32_t nPE,
+                                          int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+  @brief      parallel matrix transpose matrix multiplication for complex 8-bit integers on XpulpV2
+  @param[in]  args  pointer to plp_mat_mult_cmplx_instance_i8 struct initialized by
+                    plp_mat_mult_trans_cmplx_i8_parallel
+  @return     none
+
+  @par Exploiting SIMD instructions
+  The 8 bit values are packed four each into 32 bit vectors and then the four dot products are
+  performed on 32 bit vectors, with 32 bit accumulator.
+*/
+
+void plp_mat_mult_trans_cmplx_i8p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+  @brief      Glue code of matrix transpose matrix multiplication for complex 32-bit floats
+  @param[in]  pSrcA Points to the first input matrix of shape MxN
+  @param[in]  pSrcB Points to the second input matrix of shape OxN
+  @param[in]  M     Height of matrix SrcA and DstC
+  @param[in]  N     Width of matrix SrcA and SrcB
+  @param[in]  O     Height of matrix SrcB and width of matrix DstC
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
+*/
+
+void plp_mat_mult_trans_cmplx_f32(const float *__restrict__ pSrcA,
+                                  const float *__restrict__ pSrcB,
+                                  uint32_t M,
+                                  uint32_t N,
+                                  uint32_t O,
+                                  float *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+  @brief      matrix transpose matrix multiplication for complex 32-bit floats on XpulpV2
+  @param[in]  pSrcA Points to the first input matrix of shape MxN
+  @param[in]  pSrcB Points to the second input matrix of shape OxN
+  @param[in]  M     Height of matrix SrcA and DstC
+  @param[in]  N     Width of matrix SrcA and SrcB
+  @param[in]  O     Height of matrix SrcB and width of matrix DstC
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
+*/
+
+void plp_mat_mult_trans_cmplx_f32s_xpulpv2(const float *__restrict__ pSrcA,
+                                           const float *__restrict__ pSrcB,
+                                           uint32_t M,
+                                           uint32_t N,
+                                           uint32_t O,
+                                           float *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+  @brief      Glue code of parallel matrix transpose matrix multiplication for complex 32-bit floats
+  @param[in]  pSrcA Points to the first input matrix of shape MxN
+  @param[in]  pSrcB Points to the second input matrix of shape OxN
+  @param[in]  M     Height of matrix SrcA and DstC
+  @param[in]  N     Width of matrix SrcA and SrcB
+  @param[in]  O     Height of matrix SrcB and width of matrix DstC
+  @param[in]  nPE   Number of cores to use for computation (or PLP_NPE_AUTO)
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
+*/
+
+void plp_mat_mult_trans_cmplx_f32_parallel(const float *__restrict__ pSrcA,
+                                           const float *__restrict__ pSrcB,
+                                           uint32_t M,
+                                           uint32_t N,
+                                           uint32_t O,
+                                           uint32_t nPE,
+                                           float *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+  @brief      parallel matrix transpose matrix multiplication for complex 32-bit floats on XpulpV2
+  @param[in]  args  pointer to plp_mat_mult_cmplx_instance_f32 struct initialized by
+                    plp_mat_mult_trans_cmplx_f32_parallel
+  @return     none
+*/
+
+void plp_mat_mult_trans_cmplx_f32p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+  @brief      Glue code of matrix transpose matrix multiplication for complex 32-bit fix-point
+  @param[in]  pSrcA Points to the first input matrix of shape MxN
+  @param[in]  pSrcB Points to the second input matrix of shape OxN
+  @param[in]  M     Height of matrix SrcA and DstC
+  @param[in]  N     Width of matrix SrcA and SrcB
+  @param[in]  O     Height of matrix SrcB and width of matrix DstC
+  @param[in]  shift Amount to shift the result of each multiplication ot the right
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
+
+  @par Fix-Point
+  Fix-Point and Shifting
+  The result will be shifted by the parameter `shift` to the right (which corresponds to a
+  multiplication by `2^-shift`). Assume that matrix A is represente as `pSrcA * 2^-x` and matrix B
+  as `pSrcB * 2^-y` (which means that A has `x`, and B has `y` bits after the binary point). Then,
+  the output matrix C is represented as `pDstC * 2^-(x + y - shift)`.
+  The output matrix is also stored with the same number of bits as the inputs. Set the
+  `shift` parameter such that no overflow occurrs.
+*/
+
+void plp_mat_mult_trans_cmplx_q32(const int32_t *__restrict__ pSrcA,
+                                  const int32_t *__restrict__ pSrcB,
+                                  uint32_t M,
+                                  uint32_t N,
+                                  uint32_t O,
+                                  uint32_t shift,
+                                  int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+  @brief      matrix transpose matrix multiplication for complex 32-bit fix-point on RV32IM
+  @param[in]  pSrcA Points to the first input matrix of shape MxN
+  @param[in]  pSrcB Points to the second input matrix of shape OxN
+  @param[in]  M     Height of matrix SrcA and DstC
+  @param[in]  N     Width of matrix SrcA and SrcB
+  @param[in]  O     Height of matrix SrcB and width of matrix DstC
+  @param[in]  shift Amount to shift the result of each multiplication ot the right
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
+
+  @par Fix-Point
+  Fix-Point and Shifting
+  The result will be shifted by the parameter `shift` to the right (which corresponds to a
+  multiplication by `2^-shift`). Assume that matrix A is represente as `pSrcA * 2^-x` and matrix B
+  as `pSrcB * 2^-y` (which means that A has `x`, and B has `y` bits after the binary point). Then,
+  the output matrix C is represented as `pDstC * 2^-(x + y - shift)`.
+  The output matrix is also stored with the same number of bits as the inputs. Set the
+  `shift` parameter such that no overflow occurrs.
+*/
+
+void plp_mat_mult_trans_cmplx_q32s_rv32im(const int32_t *__restrict__ pSrcA,
+                                          const int32_t *__restrict__ pSrcB,
+                                          uint32_t M,
+                                          uint32_t N,
+                                          uint32_t O,
+                                          uint32_t shift,
+                                          int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+  @brief      matrix transpose matrix multiplication for complex 32-bit fix-point on XpulpV2
+  @param[in]  pSrcA Points to the first input matrix of shape MxN
+  @param[in]  pSrcB Points to the second input matrix of shape OxN
+  @param[in]  M     Height of matrix SrcA and DstC
+  @param[in]  N     Width of matrix SrcA and SrcB
+  @param[in]  O     Height of matrix SrcB and width of matrix DstC
+  @param[in]  shift Amount to shift the result of each multiplication ot the right
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
+
+  @par Fix-Point
+  Fix-Point and Shifting
+  The result will be shifted by the parameter `shift` to the right (which corresponds to a
+  multiplication by `2^-shift`). Assume that matrix A is represente as `pSrcA * 2^-x` and matrix B
+  as `pSrcB * 2^-y` (which means that A has `x`, and B has `y` bits after the binary point). Then,
+  the output matrix C is represented as `pDstC * 2^-(x + y - shift)`.
+  The output matrix is also stored with the same number of bits as the inputs. Set the
+  `shift` parameter such that no overflow occurrs.
+*/
+
+void plp_mat_mult_trans_cmplx_q32s_xpulpv2(const int32_t *__restrict__ pSrcA,
+                                           const int32_t *__restrict__ pSrcB,
+                                           uint32_t M,
+                                           uint32_t N,
+                                           uint32_t O,
+                                           uint32_t shift,
+                                           int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+  @brief      Glue code of parallel matrix transpose matrix multiplication for complex 32-bit
+              fix-point
+  @param[in]  pSrcA Points to the first input matrix of shape MxN
+  @param[in]  pSrcB Points to the second input matrix of shape OxN
+  @param[in]  M     Height of matrix SrcA and DstC
+  @param[in]  N     Width of matrix SrcA and SrcB
+  @param[in]  O     Height of matrix SrcB and width of matrix DstC
+  @param[in]  shift Amount to shift the result of each multiplication ot the right
+  @param[in]  nPE   Number of cores to use for computation (or PLP_NPE_AUTO)
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
+
+  @par Fix-Point
+  Fix-Point and Shifting
+  The result will be shifted by the parameter `shift` to the right (which corresponds to a
+  multiplication by `2^-shift`). Assume that matrix A is represente as `pSrcA * 2^-x` and matrix B
+  as `pSrcB * 2^-y` (which means that A has `x`, and B has `y` bits after the binary point). Then,
+  the output matrix C is represented as `pDstC * 2^-(x + y - shift)`.
+  The output matrix is also stored with the same number of bits as the inputs. Set the
+  `shift` parameter such that no overflow occurrs.
+*/
+
+void plp_mat_mult_trans_cmplx_q32_parallel(const int32_t *__restrict__ pSrcA,
+                                           const int32_t *__restrict__ pSrcB,
+                                           uint32_t M,
+                                           uint32_t N,
+                                           uint32_t O,
+                                           uint32_t shift,
+                                           uint32_t nPE,
+                                           int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+  @brief      parallel matrix transpose matrix multiplication for complex 32-bit fix-point on
+              XpulpV2
+  @param[in]  args  pointer to plp_mat_mult_cmplx_instance_q32 struct initialized by
+                    plp_mat_mult_trans_cmplx_q32_parallel
+  @return     none
+
+  @par Fix-Point
+  Fix-Point and Shifting
+  The result will be shifted by the parameter `shift` to the right (which corresponds to a
+  multiplication by `2^-shift`). Assume that matrix A is represente as `pSrcA * 2^-x` and matrix B
+  as `pSrcB * 2^-y` (which means that A has `x`, and B has `y` bits after the binary point). Then,
+  the output matrix C is represented as `pDstC * 2^-(x + y - shift)`.
+  The output matrix is also stored with the same number of bits as the inputs. Set the
+  `shift` parameter such that no overflow occurrs.
+*/
+
+void plp_mat_mult_trans_cmplx_q32p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+  @brief      Glue code of matrix transpose matrix multiplication for complex 16-bit fix-point
+  @param[in]  pSrcA Points to the first input matrix of shape MxN
+  @param[in]  pSrcB Points to the second input matrix of shape OxN
+  @param[in]  M     Height of matrix SrcA and DstC
+  @param[in]  N     Width of matrix SrcA and SrcB
+  @param[in]  O     Height of matrix SrcB and width of matrix DstC
+  @param[in]  shift Amount to shift the result of each multiplication ot the right
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
+
+  @par Fix-Point
+  Fix-Point and Shifting
+  The result will be shifted by the parameter `shift` to the right (which corresponds to a
+  multiplication by `2^-shift`). Assume that matrix A is represente as `pSrcA * 2^-x` and matrix B
+  as `pSrcB * 2^-y` (which means that A has `x`, and B has `y` bits after the binary point). Then,
+  the output matrix C is represented as `pDstC * 2^-(x + y - shift)`.
+  The output matrix is also stored with the same number of bits as the inputs. Set the
+  `shift` parameter such that no overflow occurrs.
+*/
+
+void plp_mat_mult_trans_cmplx_q16(const int16_t *__restrict__ pSrcA,
+                                  const int16_t *__restrict__ pSrcB,
+                                  uint32_t M,
+                                  uint32_t N,
+                                  uint32_t O,
+                                  uint32_t shift,
+                                  int16_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+  @brief      matrix transpose matrix multiplication for complex 16-bit fix-point on RV32IM
+  @param[in]  pSrcA Points to the first input matrix of shape MxN
+  @param[in]  pSrcB Points to the second input matrix of shape OxN
+  @param[in]  M     Height of matrix SrcA and DstC
+  @param[in]  N     Width of matrix SrcA and SrcB
+  @param[in]  O     Height of matrix SrcB and width of matrix DstC
+  @param[in]  shift Amount to shift the result of each multiplication ot the right
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
+
+  @par Fix-Point
+  Fix-Point and Shifting
+  The result will be shifted by the parameter `shift` to the right (which corresponds to a
+  multiplication by `2^-shift`). Assume that matrix A is represente as `pSrcA * 2^-x` and matrix B
+  as `pSrcB * 2^-y` (which means that A has `x`, and B has `y` bits after the binary point). Then,
+  the output matrix C is represented as `pDstC * 2^-(x + y - shift)`.
+  The output matrix is also stored with the same number of bits as the inputs. Set the
+  `shift` parameter such that no overflow occurrs.
+*/
+
+void plp_mat_mult_trans_cmplx_q16s_rv32im(const int16_t *__restrict__ pSrcA,
+                                          const int16_t *__restrict__ pSrcB,
+                                          uint32_t M,
+                                          uint32_t N,
+                                          uint32_t O,
+                                          uint32_t shift,
+                                          int16_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+  @brief      matrix transpose matrix multiplication for complex 16-bit fix-point on XpulpV2
+  @param[in]  pSrcA Points to the first input matrix of shape MxN
+  @param[in]  pSrcB Points to the second input matrix of shape OxN
+  @param[in]  M     Height of matrix SrcA and DstC
+  @param[in]  N     Width of matrix SrcA and SrcB
+  @param[in]  O     Height of matrix SrcB and width of matrix DstC
+  @param[in]  shift Amount to shift the result of each multiplication ot the right
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
+
+  @par Fix-Point
+  Fix-Point and Shifting
+  The result will be shifted by the parameter `shift` to the right (which corresponds to a
+  multiplication by `2^-shift`). Assume that matrix A is represente as `pSrcA * 2^-x` and matrix B
+  as `pSrcB * 2^-y` (which means that A has `x`, and B has `y` bits after the binary point). Then,
+  the output matrix C is represented as `pDstC * 2^-(x + y - shift)`.
+  The output matrix is also stored with the same number of bits as the inputs. Set the
+  `shift` parameter such that no overflow occurrs.
+
+  @par Exploiting SIMD instructions
+  The 16 bit values are packed two each into 32 bit vectors and then the two dot products are
+  performed on 32 bit vectors, with 32 bit accumulator.
+*/
+
+void plp_mat_mult_trans_cmplx_q16s_xpulpv2(const int16_t *__restrict__ pSrcA,
+                                           const int16_t *__restrict__ pSrcB,
+                                           uint32_t M,
+                                           uint32_t N,
+                                           uint32_t O,
+                                           uint32_t shift,
+                                           int16_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+  @brief      Glue code of parallel matrix transpose matrix multiplication for complex 16-bit
+              fix-point
+  @param[in]  pSrcA Points to the first input matrix of shape MxN
+  @param[in]  pSrcB Points to the second input matrix of shape OxN
+  @param[in]  M     Height of matrix SrcA and DstC
+  @param[in]  N     Width of matrix SrcA and SrcB
+  @param[in]  O     Height of matrix SrcB and width of matrix DstC
+  @param[in]  shift Amount to shift the result of each multiplication ot the right
+  @param[in]  nPE   Number of cores to use for computation (or PLP_NPE_AUTO)
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
+
+  @par Fix-Point
+  Fix-Point and Shifting
+  The result will be shifted by the parameter `shift` to the right (which corresponds to a
+  multiplication by `2^-shift`). Assume that matrix A is represente as `pSrcA * 2^-x` and matrix B
+  as `pSrcB * 2^-y` (which means that A has `x`, and B has `y` bits after the binary point). Then,
+  the output matrix C is represented as `pDstC * 2^-(x + y - shift)`.
+  The output matrix is also stored with the same number of bits as the inputs. Set the
+  `shift` parameter such that no overflow occurrs.
+*/
+
+void plp_mat_mult_trans_cmplx_q16_parallel(const int16_t *__restrict__ pSrcA,
+                                           const int16_t *__restrict__ pSrcB,
+                                           uint32_t M,
+                                           uint32_t N,
+                                           uint32_t O,
+                                           uint32_t shift,
+                                           uint32_t nPE,
+                                           int16_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+  @brief      parallel matrix transpose matrix multiplication for complex 16-bit fix-point on
+              XpulpV2
+  @param[in]  args  pointer to plp_mat_mult_cmplx_instance_q16 struct initialized by
+                    plp_mat_mult_trans_cmplx_q16_parallel
+  @return     none
+
+  @par Fix-Point
+  Fix-Point and Shifting
+  The result will be shifted by the parameter `shift` to the right (which corresponds to a
+  multiplication by `2^-shift`). Assume that matrix A is represente as `pSrcA * 2^-x` and matrix B
+  as `pSrcB * 2^-y` (which means that A has `x`, and B has `y` bits after the binary point). Then,
+  the output matrix C is represented as `pDstC * 2^-(x + y - shift)`.
+  The output matrix is also stored with the same number of bits as the inputs. Set the
+  `shift` parameter such that no overflow occurrs.
+
+  @par Exploiting SIMD instructions
+  The 16 bit values are packed two each into 32 bit vectors and then the two dot products are
+  performed on 32 bit vectors, with 32 bit accumulator.
+*/
+
+void plp_mat_mult_trans_cmplx_q16p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+  @brief      Glue code of matrix transpose matrix multiplication for complex 8-bit fix-point
+  @param[in]  pSrcA Points to the first input matrix of shape MxN
+  @param[in]  pSrcB Points to the second input matrix of shape OxN
+  @param[in]  M     Height of matrix SrcA and DstC
+  @param[in]  N     Width of matrix SrcA and SrcB
+  @param[in]  O     Height of matrix SrcB and width of matrix DstC
+  @param[in]  shift Amount to shift the result of each multiplication ot the right
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
+
+  @par Fix-Point
+  Fix-Point and Shifting
+  The result will be shifted by the parameter `shift` to the right (which corresponds to a
+  multiplication by `2^-shift`). Assume that matrix A is represente as `pSrcA * 2^-x` and matrix B
+  as `pSrcB * 2^-y` (which means that A has `x`, and B has `y` bits after the binary point). Then,
+  the output matrix C is represented as `pDstC * 2^-(x + y - shift)`.
+  The output matrix is also stored with the same number of bits as the inputs. Set the
+  `shift` parameter such that no overflow occurrs.
+*/
+
+void plp_mat_mult_trans_cmplx_q8(const int8_t *__restrict__ pSrcA,
+                                 const int8_t *__restrict__ pSrcB,
+                                 uint32_t M,
+                                 uint32_t N,
+                                 uint32_t O,
+                                 uint32_t shift,
+                                 int8_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+  @brief      matrix transpose matrix multiplication for complex 8-bit fix-point on RV32IM
+  @param[in]  pSrcA Points to the first input matrix of shape MxN
+  @param[in]  pSrcB Points to the second input matrix of shape OxN
+  @param[in]  M     Height of matrix SrcA and DstC
+  @param[in]  N     Width of matrix SrcA and SrcB
+  @param[in]  O     Height of matrix SrcB and width of matrix DstC
+  @param[in]  shift Amount to shift the result of each multiplication ot the right
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
+
+  @par Fix-Point
+  Fix-Point and Shifting
+  The result will be shifted by the parameter `shift` to the right (which corresponds to a
+  multiplication by `2^-shift`). Assume that matrix A is represente as `pSrcA * 2^-x` and matrix B
+  as `pSrcB * 2^-y` (which means that A has `x`, and B has `y` bits after the binary point). Then,
+  the output matrix C is represented as `pDstC * 2^-(x + y - shift)`.
+  The output matrix is also stored with the same number of bits as the inputs. Set the
+  `shift` parameter such that no overflow occurrs.
+*/
+
+void plp_mat_mult_trans_cmplx_q8s_rv32im(const int8_t *__restrict__ pSrcA,
+                                         const int8_t *__restrict__ pSrcB,
+                                         uint32_t M,
+                                         uint32_t N,
+                                         uint32_t O,
+                                         uint32_t shift,
+                                         int8_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+  @brief      matrix transpose matrix multiplication for complex 8-bit fix-point on XpulpV2
+  @param[in]  pSrcA Points to the first input matrix of shape MxN
+  @param[in]  pSrcB Points to the second input matrix of shape OxN
+  @param[in]  M     Height of matrix SrcA and DstC
+  @param[in]  N     Width of matrix SrcA and SrcB
+  @param[in]  O     Height of matrix SrcB and width of matrix DstC
+  @param[in]  shift Amount to shift the result of each multiplication ot the right
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
+
+  @par Fix-Point
+  Fix-Point and Shifting
+  The result will be shifted by the parameter `shift` to the right (which corresponds to a
+  multiplication by `2^-shift`). Assume that matrix A is represente as `pSrcA * 2^-x` and matrix B
+  as `pSrcB * 2^-y` (which means that A has `x`, and B has `y` bits after the binary point). Then,
+  the output matrix C is represented as `pDstC * 2^-(x + y - shift)`.
+  The output matrix is also stored with the same number of bits as the inputs. Set the
+  `shift` parameter such that no overflow occurrs.
+
+  @par Exploiting SIMD instructions
+  The 8 bit values are packed four each into 32 bit vectors and then the four dot products are
+  performed on 32 bit vectors, with 32 bit accumulator.
+*/
+
+void plp_mat_mult_trans_cmplx_q8s_xpulpv2(const int8_t *__restrict__ pSrcA,
+                                          const int8_t *__restrict__ pSrcB,
+                                          uint32_t M,
+                                          uint32_t N,
+                                          uint32_t O,
+                                          uint32_t shift,
+                                          int8_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+  @brief      Glue code of parallel matrix transpose matrix multiplication for complex 8-bit
+              fix-point
+  @param[in]  pSrcA Points to the first input matrix of shape MxN
+  @param[in]  pSrcB Points to the second input matrix of shape OxN
+  @param[in]  M     Height of matrix SrcA and DstC
+  @param[in]  N     Width of matrix SrcA and SrcB
+  @param[in]  O     Height of matrix SrcB and width of matrix DstC
+  @param[in]  shift Amount to shift the result of each multiplication ot the right
+  @param[in]  nPE   Number of cores to use for computation (or PLP_NPE_AUTO)
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
+
+  @par Fix-Point
+  Fix-Point and Shifting
+  The result will be shifted by the parameter `shift` to the right (which corresponds to a
+  multiplication by `2^-shift`). Assume that matrix A is represente as `pSrcA * 2^-x` and matrix B
+  as `pSrcB * 2^-y` (which means that A has `x`, and B has `y` bits after the binary point). Then,
+  the output matrix C is represented as `pDstC * 2^-(x + y - shift)`.
+  The output matrix is also stored with the same number of bits as the inputs. Set the
+  `shift` parameter such that no overflow occurrs.
+*/
+
+void plp_mat_mult_trans_cmplx_q8_parallel(const int8_t *__restrict__ pSrcA,
+                                          const int8_t *__restrict__ pSrcB,
+                                          uint32_t M,
+                                          uint32_t N,
+                                          uint32_t O,
+                                          uint32_t shift,
+                                          uint32_t nPE,
+                                          int8_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+  @brief      parallel matrix transpose matrix multiplication for complex 8-bit fix-point on XpulpV2
+  @param[in]  args  pointer to plp_mat_mult_cmplx_instance_q8 struct initialized by
+                    plp_mat_mult_trans_cmplx_q8_parallel
+  @return     none
+
+  @par Fix-Point
+  Fix-Point and Shifting
+  The result will be shifted by the parameter `shift` to the right (which corresponds to a
+  multiplication by `2^-shift`). Assume that matrix A is represente as `pSrcA * 2^-x` and matrix B
+  as `pSrcB * 2^-y` (which means that A has `x`, and B has `y` bits after the binary point). Then,
+  the output matrix C is represented as `pDstC * 2^-(x + y - shift)`.
+  The output matrix is also stored with the same number of bits as the inputs. Set the
+  `shift` parameter such that no overflow occurrs.
+
+  @par Exploiting SIMD instructions
+  The 8 bit values are packed four each into 32 bit vectors and then the four dot products are
+  performed on 32 bit vectors, with 32 bit accumulator.
+*/
+
+void plp_mat_mult_trans_cmplx_q8p_xpulpv2(void *args);
+
+/**
+ * @brief      Glue code for complex magnitude calculation in float32
+ *
+ * @param[in]  pSrc        pointer to source
+ * @param      pRes        pointer to result
+ * @param[in]  numSamples  The number samples
+ */
+
+void plp_cmplx_mag_f32(const float32_t *pSrc,
+                       float32_t *pRes,
+                       uint32_t numSamples);
+
+/**
+ * @brief      complex magnitude for float32 on XPULPV2
+ *
+ * @param[in]  pSrc        pointer to source
+ * @param      pRes        pointer to result
+ * @param[in]  numSamples  The number samples
+ */
+
+void plp_cmplx_mag_f32s_xpulpv2(const float32_t *pSrc,
+                                float32_t *pRes,
+                                uint32_t numSamples);
+
+/**
+ * @brief      Glue code for complex magnitude calculation for 32 bit fixpoint
+ *
+ * @param[in]  pSrc        pointer to source
+ * @param[in]  fracBits    fractional bits -> Q(32-fracBits).fracBits
+ * @param      pRes        pointer to result
+ * @param[in]  numSamples  The number samples
+ */
+
+void plp_cmplx_mag_q32(const int32_t *pSrc,
+                       const uint32_t fracBits,
+                       int32_t *pRes,
+                       uint32_t numSamples);
+
+/**
+ * @brief      complex magnitude for q32 on RV32IM
+ *
+ * @param[in]  pSrc        pointer to source
+ * @param[in]  fracBits    fractional bits -> Q(32-fracBits).fracBits
+ * @param      pRes        pointer to result
+ * @param[in]  numSamples  The number samples
+ */
+
+void plp_cmplx_mag_q32s_rv32im(const int32_t *pSrc,
+                               const uint32_t fracBits,
+                               int32_t *pRes,
+                               uint32_t numSamples);
+
+/**
+ * @brief      complex magnitude for q32 on XPULPV2
+ *
+ * @param[in]  pSrc        pointer to source
+ * @param[in]  fracBits    fractional bits -> Q(32-fracBits).fracBits
+ * @param      pRes        pointer to result
+ * @param[in]  numSamples  The number samples
+ */
+
+void plp_cmplx_mag_q32s_xpulpv2(const int32_t *pSrc,
+                                const uint32_t fracBits,
+                                int32_t *pRes,
+                                uint32_t numSamples);
+
+/**
+ * @brief      Glue code for complex magnitude calculation for 8 bit fixpoint
+ *
+ * @param[in]  pSrc        pointer to source
+ * @param[in]  fracBits    fractional bits -> Q(8-fracBits).fracBits
+ * @param      pRes        pointer to result
+ * @param[in]  numSamples  The number samples
+ */
+
+void plp_cmplx_mag_q8(const int8_t *pSrc,
+                       const uint32_t fracBits,
+                       int8_t *pRes,
+                       uint32_t numSamples);
+
+/**
+ * @brief      complex magnitude for q8 on RV32IM
+ *
+ * @param[in]  pSrc        pointer to source
+ * @param[in]  fracBits    fractional bits -> Q(8-fracBits).fracBits
+ * @param      pRes        pointer to result
+ * @param[in]  numSamples  The number samples
+ */
+
+void plp_cmplx_mag_q8s_rv32im(const int8_t *pSrc,
+                               const uint32_t fracBits,
+                               int8_t *pRes,
+                               uint32_t numSamples);
+
+/**
+ * @brief      complex magnitude for q8 on XPULPV2
+ *
+ * @param[in]  pSrc        pointer to source
+ * @param[in]  fracBits    fractional bits -> Q(8-fracBits).fracBits
+ * @param      pRes        pointer to result
+ * @param[in]  numSamples  The number samples
+ */
+
+void plp_cmplx_mag_q8s_xpulpv2(const int8_t *pSrc,
+                                const uint32_t fracBits,
+                                int8_t *pRes,
+                                uint32_t numSamples);
+
+/**
+ * @brief      Glue code for complex magnitude calculation in 16-bit integer
+ *
+ * @param[in]  pSrc        pointer to source
+ * @param      pRes        pointer to result
+ * @param[in]  numSamples  The number samples
+ */
+
+void plp_cmplx_mag_i16(const int16_t *pSrc,
+                       int16_t *pRes,
+                       uint32_t numSamples);
+
+/**
+ * @brief      complex magnitude for i16 on RV32IM
+ *
+ * @param[in]  pSrc        pointer to source
+ * @param      pRes        pointer to result
+ * @param[in]  numSamples  The number samples
+ */
+
+void plp_cmplx_mag_i16s_rv32im(const int16_t *pSrc,
+                               int16_t *pRes,
+                               uint32_t numSamples);
+
+/**
+ * @brief      complex magnitude for i16 on XPULPV2
+ *
+ * @param[in]  pSrc        pointer to source
+ * @param      pRes        pointer to result
+ * @param[in]  numSamples  The number samples
+ */
+
+void plp_cmplx_mag_i16s_xpulpv2(const int16_t *pSrc,
+                                int16_t *pRes,
+                                uint32_t numSamples);
+
+/**
+ * @brief      Glue code for complex magnitude calculation in 32-bit integer
+ *
+ * @param[in]  pSrc        pointer to source
+ * @param      pRes        pointer to result
+ * @param[in]  numSamples  The number samples
+ */
+
+void plp_cmplx_mag_i32(const int32_t *pSrc,
+                       int32_t *pRes,
+                       uint32_t numSamples);
+
+/**
+ * @brief      complex magnitude for i32 on RV32IM
+ *
+ * @param[in]  pSrc        pointer to source
+ * @param      pRes        pointer to result
+ * @param[in]  numSamples  The number samples
+ */
+
+void plp_cmplx_mag_i32s_rv32im(const int32_t *pSrc,
+                               int32_t *pRes,
+                               uint32_t numSamples);
+
+/**
+ * @brief      complex magnitude for i32 on XPULPV2
+ *
+ * @param[in]  pSrc        pointer to source
+ * @param      pRes        pointer to result
+ * @param[in]  numSamples  The number samples
+ */
+
+void plp_cmplx_mag_i32s_xpulpv2(const int32_t *pSrc,
+                                int32_t *pRes,
+                                uint32_t numSamples);
+
+/**
+ * @brief      Glue code for complex magnitude calculation in 8-bit integer
+ *
+ * @param[in]  pSrc        pointer to source
+ * @param      pRes        pointer to result
+ * @param[in]  numSamples  The number samples
+ */
+
+void plp_cmplx_mag_i8(const int8_t *pSrc,
+                      int8_t *pRes,
+                      uint32_t numSamples);
+
+/**
+ * @brief      complex magnitude for i8 on RV32IM
+ *
+ * @param[in]  pSrc        pointer to source
+ * @param      pRes        pointer to result
+ * @param[in]  numSamples  The number samples
+ */
+
+void plp_cmplx_mag_i8s_rv32im(const int8_t *pSrc,
+                              int8_t *pRes,
+                              uint32_t numSamples);
+
+/**
+ * @brief      complex magnitude for i8 on XPULPV2
+ *
+ * @param[in]  pSrc        pointer to source
+ * @param      pRes        pointer to result
+ * @param[in]  numSamples  The number samples
+ */
+
+void plp_cmplx_mag_i8s_xpulpv2(const int8_t *pSrc,
+                               int8_t *pRes,
+                               uint32_t numSamples);
+
+/**
+ * @brief      Glue code for complex magnitude calculation in 16-bit quantized integer
+ *
+ * @param[in]  pSrc        pointer to source
+ * @param[in]  fracBits    fractional bits -> Q(32-fracBits).fracBits
+ * @param      pRes        pointer to result
+ * @param[in]  numSamples  The number of samples
+ */
+
+void plp_cmplx_mag_q16(const int16_t *pSrc,
+                       const uint32_t fracBits,
+                       int16_t *pRes,
+                       uint32_t numSamples);
+
+/**
+ * @brief      complex magnitude for q16 on RV32IM
+ *
+ * @param[in]  pSrc        pointer to source
+ * @param[in]  fracBits    fractional bits -> Q(32-fracBits).fracBits
+ * @param      pRes        pointer to result
+ * @param[in]  numSamples  The number of samples
+ */
+
+void plp_cmplx_mag_q16s_rv32im(const int16_t *pSrc,
+                               const uint32_t fracBits,
+                               int16_t *pRes,
+                               uint32_t numSamples);
+
+/**
+ * @brief      complex magnitude for q16 on XPULPV2
+ *
+ * @param[in]  pSrc        pointer to source
+ * @param[in]  fracBits    fractional bits -> Q(32-fracBits).fracBits
+ * @param      pRes        pointer to result
+ * @param[in]  numSamples  The number of samples
+ */
+
+void plp_cmplx_mag_q16s_xpulpv2(const int16_t *pSrc,
+                                const uint32_t fracBits,
+                                int16_t *pRes,
+                                uint32_t numSamples);
+
+/**
+  @brief      In-place 16 bit reversal function for RV32IM
+  @param[in,out] pSrc        points to in-place buffer of unknown 16-bit data type
+  @param[in]  bitRevLen   bit reversal table length
+  @param[in]  pBitRevTab  points to bit reversal table
+  @return     none
+*/
+
+void plp_bitreversal_16s_rv32im(uint16_t *pSrc,
+                                const uint16_t bitRevLen,
+                                const uint16_t *pBitRevTab);
+
+/**
+  @brief      In-place 16 bit reversal function for XPULPV2
+  @param[in,out] pSrc        points to in-place buffer of unknown 16-bit data type
+  @param[in]  bitRevLen   bit reversal table length
+  @param[in]  pBitRevTab  points to bit reversal table
+  @return     none
+*/
+
+void plp_bitreversal_16s_xpulpv2(uint16_t *pSrc,
+                                 const uint16_t bitRevLen,
+                                 const uint16_t *pBitRevTab);
+
+/**
+  @brief         In-place 16 bit reversal function.
+  @param[in,out] pSrc        points to in-place buffer of unknown 16-bit data type
+  @param[in]     bitRevLen   bit reversal table length
+  @param[in]     pBitRevTab  points to bit reversal table
+  @param[in]     nPE         number of cores
+  @return        none
+*/
+
+void plp_bitreversal_16p_xpulpv2(uint16_t *pSrc,
+                                 const uint16_t bitRevLen,
+                                 const uint16_t *pBitRevTab,
+                                 uint32_t nPE);
+
+/**
+ * @brief      Glue code for quantized 16 bit complex fast fourier transform
+ *
+ * Fixed point units input -> output dependent on length:
+ * len=16:    Q1.15 -> Q5.11
+ * len=32:    Q1.15 -> Q6.10
+ * len=64:    Q1.15 -> Q7.9
+ * len=128:   Q1.15 -> Q8.8
+ * len=256:   Q1.15 -> Q9.7
+ * len=512:   Q1.15 -> Q10.6
+ * len=1024:  Q1.15 -> Q11.5
+ * len=2048:  Q1.15 -> Q12.4
+ * len=4096:  Q1.15 -> Q13.3
+ *
+ * @param[in]  S               points to an instance of the 16bit quantized CFFT structure
+ * @param[in,out] p1              points to the complex data buffer of size <code>2*fftLen</code>.
+ * Processing occurs in-place.
+ * @param[in]  ifftFlag        flag that selects forward (ifftFlag=0) or inverse (ifftFlag=1)
+ * transform.
+ * @param[in]  bitReverseFlag  flag that enables (bitReverseFlag=1) of disables
+ * (bitReverseFlag=0) bit reversal of output.
+ * @param[in]  deciPoint       decimal point for right shift
+ */
+
+void plp_cfft_q16(const plp_cfft_instance_q16 *S,
+                  int16_t *p1,
+                  uint8_t ifftFlag,
+                  uint8_t bitReverseFlag,
+                  uint32_t deciPoint);
+
+/**
+ * @brief      Glue code for quantized 16 bit complex fast fourier transform
+ *
+ * Fixed point units input -> output dependent on length:
+ * len=16:    Q1.15 -> Q5.11
+ * len=32:    Q1.15 -> Q6.10
+ * len=64:    Q1.15 -> Q7.9
+ * len=128:   Q1.15 -> Q8.8
+ * len=256:   Q1.15 -> Q9.7
+ * len=512:   Q1.15 -> Q10.6
+ * len=1024:  Q1.15 -> Q11.5
+ * len=2048:  Q1.15 -> Q12.4
+ * len=4096:  Q1.15 -> Q13.3
+ *
+ * @param[in]  S               points to an instance of the 16bit quantized CFFT structure
+ * @param[in,out] p1           points to the complex data buffer of size <code>2*fftLen</code>.
+ * Processing occurs in-place.
+ * @param[in]  ifftFlag        flag that selects forward (ifftFlag=0) or inverse (ifftFlag=1)
+ * transform.
+ * @param[in]  bitReverseFlag  flag that enables (bitReverseFlag=1) of disables
+ * (bitReverseFlag=0) bit reversal of output.
+ * @param[in]  deciPoint       decimal point for right shift
+ * @param[in]  nPE             Number of cores to use
+ */
+
+void plp_cfft_q16_parallel(const plp_cfft_instance_q16 *S,
+                           int16_t *p1,
+                           uint8_t ifftFlag,
+                           uint8_t bitReverseFlag,
+                           uint32_t deciPoint,
+                           uint32_t nPE);
+
+/**
+ * @brief      Quantized 16 bit complex fast fourier transform for RV32IM
+ * @param[in]  S               points to an instance of the 16bit quantized CFFT structure
+ * @param[in,out] p1              points to the complex data buffer of size <code>2*fftLen</code>.
+ * Processing occurs in-place.
+ * @param[in]  ifftFlag        flag that selects forward (ifftFlag=0) or inverse (ifftFlag=1)
+ * transform.
+ * @param[in]  bitReverseFlag  flag that enables (bitReverseFlag=1) of disables
+ * (bitReverseFlag=0) bit reversal of output.
+ * @param[in]  deciPoint       decimal point for right shift
+ */
+
+void plp_cfft_q16s_rv32im(const plp_cfft_instance_q16 *S,
+                          int16_t *p1,
+                          uint8_t ifftFlag,
+                          uint8_t bitReverseFlag,
+                          uint32_t deciPoint);
+
+/**
+ * @brief      Quantized 16 bit complex fast fourier transform for XPULPV2
+ * @param[in]  S               points to an instance of the 16bit quantized CFFT structure
+ * @param[in,out] p1              points to the complex data buffer of size <code>2*fftLen</code>.
+ * Processing occurs in-place.
+ * @param[in]  ifftFlag        flag that selects forward (ifftFlag=0) or inverse (ifftFlag=1)
+ * transform.
+ * @param[in]  bitReverseFlag  flag that enables (bitReverseFlag=1) of disables
+ * (bitReverseFlag=0) bit reversal of output.
+ * @param[in]  deciPoint       decimal point for right shift
+ */
+
+void plp_cfft_q16s_xpulpv2(const plp_cfft_instance_q16 *S,
+                           int16_t *p1,
+                           uint8_t ifftFlag,
+                           uint8_t bitReverseFlag,
+                           uint32_t deciPoint);
+
+/**
+ * @brief      Parallel quantized 16 bit complex fast fourier transform for XPULPV2
+ * @param[in]   args    points to the plp_cfft_instance_q16_parallel
+ */
+
+void plp_cfft_q16p_xpulpv2(void *args);
+
+/**
+ * @brief      Glue code for the quantized 16 bit Stockham complex fast fourier transform. The
+ *             transform is computed out-of-place and the output is in natural order, without a
+ *             separate bit reversal pass. Like plp_cfft_q16, the output is the spectrum divided by
+ *             fftLen.
+ * @param[in]  S       points to an instance of the 16bit quantized CFFT structure
+ * @param[in]  pSrc    points to the input buffer of size <code>2*fftLen</code>, it is not modified
+ * @param[in]  pBuf    points to a temporary buffer of size <code>2*fftLen</code>
+ * @param[out] pDst    points to the output buffer of size <code>2*fftLen</code>
+ * @return     none
+ */
+
+void plp_cfft_stockham_q16(const plp_cfft_instance_q16 *S,
+                           const int16_t *pSrc,
+                           int16_t *pBuf,
+                           int16_t *pDst);
+
+/**
+ * @brief      Glue code for the parallel quantized 16 bit Stockham complex fast fourier transform
+ * @param[in]  S       points to an instance of the 16bit quantized CFFT structure
+ * @param[in]  pSrc    points to the input buffer of size <code>2*fftLen</code>, it is not modified
+ * @param[in]  pBuf    points to a temporary buffer of size <code>2*fftLen</code>
+ * @param[in]  nPE     number of cores to use
+ * @param[out] pDst    points to the output buffer of size <code>2*fftLen</code>
+ * @return     none
+ */
+
+void plp_cfft_stockham_q16_parallel(const plp_cfft_instance_q16 *S,
+                                    const int16_t *pSrc,
+                                    int16_t *pBuf,
+                                    uint32_t nPE,
+                                    int16_t *pDst);
+
+/**
+ * @brief      Quantized 16 bit Stockham complex fast fourier transform for RV32IM
+ * @param[in]  S       points to an instance of the 16bit quantized CFFT structure
+ * @param[in]  pSrc    points to the input buffer of size <code>2*fftLen</code>, it is not modified
+ * @param[in]  pBuf    points to a temporary buffer of size <code>2*fftLen</code>
+ * @param[out] pDst    points to the output buffer of size <code>2*fftLen</code>
+ * @return     none
+ */
 
-  @par Fix-Point
-  Fix-Point and Shifting
-  The result will be shifted by the parameter `shift` to the right (which corresponds to a
-  multiplication by `2^-shift`). Assume that matrix A is represente as `pSrcA * 2^-x` and matrix B
-  as `pSrcB * 2^-y` (which means that A has `x`, and B has `y` bits after the binary point). Then,
-  the output matrix C is represented as `pDstC * 2^-(x + y - shift)`.
-  The output matrix is also stored with the same number of bits as the inputs. Set the
-  `shift` parameter such that no overflow occurrs.
-*/
+void plp_cfft_stockham_q16s_rv32im(const plp_cfft_instance_q16 *S,
+                                   const int16_t *pSrc,
+                                   int16_t *pBuf,
+                                   int16_t *pDst);
 
-void plp_mat_mult_trans_cmplx_q32s_rv32im(const int32_t *__restrict__ pSrcA,
-                                          const int32_t *__restrict__ pSrcB,
-                                          uint32_t M,
-                                          uint32_t N,
-                                          uint32_t O,
-                                          uint32_t shift,
-                                          int32_t *__restrict__ pDstC);
+/**
+ * @brief      Quantized 16 bit Stockham complex fast fourier transform for XPULPV2
+ * @param[in]  S       points to an instance of the 16bit quantized CFFT structure
+ * @param[in]  pSrc    points to the input buffer of size <code>2*fftLen</code>, it is not modified
+ * @param[in]  pBuf    points to a temporary buffer of size <code>2*fftLen</code>
+ * @param[out] pDst    points to the output buffer of size <code>2*fftLen</code>
+ * @return     none
+ */
 
-/** -------------------------------------------------------
-  @brief      matrix transpose matrix multiplication for complex 32-bit fix-point on XpulpV2
-  @param[in]  pSrcA Points to the first input matrix of shape MxN
-  @param[in]  pSrcB Points to the second input matrix of shape OxN
-  @param[in]  M     Height of matrix SrcA and DstC
-  @param[in]  N     Width of matrix SrcA and SrcB
-  @param[in]  O     Height of matrix SrcB and width of matrix DstC
-  @param[in]  shift Amount to shift the result of each multiplication ot the right
-  @param[out] pDstC Points to the output matrix of shape MxO
-  @return     none
+void plp_cfft_stockham_q16s_xpulpv2(const plp_cfft_instance_q16 *S,
+                                    const int16_t *pSrc,
+                                    int16_t *pBuf,
+                                    int16_t *pDst);
 
-  @par Fix-Point
-  Fix-Point and Shifting
-  The result will be shifted by the parameter `shift` to the right (which corresponds to a
-  multiplication by `2^-shift`). Assume that matrix A is represente as `pSrcA * 2^-x` and matrix B
-  as `pSrcB * 2^-y` (which means that A has `x`, and B has `y` bits after the binary point). Then,
-  the output matrix C is represented as `pDstC * 2^-(x + y - shift)`.
-  The output matrix is also stored with the same number of bits as the inputs. Set the
-  `shift` parameter such that no overflow occurrs.
-*/
+/**
+ * @brief      Parallel quantized 16 bit Stockham complex fast fourier transform for XPULPV2
+ * @param[in]   args    points to the plp_cfft_stockham_instance_q16_parallel
+ */
 
-void plp_mat_mult_trans_cmplx_q32s_xpulpv2(const int32_t *__restrict__ pSrcA,
-                                           const int32_t *__restrict__ pSrcB,
-                                           uint32_t M,
-                                           uint32_t N,
-                                           uint32_t O,
-                                           uint32_t shift,
-                                           int32_t *__restrict__ pDstC);
+void plp_cfft_stockham_q16p_xpulpv2(void *args);
 
-/** -------------------------------------------------------
-  @brief      Glue code of parallel matrix transpose matrix multiplication for complex 32-bit
-              fix-point
-  @param[in]  pSrcA Points to the first input matrix of shape MxN
-  @param[in]  pSrcB Points to the second input matrix of shape OxN
-  @param[in]  M     Height of matrix SrcA and DstC
-  @param[in]  N     Width of matrix SrcA and SrcB
-  @param[in]  O     Height of matrix SrcB and width of matrix DstC
-  @param[in]  shift Amount to shift the result of each multiplication ot the right
-  @param[in]  nPE   Number of cores to use for computation
-  @param[out] pDstC Points to the output matrix of shape MxO
-  @return     none
+/**
+ * @brief      Glue code for the block-floating-point quantized 16 bit complex fast fourier
+ *             transform. Instead of scaling every stage down by its radix, only the stages which
+ *             could overflow are scaled, and low-amplitude inputs are scaled up to use the headroom.
+ *             The output X satisfies <code>spectrum = X * 2^(*pExponent)</code>, with X in the same
+ *             fixed-point format as the input.
+ * @param[in]     S               points to an instance of the 16bit quantized CFFT structure
+ * @param[in,out] p1              points to the complex data buffer of size <code>2*fftLen</code>.
+ * Processing occurs in-place.
+ * @param[in]     bitReverseFlag  flag that enables (bitReverseFlag=1) of disables
+ * (bitReverseFlag=0) bit reversal of output.
+ * @param[out]    pExponent       points to the exponent of the output block
+ * @return        none
+ */
 
-  @par Fix-Point
-  Fix-Point and Shifting
-  The result will be shifted by the parameter `shift` to the right (which corresponds to a
-  multiplication by `2^-shift`). Assume that matrix A is represente as `pSrcA * 2^-x` and matrix B
-  as `pSrcB * 2^-y` (which means that A has `x`, and B has `y` bits after the binary point). Then,
-  the output matrix C is represented as `pDstC * 2^-(x + y - shift)`.
-  The output matrix is also stored with the same number of bits as the inputs. Set the
-  `shift` parameter such that no overflow occurrs.
-*/
+void plp_cfft_bfp_q16(const plp_cfft_instance_q16 *S,
+                      int16_t *p1,
+                      uint8_t bitReverseFlag,
+                      int32_t *pExponent);
 
-void plp_mat_mult_trans_cmplx_q32_parallel(const int32_t *__restrict__ pSrcA,
-                                           const int32_t *__restrict__ pSrcB,
-                                           uint32_t M,
-                                           uint32_t N,
-                                           uint32_t O,
-                                           uint32_t shift,
-                                           uint32_t nPE,
-                                           int32_t *__restrict__ pDstC);
+/**
+ * @brief      Glue code for the parallel block-floating-point quantized 16 bit complex fast fourier
+ *             transform
+ * @param[in]     S               points to an instance of the 16bit quantized CFFT structure
+ * @param[in,out] p1              points to the complex data buffer of size <code>2*fftLen</code>.
+ * Processing occurs in-place.
+ * @param[in]     bitReverseFlag  flag that enables (bitReverseFlag=1) of disables
+ * (bitReverseFlag=0) bit reversal of output.
+ * @param[in]     nPE             number of cores to use
+ * @param[out]    pExponent       points to the exponent of the output block
+ * @return        none
+ */
 
-/** -------------------------------------------------------
-  @brief      parallel matrix transpose matrix multiplication for complex 32-bit fix-point on
-              XpulpV2
-  @param[in]  args  pointer to plp_mat_mult_cmplx_instance_q32 struct initialized by
-                    plp_mat_mult_trans_cmplx_q32_parallel
-  @return     none
+void plp_cfft_bfp_q16_parallel(const plp_cfft_instance_q16 *S,
+                               int16_t *p1,
+                               uint8_t bitReverseFlag,
+                               uint32_t nPE,
+                               int32_t *pExponent);
 
-  @par Fix-Point
-  Fix-Point and Shifting
-  The result will be shifted by the parameter `shift` to the right (which corresponds to a
-  multiplication by `2^-shift`). Assume that matrix A is represente as `pSrcA * 2^-x` and matrix B
-  as `pSrcB * 2^-y` (which means that A has `x`, and B has `y` bits after the binary point). Then,
-  the output matrix C is represented as `pDstC * 2^-(x + y - shift)`.
-  The output matrix is also stored with the same number of bits as the inputs. Set the
-  `shift` parameter such that no overflow occurrs.
-*/
+/**
+ * @brief      Block-floating-point quantized 16 bit complex fast fourier transform for RV32IM
+ * @param[in]     S               points to an instance of the 16bit quantized CFFT structure
+ * @param[in,out] p1              points to the complex data buffer of size <code>2*fftLen</code>.
+ * Processing occurs in-place.
+ * @param[in]     bitReverseFlag  flag that enables (bitReverseFlag=1) of disables
+ * (bitReverseFlag=0) bit reversal of output.
+ * @param[out]    pExponent       points to the exponent of the output block
+ * @return        none
+ */
 
-void plp_mat_mult_trans_cmplx_q32p_xpulpv2(void *args);
+void plp_cfft_bfp_q16s_rv32im(const plp_cfft_instance_q16 *S,
+                              int16_t *p1,
+                              uint8_t bitReverseFlag,
+                              int32_t *pExponent);
 
-/** -------------------------------------------------------
-  @brief      Glue code of matrix transpose matrix multiplication for complex 16-bit fix-point
-  @param[in]  pSrcA Points to the first input matrix of shape MxN
-  @param[in]  pSrcB Points to the second input matrix of shape OxN
-  @param[in]  M     Height of matrix SrcA and DstC
-  @param[in]  N     Width of matrix SrcA and SrcB
-  @param[in]  O     Height of matrix SrcB and width of matrix DstC
-  @param[in]  shift Amount to shift the result of each multiplication ot the right
-  @param[out] pDstC Points to the output matrix of shape MxO
-  @return     none
+/**
+ * @brief      Block-floating-point quantized 16 bit complex fast fourier transform for XPULPV2
+ * @param[in]     S               points to an instance of the 16bit quantized CFFT structure
+ * @param[in,out] p1              points to the complex data buffer of size <code>2*fftLen</code>.
+ * Processing occurs in-place.
+ * @param[in]     bitReverseFlag  flag that enables (bitReverseFlag=1) of disables
+ * (bitReverseFlag=0) bit reversal of output.
+ * @param[out]    pExponent       points to the exponent of the output block
+ * @return        none
+ */
 
-  @par Fix-Point
-  Fix-Point and Shifting
-  The result will be shifted by the parameter `shift` to the right (which corresponds to a
-  multiplication by `2^-shift`). Assume that matrix A is represente as `pSrcA * 2^-x` and matrix B
-  as `pSrcB * 2^-y` (which means that A has `x`, and B has `y` bits after the binary point). Then,
-  the output matrix C is represented as `pDstC * 2^-(x + y - shift)`.
-  The output matrix is also stored with the same number of bits as the inputs. Set the
-  `shift` parameter such that no overflow occurrs.
-*/
+void plp_cfft_bfp_q16s_xpulpv2(const plp_cfft_instance_q16 *S,
+                               int16_t *p1,
+                               uint8_t bitReverseFlag,
+                               int32_t *pExponent);
 
-void plp_mat_mult_trans_cmplx_q16(const int16_t *__restrict__ pSrcA,
-                                  const int16_t *__restrict__ pSrcB,
-                                  uint32_t M,
-                                  uint32_t N,
-                                  uint32_t O,
-                                  uint32_t shift,
-                                  int16_t *__restrict__ pDstC);
+/**
+ * @brief      Parallel block-floating-point quantized 16 bit complex fast fourier transform for
+ *             XPULPV2
+ * @param[in]   args    points to the plp_cfft_bfp_instance_q16_parallel
+ */
 
-/** -------------------------------------------------------
-  @brief      matrix transpose matrix multiplication for complex 16-bit fix-point on RV32IM
-  @param[in]  pSrcA Points to the first input matrix of shape MxN
-  @param[in]  pSrcB Points to the second input matrix of shape OxN
-  @param[in]  M     Height of matrix SrcA and DstC
-  @param[in]  N     Width of matrix SrcA and SrcB
-  @param[in]  O     Height of matrix SrcB and width of matrix DstC
-  @param[in]  shift Amount to shift the result of each multiplication ot the right
-  @param[out] pDstC Points to the output matrix of shape MxO
-  @return     none
+void plp_cfft_bfp_q16p_xpulpv2(void *args);
 
-  @par Fix-Point
-  Fix-Point and Shifting
-  The result will be shifted by the parameter `shift` to the right (which corresponds to a
-  multiplication by `2^-shift`). Assume that matrix A is represente as `pSrcA * 2^-x` and matrix B
-  as `pSrcB * 2^-y` (which means that A has `x`, and B has `y` bits after the binary point). Then,
-  the output matrix C is represented as `pDstC * 2^-(x + y - shift)`.
-  The output matrix is also stored with the same number of bits as the inputs. Set the
-  `shift` parameter such that no overflow occurrs.
+/**
+  @brief      In-place 32 bit reversal function for RV32IM
+  @param[in,out] pSrc        points to in-place buffer of unknown 32-bit data type
+  @param[in]  bitRevLen   bit reversal table length
+  @param[in]  pBitRevTab  points to bit reversal table
+  @return     none
 */
 
-void plp_mat_mult_trans_cmplx_q16s_rv32im(const int16_t *__restrict__ pSrcA,
-                                          const int16_t *__restrict__ pSrcB,
-                                          uint32_t M,
-                                          uint32_t N,
-                                          uint32_t O,
-                                          uint32_t shift,
-                                          int16_t *__restrict__ pDstC);
+void
+plp_bitreversal_32s_rv32im(uint32_t *pSrc, const uint16_t bitRevLen, const uint16_t *pBitRevTab);
 
-/** -------------------------------------------------------
-  @brief      matrix transpose matrix multiplication for complex 16-bit fix-point on XpulpV2
-  @param[in]  pSrcA Points to the first input matrix of shape MxN
-  @param[in]  pSrcB Points to the second input matrix of shape OxN
-  @param[in]  M     Height of matrix SrcA and DstC
-  @param[in]  N     Width of matrix SrcA and SrcB
-  @param[in]  O     Height of matrix SrcB and width of matrix DstC
-  @param[in]  shift Amount to shift the result of each multiplication ot the right
-  @param[out] pDstC Points to the output matrix of shape MxO
+/**
+  @brief      In-place 32 bit reversal function for XPULPV2
+  @param[in,out] pSrc        points to in-place buffer of unknown 32-bit data type
+  @param[in]  bitRevLen   bit reversal table length
+  @param[in]  pBitRevTab  points to bit reversal table
   @return     none
+*/
 
-  @par Fix-Point
-  Fix-Point and Shifting
-  The result will be shifted by the parameter `shift` to the right (which corresponds to a
-  multiplication by `2^-shift`). Assume that matrix A is represente as `pSrcA * 2^-x` and matrix B
-  as `pSrcB * 2^-y` (which means that A has `x`, and B has `y` bits after the binary point). Then,
-  the output matrix C is represented as `pDstC * 2^-(x + y - shift)`.
-  The output matrix is also stored with the same number of bits as the inputs. Set the
-  `shift` parameter such that no overflow occurrs.
+void
+plp_bitreversal_32s_xpulpv2(uint32_t *pSrc, const uint16_t bitRevLen, const uint16_t *pBitRevTab);
 
-  @par Exploiting SIMD instructions
-  The 16 bit values are packed two each into 32 bit vectors and then the two dot products are
-  performed on 32 bit vectors, with 32 bit accumulator.
+/**
+  @brief      Parallel in-place 32 bit reversal function for XPULPV2
+  @param[in,out] pSrc        points to in-place buffer of unknown 32-bit data type
+  @param[in]  bitRevLen   bit reversal table length
+  @param[in]  pBitRevTab  points to bit reversal table
+  @param[in]  nPE         number of cores
+  @return     none
 */
 
-void plp_mat_mult_trans_cmplx_q16s_xpulpv2(const int16_t *__restrict__ pSrcA,
-                                           const int16_t *__restrict__ pSrcB,
-                                           uint32_t M,
-                                           uint32_t N,
-                                           uint32_t O,
-                                           uint32_t shift,
-                                           int16_t *__restrict__ pDstC);
+void plp_bitreversal_32p_xpulpv2(uint32_t *pSrc,
+                                 const uint16_t bitRevLen,
+                                 const uint16_t *pBitRevTab,
+                                 uint32_t nPE);
 
-/** -------------------------------------------------------
-  @brief      Glue code of parallel matrix transpose matrix multiplication for complex 16-bit
-              fix-point
-  @param[in]  pSrcA Points to the first input matrix of shape MxN
-  @param[in]  pSrcB Points to the second input matrix of shape OxN
-  @param[in]  M     Height of matrix SrcA and DstC
-  @param[in]  N     Width of matrix SrcA and SrcB
-  @param[in]  O     Height of matrix SrcB and width of matrix DstC
-  @param[in]  shift Amount to shift the result of each multiplication ot the right
-  @param[in]  nPE   Number of cores to use for computation
-  @param[out] pDstC Points to the output matrix of shape MxO
-  @return     none
+/**
+ * @brief      Glue code for quantized 32-bit complex fast fourier transform
+ * 
+ * Fixed point units input -> output dependent on length:
+ * len=16:    Q1.31 -> Q5.27
+ * len=32:    Q1.31 -> Q6.26
+ * len=64:    Q1.31 -> Q7.25
+ * len=128:   Q1.31 -> Q8.24
+ * len=256:   Q1.31 -> Q9.23
+ * len=512:   Q1.31 -> Q10.22
+ * len=1024:  Q1.31 -> Q11.21
+ * len=2048:  Q1.31 -> Q12.20
+ * len=4096:  Q1.31 -> Q13.19
+ *
+ * @param[in]  S               points to an instance of the 32bit quantized CFFT structure
+ * @param      p1              points to the complex data buffer of size <code>2*fftLen</code>. Processing occurs in-place.
+ * @param[in]  ifftFlag        flag that selects forwart (ifftFlag=0) or inverse (ifftFlag=1)
+ * @param[in]  bitReverseFlag  flag that enables (bitReverseFlag=1) of disables
+ * (bitReverseFlag=0) bit reversal of output.
+ * @param[in]  fracBits        decimal point for right shift (input format Q(32-fracBits).fracBits)
+ */
+
+void plp_cfft_q32(const plp_cfft_instance_q32 *S,
+                      int32_t *p1,
+                      uint8_t ifftFlag,
+                      uint8_t bitReverseFlag,
+                      uint32_t fracBits);
+
+/**
+ * @brief      Quantized 32-bit complex fast fourier transform for RV32IM
+ *
+ * @param[in]  S               points to an instance of the 32bit quantized CFFT structure
+ * @param      p1              points to the complex data buffer of size <code>2*fftLen</code>. Processing occurs in-place.
+ * @param[in]  ifftFlag        flag that selects forwart (ifftFlag=0) or inverse (ifftFlag=1)
+ * @param[in]  bitReverseFlag  flag that enables (bitReverseFlag=1) of disables
+ * (bitReverseFlag=0) bit reversal of output.
+ * @param[in]  fracBits        decimal point for right shift (input format Q(32-fracBits).fracBits)
+ */
 
-  @par Fix-Point
-  Fix-Point and Shifting
-  The result will be shifted by the parameter `shift` to the right (which corresponds to a
-  multiplication by `2^-shift`). Assume that matrix A is represente as `pSrcA * 2^-x` and matrix B
-  as `pSrcB * 2^-y` (which means that A has `x`, and B has `y` bits after the binary point). Then,
-  the output matrix C is represented as `pDstC * 2^-(x + y - shift)`.
-  The output matrix is also stored with the same number of bits as the inputs. Set the
-  `shift` parameter such that no overflow occurrs.
-*/
+void plp_cfft_q32s_rv32im(const plp_cfft_instance_q32 *S,
+                      int32_t *p1,
+                      uint8_t ifftFlag,
+                      uint8_t bitReverseFlag,
+                      uint32_t fracBits);
 
-void plp_mat_mult_trans_cmplx_q16_parallel(const int16_t *__restrict__ pSrcA,
-                                           const int16_t *__restrict__ pSrcB,
-                                           uint32_t M,
-                                           uint32_t N,
-                                           uint32_t O,
-                                           uint32_t shift,
-                                           uint32_t nPE,
-                                           int16_t *__restrict__ pDstC);
+/**
+ * @brief      Quantized 32-bit complex fast fourier transform for XPULPV2
+ *
+ * @param[in]  S               points to an instance of the 32bit quantized CFFT structure
+ * @param      p1              points to the complex data buffer of size <code>2*fftLen</code>. Processing occurs in-place.
+ * @param[in]  ifftFlag        flag that selects forwart (ifftFlag=0) or inverse (ifftFlag=1)
+ * @param[in]  bitReverseFlag  flag that enables (bitReverseFlag=1) of disables
+ * (bitReverseFlag=0) bit reversal of output.
+ * @param[in]  fracBits        decimal point for right shift (input format Q(32-fracBits).fracBits)
+ */
 
-/** -------------------------------------------------------
-  @brief      parallel matrix transpose matrix multiplication for complex 16-bit fix-point on
-              XpulpV2
-  @param[in]  args  pointer to plp_mat_mult_cmplx_instance_q16 struct initialized by
-                    plp_mat_mult_trans_cmplx_q16_parallel
-  @return     none
+void plp_cfft_q32s_xpulpv2(const plp_cfft_instance_q32 *S,
+                      int32_t *p1,
+                      uint8_t ifftFlag,
+                      uint8_t bitReverseFlag,
+                      uint32_t fracBits);
 
-  @par Fix-Point
-  Fix-Point and Shifting
-  The result will be shifted by the parameter `shift` to the right (which corresponds to a
-  multiplication by `2^-shift`). Assume that matrix A is represente as `pSrcA * 2^-x` and matrix B
-  as `pSrcB * 2^-y` (which means that A has `x`, and B has `y` bits after the binary point). Then,
-  the output matrix C is represented as `pDstC * 2^-(x + y - shift)`.
-  The output matrix is also stored with the same number of bits as the inputs. Set the
-  `shift` parameter such that no overflow occurrs.
+/**
+ * @brief      Glue code for parallel quantized 32-bit complex fast fourier transform
+ *
+ * The output has the same format as plp_cfft_q32, e.g. Q1.31 -> Q11.21 for len=1024.
+ *
+ * @param[in]  S               points to an instance of the 32bit quantized CFFT structure
+ * @param[in,out] p1           points to the complex data buffer of size <code>2*fftLen</code>.
+ * Processing occurs in-place.
+ * @param[in]  ifftFlag        flag that selects forward (ifftFlag=0) or inverse (ifftFlag=1)
+ * @param[in]  bitReverseFlag  flag that enables (bitReverseFlag=1) of disables
+ * (bitReverseFlag=0) bit reversal of output.
+ * @param[in]  fracBits        decimal point for right shift (input format Q(32-fracBits).fracBits)
+ * @param[in]  nPE             Number of cores to use
+ */
 
-  @par Exploiting SIMD instructions
-  The 16 bit values are packed two each into 32 bit vectors and then the two dot products are
-  performed on 32 bit vectors, with 32 bit accumulator.
-*/
+void plp_cfft_q32_parallel(const plp_cfft_instance_q32 *S,
+                           int32_t *p1,
+                           uint8_t ifftFlag,
+                           uint8_t bitReverseFlag,
+                           uint32_t fracBits,
+                           uint32_t nPE);
 
-void plp_mat_mult_trans_cmplx_q16p_xpulpv2(void *args);
+/**
+ * @brief      Parallel quantized 32-bit complex fast fourier transform for XPULPV2
+ * @param[in]   args    points to the plp_cfft_instance_q32_parallel
+ */
 
-/** -------------------------------------------------------
-  @brief      Glue code of matrix transpose matrix multiplication for complex 8-bit fix-point
-  @param[in]  pSrcA Points to the first input matrix of shape MxN
-  @param[in]  pSrcB Points to the second input matrix of shape OxN
-  @param[in]  M     Height of matrix SrcA and DstC
-  @param[in]  N     Width of matrix SrcA and SrcB
-  @param[in]  O     Height of matrix SrcB and width of matrix DstC
-  @param[in]  shift Amount to shift the result of each multiplication ot the right
-  @param[out] pDstC Points to the output matrix of shape MxO
-  @return     none
+void plp_cfft_q32p_xpulpv2(void *args);
 
-  @par Fix-Point
-  Fix-Point and Shifting
-  The result will be shifted by the parameter `shift` to the right (which corresponds to a
-  multiplication by `2^-shift`). Assume that matrix A is represente as `pSrcA * 2^-x` and matrix B
-  as `pSrcB * 2^-y` (which means that A has `x`, and B has `y` bits after the binary point). Then,
-  the output matrix C is represented as `pDstC * 2^-(x + y - shift)`.
-  The output matrix is also stored with the same number of bits as the inputs. Set the
-  `shift` parameter such that no overflow occurrs.
+/**
+   @brief Batch of floating-point FFTs on complex input data, one transform per core.
+   @param[in]   S       points to an instance of the floating-point FFT structure
+   @param[in]   pSrc    points to the first input frame (complex data)
+   @param[out]  pDst    points to the first output frame (complex data)
+   @param[in]   count   number of transforms
+   @param[in]   stride  distance between two frames in floats, at least 2*FFTLength
+   @param[in]   pBuf    points to an L1 buffer of 12*FFTLength*nPE floats for prefetching the
+                        frames with the DMA, or NULL to process the frames where they are
+   @param[in]   nPE     number of cores
+   @return      none
 */
+void plp_cfft_batch_f32(const plp_fft_instance_f32 *S,
+                        const float32_t *pSrc,
+                        float32_t *pDst,
+                        uint32_t count,
+                        uint32_t stride,
+                        float32_t *pBuf,
+                        uint32_t nPE);
 
-void plp_mat_mult_trans_cmplx_q8(const int8_t *__restrict__ pSrcA,
-                                 const int8_t *__restrict__ pSrcB,
-                                 uint32_t M,
-                                 uint32_t N,
-                                 uint32_t O,
-                                 uint32_t shift,
-                                 int8_t *__restrict__ pDstC);
+/**
+   @brief Batch of 16-bit fixed-point in-place FFTs on complex data, one transform per core.
+   @param[in]     S               points to an instance of the 16bit quantized CFFT structure
+   @param[in,out] p1              points to the first frame (complex data)
+   @param[in]     count           number of transforms
+   @param[in]     stride          distance between two frames in values, at least 2*fftLen
+   @param[in]     ifftFlag        flag that selects forward (ifftFlag=0) or inverse (ifftFlag=1)
+   @param[in]     bitReverseFlag  flag that enables (bitReverseFlag=1) the bit reversal of output
+   @param[in]     deciPoint       decimal point for right shift
+   @param[in]     pBuf            points to an L1 buffer of 6*fftLen*nPE values for prefetching
+                                  the frames with the DMA, or NULL to process the frames in place
+   @param[in]     nPE             number of cores
+   @return        none
+*/
+void plp_cfft_batch_q16(const plp_cfft_instance_q16 *S,
+                        int16_t *p1,
+                        uint32_t count,
+                        uint32_t stride,
+                        uint8_t ifftFlag,
+                        uint8_t bitReverseFlag,
+                        uint32_t deciPoint,
+                        int16_t *pBuf,
+                        uint32_t nPE);
 
-/** -------------------------------------------------------
-  @brief      matrix transpose matrix multiplication for complex 8-bit fix-point on RV32IM
-  @param[in]  pSrcA Points to the first input matrix of shape MxN
-  @param[in]  pSrcB Points to the second input matrix of shape OxN
-  @param[in]  M     Height of matrix SrcA and DstC
-  @param[in]  N     Width of matrix SrcA and SrcB
-  @param[in]  O     Height of matrix SrcB and width of matrix DstC
-  @param[in]  shift Amount to shift the result of each multiplication ot the right
-  @param[out] pDstC Points to the output matrix of shape MxO
-  @return     none
+/**
+   @brief Batch of 32-bit fixed-point in-place FFTs on complex data, one transform per core.
+   @param[in]     S               points to an instance of the 32bit quantized CFFT structure
+   @param[in,out] p1              points to the first frame (complex data)
+   @param[in]     count           number of transforms
+   @param[in]     stride          distance between two frames in values, at least 2*fftLen
+   @param[in]     ifftFlag        flag that selects forward (ifftFlag=0) or inverse (ifftFlag=1)
+   @param[in]     bitReverseFlag  flag that enables (bitReverseFlag=1) the bit reversal of output
+   @param[in]     fracBits        decimal point for right shift
+   @param[in]     pBuf            points to an L1 buffer of 6*fftLen*nPE values for prefetching
+                                  the frames with the DMA, or NULL to process the frames in place
+   @param[in]     nPE             number of cores
+   @return        none
+*/
+void plp_cfft_batch_q32(const plp_cfft_instance_q32 *S,
+                        int32_t *p1,
+                        uint32_t count,
+                        uint32_t stride,
+                        uint8_t ifftFlag,
+                        uint8_t bitReverseFlag,
+                        uint32_t fracBits,
+                        int32_t *pBuf,
+                        uint32_t nPE);
 
-  @par Fix-Point
-  Fix-Point and Shifting
-  The result will be shifted by the parameter `shift` to the right (which corresponds to a
-  multiplication by `2^-shift`). Assume that matrix A is represente as `pSrcA * 2^-x` and matrix B
-  as `pSrcB * 2^-y` (which means that A has `x`, and B has `y` bits after the binary point). Then,
-  the output matrix C is represented as `pDstC * 2^-(x + y - shift)`.
-  The output matrix is also stored with the same number of bits as the inputs. Set the
-  `shift` parameter such that no overflow occurrs.
+/**
+   @brief Batch of floating-point FFTs on real input data, one transform per core.
+   @param[in]   S          points to an instance of the floating-point FFT structure, with
+                           bitReverseFlag = 1 for the output in natural order
+   @param[in]   pSrc       points to the first input frame (real data)
+   @param[out]  pDst       points to the first output frame (complex data, 2*FFTLength floats)
+   @param[in]   count      number of transforms
+   @param[in]   srcStride  distance between two input frames in floats, at least FFTLength
+   @param[in]   dstStride  distance between two output frames in floats, at least 2*FFTLength
+   @param[in]   pBuf       points to an L1 buffer of 9*FFTLength*nPE floats for prefetching the
+                           frames with the DMA, or NULL to process the frames where they are
+   @param[in]   nPE        number of cores
+   @return      none
 */
+void plp_rfft_batch_f32(const plp_fft_instance_f32 *S,
+                        const float32_t *pSrc,
+                        float32_t *pDst,
+                        uint32_t count,
+                        uint32_t srcStride,
+                        uint32_t dstStride,
+                        float32_t *pBuf,
+                        uint32_t nPE);
 
-void plp_mat_mult_trans_cmplx_q8s_rv32im(const int8_t *__restrict__ pSrcA,
-                                         const int8_t *__restrict__ pSrcB,
-                                         uint32_t M,
-                                         uint32_t N,
-                                         uint32_t O,
-                                         uint32_t shift,
-                                         int8_t *__restrict__ pDstC);
+/**
+   @brief Batch of 16-bit fixed-point FFTs on real input data, one transform per core.
+   @param[in]   S          points to an instance of the 16bit quantized RFFT structure
+   @param[in]   pSrc       points to the first input frame (real data)
+   @param[out]  pDst       points to the first output frame (complex data, fftLenReal+2 values)
+   @param[in]   count      number of transforms
+   @param[in]   srcStride  distance between two input frames in values, at least fftLenReal
+   @param[in]   dstStride  distance between two output frames in values, at least fftLenReal+2
+   @param[in]   pBuf       points to an L1 buffer of 3*(2*fftLenReal+2)*nPE values for prefetching
+                           the frames with the DMA, or NULL to process the frames where they are
+   @param[in]   nPE        number of cores
+   @return      none
+*/
+void plp_rfft_batch_q16(const plp_rfft_instance_q16 *S,
+                        const int16_t *pSrc,
+                        int16_t *pDst,
+                        uint32_t count,
+                        uint32_t srcStride,
+                        uint32_t dstStride,
+                        int16_t *pBuf,
+                        uint32_t nPE);
 
-/** -------------------------------------------------------
-  @brief      matrix transpose matrix multiplication for complex 8-bit fix-point on XpulpV2
-  @param[in]  pSrcA Points to the first input matrix of shape MxN
-  @param[in]  pSrcB Points to the second input matrix of shape OxN
-  @param[in]  M     Height of matrix SrcA and DstC
-  @param[in]  N     Width of matrix SrcA and SrcB
-  @param[in]  O     Height of matrix SrcB and width of matrix DstC
-  @param[in]  shift Amount to shift the result of each multiplication ot the right
-  @param[out] pDstC Points to the output matrix of shape MxO
-  @return     none
+/**
+   @brief Batch of 32-bit fixed-point FFTs on real input data, one transform per core.
+   @param[in]   S          points to an instance of the 32bit quantized RFFT structure
+   @param[in]   pSrc       points to the first input frame (real data)
+   @param[out]  pDst       points to the first output frame (complex data, fftLenReal+2 values)
+   @param[in]   count      number of transforms
+   @param[in]   srcStride  distance between two input frames in values, at least fftLenReal
+   @param[in]   dstStride  distance between two output frames in values, at least fftLenReal+2
+   @param[in]   pBuf       points to an L1 buffer of 3*(2*fftLenReal+2)*nPE values for prefetching
+                           the frames with the DMA, or NULL to process the frames where they are
+   @param[in]   nPE        number of cores
+   @return      none
+*/
+void plp_rfft_batch_q32(const plp_rfft_instance_q32 *S,
+                        const int32_t *pSrc,
+                        int32_t *pDst,
+                        uint32_t count,
+                        uint32_t srcStride,
+                        uint32_t dstStride,
+                        int32_t *pBuf,
+                        uint32_t nPE);
 
-  @par Fix-Point
-  Fix-Point and Shifting
-  The result will be shifted by the parameter `shift` to the right (which corresponds to a
-  multiplication by `2^-shift`). Assume that matrix A is represente as `pSrcA * 2^-x` and matrix B
-  as `pSrcB * 2^-y` (which means that A has `x`, and B has `y` bits after the binary point). Then,
-  the output matrix C is represented as `pDstC * 2^-(x + y - shift)`.
-  The output matrix is also stored with the same number of bits as the inputs. Set the
-  `shift` parameter such that no overflow occurrs.
+/**
+   @brief      Batched floating-point complex FFTs for XPULPV2, one transform per core
+   @param[in]  args  points to the plp_fft_batch_instance
+   @return     none
+*/
+void plp_cfft_batch_f32p_xpulpv2(void *args);
 
-  @par Exploiting SIMD instructions
-  The 8 bit values are packed four each into 32 bit vectors and then the four dot products are
-  performed on 32 bit vectors, with 32 bit accumulator.
+/**
+   @brief      Batched 16-bit fixed-point complex FFTs for XPULPV2, one transform per core
+   @param[in]  args  points to the plp_fft_batch_instance
+   @return     none
 */
+void plp_cfft_batch_q16p_xpulpv2(void *args);
 
-void plp_mat_mult_trans_cmplx_q8s_xpulpv2(const int8_t *__restrict__ pSrcA,
-                                          const int8_t *__restrict__ pSrcB,
-                                          uint32_t M,
-                                          uint32_t N,
-                                          uint32_t O,
-                                          uint32_t shift,
-                                          int8_t *__restrict__ pDstC);
+/**
+   @brief      Batched 32-bit fixed-point complex FFTs for XPULPV2, one transform per core
+   @param[in]  args  points to the plp_fft_batch_instance
+   @return     none
+*/
+void plp_cfft_batch_q32p_xpulpv2(void *args);
 
-/** -------------------------------------------------------
-  @brief      Glue code of parallel matrix transpose matrix multiplication for complex 8-bit
-              fix-point
-  @param[in]  pSrcA Points to the first input matrix of shape MxN
-  @param[in]  pSrcB Points to the second input matrix of shape OxN
-  @param[in]  M     Height of matrix SrcA and DstC
-  @param[in]  N     Width of matrix SrcA and SrcB
-  @param[in]  O     Height of matrix SrcB and width of matrix DstC
-  @param[in]  shift Amount to shift the result of each multiplication ot the right
-  @param[in]  nPE   Number of cores to use for computation
-  @param[out] pDstC Points to the output matrix of shape MxO
-  @return     none
+/**
+   @brief      Batched floating-point real FFTs for XPULPV2, one transform per core
+   @param[in]  args  points to the plp_fft_batch_instance
+   @return     none
+*/
+void plp_rfft_batch_f32p_xpulpv2(void *args);
 
-  @par Fix-Point
-  Fix-Point and Shifting
-  The result will be shifted by the parameter `shift` to the right (which corresponds to a
-  multiplication by `2^-shift`). Assume that matrix A is represente as `pSrcA * 2^-x` and matrix B
-  as `pSrcB * 2^-y` (which means that A has `x`, and B has `y` bits after the binary point). Then,
-  the output matrix C is represented as `pDstC * 2^-(x + y - shift)`.
-  The output matrix is also stored with the same number of bits as the inputs. Set the
-  `shift` parameter such that no overflow occurrs.
+/**
+   @brief      Batched 16-bit fixed-point real FFTs for XPULPV2, one transform per core
+   @param[in]  args  points to the plp_fft_batch_instance
+   @return     none
 */
+void plp_rfft_batch_q16p_xpulpv2(void *args);
 
-void plp_mat_mult_trans_cmplx_q8_parallel(const int8_t *__restrict__ pSrcA,
-                                          const int8_t *__restrict__ pSrcB,
-                                          uint32_t M,
-                                          uint32_t N,
-                                          uint32_t O,
-                                          uint32_t shift,
-                                          uint32_t nPE,
-                                          int8_t *__restrict__ pDstC);
+/**
+   @brief      Batched 32-bit fixed-point real FFTs for XPULPV2, one transform per core
+   @param[in]  args  points to the plp_fft_batch_instance
+   @return     none
+*/
+void plp_rfft_batch_q32p_xpulpv2(void *args);
 
-/** -------------------------------------------------------
-  @brief      parallel matrix transpose matrix multiplication for complex 8-bit fix-point on XpulpV2
-  @param[in]  args  pointer to plp_mat_mult_cmplx_instance_q8 struct initialized by
-                    plp_mat_mult_trans_cmplx_q8_parallel
-  @return     none
+/**
+ * @brief      Glue code for quantized 16 bit fast fourier transform on real input data
+ *
+ * The real input of length N is processed as a complex sequence of length N/2, transformed with
+ * the complex FFT and split into the spectrum of the real sequence. Only the first N/2+1 complex
+ * values are computed, the others follow from the conjugate symmetry of the spectrum.
+ *
+ * Fixed point units input -> output dependent on length:
+ * len=32:    Q1.15 -> Q6.10
+ * len=64:    Q1.15 -> Q7.9
+ * len=128:   Q1.15 -> Q8.8
+ * len=256:   Q1.15 -> Q9.7
+ * len=512:   Q1.15 -> Q10.6
+ * len=1024:  Q1.15 -> Q11.5
+ * len=2048:  Q1.15 -> Q12.4
+ * len=4096:  Q1.15 -> Q13.3 *
+ * @param[in]  S       points to an instance of the 16bit quantized RFFT structure
+ * @param[in]  pSrc    points to the real input buffer of size <code>fftLenReal</code>
+ * @param[out] pDst    points to the complex output buffer of size <code>fftLenReal+2</code> */
 
-  @par Fix-Point
-  Fix-Point and Shifting
-  The result will be shifted by the parameter `shift` to the right (which corresponds to a
-  multiplication by `2^-shift`). Assume that matrix A is represente as `pSrcA * 2^-x` and matrix B
-  as `pSrcB * 2^-y` (which means that A has `x`, and B has `y` bits after the binary point). Then,
-  the output matrix C is represented as `pDstC * 2^-(x + y - shift)`.
-  The output matrix is also stored with the same number of bits as the inputs. Set the
-  `shift` parameter such that no overflow occurrs.
+void plp_rfft_q16(const plp_rfft_instance_q16 *S,
+                  const int16_t *__restrict__ pSrc,
+                  int16_t *__restrict__ pDst);
 
-  @par Exploiting SIMD instructions
-  The 8 bit values are packed four each into 32 bit vectors and then the four dot products are
-  performed on 32 bit vectors, with 32 bit accumulator.
-*/
+/**
+ * @brief      Glue code for parallel quantized 16 bit fast fourier transform on real input data
+ *
+ * Fixed point units input -> output dependent on length:
+ * len=32:    Q1.15 -> Q6.10
+ * len=64:    Q1.15 -> Q7.9
+ * len=128:   Q1.15 -> Q8.8
+ * len=256:   Q1.15 -> Q9.7
+ * len=512:   Q1.15 -> Q10.6
+ * len=1024:  Q1.15 -> Q11.5
+ * len=2048:  Q1.15 -> Q12.4
+ * len=4096:  Q1.15 -> Q13.3 *
+ * @param[in]  S       points to an instance of the 16bit quantized RFFT structure
+ * @param[in]  pSrc    points to the real input buffer of size <code>fftLenReal</code>
+ * @param[in]  nPE     number of cores to use
+ * @param[out] pDst    points to the complex output buffer of size <code>fftLenReal+2</code> */
 
-void plp_mat_mult_trans_cmplx_q8p_xpulpv2(void *args);
+void plp_rfft_q16_parallel(const plp_rfft_instance_q16 *S,
+                           const int16_t *__restrict__ pSrc,
+                           uint32_t nPE,
+                           int16_t *__restrict__ pDst);
 
 /**
- * @brief      Glue code for complex magnitude calculation in float32
- *
- * @param[in]  pSrc        pointer to source
- * @param      pRes        pointer to result
- * @param[in]  numSamples  The number samples
- */
+ * @brief      Quantized 16 bit fast fourier transform on real input data for RV32IM
+ * @param[in]  S       points to an instance of the 16bit quantized RFFT structure
+ * @param[in]  pSrc    points to the real input buffer of size <code>fftLenReal</code>
+ * @param[out] pDst    points to the complex output buffer of size <code>fftLenReal+2</code> */
 
-void plp_cmplx_mag_f32(const float32_t *pSrc,
-                       float32_t *pRes,
-                       uint32_t numSamples);
+void plp_rfft_q16s_rv32im(const plp_rfft_instance_q16 *S,
+                          const int16_t *__restrict__ pSrc,
+                          int16_t *__restrict__ pDst);
 
 /**
- * @brief      complex magnitude for float32 on XPULPV2
- *
- * @param[in]  pSrc        pointer to source
- * @param      pRes        pointer to result
- * @param[in]  numSamples  The number samples
- */
+ * @brief      Quantized 16 bit fast fourier transform on real input data for XPULPV2
+ * @param[in]  S       points to an instance of the 16bit quantized RFFT structure
+ * @param[in]  pSrc    points to the real input buffer of size <code>fftLenReal</code>
+ * @param[out] pDst    points to the complex output buffer of size <code>fftLenReal+2</code> */
 
-void plp_cmplx_mag_f32s_xpulpv2(const float32_t *pSrc,
-                                float32_t *pRes,
-                                uint32_t numSamples);
+void plp_rfft_q16s_xpulpv2(const plp_rfft_instance_q16 *S,
+                           const int16_t *__restrict__ pSrc,
+                           int16_t *__restrict__ pDst);
 
 /**
- * @brief      Glue code for complex magnitude calculation for 32 bit fixpoint
- *
- * @param[in]  pSrc        pointer to source
- * @param[in]  fracBits    fractional bits -> Q(32-fracBits).fracBits
- * @param      pRes        pointer to result
- * @param[in]  numSamples  The number samples
+ * @brief      Parallel quantized 16 bit fast fourier transform on real input data for XPULPV2
+ * @param[in]   args    points to the plp_rfft_instance_q16_parallel
  */
 
-void plp_cmplx_mag_q32(const int32_t *pSrc,
-                       const uint32_t fracBits,
-                       int32_t *pRes,
-                       uint32_t numSamples);
+void plp_rfft_q16p_xpulpv2(void *args);
 
 /**
- * @brief      complex magnitude for q32 on RV32IM
+ * @brief      Glue code for quantized 32 bit fast fourier transform on real input data
  *
- * @param[in]  pSrc        pointer to source
- * @param[in]  fracBits    fractional bits -> Q(32-fracBits).fracBits
- * @param      pRes        pointer to result
- * @param[in]  numSamples  The number samples
- */
+ * The real input of length N is processed as a complex sequence of length N/2, transformed with
+ * the complex FFT and split into the spectrum of the real sequence. Only the first N/2+1 complex
+ * values are computed, the others follow from the conjugate symmetry of the spectrum.
+ *
+ * Fixed point units input -> output dependent on length:
+ * len=32:    Q1.31 -> Q6.26
+ * len=64:    Q1.31 -> Q7.25
+ * len=128:   Q1.31 -> Q8.24
+ * len=256:   Q1.31 -> Q9.23
+ * len=512:   Q1.31 -> Q10.22
+ * len=1024:  Q1.31 -> Q11.21
+ * len=2048:  Q1.31 -> Q12.20
+ * len=4096:  Q1.31 -> Q13.19 *
+ * @param[in]  S       points to an instance of the 32bit quantized RFFT structure
+ * @param[in]  pSrc    points to the real input buffer of size <code>fftLenReal</code>
+ * @param[out] pDst    points to the complex output buffer of size <code>fftLenReal+2</code> */
 
-void plp_cmplx_mag_q32s_rv32im(const int32_t *pSrc,
-                               const uint32_t fracBits,
-                               int32_t *pRes,
-                               uint32_t numSamples);
+void plp_rfft_q32(const plp_rfft_instance_q32 *S,
+                  const int32_t *__restrict__ pSrc,
+                  int32_t *__restrict__ pDst);
 
 /**
- * @brief      complex magnitude for q32 on XPULPV2
- *
- * @param[in]  pSrc        pointer to source
- * @param[in]  fracBits    fractional bits -> Q(32-fracBits).fracBits
- * @param      pRes        pointer to result
- * @param[in]  numSamples  The number samples
- */
+ * @brief      Quantized 32 bit fast fourier transform on real input data for RV32IM
+ * @param[in]  S       points to an instance of the 32bit quantized RFFT structure
+ * @param[in]  pSrc    points to the real input buffer of size <code>fftLenReal</code>
+ * @param[out] pDst    points to the complex output buffer of size <code>fftLenReal+2</code> */
 
-void plp_cmplx_mag_q32s_xpulpv2(const int32_t *pSrc,
-                                const uint32_t fracBits,
-                                int32_t *pRes,
-                                uint32_t numSamples);
+void plp_rfft_q32s_rv32im(const plp_rfft_instance_q32 *S,
+                          const int32_t *__restrict__ pSrc,
+                          int32_t *__restrict__ pDst);
 
 /**
- * @brief      Glue code for complex magnitude calculation for 8 bit fixpoint
- *
- * @param[in]  pSrc        pointer to source
- * @param[in]  fracBits    fractional bits -> Q(8-fracBits).fracBits
- * @param      pRes        pointer to result
- * @param[in]  numSamples  The number samples
- */
+ * @brief      Quantized 32 bit fast fourier transform on real input data for XPULPV2
+ * @param[in]  S       points to an instance of the 32bit quantized RFFT structure
+ * @param[in]  pSrc    points to the real input buffer of size <code>fftLenReal</code>
+ * @param[out] pDst    points to the complex output buffer of size <code>fftLenReal+2</code> */
 
-void plp_cmplx_mag_q8(const int8_t *pSrc,
-                       const uint32_t fracBits,
-                       int8_t *pRes,
-                       uint32_t numSamples);
+void plp_rfft_q32s_xpulpv2(const plp_rfft_instance_q32 *S,
+                           const int32_t *__restrict__ pSrc,
+                           int32_t *__restrict__ pDst);
 
 /**
- * @brief      complex magnitude for q8 on RV32IM
- *
- * @param[in]  pSrc        pointer to source
- * @param[in]  fracBits    fractional bits -> Q(8-fracBits).fracBits
- * @param      pRes        pointer to result
- * @param[in]  numSamples  The number samples
- */
+   @brief Floating-point FFT on real input data.
+   @param[in]   S       points to an instance of the floating-point FFT structure
+   @param[in]   pSrc    points to the input buffer (real data)
+   @param[out]  pDst    points to the output buffer (complex data)
+   @return      none
+*/
+void plp_rfft_f32(const plp_fft_instance_f32 *S,
+                  const float32_t *__restrict__ pSrc,
+                  float32_t *__restrict__ pDst);
 
-void plp_cmplx_mag_q8s_rv32im(const int8_t *pSrc,
-                               const uint32_t fracBits,
-                               int8_t *pRes,
-                               uint32_t numSamples);
+/**
+   @brief Floating-point FFT on real input data (parallel version).
+   @param[in]   S       points to an instance of the floating-point FFT structure
+   @param[in]   pSrc    points to the input buffer (real data)
+   @param[in]   nPE     number of parallel processing units
+   @param[out]  pDst    points to the output buffer (complex data)
+   @return      none
+*/
+void plp_rfft_f32_parallel(const plp_fft_instance_f32 *S,
+                           const float32_t *__restrict__ pSrc,
+                           const uint32_t nPE,
+                           float32_t *__restrict__ pDst);
 
 /**
- * @brief      complex magnitude for q8 on XPULPV2
- *
- * @param[in]  pSrc        pointer to source
- * @param[in]  fracBits    fractional bits -> Q(8-fracBits).fracBits
- * @param      pRes        pointer to result
- * @param[in]  numSamples  The number samples
- */
+   @brief  Floating-point FFT on real input data for XPULPV2 extension.
+   @param[in]   S       points to an instance of the floating-point FFT structure
+   @param[in]   pSrcA   points to the input buffer (real data)
+   @param[out]  pDst    points to the output buffer (complex data)
+   @return      none
+*/
+void plp_rfft_f32_xpulpv2(const plp_fft_instance_f32 *S,
+                          const float32_t *__restrict__ pSrc,
+                          float32_t *__restrict__ pDst);
 
-void plp_cmplx_mag_q8s_xpulpv2(const int8_t *pSrc,
-                                const uint32_t fracBits,
-                                int8_t *pRes,
-                                uint32_t numSamples);
+/**
+   @brief  Floating-point FFT on real input data for XPULPV2 extension (parallel version).
+   @param[in]   arg       points to an instance of the floating-point FFT structure
+   @return      none
+*/
+void plp_rfft_f32_xpulpv2_parallel(plp_fft_instance_f32_parallel *arg);
 
 /**
- * @brief      Glue code for complex magnitude calculation in 16-bit integer
- *
- * @param[in]  pSrc        pointer to source
- * @param      pRes        pointer to result
- * @param[in]  numSamples  The number samples
- */
+   @brief Floating-point inverse FFT to real output data.
+   @param[in]   S       points to an instance of the floating-point FFT structure
+   @param[in]   pSrc    points to the input buffer (complex data, FFTLength / 2 + 1 values)
+   @param[out]  pDst    points to the output buffer (real data)
+   @return      none
+*/
+void plp_rifft_f32(const plp_fft_instance_f32 *S,
+                   const float32_t *__restrict__ pSrc,
+                   float32_t *__restrict__ pDst);
 
-void plp_cmplx_mag_i16(const int16_t *pSrc,
-                       int16_t *pRes,
-                       uint32_t numSamples);
+/**
+   @brief Floating-point inverse FFT to real output data (parallel version).
+   @param[in]   S       points to an instance of the floating-point FFT structure
+   @param[in]   pSrc    points to the input buffer (complex data, FFTLength / 2 + 1 values)
+   @param[in]   nPE     number of parallel processing units
+   @param[out]  pDst    points to the output buffer (real data)
+   @return      none
+*/
+void plp_rifft_f32_parallel(const plp_fft_instance_f32 *S,
+                            const float32_t *__restrict__ pSrc,
+                            const uint32_t nPE,
+                            float32_t *__restrict__ pDst);
 
 /**
- * @brief      complex magnitude for i16 on RV32IM
- *
- * @param[in]  pSrc        pointer to source
- * @param      pRes        pointer to result
- * @param[in]  numSamples  The number samples
- */
+   @brief  Floating-point inverse FFT to real output data for XPULPV2 extension.
+   @param[in]   S       points to an instance of the floating-point FFT structure
+   @param[in]   pSrc    points to the input buffer (complex data, FFTLength / 2 + 1 values)
+   @param[out]  pDst    points to the output buffer (real data)
+   @return      none
+*/
+void plp_rifft_f32_xpulpv2(const plp_fft_instance_f32 *S,
+                           const float32_t *__restrict__ pSrc,
+                           float32_t *__restrict__ pDst);
 
-void plp_cmplx_mag_i16s_rv32im(const int16_t *pSrc,
-                               int16_t *pRes,
-                               uint32_t numSamples);
+/**
+   @brief  Floating-point inverse FFT to real output data for XPULPV2 extension (parallel version).
+   @param[in]   args      points to the plp_fft_instance_f32_parallel
+   @return      none
+*/
+void plp_rifft_f32_xpulpv2_parallel(void *args);
 
 /**
- * @brief      complex magnitude for i16 on XPULPV2
- *
- * @param[in]  pSrc        pointer to source
- * @param      pRes        pointer to result
- * @param[in]  numSamples  The number samples
- */
+   @brief         Floating-point overlap-add synthesis.
+   @param[in]     pSrc      points to the frame of length frameLen
+   @param[in]     pWindow   points to the synthesis window of length frameLen, or NULL
+   @param[in]     frameLen  length of the frame
+   @param[in]     hopLen    number of samples between two frames, at most frameLen
+   @param[in,out] pBuf      points to the overlap buffer of length frameLen
+   @param[out]    pDst      points to the output buffer of length hopLen
+   @return        none
+*/
+void plp_overlap_add_f32(const float32_t *__restrict__ pSrc,
+                         const float32_t *__restrict__ pWindow,
+                         uint32_t frameLen,
+                         uint32_t hopLen,
+                         float32_t *__restrict__ pBuf,
+                         float32_t *__restrict__ pDst);
 
-void plp_cmplx_mag_i16s_xpulpv2(const int16_t *pSrc,
-                                int16_t *pRes,
-                                uint32_t numSamples);
+/**
+   @brief         Floating-point overlap-add synthesis for XPULPV2 extension.
+   @param[in]     pSrc      points to the frame of length frameLen
+   @param[in]     pWindow   points to the synthesis window of length frameLen, or NULL
+   @param[in]     frameLen  length of the frame
+   @param[in]     hopLen    number of samples between two frames, at most frameLen
+   @param[in,out] pBuf      points to the overlap buffer of length frameLen
+   @param[out]    pDst      points to the output buffer of length hopLen
+   @return        none
+*/
+void plp_overlap_add_f32_xpulpv2(const float32_t *__restrict__ pSrc,
+                                 const float32_t *__restrict__ pWindow,
+                                 uint32_t frameLen,
+                                 uint32_t hopLen,
+                                 float32_t *__restrict__ pBuf,
+                                 float32_t *__restrict__ pDst);
 
 /**
- * @brief      Glue code for complex magnitude calculation in 32-bit integer
- *
- * @param[in]  pSrc        pointer to source
- * @param      pRes        pointer to result
- * @param[in]  numSamples  The number samples
- */
+   @brief         Initializes the instance of the floating-point short-time Fourier transform and
+                  generates its analysis window.
+   @param[out]    S            points to the STFT instance
+   @param[in]     SFFT         points to the floating-point FFT instance (frame length), e.g.
+                               plp_rfft_sR_f32_len512
+   @param[in]     windowType   analysis window (plp_window_type)
+   @param[out]    pWindow      points to the buffer of FFTLength floats for the window
+   @param[in]     hopLen       number of samples between two frames, at least 1
+   @param[in]     outType      output of each frequency bin (plp_stft_output)
+   @param[in]     frameStride  distance between two frames in the output, in output values
+   @param[in]     binStride    distance between two frequency bins in the output, in output values
+   @return        none
+*/
+void plp_stft_init_f32(plp_stft_instance_f32 *S,
+                       const plp_fft_instance_f32 *SFFT,
+                       plp_window_type windowType,
+                       float32_t *pWindow,
+                       uint32_t hopLen,
+                       plp_stft_output outType,
+                       uint32_t frameStride,
+                       uint32_t binStride);
 
-void plp_cmplx_mag_i32(const int32_t *pSrc,
-                       int32_t *pRes,
-                       uint32_t numSamples);
+/**
+   @brief         Floating-point short-time Fourier transform of a buffer, the frames are
+                  distributed over the cores.
+   @param[in]     S       points to the STFT instance
+   @param[in]     pSrc    points to the input samples
+   @param[in]     srcLen  number of input samples
+   @param[in]     pBuf    points to the temporary buffer of 3*FFTLength*nPE floats
+   @param[in]     nPE     number of cores
+   @param[out]    pDst    points to the output buffer
+   @return        number of frames, the next chunk of a stream starts at pSrc + frames * hopLen
+*/
+uint32_t plp_stft_f32(const plp_stft_instance_f32 *S,
+                      const float32_t *__restrict__ pSrc,
+                      uint32_t srcLen,
+                      float32_t *__restrict__ pBuf,
+                      uint32_t nPE,
+                      float32_t *__restrict__ pDst);
 
 /**
- * @brief      complex magnitude for i32 on RV32IM
- *
- * @param[in]  pSrc        pointer to source
- * @param      pRes        pointer to result
- * @param[in]  numSamples  The number samples
- */
+   @brief      Floating-point short-time Fourier transform for XPULPV2 extension, the frames are
+               distributed over the cores.
+   @param[in]  args  points to the plp_stft_instance_f32_parallel
+   @return     none
+*/
+void plp_stft_f32p_xpulpv2(void *args);
 
-void plp_cmplx_mag_i32s_rv32im(const int32_t *pSrc,
-                               int32_t *pRes,
-                               uint32_t numSamples);
+/**
+   @brief         Initializes the instance of the floating-point Goertzel algorithm and
+                  computes the coefficients of the frequencies.
+   @param[out]    S        points to the Goertzel instance
+   @param[in]     pFreqs   points to the frequencies in cycles per sample, in [0, 1)
+   @param[in]     nBins    number of frequencies
+   @param[out]    pCoeffs  points to the buffer of 2*nBins coefficients
+   @return        none
+*/
+void plp_goertzel_init_f32(plp_goertzel_instance_f32 *S,
+                           const float32_t *pFreqs,
+                           uint32_t nBins,
+                           float32_t *pCoeffs);
 
 /**
- * @brief      complex magnitude for i32 on XPULPV2
- *
- * @param[in]  pSrc        pointer to source
- * @param      pRes        pointer to result
- * @param[in]  numSamples  The number samples
- */
+   @brief      Glue code for the floating-point Goertzel algorithm.
+   @param[in]  S          points to the Goertzel instance
+   @param[in]  pSrc       points to the block of input samples
+   @param[in]  blockSize  number of samples
+   @param[out] pDst       points to the output, real and imaginary part of every bin
+   @return     none
+*/
+void plp_goertzel_f32(const plp_goertzel_instance_f32 *S,
+                      const float32_t *__restrict__ pSrc,
+                      uint32_t blockSize,
+                      float32_t *__restrict__ pDst);
 
-void plp_cmplx_mag_i32s_xpulpv2(const int32_t *pSrc,
-                                int32_t *pRes,
-                                uint32_t numSamples);
+/**
+   @brief      Glue code for the parallel floating-point Goertzel algorithm.
+   @param[in]  S          points to the Goertzel instance
+   @param[in]  pSrc       points to the block of input samples
+   @param[in]  blockSize  number of samples
+   @param[in]  nPE        Number of cores to use
+   @param[out] pDst       points to the output, real and imaginary part of every bin
+   @return     none
+*/
+void plp_goertzel_f32_parallel(const plp_goertzel_instance_f32 *S,
+                               const float32_t *__restrict__ pSrc,
+                               uint32_t blockSize,
+                               uint32_t nPE,
+                               float32_t *__restrict__ pDst);
 
 /**
- * @brief      Glue code for complex magnitude calculation in 8-bit integer
- *
- * @param[in]  pSrc        pointer to source
- * @param      pRes        pointer to result
- * @param[in]  numSamples  The number samples
- */
+   @brief      Floating-point Goertzel algorithm for XPULPV2 extension.
+   @param[in]  S          points to the Goertzel instance
+   @param[in]  pSrc       points to the block of input samples
+   @param[in]  blockSize  number of samples
+   @param[out] pDst       points to the output, real and imaginary part of every bin
+   @return     none
+*/
+void plp_goertzel_f32s_xpulpv2(const plp_goertzel_instance_f32 *S,
+                               const float32_t *__restrict__ pSrc,
+                               uint32_t blockSize,
+                               float32_t *__restrict__ pDst);
 
-void plp_cmplx_mag_i8(const int8_t *pSrc,
-                      int8_t *pRes,
-                      uint32_t numSamples);
+/**
+   @brief      Parallel floating-point Goertzel algorithm for XPULPV2 extension, the bins are
+               distributed among the cores.
+   @param[in]  args  points to the plp_goertzel_instance_parallel
+   @return     none
+*/
+void plp_goertzel_f32p_xpulpv2(void *args);
 
 /**
- * @brief      complex magnitude for i8 on RV32IM
- *
- * @param[in]  pSrc        pointer to source
- * @param      pRes        pointer to result
- * @param[in]  numSamples  The number samples
- */
+   @brief         Initializes the instance of the 16-bit fix-point Goertzel algorithm and
+                  computes the coefficients of the frequencies.
+   @param[out]    S        points to the Goertzel instance
+   @param[in]     pFreqs   points to the frequencies in cycles per sample, in [0, 1) (Q1.15)
+   @param[in]     nBins    number of frequencies
+   @param[out]    pCoeffs  points to the buffer of 2*nBins coefficients (Q2.30)
+   @return        none
+*/
+void plp_goertzel_init_q16(plp_goertzel_instance_q16 *S,
+                           const int16_t *pFreqs,
+                           uint32_t nBins,
+                           int32_t *pCoeffs);
 
-void plp_cmplx_mag_i8s_rv32im(const int8_t *pSrc,
-                              int8_t *pRes,
-                              uint32_t numSamples);
+/**
+   @brief      Glue code for the 16-bit fix-point Goertzel algorithm.
+   @param[in]  S          points to the Goertzel instance
+   @param[in]  pSrc       points to the block of input samples
+   @param[in]  blockSize  number of samples
+   @param[in]  shift      Amount to shift the samples to the right
+   @param[out] pDst       points to the output, real and imaginary part of every bin
+   @return     none
+*/
+void plp_goertzel_q16(const plp_goertzel_instance_q16 *S,
+                      const int16_t *__restrict__ pSrc,
+                      uint32_t blockSize,
+                      uint32_t shift,
+                      int32_t *__restrict__ pDst);
 
 /**
- * @brief      complex magnitude for i8 on XPULPV2
- *
- * @param[in]  pSrc        pointer to source
- * @param      pRes        pointer to result
- * @param[in]  numSamples  The number samples
- */
+   @brief      Glue code for the parallel 16-bit fix-point Goertzel algorithm.
+   @param[in]  S          points to the Goertzel instance
+   @param[in]  pSrc       points to the block of input samples
+   @param[in]  blockSize  number of samples
+   @param[in]  shift      Amount to shift the samples to the right
+   @param[in]  nPE        Number of cores to use
+   @param[out] pDst       points to the output, real and imaginary part of every bin
+   @return     none
+*/
+void plp_goertzel_q16_parallel(const plp_goertzel_instance_q16 *S,
+                               const int16_t *__restrict__ pSrc,
+                               uint32_t blockSize,
+                               uint32_t shift,
+                               uint32_t nPE,
+                               int32_t *__restrict__ pDst);
 
-void plp_cmplx_mag_i8s_xpulpv2(const int8_t *pSrc,
-                               int8_t *pRes,
-                               uint32_t numSamples);
+/**
+   @brief      16-bit fix-point Goertzel algorithm for RV32IM extension.
+   @param[in]  S          points to the Goertzel instance
+   @param[in]  pSrc       points to the block of input samples
+   @param[in]  blockSize  number of samples
+   @param[in]  shift      Amount to shift the samples to the right
+   @param[out] pDst       points to the output, real and imaginary part of every bin
+   @return     none
+*/
+void plp_goertzel_q16s_rv32im(const plp_goertzel_instance_q16 *S,
+                              const int16_t *__restrict__ pSrc,
+                              uint32_t blockSize,
+                              uint32_t shift,
+                              int32_t *__restrict__ pDst);
 
 /**
- * @brief      Glue code for complex magnitude calculation in 16-bit quantized integer
- *
- * @param[in]  pSrc        pointer to source
- * @param[in]  fracBits    fractional bits -> Q(32-fracBits).fracBits
- * @param      pRes        pointer to result
- * @param[in]  numSamples  The number of samples
- */
+   @brief      16-bit fix-point Goertzel algorithm for XPULPV2 extension.
+   @param[in]  S          points to the Goertzel instance
+   @param[in]  pSrc       points to the block of input samples
+   @param[in]  blockSize  number of samples
+   @param[in]  shift      Amount to shift the samples to the right
+   @param[out] pDst       points to the output, real and imaginary part of every bin
+   @return     none
+*/
+void plp_goertzel_q16s_xpulpv2(const plp_goertzel_instance_q16 *S,
+                               const int16_t *__restrict__ pSrc,
+                               uint32_t blockSize,
+                               uint32_t shift,
+                               int32_t *__restrict__ pDst);
 
-void plp_cmplx_mag_q16(const int16_t *pSrc,
-                       const uint32_t fracBits,
-                       int16_t *pRes,
-                       uint32_t numSamples);
+/**
+   @brief      Parallel 16-bit fix-point Goertzel algorithm for XPULPV2 extension, the bins are
+               distributed among the cores.
+   @param[in]  args  points to the plp_goertzel_instance_parallel
+   @return     none
+*/
+void plp_goertzel_q16p_xpulpv2(void *args);
 
 /**
- * @brief      complex magnitude for q16 on RV32IM
- *
- * @param[in]  pSrc        pointer to source
- * @param[in]  fracBits    fractional bits -> Q(32-fracBits).fracBits
- * @param      pRes        pointer to result
- * @param[in]  numSamples  The number of samples
- */
+   @brief         Initializes the instance of the 32-bit fix-point Goertzel algorithm and
+                  computes the coefficients of the frequencies.
+   @param[out]    S        points to the Goertzel instance
+   @param[in]     pFreqs   points to the frequencies in cycles per sample, in [0, 1) (Q1.31)
+   @param[in]     nBins    number of frequencies
+   @param[out]    pCoeffs  points to the buffer of 2*nBins coefficients (Q2.30)
+   @return        none
+*/
+void plp_goertzel_init_q32(plp_goertzel_instance_q32 *S,
+                           const int32_t *pFreqs,
+                           uint32_t nBins,
+                           int32_t *pCoeffs);
 
-void plp_cmplx_mag_q16s_rv32im(const int16_t *pSrc,
-                               const uint32_t fracBits,
-                               int16_t *pRes,
-                               uint32_t numSamples);
+/**
+   @brief      Glue code for the 32-bit fix-point Goertzel algorithm.
+   @param[in]  S          points to the Goertzel instance
+   @param[in]  pSrc       points to the block of input samples
+   @param[in]  blockSize  number of samples
+   @param[in]  shift      Amount to shift the samples to the right
+   @param[out] pDst       points to the output, real and imaginary part of every bin
+   @return     none
+*/
+void plp_goertzel_q32(const plp_goertzel_instance_q32 *S,
+                      const int32_t *__restrict__ pSrc,
+                      uint32_t blockSize,
+                      uint32_t shift,
+                      int32_t *__restrict__ pDst);
 
 /**
- * @brief      complex magnitude for q16 on XPULPV2
- *
- * @param[in]  pSrc        pointer to source
- * @param[in]  fracBits    fractional bits -> Q(32-fracBits).fracBits
- * @param      pRes        pointer to result
- * @param[in]  numSamples  The number of samples
- */
+   @brief      Glue code for the parallel 32-bit fix-point Goertzel algorithm.
+   @param[in]  S          points to the Goertzel instance
+   @param[in]  pSrc       points to the block of input samples
+   @param[in]  blockSize  number of samples
+   @param[in]  shift      Amount to shift the samples to the right
+   @param[in]  nPE        Number of cores to use
+   @param[out] pDst       points to the output, real and imaginary part of every bin
+   @return     none
+*/
+void plp_goertzel_q32_parallel(const plp_goertzel_instance_q32 *S,
+                               const int32_t *__restrict__ pSrc,
+                               uint32_t blockSize,
+                               uint32_t shift,
+                               uint32_t nPE,
+                               int32_t *__restrict__ pDst);
 
-void plp_cmplx_mag_q16s_xpulpv2(const int16_t *pSrc,
-                                const uint32_t fracBits,
-                                int16_t *pRes,
-                                uint32_t numSamples);
+/**
+   @brief      32-bit fix-point Goertzel algorithm for RV32IM extension.
+   @param[in]  S          points to the Goertzel instance
+   @param[in]  pSrc       points to the block of input samples
+   @param[in]  blockSize  number of samples
+   @param[in]  shift      Amount to shift the samples to the right
+   @param[out] pDst       points to the output, real and imaginary part of every bin
+   @return     none
+*/
+void plp_goertzel_q32s_rv32im(const plp_goertzel_instance_q32 *S,
+                              const int32_t *__restrict__ pSrc,
+                              uint32_t blockSize,
+                              uint32_t shift,
+                              int32_t *__restrict__ pDst);
 
 /**
-  @brief      In-place 16 bit reversal function for RV32IM
-  @param[in,out] pSrc        points to in-place buffer of unknown 16-bit data type
-  @param[in]  bitRevLen   bit reversal table length
-  @param[in]  pBitRevTab  points to bit reversal table
-  @return     none
+   @brief      32-bit fix-point Goertzel algorithm for XPULPV2 extension.
+   @param[in]  S          points to the Goertzel instance
+   @param[in]  pSrc       points to the block of input samples
+   @param[in]  blockSize  number of samples
+   @param[in]  shift      Amount to shift the samples to the right
+   @param[out] pDst       points to the output, real and imaginary part of every bin
+   @return     none
 */
+void plp_goertzel_q32s_xpulpv2(const plp_goertzel_instance_q32 *S,
+                               const int32_t *__restrict__ pSrc,
+                               uint32_t blockSize,
+                               uint32_t shift,
+                               int32_t *__restrict__ pDst);
 
-void plp_bitreversal_16s_rv32im(uint16_t *pSrc,
-                                const uint16_t bitRevLen,
-                                const uint16_t *pBitRevTab);
+/**
+   @brief      Parallel 32-bit fix-point Goertzel algorithm for XPULPV2 extension, the bins are
+               distributed among the cores.
+   @param[in]  args  points to the plp_goertzel_instance_parallel
+   @return     none
+*/
+void plp_goertzel_q32p_xpulpv2(void *args);
 
 /**
-  @brief      In-place 16 bit reversal function for XPULPV2
-  @param[in,out] pSrc        points to in-place buffer of unknown 16-bit data type
-  @param[in]  bitRevLen   bit reversal table length
-  @param[in]  pBitRevTab  points to bit reversal table
-  @return     none
+   @brief         Initializes the instance of the floating-point sliding DFT, computes the
+                  twiddle factors and clears the window and the state of the bins.
+   @param[out]    S          points to the sliding DFT instance
+   @param[in]     N          length of the window
+   @param[in]     pBins      points to the indices of the bins, in [0, N)
+   @param[in]     nBins      number of bins
+   @param[out]    pTwiddles  points to the buffer of 2*N twiddle factors
+   @param[out]    pWindow    points to the buffer of N samples
+   @param[out]    pState     points to the buffer of 2*nBins state variables
+   @return        none
 */
+void plp_sdft_init_f32(plp_sdft_instance_f32 *S,
+                       uint32_t N,
+                       const uint32_t *pBins,
+                       uint32_t nBins,
+                       float32_t *pTwiddles,
+                       float32_t *pWindow,
+                       float32_t *pState);
 
-void plp_bitreversal_16s_xpulpv2(uint16_t *pSrc,
-                                 const uint16_t bitRevLen,
-                                 const uint16_t *pBitRevTab);
+/**
+   @brief         Glue code for the floating-point sliding DFT.
+   @param[in,out] S          points to the sliding DFT instance
+   @param[in]     pSrc       points to the block of input samples
+   @param[in]     blockSize  number of samples
+   @param[out]    pDst       points to the output, real and imaginary part of every bin, or NULL
+   @return        none
+*/
+void plp_sdft_f32(plp_sdft_instance_f32 *S,
+                  const float32_t *__restrict__ pSrc,
+                  uint32_t blockSize,
+                  float32_t *__restrict__ pDst);
 
 /**
-  @brief         In-place 16 bit reversal function.
-  @param[in,out] pSrc        points to in-place buffer of unknown 16-bit data type
-  @param[in]     bitRevLen   bit reversal table length
-  @param[in]     pBitRevTab  points to bit reversal table
-  @param[in]     nPE         number of cores
-  @return        none
+   @brief         Floating-point sliding DFT for XPULPV2 extension.
+   @param[in,out] S          points to the sliding DFT instance
+   @param[in]     pSrc       points to the block of input samples
+   @param[in]     blockSize  number of samples
+   @param[out]    pDst       points to the output, real and imaginary part of every bin, or NULL
+   @return        none
 */
+void plp_sdft_f32s_xpulpv2(plp_sdft_instance_f32 *S,
+                           const float32_t *__restrict__ pSrc,
+                           uint32_t blockSize,
+                           float32_t *__restrict__ pDst);
 
-void plp_bitreversal_16p_xpulpv2(uint16_t *pSrc,
-                                 const uint16_t bitRevLen,
-                                 const uint16_t *pBitRevTab,
-                                 uint32_t nPE);
+/**
+   @brief         Initializes the instance of the 16-bit fix-point sliding DFT, computes the
+                  twiddle factors and clears the window and the state of the bins.
+   @param[out]    S          points to the sliding DFT instance
+   @param[in]     N          length of the window
+   @param[in]     pBins      points to the indices of the bins, in [0, N)
+   @param[in]     nBins      number of bins
+   @param[out]    pTwiddles  points to the buffer of 2*N twiddle factors in Q1.15 format
+   @param[out]    pWindow    points to the buffer of N samples
+   @param[out]    pState     points to the buffer of 2*nBins state variables
+   @return        none
+*/
+void plp_sdft_init_q16(plp_sdft_instance_q16 *S,
+                       uint32_t N,
+                       const uint32_t *pBins,
+                       uint32_t nBins,
+                       int16_t *pTwiddles,
+                       int16_t *pWindow,
+                       int64_t *pState);
 
 /**
- * @brief      Glue code for quantized 16 bit complex fast fourier transform
- *
- * Fixed point units input -> output dependent on length:
- * len=16:    Q1.15 -> Q5.11
- * len=32:    Q1.15 -> Q6.10
- * len=64:    Q1.15 -> Q7.9
- * len=128:   Q1.15 -> Q8.8
- * len=256:   Q1.15 -> Q9.7
- * len=512:   Q1.15 -> Q10.6
- * len=1024:  Q1.15 -> Q11.5
- * len=2048:  Q1.15 -> Q12.4
- * len=4096:  Q1.15 -> Q13.3
- *
- * @param[in]  S               points to an instance of the 16bit quantized CFFT structure
- * @param[in,out] p1              points to the complex data buffer of size <code>2*fftLen</code>.
- * Processing occurs in-place.
- * @param[in]  ifftFlag        flag that selects forward (ifftFlag=0) or inverse (ifftFlag=1)
- * transform.
- * @param[in]  bitReverseFlag  flag that enables (bitReverseFlag=1) of disables
- * (bitReverseFlag=0) bit reversal of output.
- * @param[in]  deciPoint       decimal point for right shift
- */
+   @brief         Glue code for the 16-bit fix-point sliding DFT.
+   @param[in,out] S          points to the sliding DFT instance
+   @param[in]     pSrc       points to the block of input samples in Q1.15 format
+   @param[in]     blockSize  number of samples
+   @param[out]    pDst       points to the output, real and imaginary part of every bin, or NULL
+   @return        none
+*/
+void plp_sdft_q16(plp_sdft_instance_q16 *S,
+                  const int16_t *__restrict__ pSrc,
+                  uint32_t blockSize,
+                  int32_t *__restrict__ pDst);
 
-void plp_cfft_q16(const plp_cfft_instance_q16 *S,
-                  int16_t *p1,
-                  uint8_t ifftFlag,
-                  uint8_t bitReverseFlag,
-                  uint32_t deciPoint);
+/**
+   @brief         16-bit fix-point sliding DFT for RV32IM extension.
+   @param[in,out] S          points to the sliding DFT instance
+   @param[in]     pSrc       points to the block of input samples in Q1.15 format
+   @param[in]     blockSize  number of samples
+   @param[out]    pDst       points to the output, real and imaginary part of every bin, or NULL
+   @return        none
+*/
+void plp_sdft_q16s_rv32im(plp_sdft_instance_q16 *S,
+                          const int16_t *__restrict__ pSrc,
+                          uint32_t blockSize,
+                          int32_t *__restrict__ pDst);
 
 /**
- * @brief      Glue code for quantized 16 bit complex fast fourier transform
- *
- * Fixed point units input -> output dependent on length:
- * len=16:    Q1.15 -> Q5.11
- * len=32:    Q1.15 -> Q6.10
- * len=64:    Q1.15 -> Q7.9
- * len=128:   Q1.15 -> Q8.8
- * len=256:   Q1.15 -> Q9.7
- * len=512:   Q1.15 -> Q10.6
- * len=1024:  Q1.15 -> Q11.5
- * len=2048:  Q1.15 -> Q12.4
- * len=4096:  Q1.15 -> Q13.3
- *
- * @param[in]  S               points to an instance of the 16bit quantized CFFT structure
- * @param[in,out] p1           points to the complex data buffer of size <code>2*fftLen</code>.
- * Processing occurs in-place.
- * @param[in]  ifftFlag        flag that selects forward (ifftFlag=0) or inverse (ifftFlag=1)
- * transform.
- * @param[in]  bitReverseFlag  flag that enables (bitReverseFlag=1) of disables
- * (bitReverseFlag=0) bit reversal of output.
- * @param[in]  deciPoint       decimal point for right shift
- * @param[in]  nPE             Number of cores to use
- */
+   @brief         16-bit fix-point sliding DFT for XPULPV2 extension.
+   @param[in,out] S          points to the sliding DFT instance
+   @param[in]     pSrc       points to the block of input samples in Q1.15 format
+   @param[in]     blockSize  number of samples
+   @param[out]    pDst       points to the output, real and imaginary part of every bin, or NULL
+   @return        none
+*/
+void plp_sdft_q16s_xpulpv2(plp_sdft_instance_q16 *S,
+                           const int16_t *__restrict__ pSrc,
+                           uint32_t blockSize,
+                           int32_t *__restrict__ pDst);
 
-void plp_cfft_q16_parallel(const plp_cfft_instance_q16 *S,
-                           int16_t *p1,
-                           uint8_t ifftFlag,
-                           uint8_t bitReverseFlag,
-                           uint32_t deciPoint,
-                           uint32_t nPE);
+/**
+   @brief         Initializes the instance of the floating-point Welch power spectral density and
+                  generates its window.
+   @param[out]    S           points to the Welch PSD instance
+   @param[in]     SFFT        points to the floating-point FFT instance (segment length), e.g.
+                              plp_rfft_sR_f32_len512
+   @param[in]     windowType  window of the segments (plp_window_type)
+   @param[out]    pWindow     points to the buffer of FFTLength floats for the window
+   @param[in]     overlap     number of samples shared by two consecutive segments, less than
+                              FFTLength
+   @return        none
+*/
+void plp_psd_welch_init_f32(plp_psd_welch_instance_f32 *S,
+                            const plp_fft_instance_f32 *SFFT,
+                            plp_window_type windowType,
+                            float32_t *pWindow,
+                            uint32_t overlap);
 
 /**
- * @brief      Quantized 16 bit complex fast fourier transform for RV32IM
- * @param[in]  S               points to an instance of the 16bit quantized CFFT structure
- * @param[in,out] p1              points to the complex data buffer of size <code>2*fftLen</code>.
- * Processing occurs in-place.
- * @param[in]  ifftFlag        flag that selects forward (ifftFlag=0) or inverse (ifftFlag=1)
- * transform.
- * @param[in]  bitReverseFlag  flag that enables (bitReverseFlag=1) of disables
- * (bitReverseFlag=0) bit reversal of output.
- * @param[in]  deciPoint       decimal point for right shift
- */
+   @brief         Floating-point Welch power spectral density of a buffer, the segments are
+                  distributed over the cores.
+   @param[in]     S       points to the Welch PSD instance
+   @param[in]     pSrc    points to the input samples
+   @param[in]     srcLen  number of input samples
+   @param[in]     pBuf    points to the temporary buffer of 4*FFTLength*nPE floats
+   @param[in]     nPE     number of cores
+   @param[out]    pDst    points to the output of FFTLength / 2 + 1 bins
+   @return        number of segments, or 0 if srcLen < FFTLength
+*/
+uint32_t plp_psd_welch_f32(const plp_psd_welch_instance_f32 *S,
+                           const float32_t *__restrict__ pSrc,
+                           uint32_t srcLen,
+                           float32_t *__restrict__ pBuf,
+                           uint32_t nPE,
+                           float32_t *__restrict__ pDst);
 
-void plp_cfft_q16s_rv32im(const plp_cfft_instance_q16 *S,
-                          int16_t *p1,
-                          uint8_t ifftFlag,
-                          uint8_t bitReverseFlag,
-                          uint32_t deciPoint);
+/**
+   @brief      Floating-point Welch power spectral density for XPULPV2 extension, the segments are
+               distributed over the cores.
+   @param[in]  args  points to the plp_psd_welch_instance_f32_parallel
+   @return     none
+*/
+void plp_psd_welch_f32p_xpulpv2(void *args);
 
 /**
- * @brief      Quantized 16 bit complex fast fourier transform for XPULPV2
- * @param[in]  S               points to an instance of the 16bit quantized CFFT structure
- * @param[in,out] p1              points to the complex data buffer of size <code>2*fftLen</code>.
- * Processing occurs in-place.
- * @param[in]  ifftFlag        flag that selects forward (ifftFlag=0) or inverse (ifftFlag=1)
- * transform.
- * @param[in]  bitReverseFlag  flag that enables (bitReverseFlag=1) of disables
- * (bitReverseFlag=0) bit reversal of output.
- * @param[in]  deciPoint       decimal point for right shift
- */
+   @brief         Initializes the instance of the 16-bit fix-point Welch power spectral density
+                  and generates its window.
+   @param[out]    S           points to the Welch PSD instance
+   @param[in]     SFFT        points to the 16-bit RFFT instance (segment length)
+   @param[in]     windowType  window of the segments (plp_window_type)
+   @param[out]    pWindow     points to the buffer of fftLenReal values for the window in Q1.15
+   @param[in]     overlap     number of samples shared by two consecutive segments, less than
+                              fftLenReal
+   @return        none
+*/
+void plp_psd_welch_init_q16(plp_psd_welch_instance_q16 *S,
+                            const plp_rfft_instance_q16 *SFFT,
+                            plp_window_type windowType,
+                            int16_t *pWindow,
+                            uint32_t overlap);
 
-void plp_cfft_q16s_xpulpv2(const plp_cfft_instance_q16 *S,
-                           int16_t *p1,
-                           uint8_t ifftFlag,
-                           uint8_t bitReverseFlag,
-                           uint32_t deciPoint);
+/**
+   @brief         16-bit fix-point Welch power spectral density of a buffer. On the cluster, the
+                  segments are distributed over the cores.
+   @param[in]     S       points to the Welch PSD instance
+   @param[in]     pSrc    points to the input samples in Q1.15
+   @param[in]     srcLen  number of input samples
+   @param[in]     pBuf    points to the temporary buffer of (4*fftLenReal+8)*nPE values, aligned
+                          to 8 bytes
+   @param[in]     nPE     number of cores, ignored on the fabric controller
+   @param[out]    pDst    points to the output of fftLenReal / 2 + 1 bins in Q17.15
+   @return        number of segments, or 0 if srcLen < fftLenReal
+*/
+uint32_t plp_psd_welch_q16(const plp_psd_welch_instance_q16 *S,
+                           const int16_t *__restrict__ pSrc,
+                           uint32_t srcLen,
+                           int16_t *__restrict__ pBuf,
+                           uint32_t nPE,
+                           int32_t *__restrict__ pDst);
 
 /**
- * @brief      Parallel quantized 16 bit complex fast fourier transform for XPULPV2
- * @param[in]   args    points to the plp_cfft_instance_q16_parallel
- */
+   @brief      16-bit fix-point Welch power spectral density for RV32IM extension.
+   @param[in]  S          points to the Welch PSD instance
+   @param[in]  pSrc       points to the first sample of the first segment
+   @param[in]  nSegments  number of segments, at least 1
+   @param[in]  pBuf       points to the temporary buffer of 4*fftLenReal+8 values, aligned to 8
+                          bytes
+   @param[out] pDst       points to the output of fftLenReal / 2 + 1 bins in Q17.15
+   @return     none
+*/
+void plp_psd_welch_q16s_rv32im(const plp_psd_welch_instance_q16 *S,
+                               const int16_t *__restrict__ pSrc,
+                               uint32_t nSegments,
+                               int16_t *__restrict__ pBuf,
+                               int32_t *__restrict__ pDst);
 
-void plp_cfft_q16p_xpulpv2(void *args);
+/**
+   @brief      16-bit fix-point Welch power spectral density for XPULPV2 extension, the segments
+               are distributed over the cores.
+   @param[in]  args  points to the plp_psd_welch_instance_q16_parallel
+   @return     none
+*/
+void plp_psd_welch_q16p_xpulpv2(void *args);
 
 /**
-  @brief      In-place 32 bit reversal function for RV32IM
-  @param[in,out] pSrc        points to in-place buffer of unknown 32-bit data type
-  @param[in]  bitRevLen   bit reversal table length
-  @param[in]  pBitRevTab  points to bit reversal table
-  @return     none
+   @brief         Glue code for the floating-point analytic signal of a block.
+   @param[in]     S     points to the floating-point FFT instance of length N, e.g.
+                        plp_rfft_sR_f32_len512
+   @param[in]     pSrc  points to the block of N real samples
+   @param[in]     pBuf  points to the temporary buffer of 2*N floats
+   @param[out]    pDst  points to the analytic signal, N complex values
+   @return        none
 */
+void plp_hilbert_f32(const plp_fft_instance_f32 *S,
+                     const float32_t *__restrict__ pSrc,
+                     float32_t *__restrict__ pBuf,
+                     float32_t *__restrict__ pDst);
 
-void
-plp_bitreversal_32s_rv32im(uint32_t *pSrc, const uint16_t bitRevLen, const uint16_t *pBitRevTab);
+/**
+   @brief         Glue code for the floating-point envelope of a block, the magnitude of its
+                  analytic signal.
+   @param[in]     S     points to the floating-point FFT instance of length N, e.g.
+                        plp_rfft_sR_f32_len512
+   @param[in]     pSrc  points to the block of N real samples
+   @param[in]     pBuf  points to the temporary buffer of 2*N floats
+   @param[out]    pDst  points to the envelope of N values
+   @return        none
+*/
+void plp_envelope_f32(const plp_fft_instance_f32 *S,
+                      const float32_t *__restrict__ pSrc,
+                      float32_t *__restrict__ pBuf,
+                      float32_t *__restrict__ pDst);
 
 /**
-  @brief      In-place 32 bit reversal function for XPULPV2
-  @param[in,out] pSrc        points to in-place buffer of unknown 32-bit data type
-  @param[in]  bitRevLen   bit reversal table length
-  @param[in]  pBitRevTab  points to bit reversal table
-  @return     none
+   @brief         Floating-point analytic signal and envelope of a block for XPULPV2 extension.
+   @param[in]     S     points to the floating-point FFT instance of length N, with
+                        bitReverseFlag enabled
+   @param[in]     pSrc  points to the block of N real samples
+   @param[in]     pBuf  points to the temporary buffer of 2*N floats
+   @param[out]    pDst  points to the analytic signal, N complex values, or NULL
+   @param[out]    pEnv  points to the envelope of N values, or NULL
+   @return        none
 */
+void plp_hilbert_f32s_xpulpv2(const plp_fft_instance_f32 *S,
+                              const float32_t *__restrict__ pSrc,
+                              float32_t *__restrict__ pBuf,
+                              float32_t *pDst,
+                              float32_t *pEnv);
 
-void
-plp_bitreversal_32s_xpulpv2(uint32_t *pSrc, const uint16_t bitRevLen, const uint16_t *pBitRevTab);
+/**
+   @brief         Glue code for the 16-bit fix-point analytic signal of a block.
+   @param[in]     S     points to the 32-bit CFFT instance of length N, e.g.
+                        plp_cfft_sR_q32_len256
+   @param[in]     pSrc  points to the block of N samples in Q1.15
+   @param[in]     pBuf  points to the temporary buffer of 2*N values
+   @param[out]    pDst  points to the analytic signal, N complex values in Q1.15
+   @return        none
+*/
+void plp_hilbert_q16(const plp_cfft_instance_q32 *S,
+                     const int16_t *__restrict__ pSrc,
+                     int32_t *__restrict__ pBuf,
+                     int16_t *__restrict__ pDst);
 
 /**
- * @brief      Glue code for quantized 32-bit complex fast fourier transform
- * 
- * Fixed point units input -> output dependent on length:
- * len=16:    Q1.31 -> Q5.27
- * len=32:    Q1.31 -> Q6.26
- * len=64:    Q1.31 -> Q7.25
- * len=128:   Q1.31 -> Q8.24
- * len=256:   Q1.31 -> Q9.23
- * len=512:   Q1.31 -> Q10.22
- * len=1024:  Q1.31 -> Q11.21
- * len=2048:  Q1.31 -> Q12.20
- * len=4096:  Q1.31 -> Q13.19
- *
- * @param[in]  S               points to an instance of the 32bit quantized CFFT structure
- * @param      p1              points to the complex data buffer of size <code>2*fftLen</code>. Processing occurs in-place.
- * @param[in]  ifftFlag        flag that selects forwart (ifftFlag=0) or inverse (ifftFlag=1)
- * @param[in]  bitReverseFlag  flag that enables (bitReverseFlag=1) of disables
- * (bitReverseFlag=0) bit reversal of output.
- * @param[in]  fracBits        decimal point for right shift (input format Q(32-fracBits).fracBits)
- */
+   @brief         Glue code for the 16-bit fix-point envelope of a block, the magnitude of its
+                  analytic signal.
+   @param[in]     S     points to the 32-bit CFFT instance of length N, e.g.
+                        plp_cfft_sR_q32_len256
+   @param[in]     pSrc  points to the block of N samples in Q1.15
+   @param[in]     pBuf  points to the temporary buffer of 2*N values
+   @param[out]    pDst  points to the envelope of N values in Q1.15
+   @return        none
+*/
+void plp_envelope_q16(const plp_cfft_instance_q32 *S,
+                      const int16_t *__restrict__ pSrc,
+                      int32_t *__restrict__ pBuf,
+                      int16_t *__restrict__ pDst);
 
-void plp_cfft_q32(const plp_cfft_instance_q32 *S,
-                      int32_t *p1,
-                      uint8_t ifftFlag,
-                      uint8_t bitReverseFlag,
-                      uint32_t fracBits);
+/**
+   @brief         16-bit fix-point analytic signal and envelope of a block for RV32IM extension.
+   @param[in]     S     points to the 32-bit CFFT instance of length N
+   @param[in]     pSrc  points to the block of N samples in Q1.15
+   @param[in]     pBuf  points to the temporary buffer of 2*N values
+   @param[out]    pDst  points to the analytic signal, N complex values in Q1.15, or NULL
+   @param[out]    pEnv  points to the envelope of N values in Q1.15, or NULL
+   @return        none
+*/
+void plp_hilbert_q16s_rv32im(const plp_cfft_instance_q32 *S,
+                             const int16_t *__restrict__ pSrc,
+                             int32_t *__restrict__ pBuf,
+                             int16_t *__restrict__ pDst,
+                             int16_t *__restrict__ pEnv);
 
 /**
- * @brief      Quantized 32-bit complex fast fourier transform for RV32IM
- *
- * @param[in]  S               points to an instance of the 32bit quantized CFFT structure
- * @param      p1              points to the complex data buffer of size <code>2*fftLen</code>. Processing occurs in-place.
- * @param[in]  ifftFlag        flag that selects forwart (ifftFlag=0) or inverse (ifftFlag=1)
- * @param[in]  bitReverseFlag  flag that enables (bitReverseFlag=1) of disables
- * (bitReverseFlag=0) bit reversal of output.
- * @param[in]  fracBits        decimal point for right shift (input format Q(32-fracBits).fracBits)
- */
+   @brief         16-bit fix-point analytic signal and envelope of a block for XPULPV2 extension.
+   @param[in]     S     points to the 32-bit CFFT instance of length N
+   @param[in]     pSrc  points to the block of N samples in Q1.15
+   @param[in]     pBuf  points to the temporary buffer of 2*N values
+   @param[out]    pDst  points to the analytic signal, N complex values in Q1.15, or NULL
+   @param[out]    pEnv  points to the envelope of N values in Q1.15, or NULL
+   @return        none
+*/
+void plp_hilbert_q16s_xpulpv2(const plp_cfft_instance_q32 *S,
+                              const int16_t *__restrict__ pSrc,
+                              int32_t *__restrict__ pBuf,
+                              int16_t *__restrict__ pDst,
+                              int16_t *__restrict__ pEnv);
 
-void plp_cfft_q32s_rv32im(const plp_cfft_instance_q32 *S,
-                      int32_t *p1,
-                      uint8_t ifftFlag,
-                      uint8_t bitReverseFlag,
-                      uint32_t fracBits);
+/**
+   @brief         Initializes the instance of the floating-point FIR Hilbert transformer, computes the
+                  coefficients and clears the state.
+   @param[out]    S         points to the FIR Hilbert transformer instance
+   @param[in]     numPairs  number of coefficients, the delay is 2*numPairs - 1 samples
+   @param[out]    pCoeffs   points to the buffer of numPairs coefficients
+   @param[out]    pState    points to the state buffer of 4*numPairs - 2 + blockSize samples
+   @return        none
+*/
+void plp_hilbert_fir_init_f32(plp_hilbert_fir_instance_f32 *S,
+                              uint32_t numPairs,
+                              float32_t *pCoeffs,
+                              float32_t *pState);
 
 /**
- * @brief      Quantized 32-bit complex fast fourier transform for XPULPV2
- *
- * @param[in]  S               points to an instance of the 32bit quantized CFFT structure
- * @param      p1              points to the complex data buffer of size <code>2*fftLen</code>. Processing occurs in-place.
- * @param[in]  ifftFlag        flag that selects forwart (ifftFlag=0) or inverse (ifftFlag=1)
- * @param[in]  bitReverseFlag  flag that enables (bitReverseFlag=1) of disables
- * (bitReverseFlag=0) bit reversal of output.
- * @param[in]  fracBits        decimal point for right shift (input format Q(32-fracBits).fracBits)
- */
+   @brief         Glue code for the floating-point FIR Hilbert transformer.
+   @param[in]     S          points to the FIR Hilbert transformer instance
+   @param[in]     pSrc       points to the block of input samples
+   @param[in]     blockSize  number of samples
+   @param[out]    pDst       points to the analytic signal of the samples delayed by
+                             2*numPairs - 1, blockSize complex values, or NULL
+   @param[out]    pEnv       points to the envelope of the samples delayed by 2*numPairs - 1,
+                             blockSize values, or NULL
+   @return        none
+*/
+void plp_hilbert_fir_f32(const plp_hilbert_fir_instance_f32 *S,
+                         const float32_t *__restrict__ pSrc,
+                         uint32_t blockSize,
+                         float32_t *__restrict__ pDst,
+                         float32_t *__restrict__ pEnv);
 
-void plp_cfft_q32s_xpulpv2(const plp_cfft_instance_q32 *S,
-                      int32_t *p1,
-                      uint8_t ifftFlag,
-                      uint8_t bitReverseFlag,
-                      uint32_t fracBits);
+/**
+   @brief         Floating-point FIR Hilbert transformer for XPULPV2 extension.
+   @param[in]     pSrc      points to the input samples, including the 4*numPairs - 2 past
+                            samples
+   @param[in]     pCoeffs   points to the numPairs coefficients
+   @param[in]     numPairs  number of coefficients
+   @param[in]     blkSize   number of output samples
+   @param[out]    pDst      points to the analytic signal, blkSize complex values, or NULL
+   @param[out]    pEnv      points to the envelope of blkSize values, or NULL
+   @return        none
+*/
+void plp_hilbert_fir_f32s_xpulpv2(const float32_t *__restrict__ pSrc,
+                                  const float32_t *__restrict__ pCoeffs,
+                                  uint32_t numPairs,
+                                  uint32_t blkSize,
+                                  float32_t *__restrict__ pDst,
+                                  float32_t *__restrict__ pEnv);
 
 /**
-   @brief Floating-point FFT on real input data.
-   @param[in]   S       points to an instance of the floating-point FFT structure
-   @param[in]   pSrc    points to the input buffer (real data)
-   @param[out]  pDst    points to the output buffer (complex data)
-   @return      none
+   @brief         Initializes the instance of the 16-bit fix-point FIR Hilbert transformer, computes the
+                  coefficients and clears the state.
+   @param[out]    S         points to the FIR Hilbert transformer instance
+   @param[in]     numPairs  number of coefficients, the delay is 2*numPairs - 1 samples
+   @param[out]    pCoeffs   points to the buffer of numPairs coefficients in Q1.15
+   @param[out]    pState    points to the state buffer of 4*numPairs - 2 + blockSize samples
+   @return        none
 */
-void plp_rfft_f32(const plp_fft_instance_f32 *S,
-                  const float32_t *__restrict__ pSrc,
-                  float32_t *__restrict__ pDst);
+void plp_hilbert_fir_init_q16(plp_hilbert_fir_instance_q16 *S,
+                              uint32_t numPairs,
+                              int16_t *pCoeffs,
+                              int16_t *pState);
 
 /**
-   @brief Floating-point FFT on real input data (parallel version).
-   @param[in]   S       points to an instance of the floating-point FFT structure
-   @param[in]   pSrc    points to the input buffer (real data)
-   @param[in]   nPE     number of parallel processing units
-   @param[out]  pDst    points to the output buffer (complex data)
-   @return      none
+   @brief         Glue code for the 16-bit fix-point FIR Hilbert transformer.
+   @param[in]     S          points to the FIR Hilbert transformer instance
+   @param[in]     pSrc       points to the block of input samples in Q1.15
+   @param[in]     blockSize  number of samples
+   @param[out]    pDst       points to the analytic signal of the samples delayed by
+                             2*numPairs - 1, blockSize complex values, or NULL
+   @param[out]    pEnv       points to the envelope of the samples delayed by 2*numPairs - 1,
+                             blockSize values, or NULL
+   @return        none
 */
-void plp_rfft_f32_parallel(const plp_fft_instance_f32 *S,
-                           const float32_t *__restrict__ pSrc,
-                           const uint32_t nPE,
-                           float32_t *__restrict__ pDst);
+void plp_hilbert_fir_q16(const plp_hilbert_fir_instance_q16 *S,
+                         const int16_t *__restrict__ pSrc,
+                         uint32_t blockSize,
+                         int16_t *__restrict__ pDst,
+                         int16_t *__restrict__ pEnv);
 
 /**
-   @brief  Floating-point FFT on real input data for XPULPV2 extension.
-   @param[in]   S       points to an instance of the floating-point FFT structure
-   @param[in]   pSrcA   points to the input buffer (real data)
-   @param[out]  pDst    points to the output buffer (complex data)
-   @return      none
+   @brief         16-bit fix-point FIR Hilbert transformer for RV32IM extension.
+   @param[in]     pSrc      points to the input samples in Q1.15, including the 4*numPairs - 2 past
+                            samples
+   @param[in]     pCoeffs   points to the numPairs coefficients in Q1.15
+   @param[in]     numPairs  number of coefficients
+   @param[in]     blkSize   number of output samples
+   @param[out]    pDst      points to the analytic signal, blkSize complex values, or NULL
+   @param[out]    pEnv      points to the envelope of blkSize values, or NULL
+   @return        none
 */
-void plp_rfft_f32_xpulpv2(const plp_fft_instance_f32 *S,
-                          const float32_t *__restrict__ pSrc,
-                          float32_t *__restrict__ pDst);
+void plp_hilbert_fir_q16s_rv32im(const int16_t *__restrict__ pSrc,
+                                 const int16_t *__restrict__ pCoeffs,
+                                 uint32_t numPairs,
+                                 uint32_t blkSize,
+                                 int16_t *__restrict__ pDst,
+                                 int16_t *__restrict__ pEnv);
 
 /**
-   @brief  Floating-point FFT on real input data for XPULPV2 extension (parallel version).
-   @param[in]   arg       points to an instance of the floating-point FFT structure
-   @return      none
+   @brief         16-bit fix-point FIR Hilbert transformer for XPULPV2 extension.
+   @param[in]     pSrc      points to the input samples in Q1.15, including the 4*numPairs - 2 past
+                            samples
+   @param[in]     pCoeffs   points to the numPairs coefficients in Q1.15
+   @param[in]     numPairs  number of coefficients
+   @param[in]     blkSize   number of output samples
+   @param[out]    pDst      points to the analytic signal, blkSize complex values, or NULL
+   @param[out]    pEnv      points to the envelope of blkSize values, or NULL
+   @return        none
 */
-void plp_rfft_f32_xpulpv2_parallel(plp_fft_instance_f32_parallel *arg);
+void plp_hilbert_fir_q16s_xpulpv2(const int16_t *__restrict__ pSrc,
+                                  const int16_t *__restrict__ pCoeffs,
+                                  uint32_t numPairs,
+                                  uint32_t blkSize,
+                                  int16_t *__restrict__ pDst,
+                                  int16_t *__restrict__ pEnv);
 
 /**
    @brief Floating-point FFT on complex input data.
@@ -8689,6 +14577,57 @@ void plp_cfft_f32_xpulpv2(const plp_fft_instance_f32 *S,
 */
 void plp_cfft_f32_xpulpv2_parallel(plp_fft_instance_f32_parallel *arg);
 
+/**
+   @brief Floating-point Stockham FFT on complex input data. The transform is computed
+          out-of-place and the output is in natural order, without a separate bit reversal pass
+          (S->bitReverseFlag and S->pBitReverseLUT are not used).
+   @param[in]   S       points to an instance of the floating-point FFT structure
+   @param[in]   pSrc    points to the input buffer (complex data), it is not modified
+   @param[in]   pBuf    points to a temporary buffer of 2*FFTLength values
+   @param[out]  pDst    points to the output buffer (complex data)
+   @return      none
+*/
+void plp_cfft_stockham_f32(const plp_fft_instance_f32 *S,
+                           const float32_t *pSrc,
+                           float32_t *pBuf,
+                           float32_t *pDst);
+
+/**
+   @brief Floating-point Stockham FFT on complex input data (parallel version).
+   @param[in]   S       points to an instance of the floating-point FFT structure
+   @param[in]   pSrc    points to the input buffer (complex data), it is not modified
+   @param[in]   pBuf    points to a temporary buffer of 2*FFTLength values
+   @param[in]   nPE     number of parallel processing units
+   @param[out]  pDst    points to the output buffer (complex data)
+   @return      none
+*/
+void plp_cfft_stockham_f32_parallel(const plp_fft_instance_f32 *S,
+                                    const float32_t *pSrc,
+                                    float32_t *pBuf,
+                                    const uint32_t nPE,
+                                    float32_t *pDst);
+
+/**
+   @brief  Floating-point Stockham FFT on complex input data for XPULPV2 extension.
+   @param[in]   S       points to an instance of the floating-point FFT structure
+   @param[in]   pSrc    points to the input buffer (complex data)
+   @param[in]   pBuf    points to a temporary buffer of 2*FFTLength values
+   @param[out]  pDst    points to the output buffer (complex data)
+   @return      none
+*/
+void plp_cfft_stockham_f32_xpulpv2(const plp_fft_instance_f32 *S,
+                                   const float32_t *pSrc,
+                                   float32_t *pBuf,
+                                   float32_t *pDst);
+
+/**
+   @brief  Floating-point Stockham FFT on complex input data for XPULPV2 extension (parallel
+           version).
+   @param[in]   arg       points to an instance of plp_fft_stockham_instance_f32_parallel
+   @return      none
+*/
+void plp_cfft_stockham_f32p_xpulpv2(void *arg);
+
 /**
    @brief Floating-point DCT on real input data. Implementation of
                         John Makhoul's "A Fast Cosine Transform in One
@@ -8737,6 +14676,100 @@ void plp_dct2_f32_parallel(const plp_fft_instance_f32 *S,
                   	   float32_t *__restrict__ pBuf,
                   	   float32_t *__restrict__ pDst);
 
+/**
+   @brief Glue code for the quantized 16 bit DCT-II on real input data. The output is
+                        <code>pDst[k] = 1/N sum_n pSrc[n] cos(pi k (2n+1) / (2N))</code>
+   @param[in]   S       points to an instance of the 16bit quantized DCT structure
+   @param[in]   pSrc    points to the input buffer (real data) of size dctLen
+   @param[in]   pBuf    points to a buffer of size dctLen, used for computation
+   @param[out]  pDst    points to the output buffer (real data) of size dctLen, may be the same
+                        as pSrc
+   @return      none
+*/
+void plp_dct2_q16(const plp_dct_instance_q16 *S,
+                  const int16_t *pSrc,
+                  int16_t *__restrict__ pBuf,
+                  int16_t *pDst);
+
+/**
+   @brief Glue code for the quantized 32 bit DCT-II on real input data. The output is
+                        <code>pDst[k] = 1/N sum_n pSrc[n] cos(pi k (2n+1) / (2N))</code>
+   @param[in]   S       points to an instance of the 32bit quantized DCT structure
+   @param[in]   pSrc    points to the input buffer (real data) of size dctLen
+   @param[in]   pBuf    points to a buffer of size dctLen, used for computation
+   @param[out]  pDst    points to the output buffer (real data) of size dctLen, may be the same
+                        as pSrc
+   @return      none
+*/
+void plp_dct2_q32(const plp_dct_instance_q32 *S,
+                  const int32_t *pSrc,
+                  int32_t *__restrict__ pBuf,
+                  int32_t *pDst);
+
+/**
+   @brief Glue code for the quantized 16 bit inverse DCT-II (DCT-III) on real input data. The
+                        output is <code>pDst[n] = 1/N (pSrc[0]/2 + sum_{k>0} pSrc[k] cos(pi k
+                        (2n+1) / (2N)))</code>, such that plp_idct2 of the output of plp_dct2
+                        is the original input divided by 2N
+   @param[in]   S       points to an instance of the 16bit quantized DCT structure
+   @param[in]   pSrc    points to the input buffer (real data) of size dctLen
+   @param[in]   pBuf    points to a buffer of size dctLen, used for computation
+   @param[out]  pDst    points to the output buffer (real data) of size dctLen, may be the same
+                        as pSrc
+   @return      none
+*/
+void plp_idct2_q16(const plp_dct_instance_q16 *S,
+                   const int16_t *pSrc,
+                   int16_t *__restrict__ pBuf,
+                   int16_t *pDst);
+
+/**
+   @brief Glue code for the quantized 32 bit inverse DCT-II (DCT-III) on real input data. The
+                        output is <code>pDst[n] = 1/N (pSrc[0]/2 + sum_{k>0} pSrc[k] cos(pi k
+                        (2n+1) / (2N)))</code>, such that plp_idct2 of the output of plp_dct2
+                        is the original input divided by 2N
+   @param[in]   S       points to an instance of the 32bit quantized DCT structure
+   @param[in]   pSrc    points to the input buffer (real data) of size dctLen
+   @param[in]   pBuf    points to a buffer of size dctLen, used for computation
+   @param[out]  pDst    points to the output buffer (real data) of size dctLen, may be the same
+                        as pSrc
+   @return      none
+*/
+void plp_idct2_q32(const plp_dct_instance_q32 *S,
+                   const int32_t *pSrc,
+                   int32_t *__restrict__ pBuf,
+                   int32_t *pDst);
+
+/**
+   @brief Glue code for the quantized 16 bit DCT-IV on real input data. The output is
+                        <code>pDst[k] = 1/N sum_n pSrc[n] cos(pi (n+1/2) (k+1/2) / N)</code>
+   @param[in]   S       points to an instance of the 16bit quantized DCT structure
+   @param[in]   pSrc    points to the input buffer (real data) of size dctLen
+   @param[in]   pBuf    points to a buffer of size dctLen, used for computation
+   @param[out]  pDst    points to the output buffer (real data) of size dctLen, may be the same
+                        as pSrc
+   @return      none
+*/
+void plp_dct4_q16(const plp_dct_instance_q16 *S,
+                  const int16_t *pSrc,
+                  int16_t *__restrict__ pBuf,
+                  int16_t *pDst);
+
+/**
+   @brief Glue code for the quantized 32 bit DCT-IV on real input data. The output is
+                        <code>pDst[k] = 1/N sum_n pSrc[n] cos(pi (n+1/2) (k+1/2) / N)</code>
+   @param[in]   S       points to an instance of the 32bit quantized DCT structure
+   @param[in]   pSrc    points to the input buffer (real data) of size dctLen
+   @param[in]   pBuf    points to a buffer of size dctLen, used for computation
+   @param[out]  pDst    points to the output buffer (real data) of size dctLen, may be the same
+                        as pSrc
+   @return      none
+*/
+void plp_dct4_q32(const plp_dct_instance_q32 *S,
+                  const int32_t *pSrc,
+                  int32_t *__restrict__ pBuf,
+                  int32_t *pDst);
+
 /**
    @brief MFCC on real input data.
    @param[in]   SFFT        points to an instance of the floating-point FFT
@@ -8805,6 +14838,65 @@ void plp_mfcc_f32_parallel(const plp_fft_instance_f32 *SFFT,
 			   const uint32_t nPE,
                 	   float32_t *__restrict__ pDst);
 
+/**
+   @brief       Glue code for the 16 bit fixed-point MFCC on real input data.
+   @param[in]   SFFT        points to an instance of the 32 bit RFFT structure
+                            (fftLenReal = n_fft), e.g. plp_rfft_sR_q32_len512
+   @param[in]   SDCT        points to an instance of the 16 bit DCT structure
+                            (dctLen = n_mels), e.g. plp_dct_sR_q16_len32
+   @param[in]   filterBank  points to plp_triangular_filter_q16 instance with
+                            nFilters = n_mels
+   @param[in]   window      window in Q1.15 of size n_fft
+   @param[in]   pSrc        points to the input buffer (Q1.15, size n_fft)
+   @param[out]  pDst        points to the output buffer of length at least 4*n_fft+4,
+                            aligned to 4 bytes. pSrc and pDst must not overlap.
+                            The MFCCs are returned in the first n_mels spots,
+                            in Q5.10.
+   @return      none
+*/
+void plp_mfcc_q16(const plp_rfft_instance_q32 *SFFT,
+                  const plp_dct_instance_q16 *SDCT,
+                  const plp_triangular_filter_q16 *filterBank,
+                  const int16_t *window,
+                  const int16_t *__restrict__ pSrc,
+                  int16_t *__restrict__ pDst);
+
+/**
+   @brief       Log mel energies of the 16 bit fixed-point MFCC for RV32IM extension.
+   @param[in]   SFFT        points to an instance of the 32 bit RFFT structure
+   @param[in]   filterBank  points to plp_triangular_filter_q16 instance
+   @param[in]   window      window in Q1.15 of size n_fft
+   @param[in]   pSrc        points to the input buffer (Q1.15, size n_fft)
+   @param[in]   pBuf        points to a buffer of size 4*n_fft+4, aligned to 4 bytes
+   @param[out]  pDst        points to the output buffer of size nFilters, may be the
+                            second half of pBuf (starting at pBuf + 2*n_fft + 4)
+   @return      none
+*/
+void plp_mfcc_q16s_rv32im(const plp_rfft_instance_q32 *SFFT,
+                          const plp_triangular_filter_q16 *filterBank,
+                          const int16_t *window,
+                          const int16_t *__restrict__ pSrc,
+                          int16_t *pBuf,
+                          int16_t *pDst);
+
+/**
+   @brief       Log mel energies of the 16 bit fixed-point MFCC for XPULPV2 extension.
+   @param[in]   SFFT        points to an instance of the 32 bit RFFT structure
+   @param[in]   filterBank  points to plp_triangular_filter_q16 instance
+   @param[in]   window      window in Q1.15 of size n_fft
+   @param[in]   pSrc        points to the input buffer (Q1.15, size n_fft)
+   @param[in]   pBuf        points to a buffer of size 4*n_fft+4, aligned to 4 bytes
+   @param[out]  pDst        points to the output buffer of size nFilters, may be the
+                            second half of pBuf (starting at pBuf + 2*n_fft + 4)
+   @return      none
+*/
+void plp_mfcc_q16s_xpulpv2(const plp_rfft_instance_q32 *SFFT,
+                           const plp_triangular_filter_q16 *filterBank,
+                           const int16_t *window,
+                           const int16_t *__restrict__ pSrc,
+                           int16_t *pBuf,
+                           int16_t *pDst);
+
 /** -------------------------------------------------------
   @brief      Glue code for matrix addition of a 32-bit integer matrices.
   @param[in]  pSrcA   Points to the first input matrix
@@ -10347,8 +16439,8 @@ void plp_mat_trans_i16s_rv32im(const int16_t *__restrict__ pSrc,
   @return     none
 
   @par Exploiting SIMD instructions
-  The 16 bit values are packed two each into 32 bit vectors and then the two dot products are
-  performed on 32 bit vectors, with 32 bit accumulator.
+  The matrix is transposed in tiles of 2x2 values. Each tile is loaded as two 32-bit vectors,
+  transposed with shuffle instructions and stored as two 32-bit vectors.
 */
 
 void plp_mat_trans_i16s_xpulpv2(const int16_t *__restrict__ pSrc,
@@ -10422,8 +16514,8 @@ void plp_mat_trans_i8s_rv32im(const int8_t *__restrict__ pSrc,
   @return     none
 
   @par Exploiting SIMD instructions
-  The 8 bit values are packed four each into 32 bit vectors and then the four dot products are
-  performed on 32 bit vectors, with 32 bit accumulator.
+  The matrix is transposed in tiles of 4x4 values. Each tile is loaded as four 32-bit vectors,
+  transposed with shuffle instructions and stored as four 32-bit vectors.
 */
 
 void plp_mat_trans_i8s_xpulpv2(const int8_t *__restrict__ pSrc,
@@ -10491,6 +16583,98 @@ void plp_mat_trans_f32(const float *__restrict__ pSrc,
 void plp_mat_trans_f32_parallel(
     const float *__restrict__ pSrc, uint32_t M, uint32_t N, uint32_t nPE, float *__restrict__ pDst);
 
+/** -------------------------------------------------------
+  @brief      Glue code for in-place transpose of a square 32-bit integer matrix.
+  @param[in,out] pSrcDst Points to the matrix of shape NxN, overwritten with its transpose
+  @param[in]     N       Width and height of the matrix
+  @return        none
+*/
+
+void plp_mat_trans_inplace_i32(int32_t *__restrict__ pSrcDst, uint32_t N);
+
+/**
+  @brief      in-place transpose of a square 32-bit integer matrix for RV32IM extension.
+  @param[in,out] pSrcDst Points to the matrix of shape NxN, overwritten with its transpose
+  @param[in]     N       Width and height of the matrix
+  @return        none
+*/
+
+void plp_mat_trans_inplace_i32s_rv32im(int32_t *__restrict__ pSrcDst, uint32_t N);
+
+/**
+  @brief      in-place transpose of a square 32-bit integer matrix for XPULPV2 extension.
+  @param[in,out] pSrcDst Points to the matrix of shape NxN, overwritten with its transpose
+  @param[in]     N       Width and height of the matrix
+  @return        none
+*/
+
+void plp_mat_trans_inplace_i32s_xpulpv2(int32_t *__restrict__ pSrcDst, uint32_t N);
+
+/** -------------------------------------------------------
+  @brief      Glue code for in-place transpose of a square 16-bit integer matrix.
+  @param[in,out] pSrcDst Points to the matrix of shape NxN, overwritten with its transpose
+  @param[in]     N       Width and height of the matrix
+  @return        none
+*/
+
+void plp_mat_trans_inplace_i16(int16_t *__restrict__ pSrcDst, uint32_t N);
+
+/**
+  @brief      in-place transpose of a square 16-bit integer matrix for RV32IM extension.
+  @param[in,out] pSrcDst Points to the matrix of shape NxN, overwritten with its transpose
+  @param[in]     N       Width and height of the matrix
+  @return        none
+*/
+
+void plp_mat_trans_inplace_i16s_rv32im(int16_t *__restrict__ pSrcDst, uint32_t N);
+
+/**
+  @brief      in-place transpose of a square 16-bit integer matrix for XPULPV2 extension.
+  @param[in,out] pSrcDst Points to the matrix of shape NxN, overwritten with its transpose
+  @param[in]     N       Width and height of the matrix
+  @return        none
+*/
+
+void plp_mat_trans_inplace_i16s_xpulpv2(int16_t *__restrict__ pSrcDst, uint32_t N);
+
+/** -------------------------------------------------------
+  @brief      Glue code for in-place transpose of a square 8-bit integer matrix.
+  @param[in,out] pSrcDst Points to the matrix of shape NxN, overwritten with its transpose
+  @param[in]     N       Width and height of the matrix
+  @return        none
+*/
+
+void plp_mat_trans_inplace_i8(int8_t *__restrict__ pSrcDst, uint32_t N);
+
+/**
+  @brief      in-place transpose of a square 8-bit integer matrix for RV32IM extension.
+  @param[in,out] pSrcDst Points to the matrix of shape NxN, overwritten with its transpose
+  @param[in]     N       Width and height of the matrix
+  @return        none
+*/
+
+void plp_mat_trans_inplace_i8s_rv32im(int8_t *__restrict__ pSrcDst, uint32_t N);
+
+/**
+  @brief      in-place transpose of a square 8-bit integer matrix for XPULPV2 extension.
+  @param[in,out] pSrcDst Points to the matrix of shape NxN, overwritten with its transpose
+  @param[in]     N       Width and height of the matrix
+  @return        none
+*/
+
+void plp_mat_trans_inplace_i8s_xpulpv2(int8_t *__restrict__ pSrcDst, uint32_t N);
+
+/** -------------------------------------------------------
+  @brief      Glue code for in-place transpose of a square 32-bit floating-point matrix.
+  @param[in,out] pSrcDst Points to the matrix of shape NxN, overwritten with its transpose
+  @param[in]     N       Width and height of the matrix
+  @return        none
+
+  @par This function will use plp_mat_trans_inplace_i32s_xpulpv2 for its computation.
+*/
+
+void plp_mat_trans_inplace_f32(float *__restrict__ pSrcDst, uint32_t N);
+
 /** -------------------------------------------------------
   @brief      Glue code for matrix inverse of a 32-bit floating-point matrices.
   @param[in]  pSrc Points to the first input matrix. pSrc is modified by this funciton
@@ -11141,7 +17325,7 @@ void plp_mat_mult_stride_i8s_xpulpv2(const int8_t *__restrict__ pSrcA,
    @param[in]  strideA    Stride of matrix A (elements between each row)
    @param[in]  strideB    Stride of matrix B (elements between each row)
    @param[in]  strudeY    Stride of output matrix (elements between each row)
-   @param[in]  nPE        Number of cores to use
+   @param[in]  nPE        Number of cores to use (or PLP_NPE_AUTO)
    @param[out] pDstC      Output is written here
    @return     none
 */
@@ -11178,7 +17362,7 @@ void plp_mat_mult_stride_i32p_xpulpv2(void *args);
    @param[in]  strideA    Stride of matrix A (elements between each row)
    @param[in]  strideB    Stride of matrix B (elements between each row)
    @param[in]  strudeY    Stride of output matrix (elements between each row)
-   @param[in]  nPE        Number of cores to use
+   @param[in]  nPE        Number of cores to use (or PLP_NPE_AUTO)
    @param[out] pDstC      Output is written here
    @return     none
 */
@@ -11218,7 +17402,7 @@ void plp_mat_mult_stride_i16p_xpulpv2(void *args);
    @param[in]  strideA    Stride of matrix A (elements between each row)
    @param[in]  strideB    Stride of matrix B (elements between each row)
    @param[in]  strudeY    Stride of output matrix (elements between each row)
-   @param[in]  nPE        Number of cores to use
+   @param[in]  nPE        Number of cores to use (or PLP_NPE_AUTO)
    @param[out] pDstC      Output is written here
    @return     none
 */
@@ -11295,7 +17479,7 @@ void plp_mat_mult_stride_f32s_xpulpv2(const float *__restrict__ pSrcA,
    @param[in]  strideA    Stride of matrix A (elements between each row)
    @param[in]  strideB    Stride of matrix B (elements between each row)
    @param[in]  strudeY    Stride of output matrix (elements between each row)
-   @param[in]  nPE        Number of cores to use
+   @param[in]  nPE        Number of cores to use (or PLP_NPE_AUTO)
    @param[out] pDstC      Output is written here
    @return     none
 */
@@ -11378,7 +17562,7 @@ void plp_mat_mult_stride_q32(const int32_t *__restrict__ pSrcA,
    @param[in]  strideB    Stride of matrix B (elements between each row)
    @param[in]  strudeY    Stride of output matrix (elements between each row)
    @param[in]  shift      Amount to shift the result of each multiplication.
-   @param[in]  nPE        Number of cores to use
+   @param[in]  nPE        Number of cores to use (or PLP_NPE_AUTO)
    @param[out] pDstC      Output is written here
    @return     none
 
@@ -11523,7 +17707,7 @@ void plp_mat_mult_stride_q16(const int16_t *__restrict__ pSrcA,
    @param[in]  strideB    Stride of matrix B (elements between each row)
    @param[in]  strudeY    Stride of output matrix (elements between each row)
    @param[in]  shift      Amount to shift the result of each multiplication.
-   @param[in]  nPE        Number of cores to use
+   @param[in]  nPE        Number of cores to use (or PLP_NPE_AUTO)
    @param[out] pDstC      Output is written here
    @return     none
 
@@ -11677,7 +17861,7 @@ void plp_mat_mult_stride_q8(const int8_t *__restrict__ pSrcA,
    @param[in]  strideB    Stride of matrix B (elements between each row)
    @param[in]  strudeY    Stride of output matrix (elements between each row)
    @param[in]  shift      Amount to shift the result of each multiplication.
-   @param[in]  nPE        Number of cores to use
+   @param[in]  nPE        Number of cores to use (or PLP_NPE_AUTO)
    @param[out] pDstC      Output is written here
    @return     none
 
@@ -12028,7 +18212,7 @@ void plp_mat_mult_trans_stride_i8s_xpulpv2(const int8_t *__restrict__ pSrcA,
    @param[in]  strideA    Stride of matrix A (elements between each row)
    @param[in]  strideB    Stride of matrix B (elements between each row)
    @param[in]  strudeY    Stride of output matrix (elements between each row)
-   @param[in]  nPE        Number of cores to use
+   @param[in]  nPE        Number of cores to use (or PLP_NPE_AUTO)
    @param[out] pDstC      Output is written here
    @return     none
 */
@@ -12065,7 +18249,7 @@ void plp_mat_mult_trans_stride_i32p_xpulpv2(void *args);
    @param[in]  strideA    Stride of matrix A (elements between each row)
    @param[in]  strideB    Stride of matrix B (elements between each row)
    @param[in]  strudeY    Stride of output matrix (elements between each row)
-   @param[in]  nPE        Number of cores to use
+   @param[in]  nPE        Number of cores to use (or PLP_NPE_AUTO)
    @param[out] pDstC      Output is written here
    @return     none
 */
@@ -12106,7 +18290,7 @@ void plp_mat_mult_trans_stride_i16p_xpulpv2(void *args);
    @param[in]  strideA    Stride of matrix A (elements between each row)
    @param[in]  strideB    Stride of matrix B (elements between each row)
    @param[in]  strudeY    Stride of output matrix (elements between each row)
-   @param[in]  nPE        Number of cores to use
+   @param[in]  nPE        Number of cores to use (or PLP_NPE_AUTO)
    @param[out] pDstC      Output is written here
    @return     none
 */
@@ -12181,7 +18365,7 @@ void plp_mat_mult_trans_stride_q32(const int32_t *__restrict__ pSrcA,
    @param[in]  strideB    Stride of matrix B (elements between each row)
    @param[in]  strudeY    Stride of output matrix (elements between each row)
    @param[in]  shift      Amount to shift the result of each multiplication.
-   @param[in]  nPE        Number of cores to use
+   @param[in]  nPE        Number of cores to use (or PLP_NPE_AUTO)
    @param[out] pDstC      Output is written here
    @return     none
 
@@ -12328,7 +18512,7 @@ void plp_mat_mult_trans_stride_q16(const int16_t *__restrict__ pSrcA,
    @param[in]  strideB    Stride of matrix B (elements between each row)
    @param[in]  strudeY    Stride of output matrix (elements between each row)
    @param[in]  shift      Amount to shift the result of each multiplication.
-   @param[in]  nPE        Number of cores to use
+   @param[in]  nPE        Number of cores to use (or PLP_NPE_AUTO)
    @param[out] pDstC      Output is written here
    @return     none
 
@@ -12484,7 +18668,7 @@ void plp_mat_mult_trans_stride_q8(const int8_t *__restrict__ pSrcA,
    @param[in]  strideB    Stride of matrix B (elements between each row)
    @param[in]  strudeY    Stride of output matrix (elements between each row)
    @param[in]  shift      Amount to shift the result of each multiplication.
-   @param[in]  nPE        Number of cores to use
+   @param[in]  nPE        Number of cores to use (or PLP_NPE_AUTO)
    @param[out] pDstC      Output is written here
    @return     none
 
@@ -12653,7 +18837,7 @@ void plp_mat_mult_trans_stride_f32s_xpulpv2(const float *__restrict__ pSrcA,
    @param[in]  strideA    Stride of matrix A (elements between each row)
    @param[in]  strideB    Stride of matrix B (elements between each row)
    @param[in]  strudeY    Stride of output matrix (elements between each row)
-   @param[in]  nPE        Number of cores to use
+   @param[in]  nPE        Number of cores to use (or PLP_NPE_AUTO)
    @param[out] pDstC      Output is written here
    @return     none
 */
@@ -12761,7 +18945,7 @@ void plp_mat_mult_cmplx_stride_i32s_xpulpv2(const int32_t *__restrict__ pSrcA,
   @param[in]  strideA Stride of input matrix A (elements between each row)
   @param[in]  strideB Stride of input matrix B (elements between each row)
   @param[in]  strideC Stride of output matrix C (Elements between each row)
-  @param[in]  nPE     Number of cores to use for computation
+  @param[in]  nPE     Number of cores to use for computation (or PLP_NPE_AUTO)
   @param[out] pDstC   Points to the output matrix of shape MxO
   @return     none
 */
@@ -12872,7 +19056,7 @@ void plp_mat_mult_cmplx_stride_i16s_xpulpv2(const int16_t *__restrict__ pSrcA,
   @param[in]  strideA Stride of input matrix A (elements between each row)
   @param[in]  strideB Stride of input matrix B (elements between each row)
   @param[in]  strideC Stride of output matrix C (Elements between each row)
-  @param[in]  nPE     Number of cores to use for computation
+  @param[in]  nPE     Number of cores to use for computation (or PLP_NPE_AUTO)
   @param[out] pDstC   Points to the output matrix of shape MxO
   @return     none
 */
@@ -12987,7 +19171,7 @@ void plp_mat_mult_cmplx_stride_i8s_xpulpv2(const int8_t *__restrict__ pSrcA,
   @param[in]  strideA Stride of input matrix A (elements between each row)
   @param[in]  strideB Stride of input matrix B (elements between each row)
   @param[in]  strideC Stride of output matrix C (Elements between each row)
-  @param[in]  nPE     Number of cores to use for computation
+  @param[in]  nPE     Number of cores to use for computation (or PLP_NPE_AUTO)
   @param[out] pDstC   Points to the output matrix of shape MxO
   @return     none
 */
@@ -13074,7 +19258,7 @@ void plp_mat_mult_cmplx_stride_f32s_xpulpv2(const float *__restrict__ pSrcA,
   @param[in]  strideA Stride of input matrix A (elements between each row)
   @param[in]  strideB Stride of input matrix B (elements between each row)
   @param[in]  strideC Stride of output matrix C (Elements between each row)
-  @param[in]  nPE     Number of cores to use for computation
+  @param[in]  nPE     Number of cores to use for computation (or PLP_NPE_AUTO)
   @param[out] pDstC   Points to the output matrix of shape MxO
   @return     none
 */
@@ -13216,7 +19400,7 @@ void plp_mat_mult_cmplx_stride_q32s_xpulpv2(const int32_t *__restrict__ pSrcA,
   @param[in]  strideB Stride of input matrix B (elements between each row)
   @param[in]  strideC Stride of output matrix C (Elements between each row)
   @param[in]  shift   Amount to shift the result of each multiplication ot the right
-  @param[in]  nPE     Number of cores to use for computation
+  @param[in]  nPE     Number of cores to use for computation (or PLP_NPE_AUTO)
   @param[out] pDstC   Points to the output matrix of shape MxO
   @return     none
 
@@ -13381,7 +19565,7 @@ void plp_mat_mult_cmplx_stride_q16s_xpulpv2(const int16_t *__restrict__ pSrcA,
   @param[in]  strideB Stride of input matrix B (elements between each row)
   @param[in]  strideC Stride of output matrix C (Elements between each row)
   @param[in]  shift   Amount to shift the result of each multiplication ot the right
-  @param[in]  nPE     Number of cores to use for computation
+  @param[in]  nPE     Number of cores to use for computation (or PLP_NPE_AUTO)
   @param[out] pDstC   Points to the output matrix of shape MxO
   @return     none
 
@@ -13549,7 +19733,7 @@ void plp_mat_mult_cmplx_stride_q8s_xpulpv2(const int8_t *__restrict__ pSrcA,
   @param[in]  strideB Stride of input matrix B (elements between each row)
   @param[in]  strideC Stride of output matrix C (Elements between each row)
   @param[in]  shift   Amount to shift the result of each multiplication ot the right
-  @param[in]  nPE     Number of cores to use for computation
+  @param[in]  nPE     Number of cores to use for computation (or PLP_NPE_AUTO)
   @param[out] pDstC   Points to the output matrix of shape MxO
   @return     none
 
@@ -13681,7 +19865,7 @@ void plp_mat_mult_trans_cmplx_stride_i32s_xpulpv2(const int32_t *__restrict__ pS
   @param[in]  strideA Stride of input matrix A (elements between each row)
   @param[in]  strideB Stride of input matrix B (elements between each row)
   @param[in]  strideC Stride of output matrix C (Elements between each row)
-  @param[in]  nPE     Number of cores to use for computation
+  @param[in]  nPE     Number of cores to use for computation (or PLP_NPE_AUTO)
   @param[out] pDstC   Points to the output matrix of shape MxO
   @return     none
 */
@@ -13795,7 +19979,7 @@ void plp_mat_mult_trans_cmplx_stride_i16s_xpulpv2(const int16_t *__restrict__ pS
   @param[in]  strideA Stride of input matrix A (elements between each row)
   @param[in]  strideB Stride of input matrix B (elements between each row)
   @param[in]  strideC Stride of output matrix C (Elements between each row)
-  @param[in]  nPE     Number of cores to use for computation
+  @param[in]  nPE     Number of cores to use for computation (or PLP_NPE_AUTO)
   @param[out] pDstC   Points to the output matrix of shape MxO
   @return     none
 */
@@ -13912,7 +20096,7 @@ void plp_mat_mult_trans_cmplx_stride_i8s_xpulpv2(const int8_t *__restrict__ pSrc
   @param[in]  strideA Stride of input matrix A (elements between each row)
   @param[in]  strideB Stride of input matrix B (elements between each row)
   @param[in]  strideC Stride of output matrix C (Elements between each row)
-  @param[in]  nPE     Number of cores to use for computation
+  @param[in]  nPE     Number of cores to use for computation (or PLP_NPE_AUTO)
   @param[out] pDstC   Points to the output matrix of shape MxO
   @return     none
 */
@@ -14001,7 +20185,7 @@ void plp_mat_mult_trans_cmplx_stride_f32s_xpulpv2(const float *__restrict__ pSrc
   @param[in]  strideA Stride of input matrix A (elements between each row)
   @param[in]  strideB Stride of input matrix B (elements between each row)
   @param[in]  strideC Stride of output matrix C (Elements between each row)
-  @param[in]  nPE     Number of cores to use for computation
+  @param[in]  nPE     Number of cores to use for computation (or PLP_NPE_AUTO)
   @param[out] pDstC   Points to the output matrix of shape MxO
   @return     none
 */
@@ -14145,7 +20329,7 @@ void plp_mat_mult_trans_cmplx_stride_q32s_xpulpv2(const int32_t *__restrict__ pS
   @param[in]  strideB Stride of input matrix B (elements between each row)
   @param[in]  strideC Stride of output matrix C (Elements between each row)
   @param[in]  shift   Amount to shift the result of each multiplication ot the right
-  @param[in]  nPE     Number of cores to use for computation
+  @param[in]  nPE     Number of cores to use for computation (or PLP_NPE_AUTO)
   @param[out] pDstC   Points to the output matrix of shape MxO
   @return     none
 
@@ -14312,7 +20496,7 @@ void plp_mat_mult_trans_cmplx_stride_q16s_xpulpv2(const int16_t *__restrict__ pS
   @param[in]  strideB Stride of input matrix B (elements between each row)
   @param[in]  strideC Stride of output matrix C (Elements between each row)
   @param[in]  shift   Amount to shift the result of each multiplication ot the right
-  @param[in]  nPE     Number of cores to use for computation
+  @param[in]  nPE     Number of cores to use for computation (or PLP_NPE_AUTO)
   @param[out] pDstC   Points to the output matrix of shape MxO
   @return     none
 
@@ -14483,7 +20667,7 @@ void plp_mat_mult_trans_cmplx_stride_q8s_xpulpv2(const int8_t *__restrict__ pSrc
   @param[in]  strideB Stride of input matrix B (elements between each row)
   @param[in]  strideC Stride of output matrix C (Elements between each row)
   @param[in]  shift   Amount to shift the result of each multiplication ot the right
-  @param[in]  nPE     Number of cores to use for computation
+  @param[in]  nPE     Number of cores to use for computation (or PLP_NPE_AUTO)
   @param[out] pDstC   Points to the output matrix of shape MxO
   @return     none
 
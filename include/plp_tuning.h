@@ -0,0 +1,82 @@
+/* ----------------------------------------------------------------------
+ * Project:      PULP DSP Library
+ * Title:        plp_tuning.h
+ * Description:  Size-dispatch table of the kernel variants
+ *
+ * $Date:        19. Oct 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * This file is generated by test/mrWolf/tune.py, do not edit it by hand. Each macro maps the
+ * problem size n to the fastest variant measured on the simulator. Define
+ * PLP_TUNE_FORCE_<name>=<variant> when building the library to use a single variant for all sizes.
+ */
+
+#ifndef __PLP_TUNING_H__
+#define __PLP_TUNING_H__
+
+#if defined(PLP_CONV_SEQUENTIALADDING) && !defined(PLP_TUNE_FORCE_CONV_PARALLEL_OLA)
+#define PLP_TUNE_FORCE_CONV_PARALLEL_OLA 0
+#endif
+
+/* Radix of plp_cfft_f32 (2, 4 or 8) depending on the FFT length (default) */
+#ifdef PLP_TUNE_FORCE_CFFT_F32_RADIX
+#define PLP_TUNE_CFFT_F32_RADIX(n) (PLP_TUNE_FORCE_CFFT_F32_RADIX)
+#else
+#define PLP_TUNE_CFFT_F32_RADIX(n) \
+    ((n) <= 8 ? 2 :    \
+     (n) <= 16 ? 4 :   \
+     (n) <= 32 ? 2 :   \
+     (n) <= 64 ? 8 :   \
+     (n) <= 128 ? 2 :  \
+     (n) <= 256 ? 4 :  \
+     (n) <= 512 ? 8 :  \
+     (n) <= 1024 ? 4 : \
+     2)
+#endif
+
+/* Radix of plp_cfft_f32_parallel (2, 4 or 8) depending on the FFT length (default) */
+#ifdef PLP_TUNE_FORCE_CFFT_F32_PARALLEL_RADIX
+#define PLP_TUNE_CFFT_F32_PARALLEL_RADIX(n) (PLP_TUNE_FORCE_CFFT_F32_PARALLEL_RADIX)
+#else
+#define PLP_TUNE_CFFT_F32_PARALLEL_RADIX(n) \
+    ((n) <= 8 ? 2 :    \
+     (n) <= 16 ? 4 :   \
+     (n) <= 32 ? 2 :   \
+     (n) <= 64 ? 8 :   \
+     (n) <= 128 ? 2 :  \
+     (n) <= 256 ? 4 :  \
+     (n) <= 512 ? 8 :  \
+     (n) <= 1024 ? 4 : \
+     2)
+#endif
+
+/* Combination of the partial results of plp_conv_*_parallel depending on the output length: 1 for
+   parallel overlap-adding, 0 for sequential adding (default) */
+#ifdef PLP_TUNE_FORCE_CONV_PARALLEL_OLA
+#define PLP_TUNE_CONV_PARALLEL_OLA(n) (PLP_TUNE_FORCE_CONV_PARALLEL_OLA)
+#else
+#define PLP_TUNE_CONV_PARALLEL_OLA(n) (1)
+#endif
+
+#endif // __PLP_TUNING_H__
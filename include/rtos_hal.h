@@ -18,11 +18,21 @@ static inline void hal_team_barrier()
   pi_cl_team_barrier(0); 
 }
 
-static inline void hal_cl_team_fork(int nb_cores, void (*entry)(void *), void *arg)
+static inline void hal_cl_team_fork_direct(int nb_cores, void (*entry)(void *), void *arg)
 {
   pi_cl_team_fork(nb_cores, entry, arg);
 }
 
+static inline void hal_team_critical_enter()
+{
+  pi_cl_team_critical_enter();
+}
+
+static inline void hal_team_critical_exit()
+{
+  pi_cl_team_critical_exit();
+}
+
 
 /* MEMORY ALLOCATION */
 
@@ -141,11 +151,21 @@ static inline void hal_team_barrier()
 }
 
 
-static inline void hal_cl_team_fork(int nb_cores, void (*entry)(void *), void *arg)
+static inline void hal_cl_team_fork_direct(int nb_cores, void (*entry)(void *), void *arg)
 {
   rt_team_fork(nb_cores, entry, arg);
 }
 
+static inline void hal_team_critical_enter()
+{
+  rt_team_critical_enter();
+}
+
+static inline void hal_team_critical_exit()
+{
+  rt_team_critical_exit();
+}
+
 
 /* MEMORY ALLOCATION */
 
@@ -245,4 +265,21 @@ static inline unsigned int hal_perf_read(int id)
 
 #endif /* PULP-RT */
 
+
+/* TEAM FORK */
+
+#ifdef PLP_PROFILE
+/* records the per-core counters of the forked kernel, see plp_profile.c */
+void plp_profile_team_fork(int nb_cores, void (*entry)(void *), void *arg);
+#endif
+
+static inline void hal_cl_team_fork(int nb_cores, void (*entry)(void *), void *arg)
+{
+#ifdef PLP_PROFILE
+  plp_profile_team_fork(nb_cores, entry, arg);
+#else
+  hal_cl_team_fork_direct(nb_cores, entry, arg);
+#endif
+}
+
 #endif
@@ -56,6 +56,7 @@
 void plp_abs_i16(const int16_t * pSrc,
                  int16_t * pDst,
                  uint32_t blockSize) {
+    PLP_PROFILE_FUNCTION();
 
     if (hal_cluster_id() == ARCHI_FC_CID) {
       plp_abs_i16s_rv32im(pSrc, pDst, blockSize);
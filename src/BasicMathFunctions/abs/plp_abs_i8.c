@@ -56,6 +56,7 @@
 void plp_abs_i8(const int8_t * pSrc,
                  int8_t * pDst,
                  uint32_t blockSize) {
+    PLP_PROFILE_FUNCTION();
 
     if (hal_cluster_id() == ARCHI_FC_CID) {
       plp_abs_i8s_rv32im(pSrc, pDst, blockSize);
@@ -58,6 +58,7 @@ void plp_add_i16(const int16_t * pSrcA,
                  const int16_t * pSrcB,
                  int32_t * pDst,
                  uint32_t blockSize) {
+    PLP_PROFILE_FUNCTION();
 
     if (hal_cluster_id() == ARCHI_FC_CID) {
       plp_add_i16s_rv32im(pSrcA, pSrcB, pDst, blockSize);
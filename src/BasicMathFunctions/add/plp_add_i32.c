@@ -90,6 +90,7 @@ void plp_add_i32(const int32_t * pSrcA,
                  const int32_t * pSrcB,
                  int32_t * pDst,
                  uint32_t blockSize) {
+    PLP_PROFILE_FUNCTION();
 
     if (hal_cluster_id() == ARCHI_FC_CID) {
       plp_add_i32s_rv32im(pSrcA, pSrcB, pDst, blockSize);
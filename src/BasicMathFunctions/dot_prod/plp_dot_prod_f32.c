@@ -57,6 +57,7 @@ void plp_dot_prod_f32(const float32_t *__restrict__ pSrcA,
                       const float32_t *__restrict__ pSrcB,
                       uint32_t blockSize,
                       float32_t *__restrict__ pRes) {
+    PLP_PROFILE_FUNCTION();
 
     if (hal_cluster_id() == ARCHI_FC_CID) {
         //printf("Note: FC doesn't have FPU\n");
@@ -61,6 +61,7 @@ void plp_dot_prod_i16(const int16_t *__restrict__ pSrcA,
                       const int16_t *__restrict__ pSrcB,
                       uint32_t blockSize,
                       int32_t *__restrict__ pRes) {
+    PLP_PROFILE_FUNCTION();
 
     if (hal_cluster_id() == ARCHI_FC_CID) {
         plp_dot_prod_i16s_rv32im(pSrcA, pSrcB, blockSize, pRes);
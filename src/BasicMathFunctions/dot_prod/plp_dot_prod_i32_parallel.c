@@ -59,6 +59,7 @@ void plp_dot_prod_i32_parallel(const int32_t *__restrict__ pSrcA,
                                uint32_t blockSize,
                                uint32_t nPE,
                                int32_t *__restrict__ pRes) {
+    PLP_PROFILE_FUNCTION();
 
     if (hal_cluster_id() == ARCHI_FC_CID) {
         printf("parallel processing supported only for cluster side\n");
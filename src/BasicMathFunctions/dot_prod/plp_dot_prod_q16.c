@@ -63,6 +63,7 @@ void plp_dot_prod_q16(const int16_t *__restrict__ pSrcA,
                       uint32_t blockSize,
                       uint32_t deciPoint,
                       int32_t *__restrict__ pRes) {
+    PLP_PROFILE_FUNCTION();
 
     if (hal_cluster_id() == ARCHI_FC_CID) {
         plp_dot_prod_q16s_rv32im(pSrcA, pSrcB, blockSize, deciPoint, pRes);
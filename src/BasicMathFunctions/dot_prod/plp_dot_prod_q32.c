@@ -59,6 +59,7 @@ void plp_dot_prod_q32(const int32_t *__restrict__ pSrcA,
                       uint32_t blockSize,
                       uint32_t deciPoint,
                       int32_t *__restrict__ pRes) {
+    PLP_PROFILE_FUNCTION();
 
     if (hal_cluster_id() == ARCHI_FC_CID) {
         plp_dot_prod_q32s_rv32im(pSrcA, pSrcB, blockSize, deciPoint, pRes);
@@ -61,6 +61,7 @@ void plp_dot_prod_q32_parallel(const int32_t *__restrict__ pSrcA,
                                uint32_t deciPoint,
                                uint32_t nPE,
                                int32_t *__restrict__ pRes) {
+    PLP_PROFILE_FUNCTION();
 
     if (hal_cluster_id() == ARCHI_FC_CID) {
         printf("parallel processing supported only for cluster side\n");
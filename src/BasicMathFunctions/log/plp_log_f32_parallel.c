@@ -57,6 +57,7 @@ void plp_log_f32_parallel(const float32_t *__restrict__ pSrc,
                                uint32_t blockSize,
                                uint32_t nPE,
                                float32_t *__restrict__ pDst) {
+    PLP_PROFILE_FUNCTION();
 
     if (rt_cluster_id() == ARCHI_FC_CID) {
         printf("parallel processing supported only for cluster side\n");
@@ -90,6 +90,7 @@ void plp_mult_f32(const float32_t * pSrcA,
                  const float32_t * pSrcB,
                  float32_t * pDst,
                  uint32_t blockSize) {
+    PLP_PROFILE_FUNCTION();
 
     if (rt_cluster_id() == ARCHI_FC_CID) {
       printf("floating point multiplication is not supported on FC.\n");
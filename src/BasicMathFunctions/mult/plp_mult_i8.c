@@ -58,6 +58,7 @@ void plp_mult_i8(const int8_t * pSrcA,
                  const int8_t * pSrcB,
                  int32_t * pDst,
                  uint32_t blockSize) {
+    PLP_PROFILE_FUNCTION();
 
     if (hal_cluster_id() == ARCHI_FC_CID) {
       plp_mult_i8s_rv32im(pSrcA, pSrcB, pDst, blockSize);
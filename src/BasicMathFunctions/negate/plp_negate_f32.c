@@ -48,6 +48,7 @@
  */
 
 void plp_negate_f32(const float32_t * pSrc, float32_t * pDst, uint32_t blockSize) {
+    PLP_PROFILE_FUNCTION();
 
     if (rt_cluster_id() == ARCHI_FC_CID) {
         printf("Floating point is supported only for cluster side\n");
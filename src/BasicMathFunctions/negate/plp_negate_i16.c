@@ -58,6 +58,7 @@
  */
 
 void plp_negate_i16(const int16_t * pSrc, int16_t * pDst, uint32_t blockSize) {
+    PLP_PROFILE_FUNCTION();
 
     if (rt_cluster_id() == ARCHI_FC_CID) {
         plp_negate_i16s_rv32im(pSrc, pDst, blockSize);
@@ -50,6 +50,7 @@
 void plp_negate_i32(const int32_t * pSrc,
                     int32_t * pDst,
                     uint32_t blockSize) {
+    PLP_PROFILE_FUNCTION();
 
     if (rt_cluster_id() == ARCHI_FC_CID) {
         plp_negate_i32s_rv32im(pSrc, pDst, blockSize);
@@ -48,6 +48,7 @@
  */
 
 void plp_negate_i8(const int8_t * pSrc, int8_t * pDst, uint32_t blockSize) {
+    PLP_PROFILE_FUNCTION();
 
     if (rt_cluster_id() == ARCHI_FC_CID) {
         plp_negate_i8s_rv32im(pSrc, pDst, blockSize);
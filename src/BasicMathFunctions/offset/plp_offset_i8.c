@@ -49,6 +49,7 @@
  */
 
 void plp_offset_i8(const int8_t * pSrc,  int8_t offset,  int8_t * pDst, uint32_t blockSize) {
+    PLP_PROFILE_FUNCTION();
 
     if (rt_cluster_id() == ARCHI_FC_CID) {
         plp_offset_i8s_rv32im(pSrc, offset, pDst, blockSize);
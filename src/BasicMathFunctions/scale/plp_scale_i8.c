@@ -50,6 +50,7 @@
  */
 
 void plp_scale_i8(const int8_t *__restrict__ pSrc, int8_t scaleFactor, int32_t shift, int8_t *__restrict__ pDst, uint32_t blockSize) {
+    PLP_PROFILE_FUNCTION();
 
     if (rt_cluster_id() == ARCHI_FC_CID) {
         plp_scale_i8s_rv32im(pSrc, scaleFactor, shift, pDst, blockSize);
@@ -59,6 +59,7 @@
  */
 
 void plp_sub_i16(const int16_t * pSrcA, const int16_t * pSrcB, int32_t * pDst, uint32_t blockSize) {
+    PLP_PROFILE_FUNCTION();
 
     if (rt_cluster_id() == ARCHI_FC_CID) {
         plp_sub_i16s_rv32im(pSrcA, pSrcB, pDst, blockSize);
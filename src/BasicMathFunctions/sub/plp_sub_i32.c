@@ -49,6 +49,7 @@
  */
 
 void plp_sub_i32(const int32_t * pSrcA, const int32_t * pSrcB, int32_t * pDst, uint32_t blockSize) {
+    PLP_PROFILE_FUNCTION();
 
     if (rt_cluster_id() == ARCHI_FC_CID) {
         plp_sub_i32s_rv32im(pSrcA, pSrcB, pDst, blockSize);
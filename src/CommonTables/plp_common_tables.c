@@ -6929,6 +6929,3702 @@ const int32_t twiddleCoef_4096_q32[6144] =
   (int32_t)0x8000277A, (int32_t)0xFFCDBC0A, (int32_t)0x800009DE
 };
 
+/**
+  @par
+  Twiddle factors of the fixed-point DCTs (plp_dct_instance_q16) of length N, which are used for the
+  pre- and post-rotations around the complex FFT of length N/2:
+  @par
+  <pre> for(m = 0; m < 2N; m++)
+  {
+     twiddleCoefDct[2*m]   = cos(m * PI/(4*N));
+     twiddleCoefDct[2*m+1] = sin(m * PI/(4*N));
+  } </pre>
+  @par
+  Convert Floating point to q16(Fixed point 1.15):
+  round(twiddleCoefDct(i) * pow(2, 15)), saturated
+ */
+const int16_t twiddleCoef_dct_32_q16[128] = {
+    (int16_t)0x7FFF, (int16_t)0x0000, (int16_t)0x7FF6, (int16_t)0x0324, (int16_t)0x7FD9,
+    (int16_t)0x0648, (int16_t)0x7FA7, (int16_t)0x096B, (int16_t)0x7F62, (int16_t)0x0C8C,
+    (int16_t)0x7F0A, (int16_t)0x0FAB, (int16_t)0x7E9D, (int16_t)0x12C8, (int16_t)0x7E1E,
+    (int16_t)0x15E2, (int16_t)0x7D8A, (int16_t)0x18F9, (int16_t)0x7CE4, (int16_t)0x1C0C,
+    (int16_t)0x7C2A, (int16_t)0x1F1A, (int16_t)0x7B5D, (int16_t)0x2224, (int16_t)0x7A7D,
+    (int16_t)0x2528, (int16_t)0x798A, (int16_t)0x2827, (int16_t)0x7885, (int16_t)0x2B1F,
+    (int16_t)0x776C, (int16_t)0x2E11, (int16_t)0x7642, (int16_t)0x30FC, (int16_t)0x7505,
+    (int16_t)0x33DF, (int16_t)0x73B6, (int16_t)0x36BA, (int16_t)0x7255, (int16_t)0x398D,
+    (int16_t)0x70E3, (int16_t)0x3C57, (int16_t)0x6F5F, (int16_t)0x3F17, (int16_t)0x6DCA,
+    (int16_t)0x41CE, (int16_t)0x6C24, (int16_t)0x447B, (int16_t)0x6A6E, (int16_t)0x471D,
+    (int16_t)0x68A7, (int16_t)0x49B4, (int16_t)0x66D0, (int16_t)0x4C40, (int16_t)0x64E9,
+    (int16_t)0x4EC0, (int16_t)0x62F2, (int16_t)0x5134, (int16_t)0x60EC, (int16_t)0x539B,
+    (int16_t)0x5ED7, (int16_t)0x55F6, (int16_t)0x5CB4, (int16_t)0x5843, (int16_t)0x5A82,
+    (int16_t)0x5A82, (int16_t)0x5843, (int16_t)0x5CB4, (int16_t)0x55F6, (int16_t)0x5ED7,
+    (int16_t)0x539B, (int16_t)0x60EC, (int16_t)0x5134, (int16_t)0x62F2, (int16_t)0x4EC0,
+    (int16_t)0x64E9, (int16_t)0x4C40, (int16_t)0x66D0, (int16_t)0x49B4, (int16_t)0x68A7,
+    (int16_t)0x471D, (int16_t)0x6A6E, (int16_t)0x447B, (int16_t)0x6C24, (int16_t)0x41CE,
+    (int16_t)0x6DCA, (int16_t)0x3F17, (int16_t)0x6F5F, (int16_t)0x3C57, (int16_t)0x70E3,
+    (int16_t)0x398D, (int16_t)0x7255, (int16_t)0x36BA, (int16_t)0x73B6, (int16_t)0x33DF,
+    (int16_t)0x7505, (int16_t)0x30FC, (int16_t)0x7642, (int16_t)0x2E11, (int16_t)0x776C,
+    (int16_t)0x2B1F, (int16_t)0x7885, (int16_t)0x2827, (int16_t)0x798A, (int16_t)0x2528,
+    (int16_t)0x7A7D, (int16_t)0x2224, (int16_t)0x7B5D, (int16_t)0x1F1A, (int16_t)0x7C2A,
+    (int16_t)0x1C0C, (int16_t)0x7CE4, (int16_t)0x18F9, (int16_t)0x7D8A, (int16_t)0x15E2,
+    (int16_t)0x7E1E, (int16_t)0x12C8, (int16_t)0x7E9D, (int16_t)0x0FAB, (int16_t)0x7F0A,
+    (int16_t)0x0C8C, (int16_t)0x7F62, (int16_t)0x096B, (int16_t)0x7FA7, (int16_t)0x0648,
+    (int16_t)0x7FD9, (int16_t)0x0324, (int16_t)0x7FF6
+};
+
+const int16_t twiddleCoef_dct_64_q16[256] = {
+    (int16_t)0x7FFF, (int16_t)0x0000, (int16_t)0x7FFE, (int16_t)0x0192, (int16_t)0x7FF6,
+    (int16_t)0x0324, (int16_t)0x7FEA, (int16_t)0x04B6, (int16_t)0x7FD9, (int16_t)0x0648,
+    (int16_t)0x7FC2, (int16_t)0x07D9, (int16_t)0x7FA7, (int16_t)0x096B, (int16_t)0x7F87,
+    (int16_t)0x0AFB, (int16_t)0x7F62, (int16_t)0x0C8C, (int16_t)0x7F38, (int16_t)0x0E1C,
+    (int16_t)0x7F0A, (int16_t)0x0FAB, (int16_t)0x7ED6, (int16_t)0x113A, (int16_t)0x7E9D,
+    (int16_t)0x12C8, (int16_t)0x7E60, (int16_t)0x1455, (int16_t)0x7E1E, (int16_t)0x15E2,
+    (int16_t)0x7DD6, (int16_t)0x176E, (int16_t)0x7D8A, (int16_t)0x18F9, (int16_t)0x7D3A,
+    (int16_t)0x1A83, (int16_t)0x7CE4, (int16_t)0x1C0C, (int16_t)0x7C89, (int16_t)0x1D93,
+    (int16_t)0x7C2A, (int16_t)0x1F1A, (int16_t)0x7BC6, (int16_t)0x209F, (int16_t)0x7B5D,
+    (int16_t)0x2224, (int16_t)0x7AEF, (int16_t)0x23A7, (int16_t)0x7A7D, (int16_t)0x2528,
+    (int16_t)0x7A06, (int16_t)0x26A8, (int16_t)0x798A, (int16_t)0x2827, (int16_t)0x790A,
+    (int16_t)0x29A4, (int16_t)0x7885, (int16_t)0x2B1F, (int16_t)0x77FB, (int16_t)0x2C99,
+    (int16_t)0x776C, (int16_t)0x2E11, (int16_t)0x76D9, (int16_t)0x2F87, (int16_t)0x7642,
+    (int16_t)0x30FC, (int16_t)0x75A6, (int16_t)0x326E, (int16_t)0x7505, (int16_t)0x33DF,
+    (int16_t)0x7460, (int16_t)0x354E, (int16_t)0x73B6, (int16_t)0x36BA, (int16_t)0x7308,
+    (int16_t)0x3825, (int16_t)0x7255, (int16_t)0x398D, (int16_t)0x719E, (int16_t)0x3AF3,
+    (int16_t)0x70E3, (int16_t)0x3C57, (int16_t)0x7023, (int16_t)0x3DB8, (int16_t)0x6F5F,
+    (int16_t)0x3F17, (int16_t)0x6E97, (int16_t)0x4074, (int16_t)0x6DCA, (int16_t)0x41CE,
+    (int16_t)0x6CF9, (int16_t)0x4326, (int16_t)0x6C24, (int16_t)0x447B, (int16_t)0x6B4B,
+    (int16_t)0x45CD, (int16_t)0x6A6E, (int16_t)0x471D, (int16_t)0x698C, (int16_t)0x486A,
+    (int16_t)0x68A7, (int16_t)0x49B4, (int16_t)0x67BD, (int16_t)0x4AFB, (int16_t)0x66D0,
+    (int16_t)0x4C40, (int16_t)0x65DE, (int16_t)0x4D81, (int16_t)0x64E9, (int16_t)0x4EC0,
+    (int16_t)0x63EF, (int16_t)0x4FFB, (int16_t)0x62F2, (int16_t)0x5134, (int16_t)0x61F1,
+    (int16_t)0x5269, (int16_t)0x60EC, (int16_t)0x539B, (int16_t)0x5FE4, (int16_t)0x54CA,
+    (int16_t)0x5ED7, (int16_t)0x55F6, (int16_t)0x5DC8, (int16_t)0x571E, (int16_t)0x5CB4,
+    (int16_t)0x5843, (int16_t)0x5B9D, (int16_t)0x5964, (int16_t)0x5A82, (int16_t)0x5A82,
+    (int16_t)0x5964, (int16_t)0x5B9D, (int16_t)0x5843, (int16_t)0x5CB4, (int16_t)0x571E,
+    (int16_t)0x5DC8, (int16_t)0x55F6, (int16_t)0x5ED7, (int16_t)0x54CA, (int16_t)0x5FE4,
+    (int16_t)0x539B, (int16_t)0x60EC, (int16_t)0x5269, (int16_t)0x61F1, (int16_t)0x5134,
+    (int16_t)0x62F2, (int16_t)0x4FFB, (int16_t)0x63EF, (int16_t)0x4EC0, (int16_t)0x64E9,
+    (int16_t)0x4D81, (int16_t)0x65DE, (int16_t)0x4C40, (int16_t)0x66D0, (int16_t)0x4AFB,
+    (int16_t)0x67BD, (int16_t)0x49B4, (int16_t)0x68A7, (int16_t)0x486A, (int16_t)0x698C,
+    (int16_t)0x471D, (int16_t)0x6A6E, (int16_t)0x45CD, (int16_t)0x6B4B, (int16_t)0x447B,
+    (int16_t)0x6C24, (int16_t)0x4326, (int16_t)0x6CF9, (int16_t)0x41CE, (int16_t)0x6DCA,
+    (int16_t)0x4074, (int16_t)0x6E97, (int16_t)0x3F17, (int16_t)0x6F5F, (int16_t)0x3DB8,
+    (int16_t)0x7023, (int16_t)0x3C57, (int16_t)0x70E3, (int16_t)0x3AF3, (int16_t)0x719E,
+    (int16_t)0x398D, (int16_t)0x7255, (int16_t)0x3825, (int16_t)0x7308, (int16_t)0x36BA,
+    (int16_t)0x73B6, (int16_t)0x354E, (int16_t)0x7460, (int16_t)0x33DF, (int16_t)0x7505,
+    (int16_t)0x326E, (int16_t)0x75A6, (int16_t)0x30FC, (int16_t)0x7642, (int16_t)0x2F87,
+    (int16_t)0x76D9, (int16_t)0x2E11, (int16_t)0x776C, (int16_t)0x2C99, (int16_t)0x77FB,
+    (int16_t)0x2B1F, (int16_t)0x7885, (int16_t)0x29A4, (int16_t)0x790A, (int16_t)0x2827,
+    (int16_t)0x798A, (int16_t)0x26A8, (int16_t)0x7A06, (int16_t)0x2528, (int16_t)0x7A7D,
+    (int16_t)0x23A7, (int16_t)0x7AEF, (int16_t)0x2224, (int16_t)0x7B5D, (int16_t)0x209F,
+    (int16_t)0x7BC6, (int16_t)0x1F1A, (int16_t)0x7C2A, (int16_t)0x1D93, (int16_t)0x7C89,
+    (int16_t)0x1C0C, (int16_t)0x7CE4, (int16_t)0x1A83, (int16_t)0x7D3A, (int16_t)0x18F9,
+    (int16_t)0x7D8A, (int16_t)0x176E, (int16_t)0x7DD6, (int16_t)0x15E2, (int16_t)0x7E1E,
+    (int16_t)0x1455, (int16_t)0x7E60, (int16_t)0x12C8, (int16_t)0x7E9D, (int16_t)0x113A,
+    (int16_t)0x7ED6, (int16_t)0x0FAB, (int16_t)0x7F0A, (int16_t)0x0E1C, (int16_t)0x7F38,
+    (int16_t)0x0C8C, (int16_t)0x7F62, (int16_t)0x0AFB, (int16_t)0x7F87, (int16_t)0x096B,
+    (int16_t)0x7FA7, (int16_t)0x07D9, (int16_t)0x7FC2, (int16_t)0x0648, (int16_t)0x7FD9,
+    (int16_t)0x04B6, (int16_t)0x7FEA, (int16_t)0x0324, (int16_t)0x7FF6, (int16_t)0x0192,
+    (int16_t)0x7FFE
+};
+
+const int16_t twiddleCoef_dct_128_q16[512] = {
+    (int16_t)0x7FFF, (int16_t)0x0000, (int16_t)0x7FFF, (int16_t)0x00C9, (int16_t)0x7FFE,
+    (int16_t)0x0192, (int16_t)0x7FFA, (int16_t)0x025B, (int16_t)0x7FF6, (int16_t)0x0324,
+    (int16_t)0x7FF1, (int16_t)0x03ED, (int16_t)0x7FEA, (int16_t)0x04B6, (int16_t)0x7FE2,
+    (int16_t)0x057F, (int16_t)0x7FD9, (int16_t)0x0648, (int16_t)0x7FCE, (int16_t)0x0711,
+    (int16_t)0x7FC2, (int16_t)0x07D9, (int16_t)0x7FB5, (int16_t)0x08A2, (int16_t)0x7FA7,
+    (int16_t)0x096B, (int16_t)0x7F98, (int16_t)0x0A33, (int16_t)0x7F87, (int16_t)0x0AFB,
+    (int16_t)0x7F75, (int16_t)0x0BC4, (int16_t)0x7F62, (int16_t)0x0C8C, (int16_t)0x7F4E,
+    (int16_t)0x0D54, (int16_t)0x7F38, (int16_t)0x0E1C, (int16_t)0x7F22, (int16_t)0x0EE4,
+    (int16_t)0x7F0A, (int16_t)0x0FAB, (int16_t)0x7EF0, (int16_t)0x1073, (int16_t)0x7ED6,
+    (int16_t)0x113A, (int16_t)0x7EBA, (int16_t)0x1201, (int16_t)0x7E9D, (int16_t)0x12C8,
+    (int16_t)0x7E7F, (int16_t)0x138F, (int16_t)0x7E60, (int16_t)0x1455, (int16_t)0x7E3F,
+    (int16_t)0x151C, (int16_t)0x7E1E, (int16_t)0x15E2, (int16_t)0x7DFB, (int16_t)0x16A8,
+    (int16_t)0x7DD6, (int16_t)0x176E, (int16_t)0x7DB1, (int16_t)0x1833, (int16_t)0x7D8A,
+    (int16_t)0x18F9, (int16_t)0x7D63, (int16_t)0x19BE, (int16_t)0x7D3A, (int16_t)0x1A83,
+    (int16_t)0x7D0F, (int16_t)0x1B47, (int16_t)0x7CE4, (int16_t)0x1C0C, (int16_t)0x7CB7,
+    (int16_t)0x1CD0, (int16_t)0x7C89, (int16_t)0x1D93, (int16_t)0x7C5A, (int16_t)0x1E57,
+    (int16_t)0x7C2A, (int16_t)0x1F1A, (int16_t)0x7BF9, (int16_t)0x1FDD, (int16_t)0x7BC6,
+    (int16_t)0x209F, (int16_t)0x7B92, (int16_t)0x2162, (int16_t)0x7B5D, (int16_t)0x2224,
+    (int16_t)0x7B27, (int16_t)0x22E5, (int16_t)0x7AEF, (int16_t)0x23A7, (int16_t)0x7AB7,
+    (int16_t)0x2467, (int16_t)0x7A7D, (int16_t)0x2528, (int16_t)0x7A42, (int16_t)0x25E8,
+    (int16_t)0x7A06, (int16_t)0x26A8, (int16_t)0x79C9, (int16_t)0x2768, (int16_t)0x798A,
+    (int16_t)0x2827, (int16_t)0x794A, (int16_t)0x28E5, (int16_t)0x790A, (int16_t)0x29A4,
+    (int16_t)0x78C8, (int16_t)0x2A62, (int16_t)0x7885, (int16_t)0x2B1F, (int16_t)0x7840,
+    (int16_t)0x2BDC, (int16_t)0x77FB, (int16_t)0x2C99, (int16_t)0x77B4, (int16_t)0x2D55,
+    (int16_t)0x776C, (int16_t)0x2E11, (int16_t)0x7723, (int16_t)0x2ECC, (int16_t)0x76D9,
+    (int16_t)0x2F87, (int16_t)0x768E, (int16_t)0x3042, (int16_t)0x7642, (int16_t)0x30FC,
+    (int16_t)0x75F4, (int16_t)0x31B5, (int16_t)0x75A6, (int16_t)0x326E, (int16_t)0x7556,
+    (int16_t)0x3327, (int16_t)0x7505, (int16_t)0x33DF, (int16_t)0x74B3, (int16_t)0x3497,
+    (int16_t)0x7460, (int16_t)0x354E, (int16_t)0x740B, (int16_t)0x3604, (int16_t)0x73B6,
+    (int16_t)0x36BA, (int16_t)0x735F, (int16_t)0x3770, (int16_t)0x7308, (int16_t)0x3825,
+    (int16_t)0x72AF, (int16_t)0x38D9, (int16_t)0x7255, (int16_t)0x398D, (int16_t)0x71FA,
+    (int16_t)0x3A40, (int16_t)0x719E, (int16_t)0x3AF3, (int16_t)0x7141, (int16_t)0x3BA5,
+    (int16_t)0x70E3, (int16_t)0x3C57, (int16_t)0x7083, (int16_t)0x3D08, (int16_t)0x7023,
+    (int16_t)0x3DB8, (int16_t)0x6FC2, (int16_t)0x3E68, (int16_t)0x6F5F, (int16_t)0x3F17,
+    (int16_t)0x6EFB, (int16_t)0x3FC6, (int16_t)0x6E97, (int16_t)0x4074, (int16_t)0x6E31,
+    (int16_t)0x4121, (int16_t)0x6DCA, (int16_t)0x41CE, (int16_t)0x6D62, (int16_t)0x427A,
+    (int16_t)0x6CF9, (int16_t)0x4326, (int16_t)0x6C8F, (int16_t)0x43D1, (int16_t)0x6C24,
+    (int16_t)0x447B, (int16_t)0x6BB8, (int16_t)0x4524, (int16_t)0x6B4B, (int16_t)0x45CD,
+    (int16_t)0x6ADD, (int16_t)0x4675, (int16_t)0x6A6E, (int16_t)0x471D, (int16_t)0x69FD,
+    (int16_t)0x47C4, (int16_t)0x698C, (int16_t)0x486A, (int16_t)0x691A, (int16_t)0x490F,
+    (int16_t)0x68A7, (int16_t)0x49B4, (int16_t)0x6832, (int16_t)0x4A58, (int16_t)0x67BD,
+    (int16_t)0x4AFB, (int16_t)0x6747, (int16_t)0x4B9E, (int16_t)0x66D0, (int16_t)0x4C40,
+    (int16_t)0x6657, (int16_t)0x4CE1, (int16_t)0x65DE, (int16_t)0x4D81, (int16_t)0x6564,
+    (int16_t)0x4E21, (int16_t)0x64E9, (int16_t)0x4EC0, (int16_t)0x646C, (int16_t)0x4F5E,
+    (int16_t)0x63EF, (int16_t)0x4FFB, (int16_t)0x6371, (int16_t)0x5098, (int16_t)0x62F2,
+    (int16_t)0x5134, (int16_t)0x6272, (int16_t)0x51CF, (int16_t)0x61F1, (int16_t)0x5269,
+    (int16_t)0x616F, (int16_t)0x5303, (int16_t)0x60EC, (int16_t)0x539B, (int16_t)0x6068,
+    (int16_t)0x5433, (int16_t)0x5FE4, (int16_t)0x54CA, (int16_t)0x5F5E, (int16_t)0x5560,
+    (int16_t)0x5ED7, (int16_t)0x55F6, (int16_t)0x5E50, (int16_t)0x568A, (int16_t)0x5DC8,
+    (int16_t)0x571E, (int16_t)0x5D3E, (int16_t)0x57B1, (int16_t)0x5CB4, (int16_t)0x5843,
+    (int16_t)0x5C29, (int16_t)0x58D4, (int16_t)0x5B9D, (int16_t)0x5964, (int16_t)0x5B10,
+    (int16_t)0x59F4, (int16_t)0x5A82, (int16_t)0x5A82, (int16_t)0x59F4, (int16_t)0x5B10,
+    (int16_t)0x5964, (int16_t)0x5B9D, (int16_t)0x58D4, (int16_t)0x5C29, (int16_t)0x5843,
+    (int16_t)0x5CB4, (int16_t)0x57B1, (int16_t)0x5D3E, (int16_t)0x571E, (int16_t)0x5DC8,
+    (int16_t)0x568A, (int16_t)0x5E50, (int16_t)0x55F6, (int16_t)0x5ED7, (int16_t)0x5560,
+    (int16_t)0x5F5E, (int16_t)0x54CA, (int16_t)0x5FE4, (int16_t)0x5433, (int16_t)0x6068,
+    (int16_t)0x539B, (int16_t)0x60EC, (int16_t)0x5303, (int16_t)0x616F, (int16_t)0x5269,
+    (int16_t)0x61F1, (int16_t)0x51CF, (int16_t)0x6272, (int16_t)0x5134, (int16_t)0x62F2,
+    (int16_t)0x5098, (int16_t)0x6371, (int16_t)0x4FFB, (int16_t)0x63EF, (int16_t)0x4F5E,
+    (int16_t)0x646C, (int16_t)0x4EC0, (int16_t)0x64E9, (int16_t)0x4E21, (int16_t)0x6564,
+    (int16_t)0x4D81, (int16_t)0x65DE, (int16_t)0x4CE1, (int16_t)0x6657, (int16_t)0x4C40,
+    (int16_t)0x66D0, (int16_t)0x4B9E, (int16_t)0x6747, (int16_t)0x4AFB, (int16_t)0x67BD,
+    (int16_t)0x4A58, (int16_t)0x6832, (int16_t)0x49B4, (int16_t)0x68A7, (int16_t)0x490F,
+    (int16_t)0x691A, (int16_t)0x486A, (int16_t)0x698C, (int16_t)0x47C4, (int16_t)0x69FD,
+    (int16_t)0x471D, (int16_t)0x6A6E, (int16_t)0x4675, (int16_t)0x6ADD, (int16_t)0x45CD,
+    (int16_t)0x6B4B, (int16_t)0x4524, (int16_t)0x6BB8, (int16_t)0x447B, (int16_t)0x6C24,
+    (int16_t)0x43D1, (int16_t)0x6C8F, (int16_t)0x4326, (int16_t)0x6CF9, (int16_t)0x427A,
+    (int16_t)0x6D62, (int16_t)0x41CE, (int16_t)0x6DCA, (int16_t)0x4121, (int16_t)0x6E31,
+    (int16_t)0x4074, (int16_t)0x6E97, (int16_t)0x3FC6, (int16_t)0x6EFB, (int16_t)0x3F17,
+    (int16_t)0x6F5F, (int16_t)0x3E68, (int16_t)0x6FC2, (int16_t)0x3DB8, (int16_t)0x7023,
+    (int16_t)0x3D08, (int16_t)0x7083, (int16_t)0x3C57, (int16_t)0x70E3, (int16_t)0x3BA5,
+    (int16_t)0x7141, (int16_t)0x3AF3, (int16_t)0x719E, (int16_t)0x3A40, (int16_t)0x71FA,
+    (int16_t)0x398D, (int16_t)0x7255, (int16_t)0x38D9, (int16_t)0x72AF, (int16_t)0x3825,
+    (int16_t)0x7308, (int16_t)0x3770, (int16_t)0x735F, (int16_t)0x36BA, (int16_t)0x73B6,
+    (int16_t)0x3604, (int16_t)0x740B, (int16_t)0x354E, (int16_t)0x7460, (int16_t)0x3497,
+    (int16_t)0x74B3, (int16_t)0x33DF, (int16_t)0x7505, (int16_t)0x3327, (int16_t)0x7556,
+    (int16_t)0x326E, (int16_t)0x75A6, (int16_t)0x31B5, (int16_t)0x75F4, (int16_t)0x30FC,
+    (int16_t)0x7642, (int16_t)0x3042, (int16_t)0x768E, (int16_t)0x2F87, (int16_t)0x76D9,
+    (int16_t)0x2ECC, (int16_t)0x7723, (int16_t)0x2E11, (int16_t)0x776C, (int16_t)0x2D55,
+    (int16_t)0x77B4, (int16_t)0x2C99, (int16_t)0x77FB, (int16_t)0x2BDC, (int16_t)0x7840,
+    (int16_t)0x2B1F, (int16_t)0x7885, (int16_t)0x2A62, (int16_t)0x78C8, (int16_t)0x29A4,
+    (int16_t)0x790A, (int16_t)0x28E5, (int16_t)0x794A, (int16_t)0x2827, (int16_t)0x798A,
+    (int16_t)0x2768, (int16_t)0x79C9, (int16_t)0x26A8, (int16_t)0x7A06, (int16_t)0x25E8,
+    (int16_t)0x7A42, (int16_t)0x2528, (int16_t)0x7A7D, (int16_t)0x2467, (int16_t)0x7AB7,
+    (int16_t)0x23A7, (int16_t)0x7AEF, (int16_t)0x22E5, (int16_t)0x7B27, (int16_t)0x2224,
+    (int16_t)0x7B5D, (int16_t)0x2162, (int16_t)0x7B92, (int16_t)0x209F, (int16_t)0x7BC6,
+    (int16_t)0x1FDD, (int16_t)0x7BF9, (int16_t)0x1F1A, (int16_t)0x7C2A, (int16_t)0x1E57,
+    (int16_t)0x7C5A, (int16_t)0x1D93, (int16_t)0x7C89, (int16_t)0x1CD0, (int16_t)0x7CB7,
+    (int16_t)0x1C0C, (int16_t)0x7CE4, (int16_t)0x1B47, (int16_t)0x7D0F, (int16_t)0x1A83,
+    (int16_t)0x7D3A, (int16_t)0x19BE, (int16_t)0x7D63, (int16_t)0x18F9, (int16_t)0x7D8A,
+    (int16_t)0x1833, (int16_t)0x7DB1, (int16_t)0x176E, (int16_t)0x7DD6, (int16_t)0x16A8,
+    (int16_t)0x7DFB, (int16_t)0x15E2, (int16_t)0x7E1E, (int16_t)0x151C, (int16_t)0x7E3F,
+    (int16_t)0x1455, (int16_t)0x7E60, (int16_t)0x138F, (int16_t)0x7E7F, (int16_t)0x12C8,
+    (int16_t)0x7E9D, (int16_t)0x1201, (int16_t)0x7EBA, (int16_t)0x113A, (int16_t)0x7ED6,
+    (int16_t)0x1073, (int16_t)0x7EF0, (int16_t)0x0FAB, (int16_t)0x7F0A, (int16_t)0x0EE4,
+    (int16_t)0x7F22, (int16_t)0x0E1C, (int16_t)0x7F38, (int16_t)0x0D54, (int16_t)0x7F4E,
+    (int16_t)0x0C8C, (int16_t)0x7F62, (int16_t)0x0BC4, (int16_t)0x7F75, (int16_t)0x0AFB,
+    (int16_t)0x7F87, (int16_t)0x0A33, (int16_t)0x7F98, (int16_t)0x096B, (int16_t)0x7FA7,
+    (int16_t)0x08A2, (int16_t)0x7FB5, (int16_t)0x07D9, (int16_t)0x7FC2, (int16_t)0x0711,
+    (int16_t)0x7FCE, (int16_t)0x0648, (int16_t)0x7FD9, (int16_t)0x057F, (int16_t)0x7FE2,
+    (int16_t)0x04B6, (int16_t)0x7FEA, (int16_t)0x03ED, (int16_t)0x7FF1, (int16_t)0x0324,
+    (int16_t)0x7FF6, (int16_t)0x025B, (int16_t)0x7FFA, (int16_t)0x0192, (int16_t)0x7FFE,
+    (int16_t)0x00C9, (int16_t)0x7FFF
+};
+
+const int16_t twiddleCoef_dct_256_q16[1024] = {
+    (int16_t)0x7FFF, (int16_t)0x0000, (int16_t)0x7FFF, (int16_t)0x0065, (int16_t)0x7FFF,
+    (int16_t)0x00C9, (int16_t)0x7FFF, (int16_t)0x012E, (int16_t)0x7FFE, (int16_t)0x0192,
+    (int16_t)0x7FFC, (int16_t)0x01F7, (int16_t)0x7FFA, (int16_t)0x025B, (int16_t)0x7FF8,
+    (int16_t)0x02C0, (int16_t)0x7FF6, (int16_t)0x0324, (int16_t)0x7FF4, (int16_t)0x0389,
+    (int16_t)0x7FF1, (int16_t)0x03ED, (int16_t)0x7FED, (int16_t)0x0452, (int16_t)0x7FEA,
+    (int16_t)0x04B6, (int16_t)0x7FE6, (int16_t)0x051B, (int16_t)0x7FE2, (int16_t)0x057F,
+    (int16_t)0x7FDD, (int16_t)0x05E3, (int16_t)0x7FD9, (int16_t)0x0648, (int16_t)0x7FD3,
+    (int16_t)0x06AC, (int16_t)0x7FCE, (int16_t)0x0711, (int16_t)0x7FC8, (int16_t)0x0775,
+    (int16_t)0x7FC2, (int16_t)0x07D9, (int16_t)0x7FBC, (int16_t)0x083E, (int16_t)0x7FB5,
+    (int16_t)0x08A2, (int16_t)0x7FAE, (int16_t)0x0906, (int16_t)0x7FA7, (int16_t)0x096B,
+    (int16_t)0x7FA0, (int16_t)0x09CF, (int16_t)0x7F98, (int16_t)0x0A33, (int16_t)0x7F90,
+    (int16_t)0x0A97, (int16_t)0x7F87, (int16_t)0x0AFB, (int16_t)0x7F7E, (int16_t)0x0B60,
+    (int16_t)0x7F75, (int16_t)0x0BC4, (int16_t)0x7F6C, (int16_t)0x0C28, (int16_t)0x7F62,
+    (int16_t)0x0C8C, (int16_t)0x7F58, (int16_t)0x0CF0, (int16_t)0x7F4E, (int16_t)0x0D54,
+    (int16_t)0x7F43, (int16_t)0x0DB8, (int16_t)0x7F38, (int16_t)0x0E1C, (int16_t)0x7F2D,
+    (int16_t)0x0E80, (int16_t)0x7F22, (int16_t)0x0EE4, (int16_t)0x7F16, (int16_t)0x0F47,
+    (int16_t)0x7F0A, (int16_t)0x0FAB, (int16_t)0x7EFD, (int16_t)0x100F, (int16_t)0x7EF0,
+    (int16_t)0x1073, (int16_t)0x7EE3, (int16_t)0x10D6, (int16_t)0x7ED6, (int16_t)0x113A,
+    (int16_t)0x7EC8, (int16_t)0x119E, (int16_t)0x7EBA, (int16_t)0x1201, (int16_t)0x7EAC,
+    (int16_t)0x1265, (int16_t)0x7E9D, (int16_t)0x12C8, (int16_t)0x7E8E, (int16_t)0x132B,
+    (int16_t)0x7E7F, (int16_t)0x138F, (int16_t)0x7E70, (int16_t)0x13F2, (int16_t)0x7E60,
+    (int16_t)0x1455, (int16_t)0x7E50, (int16_t)0x14B9, (int16_t)0x7E3F, (int16_t)0x151C,
+    (int16_t)0x7E2F, (int16_t)0x157F, (int16_t)0x7E1E, (int16_t)0x15E2, (int16_t)0x7E0C,
+    (int16_t)0x1645, (int16_t)0x7DFB, (int16_t)0x16A8, (int16_t)0x7DE9, (int16_t)0x170B,
+    (int16_t)0x7DD6, (int16_t)0x176E, (int16_t)0x7DC4, (int16_t)0x17D1, (int16_t)0x7DB1,
+    (int16_t)0x1833, (int16_t)0x7D9E, (int16_t)0x1896, (int16_t)0x7D8A, (int16_t)0x18F9,
+    (int16_t)0x7D77, (int16_t)0x195B, (int16_t)0x7D63, (int16_t)0x19BE, (int16_t)0x7D4E,
+    (int16_t)0x1A20, (int16_t)0x7D3A, (int16_t)0x1A83, (int16_t)0x7D25, (int16_t)0x1AE5,
+    (int16_t)0x7D0F, (int16_t)0x1B47, (int16_t)0x7CFA, (int16_t)0x1BA9, (int16_t)0x7CE4,
+    (int16_t)0x1C0C, (int16_t)0x7CCE, (int16_t)0x1C6E, (int16_t)0x7CB7, (int16_t)0x1CD0,
+    (int16_t)0x7CA0, (int16_t)0x1D31, (int16_t)0x7C89, (int16_t)0x1D93, (int16_t)0x7C72,
+    (int16_t)0x1DF5, (int16_t)0x7C5A, (int16_t)0x1E57, (int16_t)0x7C42, (int16_t)0x1EB8,
+    (int16_t)0x7C2A, (int16_t)0x1F1A, (int16_t)0x7C11, (int16_t)0x1F7B, (int16_t)0x7BF9,
+    (int16_t)0x1FDD, (int16_t)0x7BDF, (int16_t)0x203E, (int16_t)0x7BC6, (int16_t)0x209F,
+    (int16_t)0x7BAC, (int16_t)0x2101, (int16_t)0x7B92, (int16_t)0x2162, (int16_t)0x7B78,
+    (int16_t)0x21C3, (int16_t)0x7B5D, (int16_t)0x2224, (int16_t)0x7B42, (int16_t)0x2284,
+    (int16_t)0x7B27, (int16_t)0x22E5, (int16_t)0x7B0B, (int16_t)0x2346, (int16_t)0x7AEF,
+    (int16_t)0x23A7, (int16_t)0x7AD3, (int16_t)0x2407, (int16_t)0x7AB7, (int16_t)0x2467,
+    (int16_t)0x7A9A, (int16_t)0x24C8, (int16_t)0x7A7D, (int16_t)0x2528, (int16_t)0x7A60,
+    (int16_t)0x2588, (int16_t)0x7A42, (int16_t)0x25E8, (int16_t)0x7A24, (int16_t)0x2648,
+    (int16_t)0x7A06, (int16_t)0x26A8, (int16_t)0x79E7, (int16_t)0x2708, (int16_t)0x79C9,
+    (int16_t)0x2768, (int16_t)0x79AA, (int16_t)0x27C7, (int16_t)0x798A, (int16_t)0x2827,
+    (int16_t)0x796A, (int16_t)0x2886, (int16_t)0x794A, (int16_t)0x28E5, (int16_t)0x792A,
+    (int16_t)0x2945, (int16_t)0x790A, (int16_t)0x29A4, (int16_t)0x78E9, (int16_t)0x2A03,
+    (int16_t)0x78C8, (int16_t)0x2A62, (int16_t)0x78A6, (int16_t)0x2AC1, (int16_t)0x7885,
+    (int16_t)0x2B1F, (int16_t)0x7863, (int16_t)0x2B7E, (int16_t)0x7840, (int16_t)0x2BDC,
+    (int16_t)0x781E, (int16_t)0x2C3B, (int16_t)0x77FB, (int16_t)0x2C99, (int16_t)0x77D8,
+    (int16_t)0x2CF7, (int16_t)0x77B4, (int16_t)0x2D55, (int16_t)0x7790, (int16_t)0x2DB3,
+    (int16_t)0x776C, (int16_t)0x2E11, (int16_t)0x7748, (int16_t)0x2E6F, (int16_t)0x7723,
+    (int16_t)0x2ECC, (int16_t)0x76FE, (int16_t)0x2F2A, (int16_t)0x76D9, (int16_t)0x2F87,
+    (int16_t)0x76B4, (int16_t)0x2FE5, (int16_t)0x768E, (int16_t)0x3042, (int16_t)0x7668,
+    (int16_t)0x309F, (int16_t)0x7642, (int16_t)0x30FC, (int16_t)0x761B, (int16_t)0x3159,
+    (int16_t)0x75F4, (int16_t)0x31B5, (int16_t)0x75CD, (int16_t)0x3212, (int16_t)0x75A6,
+    (int16_t)0x326E, (int16_t)0x757E, (int16_t)0x32CB, (int16_t)0x7556, (int16_t)0x3327,
+    (int16_t)0x752D, (int16_t)0x3383, (int16_t)0x7505, (int16_t)0x33DF, (int16_t)0x74DC,
+    (int16_t)0x343B, (int16_t)0x74B3, (int16_t)0x3497, (int16_t)0x7489, (int16_t)0x34F2,
+    (int16_t)0x7460, (int16_t)0x354E, (int16_t)0x7436, (int16_t)0x35A9, (int16_t)0x740B,
+    (int16_t)0x3604, (int16_t)0x73E1, (int16_t)0x365F, (int16_t)0x73B6, (int16_t)0x36BA,
+    (int16_t)0x738B, (int16_t)0x3715, (int16_t)0x735F, (int16_t)0x3770, (int16_t)0x7334,
+    (int16_t)0x37CA, (int16_t)0x7308, (int16_t)0x3825, (int16_t)0x72DC, (int16_t)0x387F,
+    (int16_t)0x72AF, (int16_t)0x38D9, (int16_t)0x7282, (int16_t)0x3933, (int16_t)0x7255,
+    (int16_t)0x398D, (int16_t)0x7228, (int16_t)0x39E7, (int16_t)0x71FA, (int16_t)0x3A40,
+    (int16_t)0x71CC, (int16_t)0x3A9A, (int16_t)0x719E, (int16_t)0x3AF3, (int16_t)0x7170,
+    (int16_t)0x3B4C, (int16_t)0x7141, (int16_t)0x3BA5, (int16_t)0x7112, (int16_t)0x3BFE,
+    (int16_t)0x70E3, (int16_t)0x3C57, (int16_t)0x70B3, (int16_t)0x3CAF, (int16_t)0x7083,
+    (int16_t)0x3D08, (int16_t)0x7053, (int16_t)0x3D60, (int16_t)0x7023, (int16_t)0x3DB8,
+    (int16_t)0x6FF2, (int16_t)0x3E10, (int16_t)0x6FC2, (int16_t)0x3E68, (int16_t)0x6F90,
+    (int16_t)0x3EC0, (int16_t)0x6F5F, (int16_t)0x3F17, (int16_t)0x6F2D, (int16_t)0x3F6F,
+    (int16_t)0x6EFB, (int16_t)0x3FC6, (int16_t)0x6EC9, (int16_t)0x401D, (int16_t)0x6E97,
+    (int16_t)0x4074, (int16_t)0x6E64, (int16_t)0x40CB, (int16_t)0x6E31, (int16_t)0x4121,
+    (int16_t)0x6DFE, (int16_t)0x4178, (int16_t)0x6DCA, (int16_t)0x41CE, (int16_t)0x6D96,
+    (int16_t)0x4224, (int16_t)0x6D62, (int16_t)0x427A, (int16_t)0x6D2E, (int16_t)0x42D0,
+    (int16_t)0x6CF9, (int16_t)0x4326, (int16_t)0x6CC4, (int16_t)0x437B, (int16_t)0x6C8F,
+    (int16_t)0x43D1, (int16_t)0x6C5A, (int16_t)0x4426, (int16_t)0x6C24, (int16_t)0x447B,
+    (int16_t)0x6BEE, (int16_t)0x44D0, (int16_t)0x6BB8, (int16_t)0x4524, (int16_t)0x6B82,
+    (int16_t)0x4579, (int16_t)0x6B4B, (int16_t)0x45CD, (int16_t)0x6B14, (int16_t)0x4621,
+    (int16_t)0x6ADD, (int16_t)0x4675, (int16_t)0x6AA5, (int16_t)0x46C9, (int16_t)0x6A6E,
+    (int16_t)0x471D, (int16_t)0x6A36, (int16_t)0x4770, (int16_t)0x69FD, (int16_t)0x47C4,
+    (int16_t)0x69C5, (int16_t)0x4817, (int16_t)0x698C, (int16_t)0x486A, (int16_t)0x6953,
+    (int16_t)0x48BD, (int16_t)0x691A, (int16_t)0x490F, (int16_t)0x68E0, (int16_t)0x4962,
+    (int16_t)0x68A7, (int16_t)0x49B4, (int16_t)0x686D, (int16_t)0x4A06, (int16_t)0x6832,
+    (int16_t)0x4A58, (int16_t)0x67F8, (int16_t)0x4AAA, (int16_t)0x67BD, (int16_t)0x4AFB,
+    (int16_t)0x6782, (int16_t)0x4B4D, (int16_t)0x6747, (int16_t)0x4B9E, (int16_t)0x670B,
+    (int16_t)0x4BEF, (int16_t)0x66D0, (int16_t)0x4C40, (int16_t)0x6693, (int16_t)0x4C91,
+    (int16_t)0x6657, (int16_t)0x4CE1, (int16_t)0x661B, (int16_t)0x4D31, (int16_t)0x65DE,
+    (int16_t)0x4D81, (int16_t)0x65A1, (int16_t)0x4DD1, (int16_t)0x6564, (int16_t)0x4E21,
+    (int16_t)0x6526, (int16_t)0x4E71, (int16_t)0x64E9, (int16_t)0x4EC0, (int16_t)0x64AB,
+    (int16_t)0x4F0F, (int16_t)0x646C, (int16_t)0x4F5E, (int16_t)0x642E, (int16_t)0x4FAD,
+    (int16_t)0x63EF, (int16_t)0x4FFB, (int16_t)0x63B0, (int16_t)0x504A, (int16_t)0x6371,
+    (int16_t)0x5098, (int16_t)0x6332, (int16_t)0x50E6, (int16_t)0x62F2, (int16_t)0x5134,
+    (int16_t)0x62B2, (int16_t)0x5181, (int16_t)0x6272, (int16_t)0x51CF, (int16_t)0x6232,
+    (int16_t)0x521C, (int16_t)0x61F1, (int16_t)0x5269, (int16_t)0x61B0, (int16_t)0x52B6,
+    (int16_t)0x616F, (int16_t)0x5303, (int16_t)0x612E, (int16_t)0x534F, (int16_t)0x60EC,
+    (int16_t)0x539B, (int16_t)0x60AA, (int16_t)0x53E7, (int16_t)0x6068, (int16_t)0x5433,
+    (int16_t)0x6026, (int16_t)0x547F, (int16_t)0x5FE4, (int16_t)0x54CA, (int16_t)0x5FA1,
+    (int16_t)0x5515, (int16_t)0x5F5E, (int16_t)0x5560, (int16_t)0x5F1B, (int16_t)0x55AB,
+    (int16_t)0x5ED7, (int16_t)0x55F6, (int16_t)0x5E94, (int16_t)0x5640, (int16_t)0x5E50,
+    (int16_t)0x568A, (int16_t)0x5E0C, (int16_t)0x56D4, (int16_t)0x5DC8, (int16_t)0x571E,
+    (int16_t)0x5D83, (int16_t)0x5767, (int16_t)0x5D3E, (int16_t)0x57B1, (int16_t)0x5CF9,
+    (int16_t)0x57FA, (int16_t)0x5CB4, (int16_t)0x5843, (int16_t)0x5C6F, (int16_t)0x588C,
+    (int16_t)0x5C29, (int16_t)0x58D4, (int16_t)0x5BE3, (int16_t)0x591C, (int16_t)0x5B9D,
+    (int16_t)0x5964, (int16_t)0x5B57, (int16_t)0x59AC, (int16_t)0x5B10, (int16_t)0x59F4,
+    (int16_t)0x5AC9, (int16_t)0x5A3B, (int16_t)0x5A82, (int16_t)0x5A82, (int16_t)0x5A3B,
+    (int16_t)0x5AC9, (int16_t)0x59F4, (int16_t)0x5B10, (int16_t)0x59AC, (int16_t)0x5B57,
+    (int16_t)0x5964, (int16_t)0x5B9D, (int16_t)0x591C, (int16_t)0x5BE3, (int16_t)0x58D4,
+    (int16_t)0x5C29, (int16_t)0x588C, (int16_t)0x5C6F, (int16_t)0x5843, (int16_t)0x5CB4,
+    (int16_t)0x57FA, (int16_t)0x5CF9, (int16_t)0x57B1, (int16_t)0x5D3E, (int16_t)0x5767,
+    (int16_t)0x5D83, (int16_t)0x571E, (int16_t)0x5DC8, (int16_t)0x56D4, (int16_t)0x5E0C,
+    (int16_t)0x568A, (int16_t)0x5E50, (int16_t)0x5640, (int16_t)0x5E94, (int16_t)0x55F6,
+    (int16_t)0x5ED7, (int16_t)0x55AB, (int16_t)0x5F1B, (int16_t)0x5560, (int16_t)0x5F5E,
+    (int16_t)0x5515, (int16_t)0x5FA1, (int16_t)0x54CA, (int16_t)0x5FE4, (int16_t)0x547F,
+    (int16_t)0x6026, (int16_t)0x5433, (int16_t)0x6068, (int16_t)0x53E7, (int16_t)0x60AA,
+    (int16_t)0x539B, (int16_t)0x60EC, (int16_t)0x534F, (int16_t)0x612E, (int16_t)0x5303,
+    (int16_t)0x616F, (int16_t)0x52B6, (int16_t)0x61B0, (int16_t)0x5269, (int16_t)0x61F1,
+    (int16_t)0x521C, (int16_t)0x6232, (int16_t)0x51CF, (int16_t)0x6272, (int16_t)0x5181,
+    (int16_t)0x62B2, (int16_t)0x5134, (int16_t)0x62F2, (int16_t)0x50E6, (int16_t)0x6332,
+    (int16_t)0x5098, (int16_t)0x6371, (int16_t)0x504A, (int16_t)0x63B0, (int16_t)0x4FFB,
+    (int16_t)0x63EF, (int16_t)0x4FAD, (int16_t)0x642E, (int16_t)0x4F5E, (int16_t)0x646C,
+    (int16_t)0x4F0F, (int16_t)0x64AB, (int16_t)0x4EC0, (int16_t)0x64E9, (int16_t)0x4E71,
+    (int16_t)0x6526, (int16_t)0x4E21, (int16_t)0x6564, (int16_t)0x4DD1, (int16_t)0x65A1,
+    (int16_t)0x4D81, (int16_t)0x65DE, (int16_t)0x4D31, (int16_t)0x661B, (int16_t)0x4CE1,
+    (int16_t)0x6657, (int16_t)0x4C91, (int16_t)0x6693, (int16_t)0x4C40, (int16_t)0x66D0,
+    (int16_t)0x4BEF, (int16_t)0x670B, (int16_t)0x4B9E, (int16_t)0x6747, (int16_t)0x4B4D,
+    (int16_t)0x6782, (int16_t)0x4AFB, (int16_t)0x67BD, (int16_t)0x4AAA, (int16_t)0x67F8,
+    (int16_t)0x4A58, (int16_t)0x6832, (int16_t)0x4A06, (int16_t)0x686D, (int16_t)0x49B4,
+    (int16_t)0x68A7, (int16_t)0x4962, (int16_t)0x68E0, (int16_t)0x490F, (int16_t)0x691A,
+    (int16_t)0x48BD, (int16_t)0x6953, (int16_t)0x486A, (int16_t)0x698C, (int16_t)0x4817,
+    (int16_t)0x69C5, (int16_t)0x47C4, (int16_t)0x69FD, (int16_t)0x4770, (int16_t)0x6A36,
+    (int16_t)0x471D, (int16_t)0x6A6E, (int16_t)0x46C9, (int16_t)0x6AA5, (int16_t)0x4675,
+    (int16_t)0x6ADD, (int16_t)0x4621, (int16_t)0x6B14, (int16_t)0x45CD, (int16_t)0x6B4B,
+    (int16_t)0x4579, (int16_t)0x6B82, (int16_t)0x4524, (int16_t)0x6BB8, (int16_t)0x44D0,
+    (int16_t)0x6BEE, (int16_t)0x447B, (int16_t)0x6C24, (int16_t)0x4426, (int16_t)0x6C5A,
+    (int16_t)0x43D1, (int16_t)0x6C8F, (int16_t)0x437B, (int16_t)0x6CC4, (int16_t)0x4326,
+    (int16_t)0x6CF9, (int16_t)0x42D0, (int16_t)0x6D2E, (int16_t)0x427A, (int16_t)0x6D62,
+    (int16_t)0x4224, (int16_t)0x6D96, (int16_t)0x41CE, (int16_t)0x6DCA, (int16_t)0x4178,
+    (int16_t)0x6DFE, (int16_t)0x4121, (int16_t)0x6E31, (int16_t)0x40CB, (int16_t)0x6E64,
+    (int16_t)0x4074, (int16_t)0x6E97, (int16_t)0x401D, (int16_t)0x6EC9, (int16_t)0x3FC6,
+    (int16_t)0x6EFB, (int16_t)0x3F6F, (int16_t)0x6F2D, (int16_t)0x3F17, (int16_t)0x6F5F,
+    (int16_t)0x3EC0, (int16_t)0x6F90, (int16_t)0x3E68, (int16_t)0x6FC2, (int16_t)0x3E10,
+    (int16_t)0x6FF2, (int16_t)0x3DB8, (int16_t)0x7023, (int16_t)0x3D60, (int16_t)0x7053,
+    (int16_t)0x3D08, (int16_t)0x7083, (int16_t)0x3CAF, (int16_t)0x70B3, (int16_t)0x3C57,
+    (int16_t)0x70E3, (int16_t)0x3BFE, (int16_t)0x7112, (int16_t)0x3BA5, (int16_t)0x7141,
+    (int16_t)0x3B4C, (int16_t)0x7170, (int16_t)0x3AF3, (int16_t)0x719E, (int16_t)0x3A9A,
+    (int16_t)0x71CC, (int16_t)0x3A40, (int16_t)0x71FA, (int16_t)0x39E7, (int16_t)0x7228,
+    (int16_t)0x398D, (int16_t)0x7255, (int16_t)0x3933, (int16_t)0x7282, (int16_t)0x38D9,
+    (int16_t)0x72AF, (int16_t)0x387F, (int16_t)0x72DC, (int16_t)0x3825, (int16_t)0x7308,
+    (int16_t)0x37CA, (int16_t)0x7334, (int16_t)0x3770, (int16_t)0x735F, (int16_t)0x3715,
+    (int16_t)0x738B, (int16_t)0x36BA, (int16_t)0x73B6, (int16_t)0x365F, (int16_t)0x73E1,
+    (int16_t)0x3604, (int16_t)0x740B, (int16_t)0x35A9, (int16_t)0x7436, (int16_t)0x354E,
+    (int16_t)0x7460, (int16_t)0x34F2, (int16_t)0x7489, (int16_t)0x3497, (int16_t)0x74B3,
+    (int16_t)0x343B, (int16_t)0x74DC, (int16_t)0x33DF, (int16_t)0x7505, (int16_t)0x3383,
+    (int16_t)0x752D, (int16_t)0x3327, (int16_t)0x7556, (int16_t)0x32CB, (int16_t)0x757E,
+    (int16_t)0x326E, (int16_t)0x75A6, (int16_t)0x3212, (int16_t)0x75CD, (int16_t)0x31B5,
+    (int16_t)0x75F4, (int16_t)0x3159, (int16_t)0x761B, (int16_t)0x30FC, (int16_t)0x7642,
+    (int16_t)0x309F, (int16_t)0x7668, (int16_t)0x3042, (int16_t)0x768E, (int16_t)0x2FE5,
+    (int16_t)0x76B4, (int16_t)0x2F87, (int16_t)0x76D9, (int16_t)0x2F2A, (int16_t)0x76FE,
+    (int16_t)0x2ECC, (int16_t)0x7723, (int16_t)0x2E6F, (int16_t)0x7748, (int16_t)0x2E11,
+    (int16_t)0x776C, (int16_t)0x2DB3, (int16_t)0x7790, (int16_t)0x2D55, (int16_t)0x77B4,
+    (int16_t)0x2CF7, (int16_t)0x77D8, (int16_t)0x2C99, (int16_t)0x77FB, (int16_t)0x2C3B,
+    (int16_t)0x781E, (int16_t)0x2BDC, (int16_t)0x7840, (int16_t)0x2B7E, (int16_t)0x7863,
+    (int16_t)0x2B1F, (int16_t)0x7885, (int16_t)0x2AC1, (int16_t)0x78A6, (int16_t)0x2A62,
+    (int16_t)0x78C8, (int16_t)0x2A03, (int16_t)0x78E9, (int16_t)0x29A4, (int16_t)0x790A,
+    (int16_t)0x2945, (int16_t)0x792A, (int16_t)0x28E5, (int16_t)0x794A, (int16_t)0x2886,
+    (int16_t)0x796A, (int16_t)0x2827, (int16_t)0x798A, (int16_t)0x27C7, (int16_t)0x79AA,
+    (int16_t)0x2768, (int16_t)0x79C9, (int16_t)0x2708, (int16_t)0x79E7, (int16_t)0x26A8,
+    (int16_t)0x7A06, (int16_t)0x2648, (int16_t)0x7A24, (int16_t)0x25E8, (int16_t)0x7A42,
+    (int16_t)0x2588, (int16_t)0x7A60, (int16_t)0x2528, (int16_t)0x7A7D, (int16_t)0x24C8,
+    (int16_t)0x7A9A, (int16_t)0x2467, (int16_t)0x7AB7, (int16_t)0x2407, (int16_t)0x7AD3,
+    (int16_t)0x23A7, (int16_t)0x7AEF, (int16_t)0x2346, (int16_t)0x7B0B, (int16_t)0x22E5,
+    (int16_t)0x7B27, (int16_t)0x2284, (int16_t)0x7B42, (int16_t)0x2224, (int16_t)0x7B5D,
+    (int16_t)0x21C3, (int16_t)0x7B78, (int16_t)0x2162, (int16_t)0x7B92, (int16_t)0x2101,
+    (int16_t)0x7BAC, (int16_t)0x209F, (int16_t)0x7BC6, (int16_t)0x203E, (int16_t)0x7BDF,
+    (int16_t)0x1FDD, (int16_t)0x7BF9, (int16_t)0x1F7B, (int16_t)0x7C11, (int16_t)0x1F1A,
+    (int16_t)0x7C2A, (int16_t)0x1EB8, (int16_t)0x7C42, (int16_t)0x1E57, (int16_t)0x7C5A,
+    (int16_t)0x1DF5, (int16_t)0x7C72, (int16_t)0x1D93, (int16_t)0x7C89, (int16_t)0x1D31,
+    (int16_t)0x7CA0, (int16_t)0x1CD0, (int16_t)0x7CB7, (int16_t)0x1C6E, (int16_t)0x7CCE,
+    (int16_t)0x1C0C, (int16_t)0x7CE4, (int16_t)0x1BA9, (int16_t)0x7CFA, (int16_t)0x1B47,
+    (int16_t)0x7D0F, (int16_t)0x1AE5, (int16_t)0x7D25, (int16_t)0x1A83, (int16_t)0x7D3A,
+    (int16_t)0x1A20, (int16_t)0x7D4E, (int16_t)0x19BE, (int16_t)0x7D63, (int16_t)0x195B,
+    (int16_t)0x7D77, (int16_t)0x18F9, (int16_t)0x7D8A, (int16_t)0x1896, (int16_t)0x7D9E,
+    (int16_t)0x1833, (int16_t)0x7DB1, (int16_t)0x17D1, (int16_t)0x7DC4, (int16_t)0x176E,
+    (int16_t)0x7DD6, (int16_t)0x170B, (int16_t)0x7DE9, (int16_t)0x16A8, (int16_t)0x7DFB,
+    (int16_t)0x1645, (int16_t)0x7E0C, (int16_t)0x15E2, (int16_t)0x7E1E, (int16_t)0x157F,
+    (int16_t)0x7E2F, (int16_t)0x151C, (int16_t)0x7E3F, (int16_t)0x14B9, (int16_t)0x7E50,
+    (int16_t)0x1455, (int16_t)0x7E60, (int16_t)0x13F2, (int16_t)0x7E70, (int16_t)0x138F,
+    (int16_t)0x7E7F, (int16_t)0x132B, (int16_t)0x7E8E, (int16_t)0x12C8, (int16_t)0x7E9D,
+    (int16_t)0x1265, (int16_t)0x7EAC, (int16_t)0x1201, (int16_t)0x7EBA, (int16_t)0x119E,
+    (int16_t)0x7EC8, (int16_t)0x113A, (int16_t)0x7ED6, (int16_t)0x10D6, (int16_t)0x7EE3,
+    (int16_t)0x1073, (int16_t)0x7EF0, (int16_t)0x100F, (int16_t)0x7EFD, (int16_t)0x0FAB,
+    (int16_t)0x7F0A, (int16_t)0x0F47, (int16_t)0x7F16, (int16_t)0x0EE4, (int16_t)0x7F22,
+    (int16_t)0x0E80, (int16_t)0x7F2D, (int16_t)0x0E1C, (int16_t)0x7F38, (int16_t)0x0DB8,
+    (int16_t)0x7F43, (int16_t)0x0D54, (int16_t)0x7F4E, (int16_t)0x0CF0, (int16_t)0x7F58,
+    (int16_t)0x0C8C, (int16_t)0x7F62, (int16_t)0x0C28, (int16_t)0x7F6C, (int16_t)0x0BC4,
+    (int16_t)0x7F75, (int16_t)0x0B60, (int16_t)0x7F7E, (int16_t)0x0AFB, (int16_t)0x7F87,
+    (int16_t)0x0A97, (int16_t)0x7F90, (int16_t)0x0A33, (int16_t)0x7F98, (int16_t)0x09CF,
+    (int16_t)0x7FA0, (int16_t)0x096B, (int16_t)0x7FA7, (int16_t)0x0906, (int16_t)0x7FAE,
+    (int16_t)0x08A2, (int16_t)0x7FB5, (int16_t)0x083E, (int16_t)0x7FBC, (int16_t)0x07D9,
+    (int16_t)0x7FC2, (int16_t)0x0775, (int16_t)0x7FC8, (int16_t)0x0711, (int16_t)0x7FCE,
+    (int16_t)0x06AC, (int16_t)0x7FD3, (int16_t)0x0648, (int16_t)0x7FD9, (int16_t)0x05E3,
+    (int16_t)0x7FDD, (int16_t)0x057F, (int16_t)0x7FE2, (int16_t)0x051B, (int16_t)0x7FE6,
+    (int16_t)0x04B6, (int16_t)0x7FEA, (int16_t)0x0452, (int16_t)0x7FED, (int16_t)0x03ED,
+    (int16_t)0x7FF1, (int16_t)0x0389, (int16_t)0x7FF4, (int16_t)0x0324, (int16_t)0x7FF6,
+    (int16_t)0x02C0, (int16_t)0x7FF8, (int16_t)0x025B, (int16_t)0x7FFA, (int16_t)0x01F7,
+    (int16_t)0x7FFC, (int16_t)0x0192, (int16_t)0x7FFE, (int16_t)0x012E, (int16_t)0x7FFF,
+    (int16_t)0x00C9, (int16_t)0x7FFF, (int16_t)0x0065, (int16_t)0x7FFF
+};
+
+const int16_t twiddleCoef_dct_512_q16[2048] = {
+    (int16_t)0x7FFF, (int16_t)0x0000, (int16_t)0x7FFF, (int16_t)0x0032, (int16_t)0x7FFF,
+    (int16_t)0x0065, (int16_t)0x7FFF, (int16_t)0x0097, (int16_t)0x7FFF, (int16_t)0x00C9,
+    (int16_t)0x7FFF, (int16_t)0x00FB, (int16_t)0x7FFF, (int16_t)0x012E, (int16_t)0x7FFE,
+    (int16_t)0x0160, (int16_t)0x7FFE, (int16_t)0x0192, (int16_t)0x7FFD, (int16_t)0x01C4,
+    (int16_t)0x7FFC, (int16_t)0x01F7, (int16_t)0x7FFB, (int16_t)0x0229, (int16_t)0x7FFA,
+    (int16_t)0x025B, (int16_t)0x7FF9, (int16_t)0x028D, (int16_t)0x7FF8, (int16_t)0x02C0,
+    (int16_t)0x7FF7, (int16_t)0x02F2, (int16_t)0x7FF6, (int16_t)0x0324, (int16_t)0x7FF5,
+    (int16_t)0x0356, (int16_t)0x7FF4, (int16_t)0x0389, (int16_t)0x7FF2, (int16_t)0x03BB,
+    (int16_t)0x7FF1, (int16_t)0x03ED, (int16_t)0x7FEF, (int16_t)0x041F, (int16_t)0x7FED,
+    (int16_t)0x0452, (int16_t)0x7FEC, (int16_t)0x0484, (int16_t)0x7FEA, (int16_t)0x04B6,
+    (int16_t)0x7FE8, (int16_t)0x04E8, (int16_t)0x7FE6, (int16_t)0x051B, (int16_t)0x7FE4,
+    (int16_t)0x054D, (int16_t)0x7FE2, (int16_t)0x057F, (int16_t)0x7FE0, (int16_t)0x05B1,
+    (int16_t)0x7FDD, (int16_t)0x05E3, (int16_t)0x7FDB, (int16_t)0x0616, (int16_t)0x7FD9,
+    (int16_t)0x0648, (int16_t)0x7FD6, (int16_t)0x067A, (int16_t)0x7FD3, (int16_t)0x06AC,
+    (int16_t)0x7FD1, (int16_t)0x06DE, (int16_t)0x7FCE, (int16_t)0x0711, (int16_t)0x7FCB,
+    (int16_t)0x0743, (int16_t)0x7FC8, (int16_t)0x0775, (int16_t)0x7FC5, (int16_t)0x07A7,
+    (int16_t)0x7FC2, (int16_t)0x07D9, (int16_t)0x7FBF, (int16_t)0x080C, (int16_t)0x7FBC,
+    (int16_t)0x083E, (int16_t)0x7FB9, (int16_t)0x0870, (int16_t)0x7FB5, (int16_t)0x08A2,
+    (int16_t)0x7FB2, (int16_t)0x08D4, (int16_t)0x7FAE, (int16_t)0x0906, (int16_t)0x7FAB,
+    (int16_t)0x0938, (int16_t)0x7FA7, (int16_t)0x096B, (int16_t)0x7FA3, (int16_t)0x099D,
+    (int16_t)0x7FA0, (int16_t)0x09CF, (int16_t)0x7F9C, (int16_t)0x0A01, (int16_t)0x7F98,
+    (int16_t)0x0A33, (int16_t)0x7F94, (int16_t)0x0A65, (int16_t)0x7F90, (int16_t)0x0A97,
+    (int16_t)0x7F8B, (int16_t)0x0AC9, (int16_t)0x7F87, (int16_t)0x0AFB, (int16_t)0x7F83,
+    (int16_t)0x0B2D, (int16_t)0x7F7E, (int16_t)0x0B60, (int16_t)0x7F7A, (int16_t)0x0B92,
+    (int16_t)0x7F75, (int16_t)0x0BC4, (int16_t)0x7F71, (int16_t)0x0BF6, (int16_t)0x7F6C,
+    (int16_t)0x0C28, (int16_t)0x7F67, (int16_t)0x0C5A, (int16_t)0x7F62, (int16_t)0x0C8C,
+    (int16_t)0x7F5D, (int16_t)0x0CBE, (int16_t)0x7F58, (int16_t)0x0CF0, (int16_t)0x7F53,
+    (int16_t)0x0D22, (int16_t)0x7F4E, (int16_t)0x0D54, (int16_t)0x7F49, (int16_t)0x0D86,
+    (int16_t)0x7F43, (int16_t)0x0DB8, (int16_t)0x7F3E, (int16_t)0x0DEA, (int16_t)0x7F38,
+    (int16_t)0x0E1C, (int16_t)0x7F33, (int16_t)0x0E4E, (int16_t)0x7F2D, (int16_t)0x0E80,
+    (int16_t)0x7F27, (int16_t)0x0EB2, (int16_t)0x7F22, (int16_t)0x0EE4, (int16_t)0x7F1C,
+    (int16_t)0x0F15, (int16_t)0x7F16, (int16_t)0x0F47, (int16_t)0x7F10, (int16_t)0x0F79,
+    (int16_t)0x7F0A, (int16_t)0x0FAB, (int16_t)0x7F03, (int16_t)0x0FDD, (int16_t)0x7EFD,
+    (int16_t)0x100F, (int16_t)0x7EF7, (int16_t)0x1041, (int16_t)0x7EF0, (int16_t)0x1073,
+    (int16_t)0x7EEA, (int16_t)0x10A4, (int16_t)0x7EE3, (int16_t)0x10D6, (int16_t)0x7EDD,
+    (int16_t)0x1108, (int16_t)0x7ED6, (int16_t)0x113A, (int16_t)0x7ECF, (int16_t)0x116C,
+    (int16_t)0x7EC8, (int16_t)0x119E, (int16_t)0x7EC1, (int16_t)0x11CF, (int16_t)0x7EBA,
+    (int16_t)0x1201, (int16_t)0x7EB3, (int16_t)0x1233, (int16_t)0x7EAC, (int16_t)0x1265,
+    (int16_t)0x7EA5, (int16_t)0x1296, (int16_t)0x7E9D, (int16_t)0x12C8, (int16_t)0x7E96,
+    (int16_t)0x12FA, (int16_t)0x7E8E, (int16_t)0x132B, (int16_t)0x7E87, (int16_t)0x135D,
+    (int16_t)0x7E7F, (int16_t)0x138F, (int16_t)0x7E78, (int16_t)0x13C1, (int16_t)0x7E70,
+    (int16_t)0x13F2, (int16_t)0x7E68, (int16_t)0x1424, (int16_t)0x7E60, (int16_t)0x1455,
+    (int16_t)0x7E58, (int16_t)0x1487, (int16_t)0x7E50, (int16_t)0x14B9, (int16_t)0x7E48,
+    (int16_t)0x14EA, (int16_t)0x7E3F, (int16_t)0x151C, (int16_t)0x7E37, (int16_t)0x154D,
+    (int16_t)0x7E2F, (int16_t)0x157F, (int16_t)0x7E26, (int16_t)0x15B1, (int16_t)0x7E1E,
+    (int16_t)0x15E2, (int16_t)0x7E15, (int16_t)0x1614, (int16_t)0x7E0C, (int16_t)0x1645,
+    (int16_t)0x7E03, (int16_t)0x1677, (int16_t)0x7DFB, (int16_t)0x16A8, (int16_t)0x7DF2,
+    (int16_t)0x16DA, (int16_t)0x7DE9, (int16_t)0x170B, (int16_t)0x7DE0, (int16_t)0x173C,
+    (int16_t)0x7DD6, (int16_t)0x176E, (int16_t)0x7DCD, (int16_t)0x179F, (int16_t)0x7DC4,
+    (int16_t)0x17D1, (int16_t)0x7DBA, (int16_t)0x1802, (int16_t)0x7DB1, (int16_t)0x1833,
+    (int16_t)0x7DA7, (int16_t)0x1865, (int16_t)0x7D9E, (int16_t)0x1896, (int16_t)0x7D94,
+    (int16_t)0x18C7, (int16_t)0x7D8A, (int16_t)0x18F9, (int16_t)0x7D81, (int16_t)0x192A,
+    (int16_t)0x7D77, (int16_t)0x195B, (int16_t)0x7D6D, (int16_t)0x198D, (int16_t)0x7D63,
+    (int16_t)0x19BE, (int16_t)0x7D58, (int16_t)0x19EF, (int16_t)0x7D4E, (int16_t)0x1A20,
+    (int16_t)0x7D44, (int16_t)0x1A51, (int16_t)0x7D3A, (int16_t)0x1A83, (int16_t)0x7D2F,
+    (int16_t)0x1AB4, (int16_t)0x7D25, (int16_t)0x1AE5, (int16_t)0x7D1A, (int16_t)0x1B16,
+    (int16_t)0x7D0F, (int16_t)0x1B47, (int16_t)0x7D05, (int16_t)0x1B78, (int16_t)0x7CFA,
+    (int16_t)0x1BA9, (int16_t)0x7CEF, (int16_t)0x1BDA, (int16_t)0x7CE4, (int16_t)0x1C0C,
+    (int16_t)0x7CD9, (int16_t)0x1C3D, (int16_t)0x7CCE, (int16_t)0x1C6E, (int16_t)0x7CC2,
+    (int16_t)0x1C9F, (int16_t)0x7CB7, (int16_t)0x1CD0, (int16_t)0x7CAC, (int16_t)0x1D01,
+    (int16_t)0x7CA0, (int16_t)0x1D31, (int16_t)0x7C95, (int16_t)0x1D62, (int16_t)0x7C89,
+    (int16_t)0x1D93, (int16_t)0x7C7E, (int16_t)0x1DC4, (int16_t)0x7C72, (int16_t)0x1DF5,
+    (int16_t)0x7C66, (int16_t)0x1E26, (int16_t)0x7C5A, (int16_t)0x1E57, (int16_t)0x7C4E,
+    (int16_t)0x1E88, (int16_t)0x7C42, (int16_t)0x1EB8, (int16_t)0x7C36, (int16_t)0x1EE9,
+    (int16_t)0x7C2A, (int16_t)0x1F1A, (int16_t)0x7C1E, (int16_t)0x1F4B, (int16_t)0x7C11,
+    (int16_t)0x1F7B, (int16_t)0x7C05, (int16_t)0x1FAC, (int16_t)0x7BF9, (int16_t)0x1FDD,
+    (int16_t)0x7BEC, (int16_t)0x200E, (int16_t)0x7BDF, (int16_t)0x203E, (int16_t)0x7BD3,
+    (int16_t)0x206F, (int16_t)0x7BC6, (int16_t)0x209F, (int16_t)0x7BB9, (int16_t)0x20D0,
+    (int16_t)0x7BAC, (int16_t)0x2101, (int16_t)0x7B9F, (int16_t)0x2131, (int16_t)0x7B92,
+    (int16_t)0x2162, (int16_t)0x7B85, (int16_t)0x2192, (int16_t)0x7B78, (int16_t)0x21C3,
+    (int16_t)0x7B6A, (int16_t)0x21F3, (int16_t)0x7B5D, (int16_t)0x2224, (int16_t)0x7B50,
+    (int16_t)0x2254, (int16_t)0x7B42, (int16_t)0x2284, (int16_t)0x7B34, (int16_t)0x22B5,
+    (int16_t)0x7B27, (int16_t)0x22E5, (int16_t)0x7B19, (int16_t)0x2316, (int16_t)0x7B0B,
+    (int16_t)0x2346, (int16_t)0x7AFD, (int16_t)0x2376, (int16_t)0x7AEF, (int16_t)0x23A7,
+    (int16_t)0x7AE1, (int16_t)0x23D7, (int16_t)0x7AD3, (int16_t)0x2407, (int16_t)0x7AC5,
+    (int16_t)0x2437, (int16_t)0x7AB7, (int16_t)0x2467, (int16_t)0x7AA8, (int16_t)0x2498,
+    (int16_t)0x7A9A, (int16_t)0x24C8, (int16_t)0x7A8C, (int16_t)0x24F8, (int16_t)0x7A7D,
+    (int16_t)0x2528, (int16_t)0x7A6E, (int16_t)0x2558, (int16_t)0x7A60, (int16_t)0x2588,
+    (int16_t)0x7A51, (int16_t)0x25B8, (int16_t)0x7A42, (int16_t)0x25E8, (int16_t)0x7A33,
+    (int16_t)0x2618, (int16_t)0x7A24, (int16_t)0x2648, (int16_t)0x7A15, (int16_t)0x2678,
+    (int16_t)0x7A06, (int16_t)0x26A8, (int16_t)0x79F7, (int16_t)0x26D8, (int16_t)0x79E7,
+    (int16_t)0x2708, (int16_t)0x79D8, (int16_t)0x2738, (int16_t)0x79C9, (int16_t)0x2768,
+    (int16_t)0x79B9, (int16_t)0x2797, (int16_t)0x79AA, (int16_t)0x27C7, (int16_t)0x799A,
+    (int16_t)0x27F7, (int16_t)0x798A, (int16_t)0x2827, (int16_t)0x797A, (int16_t)0x2856,
+    (int16_t)0x796A, (int16_t)0x2886, (int16_t)0x795B, (int16_t)0x28B6, (int16_t)0x794A,
+    (int16_t)0x28E5, (int16_t)0x793A, (int16_t)0x2915, (int16_t)0x792A, (int16_t)0x2945,
+    (int16_t)0x791A, (int16_t)0x2974, (int16_t)0x790A, (int16_t)0x29A4, (int16_t)0x78F9,
+    (int16_t)0x29D3, (int16_t)0x78E9, (int16_t)0x2A03, (int16_t)0x78D8, (int16_t)0x2A32,
+    (int16_t)0x78C8, (int16_t)0x2A62, (int16_t)0x78B7, (int16_t)0x2A91, (int16_t)0x78A6,
+    (int16_t)0x2AC1, (int16_t)0x7895, (int16_t)0x2AF0, (int16_t)0x7885, (int16_t)0x2B1F,
+    (int16_t)0x7874, (int16_t)0x2B4F, (int16_t)0x7863, (int16_t)0x2B7E, (int16_t)0x7851,
+    (int16_t)0x2BAD, (int16_t)0x7840, (int16_t)0x2BDC, (int16_t)0x782F, (int16_t)0x2C0C,
+    (int16_t)0x781E, (int16_t)0x2C3B, (int16_t)0x780C, (int16_t)0x2C6A, (int16_t)0x77FB,
+    (int16_t)0x2C99, (int16_t)0x77E9, (int16_t)0x2CC8, (int16_t)0x77D8, (int16_t)0x2CF7,
+    (int16_t)0x77C6, (int16_t)0x2D26, (int16_t)0x77B4, (int16_t)0x2D55, (int16_t)0x77A2,
+    (int16_t)0x2D84, (int16_t)0x7790, (int16_t)0x2DB3, (int16_t)0x777E, (int16_t)0x2DE2,
+    (int16_t)0x776C, (int16_t)0x2E11, (int16_t)0x775A, (int16_t)0x2E40, (int16_t)0x7748,
+    (int16_t)0x2E6F, (int16_t)0x7736, (int16_t)0x2E9E, (int16_t)0x7723, (int16_t)0x2ECC,
+    (int16_t)0x7711, (int16_t)0x2EFB, (int16_t)0x76FE, (int16_t)0x2F2A, (int16_t)0x76EC,
+    (int16_t)0x2F59, (int16_t)0x76D9, (int16_t)0x2F87, (int16_t)0x76C7, (int16_t)0x2FB6,
+    (int16_t)0x76B4, (int16_t)0x2FE5, (int16_t)0x76A1, (int16_t)0x3013, (int16_t)0x768E,
+    (int16_t)0x3042, (int16_t)0x767B, (int16_t)0x3070, (int16_t)0x7668, (int16_t)0x309F,
+    (int16_t)0x7655, (int16_t)0x30CD, (int16_t)0x7642, (int16_t)0x30FC, (int16_t)0x762E,
+    (int16_t)0x312A, (int16_t)0x761B, (int16_t)0x3159, (int16_t)0x7608, (int16_t)0x3187,
+    (int16_t)0x75F4, (int16_t)0x31B5, (int16_t)0x75E1, (int16_t)0x31E4, (int16_t)0x75CD,
+    (int16_t)0x3212, (int16_t)0x75B9, (int16_t)0x3240, (int16_t)0x75A6, (int16_t)0x326E,
+    (int16_t)0x7592, (int16_t)0x329D, (int16_t)0x757E, (int16_t)0x32CB, (int16_t)0x756A,
+    (int16_t)0x32F9, (int16_t)0x7556, (int16_t)0x3327, (int16_t)0x7542, (int16_t)0x3355,
+    (int16_t)0x752D, (int16_t)0x3383, (int16_t)0x7519, (int16_t)0x33B1, (int16_t)0x7505,
+    (int16_t)0x33DF, (int16_t)0x74F0, (int16_t)0x340D, (int16_t)0x74DC, (int16_t)0x343B,
+    (int16_t)0x74C7, (int16_t)0x3469, (int16_t)0x74B3, (int16_t)0x3497, (int16_t)0x749E,
+    (int16_t)0x34C4, (int16_t)0x7489, (int16_t)0x34F2, (int16_t)0x7475, (int16_t)0x3520,
+    (int16_t)0x7460, (int16_t)0x354E, (int16_t)0x744B, (int16_t)0x357B, (int16_t)0x7436,
+    (int16_t)0x35A9, (int16_t)0x7421, (int16_t)0x35D7, (int16_t)0x740B, (int16_t)0x3604,
+    (int16_t)0x73F6, (int16_t)0x3632, (int16_t)0x73E1, (int16_t)0x365F, (int16_t)0x73CB,
+    (int16_t)0x368D, (int16_t)0x73B6, (int16_t)0x36BA, (int16_t)0x73A0, (int16_t)0x36E8,
+    (int16_t)0x738B, (int16_t)0x3715, (int16_t)0x7375, (int16_t)0x3742, (int16_t)0x735F,
+    (int16_t)0x3770, (int16_t)0x734A, (int16_t)0x379D, (int16_t)0x7334, (int16_t)0x37CA,
+    (int16_t)0x731E, (int16_t)0x37F7, (int16_t)0x7308, (int16_t)0x3825, (int16_t)0x72F2,
+    (int16_t)0x3852, (int16_t)0x72DC, (int16_t)0x387F, (int16_t)0x72C5, (int16_t)0x38AC,
+    (int16_t)0x72AF, (int16_t)0x38D9, (int16_t)0x7299, (int16_t)0x3906, (int16_t)0x7282,
+    (int16_t)0x3933, (int16_t)0x726C, (int16_t)0x3960, (int16_t)0x7255, (int16_t)0x398D,
+    (int16_t)0x723F, (int16_t)0x39BA, (int16_t)0x7228, (int16_t)0x39E7, (int16_t)0x7211,
+    (int16_t)0x3A13, (int16_t)0x71FA, (int16_t)0x3A40, (int16_t)0x71E3, (int16_t)0x3A6D,
+    (int16_t)0x71CC, (int16_t)0x3A9A, (int16_t)0x71B5, (int16_t)0x3AC6, (int16_t)0x719E,
+    (int16_t)0x3AF3, (int16_t)0x7187, (int16_t)0x3B20, (int16_t)0x7170, (int16_t)0x3B4C,
+    (int16_t)0x7158, (int16_t)0x3B79, (int16_t)0x7141, (int16_t)0x3BA5, (int16_t)0x712A,
+    (int16_t)0x3BD2, (int16_t)0x7112, (int16_t)0x3BFE, (int16_t)0x70FA, (int16_t)0x3C2A,
+    (int16_t)0x70E3, (int16_t)0x3C57, (int16_t)0x70CB, (int16_t)0x3C83, (int16_t)0x70B3,
+    (int16_t)0x3CAF, (int16_t)0x709B, (int16_t)0x3CDC, (int16_t)0x7083, (int16_t)0x3D08,
+    (int16_t)0x706B, (int16_t)0x3D34, (int16_t)0x7053, (int16_t)0x3D60, (int16_t)0x703B,
+    (int16_t)0x3D8C, (int16_t)0x7023, (int16_t)0x3DB8, (int16_t)0x700B, (int16_t)0x3DE4,
+    (int16_t)0x6FF2, (int16_t)0x3E10, (int16_t)0x6FDA, (int16_t)0x3E3C, (int16_t)0x6FC2,
+    (int16_t)0x3E68, (int16_t)0x6FA9, (int16_t)0x3E94, (int16_t)0x6F90, (int16_t)0x3EC0,
+    (int16_t)0x6F78, (int16_t)0x3EEC, (int16_t)0x6F5F, (int16_t)0x3F17, (int16_t)0x6F46,
+    (int16_t)0x3F43, (int16_t)0x6F2D, (int16_t)0x3F6F, (int16_t)0x6F14, (int16_t)0x3F9A,
+    (int16_t)0x6EFB, (int16_t)0x3FC6, (int16_t)0x6EE2, (int16_t)0x3FF1, (int16_t)0x6EC9,
+    (int16_t)0x401D, (int16_t)0x6EB0, (int16_t)0x4048, (int16_t)0x6E97, (int16_t)0x4074,
+    (int16_t)0x6E7D, (int16_t)0x409F, (int16_t)0x6E64, (int16_t)0x40CB, (int16_t)0x6E4A,
+    (int16_t)0x40F6, (int16_t)0x6E31, (int16_t)0x4121, (int16_t)0x6E17, (int16_t)0x414D,
+    (int16_t)0x6DFE, (int16_t)0x4178, (int16_t)0x6DE4, (int16_t)0x41A3, (int16_t)0x6DCA,
+    (int16_t)0x41CE, (int16_t)0x6DB0, (int16_t)0x41F9, (int16_t)0x6D96, (int16_t)0x4224,
+    (int16_t)0x6D7C, (int16_t)0x424F, (int16_t)0x6D62, (int16_t)0x427A, (int16_t)0x6D48,
+    (int16_t)0x42A5, (int16_t)0x6D2E, (int16_t)0x42D0, (int16_t)0x6D14, (int16_t)0x42FB,
+    (int16_t)0x6CF9, (int16_t)0x4326, (int16_t)0x6CDF, (int16_t)0x4351, (int16_t)0x6CC4,
+    (int16_t)0x437B, (int16_t)0x6CAA, (int16_t)0x43A6, (int16_t)0x6C8F, (int16_t)0x43D1,
+    (int16_t)0x6C75, (int16_t)0x43FB, (int16_t)0x6C5A, (int16_t)0x4426, (int16_t)0x6C3F,
+    (int16_t)0x4450, (int16_t)0x6C24, (int16_t)0x447B, (int16_t)0x6C09, (int16_t)0x44A5,
+    (int16_t)0x6BEE, (int16_t)0x44D0, (int16_t)0x6BD3, (int16_t)0x44FA, (int16_t)0x6BB8,
+    (int16_t)0x4524, (int16_t)0x6B9D, (int16_t)0x454F, (int16_t)0x6B82, (int16_t)0x4579,
+    (int16_t)0x6B66, (int16_t)0x45A3, (int16_t)0x6B4B, (int16_t)0x45CD, (int16_t)0x6B30,
+    (int16_t)0x45F7, (int16_t)0x6B14, (int16_t)0x4621, (int16_t)0x6AF8, (int16_t)0x464B,
+    (int16_t)0x6ADD, (int16_t)0x4675, (int16_t)0x6AC1, (int16_t)0x469F, (int16_t)0x6AA5,
+    (int16_t)0x46C9, (int16_t)0x6A89, (int16_t)0x46F3, (int16_t)0x6A6E, (int16_t)0x471D,
+    (int16_t)0x6A52, (int16_t)0x4747, (int16_t)0x6A36, (int16_t)0x4770, (int16_t)0x6A1A,
+    (int16_t)0x479A, (int16_t)0x69FD, (int16_t)0x47C4, (int16_t)0x69E1, (int16_t)0x47ED,
+    (int16_t)0x69C5, (int16_t)0x4817, (int16_t)0x69A9, (int16_t)0x4840, (int16_t)0x698C,
+    (int16_t)0x486A, (int16_t)0x6970, (int16_t)0x4893, (int16_t)0x6953, (int16_t)0x48BD,
+    (int16_t)0x6937, (int16_t)0x48E6, (int16_t)0x691A, (int16_t)0x490F, (int16_t)0x68FD,
+    (int16_t)0x4939, (int16_t)0x68E0, (int16_t)0x4962, (int16_t)0x68C4, (int16_t)0x498B,
+    (int16_t)0x68A7, (int16_t)0x49B4, (int16_t)0x688A, (int16_t)0x49DD, (int16_t)0x686D,
+    (int16_t)0x4A06, (int16_t)0x6850, (int16_t)0x4A2F, (int16_t)0x6832, (int16_t)0x4A58,
+    (int16_t)0x6815, (int16_t)0x4A81, (int16_t)0x67F8, (int16_t)0x4AAA, (int16_t)0x67DA,
+    (int16_t)0x4AD3, (int16_t)0x67BD, (int16_t)0x4AFB, (int16_t)0x67A0, (int16_t)0x4B24,
+    (int16_t)0x6782, (int16_t)0x4B4D, (int16_t)0x6764, (int16_t)0x4B75, (int16_t)0x6747,
+    (int16_t)0x4B9E, (int16_t)0x6729, (int16_t)0x4BC7, (int16_t)0x670B, (int16_t)0x4BEF,
+    (int16_t)0x66ED, (int16_t)0x4C17, (int16_t)0x66D0, (int16_t)0x4C40, (int16_t)0x66B2,
+    (int16_t)0x4C68, (int16_t)0x6693, (int16_t)0x4C91, (int16_t)0x6675, (int16_t)0x4CB9,
+    (int16_t)0x6657, (int16_t)0x4CE1, (int16_t)0x6639, (int16_t)0x4D09, (int16_t)0x661B,
+    (int16_t)0x4D31, (int16_t)0x65FC, (int16_t)0x4D59, (int16_t)0x65DE, (int16_t)0x4D81,
+    (int16_t)0x65C0, (int16_t)0x4DA9, (int16_t)0x65A1, (int16_t)0x4DD1, (int16_t)0x6582,
+    (int16_t)0x4DF9, (int16_t)0x6564, (int16_t)0x4E21, (int16_t)0x6545, (int16_t)0x4E49,
+    (int16_t)0x6526, (int16_t)0x4E71, (int16_t)0x6507, (int16_t)0x4E98, (int16_t)0x64E9,
+    (int16_t)0x4EC0, (int16_t)0x64CA, (int16_t)0x4EE8, (int16_t)0x64AB, (int16_t)0x4F0F,
+    (int16_t)0x648B, (int16_t)0x4F37, (int16_t)0x646C, (int16_t)0x4F5E, (int16_t)0x644D,
+    (int16_t)0x4F85, (int16_t)0x642E, (int16_t)0x4FAD, (int16_t)0x640F, (int16_t)0x4FD4,
+    (int16_t)0x63EF, (int16_t)0x4FFB, (int16_t)0x63D0, (int16_t)0x5023, (int16_t)0x63B0,
+    (int16_t)0x504A, (int16_t)0x6391, (int16_t)0x5071, (int16_t)0x6371, (int16_t)0x5098,
+    (int16_t)0x6351, (int16_t)0x50BF, (int16_t)0x6332, (int16_t)0x50E6, (int16_t)0x6312,
+    (int16_t)0x510D, (int16_t)0x62F2, (int16_t)0x5134, (int16_t)0x62D2, (int16_t)0x515B,
+    (int16_t)0x62B2, (int16_t)0x5181, (int16_t)0x6292, (int16_t)0x51A8, (int16_t)0x6272,
+    (int16_t)0x51CF, (int16_t)0x6252, (int16_t)0x51F5, (int16_t)0x6232, (int16_t)0x521C,
+    (int16_t)0x6211, (int16_t)0x5243, (int16_t)0x61F1, (int16_t)0x5269, (int16_t)0x61D1,
+    (int16_t)0x5290, (int16_t)0x61B0, (int16_t)0x52B6, (int16_t)0x6190, (int16_t)0x52DC,
+    (int16_t)0x616F, (int16_t)0x5303, (int16_t)0x614E, (int16_t)0x5329, (int16_t)0x612E,
+    (int16_t)0x534F, (int16_t)0x610D, (int16_t)0x5375, (int16_t)0x60EC, (int16_t)0x539B,
+    (int16_t)0x60CB, (int16_t)0x53C1, (int16_t)0x60AA, (int16_t)0x53E7, (int16_t)0x6089,
+    (int16_t)0x540D, (int16_t)0x6068, (int16_t)0x5433, (int16_t)0x6047, (int16_t)0x5459,
+    (int16_t)0x6026, (int16_t)0x547F, (int16_t)0x6005, (int16_t)0x54A4, (int16_t)0x5FE4,
+    (int16_t)0x54CA, (int16_t)0x5FC2, (int16_t)0x54F0, (int16_t)0x5FA1, (int16_t)0x5515,
+    (int16_t)0x5F80, (int16_t)0x553B, (int16_t)0x5F5E, (int16_t)0x5560, (int16_t)0x5F3C,
+    (int16_t)0x5586, (int16_t)0x5F1B, (int16_t)0x55AB, (int16_t)0x5EF9, (int16_t)0x55D0,
+    (int16_t)0x5ED7, (int16_t)0x55F6, (int16_t)0x5EB6, (int16_t)0x561B, (int16_t)0x5E94,
+    (int16_t)0x5640, (int16_t)0x5E72, (int16_t)0x5665, (int16_t)0x5E50, (int16_t)0x568A,
+    (int16_t)0x5E2E, (int16_t)0x56AF, (int16_t)0x5E0C, (int16_t)0x56D4, (int16_t)0x5DEA,
+    (int16_t)0x56F9, (int16_t)0x5DC8, (int16_t)0x571E, (int16_t)0x5DA5, (int16_t)0x5743,
+    (int16_t)0x5D83, (int16_t)0x5767, (int16_t)0x5D61, (int16_t)0x578C, (int16_t)0x5D3E,
+    (int16_t)0x57B1, (int16_t)0x5D1C, (int16_t)0x57D5, (int16_t)0x5CF9, (int16_t)0x57FA,
+    (int16_t)0x5CD7, (int16_t)0x581E, (int16_t)0x5CB4, (int16_t)0x5843, (int16_t)0x5C91,
+    (int16_t)0x5867, (int16_t)0x5C6F, (int16_t)0x588C, (int16_t)0x5C4C, (int16_t)0x58B0,
+    (int16_t)0x5C29, (int16_t)0x58D4, (int16_t)0x5C06, (int16_t)0x58F8, (int16_t)0x5BE3,
+    (int16_t)0x591C, (int16_t)0x5BC0, (int16_t)0x5940, (int16_t)0x5B9D, (int16_t)0x5964,
+    (int16_t)0x5B7A, (int16_t)0x5988, (int16_t)0x5B57, (int16_t)0x59AC, (int16_t)0x5B34,
+    (int16_t)0x59D0, (int16_t)0x5B10, (int16_t)0x59F4, (int16_t)0x5AED, (int16_t)0x5A18,
+    (int16_t)0x5AC9, (int16_t)0x5A3B, (int16_t)0x5AA6, (int16_t)0x5A5F, (int16_t)0x5A82,
+    (int16_t)0x5A82, (int16_t)0x5A5F, (int16_t)0x5AA6, (int16_t)0x5A3B, (int16_t)0x5AC9,
+    (int16_t)0x5A18, (int16_t)0x5AED, (int16_t)0x59F4, (int16_t)0x5B10, (int16_t)0x59D0,
+    (int16_t)0x5B34, (int16_t)0x59AC, (int16_t)0x5B57, (int16_t)0x5988, (int16_t)0x5B7A,
+    (int16_t)0x5964, (int16_t)0x5B9D, (int16_t)0x5940, (int16_t)0x5BC0, (int16_t)0x591C,
+    (int16_t)0x5BE3, (int16_t)0x58F8, (int16_t)0x5C06, (int16_t)0x58D4, (int16_t)0x5C29,
+    (int16_t)0x58B0, (int16_t)0x5C4C, (int16_t)0x588C, (int16_t)0x5C6F, (int16_t)0x5867,
+    (int16_t)0x5C91, (int16_t)0x5843, (int16_t)0x5CB4, (int16_t)0x581E, (int16_t)0x5CD7,
+    (int16_t)0x57FA, (int16_t)0x5CF9, (int16_t)0x57D5, (int16_t)0x5D1C, (int16_t)0x57B1,
+    (int16_t)0x5D3E, (int16_t)0x578C, (int16_t)0x5D61, (int16_t)0x5767, (int16_t)0x5D83,
+    (int16_t)0x5743, (int16_t)0x5DA5, (int16_t)0x571E, (int16_t)0x5DC8, (int16_t)0x56F9,
+    (int16_t)0x5DEA, (int16_t)0x56D4, (int16_t)0x5E0C, (int16_t)0x56AF, (int16_t)0x5E2E,
+    (int16_t)0x568A, (int16_t)0x5E50, (int16_t)0x5665, (int16_t)0x5E72, (int16_t)0x5640,
+    (int16_t)0x5E94, (int16_t)0x561B, (int16_t)0x5EB6, (int16_t)0x55F6, (int16_t)0x5ED7,
+    (int16_t)0x55D0, (int16_t)0x5EF9, (int16_t)0x55AB, (int16_t)0x5F1B, (int16_t)0x5586,
+    (int16_t)0x5F3C, (int16_t)0x5560, (int16_t)0x5F5E, (int16_t)0x553B, (int16_t)0x5F80,
+    (int16_t)0x5515, (int16_t)0x5FA1, (int16_t)0x54F0, (int16_t)0x5FC2, (int16_t)0x54CA,
+    (int16_t)0x5FE4, (int16_t)0x54A4, (int16_t)0x6005, (int16_t)0x547F, (int16_t)0x6026,
+    (int16_t)0x5459, (int16_t)0x6047, (int16_t)0x5433, (int16_t)0x6068, (int16_t)0x540D,
+    (int16_t)0x6089, (int16_t)0x53E7, (int16_t)0x60AA, (int16_t)0x53C1, (int16_t)0x60CB,
+    (int16_t)0x539B, (int16_t)0x60EC, (int16_t)0x5375, (int16_t)0x610D, (int16_t)0x534F,
+    (int16_t)0x612E, (int16_t)0x5329, (int16_t)0x614E, (int16_t)0x5303, (int16_t)0x616F,
+    (int16_t)0x52DC, (int16_t)0x6190, (int16_t)0x52B6, (int16_t)0x61B0, (int16_t)0x5290,
+    (int16_t)0x61D1, (int16_t)0x5269, (int16_t)0x61F1, (int16_t)0x5243, (int16_t)0x6211,
+    (int16_t)0x521C, (int16_t)0x6232, (int16_t)0x51F5, (int16_t)0x6252, (int16_t)0x51CF,
+    (int16_t)0x6272, (int16_t)0x51A8, (int16_t)0x6292, (int16_t)0x5181, (int16_t)0x62B2,
+    (int16_t)0x515B, (int16_t)0x62D2, (int16_t)0x5134, (int16_t)0x62F2, (int16_t)0x510D,
+    (int16_t)0x6312, (int16_t)0x50E6, (int16_t)0x6332, (int16_t)0x50BF, (int16_t)0x6351,
+    (int16_t)0x5098, (int16_t)0x6371, (int16_t)0x5071, (int16_t)0x6391, (int16_t)0x504A,
+    (int16_t)0x63B0, (int16_t)0x5023, (int16_t)0x63D0, (int16_t)0x4FFB, (int16_t)0x63EF,
+    (int16_t)0x4FD4, (int16_t)0x640F, (int16_t)0x4FAD, (int16_t)0x642E, (int16_t)0x4F85,
+    (int16_t)0x644D, (int16_t)0x4F5E, (int16_t)0x646C, (int16_t)0x4F37, (int16_t)0x648B,
+    (int16_t)0x4F0F, (int16_t)0x64AB, (int16_t)0x4EE8, (int16_t)0x64CA, (int16_t)0x4EC0,
+    (int16_t)0x64E9, (int16_t)0x4E98, (int16_t)0x6507, (int16_t)0x4E71, (int16_t)0x6526,
+    (int16_t)0x4E49, (int16_t)0x6545, (int16_t)0x4E21, (int16_t)0x6564, (int16_t)0x4DF9,
+    (int16_t)0x6582, (int16_t)0x4DD1, (int16_t)0x65A1, (int16_t)0x4DA9, (int16_t)0x65C0,
+    (int16_t)0x4D81, (int16_t)0x65DE, (int16_t)0x4D59, (int16_t)0x65FC, (int16_t)0x4D31,
+    (int16_t)0x661B, (int16_t)0x4D09, (int16_t)0x6639, (int16_t)0x4CE1, (int16_t)0x6657,
+    (int16_t)0x4CB9, (int16_t)0x6675, (int16_t)0x4C91, (int16_t)0x6693, (int16_t)0x4C68,
+    (int16_t)0x66B2, (int16_t)0x4C40, (int16_t)0x66D0, (int16_t)0x4C17, (int16_t)0x66ED,
+    (int16_t)0x4BEF, (int16_t)0x670B, (int16_t)0x4BC7, (int16_t)0x6729, (int16_t)0x4B9E,
+    (int16_t)0x6747, (int16_t)0x4B75, (int16_t)0x6764, (int16_t)0x4B4D, (int16_t)0x6782,
+    (int16_t)0x4B24, (int16_t)0x67A0, (int16_t)0x4AFB, (int16_t)0x67BD, (int16_t)0x4AD3,
+    (int16_t)0x67DA, (int16_t)0x4AAA, (int16_t)0x67F8, (int16_t)0x4A81, (int16_t)0x6815,
+    (int16_t)0x4A58, (int16_t)0x6832, (int16_t)0x4A2F, (int16_t)0x6850, (int16_t)0x4A06,
+    (int16_t)0x686D, (int16_t)0x49DD, (int16_t)0x688A, (int16_t)0x49B4, (int16_t)0x68A7,
+    (int16_t)0x498B, (int16_t)0x68C4, (int16_t)0x4962, (int16_t)0x68E0, (int16_t)0x4939,
+    (int16_t)0x68FD, (int16_t)0x490F, (int16_t)0x691A, (int16_t)0x48E6, (int16_t)0x6937,
+    (int16_t)0x48BD, (int16_t)0x6953, (int16_t)0x4893, (int16_t)0x6970, (int16_t)0x486A,
+    (int16_t)0x698C, (int16_t)0x4840, (int16_t)0x69A9, (int16_t)0x4817, (int16_t)0x69C5,
+    (int16_t)0x47ED, (int16_t)0x69E1, (int16_t)0x47C4, (int16_t)0x69FD, (int16_t)0x479A,
+    (int16_t)0x6A1A, (int16_t)0x4770, (int16_t)0x6A36, (int16_t)0x4747, (int16_t)0x6A52,
+    (int16_t)0x471D, (int16_t)0x6A6E, (int16_t)0x46F3, (int16_t)0x6A89, (int16_t)0x46C9,
+    (int16_t)0x6AA5, (int16_t)0x469F, (int16_t)0x6AC1, (int16_t)0x4675, (int16_t)0x6ADD,
+    (int16_t)0x464B, (int16_t)0x6AF8, (int16_t)0x4621, (int16_t)0x6B14, (int16_t)0x45F7,
+    (int16_t)0x6B30, (int16_t)0x45CD, (int16_t)0x6B4B, (int16_t)0x45A3, (int16_t)0x6B66,
+    (int16_t)0x4579, (int16_t)0x6B82, (int16_t)0x454F, (int16_t)0x6B9D, (int16_t)0x4524,
+    (int16_t)0x6BB8, (int16_t)0x44FA, (int16_t)0x6BD3, (int16_t)0x44D0, (int16_t)0x6BEE,
+    (int16_t)0x44A5, (int16_t)0x6C09, (int16_t)0x447B, (int16_t)0x6C24, (int16_t)0x4450,
+    (int16_t)0x6C3F, (int16_t)0x4426, (int16_t)0x6C5A, (int16_t)0x43FB, (int16_t)0x6C75,
+    (int16_t)0x43D1, (int16_t)0x6C8F, (int16_t)0x43A6, (int16_t)0x6CAA, (int16_t)0x437B,
+    (int16_t)0x6CC4, (int16_t)0x4351, (int16_t)0x6CDF, (int16_t)0x4326, (int16_t)0x6CF9,
+    (int16_t)0x42FB, (int16_t)0x6D14, (int16_t)0x42D0, (int16_t)0x6D2E, (int16_t)0x42A5,
+    (int16_t)0x6D48, (int16_t)0x427A, (int16_t)0x6D62, (int16_t)0x424F, (int16_t)0x6D7C,
+    (int16_t)0x4224, (int16_t)0x6D96, (int16_t)0x41F9, (int16_t)0x6DB0, (int16_t)0x41CE,
+    (int16_t)0x6DCA, (int16_t)0x41A3, (int16_t)0x6DE4, (int16_t)0x4178, (int16_t)0x6DFE,
+    (int16_t)0x414D, (int16_t)0x6E17, (int16_t)0x4121, (int16_t)0x6E31, (int16_t)0x40F6,
+    (int16_t)0x6E4A, (int16_t)0x40CB, (int16_t)0x6E64, (int16_t)0x409F, (int16_t)0x6E7D,
+    (int16_t)0x4074, (int16_t)0x6E97, (int16_t)0x4048, (int16_t)0x6EB0, (int16_t)0x401D,
+    (int16_t)0x6EC9, (int16_t)0x3FF1, (int16_t)0x6EE2, (int16_t)0x3FC6, (int16_t)0x6EFB,
+    (int16_t)0x3F9A, (int16_t)0x6F14, (int16_t)0x3F6F, (int16_t)0x6F2D, (int16_t)0x3F43,
+    (int16_t)0x6F46, (int16_t)0x3F17, (int16_t)0x6F5F, (int16_t)0x3EEC, (int16_t)0x6F78,
+    (int16_t)0x3EC0, (int16_t)0x6F90, (int16_t)0x3E94, (int16_t)0x6FA9, (int16_t)0x3E68,
+    (int16_t)0x6FC2, (int16_t)0x3E3C, (int16_t)0x6FDA, (int16_t)0x3E10, (int16_t)0x6FF2,
+    (int16_t)0x3DE4, (int16_t)0x700B, (int16_t)0x3DB8, (int16_t)0x7023, (int16_t)0x3D8C,
+    (int16_t)0x703B, (int16_t)0x3D60, (int16_t)0x7053, (int16_t)0x3D34, (int16_t)0x706B,
+    (int16_t)0x3D08, (int16_t)0x7083, (int16_t)0x3CDC, (int16_t)0x709B, (int16_t)0x3CAF,
+    (int16_t)0x70B3, (int16_t)0x3C83, (int16_t)0x70CB, (int16_t)0x3C57, (int16_t)0x70E3,
+    (int16_t)0x3C2A, (int16_t)0x70FA, (int16_t)0x3BFE, (int16_t)0x7112, (int16_t)0x3BD2,
+    (int16_t)0x712A, (int16_t)0x3BA5, (int16_t)0x7141, (int16_t)0x3B79, (int16_t)0x7158,
+    (int16_t)0x3B4C, (int16_t)0x7170, (int16_t)0x3B20, (int16_t)0x7187, (int16_t)0x3AF3,
+    (int16_t)0x719E, (int16_t)0x3AC6, (int16_t)0x71B5, (int16_t)0x3A9A, (int16_t)0x71CC,
+    (int16_t)0x3A6D, (int16_t)0x71E3, (int16_t)0x3A40, (int16_t)0x71FA, (int16_t)0x3A13,
+    (int16_t)0x7211, (int16_t)0x39E7, (int16_t)0x7228, (int16_t)0x39BA, (int16_t)0x723F,
+    (int16_t)0x398D, (int16_t)0x7255, (int16_t)0x3960, (int16_t)0x726C, (int16_t)0x3933,
+    (int16_t)0x7282, (int16_t)0x3906, (int16_t)0x7299, (int16_t)0x38D9, (int16_t)0x72AF,
+    (int16_t)0x38AC, (int16_t)0x72C5, (int16_t)0x387F, (int16_t)0x72DC, (int16_t)0x3852,
+    (int16_t)0x72F2, (int16_t)0x3825, (int16_t)0x7308, (int16_t)0x37F7, (int16_t)0x731E,
+    (int16_t)0x37CA, (int16_t)0x7334, (int16_t)0x379D, (int16_t)0x734A, (int16_t)0x3770,
+    (int16_t)0x735F, (int16_t)0x3742, (int16_t)0x7375, (int16_t)0x3715, (int16_t)0x738B,
+    (int16_t)0x36E8, (int16_t)0x73A0, (int16_t)0x36BA, (int16_t)0x73B6, (int16_t)0x368D,
+    (int16_t)0x73CB, (int16_t)0x365F, (int16_t)0x73E1, (int16_t)0x3632, (int16_t)0x73F6,
+    (int16_t)0x3604, (int16_t)0x740B, (int16_t)0x35D7, (int16_t)0x7421, (int16_t)0x35A9,
+    (int16_t)0x7436, (int16_t)0x357B, (int16_t)0x744B, (int16_t)0x354E, (int16_t)0x7460,
+    (int16_t)0x3520, (int16_t)0x7475, (int16_t)0x34F2, (int16_t)0x7489, (int16_t)0x34C4,
+    (int16_t)0x749E, (int16_t)0x3497, (int16_t)0x74B3, (int16_t)0x3469, (int16_t)0x74C7,
+    (int16_t)0x343B, (int16_t)0x74DC, (int16_t)0x340D, (int16_t)0x74F0, (int16_t)0x33DF,
+    (int16_t)0x7505, (int16_t)0x33B1, (int16_t)0x7519, (int16_t)0x3383, (int16_t)0x752D,
+    (int16_t)0x3355, (int16_t)0x7542, (int16_t)0x3327, (int16_t)0x7556, (int16_t)0x32F9,
+    (int16_t)0x756A, (int16_t)0x32CB, (int16_t)0x757E, (int16_t)0x329D, (int16_t)0x7592,
+    (int16_t)0x326E, (int16_t)0x75A6, (int16_t)0x3240, (int16_t)0x75B9, (int16_t)0x3212,
+    (int16_t)0x75CD, (int16_t)0x31E4, (int16_t)0x75E1, (int16_t)0x31B5, (int16_t)0x75F4,
+    (int16_t)0x3187, (int16_t)0x7608, (int16_t)0x3159, (int16_t)0x761B, (int16_t)0x312A,
+    (int16_t)0x762E, (int16_t)0x30FC, (int16_t)0x7642, (int16_t)0x30CD, (int16_t)0x7655,
+    (int16_t)0x309F, (int16_t)0x7668, (int16_t)0x3070, (int16_t)0x767B, (int16_t)0x3042,
+    (int16_t)0x768E, (int16_t)0x3013, (int16_t)0x76A1, (int16_t)0x2FE5, (int16_t)0x76B4,
+    (int16_t)0x2FB6, (int16_t)0x76C7, (int16_t)0x2F87, (int16_t)0x76D9, (int16_t)0x2F59,
+    (int16_t)0x76EC, (int16_t)0x2F2A, (int16_t)0x76FE, (int16_t)0x2EFB, (int16_t)0x7711,
+    (int16_t)0x2ECC, (int16_t)0x7723, (int16_t)0x2E9E, (int16_t)0x7736, (int16_t)0x2E6F,
+    (int16_t)0x7748, (int16_t)0x2E40, (int16_t)0x775A, (int16_t)0x2E11, (int16_t)0x776C,
+    (int16_t)0x2DE2, (int16_t)0x777E, (int16_t)0x2DB3, (int16_t)0x7790, (int16_t)0x2D84,
+    (int16_t)0x77A2, (int16_t)0x2D55, (int16_t)0x77B4, (int16_t)0x2D26, (int16_t)0x77C6,
+    (int16_t)0x2CF7, (int16_t)0x77D8, (int16_t)0x2CC8, (int16_t)0x77E9, (int16_t)0x2C99,
+    (int16_t)0x77FB, (int16_t)0x2C6A, (int16_t)0x780C, (int16_t)0x2C3B, (int16_t)0x781E,
+    (int16_t)0x2C0C, (int16_t)0x782F, (int16_t)0x2BDC, (int16_t)0x7840, (int16_t)0x2BAD,
+    (int16_t)0x7851, (int16_t)0x2B7E, (int16_t)0x7863, (int16_t)0x2B4F, (int16_t)0x7874,
+    (int16_t)0x2B1F, (int16_t)0x7885, (int16_t)0x2AF0, (int16_t)0x7895, (int16_t)0x2AC1,
+    (int16_t)0x78A6, (int16_t)0x2A91, (int16_t)0x78B7, (int16_t)0x2A62, (int16_t)0x78C8,
+    (int16_t)0x2A32, (int16_t)0x78D8, (int16_t)0x2A03, (int16_t)0x78E9, (int16_t)0x29D3,
+    (int16_t)0x78F9, (int16_t)0x29A4, (int16_t)0x790A, (int16_t)0x2974, (int16_t)0x791A,
+    (int16_t)0x2945, (int16_t)0x792A, (int16_t)0x2915, (int16_t)0x793A, (int16_t)0x28E5,
+    (int16_t)0x794A, (int16_t)0x28B6, (int16_t)0x795B, (int16_t)0x2886, (int16_t)0x796A,
+    (int16_t)0x2856, (int16_t)0x797A, (int16_t)0x2827, (int16_t)0x798A, (int16_t)0x27F7,
+    (int16_t)0x799A, (int16_t)0x27C7, (int16_t)0x79AA, (int16_t)0x2797, (int16_t)0x79B9,
+    (int16_t)0x2768, (int16_t)0x79C9, (int16_t)0x2738, (int16_t)0x79D8, (int16_t)0x2708,
+    (int16_t)0x79E7, (int16_t)0x26D8, (int16_t)0x79F7, (int16_t)0x26A8, (int16_t)0x7A06,
+    (int16_t)0x2678, (int16_t)0x7A15, (int16_t)0x2648, (int16_t)0x7A24, (int16_t)0x2618,
+    (int16_t)0x7A33, (int16_t)0x25E8, (int16_t)0x7A42, (int16_t)0x25B8, (int16_t)0x7A51,
+    (int16_t)0x2588, (int16_t)0x7A60, (int16_t)0x2558, (int16_t)0x7A6E, (int16_t)0x2528,
+    (int16_t)0x7A7D, (int16_t)0x24F8, (int16_t)0x7A8C, (int16_t)0x24C8, (int16_t)0x7A9A,
+    (int16_t)0x2498, (int16_t)0x7AA8, (int16_t)0x2467, (int16_t)0x7AB7, (int16_t)0x2437,
+    (int16_t)0x7AC5, (int16_t)0x2407, (int16_t)0x7AD3, (int16_t)0x23D7, (int16_t)0x7AE1,
+    (int16_t)0x23A7, (int16_t)0x7AEF, (int16_t)0x2376, (int16_t)0x7AFD, (int16_t)0x2346,
+    (int16_t)0x7B0B, (int16_t)0x2316, (int16_t)0x7B19, (int16_t)0x22E5, (int16_t)0x7B27,
+    (int16_t)0x22B5, (int16_t)0x7B34, (int16_t)0x2284, (int16_t)0x7B42, (int16_t)0x2254,
+    (int16_t)0x7B50, (int16_t)0x2224, (int16_t)0x7B5D, (int16_t)0x21F3, (int16_t)0x7B6A,
+    (int16_t)0x21C3, (int16_t)0x7B78, (int16_t)0x2192, (int16_t)0x7B85, (int16_t)0x2162,
+    (int16_t)0x7B92, (int16_t)0x2131, (int16_t)0x7B9F, (int16_t)0x2101, (int16_t)0x7BAC,
+    (int16_t)0x20D0, (int16_t)0x7BB9, (int16_t)0x209F, (int16_t)0x7BC6, (int16_t)0x206F,
+    (int16_t)0x7BD3, (int16_t)0x203E, (int16_t)0x7BDF, (int16_t)0x200E, (int16_t)0x7BEC,
+    (int16_t)0x1FDD, (int16_t)0x7BF9, (int16_t)0x1FAC, (int16_t)0x7C05, (int16_t)0x1F7B,
+    (int16_t)0x7C11, (int16_t)0x1F4B, (int16_t)0x7C1E, (int16_t)0x1F1A, (int16_t)0x7C2A,
+    (int16_t)0x1EE9, (int16_t)0x7C36, (int16_t)0x1EB8, (int16_t)0x7C42, (int16_t)0x1E88,
+    (int16_t)0x7C4E, (int16_t)0x1E57, (int16_t)0x7C5A, (int16_t)0x1E26, (int16_t)0x7C66,
+    (int16_t)0x1DF5, (int16_t)0x7C72, (int16_t)0x1DC4, (int16_t)0x7C7E, (int16_t)0x1D93,
+    (int16_t)0x7C89, (int16_t)0x1D62, (int16_t)0x7C95, (int16_t)0x1D31, (int16_t)0x7CA0,
+    (int16_t)0x1D01, (int16_t)0x7CAC, (int16_t)0x1CD0, (int16_t)0x7CB7, (int16_t)0x1C9F,
+    (int16_t)0x7CC2, (int16_t)0x1C6E, (int16_t)0x7CCE, (int16_t)0x1C3D, (int16_t)0x7CD9,
+    (int16_t)0x1C0C, (int16_t)0x7CE4, (int16_t)0x1BDA, (int16_t)0x7CEF, (int16_t)0x1BA9,
+    (int16_t)0x7CFA, (int16_t)0x1B78, (int16_t)0x7D05, (int16_t)0x1B47, (int16_t)0x7D0F,
+    (int16_t)0x1B16, (int16_t)0x7D1A, (int16_t)0x1AE5, (int16_t)0x7D25, (int16_t)0x1AB4,
+    (int16_t)0x7D2F, (int16_t)0x1A83, (int16_t)0x7D3A, (int16_t)0x1A51, (int16_t)0x7D44,
+    (int16_t)0x1A20, (int16_t)0x7D4E, (int16_t)0x19EF, (int16_t)0x7D58, (int16_t)0x19BE,
+    (int16_t)0x7D63, (int16_t)0x198D, (int16_t)0x7D6D, (int16_t)0x195B, (int16_t)0x7D77,
+    (int16_t)0x192A, (int16_t)0x7D81, (int16_t)0x18F9, (int16_t)0x7D8A, (int16_t)0x18C7,
+    (int16_t)0x7D94, (int16_t)0x1896, (int16_t)0x7D9E, (int16_t)0x1865, (int16_t)0x7DA7,
+    (int16_t)0x1833, (int16_t)0x7DB1, (int16_t)0x1802, (int16_t)0x7DBA, (int16_t)0x17D1,
+    (int16_t)0x7DC4, (int16_t)0x179F, (int16_t)0x7DCD, (int16_t)0x176E, (int16_t)0x7DD6,
+    (int16_t)0x173C, (int16_t)0x7DE0, (int16_t)0x170B, (int16_t)0x7DE9, (int16_t)0x16DA,
+    (int16_t)0x7DF2, (int16_t)0x16A8, (int16_t)0x7DFB, (int16_t)0x1677, (int16_t)0x7E03,
+    (int16_t)0x1645, (int16_t)0x7E0C, (int16_t)0x1614, (int16_t)0x7E15, (int16_t)0x15E2,
+    (int16_t)0x7E1E, (int16_t)0x15B1, (int16_t)0x7E26, (int16_t)0x157F, (int16_t)0x7E2F,
+    (int16_t)0x154D, (int16_t)0x7E37, (int16_t)0x151C, (int16_t)0x7E3F, (int16_t)0x14EA,
+    (int16_t)0x7E48, (int16_t)0x14B9, (int16_t)0x7E50, (int16_t)0x1487, (int16_t)0x7E58,
+    (int16_t)0x1455, (int16_t)0x7E60, (int16_t)0x1424, (int16_t)0x7E68, (int16_t)0x13F2,
+    (int16_t)0x7E70, (int16_t)0x13C1, (int16_t)0x7E78, (int16_t)0x138F, (int16_t)0x7E7F,
+    (int16_t)0x135D, (int16_t)0x7E87, (int16_t)0x132B, (int16_t)0x7E8E, (int16_t)0x12FA,
+    (int16_t)0x7E96, (int16_t)0x12C8, (int16_t)0x7E9D, (int16_t)0x1296, (int16_t)0x7EA5,
+    (int16_t)0x1265, (int16_t)0x7EAC, (int16_t)0x1233, (int16_t)0x7EB3, (int16_t)0x1201,
+    (int16_t)0x7EBA, (int16_t)0x11CF, (int16_t)0x7EC1, (int16_t)0x119E, (int16_t)0x7EC8,
+    (int16_t)0x116C, (int16_t)0x7ECF, (int16_t)0x113A, (int16_t)0x7ED6, (int16_t)0x1108,
+    (int16_t)0x7EDD, (int16_t)0x10D6, (int16_t)0x7EE3, (int16_t)0x10A4, (int16_t)0x7EEA,
+    (int16_t)0x1073, (int16_t)0x7EF0, (int16_t)0x1041, (int16_t)0x7EF7, (int16_t)0x100F,
+    (int16_t)0x7EFD, (int16_t)0x0FDD, (int16_t)0x7F03, (int16_t)0x0FAB, (int16_t)0x7F0A,
+    (int16_t)0x0F79, (int16_t)0x7F10, (int16_t)0x0F47, (int16_t)0x7F16, (int16_t)0x0F15,
+    (int16_t)0x7F1C, (int16_t)0x0EE4, (int16_t)0x7F22, (int16_t)0x0EB2, (int16_t)0x7F27,
+    (int16_t)0x0E80, (int16_t)0x7F2D, (int16_t)0x0E4E, (int16_t)0x7F33, (int16_t)0x0E1C,
+    (int16_t)0x7F38, (int16_t)0x0DEA, (int16_t)0x7F3E, (int16_t)0x0DB8, (int16_t)0x7F43,
+    (int16_t)0x0D86, (int16_t)0x7F49, (int16_t)0x0D54, (int16_t)0x7F4E, (int16_t)0x0D22,
+    (int16_t)0x7F53, (int16_t)0x0CF0, (int16_t)0x7F58, (int16_t)0x0CBE, (int16_t)0x7F5D,
+    (int16_t)0x0C8C, (int16_t)0x7F62, (int16_t)0x0C5A, (int16_t)0x7F67, (int16_t)0x0C28,
+    (int16_t)0x7F6C, (int16_t)0x0BF6, (int16_t)0x7F71, (int16_t)0x0BC4, (int16_t)0x7F75,
+    (int16_t)0x0B92, (int16_t)0x7F7A, (int16_t)0x0B60, (int16_t)0x7F7E, (int16_t)0x0B2D,
+    (int16_t)0x7F83, (int16_t)0x0AFB, (int16_t)0x7F87, (int16_t)0x0AC9, (int16_t)0x7F8B,
+    (int16_t)0x0A97, (int16_t)0x7F90, (int16_t)0x0A65, (int16_t)0x7F94, (int16_t)0x0A33,
+    (int16_t)0x7F98, (int16_t)0x0A01, (int16_t)0x7F9C, (int16_t)0x09CF, (int16_t)0x7FA0,
+    (int16_t)0x099D, (int16_t)0x7FA3, (int16_t)0x096B, (int16_t)0x7FA7, (int16_t)0x0938,
+    (int16_t)0x7FAB, (int16_t)0x0906, (int16_t)0x7FAE, (int16_t)0x08D4, (int16_t)0x7FB2,
+    (int16_t)0x08A2, (int16_t)0x7FB5, (int16_t)0x0870, (int16_t)0x7FB9, (int16_t)0x083E,
+    (int16_t)0x7FBC, (int16_t)0x080C, (int16_t)0x7FBF, (int16_t)0x07D9, (int16_t)0x7FC2,
+    (int16_t)0x07A7, (int16_t)0x7FC5, (int16_t)0x0775, (int16_t)0x7FC8, (int16_t)0x0743,
+    (int16_t)0x7FCB, (int16_t)0x0711, (int16_t)0x7FCE, (int16_t)0x06DE, (int16_t)0x7FD1,
+    (int16_t)0x06AC, (int16_t)0x7FD3, (int16_t)0x067A, (int16_t)0x7FD6, (int16_t)0x0648,
+    (int16_t)0x7FD9, (int16_t)0x0616, (int16_t)0x7FDB, (int16_t)0x05E3, (int16_t)0x7FDD,
+    (int16_t)0x05B1, (int16_t)0x7FE0, (int16_t)0x057F, (int16_t)0x7FE2, (int16_t)0x054D,
+    (int16_t)0x7FE4, (int16_t)0x051B, (int16_t)0x7FE6, (int16_t)0x04E8, (int16_t)0x7FE8,
+    (int16_t)0x04B6, (int16_t)0x7FEA, (int16_t)0x0484, (int16_t)0x7FEC, (int16_t)0x0452,
+    (int16_t)0x7FED, (int16_t)0x041F, (int16_t)0x7FEF, (int16_t)0x03ED, (int16_t)0x7FF1,
+    (int16_t)0x03BB, (int16_t)0x7FF2, (int16_t)0x0389, (int16_t)0x7FF4, (int16_t)0x0356,
+    (int16_t)0x7FF5, (int16_t)0x0324, (int16_t)0x7FF6, (int16_t)0x02F2, (int16_t)0x7FF7,
+    (int16_t)0x02C0, (int16_t)0x7FF8, (int16_t)0x028D, (int16_t)0x7FF9, (int16_t)0x025B,
+    (int16_t)0x7FFA, (int16_t)0x0229, (int16_t)0x7FFB, (int16_t)0x01F7, (int16_t)0x7FFC,
+    (int16_t)0x01C4, (int16_t)0x7FFD, (int16_t)0x0192, (int16_t)0x7FFE, (int16_t)0x0160,
+    (int16_t)0x7FFE, (int16_t)0x012E, (int16_t)0x7FFF, (int16_t)0x00FB, (int16_t)0x7FFF,
+    (int16_t)0x00C9, (int16_t)0x7FFF, (int16_t)0x0097, (int16_t)0x7FFF, (int16_t)0x0065,
+    (int16_t)0x7FFF, (int16_t)0x0032, (int16_t)0x7FFF
+};
+
+const int16_t twiddleCoef_dct_1024_q16[4096] = {
+    (int16_t)0x7FFF, (int16_t)0x0000, (int16_t)0x7FFF, (int16_t)0x0019, (int16_t)0x7FFF,
+    (int16_t)0x0032, (int16_t)0x7FFF, (int16_t)0x004B, (int16_t)0x7FFF, (int16_t)0x0065,
+    (int16_t)0x7FFF, (int16_t)0x007E, (int16_t)0x7FFF, (int16_t)0x0097, (int16_t)0x7FFF,
+    (int16_t)0x00B0, (int16_t)0x7FFF, (int16_t)0x00C9, (int16_t)0x7FFF, (int16_t)0x00E2,
+    (int16_t)0x7FFF, (int16_t)0x00FB, (int16_t)0x7FFF, (int16_t)0x0114, (int16_t)0x7FFF,
+    (int16_t)0x012E, (int16_t)0x7FFE, (int16_t)0x0147, (int16_t)0x7FFE, (int16_t)0x0160,
+    (int16_t)0x7FFE, (int16_t)0x0179, (int16_t)0x7FFE, (int16_t)0x0192, (int16_t)0x7FFD,
+    (int16_t)0x01AB, (int16_t)0x7FFD, (int16_t)0x01C4, (int16_t)0x7FFD, (int16_t)0x01DE,
+    (int16_t)0x7FFC, (int16_t)0x01F7, (int16_t)0x7FFC, (int16_t)0x0210, (int16_t)0x7FFB,
+    (int16_t)0x0229, (int16_t)0x7FFB, (int16_t)0x0242, (int16_t)0x7FFA, (int16_t)0x025B,
+    (int16_t)0x7FFA, (int16_t)0x0274, (int16_t)0x7FF9, (int16_t)0x028D, (int16_t)0x7FF9,
+    (int16_t)0x02A7, (int16_t)0x7FF8, (int16_t)0x02C0, (int16_t)0x7FF8, (int16_t)0x02D9,
+    (int16_t)0x7FF7, (int16_t)0x02F2, (int16_t)0x7FF7, (int16_t)0x030B, (int16_t)0x7FF6,
+    (int16_t)0x0324, (int16_t)0x7FF6, (int16_t)0x033D, (int16_t)0x7FF5, (int16_t)0x0356,
+    (int16_t)0x7FF4, (int16_t)0x0370, (int16_t)0x7FF4, (int16_t)0x0389, (int16_t)0x7FF3,
+    (int16_t)0x03A2, (int16_t)0x7FF2, (int16_t)0x03BB, (int16_t)0x7FF1, (int16_t)0x03D4,
+    (int16_t)0x7FF1, (int16_t)0x03ED, (int16_t)0x7FF0, (int16_t)0x0406, (int16_t)0x7FEF,
+    (int16_t)0x041F, (int16_t)0x7FEE, (int16_t)0x0439, (int16_t)0x7FED, (int16_t)0x0452,
+    (int16_t)0x7FEC, (int16_t)0x046B, (int16_t)0x7FEC, (int16_t)0x0484, (int16_t)0x7FEB,
+    (int16_t)0x049D, (int16_t)0x7FEA, (int16_t)0x04B6, (int16_t)0x7FE9, (int16_t)0x04CF,
+    (int16_t)0x7FE8, (int16_t)0x04E8, (int16_t)0x7FE7, (int16_t)0x0501, (int16_t)0x7FE6,
+    (int16_t)0x051B, (int16_t)0x7FE5, (int16_t)0x0534, (int16_t)0x7FE4, (int16_t)0x054D,
+    (int16_t)0x7FE3, (int16_t)0x0566, (int16_t)0x7FE2, (int16_t)0x057F, (int16_t)0x7FE1,
+    (int16_t)0x0598, (int16_t)0x7FE0, (int16_t)0x05B1, (int16_t)0x7FDE, (int16_t)0x05CA,
+    (int16_t)0x7FDD, (int16_t)0x05E3, (int16_t)0x7FDC, (int16_t)0x05FD, (int16_t)0x7FDB,
+    (int16_t)0x0616, (int16_t)0x7FDA, (int16_t)0x062F, (int16_t)0x7FD9, (int16_t)0x0648,
+    (int16_t)0x7FD7, (int16_t)0x0661, (int16_t)0x7FD6, (int16_t)0x067A, (int16_t)0x7FD5,
+    (int16_t)0x0693, (int16_t)0x7FD3, (int16_t)0x06AC, (int16_t)0x7FD2, (int16_t)0x06C5,
+    (int16_t)0x7FD1, (int16_t)0x06DE, (int16_t)0x7FCF, (int16_t)0x06F8, (int16_t)0x7FCE,
+    (int16_t)0x0711, (int16_t)0x7FCD, (int16_t)0x072A, (int16_t)0x7FCB, (int16_t)0x0743,
+    (int16_t)0x7FCA, (int16_t)0x075C, (int16_t)0x7FC8, (int16_t)0x0775, (int16_t)0x7FC7,
+    (int16_t)0x078E, (int16_t)0x7FC5, (int16_t)0x07A7, (int16_t)0x7FC4, (int16_t)0x07C0,
+    (int16_t)0x7FC2, (int16_t)0x07D9, (int16_t)0x7FC1, (int16_t)0x07F2, (int16_t)0x7FBF,
+    (int16_t)0x080C, (int16_t)0x7FBE, (int16_t)0x0825, (int16_t)0x7FBC, (int16_t)0x083E,
+    (int16_t)0x7FBA, (int16_t)0x0857, (int16_t)0x7FB9, (int16_t)0x0870, (int16_t)0x7FB7,
+    (int16_t)0x0889, (int16_t)0x7FB5, (int16_t)0x08A2, (int16_t)0x7FB4, (int16_t)0x08BB,
+    (int16_t)0x7FB2, (int16_t)0x08D4, (int16_t)0x7FB0, (int16_t)0x08ED, (int16_t)0x7FAE,
+    (int16_t)0x0906, (int16_t)0x7FAD, (int16_t)0x091F, (int16_t)0x7FAB, (int16_t)0x0938,
+    (int16_t)0x7FA9, (int16_t)0x0951, (int16_t)0x7FA7, (int16_t)0x096B, (int16_t)0x7FA5,
+    (int16_t)0x0984, (int16_t)0x7FA3, (int16_t)0x099D, (int16_t)0x7FA2, (int16_t)0x09B6,
+    (int16_t)0x7FA0, (int16_t)0x09CF, (int16_t)0x7F9E, (int16_t)0x09E8, (int16_t)0x7F9C,
+    (int16_t)0x0A01, (int16_t)0x7F9A, (int16_t)0x0A1A, (int16_t)0x7F98, (int16_t)0x0A33,
+    (int16_t)0x7F96, (int16_t)0x0A4C, (int16_t)0x7F94, (int16_t)0x0A65, (int16_t)0x7F92,
+    (int16_t)0x0A7E, (int16_t)0x7F90, (int16_t)0x0A97, (int16_t)0x7F8E, (int16_t)0x0AB0,
+    (int16_t)0x7F8B, (int16_t)0x0AC9, (int16_t)0x7F89, (int16_t)0x0AE2, (int16_t)0x7F87,
+    (int16_t)0x0AFB, (int16_t)0x7F85, (int16_t)0x0B14, (int16_t)0x7F83, (int16_t)0x0B2D,
+    (int16_t)0x7F81, (int16_t)0x0B47, (int16_t)0x7F7E, (int16_t)0x0B60, (int16_t)0x7F7C,
+    (int16_t)0x0B79, (int16_t)0x7F7A, (int16_t)0x0B92, (int16_t)0x7F78, (int16_t)0x0BAB,
+    (int16_t)0x7F75, (int16_t)0x0BC4, (int16_t)0x7F73, (int16_t)0x0BDD, (int16_t)0x7F71,
+    (int16_t)0x0BF6, (int16_t)0x7F6E, (int16_t)0x0C0F, (int16_t)0x7F6C, (int16_t)0x0C28,
+    (int16_t)0x7F6A, (int16_t)0x0C41, (int16_t)0x7F67, (int16_t)0x0C5A, (int16_t)0x7F65,
+    (int16_t)0x0C73, (int16_t)0x7F62, (int16_t)0x0C8C, (int16_t)0x7F60, (int16_t)0x0CA5,
+    (int16_t)0x7F5D, (int16_t)0x0CBE, (int16_t)0x7F5B, (int16_t)0x0CD7, (int16_t)0x7F58,
+    (int16_t)0x0CF0, (int16_t)0x7F56, (int16_t)0x0D09, (int16_t)0x7F53, (int16_t)0x0D22,
+    (int16_t)0x7F50, (int16_t)0x0D3B, (int16_t)0x7F4E, (int16_t)0x0D54, (int16_t)0x7F4B,
+    (int16_t)0x0D6D, (int16_t)0x7F49, (int16_t)0x0D86, (int16_t)0x7F46, (int16_t)0x0D9F,
+    (int16_t)0x7F43, (int16_t)0x0DB8, (int16_t)0x7F41, (int16_t)0x0DD1, (int16_t)0x7F3E,
+    (int16_t)0x0DEA, (int16_t)0x7F3B, (int16_t)0x0E03, (int16_t)0x7F38, (int16_t)0x0E1C,
+    (int16_t)0x7F36, (int16_t)0x0E35, (int16_t)0x7F33, (int16_t)0x0E4E, (int16_t)0x7F30,
+    (int16_t)0x0E67, (int16_t)0x7F2D, (int16_t)0x0E80, (int16_t)0x7F2A, (int16_t)0x0E99,
+    (int16_t)0x7F27, (int16_t)0x0EB2, (int16_t)0x7F24, (int16_t)0x0ECB, (int16_t)0x7F22,
+    (int16_t)0x0EE4, (int16_t)0x7F1F, (int16_t)0x0EFC, (int16_t)0x7F1C, (int16_t)0x0F15,
+    (int16_t)0x7F19, (int16_t)0x0F2E, (int16_t)0x7F16, (int16_t)0x0F47, (int16_t)0x7F13,
+    (int16_t)0x0F60, (int16_t)0x7F10, (int16_t)0x0F79, (int16_t)0x7F0D, (int16_t)0x0F92,
+    (int16_t)0x7F0A, (int16_t)0x0FAB, (int16_t)0x7F06, (int16_t)0x0FC4, (int16_t)0x7F03,
+    (int16_t)0x0FDD, (int16_t)0x7F00, (int16_t)0x0FF6, (int16_t)0x7EFD, (int16_t)0x100F,
+    (int16_t)0x7EFA, (int16_t)0x1028, (int16_t)0x7EF7, (int16_t)0x1041, (int16_t)0x7EF4,
+    (int16_t)0x105A, (int16_t)0x7EF0, (int16_t)0x1073, (int16_t)0x7EED, (int16_t)0x108C,
+    (int16_t)0x7EEA, (int16_t)0x10A4, (int16_t)0x7EE7, (int16_t)0x10BD, (int16_t)0x7EE3,
+    (int16_t)0x10D6, (int16_t)0x7EE0, (int16_t)0x10EF, (int16_t)0x7EDD, (int16_t)0x1108,
+    (int16_t)0x7ED9, (int16_t)0x1121, (int16_t)0x7ED6, (int16_t)0x113A, (int16_t)0x7ED3,
+    (int16_t)0x1153, (int16_t)0x7ECF, (int16_t)0x116C, (int16_t)0x7ECC, (int16_t)0x1185,
+    (int16_t)0x7EC8, (int16_t)0x119E, (int16_t)0x7EC5, (int16_t)0x11B6, (int16_t)0x7EC1,
+    (int16_t)0x11CF, (int16_t)0x7EBE, (int16_t)0x11E8, (int16_t)0x7EBA, (int16_t)0x1201,
+    (int16_t)0x7EB7, (int16_t)0x121A, (int16_t)0x7EB3, (int16_t)0x1233, (int16_t)0x7EB0,
+    (int16_t)0x124C, (int16_t)0x7EAC, (int16_t)0x1265, (int16_t)0x7EA8, (int16_t)0x127D,
+    (int16_t)0x7EA5, (int16_t)0x1296, (int16_t)0x7EA1, (int16_t)0x12AF, (int16_t)0x7E9D,
+    (int16_t)0x12C8, (int16_t)0x7E9A, (int16_t)0x12E1, (int16_t)0x7E96, (int16_t)0x12FA,
+    (int16_t)0x7E92, (int16_t)0x1313, (int16_t)0x7E8E, (int16_t)0x132B, (int16_t)0x7E8B,
+    (int16_t)0x1344, (int16_t)0x7E87, (int16_t)0x135D, (int16_t)0x7E83, (int16_t)0x1376,
+    (int16_t)0x7E7F, (int16_t)0x138F, (int16_t)0x7E7B, (int16_t)0x13A8, (int16_t)0x7E78,
+    (int16_t)0x13C1, (int16_t)0x7E74, (int16_t)0x13D9, (int16_t)0x7E70, (int16_t)0x13F2,
+    (int16_t)0x7E6C, (int16_t)0x140B, (int16_t)0x7E68, (int16_t)0x1424, (int16_t)0x7E64,
+    (int16_t)0x143D, (int16_t)0x7E60, (int16_t)0x1455, (int16_t)0x7E5C, (int16_t)0x146E,
+    (int16_t)0x7E58, (int16_t)0x1487, (int16_t)0x7E54, (int16_t)0x14A0, (int16_t)0x7E50,
+    (int16_t)0x14B9, (int16_t)0x7E4C, (int16_t)0x14D1, (int16_t)0x7E48, (int16_t)0x14EA,
+    (int16_t)0x7E43, (int16_t)0x1503, (int16_t)0x7E3F, (int16_t)0x151C, (int16_t)0x7E3B,
+    (int16_t)0x1535, (int16_t)0x7E37, (int16_t)0x154D, (int16_t)0x7E33, (int16_t)0x1566,
+    (int16_t)0x7E2F, (int16_t)0x157F, (int16_t)0x7E2A, (int16_t)0x1598, (int16_t)0x7E26,
+    (int16_t)0x15B1, (int16_t)0x7E22, (int16_t)0x15C9, (int16_t)0x7E1E, (int16_t)0x15E2,
+    (int16_t)0x7E19, (int16_t)0x15FB, (int16_t)0x7E15, (int16_t)0x1614, (int16_t)0x7E11,
+    (int16_t)0x162C, (int16_t)0x7E0C, (int16_t)0x1645, (int16_t)0x7E08, (int16_t)0x165E,
+    (int16_t)0x7E03, (int16_t)0x1677, (int16_t)0x7DFF, (int16_t)0x168F, (int16_t)0x7DFB,
+    (int16_t)0x16A8, (int16_t)0x7DF6, (int16_t)0x16C1, (int16_t)0x7DF2, (int16_t)0x16DA,
+    (int16_t)0x7DED, (int16_t)0x16F2, (int16_t)0x7DE9, (int16_t)0x170B, (int16_t)0x7DE4,
+    (int16_t)0x1724, (int16_t)0x7DE0, (int16_t)0x173C, (int16_t)0x7DDB, (int16_t)0x1755,
+    (int16_t)0x7DD6, (int16_t)0x176E, (int16_t)0x7DD2, (int16_t)0x1787, (int16_t)0x7DCD,
+    (int16_t)0x179F, (int16_t)0x7DC9, (int16_t)0x17B8, (int16_t)0x7DC4, (int16_t)0x17D1,
+    (int16_t)0x7DBF, (int16_t)0x17E9, (int16_t)0x7DBA, (int16_t)0x1802, (int16_t)0x7DB6,
+    (int16_t)0x181B, (int16_t)0x7DB1, (int16_t)0x1833, (int16_t)0x7DAC, (int16_t)0x184C,
+    (int16_t)0x7DA7, (int16_t)0x1865, (int16_t)0x7DA3, (int16_t)0x187D, (int16_t)0x7D9E,
+    (int16_t)0x1896, (int16_t)0x7D99, (int16_t)0x18AF, (int16_t)0x7D94, (int16_t)0x18C7,
+    (int16_t)0x7D8F, (int16_t)0x18E0, (int16_t)0x7D8A, (int16_t)0x18F9, (int16_t)0x7D85,
+    (int16_t)0x1911, (int16_t)0x7D81, (int16_t)0x192A, (int16_t)0x7D7C, (int16_t)0x1943,
+    (int16_t)0x7D77, (int16_t)0x195B, (int16_t)0x7D72, (int16_t)0x1974, (int16_t)0x7D6D,
+    (int16_t)0x198D, (int16_t)0x7D68, (int16_t)0x19A5, (int16_t)0x7D63, (int16_t)0x19BE,
+    (int16_t)0x7D5D, (int16_t)0x19D6, (int16_t)0x7D58, (int16_t)0x19EF, (int16_t)0x7D53,
+    (int16_t)0x1A08, (int16_t)0x7D4E, (int16_t)0x1A20, (int16_t)0x7D49, (int16_t)0x1A39,
+    (int16_t)0x7D44, (int16_t)0x1A51, (int16_t)0x7D3F, (int16_t)0x1A6A, (int16_t)0x7D3A,
+    (int16_t)0x1A83, (int16_t)0x7D34, (int16_t)0x1A9B, (int16_t)0x7D2F, (int16_t)0x1AB4,
+    (int16_t)0x7D2A, (int16_t)0x1ACC, (int16_t)0x7D25, (int16_t)0x1AE5, (int16_t)0x7D1F,
+    (int16_t)0x1AFE, (int16_t)0x7D1A, (int16_t)0x1B16, (int16_t)0x7D15, (int16_t)0x1B2F,
+    (int16_t)0x7D0F, (int16_t)0x1B47, (int16_t)0x7D0A, (int16_t)0x1B60, (int16_t)0x7D05,
+    (int16_t)0x1B78, (int16_t)0x7CFF, (int16_t)0x1B91, (int16_t)0x7CFA, (int16_t)0x1BA9,
+    (int16_t)0x7CF4, (int16_t)0x1BC2, (int16_t)0x7CEF, (int16_t)0x1BDA, (int16_t)0x7CE9,
+    (int16_t)0x1BF3, (int16_t)0x7CE4, (int16_t)0x1C0C, (int16_t)0x7CDE, (int16_t)0x1C24,
+    (int16_t)0x7CD9, (int16_t)0x1C3D, (int16_t)0x7CD3, (int16_t)0x1C55, (int16_t)0x7CCE,
+    (int16_t)0x1C6E, (int16_t)0x7CC8, (int16_t)0x1C86, (int16_t)0x7CC2, (int16_t)0x1C9F,
+    (int16_t)0x7CBD, (int16_t)0x1CB7, (int16_t)0x7CB7, (int16_t)0x1CD0, (int16_t)0x7CB1,
+    (int16_t)0x1CE8, (int16_t)0x7CAC, (int16_t)0x1D01, (int16_t)0x7CA6, (int16_t)0x1D19,
+    (int16_t)0x7CA0, (int16_t)0x1D31, (int16_t)0x7C9B, (int16_t)0x1D4A, (int16_t)0x7C95,
+    (int16_t)0x1D62, (int16_t)0x7C8F, (int16_t)0x1D7B, (int16_t)0x7C89, (int16_t)0x1D93,
+    (int16_t)0x7C83, (int16_t)0x1DAC, (int16_t)0x7C7E, (int16_t)0x1DC4, (int16_t)0x7C78,
+    (int16_t)0x1DDD, (int16_t)0x7C72, (int16_t)0x1DF5, (int16_t)0x7C6C, (int16_t)0x1E0E,
+    (int16_t)0x7C66, (int16_t)0x1E26, (int16_t)0x7C60, (int16_t)0x1E3E, (int16_t)0x7C5A,
+    (int16_t)0x1E57, (int16_t)0x7C54, (int16_t)0x1E6F, (int16_t)0x7C4E, (int16_t)0x1E88,
+    (int16_t)0x7C48, (int16_t)0x1EA0, (int16_t)0x7C42, (int16_t)0x1EB8, (int16_t)0x7C3C,
+    (int16_t)0x1ED1, (int16_t)0x7C36, (int16_t)0x1EE9, (int16_t)0x7C30, (int16_t)0x1F02,
+    (int16_t)0x7C2A, (int16_t)0x1F1A, (int16_t)0x7C24, (int16_t)0x1F32, (int16_t)0x7C1E,
+    (int16_t)0x1F4B, (int16_t)0x7C18, (int16_t)0x1F63, (int16_t)0x7C11, (int16_t)0x1F7B,
+    (int16_t)0x7C0B, (int16_t)0x1F94, (int16_t)0x7C05, (int16_t)0x1FAC, (int16_t)0x7BFF,
+    (int16_t)0x1FC5, (int16_t)0x7BF9, (int16_t)0x1FDD, (int16_t)0x7BF2, (int16_t)0x1FF5,
+    (int16_t)0x7BEC, (int16_t)0x200E, (int16_t)0x7BE6, (int16_t)0x2026, (int16_t)0x7BDF,
+    (int16_t)0x203E, (int16_t)0x7BD9, (int16_t)0x2057, (int16_t)0x7BD3, (int16_t)0x206F,
+    (int16_t)0x7BCC, (int16_t)0x2087, (int16_t)0x7BC6, (int16_t)0x209F, (int16_t)0x7BBF,
+    (int16_t)0x20B8, (int16_t)0x7BB9, (int16_t)0x20D0, (int16_t)0x7BB3, (int16_t)0x20E8,
+    (int16_t)0x7BAC, (int16_t)0x2101, (int16_t)0x7BA6, (int16_t)0x2119, (int16_t)0x7B9F,
+    (int16_t)0x2131, (int16_t)0x7B99, (int16_t)0x2149, (int16_t)0x7B92, (int16_t)0x2162,
+    (int16_t)0x7B8B, (int16_t)0x217A, (int16_t)0x7B85, (int16_t)0x2192, (int16_t)0x7B7E,
+    (int16_t)0x21AA, (int16_t)0x7B78, (int16_t)0x21C3, (int16_t)0x7B71, (int16_t)0x21DB,
+    (int16_t)0x7B6A, (int16_t)0x21F3, (int16_t)0x7B64, (int16_t)0x220B, (int16_t)0x7B5D,
+    (int16_t)0x2224, (int16_t)0x7B56, (int16_t)0x223C, (int16_t)0x7B50, (int16_t)0x2254,
+    (int16_t)0x7B49, (int16_t)0x226C, (int16_t)0x7B42, (int16_t)0x2284, (int16_t)0x7B3B,
+    (int16_t)0x229D, (int16_t)0x7B34, (int16_t)0x22B5, (int16_t)0x7B2E, (int16_t)0x22CD,
+    (int16_t)0x7B27, (int16_t)0x22E5, (int16_t)0x7B20, (int16_t)0x22FD, (int16_t)0x7B19,
+    (int16_t)0x2316, (int16_t)0x7B12, (int16_t)0x232E, (int16_t)0x7B0B, (int16_t)0x2346,
+    (int16_t)0x7B04, (int16_t)0x235E, (int16_t)0x7AFD, (int16_t)0x2376, (int16_t)0x7AF6,
+    (int16_t)0x238E, (int16_t)0x7AEF, (int16_t)0x23A7, (int16_t)0x7AE8, (int16_t)0x23BF,
+    (int16_t)0x7AE1, (int16_t)0x23D7, (int16_t)0x7ADA, (int16_t)0x23EF, (int16_t)0x7AD3,
+    (int16_t)0x2407, (int16_t)0x7ACC, (int16_t)0x241F, (int16_t)0x7AC5, (int16_t)0x2437,
+    (int16_t)0x7ABE, (int16_t)0x244F, (int16_t)0x7AB7, (int16_t)0x2467, (int16_t)0x7AB0,
+    (int16_t)0x2480, (int16_t)0x7AA8, (int16_t)0x2498, (int16_t)0x7AA1, (int16_t)0x24B0,
+    (int16_t)0x7A9A, (int16_t)0x24C8, (int16_t)0x7A93, (int16_t)0x24E0, (int16_t)0x7A8C,
+    (int16_t)0x24F8, (int16_t)0x7A84, (int16_t)0x2510, (int16_t)0x7A7D, (int16_t)0x2528,
+    (int16_t)0x7A76, (int16_t)0x2540, (int16_t)0x7A6E, (int16_t)0x2558, (int16_t)0x7A67,
+    (int16_t)0x2570, (int16_t)0x7A60, (int16_t)0x2588, (int16_t)0x7A58, (int16_t)0x25A0,
+    (int16_t)0x7A51, (int16_t)0x25B8, (int16_t)0x7A49, (int16_t)0x25D0, (int16_t)0x7A42,
+    (int16_t)0x25E8, (int16_t)0x7A3B, (int16_t)0x2600, (int16_t)0x7A33, (int16_t)0x2618,
+    (int16_t)0x7A2C, (int16_t)0x2630, (int16_t)0x7A24, (int16_t)0x2648, (int16_t)0x7A1D,
+    (int16_t)0x2660, (int16_t)0x7A15, (int16_t)0x2678, (int16_t)0x7A0E, (int16_t)0x2690,
+    (int16_t)0x7A06, (int16_t)0x26A8, (int16_t)0x79FE, (int16_t)0x26C0, (int16_t)0x79F7,
+    (int16_t)0x26D8, (int16_t)0x79EF, (int16_t)0x26F0, (int16_t)0x79E7, (int16_t)0x2708,
+    (int16_t)0x79E0, (int16_t)0x2720, (int16_t)0x79D8, (int16_t)0x2738, (int16_t)0x79D0,
+    (int16_t)0x2750, (int16_t)0x79C9, (int16_t)0x2768, (int16_t)0x79C1, (int16_t)0x2780,
+    (int16_t)0x79B9, (int16_t)0x2797, (int16_t)0x79B1, (int16_t)0x27AF, (int16_t)0x79AA,
+    (int16_t)0x27C7, (int16_t)0x79A2, (int16_t)0x27DF, (int16_t)0x799A, (int16_t)0x27F7,
+    (int16_t)0x7992, (int16_t)0x280F, (int16_t)0x798A, (int16_t)0x2827, (int16_t)0x7982,
+    (int16_t)0x283F, (int16_t)0x797A, (int16_t)0x2856, (int16_t)0x7972, (int16_t)0x286E,
+    (int16_t)0x796A, (int16_t)0x2886, (int16_t)0x7962, (int16_t)0x289E, (int16_t)0x795B,
+    (int16_t)0x28B6, (int16_t)0x7953, (int16_t)0x28CE, (int16_t)0x794A, (int16_t)0x28E5,
+    (int16_t)0x7942, (int16_t)0x28FD, (int16_t)0x793A, (int16_t)0x2915, (int16_t)0x7932,
+    (int16_t)0x292D, (int16_t)0x792A, (int16_t)0x2945, (int16_t)0x7922, (int16_t)0x295C,
+    (int16_t)0x791A, (int16_t)0x2974, (int16_t)0x7912, (int16_t)0x298C, (int16_t)0x790A,
+    (int16_t)0x29A4, (int16_t)0x7901, (int16_t)0x29BC, (int16_t)0x78F9, (int16_t)0x29D3,
+    (int16_t)0x78F1, (int16_t)0x29EB, (int16_t)0x78E9, (int16_t)0x2A03, (int16_t)0x78E1,
+    (int16_t)0x2A1B, (int16_t)0x78D8, (int16_t)0x2A32, (int16_t)0x78D0, (int16_t)0x2A4A,
+    (int16_t)0x78C8, (int16_t)0x2A62, (int16_t)0x78BF, (int16_t)0x2A79, (int16_t)0x78B7,
+    (int16_t)0x2A91, (int16_t)0x78AF, (int16_t)0x2AA9, (int16_t)0x78A6, (int16_t)0x2AC1,
+    (int16_t)0x789E, (int16_t)0x2AD8, (int16_t)0x7895, (int16_t)0x2AF0, (int16_t)0x788D,
+    (int16_t)0x2B08, (int16_t)0x7885, (int16_t)0x2B1F, (int16_t)0x787C, (int16_t)0x2B37,
+    (int16_t)0x7874, (int16_t)0x2B4F, (int16_t)0x786B, (int16_t)0x2B66, (int16_t)0x7863,
+    (int16_t)0x2B7E, (int16_t)0x785A, (int16_t)0x2B95, (int16_t)0x7851, (int16_t)0x2BAD,
+    (int16_t)0x7849, (int16_t)0x2BC5, (int16_t)0x7840, (int16_t)0x2BDC, (int16_t)0x7838,
+    (int16_t)0x2BF4, (int16_t)0x782F, (int16_t)0x2C0C, (int16_t)0x7826, (int16_t)0x2C23,
+    (int16_t)0x781E, (int16_t)0x2C3B, (int16_t)0x7815, (int16_t)0x2C52, (int16_t)0x780C,
+    (int16_t)0x2C6A, (int16_t)0x7803, (int16_t)0x2C81, (int16_t)0x77FB, (int16_t)0x2C99,
+    (int16_t)0x77F2, (int16_t)0x2CB1, (int16_t)0x77E9, (int16_t)0x2CC8, (int16_t)0x77E0,
+    (int16_t)0x2CE0, (int16_t)0x77D8, (int16_t)0x2CF7, (int16_t)0x77CF, (int16_t)0x2D0F,
+    (int16_t)0x77C6, (int16_t)0x2D26, (int16_t)0x77BD, (int16_t)0x2D3E, (int16_t)0x77B4,
+    (int16_t)0x2D55, (int16_t)0x77AB, (int16_t)0x2D6D, (int16_t)0x77A2, (int16_t)0x2D84,
+    (int16_t)0x7799, (int16_t)0x2D9C, (int16_t)0x7790, (int16_t)0x2DB3, (int16_t)0x7787,
+    (int16_t)0x2DCB, (int16_t)0x777E, (int16_t)0x2DE2, (int16_t)0x7775, (int16_t)0x2DFA,
+    (int16_t)0x776C, (int16_t)0x2E11, (int16_t)0x7763, (int16_t)0x2E28, (int16_t)0x775A,
+    (int16_t)0x2E40, (int16_t)0x7751, (int16_t)0x2E57, (int16_t)0x7748, (int16_t)0x2E6F,
+    (int16_t)0x773F, (int16_t)0x2E86, (int16_t)0x7736, (int16_t)0x2E9E, (int16_t)0x772D,
+    (int16_t)0x2EB5, (int16_t)0x7723, (int16_t)0x2ECC, (int16_t)0x771A, (int16_t)0x2EE4,
+    (int16_t)0x7711, (int16_t)0x2EFB, (int16_t)0x7708, (int16_t)0x2F13, (int16_t)0x76FE,
+    (int16_t)0x2F2A, (int16_t)0x76F5, (int16_t)0x2F41, (int16_t)0x76EC, (int16_t)0x2F59,
+    (int16_t)0x76E3, (int16_t)0x2F70, (int16_t)0x76D9, (int16_t)0x2F87, (int16_t)0x76D0,
+    (int16_t)0x2F9F, (int16_t)0x76C7, (int16_t)0x2FB6, (int16_t)0x76BD, (int16_t)0x2FCD,
+    (int16_t)0x76B4, (int16_t)0x2FE5, (int16_t)0x76AA, (int16_t)0x2FFC, (int16_t)0x76A1,
+    (int16_t)0x3013, (int16_t)0x7698, (int16_t)0x302A, (int16_t)0x768E, (int16_t)0x3042,
+    (int16_t)0x7685, (int16_t)0x3059, (int16_t)0x767B, (int16_t)0x3070, (int16_t)0x7672,
+    (int16_t)0x3088, (int16_t)0x7668, (int16_t)0x309F, (int16_t)0x765E, (int16_t)0x30B6,
+    (int16_t)0x7655, (int16_t)0x30CD, (int16_t)0x764B, (int16_t)0x30E5, (int16_t)0x7642,
+    (int16_t)0x30FC, (int16_t)0x7638, (int16_t)0x3113, (int16_t)0x762E, (int16_t)0x312A,
+    (int16_t)0x7625, (int16_t)0x3141, (int16_t)0x761B, (int16_t)0x3159, (int16_t)0x7611,
+    (int16_t)0x3170, (int16_t)0x7608, (int16_t)0x3187, (int16_t)0x75FE, (int16_t)0x319E,
+    (int16_t)0x75F4, (int16_t)0x31B5, (int16_t)0x75EA, (int16_t)0x31CC, (int16_t)0x75E1,
+    (int16_t)0x31E4, (int16_t)0x75D7, (int16_t)0x31FB, (int16_t)0x75CD, (int16_t)0x3212,
+    (int16_t)0x75C3, (int16_t)0x3229, (int16_t)0x75B9, (int16_t)0x3240, (int16_t)0x75AF,
+    (int16_t)0x3257, (int16_t)0x75A6, (int16_t)0x326E, (int16_t)0x759C, (int16_t)0x3285,
+    (int16_t)0x7592, (int16_t)0x329D, (int16_t)0x7588, (int16_t)0x32B4, (int16_t)0x757E,
+    (int16_t)0x32CB, (int16_t)0x7574, (int16_t)0x32E2, (int16_t)0x756A, (int16_t)0x32F9,
+    (int16_t)0x7560, (int16_t)0x3310, (int16_t)0x7556, (int16_t)0x3327, (int16_t)0x754C,
+    (int16_t)0x333E, (int16_t)0x7542, (int16_t)0x3355, (int16_t)0x7538, (int16_t)0x336C,
+    (int16_t)0x752D, (int16_t)0x3383, (int16_t)0x7523, (int16_t)0x339A, (int16_t)0x7519,
+    (int16_t)0x33B1, (int16_t)0x750F, (int16_t)0x33C8, (int16_t)0x7505, (int16_t)0x33DF,
+    (int16_t)0x74FB, (int16_t)0x33F6, (int16_t)0x74F0, (int16_t)0x340D, (int16_t)0x74E6,
+    (int16_t)0x3424, (int16_t)0x74DC, (int16_t)0x343B, (int16_t)0x74D2, (int16_t)0x3452,
+    (int16_t)0x74C7, (int16_t)0x3469, (int16_t)0x74BD, (int16_t)0x3480, (int16_t)0x74B3,
+    (int16_t)0x3497, (int16_t)0x74A8, (int16_t)0x34AD, (int16_t)0x749E, (int16_t)0x34C4,
+    (int16_t)0x7494, (int16_t)0x34DB, (int16_t)0x7489, (int16_t)0x34F2, (int16_t)0x747F,
+    (int16_t)0x3509, (int16_t)0x7475, (int16_t)0x3520, (int16_t)0x746A, (int16_t)0x3537,
+    (int16_t)0x7460, (int16_t)0x354E, (int16_t)0x7455, (int16_t)0x3564, (int16_t)0x744B,
+    (int16_t)0x357B, (int16_t)0x7440, (int16_t)0x3592, (int16_t)0x7436, (int16_t)0x35A9,
+    (int16_t)0x742B, (int16_t)0x35C0, (int16_t)0x7421, (int16_t)0x35D7, (int16_t)0x7416,
+    (int16_t)0x35ED, (int16_t)0x740B, (int16_t)0x3604, (int16_t)0x7401, (int16_t)0x361B,
+    (int16_t)0x73F6, (int16_t)0x3632, (int16_t)0x73EB, (int16_t)0x3648, (int16_t)0x73E1,
+    (int16_t)0x365F, (int16_t)0x73D6, (int16_t)0x3676, (int16_t)0x73CB, (int16_t)0x368D,
+    (int16_t)0x73C1, (int16_t)0x36A3, (int16_t)0x73B6, (int16_t)0x36BA, (int16_t)0x73AB,
+    (int16_t)0x36D1, (int16_t)0x73A0, (int16_t)0x36E8, (int16_t)0x7396, (int16_t)0x36FE,
+    (int16_t)0x738B, (int16_t)0x3715, (int16_t)0x7380, (int16_t)0x372C, (int16_t)0x7375,
+    (int16_t)0x3742, (int16_t)0x736A, (int16_t)0x3759, (int16_t)0x735F, (int16_t)0x3770,
+    (int16_t)0x7355, (int16_t)0x3786, (int16_t)0x734A, (int16_t)0x379D, (int16_t)0x733F,
+    (int16_t)0x37B4, (int16_t)0x7334, (int16_t)0x37CA, (int16_t)0x7329, (int16_t)0x37E1,
+    (int16_t)0x731E, (int16_t)0x37F7, (int16_t)0x7313, (int16_t)0x380E, (int16_t)0x7308,
+    (int16_t)0x3825, (int16_t)0x72FD, (int16_t)0x383B, (int16_t)0x72F2, (int16_t)0x3852,
+    (int16_t)0x72E7, (int16_t)0x3868, (int16_t)0x72DC, (int16_t)0x387F, (int16_t)0x72D0,
+    (int16_t)0x3895, (int16_t)0x72C5, (int16_t)0x38AC, (int16_t)0x72BA, (int16_t)0x38C2,
+    (int16_t)0x72AF, (int16_t)0x38D9, (int16_t)0x72A4, (int16_t)0x38F0, (int16_t)0x7299,
+    (int16_t)0x3906, (int16_t)0x728D, (int16_t)0x391D, (int16_t)0x7282, (int16_t)0x3933,
+    (int16_t)0x7277, (int16_t)0x3949, (int16_t)0x726C, (int16_t)0x3960, (int16_t)0x7260,
+    (int16_t)0x3976, (int16_t)0x7255, (int16_t)0x398D, (int16_t)0x724A, (int16_t)0x39A3,
+    (int16_t)0x723F, (int16_t)0x39BA, (int16_t)0x7233, (int16_t)0x39D0, (int16_t)0x7228,
+    (int16_t)0x39E7, (int16_t)0x721C, (int16_t)0x39FD, (int16_t)0x7211, (int16_t)0x3A13,
+    (int16_t)0x7206, (int16_t)0x3A2A, (int16_t)0x71FA, (int16_t)0x3A40, (int16_t)0x71EF,
+    (int16_t)0x3A57, (int16_t)0x71E3, (int16_t)0x3A6D, (int16_t)0x71D8, (int16_t)0x3A83,
+    (int16_t)0x71CC, (int16_t)0x3A9A, (int16_t)0x71C1, (int16_t)0x3AB0, (int16_t)0x71B5,
+    (int16_t)0x3AC6, (int16_t)0x71AA, (int16_t)0x3ADD, (int16_t)0x719E, (int16_t)0x3AF3,
+    (int16_t)0x7193, (int16_t)0x3B09, (int16_t)0x7187, (int16_t)0x3B20, (int16_t)0x717B,
+    (int16_t)0x3B36, (int16_t)0x7170, (int16_t)0x3B4C, (int16_t)0x7164, (int16_t)0x3B62,
+    (int16_t)0x7158, (int16_t)0x3B79, (int16_t)0x714D, (int16_t)0x3B8F, (int16_t)0x7141,
+    (int16_t)0x3BA5, (int16_t)0x7135, (int16_t)0x3BBB, (int16_t)0x712A, (int16_t)0x3BD2,
+    (int16_t)0x711E, (int16_t)0x3BE8, (int16_t)0x7112, (int16_t)0x3BFE, (int16_t)0x7106,
+    (int16_t)0x3C14, (int16_t)0x70FA, (int16_t)0x3C2A, (int16_t)0x70EF, (int16_t)0x3C41,
+    (int16_t)0x70E3, (int16_t)0x3C57, (int16_t)0x70D7, (int16_t)0x3C6D, (int16_t)0x70CB,
+    (int16_t)0x3C83, (int16_t)0x70BF, (int16_t)0x3C99, (int16_t)0x70B3, (int16_t)0x3CAF,
+    (int16_t)0x70A7, (int16_t)0x3CC5, (int16_t)0x709B, (int16_t)0x3CDC, (int16_t)0x708F,
+    (int16_t)0x3CF2, (int16_t)0x7083, (int16_t)0x3D08, (int16_t)0x7077, (int16_t)0x3D1E,
+    (int16_t)0x706B, (int16_t)0x3D34, (int16_t)0x705F, (int16_t)0x3D4A, (int16_t)0x7053,
+    (int16_t)0x3D60, (int16_t)0x7047, (int16_t)0x3D76, (int16_t)0x703B, (int16_t)0x3D8C,
+    (int16_t)0x702F, (int16_t)0x3DA2, (int16_t)0x7023, (int16_t)0x3DB8, (int16_t)0x7017,
+    (int16_t)0x3DCE, (int16_t)0x700B, (int16_t)0x3DE4, (int16_t)0x6FFF, (int16_t)0x3DFA,
+    (int16_t)0x6FF2, (int16_t)0x3E10, (int16_t)0x6FE6, (int16_t)0x3E26, (int16_t)0x6FDA,
+    (int16_t)0x3E3C, (int16_t)0x6FCE, (int16_t)0x3E52, (int16_t)0x6FC2, (int16_t)0x3E68,
+    (int16_t)0x6FB5, (int16_t)0x3E7E, (int16_t)0x6FA9, (int16_t)0x3E94, (int16_t)0x6F9D,
+    (int16_t)0x3EAA, (int16_t)0x6F90, (int16_t)0x3EC0, (int16_t)0x6F84, (int16_t)0x3ED6,
+    (int16_t)0x6F78, (int16_t)0x3EEC, (int16_t)0x6F6B, (int16_t)0x3F01, (int16_t)0x6F5F,
+    (int16_t)0x3F17, (int16_t)0x6F53, (int16_t)0x3F2D, (int16_t)0x6F46, (int16_t)0x3F43,
+    (int16_t)0x6F3A, (int16_t)0x3F59, (int16_t)0x6F2D, (int16_t)0x3F6F, (int16_t)0x6F21,
+    (int16_t)0x3F85, (int16_t)0x6F14, (int16_t)0x3F9A, (int16_t)0x6F08, (int16_t)0x3FB0,
+    (int16_t)0x6EFB, (int16_t)0x3FC6, (int16_t)0x6EEF, (int16_t)0x3FDC, (int16_t)0x6EE2,
+    (int16_t)0x3FF1, (int16_t)0x6ED6, (int16_t)0x4007, (int16_t)0x6EC9, (int16_t)0x401D,
+    (int16_t)0x6EBD, (int16_t)0x4033, (int16_t)0x6EB0, (int16_t)0x4048, (int16_t)0x6EA3,
+    (int16_t)0x405E, (int16_t)0x6E97, (int16_t)0x4074, (int16_t)0x6E8A, (int16_t)0x408A,
+    (int16_t)0x6E7D, (int16_t)0x409F, (int16_t)0x6E71, (int16_t)0x40B5, (int16_t)0x6E64,
+    (int16_t)0x40CB, (int16_t)0x6E57, (int16_t)0x40E0, (int16_t)0x6E4A, (int16_t)0x40F6,
+    (int16_t)0x6E3E, (int16_t)0x410C, (int16_t)0x6E31, (int16_t)0x4121, (int16_t)0x6E24,
+    (int16_t)0x4137, (int16_t)0x6E17, (int16_t)0x414D, (int16_t)0x6E0A, (int16_t)0x4162,
+    (int16_t)0x6DFE, (int16_t)0x4178, (int16_t)0x6DF1, (int16_t)0x418D, (int16_t)0x6DE4,
+    (int16_t)0x41A3, (int16_t)0x6DD7, (int16_t)0x41B9, (int16_t)0x6DCA, (int16_t)0x41CE,
+    (int16_t)0x6DBD, (int16_t)0x41E4, (int16_t)0x6DB0, (int16_t)0x41F9, (int16_t)0x6DA3,
+    (int16_t)0x420F, (int16_t)0x6D96, (int16_t)0x4224, (int16_t)0x6D89, (int16_t)0x423A,
+    (int16_t)0x6D7C, (int16_t)0x424F, (int16_t)0x6D6F, (int16_t)0x4265, (int16_t)0x6D62,
+    (int16_t)0x427A, (int16_t)0x6D55, (int16_t)0x4290, (int16_t)0x6D48, (int16_t)0x42A5,
+    (int16_t)0x6D3B, (int16_t)0x42BB, (int16_t)0x6D2E, (int16_t)0x42D0, (int16_t)0x6D21,
+    (int16_t)0x42E6, (int16_t)0x6D14, (int16_t)0x42FB, (int16_t)0x6D06, (int16_t)0x4310,
+    (int16_t)0x6CF9, (int16_t)0x4326, (int16_t)0x6CEC, (int16_t)0x433B, (int16_t)0x6CDF,
+    (int16_t)0x4351, (int16_t)0x6CD2, (int16_t)0x4366, (int16_t)0x6CC4, (int16_t)0x437B,
+    (int16_t)0x6CB7, (int16_t)0x4391, (int16_t)0x6CAA, (int16_t)0x43A6, (int16_t)0x6C9D,
+    (int16_t)0x43BB, (int16_t)0x6C8F, (int16_t)0x43D1, (int16_t)0x6C82, (int16_t)0x43E6,
+    (int16_t)0x6C75, (int16_t)0x43FB, (int16_t)0x6C67, (int16_t)0x4411, (int16_t)0x6C5A,
+    (int16_t)0x4426, (int16_t)0x6C4C, (int16_t)0x443B, (int16_t)0x6C3F, (int16_t)0x4450,
+    (int16_t)0x6C32, (int16_t)0x4466, (int16_t)0x6C24, (int16_t)0x447B, (int16_t)0x6C17,
+    (int16_t)0x4490, (int16_t)0x6C09, (int16_t)0x44A5, (int16_t)0x6BFC, (int16_t)0x44BA,
+    (int16_t)0x6BEE, (int16_t)0x44D0, (int16_t)0x6BE1, (int16_t)0x44E5, (int16_t)0x6BD3,
+    (int16_t)0x44FA, (int16_t)0x6BC6, (int16_t)0x450F, (int16_t)0x6BB8, (int16_t)0x4524,
+    (int16_t)0x6BAA, (int16_t)0x4539, (int16_t)0x6B9D, (int16_t)0x454F, (int16_t)0x6B8F,
+    (int16_t)0x4564, (int16_t)0x6B82, (int16_t)0x4579, (int16_t)0x6B74, (int16_t)0x458E,
+    (int16_t)0x6B66, (int16_t)0x45A3, (int16_t)0x6B59, (int16_t)0x45B8, (int16_t)0x6B4B,
+    (int16_t)0x45CD, (int16_t)0x6B3D, (int16_t)0x45E2, (int16_t)0x6B30, (int16_t)0x45F7,
+    (int16_t)0x6B22, (int16_t)0x460C, (int16_t)0x6B14, (int16_t)0x4621, (int16_t)0x6B06,
+    (int16_t)0x4636, (int16_t)0x6AF8, (int16_t)0x464B, (int16_t)0x6AEB, (int16_t)0x4660,
+    (int16_t)0x6ADD, (int16_t)0x4675, (int16_t)0x6ACF, (int16_t)0x468A, (int16_t)0x6AC1,
+    (int16_t)0x469F, (int16_t)0x6AB3, (int16_t)0x46B4, (int16_t)0x6AA5, (int16_t)0x46C9,
+    (int16_t)0x6A97, (int16_t)0x46DE, (int16_t)0x6A89, (int16_t)0x46F3, (int16_t)0x6A7C,
+    (int16_t)0x4708, (int16_t)0x6A6E, (int16_t)0x471D, (int16_t)0x6A60, (int16_t)0x4732,
+    (int16_t)0x6A52, (int16_t)0x4747, (int16_t)0x6A44, (int16_t)0x475C, (int16_t)0x6A36,
+    (int16_t)0x4770, (int16_t)0x6A28, (int16_t)0x4785, (int16_t)0x6A1A, (int16_t)0x479A,
+    (int16_t)0x6A0B, (int16_t)0x47AF, (int16_t)0x69FD, (int16_t)0x47C4, (int16_t)0x69EF,
+    (int16_t)0x47D9, (int16_t)0x69E1, (int16_t)0x47ED, (int16_t)0x69D3, (int16_t)0x4802,
+    (int16_t)0x69C5, (int16_t)0x4817, (int16_t)0x69B7, (int16_t)0x482C, (int16_t)0x69A9,
+    (int16_t)0x4840, (int16_t)0x699A, (int16_t)0x4855, (int16_t)0x698C, (int16_t)0x486A,
+    (int16_t)0x697E, (int16_t)0x487F, (int16_t)0x6970, (int16_t)0x4893, (int16_t)0x6961,
+    (int16_t)0x48A8, (int16_t)0x6953, (int16_t)0x48BD, (int16_t)0x6945, (int16_t)0x48D1,
+    (int16_t)0x6937, (int16_t)0x48E6, (int16_t)0x6928, (int16_t)0x48FB, (int16_t)0x691A,
+    (int16_t)0x490F, (int16_t)0x690C, (int16_t)0x4924, (int16_t)0x68FD, (int16_t)0x4939,
+    (int16_t)0x68EF, (int16_t)0x494D, (int16_t)0x68E0, (int16_t)0x4962, (int16_t)0x68D2,
+    (int16_t)0x4976, (int16_t)0x68C4, (int16_t)0x498B, (int16_t)0x68B5, (int16_t)0x49A0,
+    (int16_t)0x68A7, (int16_t)0x49B4, (int16_t)0x6898, (int16_t)0x49C9, (int16_t)0x688A,
+    (int16_t)0x49DD, (int16_t)0x687B, (int16_t)0x49F2, (int16_t)0x686D, (int16_t)0x4A06,
+    (int16_t)0x685E, (int16_t)0x4A1B, (int16_t)0x6850, (int16_t)0x4A2F, (int16_t)0x6841,
+    (int16_t)0x4A44, (int16_t)0x6832, (int16_t)0x4A58, (int16_t)0x6824, (int16_t)0x4A6D,
+    (int16_t)0x6815, (int16_t)0x4A81, (int16_t)0x6806, (int16_t)0x4A95, (int16_t)0x67F8,
+    (int16_t)0x4AAA, (int16_t)0x67E9, (int16_t)0x4ABE, (int16_t)0x67DA, (int16_t)0x4AD3,
+    (int16_t)0x67CC, (int16_t)0x4AE7, (int16_t)0x67BD, (int16_t)0x4AFB, (int16_t)0x67AE,
+    (int16_t)0x4B10, (int16_t)0x67A0, (int16_t)0x4B24, (int16_t)0x6791, (int16_t)0x4B38,
+    (int16_t)0x6782, (int16_t)0x4B4D, (int16_t)0x6773, (int16_t)0x4B61, (int16_t)0x6764,
+    (int16_t)0x4B75, (int16_t)0x6756, (int16_t)0x4B8A, (int16_t)0x6747, (int16_t)0x4B9E,
+    (int16_t)0x6738, (int16_t)0x4BB2, (int16_t)0x6729, (int16_t)0x4BC7, (int16_t)0x671A,
+    (int16_t)0x4BDB, (int16_t)0x670B, (int16_t)0x4BEF, (int16_t)0x66FC, (int16_t)0x4C03,
+    (int16_t)0x66ED, (int16_t)0x4C17, (int16_t)0x66DE, (int16_t)0x4C2C, (int16_t)0x66D0,
+    (int16_t)0x4C40, (int16_t)0x66C1, (int16_t)0x4C54, (int16_t)0x66B2, (int16_t)0x4C68,
+    (int16_t)0x66A3, (int16_t)0x4C7C, (int16_t)0x6693, (int16_t)0x4C91, (int16_t)0x6684,
+    (int16_t)0x4CA5, (int16_t)0x6675, (int16_t)0x4CB9, (int16_t)0x6666, (int16_t)0x4CCD,
+    (int16_t)0x6657, (int16_t)0x4CE1, (int16_t)0x6648, (int16_t)0x4CF5, (int16_t)0x6639,
+    (int16_t)0x4D09, (int16_t)0x662A, (int16_t)0x4D1D, (int16_t)0x661B, (int16_t)0x4D31,
+    (int16_t)0x660C, (int16_t)0x4D45, (int16_t)0x65FC, (int16_t)0x4D59, (int16_t)0x65ED,
+    (int16_t)0x4D6D, (int16_t)0x65DE, (int16_t)0x4D81, (int16_t)0x65CF, (int16_t)0x4D95,
+    (int16_t)0x65C0, (int16_t)0x4DA9, (int16_t)0x65B0, (int16_t)0x4DBD, (int16_t)0x65A1,
+    (int16_t)0x4DD1, (int16_t)0x6592, (int16_t)0x4DE5, (int16_t)0x6582, (int16_t)0x4DF9,
+    (int16_t)0x6573, (int16_t)0x4E0D, (int16_t)0x6564, (int16_t)0x4E21, (int16_t)0x6554,
+    (int16_t)0x4E35, (int16_t)0x6545, (int16_t)0x4E49, (int16_t)0x6536, (int16_t)0x4E5D,
+    (int16_t)0x6526, (int16_t)0x4E71, (int16_t)0x6517, (int16_t)0x4E84, (int16_t)0x6507,
+    (int16_t)0x4E98, (int16_t)0x64F8, (int16_t)0x4EAC, (int16_t)0x64E9, (int16_t)0x4EC0,
+    (int16_t)0x64D9, (int16_t)0x4ED4, (int16_t)0x64CA, (int16_t)0x4EE8, (int16_t)0x64BA,
+    (int16_t)0x4EFB, (int16_t)0x64AB, (int16_t)0x4F0F, (int16_t)0x649B, (int16_t)0x4F23,
+    (int16_t)0x648B, (int16_t)0x4F37, (int16_t)0x647C, (int16_t)0x4F4A, (int16_t)0x646C,
+    (int16_t)0x4F5E, (int16_t)0x645D, (int16_t)0x4F72, (int16_t)0x644D, (int16_t)0x4F85,
+    (int16_t)0x643E, (int16_t)0x4F99, (int16_t)0x642E, (int16_t)0x4FAD, (int16_t)0x641E,
+    (int16_t)0x4FC0, (int16_t)0x640F, (int16_t)0x4FD4, (int16_t)0x63FF, (int16_t)0x4FE8,
+    (int16_t)0x63EF, (int16_t)0x4FFB, (int16_t)0x63DF, (int16_t)0x500F, (int16_t)0x63D0,
+    (int16_t)0x5023, (int16_t)0x63C0, (int16_t)0x5036, (int16_t)0x63B0, (int16_t)0x504A,
+    (int16_t)0x63A0, (int16_t)0x505D, (int16_t)0x6391, (int16_t)0x5071, (int16_t)0x6381,
+    (int16_t)0x5084, (int16_t)0x6371, (int16_t)0x5098, (int16_t)0x6361, (int16_t)0x50AC,
+    (int16_t)0x6351, (int16_t)0x50BF, (int16_t)0x6342, (int16_t)0x50D3, (int16_t)0x6332,
+    (int16_t)0x50E6, (int16_t)0x6322, (int16_t)0x50F9, (int16_t)0x6312, (int16_t)0x510D,
+    (int16_t)0x6302, (int16_t)0x5120, (int16_t)0x62F2, (int16_t)0x5134, (int16_t)0x62E2,
+    (int16_t)0x5147, (int16_t)0x62D2, (int16_t)0x515B, (int16_t)0x62C2, (int16_t)0x516E,
+    (int16_t)0x62B2, (int16_t)0x5181, (int16_t)0x62A2, (int16_t)0x5195, (int16_t)0x6292,
+    (int16_t)0x51A8, (int16_t)0x6282, (int16_t)0x51BB, (int16_t)0x6272, (int16_t)0x51CF,
+    (int16_t)0x6262, (int16_t)0x51E2, (int16_t)0x6252, (int16_t)0x51F5, (int16_t)0x6242,
+    (int16_t)0x5209, (int16_t)0x6232, (int16_t)0x521C, (int16_t)0x6221, (int16_t)0x522F,
+    (int16_t)0x6211, (int16_t)0x5243, (int16_t)0x6201, (int16_t)0x5256, (int16_t)0x61F1,
+    (int16_t)0x5269, (int16_t)0x61E1, (int16_t)0x527C, (int16_t)0x61D1, (int16_t)0x5290,
+    (int16_t)0x61C0, (int16_t)0x52A3, (int16_t)0x61B0, (int16_t)0x52B6, (int16_t)0x61A0,
+    (int16_t)0x52C9, (int16_t)0x6190, (int16_t)0x52DC, (int16_t)0x617F, (int16_t)0x52EF,
+    (int16_t)0x616F, (int16_t)0x5303, (int16_t)0x615F, (int16_t)0x5316, (int16_t)0x614E,
+    (int16_t)0x5329, (int16_t)0x613E, (int16_t)0x533C, (int16_t)0x612E, (int16_t)0x534F,
+    (int16_t)0x611D, (int16_t)0x5362, (int16_t)0x610D, (int16_t)0x5375, (int16_t)0x60FD,
+    (int16_t)0x5388, (int16_t)0x60EC, (int16_t)0x539B, (int16_t)0x60DC, (int16_t)0x53AE,
+    (int16_t)0x60CB, (int16_t)0x53C1, (int16_t)0x60BB, (int16_t)0x53D4, (int16_t)0x60AA,
+    (int16_t)0x53E7, (int16_t)0x609A, (int16_t)0x53FA, (int16_t)0x6089, (int16_t)0x540D,
+    (int16_t)0x6079, (int16_t)0x5420, (int16_t)0x6068, (int16_t)0x5433, (int16_t)0x6058,
+    (int16_t)0x5446, (int16_t)0x6047, (int16_t)0x5459, (int16_t)0x6037, (int16_t)0x546C,
+    (int16_t)0x6026, (int16_t)0x547F, (int16_t)0x6016, (int16_t)0x5491, (int16_t)0x6005,
+    (int16_t)0x54A4, (int16_t)0x5FF4, (int16_t)0x54B7, (int16_t)0x5FE4, (int16_t)0x54CA,
+    (int16_t)0x5FD3, (int16_t)0x54DD, (int16_t)0x5FC2, (int16_t)0x54F0, (int16_t)0x5FB2,
+    (int16_t)0x5502, (int16_t)0x5FA1, (int16_t)0x5515, (int16_t)0x5F90, (int16_t)0x5528,
+    (int16_t)0x5F80, (int16_t)0x553B, (int16_t)0x5F6F, (int16_t)0x554E, (int16_t)0x5F5E,
+    (int16_t)0x5560, (int16_t)0x5F4D, (int16_t)0x5573, (int16_t)0x5F3C, (int16_t)0x5586,
+    (int16_t)0x5F2C, (int16_t)0x5598, (int16_t)0x5F1B, (int16_t)0x55AB, (int16_t)0x5F0A,
+    (int16_t)0x55BE, (int16_t)0x5EF9, (int16_t)0x55D0, (int16_t)0x5EE8, (int16_t)0x55E3,
+    (int16_t)0x5ED7, (int16_t)0x55F6, (int16_t)0x5EC7, (int16_t)0x5608, (int16_t)0x5EB6,
+    (int16_t)0x561B, (int16_t)0x5EA5, (int16_t)0x562D, (int16_t)0x5E94, (int16_t)0x5640,
+    (int16_t)0x5E83, (int16_t)0x5653, (int16_t)0x5E72, (int16_t)0x5665, (int16_t)0x5E61,
+    (int16_t)0x5678, (int16_t)0x5E50, (int16_t)0x568A, (int16_t)0x5E3F, (int16_t)0x569D,
+    (int16_t)0x5E2E, (int16_t)0x56AF, (int16_t)0x5E1D, (int16_t)0x56C2, (int16_t)0x5E0C,
+    (int16_t)0x56D4, (int16_t)0x5DFB, (int16_t)0x56E7, (int16_t)0x5DEA, (int16_t)0x56F9,
+    (int16_t)0x5DD9, (int16_t)0x570C, (int16_t)0x5DC8, (int16_t)0x571E, (int16_t)0x5DB7,
+    (int16_t)0x5730, (int16_t)0x5DA5, (int16_t)0x5743, (int16_t)0x5D94, (int16_t)0x5755,
+    (int16_t)0x5D83, (int16_t)0x5767, (int16_t)0x5D72, (int16_t)0x577A, (int16_t)0x5D61,
+    (int16_t)0x578C, (int16_t)0x5D50, (int16_t)0x579F, (int16_t)0x5D3E, (int16_t)0x57B1,
+    (int16_t)0x5D2D, (int16_t)0x57C3, (int16_t)0x5D1C, (int16_t)0x57D5, (int16_t)0x5D0B,
+    (int16_t)0x57E8, (int16_t)0x5CF9, (int16_t)0x57FA, (int16_t)0x5CE8, (int16_t)0x580C,
+    (int16_t)0x5CD7, (int16_t)0x581E, (int16_t)0x5CC5, (int16_t)0x5831, (int16_t)0x5CB4,
+    (int16_t)0x5843, (int16_t)0x5CA3, (int16_t)0x5855, (int16_t)0x5C91, (int16_t)0x5867,
+    (int16_t)0x5C80, (int16_t)0x5879, (int16_t)0x5C6F, (int16_t)0x588C, (int16_t)0x5C5D,
+    (int16_t)0x589E, (int16_t)0x5C4C, (int16_t)0x58B0, (int16_t)0x5C3A, (int16_t)0x58C2,
+    (int16_t)0x5C29, (int16_t)0x58D4, (int16_t)0x5C18, (int16_t)0x58E6, (int16_t)0x5C06,
+    (int16_t)0x58F8, (int16_t)0x5BF5, (int16_t)0x590A, (int16_t)0x5BE3, (int16_t)0x591C,
+    (int16_t)0x5BD2, (int16_t)0x592E, (int16_t)0x5BC0, (int16_t)0x5940, (int16_t)0x5BAF,
+    (int16_t)0x5952, (int16_t)0x5B9D, (int16_t)0x5964, (int16_t)0x5B8C, (int16_t)0x5976,
+    (int16_t)0x5B7A, (int16_t)0x5988, (int16_t)0x5B68, (int16_t)0x599A, (int16_t)0x5B57,
+    (int16_t)0x59AC, (int16_t)0x5B45, (int16_t)0x59BE, (int16_t)0x5B34, (int16_t)0x59D0,
+    (int16_t)0x5B22, (int16_t)0x59E2, (int16_t)0x5B10, (int16_t)0x59F4, (int16_t)0x5AFF,
+    (int16_t)0x5A06, (int16_t)0x5AED, (int16_t)0x5A18, (int16_t)0x5ADB, (int16_t)0x5A29,
+    (int16_t)0x5AC9, (int16_t)0x5A3B, (int16_t)0x5AB8, (int16_t)0x5A4D, (int16_t)0x5AA6,
+    (int16_t)0x5A5F, (int16_t)0x5A94, (int16_t)0x5A71, (int16_t)0x5A82, (int16_t)0x5A82,
+    (int16_t)0x5A71, (int16_t)0x5A94, (int16_t)0x5A5F, (int16_t)0x5AA6, (int16_t)0x5A4D,
+    (int16_t)0x5AB8, (int16_t)0x5A3B, (int16_t)0x5AC9, (int16_t)0x5A29, (int16_t)0x5ADB,
+    (int16_t)0x5A18, (int16_t)0x5AED, (int16_t)0x5A06, (int16_t)0x5AFF, (int16_t)0x59F4,
+    (int16_t)0x5B10, (int16_t)0x59E2, (int16_t)0x5B22, (int16_t)0x59D0, (int16_t)0x5B34,
+    (int16_t)0x59BE, (int16_t)0x5B45, (int16_t)0x59AC, (int16_t)0x5B57, (int16_t)0x599A,
+    (int16_t)0x5B68, (int16_t)0x5988, (int16_t)0x5B7A, (int16_t)0x5976, (int16_t)0x5B8C,
+    (int16_t)0x5964, (int16_t)0x5B9D, (int16_t)0x5952, (int16_t)0x5BAF, (int16_t)0x5940,
+    (int16_t)0x5BC0, (int16_t)0x592E, (int16_t)0x5BD2, (int16_t)0x591C, (int16_t)0x5BE3,
+    (int16_t)0x590A, (int16_t)0x5BF5, (int16_t)0x58F8, (int16_t)0x5C06, (int16_t)0x58E6,
+    (int16_t)0x5C18, (int16_t)0x58D4, (int16_t)0x5C29, (int16_t)0x58C2, (int16_t)0x5C3A,
+    (int16_t)0x58B0, (int16_t)0x5C4C, (int16_t)0x589E, (int16_t)0x5C5D, (int16_t)0x588C,
+    (int16_t)0x5C6F, (int16_t)0x5879, (int16_t)0x5C80, (int16_t)0x5867, (int16_t)0x5C91,
+    (int16_t)0x5855, (int16_t)0x5CA3, (int16_t)0x5843, (int16_t)0x5CB4, (int16_t)0x5831,
+    (int16_t)0x5CC5, (int16_t)0x581E, (int16_t)0x5CD7, (int16_t)0x580C, (int16_t)0x5CE8,
+    (int16_t)0x57FA, (int16_t)0x5CF9, (int16_t)0x57E8, (int16_t)0x5D0B, (int16_t)0x57D5,
+    (int16_t)0x5D1C, (int16_t)0x57C3, (int16_t)0x5D2D, (int16_t)0x57B1, (int16_t)0x5D3E,
+    (int16_t)0x579F, (int16_t)0x5D50, (int16_t)0x578C, (int16_t)0x5D61, (int16_t)0x577A,
+    (int16_t)0x5D72, (int16_t)0x5767, (int16_t)0x5D83, (int16_t)0x5755, (int16_t)0x5D94,
+    (int16_t)0x5743, (int16_t)0x5DA5, (int16_t)0x5730, (int16_t)0x5DB7, (int16_t)0x571E,
+    (int16_t)0x5DC8, (int16_t)0x570C, (int16_t)0x5DD9, (int16_t)0x56F9, (int16_t)0x5DEA,
+    (int16_t)0x56E7, (int16_t)0x5DFB, (int16_t)0x56D4, (int16_t)0x5E0C, (int16_t)0x56C2,
+    (int16_t)0x5E1D, (int16_t)0x56AF, (int16_t)0x5E2E, (int16_t)0x569D, (int16_t)0x5E3F,
+    (int16_t)0x568A, (int16_t)0x5E50, (int16_t)0x5678, (int16_t)0x5E61, (int16_t)0x5665,
+    (int16_t)0x5E72, (int16_t)0x5653, (int16_t)0x5E83, (int16_t)0x5640, (int16_t)0x5E94,
+    (int16_t)0x562D, (int16_t)0x5EA5, (int16_t)0x561B, (int16_t)0x5EB6, (int16_t)0x5608,
+    (int16_t)0x5EC7, (int16_t)0x55F6, (int16_t)0x5ED7, (int16_t)0x55E3, (int16_t)0x5EE8,
+    (int16_t)0x55D0, (int16_t)0x5EF9, (int16_t)0x55BE, (int16_t)0x5F0A, (int16_t)0x55AB,
+    (int16_t)0x5F1B, (int16_t)0x5598, (int16_t)0x5F2C, (int16_t)0x5586, (int16_t)0x5F3C,
+    (int16_t)0x5573, (int16_t)0x5F4D, (int16_t)0x5560, (int16_t)0x5F5E, (int16_t)0x554E,
+    (int16_t)0x5F6F, (int16_t)0x553B, (int16_t)0x5F80, (int16_t)0x5528, (int16_t)0x5F90,
+    (int16_t)0x5515, (int16_t)0x5FA1, (int16_t)0x5502, (int16_t)0x5FB2, (int16_t)0x54F0,
+    (int16_t)0x5FC2, (int16_t)0x54DD, (int16_t)0x5FD3, (int16_t)0x54CA, (int16_t)0x5FE4,
+    (int16_t)0x54B7, (int16_t)0x5FF4, (int16_t)0x54A4, (int16_t)0x6005, (int16_t)0x5491,
+    (int16_t)0x6016, (int16_t)0x547F, (int16_t)0x6026, (int16_t)0x546C, (int16_t)0x6037,
+    (int16_t)0x5459, (int16_t)0x6047, (int16_t)0x5446, (int16_t)0x6058, (int16_t)0x5433,
+    (int16_t)0x6068, (int16_t)0x5420, (int16_t)0x6079, (int16_t)0x540D, (int16_t)0x6089,
+    (int16_t)0x53FA, (int16_t)0x609A, (int16_t)0x53E7, (int16_t)0x60AA, (int16_t)0x53D4,
+    (int16_t)0x60BB, (int16_t)0x53C1, (int16_t)0x60CB, (int16_t)0x53AE, (int16_t)0x60DC,
+    (int16_t)0x539B, (int16_t)0x60EC, (int16_t)0x5388, (int16_t)0x60FD, (int16_t)0x5375,
+    (int16_t)0x610D, (int16_t)0x5362, (int16_t)0x611D, (int16_t)0x534F, (int16_t)0x612E,
+    (int16_t)0x533C, (int16_t)0x613E, (int16_t)0x5329, (int16_t)0x614E, (int16_t)0x5316,
+    (int16_t)0x615F, (int16_t)0x5303, (int16_t)0x616F, (int16_t)0x52EF, (int16_t)0x617F,
+    (int16_t)0x52DC, (int16_t)0x6190, (int16_t)0x52C9, (int16_t)0x61A0, (int16_t)0x52B6,
+    (int16_t)0x61B0, (int16_t)0x52A3, (int16_t)0x61C0, (int16_t)0x5290, (int16_t)0x61D1,
+    (int16_t)0x527C, (int16_t)0x61E1, (int16_t)0x5269, (int16_t)0x61F1, (int16_t)0x5256,
+    (int16_t)0x6201, (int16_t)0x5243, (int16_t)0x6211, (int16_t)0x522F, (int16_t)0x6221,
+    (int16_t)0x521C, (int16_t)0x6232, (int16_t)0x5209, (int16_t)0x6242, (int16_t)0x51F5,
+    (int16_t)0x6252, (int16_t)0x51E2, (int16_t)0x6262, (int16_t)0x51CF, (int16_t)0x6272,
+    (int16_t)0x51BB, (int16_t)0x6282, (int16_t)0x51A8, (int16_t)0x6292, (int16_t)0x5195,
+    (int16_t)0x62A2, (int16_t)0x5181, (int16_t)0x62B2, (int16_t)0x516E, (int16_t)0x62C2,
+    (int16_t)0x515B, (int16_t)0x62D2, (int16_t)0x5147, (int16_t)0x62E2, (int16_t)0x5134,
+    (int16_t)0x62F2, (int16_t)0x5120, (int16_t)0x6302, (int16_t)0x510D, (int16_t)0x6312,
+    (int16_t)0x50F9, (int16_t)0x6322, (int16_t)0x50E6, (int16_t)0x6332, (int16_t)0x50D3,
+    (int16_t)0x6342, (int16_t)0x50BF, (int16_t)0x6351, (int16_t)0x50AC, (int16_t)0x6361,
+    (int16_t)0x5098, (int16_t)0x6371, (int16_t)0x5084, (int16_t)0x6381, (int16_t)0x5071,
+    (int16_t)0x6391, (int16_t)0x505D, (int16_t)0x63A0, (int16_t)0x504A, (int16_t)0x63B0,
+    (int16_t)0x5036, (int16_t)0x63C0, (int16_t)0x5023, (int16_t)0x63D0, (int16_t)0x500F,
+    (int16_t)0x63DF, (int16_t)0x4FFB, (int16_t)0x63EF, (int16_t)0x4FE8, (int16_t)0x63FF,
+    (int16_t)0x4FD4, (int16_t)0x640F, (int16_t)0x4FC0, (int16_t)0x641E, (int16_t)0x4FAD,
+    (int16_t)0x642E, (int16_t)0x4F99, (int16_t)0x643E, (int16_t)0x4F85, (int16_t)0x644D,
+    (int16_t)0x4F72, (int16_t)0x645D, (int16_t)0x4F5E, (int16_t)0x646C, (int16_t)0x4F4A,
+    (int16_t)0x647C, (int16_t)0x4F37, (int16_t)0x648B, (int16_t)0x4F23, (int16_t)0x649B,
+    (int16_t)0x4F0F, (int16_t)0x64AB, (int16_t)0x4EFB, (int16_t)0x64BA, (int16_t)0x4EE8,
+    (int16_t)0x64CA, (int16_t)0x4ED4, (int16_t)0x64D9, (int16_t)0x4EC0, (int16_t)0x64E9,
+    (int16_t)0x4EAC, (int16_t)0x64F8, (int16_t)0x4E98, (int16_t)0x6507, (int16_t)0x4E84,
+    (int16_t)0x6517, (int16_t)0x4E71, (int16_t)0x6526, (int16_t)0x4E5D, (int16_t)0x6536,
+    (int16_t)0x4E49, (int16_t)0x6545, (int16_t)0x4E35, (int16_t)0x6554, (int16_t)0x4E21,
+    (int16_t)0x6564, (int16_t)0x4E0D, (int16_t)0x6573, (int16_t)0x4DF9, (int16_t)0x6582,
+    (int16_t)0x4DE5, (int16_t)0x6592, (int16_t)0x4DD1, (int16_t)0x65A1, (int16_t)0x4DBD,
+    (int16_t)0x65B0, (int16_t)0x4DA9, (int16_t)0x65C0, (int16_t)0x4D95, (int16_t)0x65CF,
+    (int16_t)0x4D81, (int16_t)0x65DE, (int16_t)0x4D6D, (int16_t)0x65ED, (int16_t)0x4D59,
+    (int16_t)0x65FC, (int16_t)0x4D45, (int16_t)0x660C, (int16_t)0x4D31, (int16_t)0x661B,
+    (int16_t)0x4D1D, (int16_t)0x662A, (int16_t)0x4D09, (int16_t)0x6639, (int16_t)0x4CF5,
+    (int16_t)0x6648, (int16_t)0x4CE1, (int16_t)0x6657, (int16_t)0x4CCD, (int16_t)0x6666,
+    (int16_t)0x4CB9, (int16_t)0x6675, (int16_t)0x4CA5, (int16_t)0x6684, (int16_t)0x4C91,
+    (int16_t)0x6693, (int16_t)0x4C7C, (int16_t)0x66A3, (int16_t)0x4C68, (int16_t)0x66B2,
+    (int16_t)0x4C54, (int16_t)0x66C1, (int16_t)0x4C40, (int16_t)0x66D0, (int16_t)0x4C2C,
+    (int16_t)0x66DE, (int16_t)0x4C17, (int16_t)0x66ED, (int16_t)0x4C03, (int16_t)0x66FC,
+    (int16_t)0x4BEF, (int16_t)0x670B, (int16_t)0x4BDB, (int16_t)0x671A, (int16_t)0x4BC7,
+    (int16_t)0x6729, (int16_t)0x4BB2, (int16_t)0x6738, (int16_t)0x4B9E, (int16_t)0x6747,
+    (int16_t)0x4B8A, (int16_t)0x6756, (int16_t)0x4B75, (int16_t)0x6764, (int16_t)0x4B61,
+    (int16_t)0x6773, (int16_t)0x4B4D, (int16_t)0x6782, (int16_t)0x4B38, (int16_t)0x6791,
+    (int16_t)0x4B24, (int16_t)0x67A0, (int16_t)0x4B10, (int16_t)0x67AE, (int16_t)0x4AFB,
+    (int16_t)0x67BD, (int16_t)0x4AE7, (int16_t)0x67CC, (int16_t)0x4AD3, (int16_t)0x67DA,
+    (int16_t)0x4ABE, (int16_t)0x67E9, (int16_t)0x4AAA, (int16_t)0x67F8, (int16_t)0x4A95,
+    (int16_t)0x6806, (int16_t)0x4A81, (int16_t)0x6815, (int16_t)0x4A6D, (int16_t)0x6824,
+    (int16_t)0x4A58, (int16_t)0x6832, (int16_t)0x4A44, (int16_t)0x6841, (int16_t)0x4A2F,
+    (int16_t)0x6850, (int16_t)0x4A1B, (int16_t)0x685E, (int16_t)0x4A06, (int16_t)0x686D,
+    (int16_t)0x49F2, (int16_t)0x687B, (int16_t)0x49DD, (int16_t)0x688A, (int16_t)0x49C9,
+    (int16_t)0x6898, (int16_t)0x49B4, (int16_t)0x68A7, (int16_t)0x49A0, (int16_t)0x68B5,
+    (int16_t)0x498B, (int16_t)0x68C4, (int16_t)0x4976, (int16_t)0x68D2, (int16_t)0x4962,
+    (int16_t)0x68E0, (int16_t)0x494D, (int16_t)0x68EF, (int16_t)0x4939, (int16_t)0x68FD,
+    (int16_t)0x4924, (int16_t)0x690C, (int16_t)0x490F, (int16_t)0x691A, (int16_t)0x48FB,
+    (int16_t)0x6928, (int16_t)0x48E6, (int16_t)0x6937, (int16_t)0x48D1, (int16_t)0x6945,
+    (int16_t)0x48BD, (int16_t)0x6953, (int16_t)0x48A8, (int16_t)0x6961, (int16_t)0x4893,
+    (int16_t)0x6970, (int16_t)0x487F, (int16_t)0x697E, (int16_t)0x486A, (int16_t)0x698C,
+    (int16_t)0x4855, (int16_t)0x699A, (int16_t)0x4840, (int16_t)0x69A9, (int16_t)0x482C,
+    (int16_t)0x69B7, (int16_t)0x4817, (int16_t)0x69C5, (int16_t)0x4802, (int16_t)0x69D3,
+    (int16_t)0x47ED, (int16_t)0x69E1, (int16_t)0x47D9, (int16_t)0x69EF, (int16_t)0x47C4,
+    (int16_t)0x69FD, (int16_t)0x47AF, (int16_t)0x6A0B, (int16_t)0x479A, (int16_t)0x6A1A,
+    (int16_t)0x4785, (int16_t)0x6A28, (int16_t)0x4770, (int16_t)0x6A36, (int16_t)0x475C,
+    (int16_t)0x6A44, (int16_t)0x4747, (int16_t)0x6A52, (int16_t)0x4732, (int16_t)0x6A60,
+    (int16_t)0x471D, (int16_t)0x6A6E, (int16_t)0x4708, (int16_t)0x6A7C, (int16_t)0x46F3,
+    (int16_t)0x6A89, (int16_t)0x46DE, (int16_t)0x6A97, (int16_t)0x46C9, (int16_t)0x6AA5,
+    (int16_t)0x46B4, (int16_t)0x6AB3, (int16_t)0x469F, (int16_t)0x6AC1, (int16_t)0x468A,
+    (int16_t)0x6ACF, (int16_t)0x4675, (int16_t)0x6ADD, (int16_t)0x4660, (int16_t)0x6AEB,
+    (int16_t)0x464B, (int16_t)0x6AF8, (int16_t)0x4636, (int16_t)0x6B06, (int16_t)0x4621,
+    (int16_t)0x6B14, (int16_t)0x460C, (int16_t)0x6B22, (int16_t)0x45F7, (int16_t)0x6B30,
+    (int16_t)0x45E2, (int16_t)0x6B3D, (int16_t)0x45CD, (int16_t)0x6B4B, (int16_t)0x45B8,
+    (int16_t)0x6B59, (int16_t)0x45A3, (int16_t)0x6B66, (int16_t)0x458E, (int16_t)0x6B74,
+    (int16_t)0x4579, (int16_t)0x6B82, (int16_t)0x4564, (int16_t)0x6B8F, (int16_t)0x454F,
+    (int16_t)0x6B9D, (int16_t)0x4539, (int16_t)0x6BAA, (int16_t)0x4524, (int16_t)0x6BB8,
+    (int16_t)0x450F, (int16_t)0x6BC6, (int16_t)0x44FA, (int16_t)0x6BD3, (int16_t)0x44E5,
+    (int16_t)0x6BE1, (int16_t)0x44D0, (int16_t)0x6BEE, (int16_t)0x44BA, (int16_t)0x6BFC,
+    (int16_t)0x44A5, (int16_t)0x6C09, (int16_t)0x4490, (int16_t)0x6C17, (int16_t)0x447B,
+    (int16_t)0x6C24, (int16_t)0x4466, (int16_t)0x6C32, (int16_t)0x4450, (int16_t)0x6C3F,
+    (int16_t)0x443B, (int16_t)0x6C4C, (int16_t)0x4426, (int16_t)0x6C5A, (int16_t)0x4411,
+    (int16_t)0x6C67, (int16_t)0x43FB, (int16_t)0x6C75, (int16_t)0x43E6, (int16_t)0x6C82,
+    (int16_t)0x43D1, (int16_t)0x6C8F, (int16_t)0x43BB, (int16_t)0x6C9D, (int16_t)0x43A6,
+    (int16_t)0x6CAA, (int16_t)0x4391, (int16_t)0x6CB7, (int16_t)0x437B, (int16_t)0x6CC4,
+    (int16_t)0x4366, (int16_t)0x6CD2, (int16_t)0x4351, (int16_t)0x6CDF, (int16_t)0x433B,
+    (int16_t)0x6CEC, (int16_t)0x4326, (int16_t)0x6CF9, (int16_t)0x4310, (int16_t)0x6D06,
+    (int16_t)0x42FB, (int16_t)0x6D14, (int16_t)0x42E6, (int16_t)0x6D21, (int16_t)0x42D0,
+    (int16_t)0x6D2E, (int16_t)0x42BB, (int16_t)0x6D3B, (int16_t)0x42A5, (int16_t)0x6D48,
+    (int16_t)0x4290, (int16_t)0x6D55, (int16_t)0x427A, (int16_t)0x6D62, (int16_t)0x4265,
+    (int16_t)0x6D6F, (int16_t)0x424F, (int16_t)0x6D7C, (int16_t)0x423A, (int16_t)0x6D89,
+    (int16_t)0x4224, (int16_t)0x6D96, (int16_t)0x420F, (int16_t)0x6DA3, (int16_t)0x41F9,
+    (int16_t)0x6DB0, (int16_t)0x41E4, (int16_t)0x6DBD, (int16_t)0x41CE, (int16_t)0x6DCA,
+    (int16_t)0x41B9, (int16_t)0x6DD7, (int16_t)0x41A3, (int16_t)0x6DE4, (int16_t)0x418D,
+    (int16_t)0x6DF1, (int16_t)0x4178, (int16_t)0x6DFE, (int16_t)0x4162, (int16_t)0x6E0A,
+    (int16_t)0x414D, (int16_t)0x6E17, (int16_t)0x4137, (int16_t)0x6E24, (int16_t)0x4121,
+    (int16_t)0x6E31, (int16_t)0x410C, (int16_t)0x6E3E, (int16_t)0x40F6, (int16_t)0x6E4A,
+    (int16_t)0x40E0, (int16_t)0x6E57, (int16_t)0x40CB, (int16_t)0x6E64, (int16_t)0x40B5,
+    (int16_t)0x6E71, (int16_t)0x409F, (int16_t)0x6E7D, (int16_t)0x408A, (int16_t)0x6E8A,
+    (int16_t)0x4074, (int16_t)0x6E97, (int16_t)0x405E, (int16_t)0x6EA3, (int16_t)0x4048,
+    (int16_t)0x6EB0, (int16_t)0x4033, (int16_t)0x6EBD, (int16_t)0x401D, (int16_t)0x6EC9,
+    (int16_t)0x4007, (int16_t)0x6ED6, (int16_t)0x3FF1, (int16_t)0x6EE2, (int16_t)0x3FDC,
+    (int16_t)0x6EEF, (int16_t)0x3FC6, (int16_t)0x6EFB, (int16_t)0x3FB0, (int16_t)0x6F08,
+    (int16_t)0x3F9A, (int16_t)0x6F14, (int16_t)0x3F85, (int16_t)0x6F21, (int16_t)0x3F6F,
+    (int16_t)0x6F2D, (int16_t)0x3F59, (int16_t)0x6F3A, (int16_t)0x3F43, (int16_t)0x6F46,
+    (int16_t)0x3F2D, (int16_t)0x6F53, (int16_t)0x3F17, (int16_t)0x6F5F, (int16_t)0x3F01,
+    (int16_t)0x6F6B, (int16_t)0x3EEC, (int16_t)0x6F78, (int16_t)0x3ED6, (int16_t)0x6F84,
+    (int16_t)0x3EC0, (int16_t)0x6F90, (int16_t)0x3EAA, (int16_t)0x6F9D, (int16_t)0x3E94,
+    (int16_t)0x6FA9, (int16_t)0x3E7E, (int16_t)0x6FB5, (int16_t)0x3E68, (int16_t)0x6FC2,
+    (int16_t)0x3E52, (int16_t)0x6FCE, (int16_t)0x3E3C, (int16_t)0x6FDA, (int16_t)0x3E26,
+    (int16_t)0x6FE6, (int16_t)0x3E10, (int16_t)0x6FF2, (int16_t)0x3DFA, (int16_t)0x6FFF,
+    (int16_t)0x3DE4, (int16_t)0x700B, (int16_t)0x3DCE, (int16_t)0x7017, (int16_t)0x3DB8,
+    (int16_t)0x7023, (int16_t)0x3DA2, (int16_t)0x702F, (int16_t)0x3D8C, (int16_t)0x703B,
+    (int16_t)0x3D76, (int16_t)0x7047, (int16_t)0x3D60, (int16_t)0x7053, (int16_t)0x3D4A,
+    (int16_t)0x705F, (int16_t)0x3D34, (int16_t)0x706B, (int16_t)0x3D1E, (int16_t)0x7077,
+    (int16_t)0x3D08, (int16_t)0x7083, (int16_t)0x3CF2, (int16_t)0x708F, (int16_t)0x3CDC,
+    (int16_t)0x709B, (int16_t)0x3CC5, (int16_t)0x70A7, (int16_t)0x3CAF, (int16_t)0x70B3,
+    (int16_t)0x3C99, (int16_t)0x70BF, (int16_t)0x3C83, (int16_t)0x70CB, (int16_t)0x3C6D,
+    (int16_t)0x70D7, (int16_t)0x3C57, (int16_t)0x70E3, (int16_t)0x3C41, (int16_t)0x70EF,
+    (int16_t)0x3C2A, (int16_t)0x70FA, (int16_t)0x3C14, (int16_t)0x7106, (int16_t)0x3BFE,
+    (int16_t)0x7112, (int16_t)0x3BE8, (int16_t)0x711E, (int16_t)0x3BD2, (int16_t)0x712A,
+    (int16_t)0x3BBB, (int16_t)0x7135, (int16_t)0x3BA5, (int16_t)0x7141, (int16_t)0x3B8F,
+    (int16_t)0x714D, (int16_t)0x3B79, (int16_t)0x7158, (int16_t)0x3B62, (int16_t)0x7164,
+    (int16_t)0x3B4C, (int16_t)0x7170, (int16_t)0x3B36, (int16_t)0x717B, (int16_t)0x3B20,
+    (int16_t)0x7187, (int16_t)0x3B09, (int16_t)0x7193, (int16_t)0x3AF3, (int16_t)0x719E,
+    (int16_t)0x3ADD, (int16_t)0x71AA, (int16_t)0x3AC6, (int16_t)0x71B5, (int16_t)0x3AB0,
+    (int16_t)0x71C1, (int16_t)0x3A9A, (int16_t)0x71CC, (int16_t)0x3A83, (int16_t)0x71D8,
+    (int16_t)0x3A6D, (int16_t)0x71E3, (int16_t)0x3A57, (int16_t)0x71EF, (int16_t)0x3A40,
+    (int16_t)0x71FA, (int16_t)0x3A2A, (int16_t)0x7206, (int16_t)0x3A13, (int16_t)0x7211,
+    (int16_t)0x39FD, (int16_t)0x721C, (int16_t)0x39E7, (int16_t)0x7228, (int16_t)0x39D0,
+    (int16_t)0x7233, (int16_t)0x39BA, (int16_t)0x723F, (int16_t)0x39A3, (int16_t)0x724A,
+    (int16_t)0x398D, (int16_t)0x7255, (int16_t)0x3976, (int16_t)0x7260, (int16_t)0x3960,
+    (int16_t)0x726C, (int16_t)0x3949, (int16_t)0x7277, (int16_t)0x3933, (int16_t)0x7282,
+    (int16_t)0x391D, (int16_t)0x728D, (int16_t)0x3906, (int16_t)0x7299, (int16_t)0x38F0,
+    (int16_t)0x72A4, (int16_t)0x38D9, (int16_t)0x72AF, (int16_t)0x38C2, (int16_t)0x72BA,
+    (int16_t)0x38AC, (int16_t)0x72C5, (int16_t)0x3895, (int16_t)0x72D0, (int16_t)0x387F,
+    (int16_t)0x72DC, (int16_t)0x3868, (int16_t)0x72E7, (int16_t)0x3852, (int16_t)0x72F2,
+    (int16_t)0x383B, (int16_t)0x72FD, (int16_t)0x3825, (int16_t)0x7308, (int16_t)0x380E,
+    (int16_t)0x7313, (int16_t)0x37F7, (int16_t)0x731E, (int16_t)0x37E1, (int16_t)0x7329,
+    (int16_t)0x37CA, (int16_t)0x7334, (int16_t)0x37B4, (int16_t)0x733F, (int16_t)0x379D,
+    (int16_t)0x734A, (int16_t)0x3786, (int16_t)0x7355, (int16_t)0x3770, (int16_t)0x735F,
+    (int16_t)0x3759, (int16_t)0x736A, (int16_t)0x3742, (int16_t)0x7375, (int16_t)0x372C,
+    (int16_t)0x7380, (int16_t)0x3715, (int16_t)0x738B, (int16_t)0x36FE, (int16_t)0x7396,
+    (int16_t)0x36E8, (int16_t)0x73A0, (int16_t)0x36D1, (int16_t)0x73AB, (int16_t)0x36BA,
+    (int16_t)0x73B6, (int16_t)0x36A3, (int16_t)0x73C1, (int16_t)0x368D, (int16_t)0x73CB,
+    (int16_t)0x3676, (int16_t)0x73D6, (int16_t)0x365F, (int16_t)0x73E1, (int16_t)0x3648,
+    (int16_t)0x73EB, (int16_t)0x3632, (int16_t)0x73F6, (int16_t)0x361B, (int16_t)0x7401,
+    (int16_t)0x3604, (int16_t)0x740B, (int16_t)0x35ED, (int16_t)0x7416, (int16_t)0x35D7,
+    (int16_t)0x7421, (int16_t)0x35C0, (int16_t)0x742B, (int16_t)0x35A9, (int16_t)0x7436,
+    (int16_t)0x3592, (int16_t)0x7440, (int16_t)0x357B, (int16_t)0x744B, (int16_t)0x3564,
+    (int16_t)0x7455, (int16_t)0x354E, (int16_t)0x7460, (int16_t)0x3537, (int16_t)0x746A,
+    (int16_t)0x3520, (int16_t)0x7475, (int16_t)0x3509, (int16_t)0x747F, (int16_t)0x34F2,
+    (int16_t)0x7489, (int16_t)0x34DB, (int16_t)0x7494, (int16_t)0x34C4, (int16_t)0x749E,
+    (int16_t)0x34AD, (int16_t)0x74A8, (int16_t)0x3497, (int16_t)0x74B3, (int16_t)0x3480,
+    (int16_t)0x74BD, (int16_t)0x3469, (int16_t)0x74C7, (int16_t)0x3452, (int16_t)0x74D2,
+    (int16_t)0x343B, (int16_t)0x74DC, (int16_t)0x3424, (int16_t)0x74E6, (int16_t)0x340D,
+    (int16_t)0x74F0, (int16_t)0x33F6, (int16_t)0x74FB, (int16_t)0x33DF, (int16_t)0x7505,
+    (int16_t)0x33C8, (int16_t)0x750F, (int16_t)0x33B1, (int16_t)0x7519, (int16_t)0x339A,
+    (int16_t)0x7523, (int16_t)0x3383, (int16_t)0x752D, (int16_t)0x336C, (int16_t)0x7538,
+    (int16_t)0x3355, (int16_t)0x7542, (int16_t)0x333E, (int16_t)0x754C, (int16_t)0x3327,
+    (int16_t)0x7556, (int16_t)0x3310, (int16_t)0x7560, (int16_t)0x32F9, (int16_t)0x756A,
+    (int16_t)0x32E2, (int16_t)0x7574, (int16_t)0x32CB, (int16_t)0x757E, (int16_t)0x32B4,
+    (int16_t)0x7588, (int16_t)0x329D, (int16_t)0x7592, (int16_t)0x3285, (int16_t)0x759C,
+    (int16_t)0x326E, (int16_t)0x75A6, (int16_t)0x3257, (int16_t)0x75AF, (int16_t)0x3240,
+    (int16_t)0x75B9, (int16_t)0x3229, (int16_t)0x75C3, (int16_t)0x3212, (int16_t)0x75CD,
+    (int16_t)0x31FB, (int16_t)0x75D7, (int16_t)0x31E4, (int16_t)0x75E1, (int16_t)0x31CC,
+    (int16_t)0x75EA, (int16_t)0x31B5, (int16_t)0x75F4, (int16_t)0x319E, (int16_t)0x75FE,
+    (int16_t)0x3187, (int16_t)0x7608, (int16_t)0x3170, (int16_t)0x7611, (int16_t)0x3159,
+    (int16_t)0x761B, (int16_t)0x3141, (int16_t)0x7625, (int16_t)0x312A, (int16_t)0x762E,
+    (int16_t)0x3113, (int16_t)0x7638, (int16_t)0x30FC, (int16_t)0x7642, (int16_t)0x30E5,
+    (int16_t)0x764B, (int16_t)0x30CD, (int16_t)0x7655, (int16_t)0x30B6, (int16_t)0x765E,
+    (int16_t)0x309F, (int16_t)0x7668, (int16_t)0x3088, (int16_t)0x7672, (int16_t)0x3070,
+    (int16_t)0x767B, (int16_t)0x3059, (int16_t)0x7685, (int16_t)0x3042, (int16_t)0x768E,
+    (int16_t)0x302A, (int16_t)0x7698, (int16_t)0x3013, (int16_t)0x76A1, (int16_t)0x2FFC,
+    (int16_t)0x76AA, (int16_t)0x2FE5, (int16_t)0x76B4, (int16_t)0x2FCD, (int16_t)0x76BD,
+    (int16_t)0x2FB6, (int16_t)0x76C7, (int16_t)0x2F9F, (int16_t)0x76D0, (int16_t)0x2F87,
+    (int16_t)0x76D9, (int16_t)0x2F70, (int16_t)0x76E3, (int16_t)0x2F59, (int16_t)0x76EC,
+    (int16_t)0x2F41, (int16_t)0x76F5, (int16_t)0x2F2A, (int16_t)0x76FE, (int16_t)0x2F13,
+    (int16_t)0x7708, (int16_t)0x2EFB, (int16_t)0x7711, (int16_t)0x2EE4, (int16_t)0x771A,
+    (int16_t)0x2ECC, (int16_t)0x7723, (int16_t)0x2EB5, (int16_t)0x772D, (int16_t)0x2E9E,
+    (int16_t)0x7736, (int16_t)0x2E86, (int16_t)0x773F, (int16_t)0x2E6F, (int16_t)0x7748,
+    (int16_t)0x2E57, (int16_t)0x7751, (int16_t)0x2E40, (int16_t)0x775A, (int16_t)0x2E28,
+    (int16_t)0x7763, (int16_t)0x2E11, (int16_t)0x776C, (int16_t)0x2DFA, (int16_t)0x7775,
+    (int16_t)0x2DE2, (int16_t)0x777E, (int16_t)0x2DCB, (int16_t)0x7787, (int16_t)0x2DB3,
+    (int16_t)0x7790, (int16_t)0x2D9C, (int16_t)0x7799, (int16_t)0x2D84, (int16_t)0x77A2,
+    (int16_t)0x2D6D, (int16_t)0x77AB, (int16_t)0x2D55, (int16_t)0x77B4, (int16_t)0x2D3E,
+    (int16_t)0x77BD, (int16_t)0x2D26, (int16_t)0x77C6, (int16_t)0x2D0F, (int16_t)0x77CF,
+    (int16_t)0x2CF7, (int16_t)0x77D8, (int16_t)0x2CE0, (int16_t)0x77E0, (int16_t)0x2CC8,
+    (int16_t)0x77E9, (int16_t)0x2CB1, (int16_t)0x77F2, (int16_t)0x2C99, (int16_t)0x77FB,
+    (int16_t)0x2C81, (int16_t)0x7803, (int16_t)0x2C6A, (int16_t)0x780C, (int16_t)0x2C52,
+    (int16_t)0x7815, (int16_t)0x2C3B, (int16_t)0x781E, (int16_t)0x2C23, (int16_t)0x7826,
+    (int16_t)0x2C0C, (int16_t)0x782F, (int16_t)0x2BF4, (int16_t)0x7838, (int16_t)0x2BDC,
+    (int16_t)0x7840, (int16_t)0x2BC5, (int16_t)0x7849, (int16_t)0x2BAD, (int16_t)0x7851,
+    (int16_t)0x2B95, (int16_t)0x785A, (int16_t)0x2B7E, (int16_t)0x7863, (int16_t)0x2B66,
+    (int16_t)0x786B, (int16_t)0x2B4F, (int16_t)0x7874, (int16_t)0x2B37, (int16_t)0x787C,
+    (int16_t)0x2B1F, (int16_t)0x7885, (int16_t)0x2B08, (int16_t)0x788D, (int16_t)0x2AF0,
+    (int16_t)0x7895, (int16_t)0x2AD8, (int16_t)0x789E, (int16_t)0x2AC1, (int16_t)0x78A6,
+    (int16_t)0x2AA9, (int16_t)0x78AF, (int16_t)0x2A91, (int16_t)0x78B7, (int16_t)0x2A79,
+    (int16_t)0x78BF, (int16_t)0x2A62, (int16_t)0x78C8, (int16_t)0x2A4A, (int16_t)0x78D0,
+    (int16_t)0x2A32, (int16_t)0x78D8, (int16_t)0x2A1B, (int16_t)0x78E1, (int16_t)0x2A03,
+    (int16_t)0x78E9, (int16_t)0x29EB, (int16_t)0x78F1, (int16_t)0x29D3, (int16_t)0x78F9,
+    (int16_t)0x29BC, (int16_t)0x7901, (int16_t)0x29A4, (int16_t)0x790A, (int16_t)0x298C,
+    (int16_t)0x7912, (int16_t)0x2974, (int16_t)0x791A, (int16_t)0x295C, (int16_t)0x7922,
+    (int16_t)0x2945, (int16_t)0x792A, (int16_t)0x292D, (int16_t)0x7932, (int16_t)0x2915,
+    (int16_t)0x793A, (int16_t)0x28FD, (int16_t)0x7942, (int16_t)0x28E5, (int16_t)0x794A,
+    (int16_t)0x28CE, (int16_t)0x7953, (int16_t)0x28B6, (int16_t)0x795B, (int16_t)0x289E,
+    (int16_t)0x7962, (int16_t)0x2886, (int16_t)0x796A, (int16_t)0x286E, (int16_t)0x7972,
+    (int16_t)0x2856, (int16_t)0x797A, (int16_t)0x283F, (int16_t)0x7982, (int16_t)0x2827,
+    (int16_t)0x798A, (int16_t)0x280F, (int16_t)0x7992, (int16_t)0x27F7, (int16_t)0x799A,
+    (int16_t)0x27DF, (int16_t)0x79A2, (int16_t)0x27C7, (int16_t)0x79AA, (int16_t)0x27AF,
+    (int16_t)0x79B1, (int16_t)0x2797, (int16_t)0x79B9, (int16_t)0x2780, (int16_t)0x79C1,
+    (int16_t)0x2768, (int16_t)0x79C9, (int16_t)0x2750, (int16_t)0x79D0, (int16_t)0x2738,
+    (int16_t)0x79D8, (int16_t)0x2720, (int16_t)0x79E0, (int16_t)0x2708, (int16_t)0x79E7,
+    (int16_t)0x26F0, (int16_t)0x79EF, (int16_t)0x26D8, (int16_t)0x79F7, (int16_t)0x26C0,
+    (int16_t)0x79FE, (int16_t)0x26A8, (int16_t)0x7A06, (int16_t)0x2690, (int16_t)0x7A0E,
+    (int16_t)0x2678, (int16_t)0x7A15, (int16_t)0x2660, (int16_t)0x7A1D, (int16_t)0x2648,
+    (int16_t)0x7A24, (int16_t)0x2630, (int16_t)0x7A2C, (int16_t)0x2618, (int16_t)0x7A33,
+    (int16_t)0x2600, (int16_t)0x7A3B, (int16_t)0x25E8, (int16_t)0x7A42, (int16_t)0x25D0,
+    (int16_t)0x7A49, (int16_t)0x25B8, (int16_t)0x7A51, (int16_t)0x25A0, (int16_t)0x7A58,
+    (int16_t)0x2588, (int16_t)0x7A60, (int16_t)0x2570, (int16_t)0x7A67, (int16_t)0x2558,
+    (int16_t)0x7A6E, (int16_t)0x2540, (int16_t)0x7A76, (int16_t)0x2528, (int16_t)0x7A7D,
+    (int16_t)0x2510, (int16_t)0x7A84, (int16_t)0x24F8, (int16_t)0x7A8C, (int16_t)0x24E0,
+    (int16_t)0x7A93, (int16_t)0x24C8, (int16_t)0x7A9A, (int16_t)0x24B0, (int16_t)0x7AA1,
+    (int16_t)0x2498, (int16_t)0x7AA8, (int16_t)0x2480, (int16_t)0x7AB0, (int16_t)0x2467,
+    (int16_t)0x7AB7, (int16_t)0x244F, (int16_t)0x7ABE, (int16_t)0x2437, (int16_t)0x7AC5,
+    (int16_t)0x241F, (int16_t)0x7ACC, (int16_t)0x2407, (int16_t)0x7AD3, (int16_t)0x23EF,
+    (int16_t)0x7ADA, (int16_t)0x23D7, (int16_t)0x7AE1, (int16_t)0x23BF, (int16_t)0x7AE8,
+    (int16_t)0x23A7, (int16_t)0x7AEF, (int16_t)0x238E, (int16_t)0x7AF6, (int16_t)0x2376,
+    (int16_t)0x7AFD, (int16_t)0x235E, (int16_t)0x7B04, (int16_t)0x2346, (int16_t)0x7B0B,
+    (int16_t)0x232E, (int16_t)0x7B12, (int16_t)0x2316, (int16_t)0x7B19, (int16_t)0x22FD,
+    (int16_t)0x7B20, (int16_t)0x22E5, (int16_t)0x7B27, (int16_t)0x22CD, (int16_t)0x7B2E,
+    (int16_t)0x22B5, (int16_t)0x7B34, (int16_t)0x229D, (int16_t)0x7B3B, (int16_t)0x2284,
+    (int16_t)0x7B42, (int16_t)0x226C, (int16_t)0x7B49, (int16_t)0x2254, (int16_t)0x7B50,
+    (int16_t)0x223C, (int16_t)0x7B56, (int16_t)0x2224, (int16_t)0x7B5D, (int16_t)0x220B,
+    (int16_t)0x7B64, (int16_t)0x21F3, (int16_t)0x7B6A, (int16_t)0x21DB, (int16_t)0x7B71,
+    (int16_t)0x21C3, (int16_t)0x7B78, (int16_t)0x21AA, (int16_t)0x7B7E, (int16_t)0x2192,
+    (int16_t)0x7B85, (int16_t)0x217A, (int16_t)0x7B8B, (int16_t)0x2162, (int16_t)0x7B92,
+    (int16_t)0x2149, (int16_t)0x7B99, (int16_t)0x2131, (int16_t)0x7B9F, (int16_t)0x2119,
+    (int16_t)0x7BA6, (int16_t)0x2101, (int16_t)0x7BAC, (int16_t)0x20E8, (int16_t)0x7BB3,
+    (int16_t)0x20D0, (int16_t)0x7BB9, (int16_t)0x20B8, (int16_t)0x7BBF, (int16_t)0x209F,
+    (int16_t)0x7BC6, (int16_t)0x2087, (int16_t)0x7BCC, (int16_t)0x206F, (int16_t)0x7BD3,
+    (int16_t)0x2057, (int16_t)0x7BD9, (int16_t)0x203E, (int16_t)0x7BDF, (int16_t)0x2026,
+    (int16_t)0x7BE6, (int16_t)0x200E, (int16_t)0x7BEC, (int16_t)0x1FF5, (int16_t)0x7BF2,
+    (int16_t)0x1FDD, (int16_t)0x7BF9, (int16_t)0x1FC5, (int16_t)0x7BFF, (int16_t)0x1FAC,
+    (int16_t)0x7C05, (int16_t)0x1F94, (int16_t)0x7C0B, (int16_t)0x1F7B, (int16_t)0x7C11,
+    (int16_t)0x1F63, (int16_t)0x7C18, (int16_t)0x1F4B, (int16_t)0x7C1E, (int16_t)0x1F32,
+    (int16_t)0x7C24, (int16_t)0x1F1A, (int16_t)0x7C2A, (int16_t)0x1F02, (int16_t)0x7C30,
+    (int16_t)0x1EE9, (int16_t)0x7C36, (int16_t)0x1ED1, (int16_t)0x7C3C, (int16_t)0x1EB8,
+    (int16_t)0x7C42, (int16_t)0x1EA0, (int16_t)0x7C48, (int16_t)0x1E88, (int16_t)0x7C4E,
+    (int16_t)0x1E6F, (int16_t)0x7C54, (int16_t)0x1E57, (int16_t)0x7C5A, (int16_t)0x1E3E,
+    (int16_t)0x7C60, (int16_t)0x1E26, (int16_t)0x7C66, (int16_t)0x1E0E, (int16_t)0x7C6C,
+    (int16_t)0x1DF5, (int16_t)0x7C72, (int16_t)0x1DDD, (int16_t)0x7C78, (int16_t)0x1DC4,
+    (int16_t)0x7C7E, (int16_t)0x1DAC, (int16_t)0x7C83, (int16_t)0x1D93, (int16_t)0x7C89,
+    (int16_t)0x1D7B, (int16_t)0x7C8F, (int16_t)0x1D62, (int16_t)0x7C95, (int16_t)0x1D4A,
+    (int16_t)0x7C9B, (int16_t)0x1D31, (int16_t)0x7CA0, (int16_t)0x1D19, (int16_t)0x7CA6,
+    (int16_t)0x1D01, (int16_t)0x7CAC, (int16_t)0x1CE8, (int16_t)0x7CB1, (int16_t)0x1CD0,
+    (int16_t)0x7CB7, (int16_t)0x1CB7, (int16_t)0x7CBD, (int16_t)0x1C9F, (int16_t)0x7CC2,
+    (int16_t)0x1C86, (int16_t)0x7CC8, (int16_t)0x1C6E, (int16_t)0x7CCE, (int16_t)0x1C55,
+    (int16_t)0x7CD3, (int16_t)0x1C3D, (int16_t)0x7CD9, (int16_t)0x1C24, (int16_t)0x7CDE,
+    (int16_t)0x1C0C, (int16_t)0x7CE4, (int16_t)0x1BF3, (int16_t)0x7CE9, (int16_t)0x1BDA,
+    (int16_t)0x7CEF, (int16_t)0x1BC2, (int16_t)0x7CF4, (int16_t)0x1BA9, (int16_t)0x7CFA,
+    (int16_t)0x1B91, (int16_t)0x7CFF, (int16_t)0x1B78, (int16_t)0x7D05, (int16_t)0x1B60,
+    (int16_t)0x7D0A, (int16_t)0x1B47, (int16_t)0x7D0F, (int16_t)0x1B2F, (int16_t)0x7D15,
+    (int16_t)0x1B16, (int16_t)0x7D1A, (int16_t)0x1AFE, (int16_t)0x7D1F, (int16_t)0x1AE5,
+    (int16_t)0x7D25, (int16_t)0x1ACC, (int16_t)0x7D2A, (int16_t)0x1AB4, (int16_t)0x7D2F,
+    (int16_t)0x1A9B, (int16_t)0x7D34, (int16_t)0x1A83, (int16_t)0x7D3A, (int16_t)0x1A6A,
+    (int16_t)0x7D3F, (int16_t)0x1A51, (int16_t)0x7D44, (int16_t)0x1A39, (int16_t)0x7D49,
+    (int16_t)0x1A20, (int16_t)0x7D4E, (int16_t)0x1A08, (int16_t)0x7D53, (int16_t)0x19EF,
+    (int16_t)0x7D58, (int16_t)0x19D6, (int16_t)0x7D5D, (int16_t)0x19BE, (int16_t)0x7D63,
+    (int16_t)0x19A5, (int16_t)0x7D68, (int16_t)0x198D, (int16_t)0x7D6D, (int16_t)0x1974,
+    (int16_t)0x7D72, (int16_t)0x195B, (int16_t)0x7D77, (int16_t)0x1943, (int16_t)0x7D7C,
+    (int16_t)0x192A, (int16_t)0x7D81, (int16_t)0x1911, (int16_t)0x7D85, (int16_t)0x18F9,
+    (int16_t)0x7D8A, (int16_t)0x18E0, (int16_t)0x7D8F, (int16_t)0x18C7, (int16_t)0x7D94,
+    (int16_t)0x18AF, (int16_t)0x7D99, (int16_t)0x1896, (int16_t)0x7D9E, (int16_t)0x187D,
+    (int16_t)0x7DA3, (int16_t)0x1865, (int16_t)0x7DA7, (int16_t)0x184C, (int16_t)0x7DAC,
+    (int16_t)0x1833, (int16_t)0x7DB1, (int16_t)0x181B, (int16_t)0x7DB6, (int16_t)0x1802,
+    (int16_t)0x7DBA, (int16_t)0x17E9, (int16_t)0x7DBF, (int16_t)0x17D1, (int16_t)0x7DC4,
+    (int16_t)0x17B8, (int16_t)0x7DC9, (int16_t)0x179F, (int16_t)0x7DCD, (int16_t)0x1787,
+    (int16_t)0x7DD2, (int16_t)0x176E, (int16_t)0x7DD6, (int16_t)0x1755, (int16_t)0x7DDB,
+    (int16_t)0x173C, (int16_t)0x7DE0, (int16_t)0x1724, (int16_t)0x7DE4, (int16_t)0x170B,
+    (int16_t)0x7DE9, (int16_t)0x16F2, (int16_t)0x7DED, (int16_t)0x16DA, (int16_t)0x7DF2,
+    (int16_t)0x16C1, (int16_t)0x7DF6, (int16_t)0x16A8, (int16_t)0x7DFB, (int16_t)0x168F,
+    (int16_t)0x7DFF, (int16_t)0x1677, (int16_t)0x7E03, (int16_t)0x165E, (int16_t)0x7E08,
+    (int16_t)0x1645, (int16_t)0x7E0C, (int16_t)0x162C, (int16_t)0x7E11, (int16_t)0x1614,
+    (int16_t)0x7E15, (int16_t)0x15FB, (int16_t)0x7E19, (int16_t)0x15E2, (int16_t)0x7E1E,
+    (int16_t)0x15C9, (int16_t)0x7E22, (int16_t)0x15B1, (int16_t)0x7E26, (int16_t)0x1598,
+    (int16_t)0x7E2A, (int16_t)0x157F, (int16_t)0x7E2F, (int16_t)0x1566, (int16_t)0x7E33,
+    (int16_t)0x154D, (int16_t)0x7E37, (int16_t)0x1535, (int16_t)0x7E3B, (int16_t)0x151C,
+    (int16_t)0x7E3F, (int16_t)0x1503, (int16_t)0x7E43, (int16_t)0x14EA, (int16_t)0x7E48,
+    (int16_t)0x14D1, (int16_t)0x7E4C, (int16_t)0x14B9, (int16_t)0x7E50, (int16_t)0x14A0,
+    (int16_t)0x7E54, (int16_t)0x1487, (int16_t)0x7E58, (int16_t)0x146E, (int16_t)0x7E5C,
+    (int16_t)0x1455, (int16_t)0x7E60, (int16_t)0x143D, (int16_t)0x7E64, (int16_t)0x1424,
+    (int16_t)0x7E68, (int16_t)0x140B, (int16_t)0x7E6C, (int16_t)0x13F2, (int16_t)0x7E70,
+    (int16_t)0x13D9, (int16_t)0x7E74, (int16_t)0x13C1, (int16_t)0x7E78, (int16_t)0x13A8,
+    (int16_t)0x7E7B, (int16_t)0x138F, (int16_t)0x7E7F, (int16_t)0x1376, (int16_t)0x7E83,
+    (int16_t)0x135D, (int16_t)0x7E87, (int16_t)0x1344, (int16_t)0x7E8B, (int16_t)0x132B,
+    (int16_t)0x7E8E, (int16_t)0x1313, (int16_t)0x7E92, (int16_t)0x12FA, (int16_t)0x7E96,
+    (int16_t)0x12E1, (int16_t)0x7E9A, (int16_t)0x12C8, (int16_t)0x7E9D, (int16_t)0x12AF,
+    (int16_t)0x7EA1, (int16_t)0x1296, (int16_t)0x7EA5, (int16_t)0x127D, (int16_t)0x7EA8,
+    (int16_t)0x1265, (int16_t)0x7EAC, (int16_t)0x124C, (int16_t)0x7EB0, (int16_t)0x1233,
+    (int16_t)0x7EB3, (int16_t)0x121A, (int16_t)0x7EB7, (int16_t)0x1201, (int16_t)0x7EBA,
+    (int16_t)0x11E8, (int16_t)0x7EBE, (int16_t)0x11CF, (int16_t)0x7EC1, (int16_t)0x11B6,
+    (int16_t)0x7EC5, (int16_t)0x119E, (int16_t)0x7EC8, (int16_t)0x1185, (int16_t)0x7ECC,
+    (int16_t)0x116C, (int16_t)0x7ECF, (int16_t)0x1153, (int16_t)0x7ED3, (int16_t)0x113A,
+    (int16_t)0x7ED6, (int16_t)0x1121, (int16_t)0x7ED9, (int16_t)0x1108, (int16_t)0x7EDD,
+    (int16_t)0x10EF, (int16_t)0x7EE0, (int16_t)0x10D6, (int16_t)0x7EE3, (int16_t)0x10BD,
+    (int16_t)0x7EE7, (int16_t)0x10A4, (int16_t)0x7EEA, (int16_t)0x108C, (int16_t)0x7EED,
+    (int16_t)0x1073, (int16_t)0x7EF0, (int16_t)0x105A, (int16_t)0x7EF4, (int16_t)0x1041,
+    (int16_t)0x7EF7, (int16_t)0x1028, (int16_t)0x7EFA, (int16_t)0x100F, (int16_t)0x7EFD,
+    (int16_t)0x0FF6, (int16_t)0x7F00, (int16_t)0x0FDD, (int16_t)0x7F03, (int16_t)0x0FC4,
+    (int16_t)0x7F06, (int16_t)0x0FAB, (int16_t)0x7F0A, (int16_t)0x0F92, (int16_t)0x7F0D,
+    (int16_t)0x0F79, (int16_t)0x7F10, (int16_t)0x0F60, (int16_t)0x7F13, (int16_t)0x0F47,
+    (int16_t)0x7F16, (int16_t)0x0F2E, (int16_t)0x7F19, (int16_t)0x0F15, (int16_t)0x7F1C,
+    (int16_t)0x0EFC, (int16_t)0x7F1F, (int16_t)0x0EE4, (int16_t)0x7F22, (int16_t)0x0ECB,
+    (int16_t)0x7F24, (int16_t)0x0EB2, (int16_t)0x7F27, (int16_t)0x0E99, (int16_t)0x7F2A,
+    (int16_t)0x0E80, (int16_t)0x7F2D, (int16_t)0x0E67, (int16_t)0x7F30, (int16_t)0x0E4E,
+    (int16_t)0x7F33, (int16_t)0x0E35, (int16_t)0x7F36, (int16_t)0x0E1C, (int16_t)0x7F38,
+    (int16_t)0x0E03, (int16_t)0x7F3B, (int16_t)0x0DEA, (int16_t)0x7F3E, (int16_t)0x0DD1,
+    (int16_t)0x7F41, (int16_t)0x0DB8, (int16_t)0x7F43, (int16_t)0x0D9F, (int16_t)0x7F46,
+    (int16_t)0x0D86, (int16_t)0x7F49, (int16_t)0x0D6D, (int16_t)0x7F4B, (int16_t)0x0D54,
+    (int16_t)0x7F4E, (int16_t)0x0D3B, (int16_t)0x7F50, (int16_t)0x0D22, (int16_t)0x7F53,
+    (int16_t)0x0D09, (int16_t)0x7F56, (int16_t)0x0CF0, (int16_t)0x7F58, (int16_t)0x0CD7,
+    (int16_t)0x7F5B, (int16_t)0x0CBE, (int16_t)0x7F5D, (int16_t)0x0CA5, (int16_t)0x7F60,
+    (int16_t)0x0C8C, (int16_t)0x7F62, (int16_t)0x0C73, (int16_t)0x7F65, (int16_t)0x0C5A,
+    (int16_t)0x7F67, (int16_t)0x0C41, (int16_t)0x7F6A, (int16_t)0x0C28, (int16_t)0x7F6C,
+    (int16_t)0x0C0F, (int16_t)0x7F6E, (int16_t)0x0BF6, (int16_t)0x7F71, (int16_t)0x0BDD,
+    (int16_t)0x7F73, (int16_t)0x0BC4, (int16_t)0x7F75, (int16_t)0x0BAB, (int16_t)0x7F78,
+    (int16_t)0x0B92, (int16_t)0x7F7A, (int16_t)0x0B79, (int16_t)0x7F7C, (int16_t)0x0B60,
+    (int16_t)0x7F7E, (int16_t)0x0B47, (int16_t)0x7F81, (int16_t)0x0B2D, (int16_t)0x7F83,
+    (int16_t)0x0B14, (int16_t)0x7F85, (int16_t)0x0AFB, (int16_t)0x7F87, (int16_t)0x0AE2,
+    (int16_t)0x7F89, (int16_t)0x0AC9, (int16_t)0x7F8B, (int16_t)0x0AB0, (int16_t)0x7F8E,
+    (int16_t)0x0A97, (int16_t)0x7F90, (int16_t)0x0A7E, (int16_t)0x7F92, (int16_t)0x0A65,
+    (int16_t)0x7F94, (int16_t)0x0A4C, (int16_t)0x7F96, (int16_t)0x0A33, (int16_t)0x7F98,
+    (int16_t)0x0A1A, (int16_t)0x7F9A, (int16_t)0x0A01, (int16_t)0x7F9C, (int16_t)0x09E8,
+    (int16_t)0x7F9E, (int16_t)0x09CF, (int16_t)0x7FA0, (int16_t)0x09B6, (int16_t)0x7FA2,
+    (int16_t)0x099D, (int16_t)0x7FA3, (int16_t)0x0984, (int16_t)0x7FA5, (int16_t)0x096B,
+    (int16_t)0x7FA7, (int16_t)0x0951, (int16_t)0x7FA9, (int16_t)0x0938, (int16_t)0x7FAB,
+    (int16_t)0x091F, (int16_t)0x7FAD, (int16_t)0x0906, (int16_t)0x7FAE, (int16_t)0x08ED,
+    (int16_t)0x7FB0, (int16_t)0x08D4, (int16_t)0x7FB2, (int16_t)0x08BB, (int16_t)0x7FB4,
+    (int16_t)0x08A2, (int16_t)0x7FB5, (int16_t)0x0889, (int16_t)0x7FB7, (int16_t)0x0870,
+    (int16_t)0x7FB9, (int16_t)0x0857, (int16_t)0x7FBA, (int16_t)0x083E, (int16_t)0x7FBC,
+    (int16_t)0x0825, (int16_t)0x7FBE, (int16_t)0x080C, (int16_t)0x7FBF, (int16_t)0x07F2,
+    (int16_t)0x7FC1, (int16_t)0x07D9, (int16_t)0x7FC2, (int16_t)0x07C0, (int16_t)0x7FC4,
+    (int16_t)0x07A7, (int16_t)0x7FC5, (int16_t)0x078E, (int16_t)0x7FC7, (int16_t)0x0775,
+    (int16_t)0x7FC8, (int16_t)0x075C, (int16_t)0x7FCA, (int16_t)0x0743, (int16_t)0x7FCB,
+    (int16_t)0x072A, (int16_t)0x7FCD, (int16_t)0x0711, (int16_t)0x7FCE, (int16_t)0x06F8,
+    (int16_t)0x7FCF, (int16_t)0x06DE, (int16_t)0x7FD1, (int16_t)0x06C5, (int16_t)0x7FD2,
+    (int16_t)0x06AC, (int16_t)0x7FD3, (int16_t)0x0693, (int16_t)0x7FD5, (int16_t)0x067A,
+    (int16_t)0x7FD6, (int16_t)0x0661, (int16_t)0x7FD7, (int16_t)0x0648, (int16_t)0x7FD9,
+    (int16_t)0x062F, (int16_t)0x7FDA, (int16_t)0x0616, (int16_t)0x7FDB, (int16_t)0x05FD,
+    (int16_t)0x7FDC, (int16_t)0x05E3, (int16_t)0x7FDD, (int16_t)0x05CA, (int16_t)0x7FDE,
+    (int16_t)0x05B1, (int16_t)0x7FE0, (int16_t)0x0598, (int16_t)0x7FE1, (int16_t)0x057F,
+    (int16_t)0x7FE2, (int16_t)0x0566, (int16_t)0x7FE3, (int16_t)0x054D, (int16_t)0x7FE4,
+    (int16_t)0x0534, (int16_t)0x7FE5, (int16_t)0x051B, (int16_t)0x7FE6, (int16_t)0x0501,
+    (int16_t)0x7FE7, (int16_t)0x04E8, (int16_t)0x7FE8, (int16_t)0x04CF, (int16_t)0x7FE9,
+    (int16_t)0x04B6, (int16_t)0x7FEA, (int16_t)0x049D, (int16_t)0x7FEB, (int16_t)0x0484,
+    (int16_t)0x7FEC, (int16_t)0x046B, (int16_t)0x7FEC, (int16_t)0x0452, (int16_t)0x7FED,
+    (int16_t)0x0439, (int16_t)0x7FEE, (int16_t)0x041F, (int16_t)0x7FEF, (int16_t)0x0406,
+    (int16_t)0x7FF0, (int16_t)0x03ED, (int16_t)0x7FF1, (int16_t)0x03D4, (int16_t)0x7FF1,
+    (int16_t)0x03BB, (int16_t)0x7FF2, (int16_t)0x03A2, (int16_t)0x7FF3, (int16_t)0x0389,
+    (int16_t)0x7FF4, (int16_t)0x0370, (int16_t)0x7FF4, (int16_t)0x0356, (int16_t)0x7FF5,
+    (int16_t)0x033D, (int16_t)0x7FF6, (int16_t)0x0324, (int16_t)0x7FF6, (int16_t)0x030B,
+    (int16_t)0x7FF7, (int16_t)0x02F2, (int16_t)0x7FF7, (int16_t)0x02D9, (int16_t)0x7FF8,
+    (int16_t)0x02C0, (int16_t)0x7FF8, (int16_t)0x02A7, (int16_t)0x7FF9, (int16_t)0x028D,
+    (int16_t)0x7FF9, (int16_t)0x0274, (int16_t)0x7FFA, (int16_t)0x025B, (int16_t)0x7FFA,
+    (int16_t)0x0242, (int16_t)0x7FFB, (int16_t)0x0229, (int16_t)0x7FFB, (int16_t)0x0210,
+    (int16_t)0x7FFC, (int16_t)0x01F7, (int16_t)0x7FFC, (int16_t)0x01DE, (int16_t)0x7FFD,
+    (int16_t)0x01C4, (int16_t)0x7FFD, (int16_t)0x01AB, (int16_t)0x7FFD, (int16_t)0x0192,
+    (int16_t)0x7FFE, (int16_t)0x0179, (int16_t)0x7FFE, (int16_t)0x0160, (int16_t)0x7FFE,
+    (int16_t)0x0147, (int16_t)0x7FFE, (int16_t)0x012E, (int16_t)0x7FFF, (int16_t)0x0114,
+    (int16_t)0x7FFF, (int16_t)0x00FB, (int16_t)0x7FFF, (int16_t)0x00E2, (int16_t)0x7FFF,
+    (int16_t)0x00C9, (int16_t)0x7FFF, (int16_t)0x00B0, (int16_t)0x7FFF, (int16_t)0x0097,
+    (int16_t)0x7FFF, (int16_t)0x007E, (int16_t)0x7FFF, (int16_t)0x0065, (int16_t)0x7FFF,
+    (int16_t)0x004B, (int16_t)0x7FFF, (int16_t)0x0032, (int16_t)0x7FFF, (int16_t)0x0019,
+    (int16_t)0x7FFF
+};
+
+/**
+  @par
+  Twiddle factors of the fixed-point DCTs (plp_dct_instance_q32) of length N, which are used for the
+  pre- and post-rotations around the complex FFT of length N/2:
+  @par
+  <pre> for(m = 0; m < 2N; m++)
+  {
+     twiddleCoefDct[2*m]   = cos(m * PI/(4*N));
+     twiddleCoefDct[2*m+1] = sin(m * PI/(4*N));
+  } </pre>
+  @par
+  Convert Floating point to q32(Fixed point 1.31):
+  round(twiddleCoefDct(i) * pow(2, 31)), saturated
+ */
+const int32_t twiddleCoef_dct_32_q32[128] = {
+    (int32_t)0x7FFFFFFF, (int32_t)0x00000000, (int32_t)0x7FF62182, (int32_t)0x03242ABF,
+    (int32_t)0x7FD8878E, (int32_t)0x0647D97C, (int32_t)0x7FA736B4, (int32_t)0x096A9049,
+    (int32_t)0x7F62368F, (int32_t)0x0C8BD35E, (int32_t)0x7F0991C4, (int32_t)0x0FAB272B,
+    (int32_t)0x7E9D55FC, (int32_t)0x12C8106F, (int32_t)0x7E1D93EA, (int32_t)0x15E21445,
+    (int32_t)0x7D8A5F40, (int32_t)0x18F8B83C, (int32_t)0x7CE3CEB2, (int32_t)0x1C0B826A,
+    (int32_t)0x7C29FBEE, (int32_t)0x1F19F97B, (int32_t)0x7B5D039E, (int32_t)0x2223A4C5,
+    (int32_t)0x7A7D055B, (int32_t)0x25280C5E, (int32_t)0x798A23B1, (int32_t)0x2826B928,
+    (int32_t)0x78848414, (int32_t)0x2B1F34EB, (int32_t)0x776C4EDB, (int32_t)0x2E110A62,
+    (int32_t)0x7641AF3D, (int32_t)0x30FBC54D, (int32_t)0x7504D345, (int32_t)0x33DEF287,
+    (int32_t)0x73B5EBD1, (int32_t)0x36BA2014, (int32_t)0x72552C85, (int32_t)0x398CDD32,
+    (int32_t)0x70E2CBC6, (int32_t)0x3C56BA70, (int32_t)0x6F5F02B2, (int32_t)0x3F1749B8,
+    (int32_t)0x6DCA0D14, (int32_t)0x41CE1E65, (int32_t)0x6C242960, (int32_t)0x447ACD50,
+    (int32_t)0x6A6D98A4, (int32_t)0x471CECE7, (int32_t)0x68A69E81, (int32_t)0x49B41533,
+    (int32_t)0x66CF8120, (int32_t)0x4C3FDFF4, (int32_t)0x64E88926, (int32_t)0x4EBFE8A5,
+    (int32_t)0x62F201AC, (int32_t)0x5133CC94, (int32_t)0x60EC3830, (int32_t)0x539B2AF0,
+    (int32_t)0x5ED77C8A, (int32_t)0x55F5A4D2, (int32_t)0x5CB420E0, (int32_t)0x5842DD54,
+    (int32_t)0x5A82799A, (int32_t)0x5A82799A, (int32_t)0x5842DD54, (int32_t)0x5CB420E0,
+    (int32_t)0x55F5A4D2, (int32_t)0x5ED77C8A, (int32_t)0x539B2AF0, (int32_t)0x60EC3830,
+    (int32_t)0x5133CC94, (int32_t)0x62F201AC, (int32_t)0x4EBFE8A5, (int32_t)0x64E88926,
+    (int32_t)0x4C3FDFF4, (int32_t)0x66CF8120, (int32_t)0x49B41533, (int32_t)0x68A69E81,
+    (int32_t)0x471CECE7, (int32_t)0x6A6D98A4, (int32_t)0x447ACD50, (int32_t)0x6C242960,
+    (int32_t)0x41CE1E65, (int32_t)0x6DCA0D14, (int32_t)0x3F1749B8, (int32_t)0x6F5F02B2,
+    (int32_t)0x3C56BA70, (int32_t)0x70E2CBC6, (int32_t)0x398CDD32, (int32_t)0x72552C85,
+    (int32_t)0x36BA2014, (int32_t)0x73B5EBD1, (int32_t)0x33DEF287, (int32_t)0x7504D345,
+    (int32_t)0x30FBC54D, (int32_t)0x7641AF3D, (int32_t)0x2E110A62, (int32_t)0x776C4EDB,
+    (int32_t)0x2B1F34EB, (int32_t)0x78848414, (int32_t)0x2826B928, (int32_t)0x798A23B1,
+    (int32_t)0x25280C5E, (int32_t)0x7A7D055B, (int32_t)0x2223A4C5, (int32_t)0x7B5D039E,
+    (int32_t)0x1F19F97B, (int32_t)0x7C29FBEE, (int32_t)0x1C0B826A, (int32_t)0x7CE3CEB2,
+    (int32_t)0x18F8B83C, (int32_t)0x7D8A5F40, (int32_t)0x15E21445, (int32_t)0x7E1D93EA,
+    (int32_t)0x12C8106F, (int32_t)0x7E9D55FC, (int32_t)0x0FAB272B, (int32_t)0x7F0991C4,
+    (int32_t)0x0C8BD35E, (int32_t)0x7F62368F, (int32_t)0x096A9049, (int32_t)0x7FA736B4,
+    (int32_t)0x0647D97C, (int32_t)0x7FD8878E, (int32_t)0x03242ABF, (int32_t)0x7FF62182
+};
+
+const int32_t twiddleCoef_dct_64_q32[256] = {
+    (int32_t)0x7FFFFFFF, (int32_t)0x00000000, (int32_t)0x7FFD885A, (int32_t)0x01921D20,
+    (int32_t)0x7FF62182, (int32_t)0x03242ABF, (int32_t)0x7FE9CBC0, (int32_t)0x04B6195D,
+    (int32_t)0x7FD8878E, (int32_t)0x0647D97C, (int32_t)0x7FC25596, (int32_t)0x07D95B9E,
+    (int32_t)0x7FA736B4, (int32_t)0x096A9049, (int32_t)0x7F872BF3, (int32_t)0x0AFB6805,
+    (int32_t)0x7F62368F, (int32_t)0x0C8BD35E, (int32_t)0x7F3857F6, (int32_t)0x0E1BC2E4,
+    (int32_t)0x7F0991C4, (int32_t)0x0FAB272B, (int32_t)0x7ED5E5C6, (int32_t)0x1139F0CF,
+    (int32_t)0x7E9D55FC, (int32_t)0x12C8106F, (int32_t)0x7E5FE493, (int32_t)0x145576B1,
+    (int32_t)0x7E1D93EA, (int32_t)0x15E21445, (int32_t)0x7DD6668F, (int32_t)0x176DD9DE,
+    (int32_t)0x7D8A5F40, (int32_t)0x18F8B83C, (int32_t)0x7D3980EC, (int32_t)0x1A82A026,
+    (int32_t)0x7CE3CEB2, (int32_t)0x1C0B826A, (int32_t)0x7C894BDE, (int32_t)0x1D934FE5,
+    (int32_t)0x7C29FBEE, (int32_t)0x1F19F97B, (int32_t)0x7BC5E290, (int32_t)0x209F701C,
+    (int32_t)0x7B5D039E, (int32_t)0x2223A4C5, (int32_t)0x7AEF6323, (int32_t)0x23A6887F,
+    (int32_t)0x7A7D055B, (int32_t)0x25280C5E, (int32_t)0x7A05EEAD, (int32_t)0x26A82186,
+    (int32_t)0x798A23B1, (int32_t)0x2826B928, (int32_t)0x7909A92D, (int32_t)0x29A3C485,
+    (int32_t)0x78848414, (int32_t)0x2B1F34EB, (int32_t)0x77FAB989, (int32_t)0x2C98FBBA,
+    (int32_t)0x776C4EDB, (int32_t)0x2E110A62, (int32_t)0x76D94989, (int32_t)0x2F875262,
+    (int32_t)0x7641AF3D, (int32_t)0x30FBC54D, (int32_t)0x75A585CF, (int32_t)0x326E54C7,
+    (int32_t)0x7504D345, (int32_t)0x33DEF287, (int32_t)0x745F9DD1, (int32_t)0x354D9057,
+    (int32_t)0x73B5EBD1, (int32_t)0x36BA2014, (int32_t)0x7307C3D0, (int32_t)0x382493B0,
+    (int32_t)0x72552C85, (int32_t)0x398CDD32, (int32_t)0x719E2CD2, (int32_t)0x3AF2EEB7,
+    (int32_t)0x70E2CBC6, (int32_t)0x3C56BA70, (int32_t)0x7023109A, (int32_t)0x3DB832A6,
+    (int32_t)0x6F5F02B2, (int32_t)0x3F1749B8, (int32_t)0x6E96A99D, (int32_t)0x4073F21D,
+    (int32_t)0x6DCA0D14, (int32_t)0x41CE1E65, (int32_t)0x6CF934FC, (int32_t)0x4325C135,
+    (int32_t)0x6C242960, (int32_t)0x447ACD50, (int32_t)0x6B4AF279, (int32_t)0x45CD358F,
+    (int32_t)0x6A6D98A4, (int32_t)0x471CECE7, (int32_t)0x698C246C, (int32_t)0x4869E665,
+    (int32_t)0x68A69E81, (int32_t)0x49B41533, (int32_t)0x67BD0FBD, (int32_t)0x4AFB6C98,
+    (int32_t)0x66CF8120, (int32_t)0x4C3FDFF4, (int32_t)0x65DDFBD3, (int32_t)0x4D8162C4,
+    (int32_t)0x64E88926, (int32_t)0x4EBFE8A5, (int32_t)0x63EF3290, (int32_t)0x4FFB654D,
+    (int32_t)0x62F201AC, (int32_t)0x5133CC94, (int32_t)0x61F1003F, (int32_t)0x5269126E,
+    (int32_t)0x60EC3830, (int32_t)0x539B2AF0, (int32_t)0x5FE3B38D, (int32_t)0x54CA0A4B,
+    (int32_t)0x5ED77C8A, (int32_t)0x55F5A4D2, (int32_t)0x5DC79D7C, (int32_t)0x571DEEFA,
+    (int32_t)0x5CB420E0, (int32_t)0x5842DD54, (int32_t)0x5B9D1154, (int32_t)0x59646498,
+    (int32_t)0x5A82799A, (int32_t)0x5A82799A, (int32_t)0x59646498, (int32_t)0x5B9D1154,
+    (int32_t)0x5842DD54, (int32_t)0x5CB420E0, (int32_t)0x571DEEFA, (int32_t)0x5DC79D7C,
+    (int32_t)0x55F5A4D2, (int32_t)0x5ED77C8A, (int32_t)0x54CA0A4B, (int32_t)0x5FE3B38D,
+    (int32_t)0x539B2AF0, (int32_t)0x60EC3830, (int32_t)0x5269126E, (int32_t)0x61F1003F,
+    (int32_t)0x5133CC94, (int32_t)0x62F201AC, (int32_t)0x4FFB654D, (int32_t)0x63EF3290,
+    (int32_t)0x4EBFE8A5, (int32_t)0x64E88926, (int32_t)0x4D8162C4, (int32_t)0x65DDFBD3,
+    (int32_t)0x4C3FDFF4, (int32_t)0x66CF8120, (int32_t)0x4AFB6C98, (int32_t)0x67BD0FBD,
+    (int32_t)0x49B41533, (int32_t)0x68A69E81, (int32_t)0x4869E665, (int32_t)0x698C246C,
+    (int32_t)0x471CECE7, (int32_t)0x6A6D98A4, (int32_t)0x45CD358F, (int32_t)0x6B4AF279,
+    (int32_t)0x447ACD50, (int32_t)0x6C242960, (int32_t)0x4325C135, (int32_t)0x6CF934FC,
+    (int32_t)0x41CE1E65, (int32_t)0x6DCA0D14, (int32_t)0x4073F21D, (int32_t)0x6E96A99D,
+    (int32_t)0x3F1749B8, (int32_t)0x6F5F02B2, (int32_t)0x3DB832A6, (int32_t)0x7023109A,
+    (int32_t)0x3C56BA70, (int32_t)0x70E2CBC6, (int32_t)0x3AF2EEB7, (int32_t)0x719E2CD2,
+    (int32_t)0x398CDD32, (int32_t)0x72552C85, (int32_t)0x382493B0, (int32_t)0x7307C3D0,
+    (int32_t)0x36BA2014, (int32_t)0x73B5EBD1, (int32_t)0x354D9057, (int32_t)0x745F9DD1,
+    (int32_t)0x33DEF287, (int32_t)0x7504D345, (int32_t)0x326E54C7, (int32_t)0x75A585CF,
+    (int32_t)0x30FBC54D, (int32_t)0x7641AF3D, (int32_t)0x2F875262, (int32_t)0x76D94989,
+    (int32_t)0x2E110A62, (int32_t)0x776C4EDB, (int32_t)0x2C98FBBA, (int32_t)0x77FAB989,
+    (int32_t)0x2B1F34EB, (int32_t)0x78848414, (int32_t)0x29A3C485, (int32_t)0x7909A92D,
+    (int32_t)0x2826B928, (int32_t)0x798A23B1, (int32_t)0x26A82186, (int32_t)0x7A05EEAD,
+    (int32_t)0x25280C5E, (int32_t)0x7A7D055B, (int32_t)0x23A6887F, (int32_t)0x7AEF6323,
+    (int32_t)0x2223A4C5, (int32_t)0x7B5D039E, (int32_t)0x209F701C, (int32_t)0x7BC5E290,
+    (int32_t)0x1F19F97B, (int32_t)0x7C29FBEE, (int32_t)0x1D934FE5, (int32_t)0x7C894BDE,
+    (int32_t)0x1C0B826A, (int32_t)0x7CE3CEB2, (int32_t)0x1A82A026, (int32_t)0x7D3980EC,
+    (int32_t)0x18F8B83C, (int32_t)0x7D8A5F40, (int32_t)0x176DD9DE, (int32_t)0x7DD6668F,
+    (int32_t)0x15E21445, (int32_t)0x7E1D93EA, (int32_t)0x145576B1, (int32_t)0x7E5FE493,
+    (int32_t)0x12C8106F, (int32_t)0x7E9D55FC, (int32_t)0x1139F0CF, (int32_t)0x7ED5E5C6,
+    (int32_t)0x0FAB272B, (int32_t)0x7F0991C4, (int32_t)0x0E1BC2E4, (int32_t)0x7F3857F6,
+    (int32_t)0x0C8BD35E, (int32_t)0x7F62368F, (int32_t)0x0AFB6805, (int32_t)0x7F872BF3,
+    (int32_t)0x096A9049, (int32_t)0x7FA736B4, (int32_t)0x07D95B9E, (int32_t)0x7FC25596,
+    (int32_t)0x0647D97C, (int32_t)0x7FD8878E, (int32_t)0x04B6195D, (int32_t)0x7FE9CBC0,
+    (int32_t)0x03242ABF, (int32_t)0x7FF62182, (int32_t)0x01921D20, (int32_t)0x7FFD885A
+};
+
+const int32_t twiddleCoef_dct_128_q32[512] = {
+    (int32_t)0x7FFFFFFF, (int32_t)0x00000000, (int32_t)0x7FFF6216, (int32_t)0x00C90F88,
+    (int32_t)0x7FFD885A, (int32_t)0x01921D20, (int32_t)0x7FFA72D1, (int32_t)0x025B26D7,
+    (int32_t)0x7FF62182, (int32_t)0x03242ABF, (int32_t)0x7FF09478, (int32_t)0x03ED26E6,
+    (int32_t)0x7FE9CBC0, (int32_t)0x04B6195D, (int32_t)0x7FE1C76B, (int32_t)0x057F0035,
+    (int32_t)0x7FD8878E, (int32_t)0x0647D97C, (int32_t)0x7FCE0C3E, (int32_t)0x0710A345,
+    (int32_t)0x7FC25596, (int32_t)0x07D95B9E, (int32_t)0x7FB563B3, (int32_t)0x08A2009A,
+    (int32_t)0x7FA736B4, (int32_t)0x096A9049, (int32_t)0x7F97CEBD, (int32_t)0x0A3308BD,
+    (int32_t)0x7F872BF3, (int32_t)0x0AFB6805, (int32_t)0x7F754E80, (int32_t)0x0BC3AC35,
+    (int32_t)0x7F62368F, (int32_t)0x0C8BD35E, (int32_t)0x7F4DE451, (int32_t)0x0D53DB92,
+    (int32_t)0x7F3857F6, (int32_t)0x0E1BC2E4, (int32_t)0x7F2191B4, (int32_t)0x0EE38766,
+    (int32_t)0x7F0991C4, (int32_t)0x0FAB272B, (int32_t)0x7EF05860, (int32_t)0x1072A048,
+    (int32_t)0x7ED5E5C6, (int32_t)0x1139F0CF, (int32_t)0x7EBA3A39, (int32_t)0x120116D5,
+    (int32_t)0x7E9D55FC, (int32_t)0x12C8106F, (int32_t)0x7E7F3957, (int32_t)0x138EDBB1,
+    (int32_t)0x7E5FE493, (int32_t)0x145576B1, (int32_t)0x7E3F57FF, (int32_t)0x151BDF86,
+    (int32_t)0x7E1D93EA, (int32_t)0x15E21445, (int32_t)0x7DFA98A8, (int32_t)0x16A81305,
+    (int32_t)0x7DD6668F, (int32_t)0x176DD9DE, (int32_t)0x7DB0FDF8, (int32_t)0x183366E9,
+    (int32_t)0x7D8A5F40, (int32_t)0x18F8B83C, (int32_t)0x7D628AC6, (int32_t)0x19BDCBF3,
+    (int32_t)0x7D3980EC, (int32_t)0x1A82A026, (int32_t)0x7D0F4218, (int32_t)0x1B4732EF,
+    (int32_t)0x7CE3CEB2, (int32_t)0x1C0B826A, (int32_t)0x7CB72724, (int32_t)0x1CCF8CB3,
+    (int32_t)0x7C894BDE, (int32_t)0x1D934FE5, (int32_t)0x7C5A3D50, (int32_t)0x1E56CA1E,
+    (int32_t)0x7C29FBEE, (int32_t)0x1F19F97B, (int32_t)0x7BF88830, (int32_t)0x1FDCDC1B,
+    (int32_t)0x7BC5E290, (int32_t)0x209F701C, (int32_t)0x7B920B89, (int32_t)0x2161B3A0,
+    (int32_t)0x7B5D039E, (int32_t)0x2223A4C5, (int32_t)0x7B26CB4F, (int32_t)0x22E541AF,
+    (int32_t)0x7AEF6323, (int32_t)0x23A6887F, (int32_t)0x7AB6CBA4, (int32_t)0x24677758,
+    (int32_t)0x7A7D055B, (int32_t)0x25280C5E, (int32_t)0x7A4210D8, (int32_t)0x25E845B6,
+    (int32_t)0x7A05EEAD, (int32_t)0x26A82186, (int32_t)0x79C89F6E, (int32_t)0x27679DF4,
+    (int32_t)0x798A23B1, (int32_t)0x2826B928, (int32_t)0x794A7C12, (int32_t)0x28E5714B,
+    (int32_t)0x7909A92D, (int32_t)0x29A3C485, (int32_t)0x78C7ABA2, (int32_t)0x2A61B101,
+    (int32_t)0x78848414, (int32_t)0x2B1F34EB, (int32_t)0x78403329, (int32_t)0x2BDC4E6F,
+    (int32_t)0x77FAB989, (int32_t)0x2C98FBBA, (int32_t)0x77B417DF, (int32_t)0x2D553AFC,
+    (int32_t)0x776C4EDB, (int32_t)0x2E110A62, (int32_t)0x77235F2D, (int32_t)0x2ECC681E,
+    (int32_t)0x76D94989, (int32_t)0x2F875262, (int32_t)0x768E0EA6, (int32_t)0x3041C761,
+    (int32_t)0x7641AF3D, (int32_t)0x30FBC54D, (int32_t)0x75F42C0B, (int32_t)0x31B54A5E,
+    (int32_t)0x75A585CF, (int32_t)0x326E54C7, (int32_t)0x7555BD4C, (int32_t)0x3326E2C3,
+    (int32_t)0x7504D345, (int32_t)0x33DEF287, (int32_t)0x74B2C884, (int32_t)0x34968250,
+    (int32_t)0x745F9DD1, (int32_t)0x354D9057, (int32_t)0x740B53FB, (int32_t)0x36041AD9,
+    (int32_t)0x73B5EBD1, (int32_t)0x36BA2014, (int32_t)0x735F6626, (int32_t)0x376F9E46,
+    (int32_t)0x7307C3D0, (int32_t)0x382493B0, (int32_t)0x72AF05A7, (int32_t)0x38D8FE93,
+    (int32_t)0x72552C85, (int32_t)0x398CDD32, (int32_t)0x71FA3949, (int32_t)0x3A402DD2,
+    (int32_t)0x719E2CD2, (int32_t)0x3AF2EEB7, (int32_t)0x71410805, (int32_t)0x3BA51E29,
+    (int32_t)0x70E2CBC6, (int32_t)0x3C56BA70, (int32_t)0x708378FF, (int32_t)0x3D07C1D6,
+    (int32_t)0x7023109A, (int32_t)0x3DB832A6, (int32_t)0x6FC19385, (int32_t)0x3E680B2C,
+    (int32_t)0x6F5F02B2, (int32_t)0x3F1749B8, (int32_t)0x6EFB5F12, (int32_t)0x3FC5EC98,
+    (int32_t)0x6E96A99D, (int32_t)0x4073F21D, (int32_t)0x6E30E34A, (int32_t)0x4121589B,
+    (int32_t)0x6DCA0D14, (int32_t)0x41CE1E65, (int32_t)0x6D6227FA, (int32_t)0x427A41D0,
+    (int32_t)0x6CF934FC, (int32_t)0x4325C135, (int32_t)0x6C8F351C, (int32_t)0x43D09AED,
+    (int32_t)0x6C242960, (int32_t)0x447ACD50, (int32_t)0x6BB812D1, (int32_t)0x452456BD,
+    (int32_t)0x6B4AF279, (int32_t)0x45CD358F, (int32_t)0x6ADCC964, (int32_t)0x46756828,
+    (int32_t)0x6A6D98A4, (int32_t)0x471CECE7, (int32_t)0x69FD614A, (int32_t)0x47C3C22F,
+    (int32_t)0x698C246C, (int32_t)0x4869E665, (int32_t)0x6919E320, (int32_t)0x490F57EE,
+    (int32_t)0x68A69E81, (int32_t)0x49B41533, (int32_t)0x683257AB, (int32_t)0x4A581C9E,
+    (int32_t)0x67BD0FBD, (int32_t)0x4AFB6C98, (int32_t)0x6746C7D8, (int32_t)0x4B9E0390,
+    (int32_t)0x66CF8120, (int32_t)0x4C3FDFF4, (int32_t)0x66573CBB, (int32_t)0x4CE10034,
+    (int32_t)0x65DDFBD3, (int32_t)0x4D8162C4, (int32_t)0x6563BF92, (int32_t)0x4E210617,
+    (int32_t)0x64E88926, (int32_t)0x4EBFE8A5, (int32_t)0x646C59BF, (int32_t)0x4F5E08E3,
+    (int32_t)0x63EF3290, (int32_t)0x4FFB654D, (int32_t)0x637114CC, (int32_t)0x5097FC5E,
+    (int32_t)0x62F201AC, (int32_t)0x5133CC94, (int32_t)0x6271FA69, (int32_t)0x51CED46E,
+    (int32_t)0x61F1003F, (int32_t)0x5269126E, (int32_t)0x616F146C, (int32_t)0x53028518,
+    (int32_t)0x60EC3830, (int32_t)0x539B2AF0, (int32_t)0x60686CCF, (int32_t)0x5433027D,
+    (int32_t)0x5FE3B38D, (int32_t)0x54CA0A4B, (int32_t)0x5F5E0DB3, (int32_t)0x556040E2,
+    (int32_t)0x5ED77C8A, (int32_t)0x55F5A4D2, (int32_t)0x5E50015D, (int32_t)0x568A34A9,
+    (int32_t)0x5DC79D7C, (int32_t)0x571DEEFA, (int32_t)0x5D3E5237, (int32_t)0x57B0D256,
+    (int32_t)0x5CB420E0, (int32_t)0x5842DD54, (int32_t)0x5C290ACC, (int32_t)0x58D40E8C,
+    (int32_t)0x5B9D1154, (int32_t)0x59646498, (int32_t)0x5B1035CF, (int32_t)0x59F3DE12,
+    (int32_t)0x5A82799A, (int32_t)0x5A82799A, (int32_t)0x59F3DE12, (int32_t)0x5B1035CF,
+    (int32_t)0x59646498, (int32_t)0x5B9D1154, (int32_t)0x58D40E8C, (int32_t)0x5C290ACC,
+    (int32_t)0x5842DD54, (int32_t)0x5CB420E0, (int32_t)0x57B0D256, (int32_t)0x5D3E5237,
+    (int32_t)0x571DEEFA, (int32_t)0x5DC79D7C, (int32_t)0x568A34A9, (int32_t)0x5E50015D,
+    (int32_t)0x55F5A4D2, (int32_t)0x5ED77C8A, (int32_t)0x556040E2, (int32_t)0x5F5E0DB3,
+    (int32_t)0x54CA0A4B, (int32_t)0x5FE3B38D, (int32_t)0x5433027D, (int32_t)0x60686CCF,
+    (int32_t)0x539B2AF0, (int32_t)0x60EC3830, (int32_t)0x53028518, (int32_t)0x616F146C,
+    (int32_t)0x5269126E, (int32_t)0x61F1003F, (int32_t)0x51CED46E, (int32_t)0x6271FA69,
+    (int32_t)0x5133CC94, (int32_t)0x62F201AC, (int32_t)0x5097FC5E, (int32_t)0x637114CC,
+    (int32_t)0x4FFB654D, (int32_t)0x63EF3290, (int32_t)0x4F5E08E3, (int32_t)0x646C59BF,
+    (int32_t)0x4EBFE8A5, (int32_t)0x64E88926, (int32_t)0x4E210617, (int32_t)0x6563BF92,
+    (int32_t)0x4D8162C4, (int32_t)0x65DDFBD3, (int32_t)0x4CE10034, (int32_t)0x66573CBB,
+    (int32_t)0x4C3FDFF4, (int32_t)0x66CF8120, (int32_t)0x4B9E0390, (int32_t)0x6746C7D8,
+    (int32_t)0x4AFB6C98, (int32_t)0x67BD0FBD, (int32_t)0x4A581C9E, (int32_t)0x683257AB,
+    (int32_t)0x49B41533, (int32_t)0x68A69E81, (int32_t)0x490F57EE, (int32_t)0x6919E320,
+    (int32_t)0x4869E665, (int32_t)0x698C246C, (int32_t)0x47C3C22F, (int32_t)0x69FD614A,
+    (int32_t)0x471CECE7, (int32_t)0x6A6D98A4, (int32_t)0x46756828, (int32_t)0x6ADCC964,
+    (int32_t)0x45CD358F, (int32_t)0x6B4AF279, (int32_t)0x452456BD, (int32_t)0x6BB812D1,
+    (int32_t)0x447ACD50, (int32_t)0x6C242960, (int32_t)0x43D09AED, (int32_t)0x6C8F351C,
+    (int32_t)0x4325C135, (int32_t)0x6CF934FC, (int32_t)0x427A41D0, (int32_t)0x6D6227FA,
+    (int32_t)0x41CE1E65, (int32_t)0x6DCA0D14, (int32_t)0x4121589B, (int32_t)0x6E30E34A,
+    (int32_t)0x4073F21D, (int32_t)0x6E96A99D, (int32_t)0x3FC5EC98, (int32_t)0x6EFB5F12,
+    (int32_t)0x3F1749B8, (int32_t)0x6F5F02B2, (int32_t)0x3E680B2C, (int32_t)0x6FC19385,
+    (int32_t)0x3DB832A6, (int32_t)0x7023109A, (int32_t)0x3D07C1D6, (int32_t)0x708378FF,
+    (int32_t)0x3C56BA70, (int32_t)0x70E2CBC6, (int32_t)0x3BA51E29, (int32_t)0x71410805,
+    (int32_t)0x3AF2EEB7, (int32_t)0x719E2CD2, (int32_t)0x3A402DD2, (int32_t)0x71FA3949,
+    (int32_t)0x398CDD32, (int32_t)0x72552C85, (int32_t)0x38D8FE93, (int32_t)0x72AF05A7,
+    (int32_t)0x382493B0, (int32_t)0x7307C3D0, (int32_t)0x376F9E46, (int32_t)0x735F6626,
+    (int32_t)0x36BA2014, (int32_t)0x73B5EBD1, (int32_t)0x36041AD9, (int32_t)0x740B53FB,
+    (int32_t)0x354D9057, (int32_t)0x745F9DD1, (int32_t)0x34968250, (int32_t)0x74B2C884,
+    (int32_t)0x33DEF287, (int32_t)0x7504D345, (int32_t)0x3326E2C3, (int32_t)0x7555BD4C,
+    (int32_t)0x326E54C7, (int32_t)0x75A585CF, (int32_t)0x31B54A5E, (int32_t)0x75F42C0B,
+    (int32_t)0x30FBC54D, (int32_t)0x7641AF3D, (int32_t)0x3041C761, (int32_t)0x768E0EA6,
+    (int32_t)0x2F875262, (int32_t)0x76D94989, (int32_t)0x2ECC681E, (int32_t)0x77235F2D,
+    (int32_t)0x2E110A62, (int32_t)0x776C4EDB, (int32_t)0x2D553AFC, (int32_t)0x77B417DF,
+    (int32_t)0x2C98FBBA, (int32_t)0x77FAB989, (int32_t)0x2BDC4E6F, (int32_t)0x78403329,
+    (int32_t)0x2B1F34EB, (int32_t)0x78848414, (int32_t)0x2A61B101, (int32_t)0x78C7ABA2,
+    (int32_t)0x29A3C485, (int32_t)0x7909A92D, (int32_t)0x28E5714B, (int32_t)0x794A7C12,
+    (int32_t)0x2826B928, (int32_t)0x798A23B1, (int32_t)0x27679DF4, (int32_t)0x79C89F6E,
+    (int32_t)0x26A82186, (int32_t)0x7A05EEAD, (int32_t)0x25E845B6, (int32_t)0x7A4210D8,
+    (int32_t)0x25280C5E, (int32_t)0x7A7D055B, (int32_t)0x24677758, (int32_t)0x7AB6CBA4,
+    (int32_t)0x23A6887F, (int32_t)0x7AEF6323, (int32_t)0x22E541AF, (int32_t)0x7B26CB4F,
+    (int32_t)0x2223A4C5, (int32_t)0x7B5D039E, (int32_t)0x2161B3A0, (int32_t)0x7B920B89,
+    (int32_t)0x209F701C, (int32_t)0x7BC5E290, (int32_t)0x1FDCDC1B, (int32_t)0x7BF88830,
+    (int32_t)0x1F19F97B, (int32_t)0x7C29FBEE, (int32_t)0x1E56CA1E, (int32_t)0x7C5A3D50,
+    (int32_t)0x1D934FE5, (int32_t)0x7C894BDE, (int32_t)0x1CCF8CB3, (int32_t)0x7CB72724,
+    (int32_t)0x1C0B826A, (int32_t)0x7CE3CEB2, (int32_t)0x1B4732EF, (int32_t)0x7D0F4218,
+    (int32_t)0x1A82A026, (int32_t)0x7D3980EC, (int32_t)0x19BDCBF3, (int32_t)0x7D628AC6,
+    (int32_t)0x18F8B83C, (int32_t)0x7D8A5F40, (int32_t)0x183366E9, (int32_t)0x7DB0FDF8,
+    (int32_t)0x176DD9DE, (int32_t)0x7DD6668F, (int32_t)0x16A81305, (int32_t)0x7DFA98A8,
+    (int32_t)0x15E21445, (int32_t)0x7E1D93EA, (int32_t)0x151BDF86, (int32_t)0x7E3F57FF,
+    (int32_t)0x145576B1, (int32_t)0x7E5FE493, (int32_t)0x138EDBB1, (int32_t)0x7E7F3957,
+    (int32_t)0x12C8106F, (int32_t)0x7E9D55FC, (int32_t)0x120116D5, (int32_t)0x7EBA3A39,
+    (int32_t)0x1139F0CF, (int32_t)0x7ED5E5C6, (int32_t)0x1072A048, (int32_t)0x7EF05860,
+    (int32_t)0x0FAB272B, (int32_t)0x7F0991C4, (int32_t)0x0EE38766, (int32_t)0x7F2191B4,
+    (int32_t)0x0E1BC2E4, (int32_t)0x7F3857F6, (int32_t)0x0D53DB92, (int32_t)0x7F4DE451,
+    (int32_t)0x0C8BD35E, (int32_t)0x7F62368F, (int32_t)0x0BC3AC35, (int32_t)0x7F754E80,
+    (int32_t)0x0AFB6805, (int32_t)0x7F872BF3, (int32_t)0x0A3308BD, (int32_t)0x7F97CEBD,
+    (int32_t)0x096A9049, (int32_t)0x7FA736B4, (int32_t)0x08A2009A, (int32_t)0x7FB563B3,
+    (int32_t)0x07D95B9E, (int32_t)0x7FC25596, (int32_t)0x0710A345, (int32_t)0x7FCE0C3E,
+    (int32_t)0x0647D97C, (int32_t)0x7FD8878E, (int32_t)0x057F0035, (int32_t)0x7FE1C76B,
+    (int32_t)0x04B6195D, (int32_t)0x7FE9CBC0, (int32_t)0x03ED26E6, (int32_t)0x7FF09478,
+    (int32_t)0x03242ABF, (int32_t)0x7FF62182, (int32_t)0x025B26D7, (int32_t)0x7FFA72D1,
+    (int32_t)0x01921D20, (int32_t)0x7FFD885A, (int32_t)0x00C90F88, (int32_t)0x7FFF6216
+};
+
+const int32_t twiddleCoef_dct_256_q32[1024] = {
+    (int32_t)0x7FFFFFFF, (int32_t)0x00000000, (int32_t)0x7FFFD886, (int32_t)0x006487E3,
+    (int32_t)0x7FFF6216, (int32_t)0x00C90F88, (int32_t)0x7FFE9CB2, (int32_t)0x012D96B1,
+    (int32_t)0x7FFD885A, (int32_t)0x01921D20, (int32_t)0x7FFC250F, (int32_t)0x01F6A297,
+    (int32_t)0x7FFA72D1, (int32_t)0x025B26D7, (int32_t)0x7FF871A2, (int32_t)0x02BFA9A4,
+    (int32_t)0x7FF62182, (int32_t)0x03242ABF, (int32_t)0x7FF38274, (int32_t)0x0388A9EA,
+    (int32_t)0x7FF09478, (int32_t)0x03ED26E6, (int32_t)0x7FED5791, (int32_t)0x0451A177,
+    (int32_t)0x7FE9CBC0, (int32_t)0x04B6195D, (int32_t)0x7FE5F108, (int32_t)0x051A8E5C,
+    (int32_t)0x7FE1C76B, (int32_t)0x057F0035, (int32_t)0x7FDD4EEC, (int32_t)0x05E36EA9,
+    (int32_t)0x7FD8878E, (int32_t)0x0647D97C, (int32_t)0x7FD37153, (int32_t)0x06AC406F,
+    (int32_t)0x7FCE0C3E, (int32_t)0x0710A345, (int32_t)0x7FC85854, (int32_t)0x077501BE,
+    (int32_t)0x7FC25596, (int32_t)0x07D95B9E, (int32_t)0x7FBC040A, (int32_t)0x083DB0A7,
+    (int32_t)0x7FB563B3, (int32_t)0x08A2009A, (int32_t)0x7FAE7495, (int32_t)0x09064B3A,
+    (int32_t)0x7FA736B4, (int32_t)0x096A9049, (int32_t)0x7F9FAA15, (int32_t)0x09CECF89,
+    (int32_t)0x7F97CEBD, (int32_t)0x0A3308BD, (int32_t)0x7F8FA4B0, (int32_t)0x0A973BA5,
+    (int32_t)0x7F872BF3, (int32_t)0x0AFB6805, (int32_t)0x7F7E648C, (int32_t)0x0B5F8D9F,
+    (int32_t)0x7F754E80, (int32_t)0x0BC3AC35, (int32_t)0x7F6BE9D4, (int32_t)0x0C27C389,
+    (int32_t)0x7F62368F, (int32_t)0x0C8BD35E, (int32_t)0x7F5834B7, (int32_t)0x0CEFDB76,
+    (int32_t)0x7F4DE451, (int32_t)0x0D53DB92, (int32_t)0x7F434563, (int32_t)0x0DB7D376,
+    (int32_t)0x7F3857F6, (int32_t)0x0E1BC2E4, (int32_t)0x7F2D1C0E, (int32_t)0x0E7FA99E,
+    (int32_t)0x7F2191B4, (int32_t)0x0EE38766, (int32_t)0x7F15B8EE, (int32_t)0x0F475BFF,
+    (int32_t)0x7F0991C4, (int32_t)0x0FAB272B, (int32_t)0x7EFD1C3C, (int32_t)0x100EE8AD,
+    (int32_t)0x7EF05860, (int32_t)0x1072A048, (int32_t)0x7EE34636, (int32_t)0x10D64DBD,
+    (int32_t)0x7ED5E5C6, (int32_t)0x1139F0CF, (int32_t)0x7EC8371A, (int32_t)0x119D8941,
+    (int32_t)0x7EBA3A39, (int32_t)0x120116D5, (int32_t)0x7EABEF2C, (int32_t)0x1264994E,
+    (int32_t)0x7E9D55FC, (int32_t)0x12C8106F, (int32_t)0x7E8E6EB2, (int32_t)0x132B7BF9,
+    (int32_t)0x7E7F3957, (int32_t)0x138EDBB1, (int32_t)0x7E6FB5F4, (int32_t)0x13F22F58,
+    (int32_t)0x7E5FE493, (int32_t)0x145576B1, (int32_t)0x7E4FC53E, (int32_t)0x14B8B17F,
+    (int32_t)0x7E3F57FF, (int32_t)0x151BDF86, (int32_t)0x7E2E9CDF, (int32_t)0x157F0086,
+    (int32_t)0x7E1D93EA, (int32_t)0x15E21445, (int32_t)0x7E0C3D29, (int32_t)0x16451A83,
+    (int32_t)0x7DFA98A8, (int32_t)0x16A81305, (int32_t)0x7DE8A670, (int32_t)0x170AFD8D,
+    (int32_t)0x7DD6668F, (int32_t)0x176DD9DE, (int32_t)0x7DC3D90D, (int32_t)0x17D0A7BC,
+    (int32_t)0x7DB0FDF8, (int32_t)0x183366E9, (int32_t)0x7D9DD55A, (int32_t)0x18961728,
+    (int32_t)0x7D8A5F40, (int32_t)0x18F8B83C, (int32_t)0x7D769BB5, (int32_t)0x195B49EA,
+    (int32_t)0x7D628AC6, (int32_t)0x19BDCBF3, (int32_t)0x7D4E2C7F, (int32_t)0x1A203E1B,
+    (int32_t)0x7D3980EC, (int32_t)0x1A82A026, (int32_t)0x7D24881B, (int32_t)0x1AE4F1D6,
+    (int32_t)0x7D0F4218, (int32_t)0x1B4732EF, (int32_t)0x7CF9AEF0, (int32_t)0x1BA96335,
+    (int32_t)0x7CE3CEB2, (int32_t)0x1C0B826A, (int32_t)0x7CCDA169, (int32_t)0x1C6D9053,
+    (int32_t)0x7CB72724, (int32_t)0x1CCF8CB3, (int32_t)0x7CA05FF1, (int32_t)0x1D31774D,
+    (int32_t)0x7C894BDE, (int32_t)0x1D934FE5, (int32_t)0x7C71EAF9, (int32_t)0x1DF5163F,
+    (int32_t)0x7C5A3D50, (int32_t)0x1E56CA1E, (int32_t)0x7C4242F2, (int32_t)0x1EB86B46,
+    (int32_t)0x7C29FBEE, (int32_t)0x1F19F97B, (int32_t)0x7C116853, (int32_t)0x1F7B7481,
+    (int32_t)0x7BF88830, (int32_t)0x1FDCDC1B, (int32_t)0x7BDF5B94, (int32_t)0x203E300D,
+    (int32_t)0x7BC5E290, (int32_t)0x209F701C, (int32_t)0x7BAC1D31, (int32_t)0x21009C0C,
+    (int32_t)0x7B920B89, (int32_t)0x2161B3A0, (int32_t)0x7B77ADA8, (int32_t)0x21C2B69C,
+    (int32_t)0x7B5D039E, (int32_t)0x2223A4C5, (int32_t)0x7B420D7A, (int32_t)0x22847DE0,
+    (int32_t)0x7B26CB4F, (int32_t)0x22E541AF, (int32_t)0x7B0B3D2C, (int32_t)0x2345EFF8,
+    (int32_t)0x7AEF6323, (int32_t)0x23A6887F, (int32_t)0x7AD33D45, (int32_t)0x24070B08,
+    (int32_t)0x7AB6CBA4, (int32_t)0x24677758, (int32_t)0x7A9A0E50, (int32_t)0x24C7CD33,
+    (int32_t)0x7A7D055B, (int32_t)0x25280C5E, (int32_t)0x7A5FB0D8, (int32_t)0x2588349D,
+    (int32_t)0x7A4210D8, (int32_t)0x25E845B6, (int32_t)0x7A24256F, (int32_t)0x26483F6C,
+    (int32_t)0x7A05EEAD, (int32_t)0x26A82186, (int32_t)0x79E76CA7, (int32_t)0x2707EBC7,
+    (int32_t)0x79C89F6E, (int32_t)0x27679DF4, (int32_t)0x79A98715, (int32_t)0x27C737D3,
+    (int32_t)0x798A23B1, (int32_t)0x2826B928, (int32_t)0x796A7554, (int32_t)0x288621B9,
+    (int32_t)0x794A7C12, (int32_t)0x28E5714B, (int32_t)0x792A37FE, (int32_t)0x2944A7A2,
+    (int32_t)0x7909A92D, (int32_t)0x29A3C485, (int32_t)0x78E8CFB2, (int32_t)0x2A02C7B8,
+    (int32_t)0x78C7ABA2, (int32_t)0x2A61B101, (int32_t)0x78A63D11, (int32_t)0x2AC08026,
+    (int32_t)0x78848414, (int32_t)0x2B1F34EB, (int32_t)0x786280BF, (int32_t)0x2B7DCF17,
+    (int32_t)0x78403329, (int32_t)0x2BDC4E6F, (int32_t)0x781D9B65, (int32_t)0x2C3AB2B9,
+    (int32_t)0x77FAB989, (int32_t)0x2C98FBBA, (int32_t)0x77D78DAA, (int32_t)0x2CF72939,
+    (int32_t)0x77B417DF, (int32_t)0x2D553AFC, (int32_t)0x7790583E, (int32_t)0x2DB330C7,
+    (int32_t)0x776C4EDB, (int32_t)0x2E110A62, (int32_t)0x7747FBCE, (int32_t)0x2E6EC792,
+    (int32_t)0x77235F2D, (int32_t)0x2ECC681E, (int32_t)0x76FE790E, (int32_t)0x2F29EBCC,
+    (int32_t)0x76D94989, (int32_t)0x2F875262, (int32_t)0x76B3D0B4, (int32_t)0x2FE49BA7,
+    (int32_t)0x768E0EA6, (int32_t)0x3041C761, (int32_t)0x76680376, (int32_t)0x309ED556,
+    (int32_t)0x7641AF3D, (int32_t)0x30FBC54D, (int32_t)0x761B1211, (int32_t)0x3158970E,
+    (int32_t)0x75F42C0B, (int32_t)0x31B54A5E, (int32_t)0x75CCFD42, (int32_t)0x3211DF04,
+    (int32_t)0x75A585CF, (int32_t)0x326E54C7, (int32_t)0x757DC5CA, (int32_t)0x32CAAB6F,
+    (int32_t)0x7555BD4C, (int32_t)0x3326E2C3, (int32_t)0x752D6C6C, (int32_t)0x3382FA88,
+    (int32_t)0x7504D345, (int32_t)0x33DEF287, (int32_t)0x74DBF1EF, (int32_t)0x343ACA87,
+    (int32_t)0x74B2C884, (int32_t)0x34968250, (int32_t)0x7489571C, (int32_t)0x34F219A8,
+    (int32_t)0x745F9DD1, (int32_t)0x354D9057, (int32_t)0x74359CBD, (int32_t)0x35A8E625,
+    (int32_t)0x740B53FB, (int32_t)0x36041AD9, (int32_t)0x73E0C3A3, (int32_t)0x365F2E3B,
+    (int32_t)0x73B5EBD1, (int32_t)0x36BA2014, (int32_t)0x738ACC9E, (int32_t)0x3714F02A,
+    (int32_t)0x735F6626, (int32_t)0x376F9E46, (int32_t)0x7333B883, (int32_t)0x37CA2A30,
+    (int32_t)0x7307C3D0, (int32_t)0x382493B0, (int32_t)0x72DB8828, (int32_t)0x387EDA8E,
+    (int32_t)0x72AF05A7, (int32_t)0x38D8FE93, (int32_t)0x72823C67, (int32_t)0x3932FF87,
+    (int32_t)0x72552C85, (int32_t)0x398CDD32, (int32_t)0x7227D61C, (int32_t)0x39E6975E,
+    (int32_t)0x71FA3949, (int32_t)0x3A402DD2, (int32_t)0x71CC5626, (int32_t)0x3A99A057,
+    (int32_t)0x719E2CD2, (int32_t)0x3AF2EEB7, (int32_t)0x716FBD68, (int32_t)0x3B4C18BA,
+    (int32_t)0x71410805, (int32_t)0x3BA51E29, (int32_t)0x71120CC5, (int32_t)0x3BFDFECD,
+    (int32_t)0x70E2CBC6, (int32_t)0x3C56BA70, (int32_t)0x70B34525, (int32_t)0x3CAF50DA,
+    (int32_t)0x708378FF, (int32_t)0x3D07C1D6, (int32_t)0x70536771, (int32_t)0x3D600D2C,
+    (int32_t)0x7023109A, (int32_t)0x3DB832A6, (int32_t)0x6FF27497, (int32_t)0x3E10320D,
+    (int32_t)0x6FC19385, (int32_t)0x3E680B2C, (int32_t)0x6F906D84, (int32_t)0x3EBFBDCD,
+    (int32_t)0x6F5F02B2, (int32_t)0x3F1749B8, (int32_t)0x6F2D532C, (int32_t)0x3F6EAEB8,
+    (int32_t)0x6EFB5F12, (int32_t)0x3FC5EC98, (int32_t)0x6EC92683, (int32_t)0x401D0321,
+    (int32_t)0x6E96A99D, (int32_t)0x4073F21D, (int32_t)0x6E63E87F, (int32_t)0x40CAB958,
+    (int32_t)0x6E30E34A, (int32_t)0x4121589B, (int32_t)0x6DFD9A1C, (int32_t)0x4177CFB1,
+    (int32_t)0x6DCA0D14, (int32_t)0x41CE1E65, (int32_t)0x6D963C54, (int32_t)0x42244481,
+    (int32_t)0x6D6227FA, (int32_t)0x427A41D0, (int32_t)0x6D2DD027, (int32_t)0x42D0161E,
+    (int32_t)0x6CF934FC, (int32_t)0x4325C135, (int32_t)0x6CC45698, (int32_t)0x437B42E1,
+    (int32_t)0x6C8F351C, (int32_t)0x43D09AED, (int32_t)0x6C59D0A9, (int32_t)0x4425C923,
+    (int32_t)0x6C242960, (int32_t)0x447ACD50, (int32_t)0x6BEE3F62, (int32_t)0x44CFA740,
+    (int32_t)0x6BB812D1, (int32_t)0x452456BD, (int32_t)0x6B81A3CD, (int32_t)0x4578DB93,
+    (int32_t)0x6B4AF279, (int32_t)0x45CD358F, (int32_t)0x6B13FEF5, (int32_t)0x4621647D,
+    (int32_t)0x6ADCC964, (int32_t)0x46756828, (int32_t)0x6AA551E9, (int32_t)0x46C9405C,
+    (int32_t)0x6A6D98A4, (int32_t)0x471CECE7, (int32_t)0x6A359DB9, (int32_t)0x47706D93,
+    (int32_t)0x69FD614A, (int32_t)0x47C3C22F, (int32_t)0x69C4E37A, (int32_t)0x4816EA86,
+    (int32_t)0x698C246C, (int32_t)0x4869E665, (int32_t)0x69532442, (int32_t)0x48BCB599,
+    (int32_t)0x6919E320, (int32_t)0x490F57EE, (int32_t)0x68E06129, (int32_t)0x4961CD33,
+    (int32_t)0x68A69E81, (int32_t)0x49B41533, (int32_t)0x686C9B4B, (int32_t)0x4A062FBD,
+    (int32_t)0x683257AB, (int32_t)0x4A581C9E, (int32_t)0x67F7D3C5, (int32_t)0x4AA9DBA2,
+    (int32_t)0x67BD0FBD, (int32_t)0x4AFB6C98, (int32_t)0x67820BB7, (int32_t)0x4B4CCF4D,
+    (int32_t)0x6746C7D8, (int32_t)0x4B9E0390, (int32_t)0x670B4444, (int32_t)0x4BEF092D,
+    (int32_t)0x66CF8120, (int32_t)0x4C3FDFF4, (int32_t)0x66937E91, (int32_t)0x4C9087B1,
+    (int32_t)0x66573CBB, (int32_t)0x4CE10034, (int32_t)0x661ABBC5, (int32_t)0x4D31494B,
+    (int32_t)0x65DDFBD3, (int32_t)0x4D8162C4, (int32_t)0x65A0FD0B, (int32_t)0x4DD14C6E,
+    (int32_t)0x6563BF92, (int32_t)0x4E210617, (int32_t)0x6526438F, (int32_t)0x4E708F8F,
+    (int32_t)0x64E88926, (int32_t)0x4EBFE8A5, (int32_t)0x64AA907F, (int32_t)0x4F0F1126,
+    (int32_t)0x646C59BF, (int32_t)0x4F5E08E3, (int32_t)0x642DE50D, (int32_t)0x4FACCFAB,
+    (int32_t)0x63EF3290, (int32_t)0x4FFB654D, (int32_t)0x63B0426D, (int32_t)0x5049C999,
+    (int32_t)0x637114CC, (int32_t)0x5097FC5E, (int32_t)0x6331A9D4, (int32_t)0x50E5FD6D,
+    (int32_t)0x62F201AC, (int32_t)0x5133CC94, (int32_t)0x62B21C7B, (int32_t)0x518169A5,
+    (int32_t)0x6271FA69, (int32_t)0x51CED46E, (int32_t)0x62319B9D, (int32_t)0x521C0CC2,
+    (int32_t)0x61F1003F, (int32_t)0x5269126E, (int32_t)0x61B02876, (int32_t)0x52B5E546,
+    (int32_t)0x616F146C, (int32_t)0x53028518, (int32_t)0x612DC447, (int32_t)0x534EF1B5,
+    (int32_t)0x60EC3830, (int32_t)0x539B2AF0, (int32_t)0x60AA7050, (int32_t)0x53E73097,
+    (int32_t)0x60686CCF, (int32_t)0x5433027D, (int32_t)0x60262DD6, (int32_t)0x547EA073,
+    (int32_t)0x5FE3B38D, (int32_t)0x54CA0A4B, (int32_t)0x5FA0FE1F, (int32_t)0x55153FD4,
+    (int32_t)0x5F5E0DB3, (int32_t)0x556040E2, (int32_t)0x5F1AE274, (int32_t)0x55AB0D46,
+    (int32_t)0x5ED77C8A, (int32_t)0x55F5A4D2, (int32_t)0x5E93DC1F, (int32_t)0x56400758,
+    (int32_t)0x5E50015D, (int32_t)0x568A34A9, (int32_t)0x5E0BEC6E, (int32_t)0x56D42C99,
+    (int32_t)0x5DC79D7C, (int32_t)0x571DEEFA, (int32_t)0x5D8314B1, (int32_t)0x57677B9D,
+    (int32_t)0x5D3E5237, (int32_t)0x57B0D256, (int32_t)0x5CF95638, (int32_t)0x57F9F2F8,
+    (int32_t)0x5CB420E0, (int32_t)0x5842DD54, (int32_t)0x5C6EB258, (int32_t)0x588B9140,
+    (int32_t)0x5C290ACC, (int32_t)0x58D40E8C, (int32_t)0x5BE32A67, (int32_t)0x591C550E,
+    (int32_t)0x5B9D1154, (int32_t)0x59646498, (int32_t)0x5B56BFBD, (int32_t)0x59AC3CFD,
+    (int32_t)0x5B1035CF, (int32_t)0x59F3DE12, (int32_t)0x5AC973B5, (int32_t)0x5A3B47AB,
+    (int32_t)0x5A82799A, (int32_t)0x5A82799A, (int32_t)0x5A3B47AB, (int32_t)0x5AC973B5,
+    (int32_t)0x59F3DE12, (int32_t)0x5B1035CF, (int32_t)0x59AC3CFD, (int32_t)0x5B56BFBD,
+    (int32_t)0x59646498, (int32_t)0x5B9D1154, (int32_t)0x591C550E, (int32_t)0x5BE32A67,
+    (int32_t)0x58D40E8C, (int32_t)0x5C290ACC, (int32_t)0x588B9140, (int32_t)0x5C6EB258,
+    (int32_t)0x5842DD54, (int32_t)0x5CB420E0, (int32_t)0x57F9F2F8, (int32_t)0x5CF95638,
+    (int32_t)0x57B0D256, (int32_t)0x5D3E5237, (int32_t)0x57677B9D, (int32_t)0x5D8314B1,
+    (int32_t)0x571DEEFA, (int32_t)0x5DC79D7C, (int32_t)0x56D42C99, (int32_t)0x5E0BEC6E,
+    (int32_t)0x568A34A9, (int32_t)0x5E50015D, (int32_t)0x56400758, (int32_t)0x5E93DC1F,
+    (int32_t)0x55F5A4D2, (int32_t)0x5ED77C8A, (int32_t)0x55AB0D46, (int32_t)0x5F1AE274,
+    (int32_t)0x556040E2, (int32_t)0x5F5E0DB3, (int32_t)0x55153FD4, (int32_t)0x5FA0FE1F,
+    (int32_t)0x54CA0A4B, (int32_t)0x5FE3B38D, (int32_t)0x547EA073, (int32_t)0x60262DD6,
+    (int32_t)0x5433027D, (int32_t)0x60686CCF, (int32_t)0x53E73097, (int32_t)0x60AA7050,
+    (int32_t)0x539B2AF0, (int32_t)0x60EC3830, (int32_t)0x534EF1B5, (int32_t)0x612DC447,
+    (int32_t)0x53028518, (int32_t)0x616F146C, (int32_t)0x52B5E546, (int32_t)0x61B02876,
+    (int32_t)0x5269126E, (int32_t)0x61F1003F, (int32_t)0x521C0CC2, (int32_t)0x62319B9D,
+    (int32_t)0x51CED46E, (int32_t)0x6271FA69, (int32_t)0x518169A5, (int32_t)0x62B21C7B,
+    (int32_t)0x5133CC94, (int32_t)0x62F201AC, (int32_t)0x50E5FD6D, (int32_t)0x6331A9D4,
+    (int32_t)0x5097FC5E, (int32_t)0x637114CC, (int32_t)0x5049C999, (int32_t)0x63B0426D,
+    (int32_t)0x4FFB654D, (int32_t)0x63EF3290, (int32_t)0x4FACCFAB, (int32_t)0x642DE50D,
+    (int32_t)0x4F5E08E3, (int32_t)0x646C59BF, (int32_t)0x4F0F1126, (int32_t)0x64AA907F,
+    (int32_t)0x4EBFE8A5, (int32_t)0x64E88926, (int32_t)0x4E708F8F, (int32_t)0x6526438F,
+    (int32_t)0x4E210617, (int32_t)0x6563BF92, (int32_t)0x4DD14C6E, (int32_t)0x65A0FD0B,
+    (int32_t)0x4D8162C4, (int32_t)0x65DDFBD3, (int32_t)0x4D31494B, (int32_t)0x661ABBC5,
+    (int32_t)0x4CE10034, (int32_t)0x66573CBB, (int32_t)0x4C9087B1, (int32_t)0x66937E91,
+    (int32_t)0x4C3FDFF4, (int32_t)0x66CF8120, (int32_t)0x4BEF092D, (int32_t)0x670B4444,
+    (int32_t)0x4B9E0390, (int32_t)0x6746C7D8, (int32_t)0x4B4CCF4D, (int32_t)0x67820BB7,
+    (int32_t)0x4AFB6C98, (int32_t)0x67BD0FBD, (int32_t)0x4AA9DBA2, (int32_t)0x67F7D3C5,
+    (int32_t)0x4A581C9E, (int32_t)0x683257AB, (int32_t)0x4A062FBD, (int32_t)0x686C9B4B,
+    (int32_t)0x49B41533, (int32_t)0x68A69E81, (int32_t)0x4961CD33, (int32_t)0x68E06129,
+    (int32_t)0x490F57EE, (int32_t)0x6919E320, (int32_t)0x48BCB599, (int32_t)0x69532442,
+    (int32_t)0x4869E665, (int32_t)0x698C246C, (int32_t)0x4816EA86, (int32_t)0x69C4E37A,
+    (int32_t)0x47C3C22F, (int32_t)0x69FD614A, (int32_t)0x47706D93, (int32_t)0x6A359DB9,
+    (int32_t)0x471CECE7, (int32_t)0x6A6D98A4, (int32_t)0x46C9405C, (int32_t)0x6AA551E9,
+    (int32_t)0x46756828, (int32_t)0x6ADCC964, (int32_t)0x4621647D, (int32_t)0x6B13FEF5,
+    (int32_t)0x45CD358F, (int32_t)0x6B4AF279, (int32_t)0x4578DB93, (int32_t)0x6B81A3CD,
+    (int32_t)0x452456BD, (int32_t)0x6BB812D1, (int32_t)0x44CFA740, (int32_t)0x6BEE3F62,
+    (int32_t)0x447ACD50, (int32_t)0x6C242960, (int32_t)0x4425C923, (int32_t)0x6C59D0A9,
+    (int32_t)0x43D09AED, (int32_t)0x6C8F351C, (int32_t)0x437B42E1, (int32_t)0x6CC45698,
+    (int32_t)0x4325C135, (int32_t)0x6CF934FC, (int32_t)0x42D0161E, (int32_t)0x6D2DD027,
+    (int32_t)0x427A41D0, (int32_t)0x6D6227FA, (int32_t)0x42244481, (int32_t)0x6D963C54,
+    (int32_t)0x41CE1E65, (int32_t)0x6DCA0D14, (int32_t)0x4177CFB1, (int32_t)0x6DFD9A1C,
+    (int32_t)0x4121589B, (int32_t)0x6E30E34A, (int32_t)0x40CAB958, (int32_t)0x6E63E87F,
+    (int32_t)0x4073F21D, (int32_t)0x6E96A99D, (int32_t)0x401D0321, (int32_t)0x6EC92683,
+    (int32_t)0x3FC5EC98, (int32_t)0x6EFB5F12, (int32_t)0x3F6EAEB8, (int32_t)0x6F2D532C,
+    (int32_t)0x3F1749B8, (int32_t)0x6F5F02B2, (int32_t)0x3EBFBDCD, (int32_t)0x6F906D84,
+    (int32_t)0x3E680B2C, (int32_t)0x6FC19385, (int32_t)0x3E10320D, (int32_t)0x6FF27497,
+    (int32_t)0x3DB832A6, (int32_t)0x7023109A, (int32_t)0x3D600D2C, (int32_t)0x70536771,
+    (int32_t)0x3D07C1D6, (int32_t)0x708378FF, (int32_t)0x3CAF50DA, (int32_t)0x70B34525,
+    (int32_t)0x3C56BA70, (int32_t)0x70E2CBC6, (int32_t)0x3BFDFECD, (int32_t)0x71120CC5,
+    (int32_t)0x3BA51E29, (int32_t)0x71410805, (int32_t)0x3B4C18BA, (int32_t)0x716FBD68,
+    (int32_t)0x3AF2EEB7, (int32_t)0x719E2CD2, (int32_t)0x3A99A057, (int32_t)0x71CC5626,
+    (int32_t)0x3A402DD2, (int32_t)0x71FA3949, (int32_t)0x39E6975E, (int32_t)0x7227D61C,
+    (int32_t)0x398CDD32, (int32_t)0x72552C85, (int32_t)0x3932FF87, (int32_t)0x72823C67,
+    (int32_t)0x38D8FE93, (int32_t)0x72AF05A7, (int32_t)0x387EDA8E, (int32_t)0x72DB8828,
+    (int32_t)0x382493B0, (int32_t)0x7307C3D0, (int32_t)0x37CA2A30, (int32_t)0x7333B883,
+    (int32_t)0x376F9E46, (int32_t)0x735F6626, (int32_t)0x3714F02A, (int32_t)0x738ACC9E,
+    (int32_t)0x36BA2014, (int32_t)0x73B5EBD1, (int32_t)0x365F2E3B, (int32_t)0x73E0C3A3,
+    (int32_t)0x36041AD9, (int32_t)0x740B53FB, (int32_t)0x35A8E625, (int32_t)0x74359CBD,
+    (int32_t)0x354D9057, (int32_t)0x745F9DD1, (int32_t)0x34F219A8, (int32_t)0x7489571C,
+    (int32_t)0x34968250, (int32_t)0x74B2C884, (int32_t)0x343ACA87, (int32_t)0x74DBF1EF,
+    (int32_t)0x33DEF287, (int32_t)0x7504D345, (int32_t)0x3382FA88, (int32_t)0x752D6C6C,
+    (int32_t)0x3326E2C3, (int32_t)0x7555BD4C, (int32_t)0x32CAAB6F, (int32_t)0x757DC5CA,
+    (int32_t)0x326E54C7, (int32_t)0x75A585CF, (int32_t)0x3211DF04, (int32_t)0x75CCFD42,
+    (int32_t)0x31B54A5E, (int32_t)0x75F42C0B, (int32_t)0x3158970E, (int32_t)0x761B1211,
+    (int32_t)0x30FBC54D, (int32_t)0x7641AF3D, (int32_t)0x309ED556, (int32_t)0x76680376,
+    (int32_t)0x3041C761, (int32_t)0x768E0EA6, (int32_t)0x2FE49BA7, (int32_t)0x76B3D0B4,
+    (int32_t)0x2F875262, (int32_t)0x76D94989, (int32_t)0x2F29EBCC, (int32_t)0x76FE790E,
+    (int32_t)0x2ECC681E, (int32_t)0x77235F2D, (int32_t)0x2E6EC792, (int32_t)0x7747FBCE,
+    (int32_t)0x2E110A62, (int32_t)0x776C4EDB, (int32_t)0x2DB330C7, (int32_t)0x7790583E,
+    (int32_t)0x2D553AFC, (int32_t)0x77B417DF, (int32_t)0x2CF72939, (int32_t)0x77D78DAA,
+    (int32_t)0x2C98FBBA, (int32_t)0x77FAB989, (int32_t)0x2C3AB2B9, (int32_t)0x781D9B65,
+    (int32_t)0x2BDC4E6F, (int32_t)0x78403329, (int32_t)0x2B7DCF17, (int32_t)0x786280BF,
+    (int32_t)0x2B1F34EB, (int32_t)0x78848414, (int32_t)0x2AC08026, (int32_t)0x78A63D11,
+    (int32_t)0x2A61B101, (int32_t)0x78C7ABA2, (int32_t)0x2A02C7B8, (int32_t)0x78E8CFB2,
+    (int32_t)0x29A3C485, (int32_t)0x7909A92D, (int32_t)0x2944A7A2, (int32_t)0x792A37FE,
+    (int32_t)0x28E5714B, (int32_t)0x794A7C12, (int32_t)0x288621B9, (int32_t)0x796A7554,
+    (int32_t)0x2826B928, (int32_t)0x798A23B1, (int32_t)0x27C737D3, (int32_t)0x79A98715,
+    (int32_t)0x27679DF4, (int32_t)0x79C89F6E, (int32_t)0x2707EBC7, (int32_t)0x79E76CA7,
+    (int32_t)0x26A82186, (int32_t)0x7A05EEAD, (int32_t)0x26483F6C, (int32_t)0x7A24256F,
+    (int32_t)0x25E845B6, (int32_t)0x7A4210D8, (int32_t)0x2588349D, (int32_t)0x7A5FB0D8,
+    (int32_t)0x25280C5E, (int32_t)0x7A7D055B, (int32_t)0x24C7CD33, (int32_t)0x7A9A0E50,
+    (int32_t)0x24677758, (int32_t)0x7AB6CBA4, (int32_t)0x24070B08, (int32_t)0x7AD33D45,
+    (int32_t)0x23A6887F, (int32_t)0x7AEF6323, (int32_t)0x2345EFF8, (int32_t)0x7B0B3D2C,
+    (int32_t)0x22E541AF, (int32_t)0x7B26CB4F, (int32_t)0x22847DE0, (int32_t)0x7B420D7A,
+    (int32_t)0x2223A4C5, (int32_t)0x7B5D039E, (int32_t)0x21C2B69C, (int32_t)0x7B77ADA8,
+    (int32_t)0x2161B3A0, (int32_t)0x7B920B89, (int32_t)0x21009C0C, (int32_t)0x7BAC1D31,
+    (int32_t)0x209F701C, (int32_t)0x7BC5E290, (int32_t)0x203E300D, (int32_t)0x7BDF5B94,
+    (int32_t)0x1FDCDC1B, (int32_t)0x7BF88830, (int32_t)0x1F7B7481, (int32_t)0x7C116853,
+    (int32_t)0x1F19F97B, (int32_t)0x7C29FBEE, (int32_t)0x1EB86B46, (int32_t)0x7C4242F2,
+    (int32_t)0x1E56CA1E, (int32_t)0x7C5A3D50, (int32_t)0x1DF5163F, (int32_t)0x7C71EAF9,
+    (int32_t)0x1D934FE5, (int32_t)0x7C894BDE, (int32_t)0x1D31774D, (int32_t)0x7CA05FF1,
+    (int32_t)0x1CCF8CB3, (int32_t)0x7CB72724, (int32_t)0x1C6D9053, (int32_t)0x7CCDA169,
+    (int32_t)0x1C0B826A, (int32_t)0x7CE3CEB2, (int32_t)0x1BA96335, (int32_t)0x7CF9AEF0,
+    (int32_t)0x1B4732EF, (int32_t)0x7D0F4218, (int32_t)0x1AE4F1D6, (int32_t)0x7D24881B,
+    (int32_t)0x1A82A026, (int32_t)0x7D3980EC, (int32_t)0x1A203E1B, (int32_t)0x7D4E2C7F,
+    (int32_t)0x19BDCBF3, (int32_t)0x7D628AC6, (int32_t)0x195B49EA, (int32_t)0x7D769BB5,
+    (int32_t)0x18F8B83C, (int32_t)0x7D8A5F40, (int32_t)0x18961728, (int32_t)0x7D9DD55A,
+    (int32_t)0x183366E9, (int32_t)0x7DB0FDF8, (int32_t)0x17D0A7BC, (int32_t)0x7DC3D90D,
+    (int32_t)0x176DD9DE, (int32_t)0x7DD6668F, (int32_t)0x170AFD8D, (int32_t)0x7DE8A670,
+    (int32_t)0x16A81305, (int32_t)0x7DFA98A8, (int32_t)0x16451A83, (int32_t)0x7E0C3D29,
+    (int32_t)0x15E21445, (int32_t)0x7E1D93EA, (int32_t)0x157F0086, (int32_t)0x7E2E9CDF,
+    (int32_t)0x151BDF86, (int32_t)0x7E3F57FF, (int32_t)0x14B8B17F, (int32_t)0x7E4FC53E,
+    (int32_t)0x145576B1, (int32_t)0x7E5FE493, (int32_t)0x13F22F58, (int32_t)0x7E6FB5F4,
+    (int32_t)0x138EDBB1, (int32_t)0x7E7F3957, (int32_t)0x132B7BF9, (int32_t)0x7E8E6EB2,
+    (int32_t)0x12C8106F, (int32_t)0x7E9D55FC, (int32_t)0x1264994E, (int32_t)0x7EABEF2C,
+    (int32_t)0x120116D5, (int32_t)0x7EBA3A39, (int32_t)0x119D8941, (int32_t)0x7EC8371A,
+    (int32_t)0x1139F0CF, (int32_t)0x7ED5E5C6, (int32_t)0x10D64DBD, (int32_t)0x7EE34636,
+    (int32_t)0x1072A048, (int32_t)0x7EF05860, (int32_t)0x100EE8AD, (int32_t)0x7EFD1C3C,
+    (int32_t)0x0FAB272B, (int32_t)0x7F0991C4, (int32_t)0x0F475BFF, (int32_t)0x7F15B8EE,
+    (int32_t)0x0EE38766, (int32_t)0x7F2191B4, (int32_t)0x0E7FA99E, (int32_t)0x7F2D1C0E,
+    (int32_t)0x0E1BC2E4, (int32_t)0x7F3857F6, (int32_t)0x0DB7D376, (int32_t)0x7F434563,
+    (int32_t)0x0D53DB92, (int32_t)0x7F4DE451, (int32_t)0x0CEFDB76, (int32_t)0x7F5834B7,
+    (int32_t)0x0C8BD35E, (int32_t)0x7F62368F, (int32_t)0x0C27C389, (int32_t)0x7F6BE9D4,
+    (int32_t)0x0BC3AC35, (int32_t)0x7F754E80, (int32_t)0x0B5F8D9F, (int32_t)0x7F7E648C,
+    (int32_t)0x0AFB6805, (int32_t)0x7F872BF3, (int32_t)0x0A973BA5, (int32_t)0x7F8FA4B0,
+    (int32_t)0x0A3308BD, (int32_t)0x7F97CEBD, (int32_t)0x09CECF89, (int32_t)0x7F9FAA15,
+    (int32_t)0x096A9049, (int32_t)0x7FA736B4, (int32_t)0x09064B3A, (int32_t)0x7FAE7495,
+    (int32_t)0x08A2009A, (int32_t)0x7FB563B3, (int32_t)0x083DB0A7, (int32_t)0x7FBC040A,
+    (int32_t)0x07D95B9E, (int32_t)0x7FC25596, (int32_t)0x077501BE, (int32_t)0x7FC85854,
+    (int32_t)0x0710A345, (int32_t)0x7FCE0C3E, (int32_t)0x06AC406F, (int32_t)0x7FD37153,
+    (int32_t)0x0647D97C, (int32_t)0x7FD8878E, (int32_t)0x05E36EA9, (int32_t)0x7FDD4EEC,
+    (int32_t)0x057F0035, (int32_t)0x7FE1C76B, (int32_t)0x051A8E5C, (int32_t)0x7FE5F108,
+    (int32_t)0x04B6195D, (int32_t)0x7FE9CBC0, (int32_t)0x0451A177, (int32_t)0x7FED5791,
+    (int32_t)0x03ED26E6, (int32_t)0x7FF09478, (int32_t)0x0388A9EA, (int32_t)0x7FF38274,
+    (int32_t)0x03242ABF, (int32_t)0x7FF62182, (int32_t)0x02BFA9A4, (int32_t)0x7FF871A2,
+    (int32_t)0x025B26D7, (int32_t)0x7FFA72D1, (int32_t)0x01F6A297, (int32_t)0x7FFC250F,
+    (int32_t)0x01921D20, (int32_t)0x7FFD885A, (int32_t)0x012D96B1, (int32_t)0x7FFE9CB2,
+    (int32_t)0x00C90F88, (int32_t)0x7FFF6216, (int32_t)0x006487E3, (int32_t)0x7FFFD886
+};
+
+const int32_t twiddleCoef_dct_512_q32[2048] = {
+    (int32_t)0x7FFFFFFF, (int32_t)0x00000000, (int32_t)0x7FFFF621, (int32_t)0x003243F5,
+    (int32_t)0x7FFFD886, (int32_t)0x006487E3, (int32_t)0x7FFFA72C, (int32_t)0x0096CBC1,
+    (int32_t)0x7FFF6216, (int32_t)0x00C90F88, (int32_t)0x7FFF0943, (int32_t)0x00FB5330,
+    (int32_t)0x7FFE9CB2, (int32_t)0x012D96B1, (int32_t)0x7FFE1C65, (int32_t)0x015FDA03,
+    (int32_t)0x7FFD885A, (int32_t)0x01921D20, (int32_t)0x7FFCE093, (int32_t)0x01C45FFE,
+    (int32_t)0x7FFC250F, (int32_t)0x01F6A297, (int32_t)0x7FFB55CE, (int32_t)0x0228E4E2,
+    (int32_t)0x7FFA72D1, (int32_t)0x025B26D7, (int32_t)0x7FF97C18, (int32_t)0x028D6870,
+    (int32_t)0x7FF871A2, (int32_t)0x02BFA9A4, (int32_t)0x7FF75370, (int32_t)0x02F1EA6C,
+    (int32_t)0x7FF62182, (int32_t)0x03242ABF, (int32_t)0x7FF4DBD9, (int32_t)0x03566A96,
+    (int32_t)0x7FF38274, (int32_t)0x0388A9EA, (int32_t)0x7FF21553, (int32_t)0x03BAE8B2,
+    (int32_t)0x7FF09478, (int32_t)0x03ED26E6, (int32_t)0x7FEEFFE1, (int32_t)0x041F6480,
+    (int32_t)0x7FED5791, (int32_t)0x0451A177, (int32_t)0x7FEB9B85, (int32_t)0x0483DDC3,
+    (int32_t)0x7FE9CBC0, (int32_t)0x04B6195D, (int32_t)0x7FE7E841, (int32_t)0x04E8543E,
+    (int32_t)0x7FE5F108, (int32_t)0x051A8E5C, (int32_t)0x7FE3E616, (int32_t)0x054CC7B1,
+    (int32_t)0x7FE1C76B, (int32_t)0x057F0035, (int32_t)0x7FDF9508, (int32_t)0x05B137DF,
+    (int32_t)0x7FDD4EEC, (int32_t)0x05E36EA9, (int32_t)0x7FDAF519, (int32_t)0x0615A48B,
+    (int32_t)0x7FD8878E, (int32_t)0x0647D97C, (int32_t)0x7FD6064C, (int32_t)0x067A0D76,
+    (int32_t)0x7FD37153, (int32_t)0x06AC406F, (int32_t)0x7FD0C8A3, (int32_t)0x06DE7262,
+    (int32_t)0x7FCE0C3E, (int32_t)0x0710A345, (int32_t)0x7FCB3C23, (int32_t)0x0742D311,
+    (int32_t)0x7FC85854, (int32_t)0x077501BE, (int32_t)0x7FC560CF, (int32_t)0x07A72F45,
+    (int32_t)0x7FC25596, (int32_t)0x07D95B9E, (int32_t)0x7FBF36AA, (int32_t)0x080B86C2,
+    (int32_t)0x7FBC040A, (int32_t)0x083DB0A7, (int32_t)0x7FB8BDB8, (int32_t)0x086FD947,
+    (int32_t)0x7FB563B3, (int32_t)0x08A2009A, (int32_t)0x7FB1F5FC, (int32_t)0x08D42699,
+    (int32_t)0x7FAE7495, (int32_t)0x09064B3A, (int32_t)0x7FAADF7C, (int32_t)0x09386E78,
+    (int32_t)0x7FA736B4, (int32_t)0x096A9049, (int32_t)0x7FA37A3C, (int32_t)0x099CB0A7,
+    (int32_t)0x7F9FAA15, (int32_t)0x09CECF89, (int32_t)0x7F9BC640, (int32_t)0x0A00ECE8,
+    (int32_t)0x7F97CEBD, (int32_t)0x0A3308BD, (int32_t)0x7F93C38C, (int32_t)0x0A6522FE,
+    (int32_t)0x7F8FA4B0, (int32_t)0x0A973BA5, (int32_t)0x7F8B7227, (int32_t)0x0AC952AA,
+    (int32_t)0x7F872BF3, (int32_t)0x0AFB6805, (int32_t)0x7F82D214, (int32_t)0x0B2D7BAF,
+    (int32_t)0x7F7E648C, (int32_t)0x0B5F8D9F, (int32_t)0x7F79E35A, (int32_t)0x0B919DCF,
+    (int32_t)0x7F754E80, (int32_t)0x0BC3AC35, (int32_t)0x7F70A5FE, (int32_t)0x0BF5B8CB,
+    (int32_t)0x7F6BE9D4, (int32_t)0x0C27C389, (int32_t)0x7F671A05, (int32_t)0x0C59CC68,
+    (int32_t)0x7F62368F, (int32_t)0x0C8BD35E, (int32_t)0x7F5D3F75, (int32_t)0x0CBDD865,
+    (int32_t)0x7F5834B7, (int32_t)0x0CEFDB76, (int32_t)0x7F531655, (int32_t)0x0D21DC87,
+    (int32_t)0x7F4DE451, (int32_t)0x0D53DB92, (int32_t)0x7F489EAA, (int32_t)0x0D85D88F,
+    (int32_t)0x7F434563, (int32_t)0x0DB7D376, (int32_t)0x7F3DD87C, (int32_t)0x0DE9CC40,
+    (int32_t)0x7F3857F6, (int32_t)0x0E1BC2E4, (int32_t)0x7F32C3D1, (int32_t)0x0E4DB75B,
+    (int32_t)0x7F2D1C0E, (int32_t)0x0E7FA99E, (int32_t)0x7F2760AF, (int32_t)0x0EB199A4,
+    (int32_t)0x7F2191B4, (int32_t)0x0EE38766, (int32_t)0x7F1BAF1E, (int32_t)0x0F1572DC,
+    (int32_t)0x7F15B8EE, (int32_t)0x0F475BFF, (int32_t)0x7F0FAF25, (int32_t)0x0F7942C7,
+    (int32_t)0x7F0991C4, (int32_t)0x0FAB272B, (int32_t)0x7F0360CB, (int32_t)0x0FDD0926,
+    (int32_t)0x7EFD1C3C, (int32_t)0x100EE8AD, (int32_t)0x7EF6C418, (int32_t)0x1040C5BB,
+    (int32_t)0x7EF05860, (int32_t)0x1072A048, (int32_t)0x7EE9D914, (int32_t)0x10A4784B,
+    (int32_t)0x7EE34636, (int32_t)0x10D64DBD, (int32_t)0x7EDC9FC6, (int32_t)0x11082096,
+    (int32_t)0x7ED5E5C6, (int32_t)0x1139F0CF, (int32_t)0x7ECF1837, (int32_t)0x116BBE60,
+    (int32_t)0x7EC8371A, (int32_t)0x119D8941, (int32_t)0x7EC14270, (int32_t)0x11CF516A,
+    (int32_t)0x7EBA3A39, (int32_t)0x120116D5, (int32_t)0x7EB31E78, (int32_t)0x1232D979,
+    (int32_t)0x7EABEF2C, (int32_t)0x1264994E, (int32_t)0x7EA4AC58, (int32_t)0x1296564D,
+    (int32_t)0x7E9D55FC, (int32_t)0x12C8106F, (int32_t)0x7E95EC1A, (int32_t)0x12F9C7AA,
+    (int32_t)0x7E8E6EB2, (int32_t)0x132B7BF9, (int32_t)0x7E86DDC6, (int32_t)0x135D2D53,
+    (int32_t)0x7E7F3957, (int32_t)0x138EDBB1, (int32_t)0x7E778166, (int32_t)0x13C0870A,
+    (int32_t)0x7E6FB5F4, (int32_t)0x13F22F58, (int32_t)0x7E67D703, (int32_t)0x1423D492,
+    (int32_t)0x7E5FE493, (int32_t)0x145576B1, (int32_t)0x7E57DEA7, (int32_t)0x148715AE,
+    (int32_t)0x7E4FC53E, (int32_t)0x14B8B17F, (int32_t)0x7E47985B, (int32_t)0x14EA4A1F,
+    (int32_t)0x7E3F57FF, (int32_t)0x151BDF86, (int32_t)0x7E37042A, (int32_t)0x154D71AA,
+    (int32_t)0x7E2E9CDF, (int32_t)0x157F0086, (int32_t)0x7E26221F, (int32_t)0x15B08C12,
+    (int32_t)0x7E1D93EA, (int32_t)0x15E21445, (int32_t)0x7E14F242, (int32_t)0x16139918,
+    (int32_t)0x7E0C3D29, (int32_t)0x16451A83, (int32_t)0x7E0374A0, (int32_t)0x1676987F,
+    (int32_t)0x7DFA98A8, (int32_t)0x16A81305, (int32_t)0x7DF1A942, (int32_t)0x16D98A0C,
+    (int32_t)0x7DE8A670, (int32_t)0x170AFD8D, (int32_t)0x7DDF9034, (int32_t)0x173C6D80,
+    (int32_t)0x7DD6668F, (int32_t)0x176DD9DE, (int32_t)0x7DCD2981, (int32_t)0x179F429F,
+    (int32_t)0x7DC3D90D, (int32_t)0x17D0A7BC, (int32_t)0x7DBA7534, (int32_t)0x1802092C,
+    (int32_t)0x7DB0FDF8, (int32_t)0x183366E9, (int32_t)0x7DA77359, (int32_t)0x1864C0EA,
+    (int32_t)0x7D9DD55A, (int32_t)0x18961728, (int32_t)0x7D9423FC, (int32_t)0x18C7699B,
+    (int32_t)0x7D8A5F40, (int32_t)0x18F8B83C, (int32_t)0x7D808728, (int32_t)0x192A0304,
+    (int32_t)0x7D769BB5, (int32_t)0x195B49EA, (int32_t)0x7D6C9CE9, (int32_t)0x198C8CE7,
+    (int32_t)0x7D628AC6, (int32_t)0x19BDCBF3, (int32_t)0x7D58654D, (int32_t)0x19EF0707,
+    (int32_t)0x7D4E2C7F, (int32_t)0x1A203E1B, (int32_t)0x7D43E05E, (int32_t)0x1A517128,
+    (int32_t)0x7D3980EC, (int32_t)0x1A82A026, (int32_t)0x7D2F0E2B, (int32_t)0x1AB3CB0D,
+    (int32_t)0x7D24881B, (int32_t)0x1AE4F1D6, (int32_t)0x7D19EEBF, (int32_t)0x1B161479,
+    (int32_t)0x7D0F4218, (int32_t)0x1B4732EF, (int32_t)0x7D048228, (int32_t)0x1B784D30,
+    (int32_t)0x7CF9AEF0, (int32_t)0x1BA96335, (int32_t)0x7CEEC873, (int32_t)0x1BDA74F6,
+    (int32_t)0x7CE3CEB2, (int32_t)0x1C0B826A, (int32_t)0x7CD8C1AE, (int32_t)0x1C3C8B8C,
+    (int32_t)0x7CCDA169, (int32_t)0x1C6D9053, (int32_t)0x7CC26DE5, (int32_t)0x1C9E90B8,
+    (int32_t)0x7CB72724, (int32_t)0x1CCF8CB3, (int32_t)0x7CABCD28, (int32_t)0x1D00843D,
+    (int32_t)0x7CA05FF1, (int32_t)0x1D31774D, (int32_t)0x7C94DF83, (int32_t)0x1D6265DD,
+    (int32_t)0x7C894BDE, (int32_t)0x1D934FE5, (int32_t)0x7C7DA505, (int32_t)0x1DC4355E,
+    (int32_t)0x7C71EAF9, (int32_t)0x1DF5163F, (int32_t)0x7C661DBC, (int32_t)0x1E25F282,
+    (int32_t)0x7C5A3D50, (int32_t)0x1E56CA1E, (int32_t)0x7C4E49B7, (int32_t)0x1E879D0D,
+    (int32_t)0x7C4242F2, (int32_t)0x1EB86B46, (int32_t)0x7C362904, (int32_t)0x1EE934C3,
+    (int32_t)0x7C29FBEE, (int32_t)0x1F19F97B, (int32_t)0x7C1DBBB3, (int32_t)0x1F4AB968,
+    (int32_t)0x7C116853, (int32_t)0x1F7B7481, (int32_t)0x7C0501D2, (int32_t)0x1FAC2ABF,
+    (int32_t)0x7BF88830, (int32_t)0x1FDCDC1B, (int32_t)0x7BEBFB70, (int32_t)0x200D888D,
+    (int32_t)0x7BDF5B94, (int32_t)0x203E300D, (int32_t)0x7BD2A89E, (int32_t)0x206ED295,
+    (int32_t)0x7BC5E290, (int32_t)0x209F701C, (int32_t)0x7BB9096B, (int32_t)0x20D0089C,
+    (int32_t)0x7BAC1D31, (int32_t)0x21009C0C, (int32_t)0x7B9F1DE6, (int32_t)0x21312A65,
+    (int32_t)0x7B920B89, (int32_t)0x2161B3A0, (int32_t)0x7B84E61F, (int32_t)0x219237B5,
+    (int32_t)0x7B77ADA8, (int32_t)0x21C2B69C, (int32_t)0x7B6A6227, (int32_t)0x21F3304F,
+    (int32_t)0x7B5D039E, (int32_t)0x2223A4C5, (int32_t)0x7B4F920E, (int32_t)0x225413F8,
+    (int32_t)0x7B420D7A, (int32_t)0x22847DE0, (int32_t)0x7B3475E5, (int32_t)0x22B4E274,
+    (int32_t)0x7B26CB4F, (int32_t)0x22E541AF, (int32_t)0x7B190DBC, (int32_t)0x23159B88,
+    (int32_t)0x7B0B3D2C, (int32_t)0x2345EFF8, (int32_t)0x7AFD59A4, (int32_t)0x23763EF7,
+    (int32_t)0x7AEF6323, (int32_t)0x23A6887F, (int32_t)0x7AE159AE, (int32_t)0x23D6CC87,
+    (int32_t)0x7AD33D45, (int32_t)0x24070B08, (int32_t)0x7AC50DEC, (int32_t)0x243743FA,
+    (int32_t)0x7AB6CBA4, (int32_t)0x24677758, (int32_t)0x7AA8766F, (int32_t)0x2497A517,
+    (int32_t)0x7A9A0E50, (int32_t)0x24C7CD33, (int32_t)0x7A8B9348, (int32_t)0x24F7EFA2,
+    (int32_t)0x7A7D055B, (int32_t)0x25280C5E, (int32_t)0x7A6E648A, (int32_t)0x2558235F,
+    (int32_t)0x7A5FB0D8, (int32_t)0x2588349D, (int32_t)0x7A50EA47, (int32_t)0x25B84012,
+    (int32_t)0x7A4210D8, (int32_t)0x25E845B6, (int32_t)0x7A332490, (int32_t)0x26184581,
+    (int32_t)0x7A24256F, (int32_t)0x26483F6C, (int32_t)0x7A151378, (int32_t)0x26783370,
+    (int32_t)0x7A05EEAD, (int32_t)0x26A82186, (int32_t)0x79F6B711, (int32_t)0x26D809A5,
+    (int32_t)0x79E76CA7, (int32_t)0x2707EBC7, (int32_t)0x79D80F6F, (int32_t)0x2737C7E3,
+    (int32_t)0x79C89F6E, (int32_t)0x27679DF4, (int32_t)0x79B91CA4, (int32_t)0x27976DF1,
+    (int32_t)0x79A98715, (int32_t)0x27C737D3, (int32_t)0x7999DEC4, (int32_t)0x27F6FB92,
+    (int32_t)0x798A23B1, (int32_t)0x2826B928, (int32_t)0x797A55E0, (int32_t)0x2856708D,
+    (int32_t)0x796A7554, (int32_t)0x288621B9, (int32_t)0x795A820E, (int32_t)0x28B5CCA5,
+    (int32_t)0x794A7C12, (int32_t)0x28E5714B, (int32_t)0x793A6361, (int32_t)0x29150FA1,
+    (int32_t)0x792A37FE, (int32_t)0x2944A7A2, (int32_t)0x7919F9EC, (int32_t)0x29743946,
+    (int32_t)0x7909A92D, (int32_t)0x29A3C485, (int32_t)0x78F945C3, (int32_t)0x29D34958,
+    (int32_t)0x78E8CFB2, (int32_t)0x2A02C7B8, (int32_t)0x78D846FB, (int32_t)0x2A323F9E,
+    (int32_t)0x78C7ABA2, (int32_t)0x2A61B101, (int32_t)0x78B6FDA8, (int32_t)0x2A911BDC,
+    (int32_t)0x78A63D11, (int32_t)0x2AC08026, (int32_t)0x789569DF, (int32_t)0x2AEFDDD8,
+    (int32_t)0x78848414, (int32_t)0x2B1F34EB, (int32_t)0x78738BB3, (int32_t)0x2B4E8558,
+    (int32_t)0x786280BF, (int32_t)0x2B7DCF17, (int32_t)0x7851633B, (int32_t)0x2BAD1221,
+    (int32_t)0x78403329, (int32_t)0x2BDC4E6F, (int32_t)0x782EF08B, (int32_t)0x2C0B83FA,
+    (int32_t)0x781D9B65, (int32_t)0x2C3AB2B9, (int32_t)0x780C33B8, (int32_t)0x2C69DAA6,
+    (int32_t)0x77FAB989, (int32_t)0x2C98FBBA, (int32_t)0x77E92CD9, (int32_t)0x2CC815EE,
+    (int32_t)0x77D78DAA, (int32_t)0x2CF72939, (int32_t)0x77C5DC01, (int32_t)0x2D263596,
+    (int32_t)0x77B417DF, (int32_t)0x2D553AFC, (int32_t)0x77A24148, (int32_t)0x2D843964,
+    (int32_t)0x7790583E, (int32_t)0x2DB330C7, (int32_t)0x777E5CC3, (int32_t)0x2DE2211E,
+    (int32_t)0x776C4EDB, (int32_t)0x2E110A62, (int32_t)0x775A2E89, (int32_t)0x2E3FEC8B,
+    (int32_t)0x7747FBCE, (int32_t)0x2E6EC792, (int32_t)0x7735B6AF, (int32_t)0x2E9D9B70,
+    (int32_t)0x77235F2D, (int32_t)0x2ECC681E, (int32_t)0x7710F54C, (int32_t)0x2EFB2D95,
+    (int32_t)0x76FE790E, (int32_t)0x2F29EBCC, (int32_t)0x76EBEA77, (int32_t)0x2F58A2BE,
+    (int32_t)0x76D94989, (int32_t)0x2F875262, (int32_t)0x76C69647, (int32_t)0x2FB5FAB2,
+    (int32_t)0x76B3D0B4, (int32_t)0x2FE49BA7, (int32_t)0x76A0F8D2, (int32_t)0x30133539,
+    (int32_t)0x768E0EA6, (int32_t)0x3041C761, (int32_t)0x767B1231, (int32_t)0x30705217,
+    (int32_t)0x76680376, (int32_t)0x309ED556, (int32_t)0x7654E279, (int32_t)0x30CD5115,
+    (int32_t)0x7641AF3D, (int32_t)0x30FBC54D, (int32_t)0x762E69C4, (int32_t)0x312A31F8,
+    (int32_t)0x761B1211, (int32_t)0x3158970E, (int32_t)0x7607A828, (int32_t)0x3186F487,
+    (int32_t)0x75F42C0B, (int32_t)0x31B54A5E, (int32_t)0x75E09DBD, (int32_t)0x31E39889,
+    (int32_t)0x75CCFD42, (int32_t)0x3211DF04, (int32_t)0x75B94A9C, (int32_t)0x32401DC6,
+    (int32_t)0x75A585CF, (int32_t)0x326E54C7, (int32_t)0x7591AEDD, (int32_t)0x329C8402,
+    (int32_t)0x757DC5CA, (int32_t)0x32CAAB6F, (int32_t)0x7569CA99, (int32_t)0x32F8CB07,
+    (int32_t)0x7555BD4C, (int32_t)0x3326E2C3, (int32_t)0x75419DE7, (int32_t)0x3354F29B,
+    (int32_t)0x752D6C6C, (int32_t)0x3382FA88, (int32_t)0x751928E0, (int32_t)0x33B0FA84,
+    (int32_t)0x7504D345, (int32_t)0x33DEF287, (int32_t)0x74F06B9E, (int32_t)0x340CE28B,
+    (int32_t)0x74DBF1EF, (int32_t)0x343ACA87, (int32_t)0x74C7663A, (int32_t)0x3468AA76,
+    (int32_t)0x74B2C884, (int32_t)0x34968250, (int32_t)0x749E18CD, (int32_t)0x34C4520D,
+    (int32_t)0x7489571C, (int32_t)0x34F219A8, (int32_t)0x74748371, (int32_t)0x351FD918,
+    (int32_t)0x745F9DD1, (int32_t)0x354D9057, (int32_t)0x744AA63F, (int32_t)0x357B3F5D,
+    (int32_t)0x74359CBD, (int32_t)0x35A8E625, (int32_t)0x74208150, (int32_t)0x35D684A6,
+    (int32_t)0x740B53FB, (int32_t)0x36041AD9, (int32_t)0x73F614C0, (int32_t)0x3631A8B8,
+    (int32_t)0x73E0C3A3, (int32_t)0x365F2E3B, (int32_t)0x73CB60A8, (int32_t)0x368CAB5C,
+    (int32_t)0x73B5EBD1, (int32_t)0x36BA2014, (int32_t)0x73A06522, (int32_t)0x36E78C5B,
+    (int32_t)0x738ACC9E, (int32_t)0x3714F02A, (int32_t)0x73752249, (int32_t)0x37424B7B,
+    (int32_t)0x735F6626, (int32_t)0x376F9E46, (int32_t)0x73499838, (int32_t)0x379CE885,
+    (int32_t)0x7333B883, (int32_t)0x37CA2A30, (int32_t)0x731DC70A, (int32_t)0x37F76341,
+    (int32_t)0x7307C3D0, (int32_t)0x382493B0, (int32_t)0x72F1AED9, (int32_t)0x3851BB77,
+    (int32_t)0x72DB8828, (int32_t)0x387EDA8E, (int32_t)0x72C54FC1, (int32_t)0x38ABF0EF,
+    (int32_t)0x72AF05A7, (int32_t)0x38D8FE93, (int32_t)0x7298A9DD, (int32_t)0x39060373,
+    (int32_t)0x72823C67, (int32_t)0x3932FF87, (int32_t)0x726BBD48, (int32_t)0x395FF2C9,
+    (int32_t)0x72552C85, (int32_t)0x398CDD32, (int32_t)0x723E8A20, (int32_t)0x39B9BEBC,
+    (int32_t)0x7227D61C, (int32_t)0x39E6975E, (int32_t)0x7211107E, (int32_t)0x3A136712,
+    (int32_t)0x71FA3949, (int32_t)0x3A402DD2, (int32_t)0x71E35080, (int32_t)0x3A6CEB96,
+    (int32_t)0x71CC5626, (int32_t)0x3A99A057, (int32_t)0x71B54A41, (int32_t)0x3AC64C0F,
+    (int32_t)0x719E2CD2, (int32_t)0x3AF2EEB7, (int32_t)0x7186FDDE, (int32_t)0x3B1F8848,
+    (int32_t)0x716FBD68, (int32_t)0x3B4C18BA, (int32_t)0x71586B74, (int32_t)0x3B78A007,
+    (int32_t)0x71410805, (int32_t)0x3BA51E29, (int32_t)0x7129931F, (int32_t)0x3BD19318,
+    (int32_t)0x71120CC5, (int32_t)0x3BFDFECD, (int32_t)0x70FA74FC, (int32_t)0x3C2A6142,
+    (int32_t)0x70E2CBC6, (int32_t)0x3C56BA70, (int32_t)0x70CB1128, (int32_t)0x3C830A50,
+    (int32_t)0x70B34525, (int32_t)0x3CAF50DA, (int32_t)0x709B67C0, (int32_t)0x3CDB8E09,
+    (int32_t)0x708378FF, (int32_t)0x3D07C1D6, (int32_t)0x706B78E3, (int32_t)0x3D33EC39,
+    (int32_t)0x70536771, (int32_t)0x3D600D2C, (int32_t)0x703B44AD, (int32_t)0x3D8C24A8,
+    (int32_t)0x7023109A, (int32_t)0x3DB832A6, (int32_t)0x700ACB3C, (int32_t)0x3DE4371F,
+    (int32_t)0x6FF27497, (int32_t)0x3E10320D, (int32_t)0x6FDA0CAE, (int32_t)0x3E3C2369,
+    (int32_t)0x6FC19385, (int32_t)0x3E680B2C, (int32_t)0x6FA90921, (int32_t)0x3E93E950,
+    (int32_t)0x6F906D84, (int32_t)0x3EBFBDCD, (int32_t)0x6F77C0B3, (int32_t)0x3EEB889C,
+    (int32_t)0x6F5F02B2, (int32_t)0x3F1749B8, (int32_t)0x6F463383, (int32_t)0x3F430119,
+    (int32_t)0x6F2D532C, (int32_t)0x3F6EAEB8, (int32_t)0x6F1461B0, (int32_t)0x3F9A5290,
+    (int32_t)0x6EFB5F12, (int32_t)0x3FC5EC98, (int32_t)0x6EE24B57, (int32_t)0x3FF17CCA,
+    (int32_t)0x6EC92683, (int32_t)0x401D0321, (int32_t)0x6EAFF099, (int32_t)0x40487F94,
+    (int32_t)0x6E96A99D, (int32_t)0x4073F21D, (int32_t)0x6E7D5193, (int32_t)0x409F5AB6,
+    (int32_t)0x6E63E87F, (int32_t)0x40CAB958, (int32_t)0x6E4A6E66, (int32_t)0x40F60DFB,
+    (int32_t)0x6E30E34A, (int32_t)0x4121589B, (int32_t)0x6E174730, (int32_t)0x414C992F,
+    (int32_t)0x6DFD9A1C, (int32_t)0x4177CFB1, (int32_t)0x6DE3DC11, (int32_t)0x41A2FC1A,
+    (int32_t)0x6DCA0D14, (int32_t)0x41CE1E65, (int32_t)0x6DB02D29, (int32_t)0x41F93689,
+    (int32_t)0x6D963C54, (int32_t)0x42244481, (int32_t)0x6D7C3A98, (int32_t)0x424F4845,
+    (int32_t)0x6D6227FA, (int32_t)0x427A41D0, (int32_t)0x6D48047E, (int32_t)0x42A5311B,
+    (int32_t)0x6D2DD027, (int32_t)0x42D0161E, (int32_t)0x6D138AFB, (int32_t)0x42FAF0D4,
+    (int32_t)0x6CF934FC, (int32_t)0x4325C135, (int32_t)0x6CDECE2F, (int32_t)0x4350873C,
+    (int32_t)0x6CC45698, (int32_t)0x437B42E1, (int32_t)0x6CA9CE3B, (int32_t)0x43A5F41E,
+    (int32_t)0x6C8F351C, (int32_t)0x43D09AED, (int32_t)0x6C748B3F, (int32_t)0x43FB3746,
+    (int32_t)0x6C59D0A9, (int32_t)0x4425C923, (int32_t)0x6C3F055D, (int32_t)0x4450507E,
+    (int32_t)0x6C242960, (int32_t)0x447ACD50, (int32_t)0x6C093CB6, (int32_t)0x44A53F93,
+    (int32_t)0x6BEE3F62, (int32_t)0x44CFA740, (int32_t)0x6BD3316A, (int32_t)0x44FA0450,
+    (int32_t)0x6BB812D1, (int32_t)0x452456BD, (int32_t)0x6B9CE39B, (int32_t)0x454E9E80,
+    (int32_t)0x6B81A3CD, (int32_t)0x4578DB93, (int32_t)0x6B66536B, (int32_t)0x45A30DF0,
+    (int32_t)0x6B4AF279, (int32_t)0x45CD358F, (int32_t)0x6B2F80FB, (int32_t)0x45F7526B,
+    (int32_t)0x6B13FEF5, (int32_t)0x4621647D, (int32_t)0x6AF86C6C, (int32_t)0x464B6BBE,
+    (int32_t)0x6ADCC964, (int32_t)0x46756828, (int32_t)0x6AC115E2, (int32_t)0x469F59B4,
+    (int32_t)0x6AA551E9, (int32_t)0x46C9405C, (int32_t)0x6A897D7D, (int32_t)0x46F31C1A,
+    (int32_t)0x6A6D98A4, (int32_t)0x471CECE7, (int32_t)0x6A51A361, (int32_t)0x4746B2BC,
+    (int32_t)0x6A359DB9, (int32_t)0x47706D93, (int32_t)0x6A1987B0, (int32_t)0x479A1D67,
+    (int32_t)0x69FD614A, (int32_t)0x47C3C22F, (int32_t)0x69E12A8C, (int32_t)0x47ED5BE6,
+    (int32_t)0x69C4E37A, (int32_t)0x4816EA86, (int32_t)0x69A88C19, (int32_t)0x48406E08,
+    (int32_t)0x698C246C, (int32_t)0x4869E665, (int32_t)0x696FAC78, (int32_t)0x48935397,
+    (int32_t)0x69532442, (int32_t)0x48BCB599, (int32_t)0x69368BCE, (int32_t)0x48E60C62,
+    (int32_t)0x6919E320, (int32_t)0x490F57EE, (int32_t)0x68FD2A3D, (int32_t)0x49389836,
+    (int32_t)0x68E06129, (int32_t)0x4961CD33, (int32_t)0x68C387E9, (int32_t)0x498AF6DF,
+    (int32_t)0x68A69E81, (int32_t)0x49B41533, (int32_t)0x6889A4F6, (int32_t)0x49DD282A,
+    (int32_t)0x686C9B4B, (int32_t)0x4A062FBD, (int32_t)0x684F8186, (int32_t)0x4A2F2BE6,
+    (int32_t)0x683257AB, (int32_t)0x4A581C9E, (int32_t)0x68151DBE, (int32_t)0x4A8101DE,
+    (int32_t)0x67F7D3C5, (int32_t)0x4AA9DBA2, (int32_t)0x67DA79C3, (int32_t)0x4AD2A9E2,
+    (int32_t)0x67BD0FBD, (int32_t)0x4AFB6C98, (int32_t)0x679F95B7, (int32_t)0x4B2423BE,
+    (int32_t)0x67820BB7, (int32_t)0x4B4CCF4D, (int32_t)0x676471C0, (int32_t)0x4B756F40,
+    (int32_t)0x6746C7D8, (int32_t)0x4B9E0390, (int32_t)0x67290E02, (int32_t)0x4BC68C36,
+    (int32_t)0x670B4444, (int32_t)0x4BEF092D, (int32_t)0x66ED6AA1, (int32_t)0x4C177A6E,
+    (int32_t)0x66CF8120, (int32_t)0x4C3FDFF4, (int32_t)0x66B187C3, (int32_t)0x4C6839B7,
+    (int32_t)0x66937E91, (int32_t)0x4C9087B1, (int32_t)0x6675658C, (int32_t)0x4CB8C9DD,
+    (int32_t)0x66573CBB, (int32_t)0x4CE10034, (int32_t)0x66390422, (int32_t)0x4D092AB0,
+    (int32_t)0x661ABBC5, (int32_t)0x4D31494B, (int32_t)0x65FC63A9, (int32_t)0x4D595BFE,
+    (int32_t)0x65DDFBD3, (int32_t)0x4D8162C4, (int32_t)0x65BF8447, (int32_t)0x4DA95D96,
+    (int32_t)0x65A0FD0B, (int32_t)0x4DD14C6E, (int32_t)0x65826622, (int32_t)0x4DF92F46,
+    (int32_t)0x6563BF92, (int32_t)0x4E210617, (int32_t)0x6545095F, (int32_t)0x4E48D0DD,
+    (int32_t)0x6526438F, (int32_t)0x4E708F8F, (int32_t)0x65076E25, (int32_t)0x4E984229,
+    (int32_t)0x64E88926, (int32_t)0x4EBFE8A5, (int32_t)0x64C99498, (int32_t)0x4EE782FB,
+    (int32_t)0x64AA907F, (int32_t)0x4F0F1126, (int32_t)0x648B7CE0, (int32_t)0x4F369320,
+    (int32_t)0x646C59BF, (int32_t)0x4F5E08E3, (int32_t)0x644D2722, (int32_t)0x4F857269,
+    (int32_t)0x642DE50D, (int32_t)0x4FACCFAB, (int32_t)0x640E9386, (int32_t)0x4FD420A4,
+    (int32_t)0x63EF3290, (int32_t)0x4FFB654D, (int32_t)0x63CFC231, (int32_t)0x50229DA1,
+    (int32_t)0x63B0426D, (int32_t)0x5049C999, (int32_t)0x6390B34A, (int32_t)0x5070E92F,
+    (int32_t)0x637114CC, (int32_t)0x5097FC5E, (int32_t)0x635166F9, (int32_t)0x50BF031F,
+    (int32_t)0x6331A9D4, (int32_t)0x50E5FD6D, (int32_t)0x6311DD64, (int32_t)0x510CEB40,
+    (int32_t)0x62F201AC, (int32_t)0x5133CC94, (int32_t)0x62D216B3, (int32_t)0x515AA162,
+    (int32_t)0x62B21C7B, (int32_t)0x518169A5, (int32_t)0x6292130C, (int32_t)0x51A82555,
+    (int32_t)0x6271FA69, (int32_t)0x51CED46E, (int32_t)0x6251D298, (int32_t)0x51F576EA,
+    (int32_t)0x62319B9D, (int32_t)0x521C0CC2, (int32_t)0x6211557E, (int32_t)0x524295F0,
+    (int32_t)0x61F1003F, (int32_t)0x5269126E, (int32_t)0x61D09BE5, (int32_t)0x528F8238,
+    (int32_t)0x61B02876, (int32_t)0x52B5E546, (int32_t)0x618FA5F7, (int32_t)0x52DC3B92,
+    (int32_t)0x616F146C, (int32_t)0x53028518, (int32_t)0x614E73DA, (int32_t)0x5328C1D0,
+    (int32_t)0x612DC447, (int32_t)0x534EF1B5, (int32_t)0x610D05B7, (int32_t)0x537514C2,
+    (int32_t)0x60EC3830, (int32_t)0x539B2AF0, (int32_t)0x60CB5BB7, (int32_t)0x53C13439,
+    (int32_t)0x60AA7050, (int32_t)0x53E73097, (int32_t)0x60897601, (int32_t)0x540D2005,
+    (int32_t)0x60686CCF, (int32_t)0x5433027D, (int32_t)0x604754BF, (int32_t)0x5458D7F9,
+    (int32_t)0x60262DD6, (int32_t)0x547EA073, (int32_t)0x6004F819, (int32_t)0x54A45BE6,
+    (int32_t)0x5FE3B38D, (int32_t)0x54CA0A4B, (int32_t)0x5FC26038, (int32_t)0x54EFAB9C,
+    (int32_t)0x5FA0FE1F, (int32_t)0x55153FD4, (int32_t)0x5F7F8D46, (int32_t)0x553AC6EE,
+    (int32_t)0x5F5E0DB3, (int32_t)0x556040E2, (int32_t)0x5F3C7F6B, (int32_t)0x5585ADAD,
+    (int32_t)0x5F1AE274, (int32_t)0x55AB0D46, (int32_t)0x5EF936D1, (int32_t)0x55D05FAA,
+    (int32_t)0x5ED77C8A, (int32_t)0x55F5A4D2, (int32_t)0x5EB5B3A2, (int32_t)0x561ADCB9,
+    (int32_t)0x5E93DC1F, (int32_t)0x56400758, (int32_t)0x5E71F606, (int32_t)0x566524AA,
+    (int32_t)0x5E50015D, (int32_t)0x568A34A9, (int32_t)0x5E2DFE29, (int32_t)0x56AF3750,
+    (int32_t)0x5E0BEC6E, (int32_t)0x56D42C99, (int32_t)0x5DE9CC33, (int32_t)0x56F9147E,
+    (int32_t)0x5DC79D7C, (int32_t)0x571DEEFA, (int32_t)0x5DA5604F, (int32_t)0x5742BC06,
+    (int32_t)0x5D8314B1, (int32_t)0x57677B9D, (int32_t)0x5D60BAA7, (int32_t)0x578C2DBA,
+    (int32_t)0x5D3E5237, (int32_t)0x57B0D256, (int32_t)0x5D1BDB65, (int32_t)0x57D5696D,
+    (int32_t)0x5CF95638, (int32_t)0x57F9F2F8, (int32_t)0x5CD6C2B5, (int32_t)0x581E6EF1,
+    (int32_t)0x5CB420E0, (int32_t)0x5842DD54, (int32_t)0x5C9170BF, (int32_t)0x58673E1B,
+    (int32_t)0x5C6EB258, (int32_t)0x588B9140, (int32_t)0x5C4BE5B0, (int32_t)0x58AFD6BD,
+    (int32_t)0x5C290ACC, (int32_t)0x58D40E8C, (int32_t)0x5C0621B2, (int32_t)0x58F838A9,
+    (int32_t)0x5BE32A67, (int32_t)0x591C550E, (int32_t)0x5BC024F0, (int32_t)0x594063B5,
+    (int32_t)0x5B9D1154, (int32_t)0x59646498, (int32_t)0x5B79EF96, (int32_t)0x598857B2,
+    (int32_t)0x5B56BFBD, (int32_t)0x59AC3CFD, (int32_t)0x5B3381CE, (int32_t)0x59D01475,
+    (int32_t)0x5B1035CF, (int32_t)0x59F3DE12, (int32_t)0x5AECDBC5, (int32_t)0x5A1799D1,
+    (int32_t)0x5AC973B5, (int32_t)0x5A3B47AB, (int32_t)0x5AA5FDA5, (int32_t)0x5A5EE79A,
+    (int32_t)0x5A82799A, (int32_t)0x5A82799A, (int32_t)0x5A5EE79A, (int32_t)0x5AA5FDA5,
+    (int32_t)0x5A3B47AB, (int32_t)0x5AC973B5, (int32_t)0x5A1799D1, (int32_t)0x5AECDBC5,
+    (int32_t)0x59F3DE12, (int32_t)0x5B1035CF, (int32_t)0x59D01475, (int32_t)0x5B3381CE,
+    (int32_t)0x59AC3CFD, (int32_t)0x5B56BFBD, (int32_t)0x598857B2, (int32_t)0x5B79EF96,
+    (int32_t)0x59646498, (int32_t)0x5B9D1154, (int32_t)0x594063B5, (int32_t)0x5BC024F0,
+    (int32_t)0x591C550E, (int32_t)0x5BE32A67, (int32_t)0x58F838A9, (int32_t)0x5C0621B2,
+    (int32_t)0x58D40E8C, (int32_t)0x5C290ACC, (int32_t)0x58AFD6BD, (int32_t)0x5C4BE5B0,
+    (int32_t)0x588B9140, (int32_t)0x5C6EB258, (int32_t)0x58673E1B, (int32_t)0x5C9170BF,
+    (int32_t)0x5842DD54, (int32_t)0x5CB420E0, (int32_t)0x581E6EF1, (int32_t)0x5CD6C2B5,
+    (int32_t)0x57F9F2F8, (int32_t)0x5CF95638, (int32_t)0x57D5696D, (int32_t)0x5D1BDB65,
+    (int32_t)0x57B0D256, (int32_t)0x5D3E5237, (int32_t)0x578C2DBA, (int32_t)0x5D60BAA7,
+    (int32_t)0x57677B9D, (int32_t)0x5D8314B1, (int32_t)0x5742BC06, (int32_t)0x5DA5604F,
+    (int32_t)0x571DEEFA, (int32_t)0x5DC79D7C, (int32_t)0x56F9147E, (int32_t)0x5DE9CC33,
+    (int32_t)0x56D42C99, (int32_t)0x5E0BEC6E, (int32_t)0x56AF3750, (int32_t)0x5E2DFE29,
+    (int32_t)0x568A34A9, (int32_t)0x5E50015D, (int32_t)0x566524AA, (int32_t)0x5E71F606,
+    (int32_t)0x56400758, (int32_t)0x5E93DC1F, (int32_t)0x561ADCB9, (int32_t)0x5EB5B3A2,
+    (int32_t)0x55F5A4D2, (int32_t)0x5ED77C8A, (int32_t)0x55D05FAA, (int32_t)0x5EF936D1,
+    (int32_t)0x55AB0D46, (int32_t)0x5F1AE274, (int32_t)0x5585ADAD, (int32_t)0x5F3C7F6B,
+    (int32_t)0x556040E2, (int32_t)0x5F5E0DB3, (int32_t)0x553AC6EE, (int32_t)0x5F7F8D46,
+    (int32_t)0x55153FD4, (int32_t)0x5FA0FE1F, (int32_t)0x54EFAB9C, (int32_t)0x5FC26038,
+    (int32_t)0x54CA0A4B, (int32_t)0x5FE3B38D, (int32_t)0x54A45BE6, (int32_t)0x6004F819,
+    (int32_t)0x547EA073, (int32_t)0x60262DD6, (int32_t)0x5458D7F9, (int32_t)0x604754BF,
+    (int32_t)0x5433027D, (int32_t)0x60686CCF, (int32_t)0x540D2005, (int32_t)0x60897601,
+    (int32_t)0x53E73097, (int32_t)0x60AA7050, (int32_t)0x53C13439, (int32_t)0x60CB5BB7,
+    (int32_t)0x539B2AF0, (int32_t)0x60EC3830, (int32_t)0x537514C2, (int32_t)0x610D05B7,
+    (int32_t)0x534EF1B5, (int32_t)0x612DC447, (int32_t)0x5328C1D0, (int32_t)0x614E73DA,
+    (int32_t)0x53028518, (int32_t)0x616F146C, (int32_t)0x52DC3B92, (int32_t)0x618FA5F7,
+    (int32_t)0x52B5E546, (int32_t)0x61B02876, (int32_t)0x528F8238, (int32_t)0x61D09BE5,
+    (int32_t)0x5269126E, (int32_t)0x61F1003F, (int32_t)0x524295F0, (int32_t)0x6211557E,
+    (int32_t)0x521C0CC2, (int32_t)0x62319B9D, (int32_t)0x51F576EA, (int32_t)0x6251D298,
+    (int32_t)0x51CED46E, (int32_t)0x6271FA69, (int32_t)0x51A82555, (int32_t)0x6292130C,
+    (int32_t)0x518169A5, (int32_t)0x62B21C7B, (int32_t)0x515AA162, (int32_t)0x62D216B3,
+    (int32_t)0x5133CC94, (int32_t)0x62F201AC, (int32_t)0x510CEB40, (int32_t)0x6311DD64,
+    (int32_t)0x50E5FD6D, (int32_t)0x6331A9D4, (int32_t)0x50BF031F, (int32_t)0x635166F9,
+    (int32_t)0x5097FC5E, (int32_t)0x637114CC, (int32_t)0x5070E92F, (int32_t)0x6390B34A,
+    (int32_t)0x5049C999, (int32_t)0x63B0426D, (int32_t)0x50229DA1, (int32_t)0x63CFC231,
+    (int32_t)0x4FFB654D, (int32_t)0x63EF3290, (int32_t)0x4FD420A4, (int32_t)0x640E9386,
+    (int32_t)0x4FACCFAB, (int32_t)0x642DE50D, (int32_t)0x4F857269, (int32_t)0x644D2722,
+    (int32_t)0x4F5E08E3, (int32_t)0x646C59BF, (int32_t)0x4F369320, (int32_t)0x648B7CE0,
+    (int32_t)0x4F0F1126, (int32_t)0x64AA907F, (int32_t)0x4EE782FB, (int32_t)0x64C99498,
+    (int32_t)0x4EBFE8A5, (int32_t)0x64E88926, (int32_t)0x4E984229, (int32_t)0x65076E25,
+    (int32_t)0x4E708F8F, (int32_t)0x6526438F, (int32_t)0x4E48D0DD, (int32_t)0x6545095F,
+    (int32_t)0x4E210617, (int32_t)0x6563BF92, (int32_t)0x4DF92F46, (int32_t)0x65826622,
+    (int32_t)0x4DD14C6E, (int32_t)0x65A0FD0B, (int32_t)0x4DA95D96, (int32_t)0x65BF8447,
+    (int32_t)0x4D8162C4, (int32_t)0x65DDFBD3, (int32_t)0x4D595BFE, (int32_t)0x65FC63A9,
+    (int32_t)0x4D31494B, (int32_t)0x661ABBC5, (int32_t)0x4D092AB0, (int32_t)0x66390422,
+    (int32_t)0x4CE10034, (int32_t)0x66573CBB, (int32_t)0x4CB8C9DD, (int32_t)0x6675658C,
+    (int32_t)0x4C9087B1, (int32_t)0x66937E91, (int32_t)0x4C6839B7, (int32_t)0x66B187C3,
+    (int32_t)0x4C3FDFF4, (int32_t)0x66CF8120, (int32_t)0x4C177A6E, (int32_t)0x66ED6AA1,
+    (int32_t)0x4BEF092D, (int32_t)0x670B4444, (int32_t)0x4BC68C36, (int32_t)0x67290E02,
+    (int32_t)0x4B9E0390, (int32_t)0x6746C7D8, (int32_t)0x4B756F40, (int32_t)0x676471C0,
+    (int32_t)0x4B4CCF4D, (int32_t)0x67820BB7, (int32_t)0x4B2423BE, (int32_t)0x679F95B7,
+    (int32_t)0x4AFB6C98, (int32_t)0x67BD0FBD, (int32_t)0x4AD2A9E2, (int32_t)0x67DA79C3,
+    (int32_t)0x4AA9DBA2, (int32_t)0x67F7D3C5, (int32_t)0x4A8101DE, (int32_t)0x68151DBE,
+    (int32_t)0x4A581C9E, (int32_t)0x683257AB, (int32_t)0x4A2F2BE6, (int32_t)0x684F8186,
+    (int32_t)0x4A062FBD, (int32_t)0x686C9B4B, (int32_t)0x49DD282A, (int32_t)0x6889A4F6,
+    (int32_t)0x49B41533, (int32_t)0x68A69E81, (int32_t)0x498AF6DF, (int32_t)0x68C387E9,
+    (int32_t)0x4961CD33, (int32_t)0x68E06129, (int32_t)0x49389836, (int32_t)0x68FD2A3D,
+    (int32_t)0x490F57EE, (int32_t)0x6919E320, (int32_t)0x48E60C62, (int32_t)0x69368BCE,
+    (int32_t)0x48BCB599, (int32_t)0x69532442, (int32_t)0x48935397, (int32_t)0x696FAC78,
+    (int32_t)0x4869E665, (int32_t)0x698C246C, (int32_t)0x48406E08, (int32_t)0x69A88C19,
+    (int32_t)0x4816EA86, (int32_t)0x69C4E37A, (int32_t)0x47ED5BE6, (int32_t)0x69E12A8C,
+    (int32_t)0x47C3C22F, (int32_t)0x69FD614A, (int32_t)0x479A1D67, (int32_t)0x6A1987B0,
+    (int32_t)0x47706D93, (int32_t)0x6A359DB9, (int32_t)0x4746B2BC, (int32_t)0x6A51A361,
+    (int32_t)0x471CECE7, (int32_t)0x6A6D98A4, (int32_t)0x46F31C1A, (int32_t)0x6A897D7D,
+    (int32_t)0x46C9405C, (int32_t)0x6AA551E9, (int32_t)0x469F59B4, (int32_t)0x6AC115E2,
+    (int32_t)0x46756828, (int32_t)0x6ADCC964, (int32_t)0x464B6BBE, (int32_t)0x6AF86C6C,
+    (int32_t)0x4621647D, (int32_t)0x6B13FEF5, (int32_t)0x45F7526B, (int32_t)0x6B2F80FB,
+    (int32_t)0x45CD358F, (int32_t)0x6B4AF279, (int32_t)0x45A30DF0, (int32_t)0x6B66536B,
+    (int32_t)0x4578DB93, (int32_t)0x6B81A3CD, (int32_t)0x454E9E80, (int32_t)0x6B9CE39B,
+    (int32_t)0x452456BD, (int32_t)0x6BB812D1, (int32_t)0x44FA0450, (int32_t)0x6BD3316A,
+    (int32_t)0x44CFA740, (int32_t)0x6BEE3F62, (int32_t)0x44A53F93, (int32_t)0x6C093CB6,
+    (int32_t)0x447ACD50, (int32_t)0x6C242960, (int32_t)0x4450507E, (int32_t)0x6C3F055D,
+    (int32_t)0x4425C923, (int32_t)0x6C59D0A9, (int32_t)0x43FB3746, (int32_t)0x6C748B3F,
+    (int32_t)0x43D09AED, (int32_t)0x6C8F351C, (int32_t)0x43A5F41E, (int32_t)0x6CA9CE3B,
+    (int32_t)0x437B42E1, (int32_t)0x6CC45698, (int32_t)0x4350873C, (int32_t)0x6CDECE2F,
+    (int32_t)0x4325C135, (int32_t)0x6CF934FC, (int32_t)0x42FAF0D4, (int32_t)0x6D138AFB,
+    (int32_t)0x42D0161E, (int32_t)0x6D2DD027, (int32_t)0x42A5311B, (int32_t)0x6D48047E,
+    (int32_t)0x427A41D0, (int32_t)0x6D6227FA, (int32_t)0x424F4845, (int32_t)0x6D7C3A98,
+    (int32_t)0x42244481, (int32_t)0x6D963C54, (int32_t)0x41F93689, (int32_t)0x6DB02D29,
+    (int32_t)0x41CE1E65, (int32_t)0x6DCA0D14, (int32_t)0x41A2FC1A, (int32_t)0x6DE3DC11,
+    (int32_t)0x4177CFB1, (int32_t)0x6DFD9A1C, (int32_t)0x414C992F, (int32_t)0x6E174730,
+    (int32_t)0x4121589B, (int32_t)0x6E30E34A, (int32_t)0x40F60DFB, (int32_t)0x6E4A6E66,
+    (int32_t)0x40CAB958, (int32_t)0x6E63E87F, (int32_t)0x409F5AB6, (int32_t)0x6E7D5193,
+    (int32_t)0x4073F21D, (int32_t)0x6E96A99D, (int32_t)0x40487F94, (int32_t)0x6EAFF099,
+    (int32_t)0x401D0321, (int32_t)0x6EC92683, (int32_t)0x3FF17CCA, (int32_t)0x6EE24B57,
+    (int32_t)0x3FC5EC98, (int32_t)0x6EFB5F12, (int32_t)0x3F9A5290, (int32_t)0x6F1461B0,
+    (int32_t)0x3F6EAEB8, (int32_t)0x6F2D532C, (int32_t)0x3F430119, (int32_t)0x6F463383,
+    (int32_t)0x3F1749B8, (int32_t)0x6F5F02B2, (int32_t)0x3EEB889C, (int32_t)0x6F77C0B3,
+    (int32_t)0x3EBFBDCD, (int32_t)0x6F906D84, (int32_t)0x3E93E950, (int32_t)0x6FA90921,
+    (int32_t)0x3E680B2C, (int32_t)0x6FC19385, (int32_t)0x3E3C2369, (int32_t)0x6FDA0CAE,
+    (int32_t)0x3E10320D, (int32_t)0x6FF27497, (int32_t)0x3DE4371F, (int32_t)0x700ACB3C,
+    (int32_t)0x3DB832A6, (int32_t)0x7023109A, (int32_t)0x3D8C24A8, (int32_t)0x703B44AD,
+    (int32_t)0x3D600D2C, (int32_t)0x70536771, (int32_t)0x3D33EC39, (int32_t)0x706B78E3,
+    (int32_t)0x3D07C1D6, (int32_t)0x708378FF, (int32_t)0x3CDB8E09, (int32_t)0x709B67C0,
+    (int32_t)0x3CAF50DA, (int32_t)0x70B34525, (int32_t)0x3C830A50, (int32_t)0x70CB1128,
+    (int32_t)0x3C56BA70, (int32_t)0x70E2CBC6, (int32_t)0x3C2A6142, (int32_t)0x70FA74FC,
+    (int32_t)0x3BFDFECD, (int32_t)0x71120CC5, (int32_t)0x3BD19318, (int32_t)0x7129931F,
+    (int32_t)0x3BA51E29, (int32_t)0x71410805, (int32_t)0x3B78A007, (int32_t)0x71586B74,
+    (int32_t)0x3B4C18BA, (int32_t)0x716FBD68, (int32_t)0x3B1F8848, (int32_t)0x7186FDDE,
+    (int32_t)0x3AF2EEB7, (int32_t)0x719E2CD2, (int32_t)0x3AC64C0F, (int32_t)0x71B54A41,
+    (int32_t)0x3A99A057, (int32_t)0x71CC5626, (int32_t)0x3A6CEB96, (int32_t)0x71E35080,
+    (int32_t)0x3A402DD2, (int32_t)0x71FA3949, (int32_t)0x3A136712, (int32_t)0x7211107E,
+    (int32_t)0x39E6975E, (int32_t)0x7227D61C, (int32_t)0x39B9BEBC, (int32_t)0x723E8A20,
+    (int32_t)0x398CDD32, (int32_t)0x72552C85, (int32_t)0x395FF2C9, (int32_t)0x726BBD48,
+    (int32_t)0x3932FF87, (int32_t)0x72823C67, (int32_t)0x39060373, (int32_t)0x7298A9DD,
+    (int32_t)0x38D8FE93, (int32_t)0x72AF05A7, (int32_t)0x38ABF0EF, (int32_t)0x72C54FC1,
+    (int32_t)0x387EDA8E, (int32_t)0x72DB8828, (int32_t)0x3851BB77, (int32_t)0x72F1AED9,
+    (int32_t)0x382493B0, (int32_t)0x7307C3D0, (int32_t)0x37F76341, (int32_t)0x731DC70A,
+    (int32_t)0x37CA2A30, (int32_t)0x7333B883, (int32_t)0x379CE885, (int32_t)0x73499838,
+    (int32_t)0x376F9E46, (int32_t)0x735F6626, (int32_t)0x37424B7B, (int32_t)0x73752249,
+    (int32_t)0x3714F02A, (int32_t)0x738ACC9E, (int32_t)0x36E78C5B, (int32_t)0x73A06522,
+    (int32_t)0x36BA2014, (int32_t)0x73B5EBD1, (int32_t)0x368CAB5C, (int32_t)0x73CB60A8,
+    (int32_t)0x365F2E3B, (int32_t)0x73E0C3A3, (int32_t)0x3631A8B8, (int32_t)0x73F614C0,
+    (int32_t)0x36041AD9, (int32_t)0x740B53FB, (int32_t)0x35D684A6, (int32_t)0x74208150,
+    (int32_t)0x35A8E625, (int32_t)0x74359CBD, (int32_t)0x357B3F5D, (int32_t)0x744AA63F,
+    (int32_t)0x354D9057, (int32_t)0x745F9DD1, (int32_t)0x351FD918, (int32_t)0x74748371,
+    (int32_t)0x34F219A8, (int32_t)0x7489571C, (int32_t)0x34C4520D, (int32_t)0x749E18CD,
+    (int32_t)0x34968250, (int32_t)0x74B2C884, (int32_t)0x3468AA76, (int32_t)0x74C7663A,
+    (int32_t)0x343ACA87, (int32_t)0x74DBF1EF, (int32_t)0x340CE28B, (int32_t)0x74F06B9E,
+    (int32_t)0x33DEF287, (int32_t)0x7504D345, (int32_t)0x33B0FA84, (int32_t)0x751928E0,
+    (int32_t)0x3382FA88, (int32_t)0x752D6C6C, (int32_t)0x3354F29B, (int32_t)0x75419DE7,
+    (int32_t)0x3326E2C3, (int32_t)0x7555BD4C, (int32_t)0x32F8CB07, (int32_t)0x7569CA99,
+    (int32_t)0x32CAAB6F, (int32_t)0x757DC5CA, (int32_t)0x329C8402, (int32_t)0x7591AEDD,
+    (int32_t)0x326E54C7, (int32_t)0x75A585CF, (int32_t)0x32401DC6, (int32_t)0x75B94A9C,
+    (int32_t)0x3211DF04, (int32_t)0x75CCFD42, (int32_t)0x31E39889, (int32_t)0x75E09DBD,
+    (int32_t)0x31B54A5E, (int32_t)0x75F42C0B, (int32_t)0x3186F487, (int32_t)0x7607A828,
+    (int32_t)0x3158970E, (int32_t)0x761B1211, (int32_t)0x312A31F8, (int32_t)0x762E69C4,
+    (int32_t)0x30FBC54D, (int32_t)0x7641AF3D, (int32_t)0x30CD5115, (int32_t)0x7654E279,
+    (int32_t)0x309ED556, (int32_t)0x76680376, (int32_t)0x30705217, (int32_t)0x767B1231,
+    (int32_t)0x3041C761, (int32_t)0x768E0EA6, (int32_t)0x30133539, (int32_t)0x76A0F8D2,
+    (int32_t)0x2FE49BA7, (int32_t)0x76B3D0B4, (int32_t)0x2FB5FAB2, (int32_t)0x76C69647,
+    (int32_t)0x2F875262, (int32_t)0x76D94989, (int32_t)0x2F58A2BE, (int32_t)0x76EBEA77,
+    (int32_t)0x2F29EBCC, (int32_t)0x76FE790E, (int32_t)0x2EFB2D95, (int32_t)0x7710F54C,
+    (int32_t)0x2ECC681E, (int32_t)0x77235F2D, (int32_t)0x2E9D9B70, (int32_t)0x7735B6AF,
+    (int32_t)0x2E6EC792, (int32_t)0x7747FBCE, (int32_t)0x2E3FEC8B, (int32_t)0x775A2E89,
+    (int32_t)0x2E110A62, (int32_t)0x776C4EDB, (int32_t)0x2DE2211E, (int32_t)0x777E5CC3,
+    (int32_t)0x2DB330C7, (int32_t)0x7790583E, (int32_t)0x2D843964, (int32_t)0x77A24148,
+    (int32_t)0x2D553AFC, (int32_t)0x77B417DF, (int32_t)0x2D263596, (int32_t)0x77C5DC01,
+    (int32_t)0x2CF72939, (int32_t)0x77D78DAA, (int32_t)0x2CC815EE, (int32_t)0x77E92CD9,
+    (int32_t)0x2C98FBBA, (int32_t)0x77FAB989, (int32_t)0x2C69DAA6, (int32_t)0x780C33B8,
+    (int32_t)0x2C3AB2B9, (int32_t)0x781D9B65, (int32_t)0x2C0B83FA, (int32_t)0x782EF08B,
+    (int32_t)0x2BDC4E6F, (int32_t)0x78403329, (int32_t)0x2BAD1221, (int32_t)0x7851633B,
+    (int32_t)0x2B7DCF17, (int32_t)0x786280BF, (int32_t)0x2B4E8558, (int32_t)0x78738BB3,
+    (int32_t)0x2B1F34EB, (int32_t)0x78848414, (int32_t)0x2AEFDDD8, (int32_t)0x789569DF,
+    (int32_t)0x2AC08026, (int32_t)0x78A63D11, (int32_t)0x2A911BDC, (int32_t)0x78B6FDA8,
+    (int32_t)0x2A61B101, (int32_t)0x78C7ABA2, (int32_t)0x2A323F9E, (int32_t)0x78D846FB,
+    (int32_t)0x2A02C7B8, (int32_t)0x78E8CFB2, (int32_t)0x29D34958, (int32_t)0x78F945C3,
+    (int32_t)0x29A3C485, (int32_t)0x7909A92D, (int32_t)0x29743946, (int32_t)0x7919F9EC,
+    (int32_t)0x2944A7A2, (int32_t)0x792A37FE, (int32_t)0x29150FA1, (int32_t)0x793A6361,
+    (int32_t)0x28E5714B, (int32_t)0x794A7C12, (int32_t)0x28B5CCA5, (int32_t)0x795A820E,
+    (int32_t)0x288621B9, (int32_t)0x796A7554, (int32_t)0x2856708D, (int32_t)0x797A55E0,
+    (int32_t)0x2826B928, (int32_t)0x798A23B1, (int32_t)0x27F6FB92, (int32_t)0x7999DEC4,
+    (int32_t)0x27C737D3, (int32_t)0x79A98715, (int32_t)0x27976DF1, (int32_t)0x79B91CA4,
+    (int32_t)0x27679DF4, (int32_t)0x79C89F6E, (int32_t)0x2737C7E3, (int32_t)0x79D80F6F,
+    (int32_t)0x2707EBC7, (int32_t)0x79E76CA7, (int32_t)0x26D809A5, (int32_t)0x79F6B711,
+    (int32_t)0x26A82186, (int32_t)0x7A05EEAD, (int32_t)0x26783370, (int32_t)0x7A151378,
+    (int32_t)0x26483F6C, (int32_t)0x7A24256F, (int32_t)0x26184581, (int32_t)0x7A332490,
+    (int32_t)0x25E845B6, (int32_t)0x7A4210D8, (int32_t)0x25B84012, (int32_t)0x7A50EA47,
+    (int32_t)0x2588349D, (int32_t)0x7A5FB0D8, (int32_t)0x2558235F, (int32_t)0x7A6E648A,
+    (int32_t)0x25280C5E, (int32_t)0x7A7D055B, (int32_t)0x24F7EFA2, (int32_t)0x7A8B9348,
+    (int32_t)0x24C7CD33, (int32_t)0x7A9A0E50, (int32_t)0x2497A517, (int32_t)0x7AA8766F,
+    (int32_t)0x24677758, (int32_t)0x7AB6CBA4, (int32_t)0x243743FA, (int32_t)0x7AC50DEC,
+    (int32_t)0x24070B08, (int32_t)0x7AD33D45, (int32_t)0x23D6CC87, (int32_t)0x7AE159AE,
+    (int32_t)0x23A6887F, (int32_t)0x7AEF6323, (int32_t)0x23763EF7, (int32_t)0x7AFD59A4,
+    (int32_t)0x2345EFF8, (int32_t)0x7B0B3D2C, (int32_t)0x23159B88, (int32_t)0x7B190DBC,
+    (int32_t)0x22E541AF, (int32_t)0x7B26CB4F, (int32_t)0x22B4E274, (int32_t)0x7B3475E5,
+    (int32_t)0x22847DE0, (int32_t)0x7B420D7A, (int32_t)0x225413F8, (int32_t)0x7B4F920E,
+    (int32_t)0x2223A4C5, (int32_t)0x7B5D039E, (int32_t)0x21F3304F, (int32_t)0x7B6A6227,
+    (int32_t)0x21C2B69C, (int32_t)0x7B77ADA8, (int32_t)0x219237B5, (int32_t)0x7B84E61F,
+    (int32_t)0x2161B3A0, (int32_t)0x7B920B89, (int32_t)0x21312A65, (int32_t)0x7B9F1DE6,
+    (int32_t)0x21009C0C, (int32_t)0x7BAC1D31, (int32_t)0x20D0089C, (int32_t)0x7BB9096B,
+    (int32_t)0x209F701C, (int32_t)0x7BC5E290, (int32_t)0x206ED295, (int32_t)0x7BD2A89E,
+    (int32_t)0x203E300D, (int32_t)0x7BDF5B94, (int32_t)0x200D888D, (int32_t)0x7BEBFB70,
+    (int32_t)0x1FDCDC1B, (int32_t)0x7BF88830, (int32_t)0x1FAC2ABF, (int32_t)0x7C0501D2,
+    (int32_t)0x1F7B7481, (int32_t)0x7C116853, (int32_t)0x1F4AB968, (int32_t)0x7C1DBBB3,
+    (int32_t)0x1F19F97B, (int32_t)0x7C29FBEE, (int32_t)0x1EE934C3, (int32_t)0x7C362904,
+    (int32_t)0x1EB86B46, (int32_t)0x7C4242F2, (int32_t)0x1E879D0D, (int32_t)0x7C4E49B7,
+    (int32_t)0x1E56CA1E, (int32_t)0x7C5A3D50, (int32_t)0x1E25F282, (int32_t)0x7C661DBC,
+    (int32_t)0x1DF5163F, (int32_t)0x7C71EAF9, (int32_t)0x1DC4355E, (int32_t)0x7C7DA505,
+    (int32_t)0x1D934FE5, (int32_t)0x7C894BDE, (int32_t)0x1D6265DD, (int32_t)0x7C94DF83,
+    (int32_t)0x1D31774D, (int32_t)0x7CA05FF1, (int32_t)0x1D00843D, (int32_t)0x7CABCD28,
+    (int32_t)0x1CCF8CB3, (int32_t)0x7CB72724, (int32_t)0x1C9E90B8, (int32_t)0x7CC26DE5,
+    (int32_t)0x1C6D9053, (int32_t)0x7CCDA169, (int32_t)0x1C3C8B8C, (int32_t)0x7CD8C1AE,
+    (int32_t)0x1C0B826A, (int32_t)0x7CE3CEB2, (int32_t)0x1BDA74F6, (int32_t)0x7CEEC873,
+    (int32_t)0x1BA96335, (int32_t)0x7CF9AEF0, (int32_t)0x1B784D30, (int32_t)0x7D048228,
+    (int32_t)0x1B4732EF, (int32_t)0x7D0F4218, (int32_t)0x1B161479, (int32_t)0x7D19EEBF,
+    (int32_t)0x1AE4F1D6, (int32_t)0x7D24881B, (int32_t)0x1AB3CB0D, (int32_t)0x7D2F0E2B,
+    (int32_t)0x1A82A026, (int32_t)0x7D3980EC, (int32_t)0x1A517128, (int32_t)0x7D43E05E,
+    (int32_t)0x1A203E1B, (int32_t)0x7D4E2C7F, (int32_t)0x19EF0707, (int32_t)0x7D58654D,
+    (int32_t)0x19BDCBF3, (int32_t)0x7D628AC6, (int32_t)0x198C8CE7, (int32_t)0x7D6C9CE9,
+    (int32_t)0x195B49EA, (int32_t)0x7D769BB5, (int32_t)0x192A0304, (int32_t)0x7D808728,
+    (int32_t)0x18F8B83C, (int32_t)0x7D8A5F40, (int32_t)0x18C7699B, (int32_t)0x7D9423FC,
+    (int32_t)0x18961728, (int32_t)0x7D9DD55A, (int32_t)0x1864C0EA, (int32_t)0x7DA77359,
+    (int32_t)0x183366E9, (int32_t)0x7DB0FDF8, (int32_t)0x1802092C, (int32_t)0x7DBA7534,
+    (int32_t)0x17D0A7BC, (int32_t)0x7DC3D90D, (int32_t)0x179F429F, (int32_t)0x7DCD2981,
+    (int32_t)0x176DD9DE, (int32_t)0x7DD6668F, (int32_t)0x173C6D80, (int32_t)0x7DDF9034,
+    (int32_t)0x170AFD8D, (int32_t)0x7DE8A670, (int32_t)0x16D98A0C, (int32_t)0x7DF1A942,
+    (int32_t)0x16A81305, (int32_t)0x7DFA98A8, (int32_t)0x1676987F, (int32_t)0x7E0374A0,
+    (int32_t)0x16451A83, (int32_t)0x7E0C3D29, (int32_t)0x16139918, (int32_t)0x7E14F242,
+    (int32_t)0x15E21445, (int32_t)0x7E1D93EA, (int32_t)0x15B08C12, (int32_t)0x7E26221F,
+    (int32_t)0x157F0086, (int32_t)0x7E2E9CDF, (int32_t)0x154D71AA, (int32_t)0x7E37042A,
+    (int32_t)0x151BDF86, (int32_t)0x7E3F57FF, (int32_t)0x14EA4A1F, (int32_t)0x7E47985B,
+    (int32_t)0x14B8B17F, (int32_t)0x7E4FC53E, (int32_t)0x148715AE, (int32_t)0x7E57DEA7,
+    (int32_t)0x145576B1, (int32_t)0x7E5FE493, (int32_t)0x1423D492, (int32_t)0x7E67D703,
+    (int32_t)0x13F22F58, (int32_t)0x7E6FB5F4, (int32_t)0x13C0870A, (int32_t)0x7E778166,
+    (int32_t)0x138EDBB1, (int32_t)0x7E7F3957, (int32_t)0x135D2D53, (int32_t)0x7E86DDC6,
+    (int32_t)0x132B7BF9, (int32_t)0x7E8E6EB2, (int32_t)0x12F9C7AA, (int32_t)0x7E95EC1A,
+    (int32_t)0x12C8106F, (int32_t)0x7E9D55FC, (int32_t)0x1296564D, (int32_t)0x7EA4AC58,
+    (int32_t)0x1264994E, (int32_t)0x7EABEF2C, (int32_t)0x1232D979, (int32_t)0x7EB31E78,
+    (int32_t)0x120116D5, (int32_t)0x7EBA3A39, (int32_t)0x11CF516A, (int32_t)0x7EC14270,
+    (int32_t)0x119D8941, (int32_t)0x7EC8371A, (int32_t)0x116BBE60, (int32_t)0x7ECF1837,
+    (int32_t)0x1139F0CF, (int32_t)0x7ED5E5C6, (int32_t)0x11082096, (int32_t)0x7EDC9FC6,
+    (int32_t)0x10D64DBD, (int32_t)0x7EE34636, (int32_t)0x10A4784B, (int32_t)0x7EE9D914,
+    (int32_t)0x1072A048, (int32_t)0x7EF05860, (int32_t)0x1040C5BB, (int32_t)0x7EF6C418,
+    (int32_t)0x100EE8AD, (int32_t)0x7EFD1C3C, (int32_t)0x0FDD0926, (int32_t)0x7F0360CB,
+    (int32_t)0x0FAB272B, (int32_t)0x7F0991C4, (int32_t)0x0F7942C7, (int32_t)0x7F0FAF25,
+    (int32_t)0x0F475BFF, (int32_t)0x7F15B8EE, (int32_t)0x0F1572DC, (int32_t)0x7F1BAF1E,
+    (int32_t)0x0EE38766, (int32_t)0x7F2191B4, (int32_t)0x0EB199A4, (int32_t)0x7F2760AF,
+    (int32_t)0x0E7FA99E, (int32_t)0x7F2D1C0E, (int32_t)0x0E4DB75B, (int32_t)0x7F32C3D1,
+    (int32_t)0x0E1BC2E4, (int32_t)0x7F3857F6, (int32_t)0x0DE9CC40, (int32_t)0x7F3DD87C,
+    (int32_t)0x0DB7D376, (int32_t)0x7F434563, (int32_t)0x0D85D88F, (int32_t)0x7F489EAA,
+    (int32_t)0x0D53DB92, (int32_t)0x7F4DE451, (int32_t)0x0D21DC87, (int32_t)0x7F531655,
+    (int32_t)0x0CEFDB76, (int32_t)0x7F5834B7, (int32_t)0x0CBDD865, (int32_t)0x7F5D3F75,
+    (int32_t)0x0C8BD35E, (int32_t)0x7F62368F, (int32_t)0x0C59CC68, (int32_t)0x7F671A05,
+    (int32_t)0x0C27C389, (int32_t)0x7F6BE9D4, (int32_t)0x0BF5B8CB, (int32_t)0x7F70A5FE,
+    (int32_t)0x0BC3AC35, (int32_t)0x7F754E80, (int32_t)0x0B919DCF, (int32_t)0x7F79E35A,
+    (int32_t)0x0B5F8D9F, (int32_t)0x7F7E648C, (int32_t)0x0B2D7BAF, (int32_t)0x7F82D214,
+    (int32_t)0x0AFB6805, (int32_t)0x7F872BF3, (int32_t)0x0AC952AA, (int32_t)0x7F8B7227,
+    (int32_t)0x0A973BA5, (int32_t)0x7F8FA4B0, (int32_t)0x0A6522FE, (int32_t)0x7F93C38C,
+    (int32_t)0x0A3308BD, (int32_t)0x7F97CEBD, (int32_t)0x0A00ECE8, (int32_t)0x7F9BC640,
+    (int32_t)0x09CECF89, (int32_t)0x7F9FAA15, (int32_t)0x099CB0A7, (int32_t)0x7FA37A3C,
+    (int32_t)0x096A9049, (int32_t)0x7FA736B4, (int32_t)0x09386E78, (int32_t)0x7FAADF7C,
+    (int32_t)0x09064B3A, (int32_t)0x7FAE7495, (int32_t)0x08D42699, (int32_t)0x7FB1F5FC,
+    (int32_t)0x08A2009A, (int32_t)0x7FB563B3, (int32_t)0x086FD947, (int32_t)0x7FB8BDB8,
+    (int32_t)0x083DB0A7, (int32_t)0x7FBC040A, (int32_t)0x080B86C2, (int32_t)0x7FBF36AA,
+    (int32_t)0x07D95B9E, (int32_t)0x7FC25596, (int32_t)0x07A72F45, (int32_t)0x7FC560CF,
+    (int32_t)0x077501BE, (int32_t)0x7FC85854, (int32_t)0x0742D311, (int32_t)0x7FCB3C23,
+    (int32_t)0x0710A345, (int32_t)0x7FCE0C3E, (int32_t)0x06DE7262, (int32_t)0x7FD0C8A3,
+    (int32_t)0x06AC406F, (int32_t)0x7FD37153, (int32_t)0x067A0D76, (int32_t)0x7FD6064C,
+    (int32_t)0x0647D97C, (int32_t)0x7FD8878E, (int32_t)0x0615A48B, (int32_t)0x7FDAF519,
+    (int32_t)0x05E36EA9, (int32_t)0x7FDD4EEC, (int32_t)0x05B137DF, (int32_t)0x7FDF9508,
+    (int32_t)0x057F0035, (int32_t)0x7FE1C76B, (int32_t)0x054CC7B1, (int32_t)0x7FE3E616,
+    (int32_t)0x051A8E5C, (int32_t)0x7FE5F108, (int32_t)0x04E8543E, (int32_t)0x7FE7E841,
+    (int32_t)0x04B6195D, (int32_t)0x7FE9CBC0, (int32_t)0x0483DDC3, (int32_t)0x7FEB9B85,
+    (int32_t)0x0451A177, (int32_t)0x7FED5791, (int32_t)0x041F6480, (int32_t)0x7FEEFFE1,
+    (int32_t)0x03ED26E6, (int32_t)0x7FF09478, (int32_t)0x03BAE8B2, (int32_t)0x7FF21553,
+    (int32_t)0x0388A9EA, (int32_t)0x7FF38274, (int32_t)0x03566A96, (int32_t)0x7FF4DBD9,
+    (int32_t)0x03242ABF, (int32_t)0x7FF62182, (int32_t)0x02F1EA6C, (int32_t)0x7FF75370,
+    (int32_t)0x02BFA9A4, (int32_t)0x7FF871A2, (int32_t)0x028D6870, (int32_t)0x7FF97C18,
+    (int32_t)0x025B26D7, (int32_t)0x7FFA72D1, (int32_t)0x0228E4E2, (int32_t)0x7FFB55CE,
+    (int32_t)0x01F6A297, (int32_t)0x7FFC250F, (int32_t)0x01C45FFE, (int32_t)0x7FFCE093,
+    (int32_t)0x01921D20, (int32_t)0x7FFD885A, (int32_t)0x015FDA03, (int32_t)0x7FFE1C65,
+    (int32_t)0x012D96B1, (int32_t)0x7FFE9CB2, (int32_t)0x00FB5330, (int32_t)0x7FFF0943,
+    (int32_t)0x00C90F88, (int32_t)0x7FFF6216, (int32_t)0x0096CBC1, (int32_t)0x7FFFA72C,
+    (int32_t)0x006487E3, (int32_t)0x7FFFD886, (int32_t)0x003243F5, (int32_t)0x7FFFF621
+};
+
+const int32_t twiddleCoef_dct_1024_q32[4096] = {
+    (int32_t)0x7FFFFFFF, (int32_t)0x00000000, (int32_t)0x7FFFFD88, (int32_t)0x001921FB,
+    (int32_t)0x7FFFF621, (int32_t)0x003243F5, (int32_t)0x7FFFE9CB, (int32_t)0x004B65EE,
+    (int32_t)0x7FFFD886, (int32_t)0x006487E3, (int32_t)0x7FFFC251, (int32_t)0x007DA9D4,
+    (int32_t)0x7FFFA72C, (int32_t)0x0096CBC1, (int32_t)0x7FFF8719, (int32_t)0x00AFEDA8,
+    (int32_t)0x7FFF6216, (int32_t)0x00C90F88, (int32_t)0x7FFF3824, (int32_t)0x00E23160,
+    (int32_t)0x7FFF0943, (int32_t)0x00FB5330, (int32_t)0x7FFED572, (int32_t)0x011474F6,
+    (int32_t)0x7FFE9CB2, (int32_t)0x012D96B1, (int32_t)0x7FFE5F03, (int32_t)0x0146B860,
+    (int32_t)0x7FFE1C65, (int32_t)0x015FDA03, (int32_t)0x7FFDD4D7, (int32_t)0x0178FB99,
+    (int32_t)0x7FFD885A, (int32_t)0x01921D20, (int32_t)0x7FFD36EE, (int32_t)0x01AB3E97,
+    (int32_t)0x7FFCE093, (int32_t)0x01C45FFE, (int32_t)0x7FFC8549, (int32_t)0x01DD8154,
+    (int32_t)0x7FFC250F, (int32_t)0x01F6A297, (int32_t)0x7FFBBFE6, (int32_t)0x020FC3C6,
+    (int32_t)0x7FFB55CE, (int32_t)0x0228E4E2, (int32_t)0x7FFAE6C7, (int32_t)0x024205E8,
+    (int32_t)0x7FFA72D1, (int32_t)0x025B26D7, (int32_t)0x7FF9F9EC, (int32_t)0x027447B0,
+    (int32_t)0x7FF97C18, (int32_t)0x028D6870, (int32_t)0x7FF8F954, (int32_t)0x02A68917,
+    (int32_t)0x7FF871A2, (int32_t)0x02BFA9A4, (int32_t)0x7FF7E500, (int32_t)0x02D8CA16,
+    (int32_t)0x7FF75370, (int32_t)0x02F1EA6C, (int32_t)0x7FF6BCF0, (int32_t)0x030B0AA4,
+    (int32_t)0x7FF62182, (int32_t)0x03242ABF, (int32_t)0x7FF58125, (int32_t)0x033D4ABB,
+    (int32_t)0x7FF4DBD9, (int32_t)0x03566A96, (int32_t)0x7FF4319D, (int32_t)0x036F8A51,
+    (int32_t)0x7FF38274, (int32_t)0x0388A9EA, (int32_t)0x7FF2CE5B, (int32_t)0x03A1C960,
+    (int32_t)0x7FF21553, (int32_t)0x03BAE8B2, (int32_t)0x7FF1575D, (int32_t)0x03D407DF,
+    (int32_t)0x7FF09478, (int32_t)0x03ED26E6, (int32_t)0x7FEFCCA4, (int32_t)0x040645C7,
+    (int32_t)0x7FEEFFE1, (int32_t)0x041F6480, (int32_t)0x7FEE2E30, (int32_t)0x04388310,
+    (int32_t)0x7FED5791, (int32_t)0x0451A177, (int32_t)0x7FEC7C02, (int32_t)0x046ABFB3,
+    (int32_t)0x7FEB9B85, (int32_t)0x0483DDC3, (int32_t)0x7FEAB61A, (int32_t)0x049CFBA7,
+    (int32_t)0x7FE9CBC0, (int32_t)0x04B6195D, (int32_t)0x7FE8DC78, (int32_t)0x04CF36E5,
+    (int32_t)0x7FE7E841, (int32_t)0x04E8543E, (int32_t)0x7FE6EF1C, (int32_t)0x05017165,
+    (int32_t)0x7FE5F108, (int32_t)0x051A8E5C, (int32_t)0x7FE4EE06, (int32_t)0x0533AB20,
+    (int32_t)0x7FE3E616, (int32_t)0x054CC7B1, (int32_t)0x7FE2D938, (int32_t)0x0565E40D,
+    (int32_t)0x7FE1C76B, (int32_t)0x057F0035, (int32_t)0x7FE0B0B1, (int32_t)0x05981C26,
+    (int32_t)0x7FDF9508, (int32_t)0x05B137DF, (int32_t)0x7FDE7471, (int32_t)0x05CA5361,
+    (int32_t)0x7FDD4EEC, (int32_t)0x05E36EA9, (int32_t)0x7FDC247A, (int32_t)0x05FC89B8,
+    (int32_t)0x7FDAF519, (int32_t)0x0615A48B, (int32_t)0x7FD9C0CA, (int32_t)0x062EBF22,
+    (int32_t)0x7FD8878E, (int32_t)0x0647D97C, (int32_t)0x7FD74964, (int32_t)0x0660F398,
+    (int32_t)0x7FD6064C, (int32_t)0x067A0D76, (int32_t)0x7FD4BE46, (int32_t)0x06932713,
+    (int32_t)0x7FD37153, (int32_t)0x06AC406F, (int32_t)0x7FD21F72, (int32_t)0x06C5598A,
+    (int32_t)0x7FD0C8A3, (int32_t)0x06DE7262, (int32_t)0x7FCF6CE8, (int32_t)0x06F78AF6,
+    (int32_t)0x7FCE0C3E, (int32_t)0x0710A345, (int32_t)0x7FCCA6A7, (int32_t)0x0729BB4E,
+    (int32_t)0x7FCB3C23, (int32_t)0x0742D311, (int32_t)0x7FC9CCB2, (int32_t)0x075BEA8C,
+    (int32_t)0x7FC85854, (int32_t)0x077501BE, (int32_t)0x7FC6DF08, (int32_t)0x078E18A7,
+    (int32_t)0x7FC560CF, (int32_t)0x07A72F45, (int32_t)0x7FC3DDA9, (int32_t)0x07C04598,
+    (int32_t)0x7FC25596, (int32_t)0x07D95B9E, (int32_t)0x7FC0C896, (int32_t)0x07F27157,
+    (int32_t)0x7FBF36AA, (int32_t)0x080B86C2, (int32_t)0x7FBD9FD0, (int32_t)0x08249BDD,
+    (int32_t)0x7FBC040A, (int32_t)0x083DB0A7, (int32_t)0x7FBA6357, (int32_t)0x0856C520,
+    (int32_t)0x7FB8BDB8, (int32_t)0x086FD947, (int32_t)0x7FB7132B, (int32_t)0x0888ED1B,
+    (int32_t)0x7FB563B3, (int32_t)0x08A2009A, (int32_t)0x7FB3AF4E, (int32_t)0x08BB13C5,
+    (int32_t)0x7FB1F5FC, (int32_t)0x08D42699, (int32_t)0x7FB037BF, (int32_t)0x08ED3916,
+    (int32_t)0x7FAE7495, (int32_t)0x09064B3A, (int32_t)0x7FACAC7F, (int32_t)0x091F5D06,
+    (int32_t)0x7FAADF7C, (int32_t)0x09386E78, (int32_t)0x7FA90D8E, (int32_t)0x09517F8F,
+    (int32_t)0x7FA736B4, (int32_t)0x096A9049, (int32_t)0x7FA55AEE, (int32_t)0x0983A0A7,
+    (int32_t)0x7FA37A3C, (int32_t)0x099CB0A7, (int32_t)0x7FA1949E, (int32_t)0x09B5C048,
+    (int32_t)0x7F9FAA15, (int32_t)0x09CECF89, (int32_t)0x7F9DBAA0, (int32_t)0x09E7DE6A,
+    (int32_t)0x7F9BC640, (int32_t)0x0A00ECE8, (int32_t)0x7F99CCF4, (int32_t)0x0A19FB04,
+    (int32_t)0x7F97CEBD, (int32_t)0x0A3308BD, (int32_t)0x7F95CB9A, (int32_t)0x0A4C1610,
+    (int32_t)0x7F93C38C, (int32_t)0x0A6522FE, (int32_t)0x7F91B694, (int32_t)0x0A7E2F85,
+    (int32_t)0x7F8FA4B0, (int32_t)0x0A973BA5, (int32_t)0x7F8D8DE1, (int32_t)0x0AB0475C,
+    (int32_t)0x7F8B7227, (int32_t)0x0AC952AA, (int32_t)0x7F895182, (int32_t)0x0AE25D8D,
+    (int32_t)0x7F872BF3, (int32_t)0x0AFB6805, (int32_t)0x7F850179, (int32_t)0x0B147211,
+    (int32_t)0x7F82D214, (int32_t)0x0B2D7BAF, (int32_t)0x7F809DC5, (int32_t)0x0B4684DF,
+    (int32_t)0x7F7E648C, (int32_t)0x0B5F8D9F, (int32_t)0x7F7C2668, (int32_t)0x0B7895F0,
+    (int32_t)0x7F79E35A, (int32_t)0x0B919DCF, (int32_t)0x7F779B62, (int32_t)0x0BAAA53B,
+    (int32_t)0x7F754E80, (int32_t)0x0BC3AC35, (int32_t)0x7F72FCB4, (int32_t)0x0BDCB2BB,
+    (int32_t)0x7F70A5FE, (int32_t)0x0BF5B8CB, (int32_t)0x7F6E4A5E, (int32_t)0x0C0EBE66,
+    (int32_t)0x7F6BE9D4, (int32_t)0x0C27C389, (int32_t)0x7F698461, (int32_t)0x0C40C835,
+    (int32_t)0x7F671A05, (int32_t)0x0C59CC68, (int32_t)0x7F64AABF, (int32_t)0x0C72D020,
+    (int32_t)0x7F62368F, (int32_t)0x0C8BD35E, (int32_t)0x7F5FBD77, (int32_t)0x0CA4D620,
+    (int32_t)0x7F5D3F75, (int32_t)0x0CBDD865, (int32_t)0x7F5ABC8A, (int32_t)0x0CD6DA2D,
+    (int32_t)0x7F5834B7, (int32_t)0x0CEFDB76, (int32_t)0x7F55A7FA, (int32_t)0x0D08DC3F,
+    (int32_t)0x7F531655, (int32_t)0x0D21DC87, (int32_t)0x7F507FC7, (int32_t)0x0D3ADC4E,
+    (int32_t)0x7F4DE451, (int32_t)0x0D53DB92, (int32_t)0x7F4B43F2, (int32_t)0x0D6CDA53,
+    (int32_t)0x7F489EAA, (int32_t)0x0D85D88F, (int32_t)0x7F45F47B, (int32_t)0x0D9ED646,
+    (int32_t)0x7F434563, (int32_t)0x0DB7D376, (int32_t)0x7F409164, (int32_t)0x0DD0D01F,
+    (int32_t)0x7F3DD87C, (int32_t)0x0DE9CC40, (int32_t)0x7F3B1AAD, (int32_t)0x0E02C7D7,
+    (int32_t)0x7F3857F6, (int32_t)0x0E1BC2E4, (int32_t)0x7F359057, (int32_t)0x0E34BD66,
+    (int32_t)0x7F32C3D1, (int32_t)0x0E4DB75B, (int32_t)0x7F2FF263, (int32_t)0x0E66B0C3,
+    (int32_t)0x7F2D1C0E, (int32_t)0x0E7FA99E, (int32_t)0x7F2A40D2, (int32_t)0x0E98A1E9,
+    (int32_t)0x7F2760AF, (int32_t)0x0EB199A4, (int32_t)0x7F247BA5, (int32_t)0x0ECA90CE,
+    (int32_t)0x7F2191B4, (int32_t)0x0EE38766, (int32_t)0x7F1EA2DC, (int32_t)0x0EFC7D6B,
+    (int32_t)0x7F1BAF1E, (int32_t)0x0F1572DC, (int32_t)0x7F18B679, (int32_t)0x0F2E67B8,
+    (int32_t)0x7F15B8EE, (int32_t)0x0F475BFF, (int32_t)0x7F12B67C, (int32_t)0x0F604FAF,
+    (int32_t)0x7F0FAF25, (int32_t)0x0F7942C7, (int32_t)0x7F0CA2E7, (int32_t)0x0F923546,
+    (int32_t)0x7F0991C4, (int32_t)0x0FAB272B, (int32_t)0x7F067BBA, (int32_t)0x0FC41876,
+    (int32_t)0x7F0360CB, (int32_t)0x0FDD0926, (int32_t)0x7F0040F6, (int32_t)0x0FF5F938,
+    (int32_t)0x7EFD1C3C, (int32_t)0x100EE8AD, (int32_t)0x7EF9F29D, (int32_t)0x1027D784,
+    (int32_t)0x7EF6C418, (int32_t)0x1040C5BB, (int32_t)0x7EF390AE, (int32_t)0x1059B352,
+    (int32_t)0x7EF05860, (int32_t)0x1072A048, (int32_t)0x7EED1B2C, (int32_t)0x108B8C9B,
+    (int32_t)0x7EE9D914, (int32_t)0x10A4784B, (int32_t)0x7EE69217, (int32_t)0x10BD6356,
+    (int32_t)0x7EE34636, (int32_t)0x10D64DBD, (int32_t)0x7EDFF570, (int32_t)0x10EF377D,
+    (int32_t)0x7EDC9FC6, (int32_t)0x11082096, (int32_t)0x7ED94538, (int32_t)0x11210907,
+    (int32_t)0x7ED5E5C6, (int32_t)0x1139F0CF, (int32_t)0x7ED28171, (int32_t)0x1152D7ED,
+    (int32_t)0x7ECF1837, (int32_t)0x116BBE60, (int32_t)0x7ECBAA1A, (int32_t)0x1184A427,
+    (int32_t)0x7EC8371A, (int32_t)0x119D8941, (int32_t)0x7EC4BF36, (int32_t)0x11B66DAD,
+    (int32_t)0x7EC14270, (int32_t)0x11CF516A, (int32_t)0x7EBDC0C6, (int32_t)0x11E83478,
+    (int32_t)0x7EBA3A39, (int32_t)0x120116D5, (int32_t)0x7EB6AECA, (int32_t)0x1219F880,
+    (int32_t)0x7EB31E78, (int32_t)0x1232D979, (int32_t)0x7EAF8943, (int32_t)0x124BB9BE,
+    (int32_t)0x7EABEF2C, (int32_t)0x1264994E, (int32_t)0x7EA85033, (int32_t)0x127D7829,
+    (int32_t)0x7EA4AC58, (int32_t)0x1296564D, (int32_t)0x7EA1039B, (int32_t)0x12AF33BA,
+    (int32_t)0x7E9D55FC, (int32_t)0x12C8106F, (int32_t)0x7E99A37C, (int32_t)0x12E0EC6A,
+    (int32_t)0x7E95EC1A, (int32_t)0x12F9C7AA, (int32_t)0x7E922FD6, (int32_t)0x1312A230,
+    (int32_t)0x7E8E6EB2, (int32_t)0x132B7BF9, (int32_t)0x7E8AA8AC, (int32_t)0x13445505,
+    (int32_t)0x7E86DDC6, (int32_t)0x135D2D53, (int32_t)0x7E830DFF, (int32_t)0x137604E2,
+    (int32_t)0x7E7F3957, (int32_t)0x138EDBB1, (int32_t)0x7E7B5FCE, (int32_t)0x13A7B1BF,
+    (int32_t)0x7E778166, (int32_t)0x13C0870A, (int32_t)0x7E739E1D, (int32_t)0x13D95B93,
+    (int32_t)0x7E6FB5F4, (int32_t)0x13F22F58, (int32_t)0x7E6BC8EB, (int32_t)0x140B0258,
+    (int32_t)0x7E67D703, (int32_t)0x1423D492, (int32_t)0x7E63E03B, (int32_t)0x143CA605,
+    (int32_t)0x7E5FE493, (int32_t)0x145576B1, (int32_t)0x7E5BE40C, (int32_t)0x146E4694,
+    (int32_t)0x7E57DEA7, (int32_t)0x148715AE, (int32_t)0x7E53D462, (int32_t)0x149FE3FC,
+    (int32_t)0x7E4FC53E, (int32_t)0x14B8B17F, (int32_t)0x7E4BB13C, (int32_t)0x14D17E36,
+    (int32_t)0x7E47985B, (int32_t)0x14EA4A1F, (int32_t)0x7E437A9C, (int32_t)0x1503153A,
+    (int32_t)0x7E3F57FF, (int32_t)0x151BDF86, (int32_t)0x7E3B3083, (int32_t)0x1534A901,
+    (int32_t)0x7E37042A, (int32_t)0x154D71AA, (int32_t)0x7E32D2F4, (int32_t)0x15663982,
+    (int32_t)0x7E2E9CDF, (int32_t)0x157F0086, (int32_t)0x7E2A61ED, (int32_t)0x1597C6B7,
+    (int32_t)0x7E26221F, (int32_t)0x15B08C12, (int32_t)0x7E21DD73, (int32_t)0x15C95097,
+    (int32_t)0x7E1D93EA, (int32_t)0x15E21445, (int32_t)0x7E194584, (int32_t)0x15FAD71B,
+    (int32_t)0x7E14F242, (int32_t)0x16139918, (int32_t)0x7E109A24, (int32_t)0x162C5A3B,
+    (int32_t)0x7E0C3D29, (int32_t)0x16451A83, (int32_t)0x7E07DB52, (int32_t)0x165DD9F0,
+    (int32_t)0x7E0374A0, (int32_t)0x1676987F, (int32_t)0x7DFF0911, (int32_t)0x168F5632,
+    (int32_t)0x7DFA98A8, (int32_t)0x16A81305, (int32_t)0x7DF62362, (int32_t)0x16C0CEF9,
+    (int32_t)0x7DF1A942, (int32_t)0x16D98A0C, (int32_t)0x7DED2A47, (int32_t)0x16F2443E,
+    (int32_t)0x7DE8A670, (int32_t)0x170AFD8D, (int32_t)0x7DE41DC0, (int32_t)0x1723B5F9,
+    (int32_t)0x7DDF9034, (int32_t)0x173C6D80, (int32_t)0x7DDAFDCE, (int32_t)0x17552422,
+    (int32_t)0x7DD6668F, (int32_t)0x176DD9DE, (int32_t)0x7DD1CA75, (int32_t)0x17868EB3,
+    (int32_t)0x7DCD2981, (int32_t)0x179F429F, (int32_t)0x7DC883B4, (int32_t)0x17B7F5A3,
+    (int32_t)0x7DC3D90D, (int32_t)0x17D0A7BC, (int32_t)0x7DBF298D, (int32_t)0x17E958EA,
+    (int32_t)0x7DBA7534, (int32_t)0x1802092C, (int32_t)0x7DB5BC02, (int32_t)0x181AB881,
+    (int32_t)0x7DB0FDF8, (int32_t)0x183366E9, (int32_t)0x7DAC3B15, (int32_t)0x184C1461,
+    (int32_t)0x7DA77359, (int32_t)0x1864C0EA, (int32_t)0x7DA2A6C6, (int32_t)0x187D6C82,
+    (int32_t)0x7D9DD55A, (int32_t)0x18961728, (int32_t)0x7D98FF17, (int32_t)0x18AEC0DB,
+    (int32_t)0x7D9423FC, (int32_t)0x18C7699B, (int32_t)0x7D8F4409, (int32_t)0x18E01167,
+    (int32_t)0x7D8A5F40, (int32_t)0x18F8B83C, (int32_t)0x7D85759F, (int32_t)0x19115E1C,
+    (int32_t)0x7D808728, (int32_t)0x192A0304, (int32_t)0x7D7B93DA, (int32_t)0x1942A6F3,
+    (int32_t)0x7D769BB5, (int32_t)0x195B49EA, (int32_t)0x7D719EBA, (int32_t)0x1973EBE6,
+    (int32_t)0x7D6C9CE9, (int32_t)0x198C8CE7, (int32_t)0x7D679642, (int32_t)0x19A52CEB,
+    (int32_t)0x7D628AC6, (int32_t)0x19BDCBF3, (int32_t)0x7D5D7A74, (int32_t)0x19D669FC,
+    (int32_t)0x7D58654D, (int32_t)0x19EF0707, (int32_t)0x7D534B50, (int32_t)0x1A07A311,
+    (int32_t)0x7D4E2C7F, (int32_t)0x1A203E1B, (int32_t)0x7D4908D9, (int32_t)0x1A38D823,
+    (int32_t)0x7D43E05E, (int32_t)0x1A517128, (int32_t)0x7D3EB30F, (int32_t)0x1A6A0929,
+    (int32_t)0x7D3980EC, (int32_t)0x1A82A026, (int32_t)0x7D3449F5, (int32_t)0x1A9B361D,
+    (int32_t)0x7D2F0E2B, (int32_t)0x1AB3CB0D, (int32_t)0x7D29CD8C, (int32_t)0x1ACC5EF6,
+    (int32_t)0x7D24881B, (int32_t)0x1AE4F1D6, (int32_t)0x7D1F3DD6, (int32_t)0x1AFD83AD,
+    (int32_t)0x7D19EEBF, (int32_t)0x1B161479, (int32_t)0x7D149AD5, (int32_t)0x1B2EA43A,
+    (int32_t)0x7D0F4218, (int32_t)0x1B4732EF, (int32_t)0x7D09E489, (int32_t)0x1B5FC097,
+    (int32_t)0x7D048228, (int32_t)0x1B784D30, (int32_t)0x7CFF1AF5, (int32_t)0x1B90D8BB,
+    (int32_t)0x7CF9AEF0, (int32_t)0x1BA96335, (int32_t)0x7CF43E1A, (int32_t)0x1BC1EC9E,
+    (int32_t)0x7CEEC873, (int32_t)0x1BDA74F6, (int32_t)0x7CE94DFB, (int32_t)0x1BF2FC3A,
+    (int32_t)0x7CE3CEB2, (int32_t)0x1C0B826A, (int32_t)0x7CDE4A98, (int32_t)0x1C240786,
+    (int32_t)0x7CD8C1AE, (int32_t)0x1C3C8B8C, (int32_t)0x7CD333F3, (int32_t)0x1C550E7C,
+    (int32_t)0x7CCDA169, (int32_t)0x1C6D9053, (int32_t)0x7CC80A0F, (int32_t)0x1C861113,
+    (int32_t)0x7CC26DE5, (int32_t)0x1C9E90B8, (int32_t)0x7CBCCCEC, (int32_t)0x1CB70F43,
+    (int32_t)0x7CB72724, (int32_t)0x1CCF8CB3, (int32_t)0x7CB17C8D, (int32_t)0x1CE80906,
+    (int32_t)0x7CABCD28, (int32_t)0x1D00843D, (int32_t)0x7CA618F3, (int32_t)0x1D18FE54,
+    (int32_t)0x7CA05FF1, (int32_t)0x1D31774D, (int32_t)0x7C9AA221, (int32_t)0x1D49EF26,
+    (int32_t)0x7C94DF83, (int32_t)0x1D6265DD, (int32_t)0x7C8F1817, (int32_t)0x1D7ADB73,
+    (int32_t)0x7C894BDE, (int32_t)0x1D934FE5, (int32_t)0x7C837AD8, (int32_t)0x1DABC334,
+    (int32_t)0x7C7DA505, (int32_t)0x1DC4355E, (int32_t)0x7C77CA65, (int32_t)0x1DDCA662,
+    (int32_t)0x7C71EAF9, (int32_t)0x1DF5163F, (int32_t)0x7C6C06C0, (int32_t)0x1E0D84F5,
+    (int32_t)0x7C661DBC, (int32_t)0x1E25F282, (int32_t)0x7C602FEC, (int32_t)0x1E3E5EE5,
+    (int32_t)0x7C5A3D50, (int32_t)0x1E56CA1E, (int32_t)0x7C5445E9, (int32_t)0x1E6F342C,
+    (int32_t)0x7C4E49B7, (int32_t)0x1E879D0D, (int32_t)0x7C4848BA, (int32_t)0x1EA004C1,
+    (int32_t)0x7C4242F2, (int32_t)0x1EB86B46, (int32_t)0x7C3C3860, (int32_t)0x1ED0D09D,
+    (int32_t)0x7C362904, (int32_t)0x1EE934C3, (int32_t)0x7C3014DE, (int32_t)0x1F0197B8,
+    (int32_t)0x7C29FBEE, (int32_t)0x1F19F97B, (int32_t)0x7C23DE35, (int32_t)0x1F325A0B,
+    (int32_t)0x7C1DBBB3, (int32_t)0x1F4AB968, (int32_t)0x7C179467, (int32_t)0x1F63178F,
+    (int32_t)0x7C116853, (int32_t)0x1F7B7481, (int32_t)0x7C0B3777, (int32_t)0x1F93D03C,
+    (int32_t)0x7C0501D2, (int32_t)0x1FAC2ABF, (int32_t)0x7BFEC765, (int32_t)0x1FC4840A,
+    (int32_t)0x7BF88830, (int32_t)0x1FDCDC1B, (int32_t)0x7BF24434, (int32_t)0x1FF532F2,
+    (int32_t)0x7BEBFB70, (int32_t)0x200D888D, (int32_t)0x7BE5ADE6, (int32_t)0x2025DCEC,
+    (int32_t)0x7BDF5B94, (int32_t)0x203E300D, (int32_t)0x7BD9047C, (int32_t)0x205681F1,
+    (int32_t)0x7BD2A89E, (int32_t)0x206ED295, (int32_t)0x7BCC47FA, (int32_t)0x208721F9,
+    (int32_t)0x7BC5E290, (int32_t)0x209F701C, (int32_t)0x7BBF7860, (int32_t)0x20B7BCFE,
+    (int32_t)0x7BB9096B, (int32_t)0x20D0089C, (int32_t)0x7BB295B0, (int32_t)0x20E852F6,
+    (int32_t)0x7BAC1D31, (int32_t)0x21009C0C, (int32_t)0x7BA59FEE, (int32_t)0x2118E3DC,
+    (int32_t)0x7B9F1DE6, (int32_t)0x21312A65, (int32_t)0x7B989719, (int32_t)0x21496FA7,
+    (int32_t)0x7B920B89, (int32_t)0x2161B3A0, (int32_t)0x7B8B7B36, (int32_t)0x2179F64F,
+    (int32_t)0x7B84E61F, (int32_t)0x219237B5, (int32_t)0x7B7E4C45, (int32_t)0x21AA77CF,
+    (int32_t)0x7B77ADA8, (int32_t)0x21C2B69C, (int32_t)0x7B710A49, (int32_t)0x21DAF41D,
+    (int32_t)0x7B6A6227, (int32_t)0x21F3304F, (int32_t)0x7B63B543, (int32_t)0x220B6B32,
+    (int32_t)0x7B5D039E, (int32_t)0x2223A4C5, (int32_t)0x7B564D36, (int32_t)0x223BDD08,
+    (int32_t)0x7B4F920E, (int32_t)0x225413F8, (int32_t)0x7B48D225, (int32_t)0x226C4996,
+    (int32_t)0x7B420D7A, (int32_t)0x22847DE0, (int32_t)0x7B3B4410, (int32_t)0x229CB0D5,
+    (int32_t)0x7B3475E5, (int32_t)0x22B4E274, (int32_t)0x7B2DA2FA, (int32_t)0x22CD12BD,
+    (int32_t)0x7B26CB4F, (int32_t)0x22E541AF, (int32_t)0x7B1FEEE5, (int32_t)0x22FD6F48,
+    (int32_t)0x7B190DBC, (int32_t)0x23159B88, (int32_t)0x7B1227D3, (int32_t)0x232DC66D,
+    (int32_t)0x7B0B3D2C, (int32_t)0x2345EFF8, (int32_t)0x7B044DC7, (int32_t)0x235E1826,
+    (int32_t)0x7AFD59A4, (int32_t)0x23763EF7, (int32_t)0x7AF660C2, (int32_t)0x238E646A,
+    (int32_t)0x7AEF6323, (int32_t)0x23A6887F, (int32_t)0x7AE860C7, (int32_t)0x23BEAB33,
+    (int32_t)0x7AE159AE, (int32_t)0x23D6CC87, (int32_t)0x7ADA4DD8, (int32_t)0x23EEEC78,
+    (int32_t)0x7AD33D45, (int32_t)0x24070B08, (int32_t)0x7ACC27F7, (int32_t)0x241F2833,
+    (int32_t)0x7AC50DEC, (int32_t)0x243743FA, (int32_t)0x7ABDEF25, (int32_t)0x244F5E5C,
+    (int32_t)0x7AB6CBA4, (int32_t)0x24677758, (int32_t)0x7AAFA367, (int32_t)0x247F8EEC,
+    (int32_t)0x7AA8766F, (int32_t)0x2497A517, (int32_t)0x7AA144BC, (int32_t)0x24AFB9DA,
+    (int32_t)0x7A9A0E50, (int32_t)0x24C7CD33, (int32_t)0x7A92D329, (int32_t)0x24DFDF20,
+    (int32_t)0x7A8B9348, (int32_t)0x24F7EFA2, (int32_t)0x7A844EAE, (int32_t)0x250FFEB7,
+    (int32_t)0x7A7D055B, (int32_t)0x25280C5E, (int32_t)0x7A75B74F, (int32_t)0x25401896,
+    (int32_t)0x7A6E648A, (int32_t)0x2558235F, (int32_t)0x7A670D0D, (int32_t)0x25702CB7,
+    (int32_t)0x7A5FB0D8, (int32_t)0x2588349D, (int32_t)0x7A584FEB, (int32_t)0x25A03B11,
+    (int32_t)0x7A50EA47, (int32_t)0x25B84012, (int32_t)0x7A497FEB, (int32_t)0x25D0439F,
+    (int32_t)0x7A4210D8, (int32_t)0x25E845B6, (int32_t)0x7A3A9D0F, (int32_t)0x26004657,
+    (int32_t)0x7A332490, (int32_t)0x26184581, (int32_t)0x7A2BA75A, (int32_t)0x26304333,
+    (int32_t)0x7A24256F, (int32_t)0x26483F6C, (int32_t)0x7A1C9ECE, (int32_t)0x26603A2C,
+    (int32_t)0x7A151378, (int32_t)0x26783370, (int32_t)0x7A0D836D, (int32_t)0x26902B39,
+    (int32_t)0x7A05EEAD, (int32_t)0x26A82186, (int32_t)0x79FE5539, (int32_t)0x26C01655,
+    (int32_t)0x79F6B711, (int32_t)0x26D809A5, (int32_t)0x79EF1436, (int32_t)0x26EFFB76,
+    (int32_t)0x79E76CA7, (int32_t)0x2707EBC7, (int32_t)0x79DFC064, (int32_t)0x271FDA96,
+    (int32_t)0x79D80F6F, (int32_t)0x2737C7E3, (int32_t)0x79D059C8, (int32_t)0x274FB3AE,
+    (int32_t)0x79C89F6E, (int32_t)0x27679DF4, (int32_t)0x79C0E062, (int32_t)0x277F86B5,
+    (int32_t)0x79B91CA4, (int32_t)0x27976DF1, (int32_t)0x79B15435, (int32_t)0x27AF53A6,
+    (int32_t)0x79A98715, (int32_t)0x27C737D3, (int32_t)0x79A1B545, (int32_t)0x27DF1A77,
+    (int32_t)0x7999DEC4, (int32_t)0x27F6FB92, (int32_t)0x79920392, (int32_t)0x280EDB23,
+    (int32_t)0x798A23B1, (int32_t)0x2826B928, (int32_t)0x79823F20, (int32_t)0x283E95A1,
+    (int32_t)0x797A55E0, (int32_t)0x2856708D, (int32_t)0x797267F2, (int32_t)0x286E49EA,
+    (int32_t)0x796A7554, (int32_t)0x288621B9, (int32_t)0x79627E08, (int32_t)0x289DF7F8,
+    (int32_t)0x795A820E, (int32_t)0x28B5CCA5, (int32_t)0x79528167, (int32_t)0x28CD9FC1,
+    (int32_t)0x794A7C12, (int32_t)0x28E5714B, (int32_t)0x79427210, (int32_t)0x28FD4140,
+    (int32_t)0x793A6361, (int32_t)0x29150FA1, (int32_t)0x79325006, (int32_t)0x292CDC6D,
+    (int32_t)0x792A37FE, (int32_t)0x2944A7A2, (int32_t)0x79221B4B, (int32_t)0x295C7140,
+    (int32_t)0x7919F9EC, (int32_t)0x29743946, (int32_t)0x7911D3E2, (int32_t)0x298BFFB2,
+    (int32_t)0x7909A92D, (int32_t)0x29A3C485, (int32_t)0x790179CD, (int32_t)0x29BB87BC,
+    (int32_t)0x78F945C3, (int32_t)0x29D34958, (int32_t)0x78F10D0F, (int32_t)0x29EB0957,
+    (int32_t)0x78E8CFB2, (int32_t)0x2A02C7B8, (int32_t)0x78E08DAB, (int32_t)0x2A1A847B,
+    (int32_t)0x78D846FB, (int32_t)0x2A323F9E, (int32_t)0x78CFFBA3, (int32_t)0x2A49F920,
+    (int32_t)0x78C7ABA2, (int32_t)0x2A61B101, (int32_t)0x78BF56F9, (int32_t)0x2A796740,
+    (int32_t)0x78B6FDA8, (int32_t)0x2A911BDC, (int32_t)0x78AE9FB0, (int32_t)0x2AA8CED3,
+    (int32_t)0x78A63D11, (int32_t)0x2AC08026, (int32_t)0x789DD5CB, (int32_t)0x2AD82FD2,
+    (int32_t)0x789569DF, (int32_t)0x2AEFDDD8, (int32_t)0x788CF94C, (int32_t)0x2B078A36,
+    (int32_t)0x78848414, (int32_t)0x2B1F34EB, (int32_t)0x787C0A36, (int32_t)0x2B36DDF7,
+    (int32_t)0x78738BB3, (int32_t)0x2B4E8558, (int32_t)0x786B088C, (int32_t)0x2B662B0E,
+    (int32_t)0x786280BF, (int32_t)0x2B7DCF17, (int32_t)0x7859F44F, (int32_t)0x2B957173,
+    (int32_t)0x7851633B, (int32_t)0x2BAD1221, (int32_t)0x7848CD83, (int32_t)0x2BC4B120,
+    (int32_t)0x78403329, (int32_t)0x2BDC4E6F, (int32_t)0x7837942B, (int32_t)0x2BF3EA0D,
+    (int32_t)0x782EF08B, (int32_t)0x2C0B83FA, (int32_t)0x78264849, (int32_t)0x2C231C33,
+    (int32_t)0x781D9B65, (int32_t)0x2C3AB2B9, (int32_t)0x7814E9DF, (int32_t)0x2C52478A,
+    (int32_t)0x780C33B8, (int32_t)0x2C69DAA6, (int32_t)0x780378F1, (int32_t)0x2C816C0C,
+    (int32_t)0x77FAB989, (int32_t)0x2C98FBBA, (int32_t)0x77F1F581, (int32_t)0x2CB089B1,
+    (int32_t)0x77E92CD9, (int32_t)0x2CC815EE, (int32_t)0x77E05F91, (int32_t)0x2CDFA071,
+    (int32_t)0x77D78DAA, (int32_t)0x2CF72939, (int32_t)0x77CEB725, (int32_t)0x2D0EB046,
+    (int32_t)0x77C5DC01, (int32_t)0x2D263596, (int32_t)0x77BCFC3F, (int32_t)0x2D3DB928,
+    (int32_t)0x77B417DF, (int32_t)0x2D553AFC, (int32_t)0x77AB2EE2, (int32_t)0x2D6CBB10,
+    (int32_t)0x77A24148, (int32_t)0x2D843964, (int32_t)0x77994F11, (int32_t)0x2D9BB5F6,
+    (int32_t)0x7790583E, (int32_t)0x2DB330C7, (int32_t)0x77875CCE, (int32_t)0x2DCAA9D5,
+    (int32_t)0x777E5CC3, (int32_t)0x2DE2211E, (int32_t)0x7775581D, (int32_t)0x2DF996A3,
+    (int32_t)0x776C4EDB, (int32_t)0x2E110A62, (int32_t)0x776340FF, (int32_t)0x2E287C5A,
+    (int32_t)0x775A2E89, (int32_t)0x2E3FEC8B, (int32_t)0x77511778, (int32_t)0x2E575AF3,
+    (int32_t)0x7747FBCE, (int32_t)0x2E6EC792, (int32_t)0x773EDB8B, (int32_t)0x2E863267,
+    (int32_t)0x7735B6AF, (int32_t)0x2E9D9B70, (int32_t)0x772C8D3A, (int32_t)0x2EB502AE,
+    (int32_t)0x77235F2D, (int32_t)0x2ECC681E, (int32_t)0x771A2C88, (int32_t)0x2EE3CBC1,
+    (int32_t)0x7710F54C, (int32_t)0x2EFB2D95, (int32_t)0x7707B979, (int32_t)0x2F128D99,
+    (int32_t)0x76FE790E, (int32_t)0x2F29EBCC, (int32_t)0x76F5340E, (int32_t)0x2F41482E,
+    (int32_t)0x76EBEA77, (int32_t)0x2F58A2BE, (int32_t)0x76E29C4B, (int32_t)0x2F6FFB7A,
+    (int32_t)0x76D94989, (int32_t)0x2F875262, (int32_t)0x76CFF232, (int32_t)0x2F9EA775,
+    (int32_t)0x76C69647, (int32_t)0x2FB5FAB2, (int32_t)0x76BD35C7, (int32_t)0x2FCD4C19,
+    (int32_t)0x76B3D0B4, (int32_t)0x2FE49BA7, (int32_t)0x76AA670D, (int32_t)0x2FFBE95D,
+    (int32_t)0x76A0F8D2, (int32_t)0x30133539, (int32_t)0x76978605, (int32_t)0x302A7F3A,
+    (int32_t)0x768E0EA6, (int32_t)0x3041C761, (int32_t)0x768492B4, (int32_t)0x30590DAB,
+    (int32_t)0x767B1231, (int32_t)0x30705217, (int32_t)0x76718D1C, (int32_t)0x308794A6,
+    (int32_t)0x76680376, (int32_t)0x309ED556, (int32_t)0x765E7540, (int32_t)0x30B61426,
+    (int32_t)0x7654E279, (int32_t)0x30CD5115, (int32_t)0x764B4B23, (int32_t)0x30E48C22,
+    (int32_t)0x7641AF3D, (int32_t)0x30FBC54D, (int32_t)0x76380EC8, (int32_t)0x3112FC95,
+    (int32_t)0x762E69C4, (int32_t)0x312A31F8, (int32_t)0x7624C031, (int32_t)0x31416576,
+    (int32_t)0x761B1211, (int32_t)0x3158970E, (int32_t)0x76115F63, (int32_t)0x316FC6BE,
+    (int32_t)0x7607A828, (int32_t)0x3186F487, (int32_t)0x75FDEC60, (int32_t)0x319E2067,
+    (int32_t)0x75F42C0B, (int32_t)0x31B54A5E, (int32_t)0x75EA672A, (int32_t)0x31CC7269,
+    (int32_t)0x75E09DBD, (int32_t)0x31E39889, (int32_t)0x75D6CFC5, (int32_t)0x31FABCBD,
+    (int32_t)0x75CCFD42, (int32_t)0x3211DF04, (int32_t)0x75C32634, (int32_t)0x3228FF5C,
+    (int32_t)0x75B94A9C, (int32_t)0x32401DC6, (int32_t)0x75AF6A7B, (int32_t)0x32573A3F,
+    (int32_t)0x75A585CF, (int32_t)0x326E54C7, (int32_t)0x759B9C9B, (int32_t)0x32856D5E,
+    (int32_t)0x7591AEDD, (int32_t)0x329C8402, (int32_t)0x7587BC98, (int32_t)0x32B398B3,
+    (int32_t)0x757DC5CA, (int32_t)0x32CAAB6F, (int32_t)0x7573CA75, (int32_t)0x32E1BC36,
+    (int32_t)0x7569CA99, (int32_t)0x32F8CB07, (int32_t)0x755FC635, (int32_t)0x330FD7E1,
+    (int32_t)0x7555BD4C, (int32_t)0x3326E2C3, (int32_t)0x754BAFDC, (int32_t)0x333DEBAB,
+    (int32_t)0x75419DE7, (int32_t)0x3354F29B, (int32_t)0x7537876C, (int32_t)0x336BF78F,
+    (int32_t)0x752D6C6C, (int32_t)0x3382FA88, (int32_t)0x75234CE8, (int32_t)0x3399FB85,
+    (int32_t)0x751928E0, (int32_t)0x33B0FA84, (int32_t)0x750F0054, (int32_t)0x33C7F785,
+    (int32_t)0x7504D345, (int32_t)0x33DEF287, (int32_t)0x74FAA1B3, (int32_t)0x33F5EB89,
+    (int32_t)0x74F06B9E, (int32_t)0x340CE28B, (int32_t)0x74E63108, (int32_t)0x3423D78A,
+    (int32_t)0x74DBF1EF, (int32_t)0x343ACA87, (int32_t)0x74D1AE55, (int32_t)0x3451BB81,
+    (int32_t)0x74C7663A, (int32_t)0x3468AA76, (int32_t)0x74BD199F, (int32_t)0x347F9766,
+    (int32_t)0x74B2C884, (int32_t)0x34968250, (int32_t)0x74A872E8, (int32_t)0x34AD6B32,
+    (int32_t)0x749E18CD, (int32_t)0x34C4520D, (int32_t)0x7493BA34, (int32_t)0x34DB36DF,
+    (int32_t)0x7489571C, (int32_t)0x34F219A8, (int32_t)0x747EEF85, (int32_t)0x3508FA66,
+    (int32_t)0x74748371, (int32_t)0x351FD918, (int32_t)0x746A12DF, (int32_t)0x3536B5BE,
+    (int32_t)0x745F9DD1, (int32_t)0x354D9057, (int32_t)0x74552446, (int32_t)0x356468E2,
+    (int32_t)0x744AA63F, (int32_t)0x357B3F5D, (int32_t)0x744023BC, (int32_t)0x359213C9,
+    (int32_t)0x74359CBD, (int32_t)0x35A8E625, (int32_t)0x742B1144, (int32_t)0x35BFB66E,
+    (int32_t)0x74208150, (int32_t)0x35D684A6, (int32_t)0x7415ECE2, (int32_t)0x35ED50C9,
+    (int32_t)0x740B53FB, (int32_t)0x36041AD9, (int32_t)0x7400B69A, (int32_t)0x361AE2D3,
+    (int32_t)0x73F614C0, (int32_t)0x3631A8B8, (int32_t)0x73EB6E6E, (int32_t)0x36486C86,
+    (int32_t)0x73E0C3A3, (int32_t)0x365F2E3B, (int32_t)0x73D61461, (int32_t)0x3675EDD9,
+    (int32_t)0x73CB60A8, (int32_t)0x368CAB5C, (int32_t)0x73C0A878, (int32_t)0x36A366C6,
+    (int32_t)0x73B5EBD1, (int32_t)0x36BA2014, (int32_t)0x73AB2AB4, (int32_t)0x36D0D746,
+    (int32_t)0x73A06522, (int32_t)0x36E78C5B, (int32_t)0x73959B1B, (int32_t)0x36FE3F52,
+    (int32_t)0x738ACC9E, (int32_t)0x3714F02A, (int32_t)0x737FF9AE, (int32_t)0x372B9EE3,
+    (int32_t)0x73752249, (int32_t)0x37424B7B, (int32_t)0x736A4671, (int32_t)0x3758F5F2,
+    (int32_t)0x735F6626, (int32_t)0x376F9E46, (int32_t)0x73548168, (int32_t)0x37864477,
+    (int32_t)0x73499838, (int32_t)0x379CE885, (int32_t)0x733EAA96, (int32_t)0x37B38A6D,
+    (int32_t)0x7333B883, (int32_t)0x37CA2A30, (int32_t)0x7328C1FF, (int32_t)0x37E0C7CC,
+    (int32_t)0x731DC70A, (int32_t)0x37F76341, (int32_t)0x7312C7A5, (int32_t)0x380DFC8D,
+    (int32_t)0x7307C3D0, (int32_t)0x382493B0, (int32_t)0x72FCBB8C, (int32_t)0x383B28A9,
+    (int32_t)0x72F1AED9, (int32_t)0x3851BB77, (int32_t)0x72E69DB7, (int32_t)0x38684C19,
+    (int32_t)0x72DB8828, (int32_t)0x387EDA8E, (int32_t)0x72D06E2B, (int32_t)0x389566D6,
+    (int32_t)0x72C54FC1, (int32_t)0x38ABF0EF, (int32_t)0x72BA2CEA, (int32_t)0x38C278D9,
+    (int32_t)0x72AF05A7, (int32_t)0x38D8FE93, (int32_t)0x72A3D9F7, (int32_t)0x38EF821C,
+    (int32_t)0x7298A9DD, (int32_t)0x39060373, (int32_t)0x728D7557, (int32_t)0x391C8297,
+    (int32_t)0x72823C67, (int32_t)0x3932FF87, (int32_t)0x7276FF0D, (int32_t)0x39497A43,
+    (int32_t)0x726BBD48, (int32_t)0x395FF2C9, (int32_t)0x7260771B, (int32_t)0x39766919,
+    (int32_t)0x72552C85, (int32_t)0x398CDD32, (int32_t)0x7249DD86, (int32_t)0x39A34F13,
+    (int32_t)0x723E8A20, (int32_t)0x39B9BEBC, (int32_t)0x72333251, (int32_t)0x39D02C2A,
+    (int32_t)0x7227D61C, (int32_t)0x39E6975E, (int32_t)0x721C7580, (int32_t)0x39FD0056,
+    (int32_t)0x7211107E, (int32_t)0x3A136712, (int32_t)0x7205A716, (int32_t)0x3A29CB91,
+    (int32_t)0x71FA3949, (int32_t)0x3A402DD2, (int32_t)0x71EEC716, (int32_t)0x3A568DD4,
+    (int32_t)0x71E35080, (int32_t)0x3A6CEB96, (int32_t)0x71D7D585, (int32_t)0x3A834717,
+    (int32_t)0x71CC5626, (int32_t)0x3A99A057, (int32_t)0x71C0D265, (int32_t)0x3AAFF755,
+    (int32_t)0x71B54A41, (int32_t)0x3AC64C0F, (int32_t)0x71A9BDBA, (int32_t)0x3ADC9E86,
+    (int32_t)0x719E2CD2, (int32_t)0x3AF2EEB7, (int32_t)0x71929789, (int32_t)0x3B093CA3,
+    (int32_t)0x7186FDDE, (int32_t)0x3B1F8848, (int32_t)0x717B5FD3, (int32_t)0x3B35D1A5,
+    (int32_t)0x716FBD68, (int32_t)0x3B4C18BA, (int32_t)0x7164169D, (int32_t)0x3B625D86,
+    (int32_t)0x71586B74, (int32_t)0x3B78A007, (int32_t)0x714CBBEB, (int32_t)0x3B8EE03E,
+    (int32_t)0x71410805, (int32_t)0x3BA51E29, (int32_t)0x71354FC0, (int32_t)0x3BBB59C7,
+    (int32_t)0x7129931F, (int32_t)0x3BD19318, (int32_t)0x711DD220, (int32_t)0x3BE7CA1A,
+    (int32_t)0x71120CC5, (int32_t)0x3BFDFECD, (int32_t)0x7106430E, (int32_t)0x3C143130,
+    (int32_t)0x70FA74FC, (int32_t)0x3C2A6142, (int32_t)0x70EEA28E, (int32_t)0x3C408F03,
+    (int32_t)0x70E2CBC6, (int32_t)0x3C56BA70, (int32_t)0x70D6F0A4, (int32_t)0x3C6CE38A,
+    (int32_t)0x70CB1128, (int32_t)0x3C830A50, (int32_t)0x70BF2D53, (int32_t)0x3C992EC0,
+    (int32_t)0x70B34525, (int32_t)0x3CAF50DA, (int32_t)0x70A7589F, (int32_t)0x3CC5709E,
+    (int32_t)0x709B67C0, (int32_t)0x3CDB8E09, (int32_t)0x708F728B, (int32_t)0x3CF1A91C,
+    (int32_t)0x708378FF, (int32_t)0x3D07C1D6, (int32_t)0x70777B1C, (int32_t)0x3D1DD835,
+    (int32_t)0x706B78E3, (int32_t)0x3D33EC39, (int32_t)0x705F7255, (int32_t)0x3D49FDE1,
+    (int32_t)0x70536771, (int32_t)0x3D600D2C, (int32_t)0x70475839, (int32_t)0x3D761A19,
+    (int32_t)0x703B44AD, (int32_t)0x3D8C24A8, (int32_t)0x702F2CCD, (int32_t)0x3DA22CD7,
+    (int32_t)0x7023109A, (int32_t)0x3DB832A6, (int32_t)0x7016F014, (int32_t)0x3DCE3614,
+    (int32_t)0x700ACB3C, (int32_t)0x3DE4371F, (int32_t)0x6FFEA212, (int32_t)0x3DFA35C8,
+    (int32_t)0x6FF27497, (int32_t)0x3E10320D, (int32_t)0x6FE642CA, (int32_t)0x3E262BEE,
+    (int32_t)0x6FDA0CAE, (int32_t)0x3E3C2369, (int32_t)0x6FCDD241, (int32_t)0x3E52187F,
+    (int32_t)0x6FC19385, (int32_t)0x3E680B2C, (int32_t)0x6FB5507A, (int32_t)0x3E7DFB73,
+    (int32_t)0x6FA90921, (int32_t)0x3E93E950, (int32_t)0x6F9CBD79, (int32_t)0x3EA9D4C3,
+    (int32_t)0x6F906D84, (int32_t)0x3EBFBDCD, (int32_t)0x6F841942, (int32_t)0x3ED5A46B,
+    (int32_t)0x6F77C0B3, (int32_t)0x3EEB889C, (int32_t)0x6F6B63D8, (int32_t)0x3F016A61,
+    (int32_t)0x6F5F02B2, (int32_t)0x3F1749B8, (int32_t)0x6F529D40, (int32_t)0x3F2D26A0,
+    (int32_t)0x6F463383, (int32_t)0x3F430119, (int32_t)0x6F39C57D, (int32_t)0x3F58D921,
+    (int32_t)0x6F2D532C, (int32_t)0x3F6EAEB8, (int32_t)0x6F20DC92, (int32_t)0x3F8481DD,
+    (int32_t)0x6F1461B0, (int32_t)0x3F9A5290, (int32_t)0x6F07E285, (int32_t)0x3FB020CE,
+    (int32_t)0x6EFB5F12, (int32_t)0x3FC5EC98, (int32_t)0x6EEED758, (int32_t)0x3FDBB5EC,
+    (int32_t)0x6EE24B57, (int32_t)0x3FF17CCA, (int32_t)0x6ED5BB10, (int32_t)0x40074132,
+    (int32_t)0x6EC92683, (int32_t)0x401D0321, (int32_t)0x6EBC8DB0, (int32_t)0x4032C297,
+    (int32_t)0x6EAFF099, (int32_t)0x40487F94, (int32_t)0x6EA34F3D, (int32_t)0x405E3A16,
+    (int32_t)0x6E96A99D, (int32_t)0x4073F21D, (int32_t)0x6E89FFB9, (int32_t)0x4089A7A8,
+    (int32_t)0x6E7D5193, (int32_t)0x409F5AB6, (int32_t)0x6E709F2A, (int32_t)0x40B50B46,
+    (int32_t)0x6E63E87F, (int32_t)0x40CAB958, (int32_t)0x6E572D93, (int32_t)0x40E064EA,
+    (int32_t)0x6E4A6E66, (int32_t)0x40F60DFB, (int32_t)0x6E3DAAF8, (int32_t)0x410BB48C,
+    (int32_t)0x6E30E34A, (int32_t)0x4121589B, (int32_t)0x6E24175C, (int32_t)0x4136FA27,
+    (int32_t)0x6E174730, (int32_t)0x414C992F, (int32_t)0x6E0A72C5, (int32_t)0x416235B2,
+    (int32_t)0x6DFD9A1C, (int32_t)0x4177CFB1, (int32_t)0x6DF0BD35, (int32_t)0x418D6729,
+    (int32_t)0x6DE3DC11, (int32_t)0x41A2FC1A, (int32_t)0x6DD6F6B1, (int32_t)0x41B88E84,
+    (int32_t)0x6DCA0D14, (int32_t)0x41CE1E65, (int32_t)0x6DBD1F3C, (int32_t)0x41E3ABBC,
+    (int32_t)0x6DB02D29, (int32_t)0x41F93689, (int32_t)0x6DA336DC, (int32_t)0x420EBECB,
+    (int32_t)0x6D963C54, (int32_t)0x42244481, (int32_t)0x6D893D93, (int32_t)0x4239C7AA,
+    (int32_t)0x6D7C3A98, (int32_t)0x424F4845, (int32_t)0x6D6F3365, (int32_t)0x4264C653,
+    (int32_t)0x6D6227FA, (int32_t)0x427A41D0, (int32_t)0x6D551858, (int32_t)0x428FBABE,
+    (int32_t)0x6D48047E, (int32_t)0x42A5311B, (int32_t)0x6D3AEC6E, (int32_t)0x42BAA4E6,
+    (int32_t)0x6D2DD027, (int32_t)0x42D0161E, (int32_t)0x6D20AFAC, (int32_t)0x42E584C3,
+    (int32_t)0x6D138AFB, (int32_t)0x42FAF0D4, (int32_t)0x6D066215, (int32_t)0x43105A50,
+    (int32_t)0x6CF934FC, (int32_t)0x4325C135, (int32_t)0x6CEC03AF, (int32_t)0x433B2585,
+    (int32_t)0x6CDECE2F, (int32_t)0x4350873C, (int32_t)0x6CD1947C, (int32_t)0x4365E65B,
+    (int32_t)0x6CC45698, (int32_t)0x437B42E1, (int32_t)0x6CB71482, (int32_t)0x43909CCD,
+    (int32_t)0x6CA9CE3B, (int32_t)0x43A5F41E, (int32_t)0x6C9C83C3, (int32_t)0x43BB48D4,
+    (int32_t)0x6C8F351C, (int32_t)0x43D09AED, (int32_t)0x6C81E245, (int32_t)0x43E5EA68,
+    (int32_t)0x6C748B3F, (int32_t)0x43FB3746, (int32_t)0x6C67300B, (int32_t)0x44108184,
+    (int32_t)0x6C59D0A9, (int32_t)0x4425C923, (int32_t)0x6C4C6D1A, (int32_t)0x443B0E21,
+    (int32_t)0x6C3F055D, (int32_t)0x4450507E, (int32_t)0x6C319975, (int32_t)0x44659039,
+    (int32_t)0x6C242960, (int32_t)0x447ACD50, (int32_t)0x6C16B521, (int32_t)0x449007C4,
+    (int32_t)0x6C093CB6, (int32_t)0x44A53F93, (int32_t)0x6BFBC021, (int32_t)0x44BA74BD,
+    (int32_t)0x6BEE3F62, (int32_t)0x44CFA740, (int32_t)0x6BE0BA7B, (int32_t)0x44E4D71C,
+    (int32_t)0x6BD3316A, (int32_t)0x44FA0450, (int32_t)0x6BC5A431, (int32_t)0x450F2EDB,
+    (int32_t)0x6BB812D1, (int32_t)0x452456BD, (int32_t)0x6BAA7D49, (int32_t)0x45397BF4,
+    (int32_t)0x6B9CE39B, (int32_t)0x454E9E80, (int32_t)0x6B8F45C7, (int32_t)0x4563BE60,
+    (int32_t)0x6B81A3CD, (int32_t)0x4578DB93, (int32_t)0x6B73FDAE, (int32_t)0x458DF619,
+    (int32_t)0x6B66536B, (int32_t)0x45A30DF0, (int32_t)0x6B58A503, (int32_t)0x45B82318,
+    (int32_t)0x6B4AF279, (int32_t)0x45CD358F, (int32_t)0x6B3D3BCB, (int32_t)0x45E24556,
+    (int32_t)0x6B2F80FB, (int32_t)0x45F7526B, (int32_t)0x6B21C208, (int32_t)0x460C5CCE,
+    (int32_t)0x6B13FEF5, (int32_t)0x4621647D, (int32_t)0x6B0637C1, (int32_t)0x46366978,
+    (int32_t)0x6AF86C6C, (int32_t)0x464B6BBE, (int32_t)0x6AEA9CF8, (int32_t)0x46606B4E,
+    (int32_t)0x6ADCC964, (int32_t)0x46756828, (int32_t)0x6ACEF1B2, (int32_t)0x468A624A,
+    (int32_t)0x6AC115E2, (int32_t)0x469F59B4, (int32_t)0x6AB335F4, (int32_t)0x46B44E65,
+    (int32_t)0x6AA551E9, (int32_t)0x46C9405C, (int32_t)0x6A9769C1, (int32_t)0x46DE2F99,
+    (int32_t)0x6A897D7D, (int32_t)0x46F31C1A, (int32_t)0x6A7B8D1E, (int32_t)0x470805DF,
+    (int32_t)0x6A6D98A4, (int32_t)0x471CECE7, (int32_t)0x6A5FA010, (int32_t)0x4731D131,
+    (int32_t)0x6A51A361, (int32_t)0x4746B2BC, (int32_t)0x6A43A29A, (int32_t)0x475B9188,
+    (int32_t)0x6A359DB9, (int32_t)0x47706D93, (int32_t)0x6A2794C1, (int32_t)0x478546DE,
+    (int32_t)0x6A1987B0, (int32_t)0x479A1D67, (int32_t)0x6A0B7689, (int32_t)0x47AEF12C,
+    (int32_t)0x69FD614A, (int32_t)0x47C3C22F, (int32_t)0x69EF47F6, (int32_t)0x47D8906D,
+    (int32_t)0x69E12A8C, (int32_t)0x47ED5BE6, (int32_t)0x69D3090E, (int32_t)0x48022499,
+    (int32_t)0x69C4E37A, (int32_t)0x4816EA86, (int32_t)0x69B6B9D3, (int32_t)0x482BADAB,
+    (int32_t)0x69A88C19, (int32_t)0x48406E08, (int32_t)0x699A5A4C, (int32_t)0x48552B9B,
+    (int32_t)0x698C246C, (int32_t)0x4869E665, (int32_t)0x697DEA7B, (int32_t)0x487E9E64,
+    (int32_t)0x696FAC78, (int32_t)0x48935397, (int32_t)0x69616A65, (int32_t)0x48A805FF,
+    (int32_t)0x69532442, (int32_t)0x48BCB599, (int32_t)0x6944DA10, (int32_t)0x48D16265,
+    (int32_t)0x69368BCE, (int32_t)0x48E60C62, (int32_t)0x6928397E, (int32_t)0x48FAB391,
+    (int32_t)0x6919E320, (int32_t)0x490F57EE, (int32_t)0x690B88B5, (int32_t)0x4923F97B,
+    (int32_t)0x68FD2A3D, (int32_t)0x49389836, (int32_t)0x68EEC7B9, (int32_t)0x494D341E,
+    (int32_t)0x68E06129, (int32_t)0x4961CD33, (int32_t)0x68D1F68F, (int32_t)0x49766373,
+    (int32_t)0x68C387E9, (int32_t)0x498AF6DF, (int32_t)0x68B5153A, (int32_t)0x499F8774,
+    (int32_t)0x68A69E81, (int32_t)0x49B41533, (int32_t)0x689823BF, (int32_t)0x49C8A01B,
+    (int32_t)0x6889A4F6, (int32_t)0x49DD282A, (int32_t)0x687B2224, (int32_t)0x49F1AD61,
+    (int32_t)0x686C9B4B, (int32_t)0x4A062FBD, (int32_t)0x685E106C, (int32_t)0x4A1AAF3F,
+    (int32_t)0x684F8186, (int32_t)0x4A2F2BE6, (int32_t)0x6840EE9B, (int32_t)0x4A43A5B0,
+    (int32_t)0x683257AB, (int32_t)0x4A581C9E, (int32_t)0x6823BCB7, (int32_t)0x4A6C90AD,
+    (int32_t)0x68151DBE, (int32_t)0x4A8101DE, (int32_t)0x68067AC3, (int32_t)0x4A957030,
+    (int32_t)0x67F7D3C5, (int32_t)0x4AA9DBA2, (int32_t)0x67E928C5, (int32_t)0x4ABE4433,
+    (int32_t)0x67DA79C3, (int32_t)0x4AD2A9E2, (int32_t)0x67CBC6C0, (int32_t)0x4AE70CAF,
+    (int32_t)0x67BD0FBD, (int32_t)0x4AFB6C98, (int32_t)0x67AE54BA, (int32_t)0x4B0FC99D,
+    (int32_t)0x679F95B7, (int32_t)0x4B2423BE, (int32_t)0x6790D2B6, (int32_t)0x4B387AF9,
+    (int32_t)0x67820BB7, (int32_t)0x4B4CCF4D, (int32_t)0x677340BA, (int32_t)0x4B6120BB,
+    (int32_t)0x676471C0, (int32_t)0x4B756F40, (int32_t)0x67559ECA, (int32_t)0x4B89BADD,
+    (int32_t)0x6746C7D8, (int32_t)0x4B9E0390, (int32_t)0x6737ECEA, (int32_t)0x4BB24958,
+    (int32_t)0x67290E02, (int32_t)0x4BC68C36, (int32_t)0x671A2B20, (int32_t)0x4BDACC28,
+    (int32_t)0x670B4444, (int32_t)0x4BEF092D, (int32_t)0x66FC596F, (int32_t)0x4C034345,
+    (int32_t)0x66ED6AA1, (int32_t)0x4C177A6E, (int32_t)0x66DE77DC, (int32_t)0x4C2BAEA9,
+    (int32_t)0x66CF8120, (int32_t)0x4C3FDFF4, (int32_t)0x66C0866D, (int32_t)0x4C540E4E,
+    (int32_t)0x66B187C3, (int32_t)0x4C6839B7, (int32_t)0x66A28524, (int32_t)0x4C7C622D,
+    (int32_t)0x66937E91, (int32_t)0x4C9087B1, (int32_t)0x66847408, (int32_t)0x4CA4AA41,
+    (int32_t)0x6675658C, (int32_t)0x4CB8C9DD, (int32_t)0x6666531D, (int32_t)0x4CCCE684,
+    (int32_t)0x66573CBB, (int32_t)0x4CE10034, (int32_t)0x66482267, (int32_t)0x4CF516EE,
+    (int32_t)0x66390422, (int32_t)0x4D092AB0, (int32_t)0x6629E1EC, (int32_t)0x4D1D3B7A,
+    (int32_t)0x661ABBC5, (int32_t)0x4D31494B, (int32_t)0x660B91AF, (int32_t)0x4D455422,
+    (int32_t)0x65FC63A9, (int32_t)0x4D595BFE, (int32_t)0x65ED31B5, (int32_t)0x4D6D60DF,
+    (int32_t)0x65DDFBD3, (int32_t)0x4D8162C4, (int32_t)0x65CEC204, (int32_t)0x4D9561AC,
+    (int32_t)0x65BF8447, (int32_t)0x4DA95D96, (int32_t)0x65B0429F, (int32_t)0x4DBD5682,
+    (int32_t)0x65A0FD0B, (int32_t)0x4DD14C6E, (int32_t)0x6591B38C, (int32_t)0x4DE53F5A,
+    (int32_t)0x65826622, (int32_t)0x4DF92F46, (int32_t)0x657314CF, (int32_t)0x4E0D1C30,
+    (int32_t)0x6563BF92, (int32_t)0x4E210617, (int32_t)0x6554666D, (int32_t)0x4E34ECFC,
+    (int32_t)0x6545095F, (int32_t)0x4E48D0DD, (int32_t)0x6535A86B, (int32_t)0x4E5CB1B9,
+    (int32_t)0x6526438F, (int32_t)0x4E708F8F, (int32_t)0x6516DACD, (int32_t)0x4E846A60,
+    (int32_t)0x65076E25, (int32_t)0x4E984229, (int32_t)0x64F7FD98, (int32_t)0x4EAC16EB,
+    (int32_t)0x64E88926, (int32_t)0x4EBFE8A5, (int32_t)0x64D910D1, (int32_t)0x4ED3B755,
+    (int32_t)0x64C99498, (int32_t)0x4EE782FB, (int32_t)0x64BA147D, (int32_t)0x4EFB4B96,
+    (int32_t)0x64AA907F, (int32_t)0x4F0F1126, (int32_t)0x649B08A0, (int32_t)0x4F22D3AA,
+    (int32_t)0x648B7CE0, (int32_t)0x4F369320, (int32_t)0x647BED3F, (int32_t)0x4F4A4F89,
+    (int32_t)0x646C59BF, (int32_t)0x4F5E08E3, (int32_t)0x645CC260, (int32_t)0x4F71BF2E,
+    (int32_t)0x644D2722, (int32_t)0x4F857269, (int32_t)0x643D8806, (int32_t)0x4F992293,
+    (int32_t)0x642DE50D, (int32_t)0x4FACCFAB, (int32_t)0x641E3E38, (int32_t)0x4FC079B1,
+    (int32_t)0x640E9386, (int32_t)0x4FD420A4, (int32_t)0x63FEE4F8, (int32_t)0x4FE7C483,
+    (int32_t)0x63EF3290, (int32_t)0x4FFB654D, (int32_t)0x63DF7C4D, (int32_t)0x500F0302,
+    (int32_t)0x63CFC231, (int32_t)0x50229DA1, (int32_t)0x63C0043B, (int32_t)0x50363529,
+    (int32_t)0x63B0426D, (int32_t)0x5049C999, (int32_t)0x63A07CC7, (int32_t)0x505D5AF1,
+    (int32_t)0x6390B34A, (int32_t)0x5070E92F, (int32_t)0x6380E5F6, (int32_t)0x50847454,
+    (int32_t)0x637114CC, (int32_t)0x5097FC5E, (int32_t)0x63613FCD, (int32_t)0x50AB814D,
+    (int32_t)0x635166F9, (int32_t)0x50BF031F, (int32_t)0x63418A50, (int32_t)0x50D281D5,
+    (int32_t)0x6331A9D4, (int32_t)0x50E5FD6D, (int32_t)0x6321C585, (int32_t)0x50F975E6,
+    (int32_t)0x6311DD64, (int32_t)0x510CEB40, (int32_t)0x6301F171, (int32_t)0x51205D7B,
+    (int32_t)0x62F201AC, (int32_t)0x5133CC94, (int32_t)0x62E20E17, (int32_t)0x5147388C,
+    (int32_t)0x62D216B3, (int32_t)0x515AA162, (int32_t)0x62C21B7E, (int32_t)0x516E0715,
+    (int32_t)0x62B21C7B, (int32_t)0x518169A5, (int32_t)0x62A219AA, (int32_t)0x5194C910,
+    (int32_t)0x6292130C, (int32_t)0x51A82555, (int32_t)0x628208A1, (int32_t)0x51BB7E75,
+    (int32_t)0x6271FA69, (int32_t)0x51CED46E, (int32_t)0x6261E866, (int32_t)0x51E22740,
+    (int32_t)0x6251D298, (int32_t)0x51F576EA, (int32_t)0x6241B8FF, (int32_t)0x5208C36A,
+    (int32_t)0x62319B9D, (int32_t)0x521C0CC2, (int32_t)0x62217A72, (int32_t)0x522F52EE,
+    (int32_t)0x6211557E, (int32_t)0x524295F0, (int32_t)0x62012CC2, (int32_t)0x5255D5C5,
+    (int32_t)0x61F1003F, (int32_t)0x5269126E, (int32_t)0x61E0CFF5, (int32_t)0x527C4BEA,
+    (int32_t)0x61D09BE5, (int32_t)0x528F8238, (int32_t)0x61C06410, (int32_t)0x52A2B556,
+    (int32_t)0x61B02876, (int32_t)0x52B5E546, (int32_t)0x619FE918, (int32_t)0x52C91204,
+    (int32_t)0x618FA5F7, (int32_t)0x52DC3B92, (int32_t)0x617F5F12, (int32_t)0x52EF61EE,
+    (int32_t)0x616F146C, (int32_t)0x53028518, (int32_t)0x615EC603, (int32_t)0x5315A50E,
+    (int32_t)0x614E73DA, (int32_t)0x5328C1D0, (int32_t)0x613E1DF0, (int32_t)0x533BDB5D,
+    (int32_t)0x612DC447, (int32_t)0x534EF1B5, (int32_t)0x611D66DE, (int32_t)0x536204D7,
+    (int32_t)0x610D05B7, (int32_t)0x537514C2, (int32_t)0x60FCA0D2, (int32_t)0x53882175,
+    (int32_t)0x60EC3830, (int32_t)0x539B2AF0, (int32_t)0x60DBCBD1, (int32_t)0x53AE3131,
+    (int32_t)0x60CB5BB7, (int32_t)0x53C13439, (int32_t)0x60BAE7E1, (int32_t)0x53D43406,
+    (int32_t)0x60AA7050, (int32_t)0x53E73097, (int32_t)0x6099F505, (int32_t)0x53FA29ED,
+    (int32_t)0x60897601, (int32_t)0x540D2005, (int32_t)0x6078F344, (int32_t)0x542012E1,
+    (int32_t)0x60686CCF, (int32_t)0x5433027D, (int32_t)0x6057E2A2, (int32_t)0x5445EEDB,
+    (int32_t)0x604754BF, (int32_t)0x5458D7F9, (int32_t)0x6036C325, (int32_t)0x546BBDD7,
+    (int32_t)0x60262DD6, (int32_t)0x547EA073, (int32_t)0x601594D1, (int32_t)0x54917FCE,
+    (int32_t)0x6004F819, (int32_t)0x54A45BE6, (int32_t)0x5FF457AD, (int32_t)0x54B734BA,
+    (int32_t)0x5FE3B38D, (int32_t)0x54CA0A4B, (int32_t)0x5FD30BBC, (int32_t)0x54DCDC96,
+    (int32_t)0x5FC26038, (int32_t)0x54EFAB9C, (int32_t)0x5FB1B104, (int32_t)0x5502775C,
+    (int32_t)0x5FA0FE1F, (int32_t)0x55153FD4, (int32_t)0x5F90478A, (int32_t)0x55280505,
+    (int32_t)0x5F7F8D46, (int32_t)0x553AC6EE, (int32_t)0x5F6ECF53, (int32_t)0x554D858D,
+    (int32_t)0x5F5E0DB3, (int32_t)0x556040E2, (int32_t)0x5F4D4865, (int32_t)0x5572F8ED,
+    (int32_t)0x5F3C7F6B, (int32_t)0x5585ADAD, (int32_t)0x5F2BB2C5, (int32_t)0x55985F20,
+    (int32_t)0x5F1AE274, (int32_t)0x55AB0D46, (int32_t)0x5F0A0E77, (int32_t)0x55BDB81F,
+    (int32_t)0x5EF936D1, (int32_t)0x55D05FAA, (int32_t)0x5EE85B82, (int32_t)0x55E303E6,
+    (int32_t)0x5ED77C8A, (int32_t)0x55F5A4D2, (int32_t)0x5EC699E9, (int32_t)0x5608426E,
+    (int32_t)0x5EB5B3A2, (int32_t)0x561ADCB9, (int32_t)0x5EA4C9B3, (int32_t)0x562D73B2,
+    (int32_t)0x5E93DC1F, (int32_t)0x56400758, (int32_t)0x5E82EAE5, (int32_t)0x565297AB,
+    (int32_t)0x5E71F606, (int32_t)0x566524AA, (int32_t)0x5E60FD84, (int32_t)0x5677AE54,
+    (int32_t)0x5E50015D, (int32_t)0x568A34A9, (int32_t)0x5E3F0194, (int32_t)0x569CB7A8,
+    (int32_t)0x5E2DFE29, (int32_t)0x56AF3750, (int32_t)0x5E1CF71C, (int32_t)0x56C1B3A1,
+    (int32_t)0x5E0BEC6E, (int32_t)0x56D42C99, (int32_t)0x5DFADE20, (int32_t)0x56E6A239,
+    (int32_t)0x5DE9CC33, (int32_t)0x56F9147E, (int32_t)0x5DD8B6A7, (int32_t)0x570B8369,
+    (int32_t)0x5DC79D7C, (int32_t)0x571DEEFA, (int32_t)0x5DB680B4, (int32_t)0x5730572E,
+    (int32_t)0x5DA5604F, (int32_t)0x5742BC06, (int32_t)0x5D943C4E, (int32_t)0x57551D80,
+    (int32_t)0x5D8314B1, (int32_t)0x57677B9D, (int32_t)0x5D71E979, (int32_t)0x5779D65B,
+    (int32_t)0x5D60BAA7, (int32_t)0x578C2DBA, (int32_t)0x5D4F883B, (int32_t)0x579E81B8,
+    (int32_t)0x5D3E5237, (int32_t)0x57B0D256, (int32_t)0x5D2D189A, (int32_t)0x57C31F92,
+    (int32_t)0x5D1BDB65, (int32_t)0x57D5696D, (int32_t)0x5D0A9A9A, (int32_t)0x57E7AFE4,
+    (int32_t)0x5CF95638, (int32_t)0x57F9F2F8, (int32_t)0x5CE80E41, (int32_t)0x580C32A7,
+    (int32_t)0x5CD6C2B5, (int32_t)0x581E6EF1, (int32_t)0x5CC57394, (int32_t)0x5830A7D6,
+    (int32_t)0x5CB420E0, (int32_t)0x5842DD54, (int32_t)0x5CA2CA99, (int32_t)0x58550F6C,
+    (int32_t)0x5C9170BF, (int32_t)0x58673E1B, (int32_t)0x5C801354, (int32_t)0x58796962,
+    (int32_t)0x5C6EB258, (int32_t)0x588B9140, (int32_t)0x5C5D4DCC, (int32_t)0x589DB5B3,
+    (int32_t)0x5C4BE5B0, (int32_t)0x58AFD6BD, (int32_t)0x5C3A7A05, (int32_t)0x58C1F45B,
+    (int32_t)0x5C290ACC, (int32_t)0x58D40E8C, (int32_t)0x5C179806, (int32_t)0x58E62552,
+    (int32_t)0x5C0621B2, (int32_t)0x58F838A9, (int32_t)0x5BF4A7D2, (int32_t)0x590A4893,
+    (int32_t)0x5BE32A67, (int32_t)0x591C550E, (int32_t)0x5BD1A971, (int32_t)0x592E5E19,
+    (int32_t)0x5BC024F0, (int32_t)0x594063B5, (int32_t)0x5BAE9CE7, (int32_t)0x595265DF,
+    (int32_t)0x5B9D1154, (int32_t)0x59646498, (int32_t)0x5B8B8239, (int32_t)0x59765FDE,
+    (int32_t)0x5B79EF96, (int32_t)0x598857B2, (int32_t)0x5B68596D, (int32_t)0x599A4C12,
+    (int32_t)0x5B56BFBD, (int32_t)0x59AC3CFD, (int32_t)0x5B452288, (int32_t)0x59BE2A74,
+    (int32_t)0x5B3381CE, (int32_t)0x59D01475, (int32_t)0x5B21DD90, (int32_t)0x59E1FAFF,
+    (int32_t)0x5B1035CF, (int32_t)0x59F3DE12, (int32_t)0x5AFE8A8B, (int32_t)0x5A05BDAE,
+    (int32_t)0x5AECDBC5, (int32_t)0x5A1799D1, (int32_t)0x5ADB297D, (int32_t)0x5A29727B,
+    (int32_t)0x5AC973B5, (int32_t)0x5A3B47AB, (int32_t)0x5AB7BA6C, (int32_t)0x5A4D1960,
+    (int32_t)0x5AA5FDA5, (int32_t)0x5A5EE79A, (int32_t)0x5A943D5E, (int32_t)0x5A70B258,
+    (int32_t)0x5A82799A, (int32_t)0x5A82799A, (int32_t)0x5A70B258, (int32_t)0x5A943D5E,
+    (int32_t)0x5A5EE79A, (int32_t)0x5AA5FDA5, (int32_t)0x5A4D1960, (int32_t)0x5AB7BA6C,
+    (int32_t)0x5A3B47AB, (int32_t)0x5AC973B5, (int32_t)0x5A29727B, (int32_t)0x5ADB297D,
+    (int32_t)0x5A1799D1, (int32_t)0x5AECDBC5, (int32_t)0x5A05BDAE, (int32_t)0x5AFE8A8B,
+    (int32_t)0x59F3DE12, (int32_t)0x5B1035CF, (int32_t)0x59E1FAFF, (int32_t)0x5B21DD90,
+    (int32_t)0x59D01475, (int32_t)0x5B3381CE, (int32_t)0x59BE2A74, (int32_t)0x5B452288,
+    (int32_t)0x59AC3CFD, (int32_t)0x5B56BFBD, (int32_t)0x599A4C12, (int32_t)0x5B68596D,
+    (int32_t)0x598857B2, (int32_t)0x5B79EF96, (int32_t)0x59765FDE, (int32_t)0x5B8B8239,
+    (int32_t)0x59646498, (int32_t)0x5B9D1154, (int32_t)0x595265DF, (int32_t)0x5BAE9CE7,
+    (int32_t)0x594063B5, (int32_t)0x5BC024F0, (int32_t)0x592E5E19, (int32_t)0x5BD1A971,
+    (int32_t)0x591C550E, (int32_t)0x5BE32A67, (int32_t)0x590A4893, (int32_t)0x5BF4A7D2,
+    (int32_t)0x58F838A9, (int32_t)0x5C0621B2, (int32_t)0x58E62552, (int32_t)0x5C179806,
+    (int32_t)0x58D40E8C, (int32_t)0x5C290ACC, (int32_t)0x58C1F45B, (int32_t)0x5C3A7A05,
+    (int32_t)0x58AFD6BD, (int32_t)0x5C4BE5B0, (int32_t)0x589DB5B3, (int32_t)0x5C5D4DCC,
+    (int32_t)0x588B9140, (int32_t)0x5C6EB258, (int32_t)0x58796962, (int32_t)0x5C801354,
+    (int32_t)0x58673E1B, (int32_t)0x5C9170BF, (int32_t)0x58550F6C, (int32_t)0x5CA2CA99,
+    (int32_t)0x5842DD54, (int32_t)0x5CB420E0, (int32_t)0x5830A7D6, (int32_t)0x5CC57394,
+    (int32_t)0x581E6EF1, (int32_t)0x5CD6C2B5, (int32_t)0x580C32A7, (int32_t)0x5CE80E41,
+    (int32_t)0x57F9F2F8, (int32_t)0x5CF95638, (int32_t)0x57E7AFE4, (int32_t)0x5D0A9A9A,
+    (int32_t)0x57D5696D, (int32_t)0x5D1BDB65, (int32_t)0x57C31F92, (int32_t)0x5D2D189A,
+    (int32_t)0x57B0D256, (int32_t)0x5D3E5237, (int32_t)0x579E81B8, (int32_t)0x5D4F883B,
+    (int32_t)0x578C2DBA, (int32_t)0x5D60BAA7, (int32_t)0x5779D65B, (int32_t)0x5D71E979,
+    (int32_t)0x57677B9D, (int32_t)0x5D8314B1, (int32_t)0x57551D80, (int32_t)0x5D943C4E,
+    (int32_t)0x5742BC06, (int32_t)0x5DA5604F, (int32_t)0x5730572E, (int32_t)0x5DB680B4,
+    (int32_t)0x571DEEFA, (int32_t)0x5DC79D7C, (int32_t)0x570B8369, (int32_t)0x5DD8B6A7,
+    (int32_t)0x56F9147E, (int32_t)0x5DE9CC33, (int32_t)0x56E6A239, (int32_t)0x5DFADE20,
+    (int32_t)0x56D42C99, (int32_t)0x5E0BEC6E, (int32_t)0x56C1B3A1, (int32_t)0x5E1CF71C,
+    (int32_t)0x56AF3750, (int32_t)0x5E2DFE29, (int32_t)0x569CB7A8, (int32_t)0x5E3F0194,
+    (int32_t)0x568A34A9, (int32_t)0x5E50015D, (int32_t)0x5677AE54, (int32_t)0x5E60FD84,
+    (int32_t)0x566524AA, (int32_t)0x5E71F606, (int32_t)0x565297AB, (int32_t)0x5E82EAE5,
+    (int32_t)0x56400758, (int32_t)0x5E93DC1F, (int32_t)0x562D73B2, (int32_t)0x5EA4C9B3,
+    (int32_t)0x561ADCB9, (int32_t)0x5EB5B3A2, (int32_t)0x5608426E, (int32_t)0x5EC699E9,
+    (int32_t)0x55F5A4D2, (int32_t)0x5ED77C8A, (int32_t)0x55E303E6, (int32_t)0x5EE85B82,
+    (int32_t)0x55D05FAA, (int32_t)0x5EF936D1, (int32_t)0x55BDB81F, (int32_t)0x5F0A0E77,
+    (int32_t)0x55AB0D46, (int32_t)0x5F1AE274, (int32_t)0x55985F20, (int32_t)0x5F2BB2C5,
+    (int32_t)0x5585ADAD, (int32_t)0x5F3C7F6B, (int32_t)0x5572F8ED, (int32_t)0x5F4D4865,
+    (int32_t)0x556040E2, (int32_t)0x5F5E0DB3, (int32_t)0x554D858D, (int32_t)0x5F6ECF53,
+    (int32_t)0x553AC6EE, (int32_t)0x5F7F8D46, (int32_t)0x55280505, (int32_t)0x5F90478A,
+    (int32_t)0x55153FD4, (int32_t)0x5FA0FE1F, (int32_t)0x5502775C, (int32_t)0x5FB1B104,
+    (int32_t)0x54EFAB9C, (int32_t)0x5FC26038, (int32_t)0x54DCDC96, (int32_t)0x5FD30BBC,
+    (int32_t)0x54CA0A4B, (int32_t)0x5FE3B38D, (int32_t)0x54B734BA, (int32_t)0x5FF457AD,
+    (int32_t)0x54A45BE6, (int32_t)0x6004F819, (int32_t)0x54917FCE, (int32_t)0x601594D1,
+    (int32_t)0x547EA073, (int32_t)0x60262DD6, (int32_t)0x546BBDD7, (int32_t)0x6036C325,
+    (int32_t)0x5458D7F9, (int32_t)0x604754BF, (int32_t)0x5445EEDB, (int32_t)0x6057E2A2,
+    (int32_t)0x5433027D, (int32_t)0x60686CCF, (int32_t)0x542012E1, (int32_t)0x6078F344,
+    (int32_t)0x540D2005, (int32_t)0x60897601, (int32_t)0x53FA29ED, (int32_t)0x6099F505,
+    (int32_t)0x53E73097, (int32_t)0x60AA7050, (int32_t)0x53D43406, (int32_t)0x60BAE7E1,
+    (int32_t)0x53C13439, (int32_t)0x60CB5BB7, (int32_t)0x53AE3131, (int32_t)0x60DBCBD1,
+    (int32_t)0x539B2AF0, (int32_t)0x60EC3830, (int32_t)0x53882175, (int32_t)0x60FCA0D2,
+    (int32_t)0x537514C2, (int32_t)0x610D05B7, (int32_t)0x536204D7, (int32_t)0x611D66DE,
+    (int32_t)0x534EF1B5, (int32_t)0x612DC447, (int32_t)0x533BDB5D, (int32_t)0x613E1DF0,
+    (int32_t)0x5328C1D0, (int32_t)0x614E73DA, (int32_t)0x5315A50E, (int32_t)0x615EC603,
+    (int32_t)0x53028518, (int32_t)0x616F146C, (int32_t)0x52EF61EE, (int32_t)0x617F5F12,
+    (int32_t)0x52DC3B92, (int32_t)0x618FA5F7, (int32_t)0x52C91204, (int32_t)0x619FE918,
+    (int32_t)0x52B5E546, (int32_t)0x61B02876, (int32_t)0x52A2B556, (int32_t)0x61C06410,
+    (int32_t)0x528F8238, (int32_t)0x61D09BE5, (int32_t)0x527C4BEA, (int32_t)0x61E0CFF5,
+    (int32_t)0x5269126E, (int32_t)0x61F1003F, (int32_t)0x5255D5C5, (int32_t)0x62012CC2,
+    (int32_t)0x524295F0, (int32_t)0x6211557E, (int32_t)0x522F52EE, (int32_t)0x62217A72,
+    (int32_t)0x521C0CC2, (int32_t)0x62319B9D, (int32_t)0x5208C36A, (int32_t)0x6241B8FF,
+    (int32_t)0x51F576EA, (int32_t)0x6251D298, (int32_t)0x51E22740, (int32_t)0x6261E866,
+    (int32_t)0x51CED46E, (int32_t)0x6271FA69, (int32_t)0x51BB7E75, (int32_t)0x628208A1,
+    (int32_t)0x51A82555, (int32_t)0x6292130C, (int32_t)0x5194C910, (int32_t)0x62A219AA,
+    (int32_t)0x518169A5, (int32_t)0x62B21C7B, (int32_t)0x516E0715, (int32_t)0x62C21B7E,
+    (int32_t)0x515AA162, (int32_t)0x62D216B3, (int32_t)0x5147388C, (int32_t)0x62E20E17,
+    (int32_t)0x5133CC94, (int32_t)0x62F201AC, (int32_t)0x51205D7B, (int32_t)0x6301F171,
+    (int32_t)0x510CEB40, (int32_t)0x6311DD64, (int32_t)0x50F975E6, (int32_t)0x6321C585,
+    (int32_t)0x50E5FD6D, (int32_t)0x6331A9D4, (int32_t)0x50D281D5, (int32_t)0x63418A50,
+    (int32_t)0x50BF031F, (int32_t)0x635166F9, (int32_t)0x50AB814D, (int32_t)0x63613FCD,
+    (int32_t)0x5097FC5E, (int32_t)0x637114CC, (int32_t)0x50847454, (int32_t)0x6380E5F6,
+    (int32_t)0x5070E92F, (int32_t)0x6390B34A, (int32_t)0x505D5AF1, (int32_t)0x63A07CC7,
+    (int32_t)0x5049C999, (int32_t)0x63B0426D, (int32_t)0x50363529, (int32_t)0x63C0043B,
+    (int32_t)0x50229DA1, (int32_t)0x63CFC231, (int32_t)0x500F0302, (int32_t)0x63DF7C4D,
+    (int32_t)0x4FFB654D, (int32_t)0x63EF3290, (int32_t)0x4FE7C483, (int32_t)0x63FEE4F8,
+    (int32_t)0x4FD420A4, (int32_t)0x640E9386, (int32_t)0x4FC079B1, (int32_t)0x641E3E38,
+    (int32_t)0x4FACCFAB, (int32_t)0x642DE50D, (int32_t)0x4F992293, (int32_t)0x643D8806,
+    (int32_t)0x4F857269, (int32_t)0x644D2722, (int32_t)0x4F71BF2E, (int32_t)0x645CC260,
+    (int32_t)0x4F5E08E3, (int32_t)0x646C59BF, (int32_t)0x4F4A4F89, (int32_t)0x647BED3F,
+    (int32_t)0x4F369320, (int32_t)0x648B7CE0, (int32_t)0x4F22D3AA, (int32_t)0x649B08A0,
+    (int32_t)0x4F0F1126, (int32_t)0x64AA907F, (int32_t)0x4EFB4B96, (int32_t)0x64BA147D,
+    (int32_t)0x4EE782FB, (int32_t)0x64C99498, (int32_t)0x4ED3B755, (int32_t)0x64D910D1,
+    (int32_t)0x4EBFE8A5, (int32_t)0x64E88926, (int32_t)0x4EAC16EB, (int32_t)0x64F7FD98,
+    (int32_t)0x4E984229, (int32_t)0x65076E25, (int32_t)0x4E846A60, (int32_t)0x6516DACD,
+    (int32_t)0x4E708F8F, (int32_t)0x6526438F, (int32_t)0x4E5CB1B9, (int32_t)0x6535A86B,
+    (int32_t)0x4E48D0DD, (int32_t)0x6545095F, (int32_t)0x4E34ECFC, (int32_t)0x6554666D,
+    (int32_t)0x4E210617, (int32_t)0x6563BF92, (int32_t)0x4E0D1C30, (int32_t)0x657314CF,
+    (int32_t)0x4DF92F46, (int32_t)0x65826622, (int32_t)0x4DE53F5A, (int32_t)0x6591B38C,
+    (int32_t)0x4DD14C6E, (int32_t)0x65A0FD0B, (int32_t)0x4DBD5682, (int32_t)0x65B0429F,
+    (int32_t)0x4DA95D96, (int32_t)0x65BF8447, (int32_t)0x4D9561AC, (int32_t)0x65CEC204,
+    (int32_t)0x4D8162C4, (int32_t)0x65DDFBD3, (int32_t)0x4D6D60DF, (int32_t)0x65ED31B5,
+    (int32_t)0x4D595BFE, (int32_t)0x65FC63A9, (int32_t)0x4D455422, (int32_t)0x660B91AF,
+    (int32_t)0x4D31494B, (int32_t)0x661ABBC5, (int32_t)0x4D1D3B7A, (int32_t)0x6629E1EC,
+    (int32_t)0x4D092AB0, (int32_t)0x66390422, (int32_t)0x4CF516EE, (int32_t)0x66482267,
+    (int32_t)0x4CE10034, (int32_t)0x66573CBB, (int32_t)0x4CCCE684, (int32_t)0x6666531D,
+    (int32_t)0x4CB8C9DD, (int32_t)0x6675658C, (int32_t)0x4CA4AA41, (int32_t)0x66847408,
+    (int32_t)0x4C9087B1, (int32_t)0x66937E91, (int32_t)0x4C7C622D, (int32_t)0x66A28524,
+    (int32_t)0x4C6839B7, (int32_t)0x66B187C3, (int32_t)0x4C540E4E, (int32_t)0x66C0866D,
+    (int32_t)0x4C3FDFF4, (int32_t)0x66CF8120, (int32_t)0x4C2BAEA9, (int32_t)0x66DE77DC,
+    (int32_t)0x4C177A6E, (int32_t)0x66ED6AA1, (int32_t)0x4C034345, (int32_t)0x66FC596F,
+    (int32_t)0x4BEF092D, (int32_t)0x670B4444, (int32_t)0x4BDACC28, (int32_t)0x671A2B20,
+    (int32_t)0x4BC68C36, (int32_t)0x67290E02, (int32_t)0x4BB24958, (int32_t)0x6737ECEA,
+    (int32_t)0x4B9E0390, (int32_t)0x6746C7D8, (int32_t)0x4B89BADD, (int32_t)0x67559ECA,
+    (int32_t)0x4B756F40, (int32_t)0x676471C0, (int32_t)0x4B6120BB, (int32_t)0x677340BA,
+    (int32_t)0x4B4CCF4D, (int32_t)0x67820BB7, (int32_t)0x4B387AF9, (int32_t)0x6790D2B6,
+    (int32_t)0x4B2423BE, (int32_t)0x679F95B7, (int32_t)0x4B0FC99D, (int32_t)0x67AE54BA,
+    (int32_t)0x4AFB6C98, (int32_t)0x67BD0FBD, (int32_t)0x4AE70CAF, (int32_t)0x67CBC6C0,
+    (int32_t)0x4AD2A9E2, (int32_t)0x67DA79C3, (int32_t)0x4ABE4433, (int32_t)0x67E928C5,
+    (int32_t)0x4AA9DBA2, (int32_t)0x67F7D3C5, (int32_t)0x4A957030, (int32_t)0x68067AC3,
+    (int32_t)0x4A8101DE, (int32_t)0x68151DBE, (int32_t)0x4A6C90AD, (int32_t)0x6823BCB7,
+    (int32_t)0x4A581C9E, (int32_t)0x683257AB, (int32_t)0x4A43A5B0, (int32_t)0x6840EE9B,
+    (int32_t)0x4A2F2BE6, (int32_t)0x684F8186, (int32_t)0x4A1AAF3F, (int32_t)0x685E106C,
+    (int32_t)0x4A062FBD, (int32_t)0x686C9B4B, (int32_t)0x49F1AD61, (int32_t)0x687B2224,
+    (int32_t)0x49DD282A, (int32_t)0x6889A4F6, (int32_t)0x49C8A01B, (int32_t)0x689823BF,
+    (int32_t)0x49B41533, (int32_t)0x68A69E81, (int32_t)0x499F8774, (int32_t)0x68B5153A,
+    (int32_t)0x498AF6DF, (int32_t)0x68C387E9, (int32_t)0x49766373, (int32_t)0x68D1F68F,
+    (int32_t)0x4961CD33, (int32_t)0x68E06129, (int32_t)0x494D341E, (int32_t)0x68EEC7B9,
+    (int32_t)0x49389836, (int32_t)0x68FD2A3D, (int32_t)0x4923F97B, (int32_t)0x690B88B5,
+    (int32_t)0x490F57EE, (int32_t)0x6919E320, (int32_t)0x48FAB391, (int32_t)0x6928397E,
+    (int32_t)0x48E60C62, (int32_t)0x69368BCE, (int32_t)0x48D16265, (int32_t)0x6944DA10,
+    (int32_t)0x48BCB599, (int32_t)0x69532442, (int32_t)0x48A805FF, (int32_t)0x69616A65,
+    (int32_t)0x48935397, (int32_t)0x696FAC78, (int32_t)0x487E9E64, (int32_t)0x697DEA7B,
+    (int32_t)0x4869E665, (int32_t)0x698C246C, (int32_t)0x48552B9B, (int32_t)0x699A5A4C,
+    (int32_t)0x48406E08, (int32_t)0x69A88C19, (int32_t)0x482BADAB, (int32_t)0x69B6B9D3,
+    (int32_t)0x4816EA86, (int32_t)0x69C4E37A, (int32_t)0x48022499, (int32_t)0x69D3090E,
+    (int32_t)0x47ED5BE6, (int32_t)0x69E12A8C, (int32_t)0x47D8906D, (int32_t)0x69EF47F6,
+    (int32_t)0x47C3C22F, (int32_t)0x69FD614A, (int32_t)0x47AEF12C, (int32_t)0x6A0B7689,
+    (int32_t)0x479A1D67, (int32_t)0x6A1987B0, (int32_t)0x478546DE, (int32_t)0x6A2794C1,
+    (int32_t)0x47706D93, (int32_t)0x6A359DB9, (int32_t)0x475B9188, (int32_t)0x6A43A29A,
+    (int32_t)0x4746B2BC, (int32_t)0x6A51A361, (int32_t)0x4731D131, (int32_t)0x6A5FA010,
+    (int32_t)0x471CECE7, (int32_t)0x6A6D98A4, (int32_t)0x470805DF, (int32_t)0x6A7B8D1E,
+    (int32_t)0x46F31C1A, (int32_t)0x6A897D7D, (int32_t)0x46DE2F99, (int32_t)0x6A9769C1,
+    (int32_t)0x46C9405C, (int32_t)0x6AA551E9, (int32_t)0x46B44E65, (int32_t)0x6AB335F4,
+    (int32_t)0x469F59B4, (int32_t)0x6AC115E2, (int32_t)0x468A624A, (int32_t)0x6ACEF1B2,
+    (int32_t)0x46756828, (int32_t)0x6ADCC964, (int32_t)0x46606B4E, (int32_t)0x6AEA9CF8,
+    (int32_t)0x464B6BBE, (int32_t)0x6AF86C6C, (int32_t)0x46366978, (int32_t)0x6B0637C1,
+    (int32_t)0x4621647D, (int32_t)0x6B13FEF5, (int32_t)0x460C5CCE, (int32_t)0x6B21C208,
+    (int32_t)0x45F7526B, (int32_t)0x6B2F80FB, (int32_t)0x45E24556, (int32_t)0x6B3D3BCB,
+    (int32_t)0x45CD358F, (int32_t)0x6B4AF279, (int32_t)0x45B82318, (int32_t)0x6B58A503,
+    (int32_t)0x45A30DF0, (int32_t)0x6B66536B, (int32_t)0x458DF619, (int32_t)0x6B73FDAE,
+    (int32_t)0x4578DB93, (int32_t)0x6B81A3CD, (int32_t)0x4563BE60, (int32_t)0x6B8F45C7,
+    (int32_t)0x454E9E80, (int32_t)0x6B9CE39B, (int32_t)0x45397BF4, (int32_t)0x6BAA7D49,
+    (int32_t)0x452456BD, (int32_t)0x6BB812D1, (int32_t)0x450F2EDB, (int32_t)0x6BC5A431,
+    (int32_t)0x44FA0450, (int32_t)0x6BD3316A, (int32_t)0x44E4D71C, (int32_t)0x6BE0BA7B,
+    (int32_t)0x44CFA740, (int32_t)0x6BEE3F62, (int32_t)0x44BA74BD, (int32_t)0x6BFBC021,
+    (int32_t)0x44A53F93, (int32_t)0x6C093CB6, (int32_t)0x449007C4, (int32_t)0x6C16B521,
+    (int32_t)0x447ACD50, (int32_t)0x6C242960, (int32_t)0x44659039, (int32_t)0x6C319975,
+    (int32_t)0x4450507E, (int32_t)0x6C3F055D, (int32_t)0x443B0E21, (int32_t)0x6C4C6D1A,
+    (int32_t)0x4425C923, (int32_t)0x6C59D0A9, (int32_t)0x44108184, (int32_t)0x6C67300B,
+    (int32_t)0x43FB3746, (int32_t)0x6C748B3F, (int32_t)0x43E5EA68, (int32_t)0x6C81E245,
+    (int32_t)0x43D09AED, (int32_t)0x6C8F351C, (int32_t)0x43BB48D4, (int32_t)0x6C9C83C3,
+    (int32_t)0x43A5F41E, (int32_t)0x6CA9CE3B, (int32_t)0x43909CCD, (int32_t)0x6CB71482,
+    (int32_t)0x437B42E1, (int32_t)0x6CC45698, (int32_t)0x4365E65B, (int32_t)0x6CD1947C,
+    (int32_t)0x4350873C, (int32_t)0x6CDECE2F, (int32_t)0x433B2585, (int32_t)0x6CEC03AF,
+    (int32_t)0x4325C135, (int32_t)0x6CF934FC, (int32_t)0x43105A50, (int32_t)0x6D066215,
+    (int32_t)0x42FAF0D4, (int32_t)0x6D138AFB, (int32_t)0x42E584C3, (int32_t)0x6D20AFAC,
+    (int32_t)0x42D0161E, (int32_t)0x6D2DD027, (int32_t)0x42BAA4E6, (int32_t)0x6D3AEC6E,
+    (int32_t)0x42A5311B, (int32_t)0x6D48047E, (int32_t)0x428FBABE, (int32_t)0x6D551858,
+    (int32_t)0x427A41D0, (int32_t)0x6D6227FA, (int32_t)0x4264C653, (int32_t)0x6D6F3365,
+    (int32_t)0x424F4845, (int32_t)0x6D7C3A98, (int32_t)0x4239C7AA, (int32_t)0x6D893D93,
+    (int32_t)0x42244481, (int32_t)0x6D963C54, (int32_t)0x420EBECB, (int32_t)0x6DA336DC,
+    (int32_t)0x41F93689, (int32_t)0x6DB02D29, (int32_t)0x41E3ABBC, (int32_t)0x6DBD1F3C,
+    (int32_t)0x41CE1E65, (int32_t)0x6DCA0D14, (int32_t)0x41B88E84, (int32_t)0x6DD6F6B1,
+    (int32_t)0x41A2FC1A, (int32_t)0x6DE3DC11, (int32_t)0x418D6729, (int32_t)0x6DF0BD35,
+    (int32_t)0x4177CFB1, (int32_t)0x6DFD9A1C, (int32_t)0x416235B2, (int32_t)0x6E0A72C5,
+    (int32_t)0x414C992F, (int32_t)0x6E174730, (int32_t)0x4136FA27, (int32_t)0x6E24175C,
+    (int32_t)0x4121589B, (int32_t)0x6E30E34A, (int32_t)0x410BB48C, (int32_t)0x6E3DAAF8,
+    (int32_t)0x40F60DFB, (int32_t)0x6E4A6E66, (int32_t)0x40E064EA, (int32_t)0x6E572D93,
+    (int32_t)0x40CAB958, (int32_t)0x6E63E87F, (int32_t)0x40B50B46, (int32_t)0x6E709F2A,
+    (int32_t)0x409F5AB6, (int32_t)0x6E7D5193, (int32_t)0x4089A7A8, (int32_t)0x6E89FFB9,
+    (int32_t)0x4073F21D, (int32_t)0x6E96A99D, (int32_t)0x405E3A16, (int32_t)0x6EA34F3D,
+    (int32_t)0x40487F94, (int32_t)0x6EAFF099, (int32_t)0x4032C297, (int32_t)0x6EBC8DB0,
+    (int32_t)0x401D0321, (int32_t)0x6EC92683, (int32_t)0x40074132, (int32_t)0x6ED5BB10,
+    (int32_t)0x3FF17CCA, (int32_t)0x6EE24B57, (int32_t)0x3FDBB5EC, (int32_t)0x6EEED758,
+    (int32_t)0x3FC5EC98, (int32_t)0x6EFB5F12, (int32_t)0x3FB020CE, (int32_t)0x6F07E285,
+    (int32_t)0x3F9A5290, (int32_t)0x6F1461B0, (int32_t)0x3F8481DD, (int32_t)0x6F20DC92,
+    (int32_t)0x3F6EAEB8, (int32_t)0x6F2D532C, (int32_t)0x3F58D921, (int32_t)0x6F39C57D,
+    (int32_t)0x3F430119, (int32_t)0x6F463383, (int32_t)0x3F2D26A0, (int32_t)0x6F529D40,
+    (int32_t)0x3F1749B8, (int32_t)0x6F5F02B2, (int32_t)0x3F016A61, (int32_t)0x6F6B63D8,
+    (int32_t)0x3EEB889C, (int32_t)0x6F77C0B3, (int32_t)0x3ED5A46B, (int32_t)0x6F841942,
+    (int32_t)0x3EBFBDCD, (int32_t)0x6F906D84, (int32_t)0x3EA9D4C3, (int32_t)0x6F9CBD79,
+    (int32_t)0x3E93E950, (int32_t)0x6FA90921, (int32_t)0x3E7DFB73, (int32_t)0x6FB5507A,
+    (int32_t)0x3E680B2C, (int32_t)0x6FC19385, (int32_t)0x3E52187F, (int32_t)0x6FCDD241,
+    (int32_t)0x3E3C2369, (int32_t)0x6FDA0CAE, (int32_t)0x3E262BEE, (int32_t)0x6FE642CA,
+    (int32_t)0x3E10320D, (int32_t)0x6FF27497, (int32_t)0x3DFA35C8, (int32_t)0x6FFEA212,
+    (int32_t)0x3DE4371F, (int32_t)0x700ACB3C, (int32_t)0x3DCE3614, (int32_t)0x7016F014,
+    (int32_t)0x3DB832A6, (int32_t)0x7023109A, (int32_t)0x3DA22CD7, (int32_t)0x702F2CCD,
+    (int32_t)0x3D8C24A8, (int32_t)0x703B44AD, (int32_t)0x3D761A19, (int32_t)0x70475839,
+    (int32_t)0x3D600D2C, (int32_t)0x70536771, (int32_t)0x3D49FDE1, (int32_t)0x705F7255,
+    (int32_t)0x3D33EC39, (int32_t)0x706B78E3, (int32_t)0x3D1DD835, (int32_t)0x70777B1C,
+    (int32_t)0x3D07C1D6, (int32_t)0x708378FF, (int32_t)0x3CF1A91C, (int32_t)0x708F728B,
+    (int32_t)0x3CDB8E09, (int32_t)0x709B67C0, (int32_t)0x3CC5709E, (int32_t)0x70A7589F,
+    (int32_t)0x3CAF50DA, (int32_t)0x70B34525, (int32_t)0x3C992EC0, (int32_t)0x70BF2D53,
+    (int32_t)0x3C830A50, (int32_t)0x70CB1128, (int32_t)0x3C6CE38A, (int32_t)0x70D6F0A4,
+    (int32_t)0x3C56BA70, (int32_t)0x70E2CBC6, (int32_t)0x3C408F03, (int32_t)0x70EEA28E,
+    (int32_t)0x3C2A6142, (int32_t)0x70FA74FC, (int32_t)0x3C143130, (int32_t)0x7106430E,
+    (int32_t)0x3BFDFECD, (int32_t)0x71120CC5, (int32_t)0x3BE7CA1A, (int32_t)0x711DD220,
+    (int32_t)0x3BD19318, (int32_t)0x7129931F, (int32_t)0x3BBB59C7, (int32_t)0x71354FC0,
+    (int32_t)0x3BA51E29, (int32_t)0x71410805, (int32_t)0x3B8EE03E, (int32_t)0x714CBBEB,
+    (int32_t)0x3B78A007, (int32_t)0x71586B74, (int32_t)0x3B625D86, (int32_t)0x7164169D,
+    (int32_t)0x3B4C18BA, (int32_t)0x716FBD68, (int32_t)0x3B35D1A5, (int32_t)0x717B5FD3,
+    (int32_t)0x3B1F8848, (int32_t)0x7186FDDE, (int32_t)0x3B093CA3, (int32_t)0x71929789,
+    (int32_t)0x3AF2EEB7, (int32_t)0x719E2CD2, (int32_t)0x3ADC9E86, (int32_t)0x71A9BDBA,
+    (int32_t)0x3AC64C0F, (int32_t)0x71B54A41, (int32_t)0x3AAFF755, (int32_t)0x71C0D265,
+    (int32_t)0x3A99A057, (int32_t)0x71CC5626, (int32_t)0x3A834717, (int32_t)0x71D7D585,
+    (int32_t)0x3A6CEB96, (int32_t)0x71E35080, (int32_t)0x3A568DD4, (int32_t)0x71EEC716,
+    (int32_t)0x3A402DD2, (int32_t)0x71FA3949, (int32_t)0x3A29CB91, (int32_t)0x7205A716,
+    (int32_t)0x3A136712, (int32_t)0x7211107E, (int32_t)0x39FD0056, (int32_t)0x721C7580,
+    (int32_t)0x39E6975E, (int32_t)0x7227D61C, (int32_t)0x39D02C2A, (int32_t)0x72333251,
+    (int32_t)0x39B9BEBC, (int32_t)0x723E8A20, (int32_t)0x39A34F13, (int32_t)0x7249DD86,
+    (int32_t)0x398CDD32, (int32_t)0x72552C85, (int32_t)0x39766919, (int32_t)0x7260771B,
+    (int32_t)0x395FF2C9, (int32_t)0x726BBD48, (int32_t)0x39497A43, (int32_t)0x7276FF0D,
+    (int32_t)0x3932FF87, (int32_t)0x72823C67, (int32_t)0x391C8297, (int32_t)0x728D7557,
+    (int32_t)0x39060373, (int32_t)0x7298A9DD, (int32_t)0x38EF821C, (int32_t)0x72A3D9F7,
+    (int32_t)0x38D8FE93, (int32_t)0x72AF05A7, (int32_t)0x38C278D9, (int32_t)0x72BA2CEA,
+    (int32_t)0x38ABF0EF, (int32_t)0x72C54FC1, (int32_t)0x389566D6, (int32_t)0x72D06E2B,
+    (int32_t)0x387EDA8E, (int32_t)0x72DB8828, (int32_t)0x38684C19, (int32_t)0x72E69DB7,
+    (int32_t)0x3851BB77, (int32_t)0x72F1AED9, (int32_t)0x383B28A9, (int32_t)0x72FCBB8C,
+    (int32_t)0x382493B0, (int32_t)0x7307C3D0, (int32_t)0x380DFC8D, (int32_t)0x7312C7A5,
+    (int32_t)0x37F76341, (int32_t)0x731DC70A, (int32_t)0x37E0C7CC, (int32_t)0x7328C1FF,
+    (int32_t)0x37CA2A30, (int32_t)0x7333B883, (int32_t)0x37B38A6D, (int32_t)0x733EAA96,
+    (int32_t)0x379CE885, (int32_t)0x73499838, (int32_t)0x37864477, (int32_t)0x73548168,
+    (int32_t)0x376F9E46, (int32_t)0x735F6626, (int32_t)0x3758F5F2, (int32_t)0x736A4671,
+    (int32_t)0x37424B7B, (int32_t)0x73752249, (int32_t)0x372B9EE3, (int32_t)0x737FF9AE,
+    (int32_t)0x3714F02A, (int32_t)0x738ACC9E, (int32_t)0x36FE3F52, (int32_t)0x73959B1B,
+    (int32_t)0x36E78C5B, (int32_t)0x73A06522, (int32_t)0x36D0D746, (int32_t)0x73AB2AB4,
+    (int32_t)0x36BA2014, (int32_t)0x73B5EBD1, (int32_t)0x36A366C6, (int32_t)0x73C0A878,
+    (int32_t)0x368CAB5C, (int32_t)0x73CB60A8, (int32_t)0x3675EDD9, (int32_t)0x73D61461,
+    (int32_t)0x365F2E3B, (int32_t)0x73E0C3A3, (int32_t)0x36486C86, (int32_t)0x73EB6E6E,
+    (int32_t)0x3631A8B8, (int32_t)0x73F614C0, (int32_t)0x361AE2D3, (int32_t)0x7400B69A,
+    (int32_t)0x36041AD9, (int32_t)0x740B53FB, (int32_t)0x35ED50C9, (int32_t)0x7415ECE2,
+    (int32_t)0x35D684A6, (int32_t)0x74208150, (int32_t)0x35BFB66E, (int32_t)0x742B1144,
+    (int32_t)0x35A8E625, (int32_t)0x74359CBD, (int32_t)0x359213C9, (int32_t)0x744023BC,
+    (int32_t)0x357B3F5D, (int32_t)0x744AA63F, (int32_t)0x356468E2, (int32_t)0x74552446,
+    (int32_t)0x354D9057, (int32_t)0x745F9DD1, (int32_t)0x3536B5BE, (int32_t)0x746A12DF,
+    (int32_t)0x351FD918, (int32_t)0x74748371, (int32_t)0x3508FA66, (int32_t)0x747EEF85,
+    (int32_t)0x34F219A8, (int32_t)0x7489571C, (int32_t)0x34DB36DF, (int32_t)0x7493BA34,
+    (int32_t)0x34C4520D, (int32_t)0x749E18CD, (int32_t)0x34AD6B32, (int32_t)0x74A872E8,
+    (int32_t)0x34968250, (int32_t)0x74B2C884, (int32_t)0x347F9766, (int32_t)0x74BD199F,
+    (int32_t)0x3468AA76, (int32_t)0x74C7663A, (int32_t)0x3451BB81, (int32_t)0x74D1AE55,
+    (int32_t)0x343ACA87, (int32_t)0x74DBF1EF, (int32_t)0x3423D78A, (int32_t)0x74E63108,
+    (int32_t)0x340CE28B, (int32_t)0x74F06B9E, (int32_t)0x33F5EB89, (int32_t)0x74FAA1B3,
+    (int32_t)0x33DEF287, (int32_t)0x7504D345, (int32_t)0x33C7F785, (int32_t)0x750F0054,
+    (int32_t)0x33B0FA84, (int32_t)0x751928E0, (int32_t)0x3399FB85, (int32_t)0x75234CE8,
+    (int32_t)0x3382FA88, (int32_t)0x752D6C6C, (int32_t)0x336BF78F, (int32_t)0x7537876C,
+    (int32_t)0x3354F29B, (int32_t)0x75419DE7, (int32_t)0x333DEBAB, (int32_t)0x754BAFDC,
+    (int32_t)0x3326E2C3, (int32_t)0x7555BD4C, (int32_t)0x330FD7E1, (int32_t)0x755FC635,
+    (int32_t)0x32F8CB07, (int32_t)0x7569CA99, (int32_t)0x32E1BC36, (int32_t)0x7573CA75,
+    (int32_t)0x32CAAB6F, (int32_t)0x757DC5CA, (int32_t)0x32B398B3, (int32_t)0x7587BC98,
+    (int32_t)0x329C8402, (int32_t)0x7591AEDD, (int32_t)0x32856D5E, (int32_t)0x759B9C9B,
+    (int32_t)0x326E54C7, (int32_t)0x75A585CF, (int32_t)0x32573A3F, (int32_t)0x75AF6A7B,
+    (int32_t)0x32401DC6, (int32_t)0x75B94A9C, (int32_t)0x3228FF5C, (int32_t)0x75C32634,
+    (int32_t)0x3211DF04, (int32_t)0x75CCFD42, (int32_t)0x31FABCBD, (int32_t)0x75D6CFC5,
+    (int32_t)0x31E39889, (int32_t)0x75E09DBD, (int32_t)0x31CC7269, (int32_t)0x75EA672A,
+    (int32_t)0x31B54A5E, (int32_t)0x75F42C0B, (int32_t)0x319E2067, (int32_t)0x75FDEC60,
+    (int32_t)0x3186F487, (int32_t)0x7607A828, (int32_t)0x316FC6BE, (int32_t)0x76115F63,
+    (int32_t)0x3158970E, (int32_t)0x761B1211, (int32_t)0x31416576, (int32_t)0x7624C031,
+    (int32_t)0x312A31F8, (int32_t)0x762E69C4, (int32_t)0x3112FC95, (int32_t)0x76380EC8,
+    (int32_t)0x30FBC54D, (int32_t)0x7641AF3D, (int32_t)0x30E48C22, (int32_t)0x764B4B23,
+    (int32_t)0x30CD5115, (int32_t)0x7654E279, (int32_t)0x30B61426, (int32_t)0x765E7540,
+    (int32_t)0x309ED556, (int32_t)0x76680376, (int32_t)0x308794A6, (int32_t)0x76718D1C,
+    (int32_t)0x30705217, (int32_t)0x767B1231, (int32_t)0x30590DAB, (int32_t)0x768492B4,
+    (int32_t)0x3041C761, (int32_t)0x768E0EA6, (int32_t)0x302A7F3A, (int32_t)0x76978605,
+    (int32_t)0x30133539, (int32_t)0x76A0F8D2, (int32_t)0x2FFBE95D, (int32_t)0x76AA670D,
+    (int32_t)0x2FE49BA7, (int32_t)0x76B3D0B4, (int32_t)0x2FCD4C19, (int32_t)0x76BD35C7,
+    (int32_t)0x2FB5FAB2, (int32_t)0x76C69647, (int32_t)0x2F9EA775, (int32_t)0x76CFF232,
+    (int32_t)0x2F875262, (int32_t)0x76D94989, (int32_t)0x2F6FFB7A, (int32_t)0x76E29C4B,
+    (int32_t)0x2F58A2BE, (int32_t)0x76EBEA77, (int32_t)0x2F41482E, (int32_t)0x76F5340E,
+    (int32_t)0x2F29EBCC, (int32_t)0x76FE790E, (int32_t)0x2F128D99, (int32_t)0x7707B979,
+    (int32_t)0x2EFB2D95, (int32_t)0x7710F54C, (int32_t)0x2EE3CBC1, (int32_t)0x771A2C88,
+    (int32_t)0x2ECC681E, (int32_t)0x77235F2D, (int32_t)0x2EB502AE, (int32_t)0x772C8D3A,
+    (int32_t)0x2E9D9B70, (int32_t)0x7735B6AF, (int32_t)0x2E863267, (int32_t)0x773EDB8B,
+    (int32_t)0x2E6EC792, (int32_t)0x7747FBCE, (int32_t)0x2E575AF3, (int32_t)0x77511778,
+    (int32_t)0x2E3FEC8B, (int32_t)0x775A2E89, (int32_t)0x2E287C5A, (int32_t)0x776340FF,
+    (int32_t)0x2E110A62, (int32_t)0x776C4EDB, (int32_t)0x2DF996A3, (int32_t)0x7775581D,
+    (int32_t)0x2DE2211E, (int32_t)0x777E5CC3, (int32_t)0x2DCAA9D5, (int32_t)0x77875CCE,
+    (int32_t)0x2DB330C7, (int32_t)0x7790583E, (int32_t)0x2D9BB5F6, (int32_t)0x77994F11,
+    (int32_t)0x2D843964, (int32_t)0x77A24148, (int32_t)0x2D6CBB10, (int32_t)0x77AB2EE2,
+    (int32_t)0x2D553AFC, (int32_t)0x77B417DF, (int32_t)0x2D3DB928, (int32_t)0x77BCFC3F,
+    (int32_t)0x2D263596, (int32_t)0x77C5DC01, (int32_t)0x2D0EB046, (int32_t)0x77CEB725,
+    (int32_t)0x2CF72939, (int32_t)0x77D78DAA, (int32_t)0x2CDFA071, (int32_t)0x77E05F91,
+    (int32_t)0x2CC815EE, (int32_t)0x77E92CD9, (int32_t)0x2CB089B1, (int32_t)0x77F1F581,
+    (int32_t)0x2C98FBBA, (int32_t)0x77FAB989, (int32_t)0x2C816C0C, (int32_t)0x780378F1,
+    (int32_t)0x2C69DAA6, (int32_t)0x780C33B8, (int32_t)0x2C52478A, (int32_t)0x7814E9DF,
+    (int32_t)0x2C3AB2B9, (int32_t)0x781D9B65, (int32_t)0x2C231C33, (int32_t)0x78264849,
+    (int32_t)0x2C0B83FA, (int32_t)0x782EF08B, (int32_t)0x2BF3EA0D, (int32_t)0x7837942B,
+    (int32_t)0x2BDC4E6F, (int32_t)0x78403329, (int32_t)0x2BC4B120, (int32_t)0x7848CD83,
+    (int32_t)0x2BAD1221, (int32_t)0x7851633B, (int32_t)0x2B957173, (int32_t)0x7859F44F,
+    (int32_t)0x2B7DCF17, (int32_t)0x786280BF, (int32_t)0x2B662B0E, (int32_t)0x786B088C,
+    (int32_t)0x2B4E8558, (int32_t)0x78738BB3, (int32_t)0x2B36DDF7, (int32_t)0x787C0A36,
+    (int32_t)0x2B1F34EB, (int32_t)0x78848414, (int32_t)0x2B078A36, (int32_t)0x788CF94C,
+    (int32_t)0x2AEFDDD8, (int32_t)0x789569DF, (int32_t)0x2AD82FD2, (int32_t)0x789DD5CB,
+    (int32_t)0x2AC08026, (int32_t)0x78A63D11, (int32_t)0x2AA8CED3, (int32_t)0x78AE9FB0,
+    (int32_t)0x2A911BDC, (int32_t)0x78B6FDA8, (int32_t)0x2A796740, (int32_t)0x78BF56F9,
+    (int32_t)0x2A61B101, (int32_t)0x78C7ABA2, (int32_t)0x2A49F920, (int32_t)0x78CFFBA3,
+    (int32_t)0x2A323F9E, (int32_t)0x78D846FB, (int32_t)0x2A1A847B, (int32_t)0x78E08DAB,
+    (int32_t)0x2A02C7B8, (int32_t)0x78E8CFB2, (int32_t)0x29EB0957, (int32_t)0x78F10D0F,
+    (int32_t)0x29D34958, (int32_t)0x78F945C3, (int32_t)0x29BB87BC, (int32_t)0x790179CD,
+    (int32_t)0x29A3C485, (int32_t)0x7909A92D, (int32_t)0x298BFFB2, (int32_t)0x7911D3E2,
+    (int32_t)0x29743946, (int32_t)0x7919F9EC, (int32_t)0x295C7140, (int32_t)0x79221B4B,
+    (int32_t)0x2944A7A2, (int32_t)0x792A37FE, (int32_t)0x292CDC6D, (int32_t)0x79325006,
+    (int32_t)0x29150FA1, (int32_t)0x793A6361, (int32_t)0x28FD4140, (int32_t)0x79427210,
+    (int32_t)0x28E5714B, (int32_t)0x794A7C12, (int32_t)0x28CD9FC1, (int32_t)0x79528167,
+    (int32_t)0x28B5CCA5, (int32_t)0x795A820E, (int32_t)0x289DF7F8, (int32_t)0x79627E08,
+    (int32_t)0x288621B9, (int32_t)0x796A7554, (int32_t)0x286E49EA, (int32_t)0x797267F2,
+    (int32_t)0x2856708D, (int32_t)0x797A55E0, (int32_t)0x283E95A1, (int32_t)0x79823F20,
+    (int32_t)0x2826B928, (int32_t)0x798A23B1, (int32_t)0x280EDB23, (int32_t)0x79920392,
+    (int32_t)0x27F6FB92, (int32_t)0x7999DEC4, (int32_t)0x27DF1A77, (int32_t)0x79A1B545,
+    (int32_t)0x27C737D3, (int32_t)0x79A98715, (int32_t)0x27AF53A6, (int32_t)0x79B15435,
+    (int32_t)0x27976DF1, (int32_t)0x79B91CA4, (int32_t)0x277F86B5, (int32_t)0x79C0E062,
+    (int32_t)0x27679DF4, (int32_t)0x79C89F6E, (int32_t)0x274FB3AE, (int32_t)0x79D059C8,
+    (int32_t)0x2737C7E3, (int32_t)0x79D80F6F, (int32_t)0x271FDA96, (int32_t)0x79DFC064,
+    (int32_t)0x2707EBC7, (int32_t)0x79E76CA7, (int32_t)0x26EFFB76, (int32_t)0x79EF1436,
+    (int32_t)0x26D809A5, (int32_t)0x79F6B711, (int32_t)0x26C01655, (int32_t)0x79FE5539,
+    (int32_t)0x26A82186, (int32_t)0x7A05EEAD, (int32_t)0x26902B39, (int32_t)0x7A0D836D,
+    (int32_t)0x26783370, (int32_t)0x7A151378, (int32_t)0x26603A2C, (int32_t)0x7A1C9ECE,
+    (int32_t)0x26483F6C, (int32_t)0x7A24256F, (int32_t)0x26304333, (int32_t)0x7A2BA75A,
+    (int32_t)0x26184581, (int32_t)0x7A332490, (int32_t)0x26004657, (int32_t)0x7A3A9D0F,
+    (int32_t)0x25E845B6, (int32_t)0x7A4210D8, (int32_t)0x25D0439F, (int32_t)0x7A497FEB,
+    (int32_t)0x25B84012, (int32_t)0x7A50EA47, (int32_t)0x25A03B11, (int32_t)0x7A584FEB,
+    (int32_t)0x2588349D, (int32_t)0x7A5FB0D8, (int32_t)0x25702CB7, (int32_t)0x7A670D0D,
+    (int32_t)0x2558235F, (int32_t)0x7A6E648A, (int32_t)0x25401896, (int32_t)0x7A75B74F,
+    (int32_t)0x25280C5E, (int32_t)0x7A7D055B, (int32_t)0x250FFEB7, (int32_t)0x7A844EAE,
+    (int32_t)0x24F7EFA2, (int32_t)0x7A8B9348, (int32_t)0x24DFDF20, (int32_t)0x7A92D329,
+    (int32_t)0x24C7CD33, (int32_t)0x7A9A0E50, (int32_t)0x24AFB9DA, (int32_t)0x7AA144BC,
+    (int32_t)0x2497A517, (int32_t)0x7AA8766F, (int32_t)0x247F8EEC, (int32_t)0x7AAFA367,
+    (int32_t)0x24677758, (int32_t)0x7AB6CBA4, (int32_t)0x244F5E5C, (int32_t)0x7ABDEF25,
+    (int32_t)0x243743FA, (int32_t)0x7AC50DEC, (int32_t)0x241F2833, (int32_t)0x7ACC27F7,
+    (int32_t)0x24070B08, (int32_t)0x7AD33D45, (int32_t)0x23EEEC78, (int32_t)0x7ADA4DD8,
+    (int32_t)0x23D6CC87, (int32_t)0x7AE159AE, (int32_t)0x23BEAB33, (int32_t)0x7AE860C7,
+    (int32_t)0x23A6887F, (int32_t)0x7AEF6323, (int32_t)0x238E646A, (int32_t)0x7AF660C2,
+    (int32_t)0x23763EF7, (int32_t)0x7AFD59A4, (int32_t)0x235E1826, (int32_t)0x7B044DC7,
+    (int32_t)0x2345EFF8, (int32_t)0x7B0B3D2C, (int32_t)0x232DC66D, (int32_t)0x7B1227D3,
+    (int32_t)0x23159B88, (int32_t)0x7B190DBC, (int32_t)0x22FD6F48, (int32_t)0x7B1FEEE5,
+    (int32_t)0x22E541AF, (int32_t)0x7B26CB4F, (int32_t)0x22CD12BD, (int32_t)0x7B2DA2FA,
+    (int32_t)0x22B4E274, (int32_t)0x7B3475E5, (int32_t)0x229CB0D5, (int32_t)0x7B3B4410,
+    (int32_t)0x22847DE0, (int32_t)0x7B420D7A, (int32_t)0x226C4996, (int32_t)0x7B48D225,
+    (int32_t)0x225413F8, (int32_t)0x7B4F920E, (int32_t)0x223BDD08, (int32_t)0x7B564D36,
+    (int32_t)0x2223A4C5, (int32_t)0x7B5D039E, (int32_t)0x220B6B32, (int32_t)0x7B63B543,
+    (int32_t)0x21F3304F, (int32_t)0x7B6A6227, (int32_t)0x21DAF41D, (int32_t)0x7B710A49,
+    (int32_t)0x21C2B69C, (int32_t)0x7B77ADA8, (int32_t)0x21AA77CF, (int32_t)0x7B7E4C45,
+    (int32_t)0x219237B5, (int32_t)0x7B84E61F, (int32_t)0x2179F64F, (int32_t)0x7B8B7B36,
+    (int32_t)0x2161B3A0, (int32_t)0x7B920B89, (int32_t)0x21496FA7, (int32_t)0x7B989719,
+    (int32_t)0x21312A65, (int32_t)0x7B9F1DE6, (int32_t)0x2118E3DC, (int32_t)0x7BA59FEE,
+    (int32_t)0x21009C0C, (int32_t)0x7BAC1D31, (int32_t)0x20E852F6, (int32_t)0x7BB295B0,
+    (int32_t)0x20D0089C, (int32_t)0x7BB9096B, (int32_t)0x20B7BCFE, (int32_t)0x7BBF7860,
+    (int32_t)0x209F701C, (int32_t)0x7BC5E290, (int32_t)0x208721F9, (int32_t)0x7BCC47FA,
+    (int32_t)0x206ED295, (int32_t)0x7BD2A89E, (int32_t)0x205681F1, (int32_t)0x7BD9047C,
+    (int32_t)0x203E300D, (int32_t)0x7BDF5B94, (int32_t)0x2025DCEC, (int32_t)0x7BE5ADE6,
+    (int32_t)0x200D888D, (int32_t)0x7BEBFB70, (int32_t)0x1FF532F2, (int32_t)0x7BF24434,
+    (int32_t)0x1FDCDC1B, (int32_t)0x7BF88830, (int32_t)0x1FC4840A, (int32_t)0x7BFEC765,
+    (int32_t)0x1FAC2ABF, (int32_t)0x7C0501D2, (int32_t)0x1F93D03C, (int32_t)0x7C0B3777,
+    (int32_t)0x1F7B7481, (int32_t)0x7C116853, (int32_t)0x1F63178F, (int32_t)0x7C179467,
+    (int32_t)0x1F4AB968, (int32_t)0x7C1DBBB3, (int32_t)0x1F325A0B, (int32_t)0x7C23DE35,
+    (int32_t)0x1F19F97B, (int32_t)0x7C29FBEE, (int32_t)0x1F0197B8, (int32_t)0x7C3014DE,
+    (int32_t)0x1EE934C3, (int32_t)0x7C362904, (int32_t)0x1ED0D09D, (int32_t)0x7C3C3860,
+    (int32_t)0x1EB86B46, (int32_t)0x7C4242F2, (int32_t)0x1EA004C1, (int32_t)0x7C4848BA,
+    (int32_t)0x1E879D0D, (int32_t)0x7C4E49B7, (int32_t)0x1E6F342C, (int32_t)0x7C5445E9,
+    (int32_t)0x1E56CA1E, (int32_t)0x7C5A3D50, (int32_t)0x1E3E5EE5, (int32_t)0x7C602FEC,
+    (int32_t)0x1E25F282, (int32_t)0x7C661DBC, (int32_t)0x1E0D84F5, (int32_t)0x7C6C06C0,
+    (int32_t)0x1DF5163F, (int32_t)0x7C71EAF9, (int32_t)0x1DDCA662, (int32_t)0x7C77CA65,
+    (int32_t)0x1DC4355E, (int32_t)0x7C7DA505, (int32_t)0x1DABC334, (int32_t)0x7C837AD8,
+    (int32_t)0x1D934FE5, (int32_t)0x7C894BDE, (int32_t)0x1D7ADB73, (int32_t)0x7C8F1817,
+    (int32_t)0x1D6265DD, (int32_t)0x7C94DF83, (int32_t)0x1D49EF26, (int32_t)0x7C9AA221,
+    (int32_t)0x1D31774D, (int32_t)0x7CA05FF1, (int32_t)0x1D18FE54, (int32_t)0x7CA618F3,
+    (int32_t)0x1D00843D, (int32_t)0x7CABCD28, (int32_t)0x1CE80906, (int32_t)0x7CB17C8D,
+    (int32_t)0x1CCF8CB3, (int32_t)0x7CB72724, (int32_t)0x1CB70F43, (int32_t)0x7CBCCCEC,
+    (int32_t)0x1C9E90B8, (int32_t)0x7CC26DE5, (int32_t)0x1C861113, (int32_t)0x7CC80A0F,
+    (int32_t)0x1C6D9053, (int32_t)0x7CCDA169, (int32_t)0x1C550E7C, (int32_t)0x7CD333F3,
+    (int32_t)0x1C3C8B8C, (int32_t)0x7CD8C1AE, (int32_t)0x1C240786, (int32_t)0x7CDE4A98,
+    (int32_t)0x1C0B826A, (int32_t)0x7CE3CEB2, (int32_t)0x1BF2FC3A, (int32_t)0x7CE94DFB,
+    (int32_t)0x1BDA74F6, (int32_t)0x7CEEC873, (int32_t)0x1BC1EC9E, (int32_t)0x7CF43E1A,
+    (int32_t)0x1BA96335, (int32_t)0x7CF9AEF0, (int32_t)0x1B90D8BB, (int32_t)0x7CFF1AF5,
+    (int32_t)0x1B784D30, (int32_t)0x7D048228, (int32_t)0x1B5FC097, (int32_t)0x7D09E489,
+    (int32_t)0x1B4732EF, (int32_t)0x7D0F4218, (int32_t)0x1B2EA43A, (int32_t)0x7D149AD5,
+    (int32_t)0x1B161479, (int32_t)0x7D19EEBF, (int32_t)0x1AFD83AD, (int32_t)0x7D1F3DD6,
+    (int32_t)0x1AE4F1D6, (int32_t)0x7D24881B, (int32_t)0x1ACC5EF6, (int32_t)0x7D29CD8C,
+    (int32_t)0x1AB3CB0D, (int32_t)0x7D2F0E2B, (int32_t)0x1A9B361D, (int32_t)0x7D3449F5,
+    (int32_t)0x1A82A026, (int32_t)0x7D3980EC, (int32_t)0x1A6A0929, (int32_t)0x7D3EB30F,
+    (int32_t)0x1A517128, (int32_t)0x7D43E05E, (int32_t)0x1A38D823, (int32_t)0x7D4908D9,
+    (int32_t)0x1A203E1B, (int32_t)0x7D4E2C7F, (int32_t)0x1A07A311, (int32_t)0x7D534B50,
+    (int32_t)0x19EF0707, (int32_t)0x7D58654D, (int32_t)0x19D669FC, (int32_t)0x7D5D7A74,
+    (int32_t)0x19BDCBF3, (int32_t)0x7D628AC6, (int32_t)0x19A52CEB, (int32_t)0x7D679642,
+    (int32_t)0x198C8CE7, (int32_t)0x7D6C9CE9, (int32_t)0x1973EBE6, (int32_t)0x7D719EBA,
+    (int32_t)0x195B49EA, (int32_t)0x7D769BB5, (int32_t)0x1942A6F3, (int32_t)0x7D7B93DA,
+    (int32_t)0x192A0304, (int32_t)0x7D808728, (int32_t)0x19115E1C, (int32_t)0x7D85759F,
+    (int32_t)0x18F8B83C, (int32_t)0x7D8A5F40, (int32_t)0x18E01167, (int32_t)0x7D8F4409,
+    (int32_t)0x18C7699B, (int32_t)0x7D9423FC, (int32_t)0x18AEC0DB, (int32_t)0x7D98FF17,
+    (int32_t)0x18961728, (int32_t)0x7D9DD55A, (int32_t)0x187D6C82, (int32_t)0x7DA2A6C6,
+    (int32_t)0x1864C0EA, (int32_t)0x7DA77359, (int32_t)0x184C1461, (int32_t)0x7DAC3B15,
+    (int32_t)0x183366E9, (int32_t)0x7DB0FDF8, (int32_t)0x181AB881, (int32_t)0x7DB5BC02,
+    (int32_t)0x1802092C, (int32_t)0x7DBA7534, (int32_t)0x17E958EA, (int32_t)0x7DBF298D,
+    (int32_t)0x17D0A7BC, (int32_t)0x7DC3D90D, (int32_t)0x17B7F5A3, (int32_t)0x7DC883B4,
+    (int32_t)0x179F429F, (int32_t)0x7DCD2981, (int32_t)0x17868EB3, (int32_t)0x7DD1CA75,
+    (int32_t)0x176DD9DE, (int32_t)0x7DD6668F, (int32_t)0x17552422, (int32_t)0x7DDAFDCE,
+    (int32_t)0x173C6D80, (int32_t)0x7DDF9034, (int32_t)0x1723B5F9, (int32_t)0x7DE41DC0,
+    (int32_t)0x170AFD8D, (int32_t)0x7DE8A670, (int32_t)0x16F2443E, (int32_t)0x7DED2A47,
+    (int32_t)0x16D98A0C, (int32_t)0x7DF1A942, (int32_t)0x16C0CEF9, (int32_t)0x7DF62362,
+    (int32_t)0x16A81305, (int32_t)0x7DFA98A8, (int32_t)0x168F5632, (int32_t)0x7DFF0911,
+    (int32_t)0x1676987F, (int32_t)0x7E0374A0, (int32_t)0x165DD9F0, (int32_t)0x7E07DB52,
+    (int32_t)0x16451A83, (int32_t)0x7E0C3D29, (int32_t)0x162C5A3B, (int32_t)0x7E109A24,
+    (int32_t)0x16139918, (int32_t)0x7E14F242, (int32_t)0x15FAD71B, (int32_t)0x7E194584,
+    (int32_t)0x15E21445, (int32_t)0x7E1D93EA, (int32_t)0x15C95097, (int32_t)0x7E21DD73,
+    (int32_t)0x15B08C12, (int32_t)0x7E26221F, (int32_t)0x1597C6B7, (int32_t)0x7E2A61ED,
+    (int32_t)0x157F0086, (int32_t)0x7E2E9CDF, (int32_t)0x15663982, (int32_t)0x7E32D2F4,
+    (int32_t)0x154D71AA, (int32_t)0x7E37042A, (int32_t)0x1534A901, (int32_t)0x7E3B3083,
+    (int32_t)0x151BDF86, (int32_t)0x7E3F57FF, (int32_t)0x1503153A, (int32_t)0x7E437A9C,
+    (int32_t)0x14EA4A1F, (int32_t)0x7E47985B, (int32_t)0x14D17E36, (int32_t)0x7E4BB13C,
+    (int32_t)0x14B8B17F, (int32_t)0x7E4FC53E, (int32_t)0x149FE3FC, (int32_t)0x7E53D462,
+    (int32_t)0x148715AE, (int32_t)0x7E57DEA7, (int32_t)0x146E4694, (int32_t)0x7E5BE40C,
+    (int32_t)0x145576B1, (int32_t)0x7E5FE493, (int32_t)0x143CA605, (int32_t)0x7E63E03B,
+    (int32_t)0x1423D492, (int32_t)0x7E67D703, (int32_t)0x140B0258, (int32_t)0x7E6BC8EB,
+    (int32_t)0x13F22F58, (int32_t)0x7E6FB5F4, (int32_t)0x13D95B93, (int32_t)0x7E739E1D,
+    (int32_t)0x13C0870A, (int32_t)0x7E778166, (int32_t)0x13A7B1BF, (int32_t)0x7E7B5FCE,
+    (int32_t)0x138EDBB1, (int32_t)0x7E7F3957, (int32_t)0x137604E2, (int32_t)0x7E830DFF,
+    (int32_t)0x135D2D53, (int32_t)0x7E86DDC6, (int32_t)0x13445505, (int32_t)0x7E8AA8AC,
+    (int32_t)0x132B7BF9, (int32_t)0x7E8E6EB2, (int32_t)0x1312A230, (int32_t)0x7E922FD6,
+    (int32_t)0x12F9C7AA, (int32_t)0x7E95EC1A, (int32_t)0x12E0EC6A, (int32_t)0x7E99A37C,
+    (int32_t)0x12C8106F, (int32_t)0x7E9D55FC, (int32_t)0x12AF33BA, (int32_t)0x7EA1039B,
+    (int32_t)0x1296564D, (int32_t)0x7EA4AC58, (int32_t)0x127D7829, (int32_t)0x7EA85033,
+    (int32_t)0x1264994E, (int32_t)0x7EABEF2C, (int32_t)0x124BB9BE, (int32_t)0x7EAF8943,
+    (int32_t)0x1232D979, (int32_t)0x7EB31E78, (int32_t)0x1219F880, (int32_t)0x7EB6AECA,
+    (int32_t)0x120116D5, (int32_t)0x7EBA3A39, (int32_t)0x11E83478, (int32_t)0x7EBDC0C6,
+    (int32_t)0x11CF516A, (int32_t)0x7EC14270, (int32_t)0x11B66DAD, (int32_t)0x7EC4BF36,
+    (int32_t)0x119D8941, (int32_t)0x7EC8371A, (int32_t)0x1184A427, (int32_t)0x7ECBAA1A,
+    (int32_t)0x116BBE60, (int32_t)0x7ECF1837, (int32_t)0x1152D7ED, (int32_t)0x7ED28171,
+    (int32_t)0x1139F0CF, (int32_t)0x7ED5E5C6, (int32_t)0x11210907, (int32_t)0x7ED94538,
+    (int32_t)0x11082096, (int32_t)0x7EDC9FC6, (int32_t)0x10EF377D, (int32_t)0x7EDFF570,
+    (int32_t)0x10D64DBD, (int32_t)0x7EE34636, (int32_t)0x10BD6356, (int32_t)0x7EE69217,
+    (int32_t)0x10A4784B, (int32_t)0x7EE9D914, (int32_t)0x108B8C9B, (int32_t)0x7EED1B2C,
+    (int32_t)0x1072A048, (int32_t)0x7EF05860, (int32_t)0x1059B352, (int32_t)0x7EF390AE,
+    (int32_t)0x1040C5BB, (int32_t)0x7EF6C418, (int32_t)0x1027D784, (int32_t)0x7EF9F29D,
+    (int32_t)0x100EE8AD, (int32_t)0x7EFD1C3C, (int32_t)0x0FF5F938, (int32_t)0x7F0040F6,
+    (int32_t)0x0FDD0926, (int32_t)0x7F0360CB, (int32_t)0x0FC41876, (int32_t)0x7F067BBA,
+    (int32_t)0x0FAB272B, (int32_t)0x7F0991C4, (int32_t)0x0F923546, (int32_t)0x7F0CA2E7,
+    (int32_t)0x0F7942C7, (int32_t)0x7F0FAF25, (int32_t)0x0F604FAF, (int32_t)0x7F12B67C,
+    (int32_t)0x0F475BFF, (int32_t)0x7F15B8EE, (int32_t)0x0F2E67B8, (int32_t)0x7F18B679,
+    (int32_t)0x0F1572DC, (int32_t)0x7F1BAF1E, (int32_t)0x0EFC7D6B, (int32_t)0x7F1EA2DC,
+    (int32_t)0x0EE38766, (int32_t)0x7F2191B4, (int32_t)0x0ECA90CE, (int32_t)0x7F247BA5,
+    (int32_t)0x0EB199A4, (int32_t)0x7F2760AF, (int32_t)0x0E98A1E9, (int32_t)0x7F2A40D2,
+    (int32_t)0x0E7FA99E, (int32_t)0x7F2D1C0E, (int32_t)0x0E66B0C3, (int32_t)0x7F2FF263,
+    (int32_t)0x0E4DB75B, (int32_t)0x7F32C3D1, (int32_t)0x0E34BD66, (int32_t)0x7F359057,
+    (int32_t)0x0E1BC2E4, (int32_t)0x7F3857F6, (int32_t)0x0E02C7D7, (int32_t)0x7F3B1AAD,
+    (int32_t)0x0DE9CC40, (int32_t)0x7F3DD87C, (int32_t)0x0DD0D01F, (int32_t)0x7F409164,
+    (int32_t)0x0DB7D376, (int32_t)0x7F434563, (int32_t)0x0D9ED646, (int32_t)0x7F45F47B,
+    (int32_t)0x0D85D88F, (int32_t)0x7F489EAA, (int32_t)0x0D6CDA53, (int32_t)0x7F4B43F2,
+    (int32_t)0x0D53DB92, (int32_t)0x7F4DE451, (int32_t)0x0D3ADC4E, (int32_t)0x7F507FC7,
+    (int32_t)0x0D21DC87, (int32_t)0x7F531655, (int32_t)0x0D08DC3F, (int32_t)0x7F55A7FA,
+    (int32_t)0x0CEFDB76, (int32_t)0x7F5834B7, (int32_t)0x0CD6DA2D, (int32_t)0x7F5ABC8A,
+    (int32_t)0x0CBDD865, (int32_t)0x7F5D3F75, (int32_t)0x0CA4D620, (int32_t)0x7F5FBD77,
+    (int32_t)0x0C8BD35E, (int32_t)0x7F62368F, (int32_t)0x0C72D020, (int32_t)0x7F64AABF,
+    (int32_t)0x0C59CC68, (int32_t)0x7F671A05, (int32_t)0x0C40C835, (int32_t)0x7F698461,
+    (int32_t)0x0C27C389, (int32_t)0x7F6BE9D4, (int32_t)0x0C0EBE66, (int32_t)0x7F6E4A5E,
+    (int32_t)0x0BF5B8CB, (int32_t)0x7F70A5FE, (int32_t)0x0BDCB2BB, (int32_t)0x7F72FCB4,
+    (int32_t)0x0BC3AC35, (int32_t)0x7F754E80, (int32_t)0x0BAAA53B, (int32_t)0x7F779B62,
+    (int32_t)0x0B919DCF, (int32_t)0x7F79E35A, (int32_t)0x0B7895F0, (int32_t)0x7F7C2668,
+    (int32_t)0x0B5F8D9F, (int32_t)0x7F7E648C, (int32_t)0x0B4684DF, (int32_t)0x7F809DC5,
+    (int32_t)0x0B2D7BAF, (int32_t)0x7F82D214, (int32_t)0x0B147211, (int32_t)0x7F850179,
+    (int32_t)0x0AFB6805, (int32_t)0x7F872BF3, (int32_t)0x0AE25D8D, (int32_t)0x7F895182,
+    (int32_t)0x0AC952AA, (int32_t)0x7F8B7227, (int32_t)0x0AB0475C, (int32_t)0x7F8D8DE1,
+    (int32_t)0x0A973BA5, (int32_t)0x7F8FA4B0, (int32_t)0x0A7E2F85, (int32_t)0x7F91B694,
+    (int32_t)0x0A6522FE, (int32_t)0x7F93C38C, (int32_t)0x0A4C1610, (int32_t)0x7F95CB9A,
+    (int32_t)0x0A3308BD, (int32_t)0x7F97CEBD, (int32_t)0x0A19FB04, (int32_t)0x7F99CCF4,
+    (int32_t)0x0A00ECE8, (int32_t)0x7F9BC640, (int32_t)0x09E7DE6A, (int32_t)0x7F9DBAA0,
+    (int32_t)0x09CECF89, (int32_t)0x7F9FAA15, (int32_t)0x09B5C048, (int32_t)0x7FA1949E,
+    (int32_t)0x099CB0A7, (int32_t)0x7FA37A3C, (int32_t)0x0983A0A7, (int32_t)0x7FA55AEE,
+    (int32_t)0x096A9049, (int32_t)0x7FA736B4, (int32_t)0x09517F8F, (int32_t)0x7FA90D8E,
+    (int32_t)0x09386E78, (int32_t)0x7FAADF7C, (int32_t)0x091F5D06, (int32_t)0x7FACAC7F,
+    (int32_t)0x09064B3A, (int32_t)0x7FAE7495, (int32_t)0x08ED3916, (int32_t)0x7FB037BF,
+    (int32_t)0x08D42699, (int32_t)0x7FB1F5FC, (int32_t)0x08BB13C5, (int32_t)0x7FB3AF4E,
+    (int32_t)0x08A2009A, (int32_t)0x7FB563B3, (int32_t)0x0888ED1B, (int32_t)0x7FB7132B,
+    (int32_t)0x086FD947, (int32_t)0x7FB8BDB8, (int32_t)0x0856C520, (int32_t)0x7FBA6357,
+    (int32_t)0x083DB0A7, (int32_t)0x7FBC040A, (int32_t)0x08249BDD, (int32_t)0x7FBD9FD0,
+    (int32_t)0x080B86C2, (int32_t)0x7FBF36AA, (int32_t)0x07F27157, (int32_t)0x7FC0C896,
+    (int32_t)0x07D95B9E, (int32_t)0x7FC25596, (int32_t)0x07C04598, (int32_t)0x7FC3DDA9,
+    (int32_t)0x07A72F45, (int32_t)0x7FC560CF, (int32_t)0x078E18A7, (int32_t)0x7FC6DF08,
+    (int32_t)0x077501BE, (int32_t)0x7FC85854, (int32_t)0x075BEA8C, (int32_t)0x7FC9CCB2,
+    (int32_t)0x0742D311, (int32_t)0x7FCB3C23, (int32_t)0x0729BB4E, (int32_t)0x7FCCA6A7,
+    (int32_t)0x0710A345, (int32_t)0x7FCE0C3E, (int32_t)0x06F78AF6, (int32_t)0x7FCF6CE8,
+    (int32_t)0x06DE7262, (int32_t)0x7FD0C8A3, (int32_t)0x06C5598A, (int32_t)0x7FD21F72,
+    (int32_t)0x06AC406F, (int32_t)0x7FD37153, (int32_t)0x06932713, (int32_t)0x7FD4BE46,
+    (int32_t)0x067A0D76, (int32_t)0x7FD6064C, (int32_t)0x0660F398, (int32_t)0x7FD74964,
+    (int32_t)0x0647D97C, (int32_t)0x7FD8878E, (int32_t)0x062EBF22, (int32_t)0x7FD9C0CA,
+    (int32_t)0x0615A48B, (int32_t)0x7FDAF519, (int32_t)0x05FC89B8, (int32_t)0x7FDC247A,
+    (int32_t)0x05E36EA9, (int32_t)0x7FDD4EEC, (int32_t)0x05CA5361, (int32_t)0x7FDE7471,
+    (int32_t)0x05B137DF, (int32_t)0x7FDF9508, (int32_t)0x05981C26, (int32_t)0x7FE0B0B1,
+    (int32_t)0x057F0035, (int32_t)0x7FE1C76B, (int32_t)0x0565E40D, (int32_t)0x7FE2D938,
+    (int32_t)0x054CC7B1, (int32_t)0x7FE3E616, (int32_t)0x0533AB20, (int32_t)0x7FE4EE06,
+    (int32_t)0x051A8E5C, (int32_t)0x7FE5F108, (int32_t)0x05017165, (int32_t)0x7FE6EF1C,
+    (int32_t)0x04E8543E, (int32_t)0x7FE7E841, (int32_t)0x04CF36E5, (int32_t)0x7FE8DC78,
+    (int32_t)0x04B6195D, (int32_t)0x7FE9CBC0, (int32_t)0x049CFBA7, (int32_t)0x7FEAB61A,
+    (int32_t)0x0483DDC3, (int32_t)0x7FEB9B85, (int32_t)0x046ABFB3, (int32_t)0x7FEC7C02,
+    (int32_t)0x0451A177, (int32_t)0x7FED5791, (int32_t)0x04388310, (int32_t)0x7FEE2E30,
+    (int32_t)0x041F6480, (int32_t)0x7FEEFFE1, (int32_t)0x040645C7, (int32_t)0x7FEFCCA4,
+    (int32_t)0x03ED26E6, (int32_t)0x7FF09478, (int32_t)0x03D407DF, (int32_t)0x7FF1575D,
+    (int32_t)0x03BAE8B2, (int32_t)0x7FF21553, (int32_t)0x03A1C960, (int32_t)0x7FF2CE5B,
+    (int32_t)0x0388A9EA, (int32_t)0x7FF38274, (int32_t)0x036F8A51, (int32_t)0x7FF4319D,
+    (int32_t)0x03566A96, (int32_t)0x7FF4DBD9, (int32_t)0x033D4ABB, (int32_t)0x7FF58125,
+    (int32_t)0x03242ABF, (int32_t)0x7FF62182, (int32_t)0x030B0AA4, (int32_t)0x7FF6BCF0,
+    (int32_t)0x02F1EA6C, (int32_t)0x7FF75370, (int32_t)0x02D8CA16, (int32_t)0x7FF7E500,
+    (int32_t)0x02BFA9A4, (int32_t)0x7FF871A2, (int32_t)0x02A68917, (int32_t)0x7FF8F954,
+    (int32_t)0x028D6870, (int32_t)0x7FF97C18, (int32_t)0x027447B0, (int32_t)0x7FF9F9EC,
+    (int32_t)0x025B26D7, (int32_t)0x7FFA72D1, (int32_t)0x024205E8, (int32_t)0x7FFAE6C7,
+    (int32_t)0x0228E4E2, (int32_t)0x7FFB55CE, (int32_t)0x020FC3C6, (int32_t)0x7FFBBFE6,
+    (int32_t)0x01F6A297, (int32_t)0x7FFC250F, (int32_t)0x01DD8154, (int32_t)0x7FFC8549,
+    (int32_t)0x01C45FFE, (int32_t)0x7FFCE093, (int32_t)0x01AB3E97, (int32_t)0x7FFD36EE,
+    (int32_t)0x01921D20, (int32_t)0x7FFD885A, (int32_t)0x0178FB99, (int32_t)0x7FFDD4D7,
+    (int32_t)0x015FDA03, (int32_t)0x7FFE1C65, (int32_t)0x0146B860, (int32_t)0x7FFE5F03,
+    (int32_t)0x012D96B1, (int32_t)0x7FFE9CB2, (int32_t)0x011474F6, (int32_t)0x7FFED572,
+    (int32_t)0x00FB5330, (int32_t)0x7FFF0943, (int32_t)0x00E23160, (int32_t)0x7FFF3824,
+    (int32_t)0x00C90F88, (int32_t)0x7FFF6216, (int32_t)0x00AFEDA8, (int32_t)0x7FFF8719,
+    (int32_t)0x0096CBC1, (int32_t)0x7FFFA72C, (int32_t)0x007DA9D4, (int32_t)0x7FFFC251,
+    (int32_t)0x006487E3, (int32_t)0x7FFFD886, (int32_t)0x004B65EE, (int32_t)0x7FFFE9CB,
+    (int32_t)0x003243F5, (int32_t)0x7FFFF621, (int32_t)0x001921FB, (int32_t)0x7FFFFD88
+};
+
 const uint16_t plpBitRevIndexTable_fixed_16[PLPBITREVINDEXTABLE_FIXED_16_TABLE_LENGTH] = {
     /* radix 4, size 12 */
     8, 64, 16, 32, 24, 96, 40, 80, 56, 112, 88, 104
@@ -9131,3 +12827,103 @@ const float32_t hannWindow_f32_len512[512] = {
 	0.00184369f,  0.00135478f,  0.00094095f,  0.00060228f,  0.00033882f,
 	0.00015059f,  0.00003764f
 };
+
+// values_fb_32 in Q1.15, saturated to 32767
+const int16_t values_fb_32_q16[245] = {
+	  8752,  32487,   9519,    281,  23249,  20061,  12707,  31220,  10720,   1548,
+	 22048,  23528,   4161,   9240,  28607,  18402,    105,  14366,  32663,  15581,
+	 17187,  31157,  14827,   1611,  17941,  31347,  15919,    491,   1421,  16849,
+	 32277,  18657,   4081,  14111,  28687,  22854,   9084,   9914,  23684,  28341,
+	 15332,   2323,   4427,  17436,  30445,  22673,  10383,  10095,  22385,  30966,
+	 19355,   7745,   1802,  13413,  25023,  29115,  18146,   7177,   3653,  14622,
+	 25591,  29186,  18823,   8460,   3582,  13945,  24308,  30970,  21180,  11390,
+	  1599,   1798,  11588,  21378,  31169,  25030,  15781,   6532,   7738,  16987,
+	 26236,  30201,  21463,  12725,   3987,   2567,  11305,  20043,  28781,  28279,
+	 20024,  11769,   3514,   4489,  12744,  20999,  29254,  28289,  20490,  12691,
+	  4892,   4479,  12278,  20077,  27876,  30022,  22654,  15286,   7918,    550,
+	  2746,  10114,  17482,  24850,  32218,  26327,  19367,  12406,   5445,   6441,
+	 13401,  20362,  27323,  31336,  24760,  18184,  11608,   5032,   1432,   8008,
+	 14584,  21160,  27736,  31309,  25097,  18884,  12672,   6459,    247,   1459,
+	  7671,  13884,  20096,  26309,  32521,  27132,  21262,  15393,   9524,   3655,
+	  5636,  11506,  17375,  23244,  29113,  30676,  25131,  19586,  14041,   8496,
+	  2951,   2092,   7637,  13182,  18727,  24272,  29817,  30318,  25079,  19841,
+	 14602,   9364,   4125,   2450,   7689,  12927,  18166,  23404,  28643,  31716,
+	 26767,  21819,  16870,  11921,   6972,   2023,   1052,   6000,  10949,  15898,
+	 20847,  25796,  30745,  30003,  25328,  20653,  15977,  11302,   6626,   1951,
+	  2765,   7440,  12115,  16791,  21466,  26142,  30817,  30194,  25777,  21360,
+	 16943,  12526,   8109,   3691,   2574,   6991,  11408,  15825,  20242,  24659,
+	 29077,  32082,  27910,  23737,  19564,  15391,  11218,   7045,   2872,    686,
+	  4858,   9031,  13204,  17377,  21550,  25723,  29896,  31539,  27596,  23654,
+	 19712,  15769,  11827,   7885,   3942
+};
+
+// hannWindow_f32_len512 in Q1.15, saturated to 32767
+const int16_t hannWindow_q16_len512[512] = {
+	     0,      1,      5,     11,     20,     31,     44,     60,     79,    100,
+	   123,    149,    177,    208,    241,    277,    315,    355,    398,    443,
+	   491,    541,    593,    648,    705,    765,    827,    891,    958,   1027,
+	  1098,   1171,   1247,   1325,   1406,   1488,   1573,   1660,   1749,   1841,
+	  1935,   2030,   2128,   2229,   2331,   2435,   2542,   2651,   2761,   2874,
+	  2989,   3105,   3224,   3345,   3468,   3592,   3719,   3847,   3978,   4110,
+	  4244,   4380,   4518,   4657,   4799,   4942,   5087,   5233,   5381,   5531,
+	  5682,   5835,   5990,   6146,   6304,   6463,   6624,   6786,   6950,   7115,
+	  7282,   7449,   7619,   7789,   7961,   8134,   8308,   8484,   8661,   8839,
+	  9018,   9198,   9379,   9561,   9745,   9929,  10114,  10300,  10487,  10676,
+	 10864,  11054,  11245,  11436,  11628,  11821,  12014,  12208,  12403,  12598,
+	 12794,  12991,  13188,  13385,  13583,  13781,  13980,  14179,  14378,  14578,
+	 14778,  14978,  15179,  15379,  15580,  15781,  15982,  16183,  16384,  16585,
+	 16786,  16987,  17188,  17389,  17589,  17790,  17990,  18190,  18390,  18589,
+	 18788,  18987,  19185,  19383,  19580,  19777,  19974,  20170,  20365,  20560,
+	 20754,  20947,  21140,  21332,  21523,  21714,  21904,  22092,  22281,  22468,
+	 22654,  22839,  23023,  23207,  23389,  23570,  23750,  23929,  24107,  24284,
+	 24460,  24634,  24807,  24979,  25149,  25319,  25486,  25653,  25818,  25982,
+	 26144,  26305,  26464,  26622,  26778,  26933,  27086,  27237,  27387,  27535,
+	 27681,  27826,  27969,  28111,  28250,  28388,  28524,  28658,  28790,  28921,
+	 29049,  29176,  29300,  29423,  29544,  29663,  29779,  29894,  30007,  30117,
+	 30226,  30333,  30437,  30539,  30640,  30738,  30833,  30927,  31019,  31108,
+	 31195,  31280,  31362,  31443,  31521,  31597,  31670,  31741,  31810,  31877,
+	 31941,  32003,  32063,  32120,  32175,  32227,  32277,  32325,  32370,  32413,
+	 32453,  32491,  32527,  32560,  32591,  32619,  32645,  32668,  32689,  32708,
+	 32724,  32737,  32748,  32757,  32763,  32767,  32767,  32767,  32763,  32757,
+	 32748,  32737,  32724,  32708,  32689,  32668,  32645,  32619,  32591,  32560,
+	 32527,  32491,  32453,  32413,  32370,  32325,  32277,  32227,  32175,  32120,
+	 32063,  32003,  31941,  31877,  31810,  31741,  31670,  31597,  31521,  31443,
+	 31362,  31280,  31195,  31108,  31019,  30927,  30833,  30738,  30640,  30539,
+	 30437,  30333,  30226,  30117,  30007,  29894,  29779,  29663,  29544,  29423,
+	 29300,  29176,  29049,  28921,  28790,  28658,  28524,  28388,  28250,  28111,
+	 27969,  27826,  27681,  27535,  27387,  27237,  27086,  26933,  26778,  26622,
+	 26464,  26305,  26144,  25982,  25818,  25653,  25486,  25319,  25149,  24979,
+	 24807,  24634,  24460,  24284,  24107,  23929,  23750,  23570,  23389,  23207,
+	 23023,  22839,  22654,  22468,  22281,  22092,  21904,  21714,  21523,  21332,
+	 21140,  20947,  20754,  20560,  20365,  20170,  19974,  19777,  19580,  19383,
+	 19185,  18987,  18788,  18589,  18390,  18190,  17990,  17790,  17589,  17389,
+	 17188,  16987,  16786,  16585,  16384,  16183,  15982,  15781,  15580,  15379,
+	 15179,  14978,  14778,  14578,  14378,  14179,  13980,  13781,  13583,  13385,
+	 13188,  12991,  12794,  12598,  12403,  12208,  12014,  11821,  11628,  11436,
+	 11245,  11054,  10864,  10676,  10487,  10300,  10114,   9929,   9745,   9561,
+	  9379,   9198,   9018,   8839,   8661,   8484,   8308,   8134,   7961,   7789,
+	  7619,   7449,   7282,   7115,   6950,   6786,   6624,   6463,   6304,   6146,
+	  5990,   5835,   5682,   5531,   5381,   5233,   5087,   4942,   4799,   4657,
+	  4518,   4380,   4244,   4110,   3978,   3847,   3719,   3592,   3468,   3345,
+	  3224,   3105,   2989,   2874,   2761,   2651,   2542,   2435,   2331,   2229,
+	  2128,   2030,   1935,   1841,   1749,   1660,   1573,   1488,   1406,   1325,
+	  1247,   1171,   1098,   1027,    958,    891,    827,    765,    705,    648,
+	   593,    541,    491,    443,    398,    355,    315,    277,    241,    208,
+	   177,    149,    123,    100,     79,     60,     44,     31,     20,     11,
+	     5,      1
+};
+
+/**
+  @par
+  Table of log2(1 + i/32) for i = 0..32 in Q1.15, used for the fixed-point logarithm of
+  plp_mfcc_q16. It is generated by
+  <pre>log2Table_q16[i] = round(log2(1 + i / 32.0) * 2^15)</pre>
+  Values between the entries are linearly interpolated, the maximal error is below 2e-4.
+ */
+const uint16_t log2Table_q16[33] = {
+	     0,   1455,   2866,   4236,   5568,   6863,   8124,   9352,
+	 10549,  11716,  12855,  13968,  15055,  16117,  17156,  18173,
+	 19168,  20143,  21098,  22034,  22952,  23852,  24736,  25604,
+	 26455,  27292,  28114,  28922,  29717,  30498,  31267,  32024,
+	 32768
+};
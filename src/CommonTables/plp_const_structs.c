@@ -99,6 +99,96 @@ const plp_cfft_instance_q32 plp_cfft_sR_q32_len4096 = { 4096, twiddleCoef_4096_q
                                                         PLPBITREVINDEXTABLE_FIXED_4096_TABLE_LENGTH };
 
 
+const plp_rfft_instance_q16 plp_rfft_sR_q16_len32 = { 32, &plp_cfft_sR_q16_len16,
+                                                      twiddleCoef_32_q16 };
+
+const plp_rfft_instance_q16 plp_rfft_sR_q16_len64 = { 64, &plp_cfft_sR_q16_len32,
+                                                      twiddleCoef_64_q16 };
+
+const plp_rfft_instance_q16 plp_rfft_sR_q16_len128 = { 128, &plp_cfft_sR_q16_len64,
+                                                       twiddleCoef_128_q16 };
+
+const plp_rfft_instance_q16 plp_rfft_sR_q16_len256 = { 256, &plp_cfft_sR_q16_len128,
+                                                       twiddleCoef_256_q16 };
+
+const plp_rfft_instance_q16 plp_rfft_sR_q16_len512 = { 512, &plp_cfft_sR_q16_len256,
+                                                       twiddleCoef_512_q16 };
+
+const plp_rfft_instance_q16 plp_rfft_sR_q16_len1024 = { 1024, &plp_cfft_sR_q16_len512,
+                                                        twiddleCoef_1024_q16 };
+
+const plp_rfft_instance_q16 plp_rfft_sR_q16_len2048 = { 2048, &plp_cfft_sR_q16_len1024,
+                                                        twiddleCoef_2048_q16 };
+
+const plp_rfft_instance_q16 plp_rfft_sR_q16_len4096 = { 4096, &plp_cfft_sR_q16_len2048,
+                                                        twiddleCoef_4096_q16 };
+
+
+const plp_rfft_instance_q32 plp_rfft_sR_q32_len32 = { 32, &plp_cfft_sR_q32_len16,
+                                                      twiddleCoef_32_q32 };
+
+const plp_rfft_instance_q32 plp_rfft_sR_q32_len64 = { 64, &plp_cfft_sR_q32_len32,
+                                                      twiddleCoef_64_q32 };
+
+const plp_rfft_instance_q32 plp_rfft_sR_q32_len128 = { 128, &plp_cfft_sR_q32_len64,
+                                                       twiddleCoef_128_q32 };
+
+const plp_rfft_instance_q32 plp_rfft_sR_q32_len256 = { 256, &plp_cfft_sR_q32_len128,
+                                                       twiddleCoef_256_q32 };
+
+const plp_rfft_instance_q32 plp_rfft_sR_q32_len512 = { 512, &plp_cfft_sR_q32_len256,
+                                                       twiddleCoef_512_q32 };
+
+const plp_rfft_instance_q32 plp_rfft_sR_q32_len1024 = { 1024, &plp_cfft_sR_q32_len512,
+                                                        twiddleCoef_1024_q32 };
+
+const plp_rfft_instance_q32 plp_rfft_sR_q32_len2048 = { 2048, &plp_cfft_sR_q32_len1024,
+                                                        twiddleCoef_2048_q32 };
+
+const plp_rfft_instance_q32 plp_rfft_sR_q32_len4096 = { 4096, &plp_cfft_sR_q32_len2048,
+                                                        twiddleCoef_4096_q32 };
+
+
+const plp_dct_instance_q16 plp_dct_sR_q16_len32 = { 32, &plp_cfft_sR_q16_len16,
+                                                    twiddleCoef_32_q16, twiddleCoef_dct_32_q16 };
+
+const plp_dct_instance_q16 plp_dct_sR_q16_len64 = { 64, &plp_cfft_sR_q16_len32,
+                                                    twiddleCoef_64_q16, twiddleCoef_dct_64_q16 };
+
+const plp_dct_instance_q16 plp_dct_sR_q16_len128 = { 128, &plp_cfft_sR_q16_len64,
+                                                     twiddleCoef_128_q16, twiddleCoef_dct_128_q16 };
+
+const plp_dct_instance_q16 plp_dct_sR_q16_len256 = { 256, &plp_cfft_sR_q16_len128,
+                                                     twiddleCoef_256_q16, twiddleCoef_dct_256_q16 };
+
+const plp_dct_instance_q16 plp_dct_sR_q16_len512 = { 512, &plp_cfft_sR_q16_len256,
+                                                     twiddleCoef_512_q16, twiddleCoef_dct_512_q16 };
+
+const plp_dct_instance_q16 plp_dct_sR_q16_len1024 = { 1024, &plp_cfft_sR_q16_len512,
+                                                      twiddleCoef_1024_q16,
+                                                      twiddleCoef_dct_1024_q16 };
+
+
+const plp_dct_instance_q32 plp_dct_sR_q32_len32 = { 32, &plp_cfft_sR_q32_len16,
+                                                    twiddleCoef_32_q32, twiddleCoef_dct_32_q32 };
+
+const plp_dct_instance_q32 plp_dct_sR_q32_len64 = { 64, &plp_cfft_sR_q32_len32,
+                                                    twiddleCoef_64_q32, twiddleCoef_dct_64_q32 };
+
+const plp_dct_instance_q32 plp_dct_sR_q32_len128 = { 128, &plp_cfft_sR_q32_len64,
+                                                     twiddleCoef_128_q32, twiddleCoef_dct_128_q32 };
+
+const plp_dct_instance_q32 plp_dct_sR_q32_len256 = { 256, &plp_cfft_sR_q32_len128,
+                                                     twiddleCoef_256_q32, twiddleCoef_dct_256_q32 };
+
+const plp_dct_instance_q32 plp_dct_sR_q32_len512 = { 512, &plp_cfft_sR_q32_len256,
+                                                     twiddleCoef_512_q32, twiddleCoef_dct_512_q32 };
+
+const plp_dct_instance_q32 plp_dct_sR_q32_len1024 = { 1024, &plp_cfft_sR_q32_len512,
+                                                      twiddleCoef_1024_q32,
+                                                      twiddleCoef_dct_1024_q32 };
+
+
 const plp_fft_instance_f32 plp_rfft_sR_f32_len32 = { 32, 0, (float32_t *)twiddleCoef_rfft_32,
                                                         (uint16_t *)bit_rev_radix2_LUT_32 };
 
@@ -118,6 +208,28 @@ const plp_triangular_filter_f32 plp_triangular_filter_f32_32 = {
 	32
 };
 
+const plp_triangular_filter_q16 plp_triangular_filter_q16_32 = {
+	values_fb_32_q16,
+	startingIndices_fb_32,
+	filterLengths_fb_32,
+	32
+};
+
+/* Cost models for PLP_NPE_AUTO, calibrated with test/mrWolf/npe_model.py on the sweep in
+ * test/mrWolf/mat_mul/test_fct/performance.csv. The sweep only contains the integer versions. The
+ * fix-point and float versions use the model of the integer version with the same word size, which
+ * is an approximation: the fix-point kernels additionally round and shift every output, and the
+ * float kernel uses the FPU instead of the integer MAC unit. The models of these versions can be
+ * calibrated on a bench file of the mat_mul test folder (bench.py run -t '^mat_mul$'), which
+ * npe_model.py fits for every version with a serial and a parallel run. */
+const plp_npe_cost_model plp_npe_model_mat_mult_i32 = { 29, 126 };
+const plp_npe_cost_model plp_npe_model_mat_mult_i16 = { 41, 161 };
+const plp_npe_cost_model plp_npe_model_mat_mult_i8 = { 42, 172 };
+const plp_npe_cost_model plp_npe_model_mat_mult_q32 = { 29, 126 };
+const plp_npe_cost_model plp_npe_model_mat_mult_q16 = { 41, 161 };
+const plp_npe_cost_model plp_npe_model_mat_mult_q8 = { 42, 172 };
+const plp_npe_cost_model plp_npe_model_mat_mult_f32 = { 29, 126 };
+
 
 const plp_dwt_wavelet_f32 PLP_DWT_HAAR_f32 = {
     .length = 2,
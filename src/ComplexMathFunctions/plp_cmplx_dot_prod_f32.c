@@ -81,6 +81,7 @@ void plp_cmplx_dot_prod_f32(const float32_t *__restrict__ pSrcA,
                             uint32_t numSamples,
                             float32_t *__restrict__ realResult,
                             float32_t *__restrict__ imagResult) {
+    PLP_PROFILE_FUNCTION();
 
     if (hal_cluster_id() == ARCHI_FC_CID) {
         printf("error: FC doesn't have FPU\n");
@@ -81,6 +81,7 @@ void plp_cmplx_dot_prod_i16(const int16_t *__restrict__ pSrcA,
                             uint32_t numSamples,
                             int16_t *__restrict__ realResult,
                             int16_t *__restrict__ imagResult) {
+    PLP_PROFILE_FUNCTION();
 
     if (hal_cluster_id() == ARCHI_FC_CID) {
         plp_cmplx_dot_prod_i16_rv32im(pSrcA, pSrcB, numSamples, realResult, imagResult);
@@ -83,6 +83,7 @@ void plp_cmplx_dot_prod_q32(const int32_t *__restrict__ pSrcA,
                             uint32_t deciPoint,
                             int32_t *__restrict__ realResult,
                             int32_t *__restrict__ imagResult) {
+    PLP_PROFILE_FUNCTION();
 
     if (hal_cluster_id() == ARCHI_FC_CID) {
         plp_cmplx_dot_prod_q32_rv32im(pSrcA, pSrcB, numSamples, deciPoint, realResult, imagResult);
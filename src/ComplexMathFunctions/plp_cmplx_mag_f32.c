@@ -79,6 +79,7 @@
 void plp_cmplx_mag_f32(const float32_t *pSrc,
                        float32_t *pRes,
                        uint32_t numSamples){
+    PLP_PROFILE_FUNCTION();
     
     if (hal_cluster_id() == ARCHI_FC_CID){
         printf("error: FC doesn't have FPU\n");
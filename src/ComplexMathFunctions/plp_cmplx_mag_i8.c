@@ -79,6 +79,7 @@
 void plp_cmplx_mag_i8(const int8_t *pSrc,
                       int8_t *pRes,
                       uint32_t numSamples){
+    PLP_PROFILE_FUNCTION();
     printf("Error: plp_sqrt_q8 not implemented!\n");
     return;
     if (hal_cluster_id() == ARCHI_FC_CID){
@@ -73,6 +73,7 @@ void plp_cmplx_mag_q16(const int16_t *pSrc,
                        const uint32_t fracBits,
                        int16_t *pRes,
                        uint32_t numSamples) {
+    PLP_PROFILE_FUNCTION();
 
     if (hal_cluster_id() == ARCHI_FC_CID){
         plp_cmplx_mag_q16s_rv32im(pSrc, fracBits, pRes, numSamples);
@@ -75,6 +75,7 @@
 void plp_cmplx_mag_squared_i8(const int8_t *__restrict__ pSrc,
                               int8_t *__restrict__ pDst,
                               uint32_t numSamples) {
+    PLP_PROFILE_FUNCTION();
 
     if (hal_cluster_id() == ARCHI_FC_CID) {
         plp_cmplx_mag_squared_i8_rv32im(pSrc, pDst, numSamples);
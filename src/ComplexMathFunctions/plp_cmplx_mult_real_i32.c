@@ -77,6 +77,7 @@ void plp_cmplx_mult_real_i32(const int32_t *__restrict__ pSrcCmplx,
                              const int32_t *__restrict__ pSrcReal,
                              int32_t *__restrict__ pDst,
                              uint32_t numSamples) {
+    PLP_PROFILE_FUNCTION();
 
     if (hal_cluster_id() == ARCHI_FC_CID) {
         plp_cmplx_mult_real_i32_rv32im(pSrcCmplx, pSrcReal, pDst, numSamples);
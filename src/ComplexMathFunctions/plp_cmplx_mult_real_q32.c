@@ -79,6 +79,7 @@ void plp_cmplx_mult_real_q32(const int32_t *__restrict__ pSrcCmplx,
                              int32_t *__restrict__ pDst,
                              uint32_t deciPoint,
                              uint32_t numSamples) {
+    PLP_PROFILE_FUNCTION();
 
     if (hal_cluster_id() == ARCHI_FC_CID) {
         plp_cmplx_mult_real_q32_rv32im(pSrcCmplx, pSrcReal, pDst, deciPoint, numSamples);
@@ -43,6 +43,7 @@
  */
 
 float32_t plp_sin_f32(float32_t x) {
+    PLP_PROFILE_FUNCTION();
 
     if (hal_cluster_id() == ARCHI_FC_CID) {
         return 0.0f;
@@ -44,6 +44,7 @@
  */
 
 int16_t plp_sin_q16(int16_t x) {
+    PLP_PROFILE_FUNCTION();
 
     if (hal_cluster_id() == ARCHI_FC_CID) {
         return plp_sin_q16s_rv32im(x);
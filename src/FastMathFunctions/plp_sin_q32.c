@@ -44,6 +44,7 @@
  */
 
 int32_t plp_sin_q32(int32_t x) {
+    PLP_PROFILE_FUNCTION();
 
     if (hal_cluster_id() == ARCHI_FC_CID) {
         return plp_sin_q32s_rv32im(x);
@@ -56,6 +56,7 @@
  */
 
 void plp_sqrt_f32(const float *__restrict__ pSrc, float *__restrict__ pRes) {
+    PLP_PROFILE_FUNCTION();
 
     if (hal_cluster_id() == ARCHI_FC_CID) {
         *pRes = 0.f;
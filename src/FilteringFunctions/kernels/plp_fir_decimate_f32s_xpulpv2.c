@@ -0,0 +1,123 @@
+/* ----------------------------------------------------------------------
+ * Project:      PULP DSP Library
+ * Title:        plp_fir_decimate_f32s_xpulpv2.c
+ * Description:  FIR decimation of floating-point vectors for XPULPV2
+ *
+ * $Date:        19. Oct 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup FirMultirate
+*/
+
+/**
+   @addtogroup FirMultirateKernels
+   @{
+*/
+
+/* Dot product of n samples */
+static inline float32_t plp_fir_dot_f32(const float32_t *px, const float32_t *pc, uint32_t n) {
+    uint32_t tapCnt;
+    float32_t acc0 = 0.0f, acc1 = 0.0f;
+
+    for (tapCnt = n >> 1U; tapCnt > 0U; tapCnt--) {
+        acc0 += px[0] * pc[0];
+        acc1 += px[1] * pc[1];
+        px += 2;
+        pc += 2;
+    }
+    if (n & 1U) {
+        acc0 += (*px) * (*pc);
+    }
+    return acc0 + acc1;
+}
+
+/**
+   @brief FIR decimation of floating-point vectors kernel for XPULPV2 extension.
+   @param[in]  pSrc      points to the input samples, including the numTaps - 1 past samples
+   @param[in]  pCoeffs   points to the coefficients in time-reversed order
+   @param[in]  numTaps   number of filter coefficients
+   @param[in]  M         decimation factor
+   @param[in]  blkSize   number of output samples
+   @param[out] pDst      points to the output samples
+   @return     none
+*/
+
+void plp_fir_decimate_f32s_xpulpv2(const float32_t *__restrict__ pSrc,
+                                   const float32_t *__restrict__ pCoeffs,
+                                   uint32_t numTaps,
+                                   uint32_t M,
+                                   uint32_t blkSize,
+                                   float32_t *__restrict__ pDst) {
+
+    uint32_t blkCnt;
+
+#if defined(PLP_MATH_LOOPUNROLL)
+    const float32_t *px0, *px1;
+    const float32_t *pc;
+    float32_t acc0, acc1;
+    float32_t c;
+    uint32_t tapCnt;
+#endif
+
+#if defined(PLP_MATH_LOOPUNROLL)
+
+    /* Compute two outputs at a time, such that each coefficient is loaded only once. */
+    for (blkCnt = blkSize >> 1U; blkCnt > 0U; blkCnt--) {
+        px0 = pSrc;
+        px1 = pSrc + M;
+        pc = pCoeffs;
+        acc0 = 0.0f;
+        acc1 = 0.0f;
+
+        for (tapCnt = numTaps; tapCnt > 0U; tapCnt--) {
+            c = *pc++;
+            acc0 += (*px0++) * c;
+            acc1 += (*px1++) * c;
+        }
+
+        *pDst++ = acc0;
+        *pDst++ = acc1;
+
+        pSrc += 2 * M;
+    }
+
+    if (blkSize & 1U) {
+        *pDst = plp_fir_dot_f32(pSrc, pCoeffs, numTaps);
+    }
+
+#else // PLP_MATH_LOOPUNROLL
+
+    for (blkCnt = blkSize; blkCnt > 0U; blkCnt--) {
+        *pDst++ = plp_fir_dot_f32(pSrc, pCoeffs, numTaps);
+        pSrc += M;
+    }
+
+#endif // PLP_MATH_LOOPUNROLL
+}
+
+/**
+   @} end of FirMultirateKernels group
+*/
@@ -0,0 +1,143 @@
+/* ----------------------------------------------------------------------
+ * Project:      PULP DSP Library
+ * Title:        plp_fir_decimate_q16s_xpulpv2.c
+ * Description:  FIR decimation of 16-bit fixed-point vectors for XPULPV2
+ *
+ * $Date:        19. Oct 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup FirMultirate
+*/
+
+/**
+   @addtogroup FirMultirateKernels
+   @{
+*/
+
+/* Dot product of n samples, accumulated on acc */
+static inline int32_t plp_fir_dot_q16(const int16_t *px,
+                                      const int16_t *pc,
+                                      uint32_t n,
+                                      int32_t acc) {
+    uint32_t tapCnt;
+
+    for (tapCnt = n >> 1U; tapCnt > 0U; tapCnt--) {
+        acc = __SUMDOTP2(*((v2s *)px), *((v2s *)pc), acc);
+        px += 2;
+        pc += 2;
+    }
+    if (n & 1U) {
+        acc = __MAC(acc, *px, *pc);
+    }
+    return acc;
+}
+
+/**
+   @brief FIR decimation of 16-bit fixed-point vectors kernel for XPULPV2 extension.
+   @param[in]  pSrc      points to the input samples, including the numTaps - 1 past samples
+   @param[in]  pCoeffs   points to the coefficients in time-reversed order
+   @param[in]  numTaps   number of filter coefficients
+   @param[in]  M         decimation factor
+   @param[in]  fracBits  number of fractional bits of the coefficients
+   @param[in]  blkSize   number of output samples
+   @param[out] pDst      points to the output samples
+   @return     none
+
+   @par Exploiting SIMD instructions
+   The 16 bit samples and coefficients are packed two by two into 32 bit vectors, and two outputs
+   are computed at a time with the SIMD dot product instructions, sharing the vector loads.
+*/
+
+void plp_fir_decimate_q16s_xpulpv2(const int16_t *__restrict__ pSrc,
+                                   const int16_t *__restrict__ pCoeffs,
+                                   uint32_t numTaps,
+                                   uint32_t M,
+                                   uint32_t fracBits,
+                                   uint32_t blkSize,
+                                   int16_t *__restrict__ pDst) {
+
+    int32_t acc0;
+    int32_t round = fracBits ? 1 << (fracBits - 1U) : 0;
+    uint32_t blkCnt;
+
+#if defined(PLP_MATH_LOOPUNROLL)
+    const int16_t *px0, *px1;
+    const int16_t *pc;
+    int32_t acc1;
+    uint32_t tapCnt;
+    v2s c, x0, x1;
+#endif
+
+#if defined(PLP_MATH_LOOPUNROLL)
+
+    /* Compute two outputs at a time, such that each coefficient pair is loaded only once. */
+    for (blkCnt = blkSize >> 1U; blkCnt > 0U; blkCnt--) {
+        px0 = pSrc;
+        px1 = pSrc + M;
+        pc = pCoeffs;
+        acc0 = round;
+        acc1 = round;
+
+        for (tapCnt = numTaps >> 1U; tapCnt > 0U; tapCnt--) {
+            c = *((v2s *)pc);
+            x0 = *((v2s *)px0);
+            x1 = *((v2s *)px1);
+            acc0 = __SUMDOTP2(x0, c, acc0);
+            acc1 = __SUMDOTP2(x1, c, acc1);
+            pc += 2;
+            px0 += 2;
+            px1 += 2;
+        }
+        if (numTaps & 1U) {
+            acc0 = __MAC(acc0, *px0, *pc);
+            acc1 = __MAC(acc1, *px1, *pc);
+        }
+
+        *pDst++ = (int16_t)__CLIP(acc0 >> fracBits, 15);
+        *pDst++ = (int16_t)__CLIP(acc1 >> fracBits, 15);
+
+        pSrc += 2 * M;
+    }
+
+    if (blkSize & 1U) {
+        acc0 = plp_fir_dot_q16(pSrc, pCoeffs, numTaps, round);
+        *pDst = (int16_t)__CLIP(acc0 >> fracBits, 15);
+    }
+
+#else // PLP_MATH_LOOPUNROLL
+
+    for (blkCnt = blkSize; blkCnt > 0U; blkCnt--) {
+        acc0 = plp_fir_dot_q16(pSrc, pCoeffs, numTaps, round);
+        *pDst++ = (int16_t)__CLIP(acc0 >> fracBits, 15);
+        pSrc += M;
+    }
+
+#endif // PLP_MATH_LOOPUNROLL
+}
+
+/**
+   @} end of FirMultirateKernels group
+*/
@@ -0,0 +1,76 @@
+/* ----------------------------------------------------------------------
+ * Project:      PULP DSP Library
+ * Title:        plp_fir_decimate_q32p_xpulpv2.c
+ * Description:  Parallel FIR decimation of 32-bit fixed-point vectors for XPULPV2
+ *
+ * $Date:        19. Oct 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup FirMultirate
+*/
+
+/**
+   @addtogroup FirMultirateKernels
+   @{
+*/
+
+/**
+   @brief Parallel FIR decimation of 32-bit fixed-point vectors kernel for XPULPV2 extension.
+   Each core computes a contiguous part of the output samples with the single-core kernel.
+   @param[in]  task_args  pointer to plp_fir_multirate_instance_q32 struct initialized by
+                          plp_fir_decimate_q32_parallel
+   @return     none
+*/
+
+void plp_fir_decimate_q32p_xpulpv2(void *task_args) {
+
+    plp_fir_multirate_instance_q32 *args = (plp_fir_multirate_instance_q32 *)task_args;
+
+    uint32_t core_id = hal_core_id();
+    uint32_t blkSizePE = (args->blkSize + args->nPE - 1) / args->nPE;
+    uint32_t start = core_id * blkSizePE;
+    uint32_t blkSize;
+
+    if (start < args->blkSize) {
+        blkSize = args->blkSize - start;
+        if (blkSize > blkSizePE) {
+            blkSize = blkSizePE;
+        }
+        plp_fir_decimate_q32s_xpulpv2(args->pSrc + start * args->factor,
+                                      args->pCoeffs,
+                                      args->numTaps,
+                                      args->factor,
+                                      args->fracBits,
+                                      blkSize,
+                                      args->pDst + start);
+    }
+
+    hal_team_barrier();
+}
+
+/**
+   @} end of FirMultirateKernels group
+*/
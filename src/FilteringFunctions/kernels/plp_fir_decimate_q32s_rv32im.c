@@ -0,0 +1,84 @@
+/* ----------------------------------------------------------------------
+ * Project:      PULP DSP Library
+ * Title:        plp_fir_decimate_q32s_rv32im.c
+ * Description:  FIR decimation of 32-bit fixed-point vectors for RV32IM
+ *
+ * $Date:        19. Oct 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup FirMultirate
+*/
+
+/**
+   @addtogroup FirMultirateKernels
+   @{
+*/
+
+/**
+   @brief FIR decimation of 32-bit fixed-point vectors kernel for RV32IM extension.
+   @param[in]  pSrc      points to the input samples, including the numTaps - 1 past samples
+   @param[in]  pCoeffs   points to the coefficients in time-reversed order
+   @param[in]  numTaps   number of filter coefficients
+   @param[in]  M         decimation factor
+   @param[in]  fracBits  number of fractional bits of the coefficients
+   @param[in]  blkSize   number of output samples
+   @param[out] pDst      points to the output samples
+   @return     none
+*/
+
+void plp_fir_decimate_q32s_rv32im(const int32_t *__restrict__ pSrc,
+                                  const int32_t *__restrict__ pCoeffs,
+                                  uint32_t numTaps,
+                                  uint32_t M,
+                                  uint32_t fracBits,
+                                  uint32_t blkSize,
+                                  int32_t *__restrict__ pDst) {
+
+    const int32_t *px;
+    const int32_t *pc;
+    int32_t sum;
+    int32_t round = fracBits ? 1 << (fracBits - 1U) : 0;
+    uint32_t blkCnt, tapCnt;
+
+    for (blkCnt = blkSize; blkCnt > 0U; blkCnt--) {
+        px = pSrc;
+        pc = pCoeffs;
+        sum = 0;
+
+        for (tapCnt = numTaps; tapCnt > 0U; tapCnt--) {
+            sum += ((*px++) * (*pc++) + round) >> fracBits;
+        }
+
+        *pDst++ = sum;
+
+        /* Advance the window by the decimation factor */
+        pSrc += M;
+    }
+}
+
+/**
+   @} end of FirMultirateKernels group
+*/
@@ -0,0 +1,132 @@
+/* ----------------------------------------------------------------------
+ * Project:      PULP DSP Library
+ * Title:        plp_fir_interpolate_f32s_xpulpv2.c
+ * Description:  FIR interpolation of floating-point vectors for XPULPV2
+ *
+ * $Date:        19. Oct 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup FirMultirate
+*/
+
+/**
+   @addtogroup FirMultirateKernels
+   @{
+*/
+
+/* Dot product of n samples */
+static inline float32_t plp_fir_dot_f32(const float32_t *px, const float32_t *pc, uint32_t n) {
+    uint32_t tapCnt;
+    float32_t acc0 = 0.0f, acc1 = 0.0f;
+
+    for (tapCnt = n >> 1U; tapCnt > 0U; tapCnt--) {
+        acc0 += px[0] * pc[0];
+        acc1 += px[1] * pc[1];
+        px += 2;
+        pc += 2;
+    }
+    if (n & 1U) {
+        acc0 += (*px) * (*pc);
+    }
+    return acc0 + acc1;
+}
+
+/**
+   @brief FIR interpolation of floating-point vectors kernel for XPULPV2 extension.
+   @param[in]  pSrc         points to the input samples, including the phaseLength - 1 past
+                            samples
+   @param[in]  pCoeffs      points to the polyphase coefficients, each phase in time-reversed
+                            order
+   @param[in]  phaseLength  number of coefficients of each polyphase filter
+   @param[in]  L            interpolation factor
+   @param[in]  blkSize      number of input samples
+   @param[out] pDst         points to the output samples
+   @return     none
+*/
+
+void plp_fir_interpolate_f32s_xpulpv2(const float32_t *__restrict__ pSrc,
+                                      const float32_t *__restrict__ pCoeffs,
+                                      uint32_t phaseLength,
+                                      uint32_t L,
+                                      uint32_t blkSize,
+                                      float32_t *__restrict__ pDst) {
+
+    const float32_t *pc0;
+    uint32_t blkCnt, phaseCnt;
+
+#if defined(PLP_MATH_LOOPUNROLL)
+    const float32_t *px;
+    const float32_t *pc1;
+    float32_t acc0, acc1;
+    float32_t x;
+    uint32_t tapCnt;
+#endif
+
+    for (blkCnt = blkSize; blkCnt > 0U; blkCnt--) {
+        pc0 = pCoeffs;
+
+#if defined(PLP_MATH_LOOPUNROLL)
+
+        /* Compute two phases at a time, such that each input is loaded only once. */
+        for (phaseCnt = L >> 1U; phaseCnt > 0U; phaseCnt--) {
+            px = pSrc;
+            pc1 = pc0 + phaseLength;
+            acc0 = 0.0f;
+            acc1 = 0.0f;
+
+            for (tapCnt = phaseLength; tapCnt > 0U; tapCnt--) {
+                x = *px++;
+                acc0 += x * (*pc0++);
+                acc1 += x * (*pc1++);
+            }
+
+            *pDst++ = acc0;
+            *pDst++ = acc1;
+
+            /* pc0 is at the beginning of the second phase, skip it */
+            pc0 += phaseLength;
+        }
+
+        if (L & 1U) {
+            *pDst++ = plp_fir_dot_f32(pSrc, pc0, phaseLength);
+        }
+
+#else // PLP_MATH_LOOPUNROLL
+
+        for (phaseCnt = L; phaseCnt > 0U; phaseCnt--) {
+            *pDst++ = plp_fir_dot_f32(pSrc, pc0, phaseLength);
+            pc0 += phaseLength;
+        }
+
+#endif // PLP_MATH_LOOPUNROLL
+
+        pSrc++;
+    }
+}
+
+/**
+   @} end of FirMultirateKernels group
+*/
@@ -0,0 +1,144 @@
+/* ----------------------------------------------------------------------
+ * Project:      PULP DSP Library
+ * Title:        plp_fir_interpolate_q32s_xpulpv2.c
+ * Description:  FIR interpolation of 32-bit fixed-point vectors for XPULPV2
+ *
+ * $Date:        19. Oct 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup FirMultirate
+*/
+
+/**
+   @addtogroup FirMultirateKernels
+   @{
+*/
+
+/* Dot product of n samples, each pair of products rounded by fracBits */
+static inline int32_t plp_fir_dot_q32(const int32_t *px,
+                                      const int32_t *pc,
+                                      uint32_t n,
+                                      uint32_t fracBits) {
+    uint32_t tapCnt;
+    int32_t acc = 0;
+
+    for (tapCnt = n >> 1U; tapCnt > 0U; tapCnt--) {
+        acc += __ADDROUNDNORM_REG(px[0] * pc[0], px[1] * pc[1], fracBits);
+        px += 2;
+        pc += 2;
+    }
+    if (n & 1U) {
+        acc += __ROUNDNORM_REG((*px) * (*pc), fracBits);
+    }
+    return acc;
+}
+
+/**
+   @brief FIR interpolation of 32-bit fixed-point vectors kernel for XPULPV2 extension.
+   @param[in]  pSrc         points to the input samples, including the phaseLength - 1 past
+                            samples
+   @param[in]  pCoeffs      points to the polyphase coefficients, each phase in time-reversed
+                            order
+   @param[in]  phaseLength  number of coefficients of each polyphase filter
+   @param[in]  L            interpolation factor
+   @param[in]  fracBits     number of fractional bits of the coefficients
+   @param[in]  blkSize      number of input samples
+   @param[out] pDst         points to the output samples
+   @return     none
+*/
+
+void plp_fir_interpolate_q32s_xpulpv2(const int32_t *__restrict__ pSrc,
+                                      const int32_t *__restrict__ pCoeffs,
+                                      uint32_t phaseLength,
+                                      uint32_t L,
+                                      uint32_t fracBits,
+                                      uint32_t blkSize,
+                                      int32_t *__restrict__ pDst) {
+
+    const int32_t *pc0;
+    uint32_t blkCnt, phaseCnt;
+
+#if defined(PLP_MATH_LOOPUNROLL)
+    const int32_t *px;
+    const int32_t *pc1;
+    int32_t acc0, acc1;
+    int32_t x0, x1;
+    uint32_t tapCnt;
+#endif
+
+    for (blkCnt = blkSize; blkCnt > 0U; blkCnt--) {
+        pc0 = pCoeffs;
+
+#if defined(PLP_MATH_LOOPUNROLL)
+
+        /* Compute two phases at a time, such that each input is loaded only once. */
+        for (phaseCnt = L >> 1U; phaseCnt > 0U; phaseCnt--) {
+            px = pSrc;
+            pc1 = pc0 + phaseLength;
+            acc0 = 0;
+            acc1 = 0;
+
+            for (tapCnt = phaseLength >> 1U; tapCnt > 0U; tapCnt--) {
+                x0 = px[0];
+                x1 = px[1];
+                acc0 += __ADDROUNDNORM_REG(x0 * pc0[0], x1 * pc0[1], fracBits);
+                acc1 += __ADDROUNDNORM_REG(x0 * pc1[0], x1 * pc1[1], fracBits);
+                px += 2;
+                pc0 += 2;
+                pc1 += 2;
+            }
+            if (phaseLength & 1U) {
+                acc0 += __ROUNDNORM_REG((*px) * (*pc0++), fracBits);
+                acc1 += __ROUNDNORM_REG((*px) * (*pc1), fracBits);
+            }
+
+            *pDst++ = acc0;
+            *pDst++ = acc1;
+
+            /* pc0 is at the beginning of the second phase, skip it */
+            pc0 += phaseLength;
+        }
+
+        if (L & 1U) {
+            *pDst++ = plp_fir_dot_q32(pSrc, pc0, phaseLength, fracBits);
+        }
+
+#else // PLP_MATH_LOOPUNROLL
+
+        for (phaseCnt = L; phaseCnt > 0U; phaseCnt--) {
+            *pDst++ = plp_fir_dot_q32(pSrc, pc0, phaseLength, fracBits);
+            pc0 += phaseLength;
+        }
+
+#endif // PLP_MATH_LOOPUNROLL
+
+        pSrc++;
+    }
+}
+
+/**
+   @} end of FirMultirateKernels group
+*/
@@ -0,0 +1,113 @@
+/* ----------------------------------------------------------------------
+ * Project:      PULP DSP Library
+ * Title:        plp_lms_block_f32p_xpulpv2.c
+ * Description:  Parallel floating-point block LMS adaptive filter kernel for XPULPV2
+ *
+ * $Date:        19. Oct 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup AdaptiveFilters
+*/
+
+/**
+   @addtogroup AdaptiveFiltersKernels
+   @{
+*/
+
+/* Dot product of n samples */
+static inline float32_t plp_lms_dot_f32(const float32_t *px, const float32_t *pc, uint32_t n) {
+    float32_t sum = 0.0f;
+    uint32_t tapCnt;
+
+#if defined(PLP_MATH_LOOPUNROLL)
+    for (tapCnt = n >> 1U; tapCnt > 0U; tapCnt--) {
+        sum += px[0] * pc[0] + px[1] * pc[1];
+        px += 2;
+        pc += 2;
+    }
+    if (n & 1U) {
+        sum += (*px) * (*pc);
+    }
+#else
+    for (tapCnt = n; tapCnt > 0U; tapCnt--) {
+        sum += (*px++) * (*pc++);
+    }
+#endif
+    return sum;
+}
+
+/**
+   @brief Parallel block LMS filter of floating-point vectors kernel for XPULPV2 extension.
+   First, each core computes the outputs and errors of a contiguous part of the block with the
+   coefficients of the beginning of the block. After a barrier, each core updates a contiguous
+   part of the coefficients with the correlation of the errors and the samples of the whole block.
+   @param[in]  task_args  pointer to plp_lms_block_instance_f32 struct initialized by
+                          plp_lms_block_f32_parallel
+   @return     none
+*/
+
+void plp_lms_block_f32p_xpulpv2(void *task_args) {
+
+    plp_lms_block_instance_f32 *args = (plp_lms_block_instance_f32 *)task_args;
+
+    const float32_t *pSrc = args->pSrc;
+    float32_t *pCoeffs = args->pCoeffs;
+    uint32_t numTaps = args->numTaps;
+    uint32_t blkSize = args->blkSize;
+    uint32_t nPE = args->nPE;
+    float32_t y, grad;
+    uint32_t core_id = hal_core_id();
+    uint32_t chunk, start, end, i;
+
+    /* Outputs and errors of a part of the block */
+    chunk = (blkSize + nPE - 1) / nPE;
+    start = core_id * chunk;
+    end = start + chunk < blkSize ? start + chunk : blkSize;
+
+    for (i = start; i < end; i++) {
+        y = plp_lms_dot_f32(pSrc + i, pCoeffs, numTaps);
+        args->pOut[i] = y;
+        args->pErr[i] = args->pRef[i] - y;
+    }
+
+    hal_team_barrier();
+
+    /* Update of a part of the coefficients with the errors of the whole block */
+    chunk = (numTaps + nPE - 1) / nPE;
+    start = core_id * chunk;
+    end = start + chunk < numTaps ? start + chunk : numTaps;
+
+    for (i = start; i < end; i++) {
+        grad = plp_lms_dot_f32(args->pErr, pSrc + i, blkSize);
+        pCoeffs[i] += args->mu * grad;
+    }
+
+    hal_team_barrier();
+}
+
+/**
+   @} end of AdaptiveFiltersKernels group
+*/
@@ -0,0 +1,143 @@
+/* ----------------------------------------------------------------------
+ * Project:      PULP DSP Library
+ * Title:        plp_lms_block_q16p_xpulpv2.c
+ * Description:  Parallel 16-bit fixed-point block LMS adaptive filter kernel for XPULPV2
+ *
+ * $Date:        19. Oct 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup AdaptiveFilters
+*/
+
+/**
+   @addtogroup AdaptiveFiltersKernels
+   @{
+*/
+
+/* Dot product of n samples */
+static inline int32_t plp_lms_dot_q16(const int16_t *px, const int16_t *pc, uint32_t n) {
+    int32_t sum = 0;
+    uint32_t tapCnt;
+
+#if defined(PLP_MATH_LOOPUNROLL)
+    for (tapCnt = n >> 1U; tapCnt > 0U; tapCnt--) {
+        sum = __SUMDOTP2(*((v2s *)px), *((v2s *)pc), sum);
+        px += 2;
+        pc += 2;
+    }
+    if (n & 1U) {
+        sum = __MAC(sum, *px, *pc);
+    }
+#else
+    for (tapCnt = n; tapCnt > 0U; tapCnt--) {
+        sum = __MAC(sum, *px++, *pc++);
+    }
+#endif
+    return sum;
+}
+
+/* Correlation of the errors with the samples, each pair of products rounded by fracBits */
+static inline int32_t plp_lms_grad_q16(const int16_t *pe,
+                                       const int16_t *px,
+                                       uint32_t n,
+                                       uint32_t fracBits) {
+    int32_t sum = 0;
+    uint32_t cnt;
+
+#if defined(PLP_MATH_LOOPUNROLL)
+    for (cnt = n >> 1U; cnt > 0U; cnt--) {
+        sum += __ROUNDNORM_REG(__DOTP2(*((v2s *)pe), *((v2s *)px)), fracBits);
+        pe += 2;
+        px += 2;
+    }
+    if (n & 1U) {
+        sum += __ROUNDNORM_REG((*pe) * (*px), fracBits);
+    }
+#else
+    for (cnt = n; cnt > 0U; cnt--) {
+        sum += __ROUNDNORM_REG((*pe++) * (*px++), fracBits);
+    }
+#endif
+    return sum;
+}
+
+/**
+   @brief Parallel block LMS filter of 16-bit fixed-point vectors kernel for XPULPV2 extension.
+   First, each core computes the outputs and errors of a contiguous part of the block with the
+   coefficients of the beginning of the block. After a barrier, each core updates a contiguous
+   part of the coefficients with the correlation of the errors and the samples of the whole block.
+   @param[in]  task_args  pointer to plp_lms_block_instance_q16 struct initialized by
+                          plp_lms_block_q16_parallel
+   @return     none
+*/
+
+void plp_lms_block_q16p_xpulpv2(void *task_args) {
+
+    plp_lms_block_instance_q16 *args = (plp_lms_block_instance_q16 *)task_args;
+
+    const int16_t *pSrc = args->pSrc;
+    int16_t *pCoeffs = args->pCoeffs;
+    uint32_t numTaps = args->numTaps;
+    uint32_t blkSize = args->blkSize;
+    uint32_t nPE = args->nPE;
+    uint32_t fracBits = args->fracBits;
+    int32_t round = 1 << (fracBits - 1U);
+    int32_t acc, y, e, grad;
+    uint32_t core_id = hal_core_id();
+    uint32_t chunk, start, end, i;
+
+    /* Outputs and errors of a part of the block */
+    chunk = (blkSize + nPE - 1) / nPE;
+    start = core_id * chunk;
+    end = start + chunk < blkSize ? start + chunk : blkSize;
+
+    for (i = start; i < end; i++) {
+        acc = plp_lms_dot_q16(pSrc + i, pCoeffs, numTaps);
+        y = __CLIP((acc + round) >> fracBits, 15);
+        e = __CLIP(args->pRef[i] - y, 15);
+        args->pOut[i] = (int16_t)y;
+        args->pErr[i] = (int16_t)e;
+    }
+
+    hal_team_barrier();
+
+    /* Update of a part of the coefficients with the errors of the whole block */
+    chunk = (numTaps + nPE - 1) / nPE;
+    start = core_id * chunk;
+    end = start + chunk < numTaps ? start + chunk : numTaps;
+
+    for (i = start; i < end; i++) {
+        grad = plp_lms_grad_q16(args->pErr, pSrc + i, blkSize, fracBits);
+        grad = (int32_t)(((int64_t)args->mu * grad + round) >> fracBits);
+        pCoeffs[i] = (int16_t)__CLIP(pCoeffs[i] + grad, 15);
+    }
+
+    hal_team_barrier();
+}
+
+/**
+   @} end of AdaptiveFiltersKernels group
+*/
@@ -0,0 +1,166 @@
+/* ----------------------------------------------------------------------
+ * Project:      PULP DSP Library
+ * Title:        plp_lms_f32s_xpulpv2.c
+ * Description:  Floating-point LMS adaptive filter kernel for XPULPV2
+ *
+ * $Date:        19. Oct 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup AdaptiveFilters
+*/
+
+/**
+   @addtogroup AdaptiveFiltersKernels
+   @{
+*/
+
+/* Dot product of n samples */
+static inline float32_t plp_lms_dot_f32(const float32_t *px, const float32_t *pc, uint32_t n) {
+    float32_t sum = 0.0f;
+    uint32_t tapCnt;
+
+#if defined(PLP_MATH_LOOPUNROLL)
+    for (tapCnt = n >> 1U; tapCnt > 0U; tapCnt--) {
+        sum += px[0] * pc[0] + px[1] * pc[1];
+        px += 2;
+        pc += 2;
+    }
+    if (n & 1U) {
+        sum += (*px) * (*pc);
+    }
+#else
+    for (tapCnt = n; tapCnt > 0U; tapCnt--) {
+        sum += (*px++) * (*pc++);
+    }
+#endif
+    return sum;
+}
+
+/* Adds alpha * x to the coefficients */
+static inline void plp_lms_update_f32(const float32_t *px,
+                                      float32_t *pc,
+                                      uint32_t n,
+                                      float32_t alpha) {
+    uint32_t tapCnt;
+
+    for (tapCnt = n; tapCnt > 0U; tapCnt--) {
+        *pc++ += alpha * (*px++);
+    }
+}
+
+/* Adds alpha * x to the coefficients, and returns the dot product of the updated coefficients with
+   the samples shifted by one, i.e. the filter output of the next sample */
+static inline float32_t plp_lms_update_dot_f32(const float32_t *px,
+                                               float32_t *pc,
+                                               uint32_t n,
+                                               float32_t alpha) {
+    float32_t sum = 0.0f;
+    float32_t c0;
+    uint32_t tapCnt;
+
+#if defined(PLP_MATH_LOOPUNROLL)
+    float32_t c1, x0, x1, x2;
+
+    x0 = px[0];
+    for (tapCnt = n >> 1U; tapCnt > 0U; tapCnt--) {
+        x1 = px[1];
+        x2 = px[2];
+        c0 = pc[0] + alpha * x0;
+        c1 = pc[1] + alpha * x1;
+        pc[0] = c0;
+        pc[1] = c1;
+        sum += x1 * c0 + x2 * c1;
+        x0 = x2;
+        px += 2;
+        pc += 2;
+    }
+    if (n & 1U) {
+        c0 = pc[0] + alpha * x0;
+        pc[0] = c0;
+        sum += px[1] * c0;
+    }
+#else
+    for (tapCnt = n; tapCnt > 0U; tapCnt--) {
+        c0 = *pc + alpha * px[0];
+        *pc++ = c0;
+        sum += px[1] * c0;
+        px++;
+    }
+#endif
+    return sum;
+}
+
+/**
+   @brief LMS filter of floating-point vectors kernel for XPULPV2 extension.
+   @param[in]     pSrc      points to the input samples, including the numTaps - 1 past samples
+   @param[in,out] pCoeffs   points to the coefficients in time-reversed order
+   @param[in]     numTaps   number of filter coefficients
+   @param[in]     mu        step size
+   @param[in]     pRef      points to the reference samples
+   @param[in]     blkSize   number of samples
+   @param[out]    pOut      points to the output samples
+   @param[out]    pErr      points to the error samples
+   @return        none
+
+   @par Fusing the update and the filter output
+   The coefficients of sample n are updated in the same pass over the delay line that computes
+   the filter output of sample n + 1 with the updated coefficients, such that the samples and
+   coefficients are loaded only once per sample.
+*/
+
+void plp_lms_f32s_xpulpv2(const float32_t *__restrict__ pSrc,
+                          float32_t *__restrict__ pCoeffs,
+                          uint32_t numTaps,
+                          float32_t mu,
+                          const float32_t *__restrict__ pRef,
+                          uint32_t blkSize,
+                          float32_t *__restrict__ pOut,
+                          float32_t *__restrict__ pErr) {
+    float32_t acc, e, alpha;
+    uint32_t blkCnt;
+
+    acc = plp_lms_dot_f32(pSrc, pCoeffs, numTaps);
+
+    for (blkCnt = blkSize; blkCnt > 0U; blkCnt--) {
+        e = *pRef++ - acc;
+        *pOut++ = acc;
+        *pErr++ = e;
+
+        alpha = mu * e;
+
+        if (blkCnt > 1U) {
+            acc = plp_lms_update_dot_f32(pSrc, pCoeffs, numTaps, alpha);
+        } else {
+            plp_lms_update_f32(pSrc, pCoeffs, numTaps, alpha);
+        }
+
+        pSrc++;
+    }
+}
+
+/**
+   @} end of AdaptiveFiltersKernels group
+*/
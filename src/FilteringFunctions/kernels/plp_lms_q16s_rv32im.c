@@ -0,0 +1,116 @@
+/* ----------------------------------------------------------------------
+ * Project:      PULP DSP Library
+ * Title:        plp_lms_q16s_rv32im.c
+ * Description:  16-bit fixed-point LMS adaptive filter kernel for RV32IM
+ *
+ * $Date:        19. Oct 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup AdaptiveFilters
+*/
+
+/**
+   @defgroup AdaptiveFiltersKernels Adaptive Filter Kernels
+   This module contains the kernel code for the LMS, NLMS and block LMS filters.
+*/
+
+/**
+   @addtogroup AdaptiveFiltersKernels
+   @{
+*/
+
+/* Dot product of n samples */
+static inline int32_t plp_lms_dot_q16(const int16_t *px, const int16_t *pc, uint32_t n) {
+    int32_t sum = 0;
+    uint32_t tapCnt;
+
+    for (tapCnt = n; tapCnt > 0U; tapCnt--) {
+        sum += (*px++) * (*pc++);
+    }
+    return sum;
+}
+
+/* Adds alpha * x to the coefficients, rounded and saturated */
+static inline void plp_lms_update_q16(const int16_t *px,
+                                      int16_t *pc,
+                                      uint32_t n,
+                                      int32_t alpha,
+                                      uint32_t fracBits) {
+    int32_t round = 1 << (fracBits - 1U);
+    int32_t c;
+    uint32_t tapCnt;
+
+    for (tapCnt = n; tapCnt > 0U; tapCnt--) {
+        c = *pc + ((alpha * (*px++) + round) >> fracBits);
+        *pc++ = (int16_t)(c > 32767 ? 32767 : (c < -32768 ? -32768 : c));
+    }
+}
+
+/**
+   @brief LMS filter of 16-bit fixed-point vectors kernel for RV32IM extension.
+   @param[in]     pSrc      points to the input samples, including the numTaps - 1 past samples
+   @param[in,out] pCoeffs   points to the coefficients in time-reversed order
+   @param[in]     numTaps   number of filter coefficients
+   @param[in]     mu        step size
+   @param[in]     fracBits  number of fractional bits of the coefficients and mu
+   @param[in]     pRef      points to the reference samples
+   @param[in]     blkSize   number of samples
+   @param[out]    pOut      points to the output samples
+   @param[out]    pErr      points to the error samples
+   @return        none
+*/
+
+void plp_lms_q16s_rv32im(const int16_t *__restrict__ pSrc,
+                         int16_t *__restrict__ pCoeffs,
+                         uint32_t numTaps,
+                         int16_t mu,
+                         uint32_t fracBits,
+                         const int16_t *__restrict__ pRef,
+                         uint32_t blkSize,
+                         int16_t *__restrict__ pOut,
+                         int16_t *__restrict__ pErr) {
+    int32_t round = 1 << (fracBits - 1U);
+    int32_t acc, y, e, alpha;
+    uint32_t blkCnt;
+
+    for (blkCnt = blkSize; blkCnt > 0U; blkCnt--) {
+        acc = (plp_lms_dot_q16(pSrc, pCoeffs, numTaps) + round) >> fracBits;
+        y = acc > 32767 ? 32767 : (acc < -32768 ? -32768 : acc);
+        e = *pRef++ - y;
+        e = e > 32767 ? 32767 : (e < -32768 ? -32768 : e);
+        *pOut++ = (int16_t)y;
+        *pErr++ = (int16_t)e;
+
+        alpha = (mu * e + round) >> fracBits;
+        plp_lms_update_q16(pSrc, pCoeffs, numTaps, alpha, fracBits);
+
+        pSrc++;
+    }
+}
+
+/**
+   @} end of AdaptiveFiltersKernels group
+*/
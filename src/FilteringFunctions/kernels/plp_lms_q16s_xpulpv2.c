@@ -0,0 +1,188 @@
+/* ----------------------------------------------------------------------
+ * Project:      PULP DSP Library
+ * Title:        plp_lms_q16s_xpulpv2.c
+ * Description:  16-bit fixed-point LMS adaptive filter kernel for XPULPV2
+ *
+ * $Date:        19. Oct 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup AdaptiveFilters
+*/
+
+/**
+   @addtogroup AdaptiveFiltersKernels
+   @{
+*/
+
+#define shufflemask2                                                                               \
+    (v2s) { 1, 2 }
+
+/* Dot product of n samples */
+static inline int32_t plp_lms_dot_q16(const int16_t *px, const int16_t *pc, uint32_t n) {
+    int32_t sum = 0;
+    uint32_t tapCnt;
+
+#if defined(PLP_MATH_LOOPUNROLL)
+    for (tapCnt = n >> 1U; tapCnt > 0U; tapCnt--) {
+        sum = __SUMDOTP2(*((v2s *)px), *((v2s *)pc), sum);
+        px += 2;
+        pc += 2;
+    }
+    if (n & 1U) {
+        sum = __MAC(sum, *px, *pc);
+    }
+#else
+    for (tapCnt = n; tapCnt > 0U; tapCnt--) {
+        sum = __MAC(sum, *px++, *pc++);
+    }
+#endif
+    return sum;
+}
+
+/* Adds alpha * x to the coefficients, rounded and saturated */
+static inline void plp_lms_update_q16(const int16_t *px,
+                                      int16_t *pc,
+                                      uint32_t n,
+                                      int32_t alpha,
+                                      uint32_t fracBits) {
+    uint32_t tapCnt;
+
+    for (tapCnt = n; tapCnt > 0U; tapCnt--) {
+        *pc = (int16_t)__CLIP(*pc + __ROUNDNORM_REG(alpha * (*px++), fracBits), 15);
+        pc++;
+    }
+}
+
+/* Adds alpha * x to the coefficients like plp_lms_update_q16, and returns the dot product of
+   the updated coefficients with the samples shifted by one, i.e. the output of the next sample */
+static inline int32_t plp_lms_update_dot_q16(const int16_t *px,
+                                             int16_t *pc,
+                                             uint32_t n,
+                                             int32_t alpha,
+                                             uint32_t fracBits) {
+    int32_t sum = 0;
+    int32_t c0;
+    uint32_t tapCnt;
+
+#if defined(PLP_MATH_LOOPUNROLL)
+    int32_t c1;
+    v2s x0, x1, c;
+
+    /* The pairs of samples are loaded once, the shifted pair is built with a shuffle. The last
+       pair is handled separately, such that no sample after the next window is read. */
+    x0 = *((v2s *)px);
+    for (tapCnt = (n - 1U) >> 1U; tapCnt > 0U; tapCnt--) {
+        x1 = *((v2s *)(px + 2));
+        c0 = __CLIP(pc[0] + __ROUNDNORM_REG(alpha * x0[0], fracBits), 15);
+        c1 = __CLIP(pc[1] + __ROUNDNORM_REG(alpha * x0[1], fracBits), 15);
+        c = __PACK2(c0, c1);
+        *((v2s *)pc) = c;
+        sum = __SUMDOTP2(__builtin_shuffle(x0, x1, shufflemask2), c, sum);
+        x0 = x1;
+        px += 2;
+        pc += 2;
+    }
+    c0 = __CLIP(pc[0] + __ROUNDNORM_REG(alpha * x0[0], fracBits), 15);
+    if (n & 1U) {
+        pc[0] = (int16_t)c0;
+        sum = __MAC(sum, x0[1], c0);
+    } else {
+        c1 = __CLIP(pc[1] + __ROUNDNORM_REG(alpha * x0[1], fracBits), 15);
+        c = __PACK2(c0, c1);
+        *((v2s *)pc) = c;
+        sum = __SUMDOTP2(__PACK2(x0[1], px[2]), c, sum);
+    }
+#else
+    for (tapCnt = n; tapCnt > 0U; tapCnt--) {
+        c0 = __CLIP(*pc + __ROUNDNORM_REG(alpha * px[0], fracBits), 15);
+        *pc++ = (int16_t)c0;
+        sum = __MAC(sum, px[1], c0);
+        px++;
+    }
+#endif
+    return sum;
+}
+
+/**
+   @brief LMS filter of 16-bit fixed-point vectors kernel for XPULPV2 extension.
+   @param[in]     pSrc      points to the input samples, including the numTaps - 1 past samples
+   @param[in,out] pCoeffs   points to the coefficients in time-reversed order
+   @param[in]     numTaps   number of filter coefficients
+   @param[in]     mu        step size
+   @param[in]     fracBits  number of fractional bits of the coefficients and mu
+   @param[in]     pRef      points to the reference samples
+   @param[in]     blkSize   number of samples
+   @param[out]    pOut      points to the output samples
+   @param[out]    pErr      points to the error samples
+   @return        none
+
+   @par Fusing the update and the filter output
+   The coefficients of sample n are updated in the same pass over the delay line that computes
+   the filter output of sample n + 1 with the updated coefficients, such that the samples and
+   coefficients are loaded only once per sample.
+
+   @par Exploiting SIMD instructions
+   The samples and coefficients are packed two by two into 32 bit vectors for the dot products.
+   The updated coefficients are stored as vectors, and the samples shifted by one are built from
+   the loaded vectors with a shuffle.
+*/
+
+void plp_lms_q16s_xpulpv2(const int16_t *__restrict__ pSrc,
+                          int16_t *__restrict__ pCoeffs,
+                          uint32_t numTaps,
+                          int16_t mu,
+                          uint32_t fracBits,
+                          const int16_t *__restrict__ pRef,
+                          uint32_t blkSize,
+                          int16_t *__restrict__ pOut,
+                          int16_t *__restrict__ pErr) {
+    int32_t round = 1 << (fracBits - 1U);
+    int32_t acc, y, e, alpha;
+    uint32_t blkCnt;
+
+    acc = plp_lms_dot_q16(pSrc, pCoeffs, numTaps);
+
+    for (blkCnt = blkSize; blkCnt > 0U; blkCnt--) {
+        y = __CLIP((acc + round) >> fracBits, 15);
+        e = __CLIP(*pRef++ - y, 15);
+        *pOut++ = (int16_t)y;
+        *pErr++ = (int16_t)e;
+
+        alpha = __ROUNDNORM_REG(mu * e, fracBits);
+
+        if (blkCnt > 1U) {
+            acc = plp_lms_update_dot_q16(pSrc, pCoeffs, numTaps, alpha, fracBits);
+        } else {
+            plp_lms_update_q16(pSrc, pCoeffs, numTaps, alpha, fracBits);
+        }
+
+        pSrc++;
+    }
+}
+
+/**
+   @} end of AdaptiveFiltersKernels group
+*/
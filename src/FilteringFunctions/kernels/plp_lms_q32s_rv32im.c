@@ -0,0 +1,111 @@
+/* ----------------------------------------------------------------------
+ * Project:      PULP DSP Library
+ * Title:        plp_lms_q32s_rv32im.c
+ * Description:  32-bit fixed-point LMS adaptive filter kernel for RV32IM
+ *
+ * $Date:        19. Oct 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup AdaptiveFilters
+*/
+
+/**
+   @addtogroup AdaptiveFiltersKernels
+   @{
+*/
+
+/* Dot product of n samples, each product rounded by fracBits */
+static inline int32_t plp_lms_dot_q32(const int32_t *px,
+                                      const int32_t *pc,
+                                      uint32_t n,
+                                      uint32_t fracBits) {
+    int32_t round = 1 << (fracBits - 1U);
+    int32_t sum = 0;
+    uint32_t tapCnt;
+
+    for (tapCnt = n; tapCnt > 0U; tapCnt--) {
+        sum += ((*px++) * (*pc++) + round) >> fracBits;
+    }
+    return sum;
+}
+
+/* Adds alpha * x to the coefficients, rounded by fracBits */
+static inline void plp_lms_update_q32(const int32_t *px,
+                                      int32_t *pc,
+                                      uint32_t n,
+                                      int32_t alpha,
+                                      uint32_t fracBits) {
+    int32_t round = 1 << (fracBits - 1U);
+    uint32_t tapCnt;
+
+    for (tapCnt = n; tapCnt > 0U; tapCnt--) {
+        *pc++ += (alpha * (*px++) + round) >> fracBits;
+    }
+}
+
+/**
+   @brief LMS filter of 32-bit fixed-point vectors kernel for RV32IM extension.
+   @param[in]     pSrc      points to the input samples, including the numTaps - 1 past samples
+   @param[in,out] pCoeffs   points to the coefficients in time-reversed order
+   @param[in]     numTaps   number of filter coefficients
+   @param[in]     mu        step size
+   @param[in]     fracBits  number of fractional bits of the coefficients and mu
+   @param[in]     pRef      points to the reference samples
+   @param[in]     blkSize   number of samples
+   @param[out]    pOut      points to the output samples
+   @param[out]    pErr      points to the error samples
+   @return        none
+*/
+
+void plp_lms_q32s_rv32im(const int32_t *__restrict__ pSrc,
+                         int32_t *__restrict__ pCoeffs,
+                         uint32_t numTaps,
+                         int32_t mu,
+                         uint32_t fracBits,
+                         const int32_t *__restrict__ pRef,
+                         uint32_t blkSize,
+                         int32_t *__restrict__ pOut,
+                         int32_t *__restrict__ pErr) {
+    int32_t round = 1 << (fracBits - 1U);
+    int32_t y, e, alpha;
+    uint32_t blkCnt;
+
+    for (blkCnt = blkSize; blkCnt > 0U; blkCnt--) {
+        y = plp_lms_dot_q32(pSrc, pCoeffs, numTaps, fracBits);
+        e = *pRef++ - y;
+        *pOut++ = y;
+        *pErr++ = e;
+
+        alpha = (mu * e + round) >> fracBits;
+        plp_lms_update_q32(pSrc, pCoeffs, numTaps, alpha, fracBits);
+
+        pSrc++;
+    }
+}
+
+/**
+   @} end of AdaptiveFiltersKernels group
+*/
@@ -0,0 +1,173 @@
+/* ----------------------------------------------------------------------
+ * Project:      PULP DSP Library
+ * Title:        plp_lms_q32s_xpulpv2.c
+ * Description:  32-bit fixed-point LMS adaptive filter kernel for XPULPV2
+ *
+ * $Date:        19. Oct 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup AdaptiveFilters
+*/
+
+/**
+   @addtogroup AdaptiveFiltersKernels
+   @{
+*/
+
+/* Dot product of n samples, each pair of products rounded by fracBits */
+static inline int32_t plp_lms_dot_q32(const int32_t *px,
+                                      const int32_t *pc,
+                                      uint32_t n,
+                                      uint32_t fracBits) {
+    int32_t sum = 0;
+    uint32_t tapCnt;
+
+#if defined(PLP_MATH_LOOPUNROLL)
+    for (tapCnt = n >> 1U; tapCnt > 0U; tapCnt--) {
+        sum += __ADDROUNDNORM_REG(px[0] * pc[0], px[1] * pc[1], fracBits);
+        px += 2;
+        pc += 2;
+    }
+    if (n & 1U) {
+        sum += __ROUNDNORM_REG((*px) * (*pc), fracBits);
+    }
+#else
+    for (tapCnt = n; tapCnt > 0U; tapCnt--) {
+        sum += __ROUNDNORM_REG((*px++) * (*pc++), fracBits);
+    }
+#endif
+    return sum;
+}
+
+/* Adds alpha * x to the coefficients, rounded by fracBits */
+static inline void plp_lms_update_q32(const int32_t *px,
+                                      int32_t *pc,
+                                      uint32_t n,
+                                      int32_t alpha,
+                                      uint32_t fracBits) {
+    uint32_t tapCnt;
+
+    for (tapCnt = n; tapCnt > 0U; tapCnt--) {
+        *pc++ += __ROUNDNORM_REG(alpha * (*px++), fracBits);
+    }
+}
+
+/* Adds alpha * x to the coefficients like plp_lms_update_q32, and returns the dot product of
+   the updated coefficients with the samples shifted by one, i.e. the output of the next sample */
+static inline int32_t plp_lms_update_dot_q32(const int32_t *px,
+                                             int32_t *pc,
+                                             uint32_t n,
+                                             int32_t alpha,
+                                             uint32_t fracBits) {
+    int32_t sum = 0;
+    int32_t c0;
+    uint32_t tapCnt;
+
+#if defined(PLP_MATH_LOOPUNROLL)
+    int32_t c1, x0, x1, x2;
+
+    x0 = px[0];
+    for (tapCnt = n >> 1U; tapCnt > 0U; tapCnt--) {
+        x1 = px[1];
+        x2 = px[2];
+        c0 = pc[0] + __ROUNDNORM_REG(alpha * x0, fracBits);
+        c1 = pc[1] + __ROUNDNORM_REG(alpha * x1, fracBits);
+        pc[0] = c0;
+        pc[1] = c1;
+        sum += __ADDROUNDNORM_REG(x1 * c0, x2 * c1, fracBits);
+        x0 = x2;
+        px += 2;
+        pc += 2;
+    }
+    if (n & 1U) {
+        c0 = pc[0] + __ROUNDNORM_REG(alpha * x0, fracBits);
+        pc[0] = c0;
+        sum += __ROUNDNORM_REG(px[1] * c0, fracBits);
+    }
+#else
+    for (tapCnt = n; tapCnt > 0U; tapCnt--) {
+        c0 = *pc + __ROUNDNORM_REG(alpha * px[0], fracBits);
+        *pc++ = c0;
+        sum += __ROUNDNORM_REG(px[1] * c0, fracBits);
+        px++;
+    }
+#endif
+    return sum;
+}
+
+/**
+   @brief LMS filter of 32-bit fixed-point vectors kernel for XPULPV2 extension.
+   @param[in]     pSrc      points to the input samples, including the numTaps - 1 past samples
+   @param[in,out] pCoeffs   points to the coefficients in time-reversed order
+   @param[in]     numTaps   number of filter coefficients
+   @param[in]     mu        step size
+   @param[in]     fracBits  number of fractional bits of the coefficients and mu
+   @param[in]     pRef      points to the reference samples
+   @param[in]     blkSize   number of samples
+   @param[out]    pOut      points to the output samples
+   @param[out]    pErr      points to the error samples
+   @return        none
+
+   @par Fusing the update and the filter output
+   The coefficients of sample n are updated in the same pass over the delay line that computes
+   the filter output of sample n + 1 with the updated coefficients, such that the samples and
+   coefficients are loaded only once per sample.
+*/
+
+void plp_lms_q32s_xpulpv2(const int32_t *__restrict__ pSrc,
+                          int32_t *__restrict__ pCoeffs,
+                          uint32_t numTaps,
+                          int32_t mu,
+                          uint32_t fracBits,
+                          const int32_t *__restrict__ pRef,
+                          uint32_t blkSize,
+                          int32_t *__restrict__ pOut,
+                          int32_t *__restrict__ pErr) {
+    int32_t acc, e, alpha;
+    uint32_t blkCnt;
+
+    acc = plp_lms_dot_q32(pSrc, pCoeffs, numTaps, fracBits);
+
+    for (blkCnt = blkSize; blkCnt > 0U; blkCnt--) {
+        e = *pRef++ - acc;
+        *pOut++ = acc;
+        *pErr++ = e;
+
+        alpha = __ROUNDNORM_REG(mu * e, fracBits);
+
+        if (blkCnt > 1U) {
+            acc = plp_lms_update_dot_q32(pSrc, pCoeffs, numTaps, alpha, fracBits);
+        } else {
+            plp_lms_update_q32(pSrc, pCoeffs, numTaps, alpha, fracBits);
+        }
+
+        pSrc++;
+    }
+}
+
+/**
+   @} end of AdaptiveFiltersKernels group
+*/
@@ -30,6 +30,7 @@
 
 #include "plp_math.h"
 #include "rtos_hal.h"
+#include "plp_tuning.h"
 
 HAL_CL_L1 int32_t *resultsBuffer;
 
@@ -59,6 +60,7 @@ void plp_conv_i16_parallel(const int16_t *pSrcA,
                            const uint32_t srcBLen,
                            const uint8_t nPE,
                            int32_t *pRes) {
+    PLP_PROFILE_FUNCTION();
 
     if (hal_cluster_id() == ARCHI_FC_CID) {
         printf("parallel processing supported only for cluster side\n");
@@ -109,59 +111,60 @@ void plp_conv_i16_parallel(const int16_t *pSrcA,
         hal_cl_team_fork(nPE, plp_conv_i16p_xpulpv2, (void *)&S);
         if (nPE > 1) {
 
-#if defined(PLP_CONV_SEQUENTIALADDING)
+            if (!PLP_TUNE_CONV_PARALLEL_OLA(srcALen + srcBLen - 1)) {
 
-            for (uint32_t i = 0; i < resultsoffset; i++) {
-                pRes[i] = resultsBuffer[i];
-            }
+                for (uint32_t i = 0; i < resultsoffset; i++) {
+                    pRes[i] = resultsBuffer[i];
+                }
 
-            for (uint32_t i = resultsoffset; i < srcALen + srcBLen - 1; i++) {
-                pRes[i] = 0;
-            }
+                for (uint32_t i = resultsoffset; i < srcALen + srcBLen - 1; i++) {
+                    pRes[i] = 0;
+                }
 
-            for (int32_t i = 1; i < nPE - 1; i++) {
-                for (uint32_t j = 0; j < resultsoffset; j++) {
-                    pRes[i * srcAoffset + j] += resultsBuffer[j + i * resultsoffset];
+                for (int32_t i = 1; i < nPE - 1; i++) {
+                    for (uint32_t j = 0; j < resultsoffset; j++) {
+                        pRes[i * srcAoffset + j] += resultsBuffer[j + i * resultsoffset];
+                    }
                 }
-            }
 
-            for (uint32_t j = 0; j < resultsLen - resultsoffset * (nPE - 1); j++) {
-                pRes[(nPE - 1) * srcAoffset + j] += resultsBuffer[(nPE - 1) * resultsoffset + j];
-            }
+                for (uint32_t j = 0; j < resultsLen - resultsoffset * (nPE - 1); j++) {
+                    pRes[(nPE - 1) * srcAoffset + j] +=
+                        resultsBuffer[(nPE - 1) * resultsoffset + j];
+                }
 
-#else
+            } else {
 
-            /* Parallel overlap-adding */
-            plp_conv_parallel_OLA(nPE, pIn1Len, pIn2Len, resultsBuffer);
+                /* Parallel overlap-adding */
+                plp_conv_parallel_OLA(nPE, pIn1Len, pIn2Len, resultsBuffer);
 
 #if defined(PLP_MATH_LOOPUNROLL)
 
-            uint32_t k = (srcALen + srcBLen - 1) >> 1U;
-            int32_t temp1, temp2;
+                uint32_t k = (srcALen + srcBLen - 1) >> 1U;
+                int32_t temp1, temp2;
 
-            while (k) {
-                temp1 = *resultsBuffer++;
-                temp2 = *resultsBuffer++;
+                while (k) {
+                    temp1 = *resultsBuffer++;
+                    temp2 = *resultsBuffer++;
 
-                *pRes++ = temp1;
-                *pRes++ = temp2;
+                    *pRes++ = temp1;
+                    *pRes++ = temp2;
 
-                k--;
-            }
+                    k--;
+                }
 
-            k = (srcALen + srcBLen - 1) % 0x2U;
+                k = (srcALen + srcBLen - 1) % 0x2U;
 
-            if (k) {
-                *pRes++ = *resultsBuffer++;
-            }
+                if (k) {
+                    *pRes++ = *resultsBuffer++;
+                }
 
 #else
-            for (uint32_t i = 0; i < srcALen + srcBLen - 1; i++) {
-                pRes[i] = resultsBuffer[i];
-            }
+                for (uint32_t i = 0; i < srcALen + srcBLen - 1; i++) {
+                    pRes[i] = resultsBuffer[i];
+                }
 #endif
+            }
             hal_cl_l1_free(resBuf, sizeof(int32_t) * resultsoffset * nPE);
-#endif
         }
 
         return;
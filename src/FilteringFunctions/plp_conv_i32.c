@@ -64,6 +64,7 @@ void plp_conv_i32(const int32_t *pSrcA,
                   const int32_t *pSrcB,
                   const uint32_t srcBLen,
                   int32_t *__restrict__ pRes) {
+    PLP_PROFILE_FUNCTION();
 
     uint32_t in1Len, in2Len;
     const int32_t *pIn1;
@@ -55,6 +55,7 @@ void plp_conv_valid_rep_i16(const int16_t *pSrcA,
                             const int16_t *pSrcB,
                             const uint32_t srcBLen,
                             int32_t *pRes) {
+    PLP_PROFILE_FUNCTION();
 
     uint32_t in1Len, in2Len;
     const int16_t *pIn1;
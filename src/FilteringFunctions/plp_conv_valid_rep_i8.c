@@ -55,6 +55,7 @@ void plp_conv_valid_rep_i8(const int8_t *pSrcA,
                            const int8_t *pSrcB,
                            const uint32_t srcBLen,
                            int32_t *pRes) {
+    PLP_PROFILE_FUNCTION();
 
     uint32_t in1Len, in2Len;
     const int8_t *pIn1;
@@ -60,6 +60,7 @@ void plp_correlate_i32(const int32_t *pSrcA,
                        const int32_t *pSrcB,
                        const uint32_t srcBLen,
                        int32_t *__restrict__ pRes) {
+    PLP_PROFILE_FUNCTION();
 
     if (hal_cluster_id() == ARCHI_FC_CID) {
         plp_correlate_i32s_rv32im(pSrcA, srcALen, pSrcB, srcBLen, pRes);
@@ -0,0 +1,62 @@
+/* ----------------------------------------------------------------------
+ * Project:      PULP DSP Library
+ * Title:        plp_fir_common.h
+ * Description:  State buffer handling of the multirate FIR filters
+ *
+ * $Date:        19. Oct 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+#ifndef __PLP_FIR_COMMON_H
+#define __PLP_FIR_COMMON_H
+
+/*
+ * The state buffer holds the last (numTaps - 1) input samples of the previous block, followed by
+ * the current block. The kernels read the whole buffer, such that each output is a contiguous dot
+ * product of the time-reversed coefficients with the state. Copying forward is safe for the
+ * overlapping move of the history to the beginning of the buffer.
+ */
+
+static inline void plp_fir_copy_i16(int16_t *pDst, const int16_t *pSrc, uint32_t length) {
+    uint32_t i;
+    for (i = 0; i < length; i++) {
+        pDst[i] = pSrc[i];
+    }
+}
+
+static inline void plp_fir_copy_i32(int32_t *pDst, const int32_t *pSrc, uint32_t length) {
+    uint32_t i;
+    for (i = 0; i < length; i++) {
+        pDst[i] = pSrc[i];
+    }
+}
+
+static inline void plp_fir_copy_f32(float32_t *pDst, const float32_t *pSrc, uint32_t length) {
+    uint32_t i;
+    for (i = 0; i < length; i++) {
+        pDst[i] = pSrc[i];
+    }
+}
+
+#endif // __PLP_FIR_COMMON_H
@@ -0,0 +1,125 @@
+/* ----------------------------------------------------------------------
+ * Project:      PULP DSP Library
+ * Title:        plp_fir_decimate_q16.c
+ * Description:  16-bit fixed-point polyphase FIR decimator glue code
+ *
+ * $Date:        19. Oct 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+#include "plp_fir_common.h"
+
+/**
+   @ingroup groupFilters
+*/
+
+/**
+   @defgroup FirMultirate Multirate FIR Filters
+   This module contains the glue code for the polyphase FIR decimators and interpolators. The
+   kernel codes (kernels) are in the Module Multirate FIR Filter Kernels.
+
+   The decimator computes only every M-th output of the FIR filter
+   \f$y[m] = \sum_{k=0}^{numTaps-1} h[k] x[mM - k]\f$, instead of filtering at the full rate and
+   discarding M - 1 of every M outputs. The interpolator splits the filter into L polyphase
+   filters of length numTaps / L, and computes the L outputs of each input sample without
+   multiplying the inserted zeros.
+
+   The coefficients are stored in time-reversed order (the polyphase filters of the interpolator
+   each in time-reversed order), such that each output is a contiguous dot product with the state
+   buffer, which maps to the SIMD dot product instructions of XPULPV2. The state buffer keeps the
+   past input samples across calls, and is set up by the init functions. For the fixed-point
+   versions, the products are accumulated with 32-bit precision and the result is rounded by
+   fracBits and saturated to the output type.
+*/
+
+/**
+   @addtogroup FirMultirate
+   @{
+*/
+
+/**
+   @brief Initialization of the 16-bit fixed-point polyphase FIR decimator.
+   @param[out] S         points to the instance structure
+   @param[in]  M         decimation factor
+   @param[in]  numTaps   number of filter coefficients
+   @param[in]  pCoeffs   points to the coefficients in time-reversed order
+   @param[in]  pState    points to the state buffer of length numTaps - 1 + blockSize
+   @param[in]  fracBits  number of fractional bits of the coefficients
+   @return     none
+*/
+void plp_fir_decimate_init_q16(plp_fir_decimate_instance_q16 *S,
+                               uint8_t M,
+                               uint16_t numTaps,
+                               const int16_t *pCoeffs,
+                               int16_t *pState,
+                               uint32_t fracBits) {
+    PLP_PROFILE_FUNCTION();
+
+    uint32_t i;
+
+    S->M = M;
+    S->numTaps = numTaps;
+    S->pCoeffs = pCoeffs;
+    S->pState = pState;
+    S->fracBits = fracBits;
+
+    for (i = 0; i < numTaps - 1U; i++) {
+        pState[i] = 0;
+    }
+}
+
+/**
+   @brief Glue code for the 16-bit fixed-point polyphase FIR decimator.
+   @param[in]  S          points to the instance structure
+   @param[in]  pSrc       points to the input block
+   @param[in]  blockSize  number of input samples, must be a multiple of M
+   @param[out] pDst       points to the output block of length blockSize / M
+   @return     none
+*/
+void plp_fir_decimate_q16(const plp_fir_decimate_instance_q16 *S,
+                          const int16_t *__restrict__ pSrc,
+                          uint32_t blockSize,
+                          int16_t *__restrict__ pDst) {
+    PLP_PROFILE_FUNCTION();
+
+    if (blockSize % S->M != 0) {
+        printf("Error: blockSize must be a multiple of the decimation factor\n");
+        return;
+    }
+
+    plp_fir_copy_i16(S->pState + S->numTaps - 1, pSrc, blockSize);
+
+    if (hal_cluster_id() == ARCHI_FC_CID) {
+        plp_fir_decimate_q16s_rv32im(S->pState, S->pCoeffs, S->numTaps, S->M, S->fracBits,
+                                     blockSize / S->M, pDst);
+    } else {
+        plp_fir_decimate_q16s_xpulpv2(S->pState, S->pCoeffs, S->numTaps, S->M, S->fracBits,
+                                      blockSize / S->M, pDst);
+    }
+
+    plp_fir_copy_i16(S->pState, S->pState + blockSize, S->numTaps - 1);
+}
+
+/**
+   @} end of FirMultirate group
+*/
@@ -0,0 +1,80 @@
+/* ----------------------------------------------------------------------
+ * Project:      PULP DSP Library
+ * Title:        plp_fir_interpolate_f32_parallel.c
+ * Description:  Parallel floating-point polyphase FIR interpolator glue code
+ *
+ * $Date:        19. Oct 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+#include "plp_fir_common.h"
+
+/**
+   @ingroup groupFilters
+*/
+
+/**
+   @addtogroup FirMultirate
+   @{
+*/
+
+/**
+   @brief Glue code for the parallel floating-point polyphase FIR interpolator. The input
+   block is split into contiguous parts, one per core.
+   @param[in]  S          points to the instance structure
+   @param[in]  pSrc       points to the input block
+   @param[in]  blockSize  number of input samples
+   @param[in]  nPE        number of cores to compute on
+   @param[out] pDst       points to the output block of length blockSize * L
+   @return     none
+*/
+void plp_fir_interpolate_f32_parallel(const plp_fir_interpolate_instance_f32 *S,
+                                      const float32_t *__restrict__ pSrc,
+                                      uint32_t blockSize,
+                                      uint32_t nPE,
+                                      float32_t *__restrict__ pDst) {
+    PLP_PROFILE_FUNCTION();
+
+    if (hal_cluster_id() == ARCHI_FC_CID) {
+        printf("parallel processing supported only for cluster side\n");
+        return;
+    }
+
+    plp_fir_copy_f32(S->pState + S->phaseLength - 1, pSrc, blockSize);
+
+    plp_fir_multirate_instance_f32 args = { .pCoeffs = S->pCoeffs,
+                                            .pSrc = S->pState,
+                                            .numTaps = S->phaseLength,
+                                            .factor = S->L,
+                                            .blkSize = blockSize,
+                                            .nPE = nPE,
+                                            .pDst = pDst };
+
+    hal_cl_team_fork(nPE, plp_fir_interpolate_f32p_xpulpv2, (void *)&args);
+
+    plp_fir_copy_f32(S->pState, S->pState + blockSize, S->phaseLength - 1);
+}
+
+/**
+   @} end of FirMultirate group
+*/
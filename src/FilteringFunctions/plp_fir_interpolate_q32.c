@@ -0,0 +1,107 @@
+/* ----------------------------------------------------------------------
+ * Project:      PULP DSP Library
+ * Title:        plp_fir_interpolate_q32.c
+ * Description:  32-bit fixed-point polyphase FIR interpolator glue code
+ *
+ * $Date:        19. Oct 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+#include "plp_fir_common.h"
+
+/**
+   @ingroup groupFilters
+*/
+
+/**
+   @addtogroup FirMultirate
+   @{
+*/
+
+/**
+   @brief Initialization of the 32-bit fixed-point polyphase FIR interpolator.
+   @param[out] S         points to the instance structure
+   @param[in]  L         interpolation factor
+   @param[in]  numTaps   number of filter coefficients, must be a multiple of L
+   @param[in]  pCoeffs   points to the polyphase coefficients, see
+                         plp_fir_interpolate_instance_q32
+   @param[in]  pState    points to the state buffer of length numTaps / L - 1 + blockSize
+   @param[in]  fracBits  number of fractional bits of the coefficients
+   @return     none
+*/
+void plp_fir_interpolate_init_q32(plp_fir_interpolate_instance_q32 *S,
+                                  uint8_t L,
+                                  uint16_t numTaps,
+                                  const int32_t *pCoeffs,
+                                  int32_t *pState,
+                                  uint32_t fracBits) {
+    PLP_PROFILE_FUNCTION();
+
+    uint32_t i;
+
+    if (numTaps % L != 0) {
+        printf("Error: numTaps must be a multiple of the interpolation factor\n");
+        return;
+    }
+
+    S->L = L;
+    S->phaseLength = numTaps / L;
+    S->pCoeffs = pCoeffs;
+    S->pState = pState;
+    S->fracBits = fracBits;
+
+    for (i = 0; i < S->phaseLength - 1U; i++) {
+        pState[i] = 0;
+    }
+}
+
+/**
+   @brief Glue code for the 32-bit fixed-point polyphase FIR interpolator.
+   @param[in]  S          points to the instance structure
+   @param[in]  pSrc       points to the input block
+   @param[in]  blockSize  number of input samples
+   @param[out] pDst       points to the output block of length blockSize * L
+   @return     none
+*/
+void plp_fir_interpolate_q32(const plp_fir_interpolate_instance_q32 *S,
+                             const int32_t *__restrict__ pSrc,
+                             uint32_t blockSize,
+                             int32_t *__restrict__ pDst) {
+    PLP_PROFILE_FUNCTION();
+
+    plp_fir_copy_i32(S->pState + S->phaseLength - 1, pSrc, blockSize);
+
+    if (hal_cluster_id() == ARCHI_FC_CID) {
+        plp_fir_interpolate_q32s_rv32im(S->pState, S->pCoeffs, S->phaseLength, S->L, S->fracBits,
+                                        blockSize, pDst);
+    } else {
+        plp_fir_interpolate_q32s_xpulpv2(S->pState, S->pCoeffs, S->phaseLength, S->L, S->fracBits,
+                                         blockSize, pDst);
+    }
+
+    plp_fir_copy_i32(S->pState, S->pState + blockSize, S->phaseLength - 1);
+}
+
+/**
+   @} end of FirMultirate group
+*/
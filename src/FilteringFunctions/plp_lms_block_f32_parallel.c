@@ -0,0 +1,86 @@
+/* ----------------------------------------------------------------------
+ * Project:      PULP DSP Library
+ * Title:        plp_lms_block_f32_parallel.c
+ * Description:  Parallel floating-point block LMS adaptive filter glue code
+ *
+ * $Date:        19. Oct 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+#include "plp_fir_common.h"
+
+/**
+   @ingroup groupFilters
+*/
+
+/**
+   @addtogroup AdaptiveFilters
+   @{
+*/
+
+/**
+   @brief Glue code for the parallel floating-point block LMS filter. The coefficients are
+   updated once per call, with the gradient of the whole block.
+   @param[in]  S          points to the instance structure
+   @param[in]  pSrc       points to the input block
+   @param[in]  pRef       points to the reference block
+   @param[in]  blockSize  number of samples
+   @param[in]  nPE        number of cores to compute on
+   @param[out] pOut       points to the output block
+   @param[out] pErr       points to the error block
+   @return     none
+*/
+void plp_lms_block_f32_parallel(const plp_lms_instance_f32 *S,
+                                const float32_t *__restrict__ pSrc,
+                                const float32_t *__restrict__ pRef,
+                                uint32_t blockSize,
+                                uint32_t nPE,
+                                float32_t *__restrict__ pOut,
+                                float32_t *__restrict__ pErr) {
+    PLP_PROFILE_FUNCTION();
+
+    if (hal_cluster_id() == ARCHI_FC_CID) {
+        printf("parallel processing supported only for cluster side\n");
+        return;
+    }
+
+    plp_fir_copy_f32(S->pState + S->numTaps - 1, pSrc, blockSize);
+
+    plp_lms_block_instance_f32 args = { .pSrc = S->pState,
+                                        .pCoeffs = S->pCoeffs,
+                                        .numTaps = S->numTaps,
+                                        .mu = S->mu,
+                                        .pRef = pRef,
+                                        .blkSize = blockSize,
+                                        .nPE = nPE,
+                                        .pOut = pOut,
+                                        .pErr = pErr };
+
+    hal_cl_team_fork(nPE, plp_lms_block_f32p_xpulpv2, (void *)&args);
+
+    plp_fir_copy_f32(S->pState, S->pState + blockSize, S->numTaps - 1);
+}
+
+/**
+   @} end of AdaptiveFilters group
+*/
@@ -0,0 +1,102 @@
+/* ----------------------------------------------------------------------
+ * Project:      PULP DSP Library
+ * Title:        plp_lms_f32.c
+ * Description:  Floating-point LMS adaptive filter glue code
+ *
+ * $Date:        19. Oct 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+#include "plp_fir_common.h"
+
+/**
+   @ingroup groupFilters
+*/
+
+/**
+   @addtogroup AdaptiveFilters
+   @{
+*/
+
+/**
+   @brief Initialization of the floating-point LMS and NLMS filters.
+   @param[out] S         points to the instance structure
+   @param[in]  numTaps   number of filter coefficients
+   @param[in]  pCoeffs   points to the initial coefficients in time-reversed order, they are
+                         updated in place
+   @param[in]  pState    points to the state buffer of length numTaps - 1 + blockSize
+   @param[in]  mu        step size
+   @return     none
+*/
+void plp_lms_init_f32(plp_lms_instance_f32 *S,
+                      uint16_t numTaps,
+                      float32_t *pCoeffs,
+                      float32_t *pState,
+                      float32_t mu) {
+    PLP_PROFILE_FUNCTION();
+
+    uint32_t i;
+
+    S->numTaps = numTaps;
+    S->pCoeffs = pCoeffs;
+    S->pState = pState;
+    S->mu = mu;
+
+    for (i = 0; i < numTaps - 1U; i++) {
+        pState[i] = 0.0f;
+    }
+}
+
+/**
+   @brief Glue code for the floating-point LMS filter.
+   @param[in]  S          points to the instance structure
+   @param[in]  pSrc       points to the input block
+   @param[in]  pRef       points to the reference block
+   @param[in]  blockSize  number of samples
+   @param[out] pOut       points to the output block
+   @param[out] pErr       points to the error block
+   @return     none
+*/
+void plp_lms_f32(const plp_lms_instance_f32 *S,
+                 const float32_t *__restrict__ pSrc,
+                 const float32_t *__restrict__ pRef,
+                 uint32_t blockSize,
+                 float32_t *__restrict__ pOut,
+                 float32_t *__restrict__ pErr) {
+    PLP_PROFILE_FUNCTION();
+
+    if (hal_cluster_id() == ARCHI_FC_CID) {
+        printf("error: FC doesn't have FPU\n");
+        return;
+    }
+
+    plp_fir_copy_f32(S->pState + S->numTaps - 1, pSrc, blockSize);
+
+    plp_lms_f32s_xpulpv2(S->pState, S->pCoeffs, S->numTaps, S->mu, pRef, blockSize, pOut, pErr);
+
+    plp_fir_copy_f32(S->pState, S->pState + blockSize, S->numTaps - 1);
+}
+
+/**
+   @} end of AdaptiveFilters group
+*/
@@ -0,0 +1,132 @@
+/* ----------------------------------------------------------------------
+ * Project:      PULP DSP Library
+ * Title:        plp_lms_q16.c
+ * Description:  16-bit fixed-point LMS adaptive filter glue code
+ *
+ * $Date:        19. Oct 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+#include "plp_fir_common.h"
+
+/**
+   @ingroup groupFilters
+*/
+
+/**
+   @defgroup AdaptiveFilters Adaptive Filters
+   The LMS filter adapts the coefficients of an FIR filter, such that its output y[n] follows the
+   reference signal d[n]. For each sample, the filter output is computed with the current
+   coefficients, and the coefficients are updated with the error e[n] = d[n] - y[n]:
+   \f$h_k \leftarrow h_k + \mu e[n] x[n - k]\f$. The normalized LMS (NLMS) divides the step size
+   by the energy of the samples in the delay line, \f$\mu / (\epsilon + \sum_k x[n - k]^2)\f$,
+   which makes the convergence independent of the input level. \f$\epsilon\f$ is one LSB for the
+   fixed-point versions and 1e-6 for the floating-point version.
+
+   Both functions use the same instance, which is set up by the init functions. As for the FIR
+   filters, the coefficients are stored in time-reversed order, and the state buffer keeps the
+   past input samples across calls. The coefficients are updated in place. The kernels for XPULPV2
+   fuse the update of the coefficients with the filter output of the next sample, such that the
+   delay line and the coefficients are loaded only once per sample.
+
+   For long filters, the block LMS (plp_lms_block_*_parallel) keeps the coefficients constant
+   during a block: The cores compute the outputs and errors of a part of the block each, and then
+   update a part of the coefficients each with the gradient of the whole block. The result is not
+   the same as the one of the sample-by-sample LMS.
+
+   For the fixed-point versions, the coefficients and mu have fracBits fractional bits. The
+   products are accumulated with 32-bit precision and rounded by fracBits. The outputs, errors and
+   coefficients of the 16-bit version are saturated.
+*/
+
+/**
+   @addtogroup AdaptiveFilters
+   @{
+*/
+
+/**
+   @brief Initialization of the 16-bit fixed-point LMS and NLMS filters.
+   @param[out] S         points to the instance structure
+   @param[in]  numTaps   number of filter coefficients
+   @param[in]  pCoeffs   points to the initial coefficients in time-reversed order, they are
+                         updated in place
+   @param[in]  pState    points to the state buffer of length numTaps - 1 + blockSize
+   @param[in]  mu        step size
+   @param[in]  fracBits  number of fractional bits of the coefficients and mu
+   @return     none
+*/
+void plp_lms_init_q16(plp_lms_instance_q16 *S,
+                      uint16_t numTaps,
+                      int16_t *pCoeffs,
+                      int16_t *pState,
+                      int16_t mu,
+                      uint32_t fracBits) {
+    PLP_PROFILE_FUNCTION();
+
+    uint32_t i;
+
+    S->numTaps = numTaps;
+    S->pCoeffs = pCoeffs;
+    S->pState = pState;
+    S->mu = mu;
+    S->fracBits = fracBits;
+
+    for (i = 0; i < numTaps - 1U; i++) {
+        pState[i] = 0;
+    }
+}
+
+/**
+   @brief Glue code for the 16-bit fixed-point LMS filter.
+   @param[in]  S          points to the instance structure
+   @param[in]  pSrc       points to the input block
+   @param[in]  pRef       points to the reference block
+   @param[in]  blockSize  number of samples
+   @param[out] pOut       points to the output block
+   @param[out] pErr       points to the error block
+   @return     none
+*/
+void plp_lms_q16(const plp_lms_instance_q16 *S,
+                 const int16_t *__restrict__ pSrc,
+                 const int16_t *__restrict__ pRef,
+                 uint32_t blockSize,
+                 int16_t *__restrict__ pOut,
+                 int16_t *__restrict__ pErr) {
+    PLP_PROFILE_FUNCTION();
+
+    plp_fir_copy_i16(S->pState + S->numTaps - 1, pSrc, blockSize);
+
+    if (hal_cluster_id() == ARCHI_FC_CID) {
+        plp_lms_q16s_rv32im(S->pState, S->pCoeffs, S->numTaps, S->mu, S->fracBits, pRef, blockSize,
+                            pOut, pErr);
+    } else {
+        plp_lms_q16s_xpulpv2(S->pState, S->pCoeffs, S->numTaps, S->mu, S->fracBits, pRef, blockSize,
+                             pOut, pErr);
+    }
+
+    plp_fir_copy_i16(S->pState, S->pState + blockSize, S->numTaps - 1);
+}
+
+/**
+   @} end of AdaptiveFilters group
+*/
@@ -0,0 +1,110 @@
+/* ----------------------------------------------------------------------
+ * Project:      PULP DSP Library
+ * Title:        plp_lms_q32.c
+ * Description:  32-bit fixed-point LMS adaptive filter glue code
+ *
+ * $Date:        19. Oct 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+#include "plp_fir_common.h"
+
+/**
+   @ingroup groupFilters
+*/
+
+/**
+   @addtogroup AdaptiveFilters
+   @{
+*/
+
+/**
+   @brief Initialization of the 32-bit fixed-point LMS and NLMS filters.
+   @param[out] S         points to the instance structure
+   @param[in]  numTaps   number of filter coefficients
+   @param[in]  pCoeffs   points to the initial coefficients in time-reversed order, they are
+                         updated in place
+   @param[in]  pState    points to the state buffer of length numTaps - 1 + blockSize
+   @param[in]  mu        step size
+   @param[in]  fracBits  number of fractional bits of the coefficients and mu
+   @param[in]  delta     regularization of the NLMS filter, added to the energy of the delay line
+                         with fracBits fractional bits, must be positive
+   @return     none
+*/
+void plp_lms_init_q32(plp_lms_instance_q32 *S,
+                      uint16_t numTaps,
+                      int32_t *pCoeffs,
+                      int32_t *pState,
+                      int32_t mu,
+                      uint32_t fracBits,
+                      int32_t delta) {
+    PLP_PROFILE_FUNCTION();
+
+    uint32_t i;
+
+    S->numTaps = numTaps;
+    S->pCoeffs = pCoeffs;
+    S->pState = pState;
+    S->mu = mu;
+    S->fracBits = fracBits;
+    S->delta = delta;
+
+    for (i = 0; i < numTaps - 1U; i++) {
+        pState[i] = 0;
+    }
+}
+
+/**
+   @brief Glue code for the 32-bit fixed-point LMS filter.
+   @param[in]  S          points to the instance structure
+   @param[in]  pSrc       points to the input block
+   @param[in]  pRef       points to the reference block
+   @param[in]  blockSize  number of samples
+   @param[out] pOut       points to the output block
+   @param[out] pErr       points to the error block
+   @return     none
+*/
+void plp_lms_q32(const plp_lms_instance_q32 *S,
+                 const int32_t *__restrict__ pSrc,
+                 const int32_t *__restrict__ pRef,
+                 uint32_t blockSize,
+                 int32_t *__restrict__ pOut,
+                 int32_t *__restrict__ pErr) {
+    PLP_PROFILE_FUNCTION();
+
+    plp_fir_copy_i32(S->pState + S->numTaps - 1, pSrc, blockSize);
+
+    if (hal_cluster_id() == ARCHI_FC_CID) {
+        plp_lms_q32s_rv32im(S->pState, S->pCoeffs, S->numTaps, S->mu, S->fracBits, pRef, blockSize,
+                            pOut, pErr);
+    } else {
+        plp_lms_q32s_xpulpv2(S->pState, S->pCoeffs, S->numTaps, S->mu, S->fracBits, pRef, blockSize,
+                             pOut, pErr);
+    }
+
+    plp_fir_copy_i32(S->pState, S->pState + blockSize, S->numTaps - 1);
+}
+
+/**
+   @} end of AdaptiveFilters group
+*/
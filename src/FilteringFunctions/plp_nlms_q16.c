@@ -0,0 +1,74 @@
+/* ----------------------------------------------------------------------
+ * Project:      PULP DSP Library
+ * Title:        plp_nlms_q16.c
+ * Description:  16-bit fixed-point NLMS adaptive filter glue code
+ *
+ * $Date:        19. Oct 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+#include "plp_fir_common.h"
+
+/**
+   @ingroup groupFilters
+*/
+
+/**
+   @addtogroup AdaptiveFilters
+   @{
+*/
+
+/**
+   @brief Glue code for the 16-bit fixed-point NLMS filter.
+   @param[in]  S          points to the instance structure
+   @param[in]  pSrc       points to the input block
+   @param[in]  pRef       points to the reference block
+   @param[in]  blockSize  number of samples
+   @param[out] pOut       points to the output block
+   @param[out] pErr       points to the error block
+   @return     none
+*/
+void plp_nlms_q16(const plp_lms_instance_q16 *S,
+                  const int16_t *__restrict__ pSrc,
+                  const int16_t *__restrict__ pRef,
+                  uint32_t blockSize,
+                  int16_t *__restrict__ pOut,
+                  int16_t *__restrict__ pErr) {
+    PLP_PROFILE_FUNCTION();
+
+    plp_fir_copy_i16(S->pState + S->numTaps - 1, pSrc, blockSize);
+
+    if (hal_cluster_id() == ARCHI_FC_CID) {
+        plp_nlms_q16s_rv32im(S->pState, S->pCoeffs, S->numTaps, S->mu, S->fracBits, pRef, blockSize,
+                             pOut, pErr);
+    } else {
+        plp_nlms_q16s_xpulpv2(S->pState, S->pCoeffs, S->numTaps, S->mu, S->fracBits, pRef,
+                              blockSize, pOut, pErr);
+    }
+
+    plp_fir_copy_i16(S->pState, S->pState + blockSize, S->numTaps - 1);
+}
+
+/**
+   @} end of AdaptiveFilters group
+*/
@@ -55,6 +55,7 @@ void plp_mat_add_f32(const float *__restrict__ pSrcA,
                      uint32_t M,
                      uint32_t N,
                      float *__restrict__ pDst) {
+    PLP_PROFILE_FUNCTION();
 
     if (hal_cluster_id() == ARCHI_FC_CID) {
         printf("Floating point is supported only for cluster side\n");
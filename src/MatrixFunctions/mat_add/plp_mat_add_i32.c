@@ -54,6 +54,7 @@ void plp_mat_add_i32(const int32_t *__restrict__ pSrcA,
                      uint32_t M,
                      uint32_t N,
                      int32_t *__restrict__ pDst) {
+    PLP_PROFILE_FUNCTION();
 
     if (hal_cluster_id() == ARCHI_FC_CID) {
         plp_mat_add_i32s_rv32im(pSrcA, pSrcB, M, N, pDst);
@@ -56,6 +56,7 @@ void plp_mat_add_i32_parallel(const int32_t *__restrict__ pSrcA,
                               uint32_t N,
                               uint32_t nPE,
                               int32_t *__restrict__ pDst) {
+    PLP_PROFILE_FUNCTION();
 
     if (hal_cluster_id() == ARCHI_FC_CID) {
         printf("parallel processing supported only for cluster side\n");
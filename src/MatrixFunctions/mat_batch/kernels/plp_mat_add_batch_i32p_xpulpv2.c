@@ -0,0 +1,91 @@
+/* ----------------------------------------------------------------------
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_add_batch_i32p_xpulpv2.c
+ * Description:  parallel batched 32-bit integer matrix addition kernel
+ *
+ * $Date:        19. Oct 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+#include "plp_mat_batch_xpulpv2.h"
+
+/**
+  @ingroup MatBatch
+ */
+
+/**
+  @addtogroup MatBatchKernels
+  @{
+ */
+
+/**
+  @brief Parallel batched matrix addition of 32-bit integer matrices kernel for XPULPV2
+         extension.
+  @param[in]  args  pointer to plp_mat_batch_instance struct initialized by
+                    plp_mat_add_batch_i32
+  @return     none
+
+  @par
+  If the matrices of all operands are contiguous, the slice of each core is added as a single
+  vector of (end - start)*M*N elements.
+ */
+
+void plp_mat_add_batch_i32p_xpulpv2(void *args) {
+
+    int core_id = hal_core_id();
+
+    plp_mat_batch_instance *a = (plp_mat_batch_instance *)args;
+
+    const int32_t *__restrict__ pSrcA = (const int32_t *)a->pSrcA;
+    const int32_t *__restrict__ pSrcB = (const int32_t *)a->pSrcB;
+    uint32_t M = a->M;
+    uint32_t N = a->N;
+    uint32_t strideA = a->strideA;
+    uint32_t strideB = a->strideB;
+    uint32_t strideC = a->strideC;
+    int32_t *__restrict__ pDstC = (int32_t *)a->pDstC;
+
+    uint32_t start, end; // slice of the batch
+    uint32_t b;          // loop counter
+
+    plp_mat_batch_slice(a->count, a->nPE, core_id, &start, &end);
+
+    // the unrolled kernel always computes the last element, even of an empty matrix
+    if (start == end) {
+        return;
+    }
+
+    if (strideA == M * N && strideB == M * N && strideC == M * N) {
+        plp_mat_add_i32s_xpulpv2(&pSrcA[start * strideA], &pSrcB[start * strideB], 1,
+                                 (end - start) * M * N, &pDstC[start * strideC]);
+    } else {
+        for (b = start; b < end; b++) {
+            plp_mat_add_i32s_xpulpv2(&pSrcA[b * strideA], &pSrcB[b * strideB], M, N,
+                                     &pDstC[b * strideC]);
+        }
+    }
+}
+
+/**
+  @} end of MatBatchKernels group
+ */
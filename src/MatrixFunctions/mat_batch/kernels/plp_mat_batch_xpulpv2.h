@@ -0,0 +1,55 @@
+/* ----------------------------------------------------------------------
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_batch_xpulpv2.h
+ * Description:  Slices and small matrix kernels of the batched matrix operations
+ *
+ * $Date:        19. Oct 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __PLP_MAT_BATCH_XPULPV2_H__
+#define __PLP_MAT_BATCH_XPULPV2_H__
+
+#include "plp_math.h"
+
+/*
+ * Contiguous slice [*pStart, *pEnd) of the count matrices of the batch computed by core_id. The
+ * first count % nPE cores get one matrix more than the others.
+ */
+static inline void plp_mat_batch_slice(uint32_t count,
+                                       uint32_t nPE,
+                                       uint32_t core_id,
+                                       uint32_t *pStart,
+                                       uint32_t *pEnd) {
+    uint32_t size = count / nPE;
+    uint32_t rem = count % nPE;
+
+    if (core_id < rem) {
+        *pStart = core_id * (size + 1);
+        *pEnd = *pStart + size + 1;
+    } else {
+        *pStart = core_id * size + rem;
+        *pEnd = *pStart + size;
+    }
+}
+
+#endif // __PLP_MAT_BATCH_XPULPV2_H__
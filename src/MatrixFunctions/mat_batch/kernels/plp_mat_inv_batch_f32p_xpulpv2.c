@@ -0,0 +1,84 @@
+/* ----------------------------------------------------------------------
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_inv_batch_f32p_xpulpv2.c
+ * Description:  parallel batched 32-bit floating-point matrix inversion kernel
+ *
+ * $Date:        19. Oct 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+#include "plp_mat_small.h"
+#include "plp_mat_batch_xpulpv2.h"
+
+/**
+  @ingroup MatBatch
+ */
+
+/**
+  @addtogroup MatBatchKernels
+  @{
+ */
+
+/**
+  @brief Parallel batched matrix inversion of 32-bit floating-point matrices kernel for XPULPV2
+         extension.
+  @param[in]  args  pointer to plp_mat_inv_batch_instance_f32 struct initialized by
+                    plp_mat_inv_batch_f32
+  @return     none
+
+  @par
+  A core which finds a singular matrix sets the singular flag of the instance. All the cores only
+  ever write 1 into the flag, hence no synchronization is needed.
+ */
+
+void plp_mat_inv_batch_f32p_xpulpv2(void *args) {
+
+    int core_id = hal_core_id();
+
+    plp_mat_inv_batch_instance_f32 *a = (plp_mat_inv_batch_instance_f32 *)args;
+
+    float *__restrict__ pSrc = a->pSrc;
+    uint32_t N = a->N;
+    uint32_t strideSrc = a->strideSrc;
+    uint32_t strideDst = a->strideDst;
+    float *__restrict__ pDst = a->pDst;
+
+    uint32_t start, end; // slice of the batch
+    uint32_t b;          // loop counter
+
+    plp_mat_batch_slice(a->count, a->nPE, core_id, &start, &end);
+
+    for (b = start; b < end; b++) {
+        int status = plp_mat_inv_small_f32(&pSrc[b * strideSrc], N, &pDst[b * strideDst]);
+        if (status == 2) {
+            status = plp_mat_inv_f32s_xpulpv2(&pSrc[b * strideSrc], N, &pDst[b * strideDst]);
+        }
+        if (status != 0) {
+            a->singular = 1;
+        }
+    }
+}
+
+/**
+  @} end of MatBatchKernels group
+ */
@@ -0,0 +1,97 @@
+/* ----------------------------------------------------------------------
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_inv_batch_f32.c
+ * Description:  batched 32-bit floating-point matrix inversion glue code
+ *
+ * $Date:        19. Oct 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+#include "plp_const_structs.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @addtogroup MatBatch
+  @{
+ */
+
+/**
+  @brief Glue code for batched matrix inversion of 32-bit floating-point matrices.
+  @param[in]  pSrc       points to the first matrix of the batch of inputs (NxN), the inputs are
+                         modified by this function
+  @param[in]  N          width and height of the matrices
+  @param[in]  count      number of matrices in the batch
+  @param[in]  strideSrc  distance between two inputs in elements, at least N*N
+  @param[in]  strideDst  distance between two outputs in elements, at least N*N
+  @param[in]  nPE        Number of cores to use (or PLP_NPE_AUTO)
+  @param[out] pDst       points to the first matrix of the batch of outputs
+  @return     0: Success, 1: at least one matrix is singular, 2: operation not supported
+
+  @par
+  The 2x2, 3x3 and 4x4 matrices are inverted with the fixed-size kernels of plp_mat_small.h, the
+  others with plp_mat_inv_f32s_xpulpv2. The outputs of the singular matrices are undefined, the
+  other matrices of the batch are inverted nevertheless.
+
+  @par
+  With PLP_NPE_AUTO, the number of cores is chosen with the cost model of plp_mat_mult_f32,
+  counting N*N*N operations per matrix. The model is calibrated for the MACs of the
+  multiplication, such that it is only an approximation for the inversion.
+ */
+
+int plp_mat_inv_batch_f32(float *__restrict__ pSrc,
+                          uint32_t N,
+                          uint32_t count,
+                          uint32_t strideSrc,
+                          uint32_t strideDst,
+                          uint32_t nPE,
+                          float *__restrict__ pDst) {
+    PLP_PROFILE_FUNCTION();
+
+    if (hal_cluster_id() == ARCHI_FC_CID) {
+        printf("Floating point is supported only for cluster side\n");
+        return 2;
+    } else {
+        if (nPE == PLP_NPE_AUTO) {
+            nPE = plp_npe_auto(&plp_npe_model_mat_mult_f32, count * N * N * N, count);
+        }
+        plp_mat_inv_batch_instance_f32 args = {
+            .pSrc = pSrc,
+            .N = N,
+            .count = count,
+            .strideSrc = strideSrc,
+            .strideDst = strideDst,
+            .nPE = nPE,
+            .pDst = pDst,
+            .singular = 0
+        };
+        hal_cl_team_fork(nPE, plp_mat_inv_batch_f32p_xpulpv2, (void *)&args);
+        return args.singular;
+    }
+}
+
+/**
+  @} end of MatBatch group
+ */
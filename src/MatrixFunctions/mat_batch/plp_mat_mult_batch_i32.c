@@ -0,0 +1,122 @@
+/* ----------------------------------------------------------------------
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_mult_batch_i32.c
+ * Description:  batched 32-bit integer matrix multiplication glue code
+ *
+ * $Date:        19. Oct 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+#include "plp_const_structs.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @defgroup MatBatch Batched Matrix Operations
+  Computes the same operation on many independent small matrices, e.g. the 3x3 and 4x4
+  rotations, multiplications and inversions of sensor fusion. The parallel functions such as
+  plp_mat_mult_f32_parallel split a single matrix among the cores, which does not pay off for such
+  small sizes. Instead, the batched functions give each core a contiguous slice of the batch,
+  which it computes without any barrier.
+
+  The matrices of a batch are stored with a constant distance (stride, in elements) between the
+  first elements of two consecutive matrices, e.g. M*N for contiguous MxN matrices. A stride of 0
+  for the second operand applies the same matrix to all the matrices of the batch.
+
+  The multiplications and inversions of 2x2, 3x3 and 4x4 matrices (and the products of these
+  matrices with a vector) use the fully unrolled kernels of plp_mat_small.h. The other sizes use
+  the single core kernels of plp_mat_mult, plp_mat_mult_trans and plp_mat_inv.
+ */
+
+/**
+  @addtogroup MatBatch
+  @{
+ */
+
+/**
+  @brief Glue code for batched matrix multiplication of 32-bit integer matrices.
+  @param[in]  pSrcA     points to the first matrix of the batch of first operands (MxN)
+  @param[in]  pSrcB     points to the first matrix of the batch of second operands (NxO)
+  @param[in]  M         height of the first operands and of the outputs
+  @param[in]  N         width of the first operands
+  @param[in]  O         width of the outputs
+  @param[in]  count     number of matrices in the batch
+  @param[in]  strideA   distance between two first operands in elements, at least M*N
+  @param[in]  strideB   distance between two second operands in elements, 0 to use the same
+                        second operand for the whole batch
+  @param[in]  strideC   distance between two outputs in elements, at least M*O
+  @param[in]  nPE       Number of cores to use (or PLP_NPE_AUTO)
+  @param[out] pDstC     points to the first matrix of the batch of outputs
+  @return     none
+
+  @par
+  On the fabric controller, the matrices are computed one after the other with
+  plp_mat_mult_i32s_rv32im, and nPE is ignored.
+ */
+
+void plp_mat_mult_batch_i32(const int32_t *__restrict__ pSrcA,
+                            const int32_t *__restrict__ pSrcB,
+                            uint32_t M,
+                            uint32_t N,
+                            uint32_t O,
+                            uint32_t count,
+                            uint32_t strideA,
+                            uint32_t strideB,
+                            uint32_t strideC,
+                            uint32_t nPE,
+                            int32_t *__restrict__ pDstC) {
+    PLP_PROFILE_FUNCTION();
+
+    if (hal_cluster_id() == ARCHI_FC_CID) {
+        uint32_t b; // loop counter
+
+        for (b = 0; b < count; b++) {
+            plp_mat_mult_i32s_rv32im(&pSrcA[b * strideA], &pSrcB[b * strideB], M, N, O,
+                                     &pDstC[b * strideC]);
+        }
+    } else {
+        if (nPE == PLP_NPE_AUTO) {
+            nPE = plp_npe_auto(&plp_npe_model_mat_mult_i32, count * M * N * O, count);
+        }
+        plp_mat_batch_instance args = {
+            .pSrcA = pSrcA,
+            .pSrcB = pSrcB,
+            .M = M,
+            .N = N,
+            .O = O,
+            .count = count,
+            .strideA = strideA,
+            .strideB = strideB,
+            .strideC = strideC,
+            .nPE = nPE,
+            .pDstC = pDstC
+        };
+        hal_cl_team_fork(nPE, plp_mat_mult_batch_i32p_xpulpv2, (void *)&args);
+    }
+}
+
+/**
+  @} end of MatBatch group
+ */
@@ -47,6 +47,7 @@
  */
 
 void plp_mat_fill_I_f32(uint32_t N, float *__restrict__ pDst) {
+    PLP_PROFILE_FUNCTION();
 
     if (hal_cluster_id() == ARCHI_FC_CID) {
         printf("Floating point is supported only for cluster side\n");
@@ -52,6 +52,7 @@ void plp_mat_fill_I_q16_parallel(uint32_t N,
                                  int32_t fracBits,
                                  uint32_t nPE,
                                  int16_t *__restrict__ pDst) {
+    PLP_PROFILE_FUNCTION();
 
     if (hal_cluster_id() == ARCHI_FC_CID) {
         printf("parallel processing supported only for cluster side\n");
@@ -29,6 +29,7 @@
  */
 
 #include "plp_math.h"
+#include "plp_mat_small.h"
 
 /**
    @ingroup groupMatrix
@@ -72,15 +73,24 @@
   @return     0: Success, 1: Matrix is singular, 2: operation not supported
 
   @par This function will use plp_mat_inv_i32s_xpulpv2 for its computation.
+
+  @par
+  The 2x2, 3x3 and 4x4 matrices are inverted with the fixed-size kernels of plp_mat_small.h, which
+  do not modify pSrc.
  */
 
 int plp_mat_inv_f32(float *__restrict__ pSrc, uint32_t N, float *__restrict__ pDst) {
+    PLP_PROFILE_FUNCTION();
 
     if (hal_cluster_id() == ARCHI_FC_CID) {
         printf("Floating point is supported only for cluster side\n");
         return 2;
     } else {
-        return plp_mat_inv_f32s_xpulpv2(pSrc, N, pDst);
+        int status = plp_mat_inv_small_f32(pSrc, N, pDst);
+        if (status == 2) {
+            status = plp_mat_inv_f32s_xpulpv2(pSrc, N, pDst);
+        }
+        return status;
     }
 }
 
@@ -55,6 +55,7 @@ int plp_mat_inv_f32_parallel(float *__restrict__ pSrc,
                              uint32_t N,
                              uint32_t nPE,
                              float *__restrict__ pDst) {
+    PLP_PROFILE_FUNCTION();
 
     if (hal_cluster_id() == ARCHI_FC_CID) {
         printf("parallel and floating-point processing supported only for cluster side\n");
@@ -29,6 +29,7 @@
  */
 
 #include "plp_math.h"
+#include "plp_const_structs.h"
 
 /**
   @ingroup groupMatrix
@@ -46,7 +47,7 @@
   @param[in]  M         height of the first input matrix
   @param[in]  N         width of the first input matrix and hight of the second
   @param[in]  O         width of the second input matrix
-  @param[in]  nPE       Number of cores to use
+  @param[in]  nPE       Number of cores to use (or PLP_NPE_AUTO)
   @param[out] pDstC     points to the output matrix
   @return     none
  */
@@ -58,11 +59,19 @@ void plp_mat_mult_f32_parallel(const float *__restrict__ pSrcA,
                                uint32_t O,
                                uint32_t nPE,
                                float *__restrict__ pDstC) {
+    PLP_PROFILE_FUNCTION();
 
     if (hal_cluster_id() == ARCHI_FC_CID) {
         printf("parallel and floating-point processing supported only for cluster side\n");
         return;
     } else {
+        if (nPE == PLP_NPE_AUTO) {
+            nPE = plp_npe_auto(&plp_npe_model_mat_mult_f32, M * N * O, M);
+            if (nPE == 1) {
+                plp_mat_mult_f32s_xpulpv2(pSrcA, pSrcB, M, N, O, pDstC);
+                return;
+            }
+        }
         plp_mat_mult_instance_f32 args = {
             .pSrcA = pSrcA, .pSrcB = pSrcB, .M = M, .N = N, .O = O, .nPE = nPE, .pDstC = pDstC
         };
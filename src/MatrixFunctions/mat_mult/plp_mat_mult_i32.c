@@ -29,6 +29,7 @@
  */
 
 #include "plp_math.h"
+#include "plp_mat_small.h"
 
 /**
    @ingroup groupMatrix
@@ -75,6 +76,10 @@
   @param[in]  O         width of the second input matrix
   @param[out] pDstC     points to the output matrix
   @return     none
+
+  @par
+  The multiplications of 2x2, 3x3 and 4x4 matrices, and of these matrices with a vector, are
+  computed with the fixed-size kernels of plp_mat_small.h.
  */
 
 void plp_mat_mult_i32(const int32_t *__restrict__ pSrcA,
@@ -83,6 +88,11 @@ void plp_mat_mult_i32(const int32_t *__restrict__ pSrcA,
                       uint32_t N,
                       uint32_t O,
                       int32_t *__restrict__ pDstC) {
+    PLP_PROFILE_FUNCTION();
+
+    if (plp_mat_mult_small_i32(pSrcA, pSrcB, M, N, O, pDstC)) {
+        return;
+    }
 
     if (hal_cluster_id() == ARCHI_FC_CID) {
         plp_mat_mult_i32s_rv32im(pSrcA, pSrcB, M, N, O, pDstC);
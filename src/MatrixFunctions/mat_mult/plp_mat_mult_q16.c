@@ -29,6 +29,7 @@
  */
 
 #include "plp_math.h"
+#include "plp_mat_small.h"
 
 /**
    @ingroup groupMatrix
@@ -58,6 +59,10 @@
 
   The output of the matrix multiplication will also be stored as an 16-bit
   array. Set the `shift` parameter such that no overflow ocurrs.
+
+  @par
+  The multiplications of 2x2, 3x3 and 4x4 matrices, and of these matrices with a vector, are
+  computed with the fixed-size kernels of plp_mat_small.h.
  */
 
 void plp_mat_mult_q16(const int16_t *__restrict__ pSrcA,
@@ -67,6 +72,11 @@ void plp_mat_mult_q16(const int16_t *__restrict__ pSrcA,
                       uint32_t O,
                       uint32_t shift,
                       int16_t *__restrict__ pDstC) {
+    PLP_PROFILE_FUNCTION();
+
+    if (plp_mat_mult_small_q16(pSrcA, pSrcB, M, N, O, shift, pDstC)) {
+        return;
+    }
 
     if (hal_cluster_id() == ARCHI_FC_CID) {
         plp_mat_mult_q16s_rv32im(pSrcA, pSrcB, M, N, O, shift, pDstC);
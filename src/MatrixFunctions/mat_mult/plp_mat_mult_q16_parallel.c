@@ -29,6 +29,7 @@
  */
 
 #include "plp_math.h"
+#include "plp_const_structs.h"
 
 /**
   @ingroup groupMatrix
@@ -47,7 +48,7 @@
   @param[in]  N         width of the first input matrix and hight of the second
   @param[in]  O         width of the second input matrix
   @param[in]  shift     Amount to shift the result of each multiplication.
-  @param[in]  nPE       Number of cores to use
+  @param[in]  nPE       Number of cores to use (or PLP_NPE_AUTO)
   @param[out] pDstC     points to the output matrix
   @return     none
 
@@ -69,11 +70,19 @@ void plp_mat_mult_q16_parallel(const int16_t *__restrict__ pSrcA,
                                uint32_t shift,
                                uint32_t nPE,
                                int16_t *__restrict__ pDstC) {
+    PLP_PROFILE_FUNCTION();
 
     if (hal_cluster_id() == ARCHI_FC_CID) {
         printf("parallel processing supported only for cluster side\n");
         return;
     } else {
+        if (nPE == PLP_NPE_AUTO) {
+            nPE = plp_npe_auto(&plp_npe_model_mat_mult_q16, M * N * O, M);
+            if (nPE == 1) {
+                plp_mat_mult_q16s_xpulpv2(pSrcA, pSrcB, M, N, O, shift, pDstC);
+                return;
+            }
+        }
         plp_mat_mult_instance_q16 args = { .pSrcA = pSrcA,
                                            .pSrcB = pSrcB,
                                            .M = M,
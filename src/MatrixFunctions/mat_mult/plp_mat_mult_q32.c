@@ -29,6 +29,7 @@
  */
 
 #include "plp_math.h"
+#include "plp_mat_small.h"
 
 /**
    @ingroup groupMatrix
@@ -55,6 +56,10 @@
   by 2^-shift). Assume that matrix A is represented as pSrcA * 2^-x, and matrix
   B as pSrcB * 2^-y (in other words, A has it's x last digits after the binary
   point). Then, the output is represented as pDstC * 2^-(x + y - shift).
+
+  @par
+  The multiplications of 2x2, 3x3 and 4x4 matrices, and of these matrices with a vector, are
+  computed with the fixed-size kernels of plp_mat_small.h.
  */
 
 void plp_mat_mult_q32(const int32_t *__restrict__ pSrcA,
@@ -64,6 +69,11 @@ void plp_mat_mult_q32(const int32_t *__restrict__ pSrcA,
                       uint32_t O,
                       uint32_t shift,
                       int32_t *__restrict__ pDstC) {
+    PLP_PROFILE_FUNCTION();
+
+    if (plp_mat_mult_small_q32(pSrcA, pSrcB, M, N, O, shift, pDstC)) {
+        return;
+    }
 
     if (hal_cluster_id() == ARCHI_FC_CID) {
         plp_mat_mult_q32s_rv32im(pSrcA, pSrcB, M, N, O, shift, pDstC);
@@ -29,6 +29,7 @@
  */
 
 #include "plp_math.h"
+#include "plp_const_structs.h"
 
 /**
   @ingroup groupMatrix
@@ -46,7 +47,7 @@
   @param[in]  M     Height of matrix SrcA and DstC
   @param[in]  N     Width of matrix SrcA and height of matrix SrcB
   @param[in]  O     Width of matrix SrcB and DstC
-  @param[in]  nPE   Number of cores to use for computation
+  @param[in]  nPE   Number of cores to use for computation (or PLP_NPE_AUTO)
   @param[out] pDstC Points to the output matrix of shape MxO
   @return     none
  */
@@ -58,11 +59,19 @@ void plp_mat_mult_cmplx_i8_parallel(const int8_t *__restrict__ pSrcA,
                                     uint32_t O,
                                     uint32_t nPE,
                                     int32_t *__restrict__ pDstC) {
+    PLP_PROFILE_FUNCTION();
 
     if (hal_cluster_id() == ARCHI_FC_CID) {
         printf("parallel processing supported only for cluster side\n");
         return;
     } else {
+        if (nPE == PLP_NPE_AUTO) {
+            nPE = plp_npe_auto(&plp_npe_model_mat_mult_i8, 4 * M * N * O, M);
+            if (nPE == 1) {
+                plp_mat_mult_cmplx_i8s_xpulpv2(pSrcA, pSrcB, M, N, O, pDstC);
+                return;
+            }
+        }
         plp_mat_mult_cmplx_instance_i8 args = {
             .pSrcA = pSrcA, .pSrcB = pSrcB, .M = M, .N = N, .O = O, .nPE = nPE, .pDstC = pDstC
         };
@@ -67,6 +67,7 @@ void plp_mat_mult_cmplx_q32(const int32_t *__restrict__ pSrcA,
                             uint32_t O,
                             uint32_t shift,
                             int32_t *__restrict__ pDstC) {
+    PLP_PROFILE_FUNCTION();
 
     if (hal_cluster_id() == ARCHI_FC_CID) {
         plp_mat_mult_cmplx_q32s_rv32im(pSrcA, pSrcB, M, N, O, shift, pDstC);
@@ -29,6 +29,7 @@
  */
 
 #include "plp_math.h"
+#include "plp_const_structs.h"
 
 /**
   @ingroup groupMatrix
@@ -47,7 +48,7 @@
   @param[in]  N     Width of matrix SrcA and height of matrix SrcB
   @param[in]  O     Width of matrix SrcB and DstC
   @param[in]  shift Amount to shift the result of each multiplication ot the right
-  @param[in]  nPE   Number of cores to use for computation
+  @param[in]  nPE   Number of cores to use for computation (or PLP_NPE_AUTO)
   @param[out] pDstC Points to the output matrix of shape MxO
   @return     none
 
@@ -69,11 +70,19 @@ void plp_mat_mult_cmplx_q32_parallel(const int32_t *__restrict__ pSrcA,
                                      uint32_t shift,
                                      uint32_t nPE,
                                      int32_t *__restrict__ pDstC) {
+    PLP_PROFILE_FUNCTION();
 
     if (hal_cluster_id() == ARCHI_FC_CID) {
         printf("parallel processing supported only for cluster side\n");
         return;
     } else {
+        if (nPE == PLP_NPE_AUTO) {
+            nPE = plp_npe_auto(&plp_npe_model_mat_mult_q32, 4 * M * N * O, M);
+            if (nPE == 1) {
+                plp_mat_mult_cmplx_q32s_xpulpv2(pSrcA, pSrcB, M, N, O, shift, pDstC);
+                return;
+            }
+        }
         plp_mat_mult_cmplx_instance_q32 args = { .pSrcA = pSrcA,
                                                  .pSrcB = pSrcB,
                                                  .M = M,
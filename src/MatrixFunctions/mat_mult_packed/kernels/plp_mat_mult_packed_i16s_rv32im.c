@@ -0,0 +1,90 @@
+/* ----------------------------------------------------------------------
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_mult_packed_i16s_rv32im.c
+ * Description:  Serial 16-bit integer matrix multiplication with packed B kernel for RV32IM
+ *
+ * $Date:        19. Oct 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup MatMultPacked
+ */
+
+/**
+  @addtogroup MatMultPackedKernels
+  @{
+ */
+
+/**
+  @brief Serial matrix multiplication of 16-bit integer matrices with packed B kernel
+         for RV32IM extension.
+  @param[in]  pSrcA     points to the first input matrix
+  @param[in]  pPackedB  points to the second input matrix, packed by plp_mat_pack_b_i16
+  @param[in]  M         height of the first input matrix
+  @param[in]  N         width of the first input matrix and hight of the second
+  @param[in]  O         width of the second input matrix
+  @param[out] pDstC     points to the output matrix
+  @return     none
+ */
+
+void plp_mat_mult_packed_i16s_rv32im(const int16_t *__restrict__ pSrcA,
+                                     const int16_t *__restrict__ pPackedB,
+                                     uint32_t M,
+                                     uint32_t N,
+                                     uint32_t O,
+                                     int32_t *__restrict__ pDstC) {
+
+    uint32_t nBlocks = (N + 1) >> 1;
+    uint32_t oBlocks = (O + 1) >> 1;
+    uint32_t k; // loop counter for the column blocks
+    uint32_t i; // loop counter for the rows of A
+    uint32_t j; // loop counter for the columns of A
+    uint32_t c; // loop counter for the columns in the block
+
+    for (k = 0; k < oBlocks; k++) {
+        const int16_t *pB = &pPackedB[k * nBlocks * 4];
+        uint32_t nCols = (O - k * 2 < 2) ? O - k * 2 : 2;
+
+        for (i = 0; i < M; i++) {
+            const int16_t *pA = &pSrcA[i * N];
+            int32_t sum[2] = { 0 };
+
+            for (j = 0; j < N; j++) {
+                const int16_t *pb = &pB[(j >> 1) * 4 + (j & 1)];
+                int32_t aVal = pA[j];
+                sum[0] += aVal * pb[0];
+                sum[1] += aVal * pb[2];
+            }
+
+            for (c = 0; c < nCols; c++) {
+                pDstC[i * O + k * 2 + c] = sum[c];
+            }
+        }
+    }
+}
+
+/**
+  @} end of MatMultPackedKernels group
+ */
@@ -0,0 +1,99 @@
+/* ----------------------------------------------------------------------
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_mult_packed_i8p_xpulpv2.c
+ * Description:  Parallel 8-bit integer matrix multiplication with packed B kernel for XPULPV2
+ *
+ * $Date:        19. Oct 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+#include "plp_mat_mult_packed_xpulpv2.h"
+
+/**
+  @ingroup MatMultPacked
+ */
+
+/**
+  @addtogroup MatMultPackedKernels
+  @{
+ */
+
+/**
+  @brief Parallel matrix multiplication of 8-bit integer matrices with packed B kernel
+         for XPULPV2 extension.
+  @param[in]  args  pointer to plp_mat_mult_instance_i8 struct initialized by
+                    plp_mat_mult_packed_i8_parallel
+  @return     none
+
+  @par Parallelization
+  The column blocks of the packed matrix B are distributed among the cores, such that each core
+  reads only its own part of B.
+ */
+
+void plp_mat_mult_packed_i8p_xpulpv2(void *args) {
+
+    int core_id = hal_core_id();
+
+    plp_mat_mult_instance_i8 *a = (plp_mat_mult_instance_i8 *)args;
+
+    const int8_t *__restrict__ pSrcA = a->pSrcA;
+    const int8_t *__restrict__ pPackedB = a->pSrcB;
+    uint32_t M = a->M;
+    uint32_t N = a->N;
+    uint32_t O = a->O;
+    uint32_t nPE = a->nPE;
+    int32_t *__restrict__ pDstC = a->pDstC;
+    uint32_t nBlocks = (N + 3) >> 2;
+    uint32_t oBlocks = (O + 3) >> 2;
+    uint32_t k; // loop counter for the column blocks
+    uint32_t i; // loop counter for the rows of A
+    uint32_t c; // loop counter for the columns in the block
+    int32_t sum[8];
+
+    for (k = core_id; k < oBlocks; k += nPE) {
+        const int8_t *pB = &pPackedB[k * nBlocks * 16];
+        uint32_t nCols = (O - k * 4 < 4) ? O - k * 4 : 4;
+        int32_t *pDst = &pDstC[k * 4];
+
+        for (i = 0; i < M; i += 2) {
+            const int8_t *pA0 = &pSrcA[i * N];
+            // if M is odd, the last row is computed twice, but stored once
+            const int8_t *pA1 = (i + 1 < M) ? &pSrcA[(i + 1) * N] : pA0;
+
+            plp_mat_mult_packed_i8_block_xpulpv2(pA0, pA1, pB, N, sum);
+
+            for (c = 0; c < nCols; c++) {
+                pDst[i * O + c] = sum[c];
+            }
+            if (i + 1 < M) {
+                for (c = 0; c < nCols; c++) {
+                    pDst[(i + 1) * O + c] = sum[4 + c];
+                }
+            }
+        }
+    }
+}
+
+/**
+  @} end of MatMultPackedKernels group
+ */
@@ -0,0 +1,169 @@
+/* ----------------------------------------------------------------------
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_mult_packed_xpulpv2.h
+ * Description:  Inner blocks of the matrix multiplications with packed B for XPULPV2
+ *
+ * $Date:        19. Oct 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __PLP_MAT_MULT_PACKED_XPULPV2_H__
+#define __PLP_MAT_MULT_PACKED_XPULPV2_H__
+
+#include "plp_math.h"
+
+/*
+ * Computes the 2x4 block of A * B, where pA0 and pA1 point to two rows of A (of length N), and pB
+ * points to a column block of B packed by plp_mat_pack_b_i8. Each group of 4 bytes in pB is a
+ * piece of a column of B, such that the inner loop consists only of loads and dot products. The
+ * last N % 4 values of the columns are padded with zeros.
+ */
+static inline void plp_mat_mult_packed_i8_block_xpulpv2(const int8_t *__restrict__ pA0,
+                                                        const int8_t *__restrict__ pA1,
+                                                        const int8_t *__restrict__ pB,
+                                                        uint32_t N,
+                                                        int32_t *__restrict__ sum) {
+    uint32_t nFull = N >> 2;
+    const v4s *pBv = (const v4s *)pB;
+    int32_t sum00 = 0;
+    int32_t sum01 = 0;
+    int32_t sum02 = 0;
+    int32_t sum03 = 0;
+    int32_t sum10 = 0;
+    int32_t sum11 = 0;
+    int32_t sum12 = 0;
+    int32_t sum13 = 0;
+    uint32_t j;
+
+    for (j = 0; j < nFull; j++) {
+        v4s aVec0 = *((v4s *)&pA0[j * 4]);
+        v4s aVec1 = *((v4s *)&pA1[j * 4]);
+        v4s bVec0 = pBv[0];
+        v4s bVec1 = pBv[1];
+        v4s bVec2 = pBv[2];
+        v4s bVec3 = pBv[3];
+        pBv += 4;
+
+        sum00 = __SUMDOTP4(aVec0, bVec0, sum00);
+        sum01 = __SUMDOTP4(aVec0, bVec1, sum01);
+        sum02 = __SUMDOTP4(aVec0, bVec2, sum02);
+        sum03 = __SUMDOTP4(aVec0, bVec3, sum03);
+        sum10 = __SUMDOTP4(aVec1, bVec0, sum10);
+        sum11 = __SUMDOTP4(aVec1, bVec1, sum11);
+        sum12 = __SUMDOTP4(aVec1, bVec2, sum12);
+        sum13 = __SUMDOTP4(aVec1, bVec3, sum13);
+    }
+
+    // remaining N % 4 rows of B
+    for (j = nFull * 4; j < N; j++) {
+        const int8_t *pb = &pB[nFull * 16 + (j & 3)];
+        int32_t a0 = pA0[j];
+        int32_t a1 = pA1[j];
+        sum00 += a0 * pb[0];
+        sum01 += a0 * pb[4];
+        sum02 += a0 * pb[8];
+        sum03 += a0 * pb[12];
+        sum10 += a1 * pb[0];
+        sum11 += a1 * pb[4];
+        sum12 += a1 * pb[8];
+        sum13 += a1 * pb[12];
+    }
+
+    sum[0] = sum00;
+    sum[1] = sum01;
+    sum[2] = sum02;
+    sum[3] = sum03;
+    sum[4] = sum10;
+    sum[5] = sum11;
+    sum[6] = sum12;
+    sum[7] = sum13;
+}
+
+/*
+ * Computes the 4x2 block of A * B, where pA[0..3] point to four rows of A (of length N), and pB
+ * points to a column block of B packed by plp_mat_pack_b_i16. Each pair of values in pB is a
+ * piece of a column of B, the last N % 2 values of the columns are padded with zeros.
+ */
+static inline void plp_mat_mult_packed_i16_block_xpulpv2(const int16_t *const *pA,
+                                                         const int16_t *__restrict__ pB,
+                                                         uint32_t N,
+                                                         int32_t *__restrict__ sum) {
+    uint32_t nFull = N >> 1;
+    const int16_t *__restrict__ pA0 = pA[0];
+    const int16_t *__restrict__ pA1 = pA[1];
+    const int16_t *__restrict__ pA2 = pA[2];
+    const int16_t *__restrict__ pA3 = pA[3];
+    const v2s *pBv = (const v2s *)pB;
+    int32_t sum00 = 0;
+    int32_t sum01 = 0;
+    int32_t sum10 = 0;
+    int32_t sum11 = 0;
+    int32_t sum20 = 0;
+    int32_t sum21 = 0;
+    int32_t sum30 = 0;
+    int32_t sum31 = 0;
+    uint32_t j;
+
+    for (j = 0; j < nFull; j++) {
+        v2s aVec0 = *((v2s *)&pA0[j * 2]);
+        v2s aVec1 = *((v2s *)&pA1[j * 2]);
+        v2s aVec2 = *((v2s *)&pA2[j * 2]);
+        v2s aVec3 = *((v2s *)&pA3[j * 2]);
+        v2s bVec0 = pBv[0];
+        v2s bVec1 = pBv[1];
+        pBv += 2;
+
+        sum00 = __SUMDOTP2(aVec0, bVec0, sum00);
+        sum01 = __SUMDOTP2(aVec0, bVec1, sum01);
+        sum10 = __SUMDOTP2(aVec1, bVec0, sum10);
+        sum11 = __SUMDOTP2(aVec1, bVec1, sum11);
+        sum20 = __SUMDOTP2(aVec2, bVec0, sum20);
+        sum21 = __SUMDOTP2(aVec2, bVec1, sum21);
+        sum30 = __SUMDOTP2(aVec3, bVec0, sum30);
+        sum31 = __SUMDOTP2(aVec3, bVec1, sum31);
+    }
+
+    // remaining row of B, if N is odd
+    if (N & 1) {
+        int32_t b0 = pB[nFull * 4];
+        int32_t b1 = pB[nFull * 4 + 2];
+        sum00 += pA0[N - 1] * b0;
+        sum01 += pA0[N - 1] * b1;
+        sum10 += pA1[N - 1] * b0;
+        sum11 += pA1[N - 1] * b1;
+        sum20 += pA2[N - 1] * b0;
+        sum21 += pA2[N - 1] * b1;
+        sum30 += pA3[N - 1] * b0;
+        sum31 += pA3[N - 1] * b1;
+    }
+
+    sum[0] = sum00;
+    sum[1] = sum01;
+    sum[2] = sum10;
+    sum[3] = sum11;
+    sum[4] = sum20;
+    sum[5] = sum21;
+    sum[6] = sum30;
+    sum[7] = sum31;
+}
+
+#endif // __PLP_MAT_MULT_PACKED_XPULPV2_H__
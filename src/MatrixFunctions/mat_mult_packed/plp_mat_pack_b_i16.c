@@ -0,0 +1,79 @@
+/* ----------------------------------------------------------------------
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_pack_b_i16.c
+ * Description:  Packs the second operand of the 16-bit matrix multiplication
+ *
+ * $Date:        19. Oct 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @addtogroup MatMultPacked
+  @{
+ */
+
+/**
+  @brief Packs the 16-bit integer matrix B for plp_mat_mult_packed_i16.
+  @param[in]  pSrcB     points to the matrix B of size NxO
+  @param[in]  N         height of the matrix B
+  @param[in]  O         width of the matrix B
+  @param[out] pPackedB  points to the packed matrix, of size PLP_MAT_PACK_B_I16_SIZE(N, O)
+  @return     none
+ */
+
+void plp_mat_pack_b_i16(const int16_t *__restrict__ pSrcB,
+                        uint32_t N,
+                        uint32_t O,
+                        int16_t *__restrict__ pPackedB) {
+    PLP_PROFILE_FUNCTION();
+
+    uint32_t nBlocks = (N + 1) >> 1;
+    uint32_t oBlocks = (O + 1) >> 1;
+    uint32_t k; // loop counter for the column blocks
+    uint32_t j; // loop counter for the row groups
+    uint32_t c; // loop counter for the columns in the block
+    uint32_t r; // loop counter for the rows in the group
+
+    for (k = 0; k < oBlocks; k++) {
+        for (j = 0; j < nBlocks; j++) {
+            int16_t *pDst = &pPackedB[(k * nBlocks + j) * 4];
+            for (c = 0; c < 2; c++) {
+                uint32_t o = k * 2 + c;
+                for (r = 0; r < 2; r++) {
+                    uint32_t n = j * 2 + r;
+                    pDst[c * 2 + r] = (n < N && o < O) ? pSrcB[n * O + o] : 0;
+                }
+            }
+        }
+    }
+}
+
+/**
+  @} end of MatMultPacked group
+ */
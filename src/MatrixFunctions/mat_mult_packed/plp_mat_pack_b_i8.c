@@ -0,0 +1,103 @@
+/* ----------------------------------------------------------------------
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_pack_b_i8.c
+ * Description:  Packs the second operand of the 8-bit matrix multiplication
+ *
+ * $Date:        19. Oct 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @defgroup MatMultPacked Matrix Multiplication with packed B
+  The matrix multiplication on XPULPV2 computes four products at once with the SIMD dot product
+  (__SUMDOTP4 for 8-bit, __SUMDOTP2 for 16-bit). Since B is stored row major, the kernels of
+  plp_mat_mult have to gather the columns of B into vectors with shuffle operations, on every call.
+  When B is constant (e.g. the weights of a neural network layer), it can be reordered once with
+  plp_mat_pack_b_i8 (or plp_mat_pack_b_i16, plp_mat_pack_b_q8, plp_mat_pack_b_q16), such that the
+  columns are contiguous in memory. Then, plp_mat_mult_packed_i8 (and the other variants) compute
+  C = A * B with only loads and dot products in the inner loop.
+
+  The 8-bit variants split B into blocks of 4 columns. Each block stores, for every group of 4
+  rows, the 4 values of the first column, followed by the 4 values of the second column, etc.:
+  <pre>
+  B[n][o] -> pPackedB[((o / 4) * ceil(N / 4) + n / 4) * 16 + (o % 4) * 4 + n % 4]
+  </pre>
+  The 16-bit variants use blocks of 2 columns and groups of 2 rows:
+  <pre>
+  B[n][o] -> pPackedB[((o / 2) * ceil(N / 2) + n / 2) * 4 + (o % 2) * 2 + n % 2]
+  </pre>
+  Missing rows and columns (if N or O is not a multiple of the block size) are filled with zeros.
+  The packed buffer holds PLP_MAT_PACK_B_I8_SIZE(N, O) or PLP_MAT_PACK_B_I16_SIZE(N, O) elements,
+  and must be 4-byte aligned.
+ */
+
+/**
+  @addtogroup MatMultPacked
+  @{
+ */
+
+/**
+  @brief Packs the 8-bit integer matrix B for plp_mat_mult_packed_i8.
+  @param[in]  pSrcB     points to the matrix B of size NxO
+  @param[in]  N         height of the matrix B
+  @param[in]  O         width of the matrix B
+  @param[out] pPackedB  points to the packed matrix, of size PLP_MAT_PACK_B_I8_SIZE(N, O)
+  @return     none
+ */
+
+void plp_mat_pack_b_i8(const int8_t *__restrict__ pSrcB,
+                       uint32_t N,
+                       uint32_t O,
+                       int8_t *__restrict__ pPackedB) {
+    PLP_PROFILE_FUNCTION();
+
+    uint32_t nBlocks = (N + 3) >> 2;
+    uint32_t oBlocks = (O + 3) >> 2;
+    uint32_t k; // loop counter for the column blocks
+    uint32_t j; // loop counter for the row groups
+    uint32_t c; // loop counter for the columns in the block
+    uint32_t r; // loop counter for the rows in the group
+
+    for (k = 0; k < oBlocks; k++) {
+        for (j = 0; j < nBlocks; j++) {
+            int8_t *pDst = &pPackedB[(k * nBlocks + j) * 16];
+            for (c = 0; c < 4; c++) {
+                uint32_t o = k * 4 + c;
+                for (r = 0; r < 4; r++) {
+                    uint32_t n = j * 4 + r;
+                    pDst[c * 4 + r] = (n < N && o < O) ? pSrcB[n * O + o] : 0;
+                }
+            }
+        }
+    }
+}
+
+/**
+  @} end of MatMultPacked group
+ */
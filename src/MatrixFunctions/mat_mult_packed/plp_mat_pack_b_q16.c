@@ -0,0 +1,63 @@
+/* ----------------------------------------------------------------------
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_pack_b_q16.c
+ * Description:  Packs the second operand of the 16-bit fix-point matrix multiplication
+ *
+ * $Date:        19. Oct 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @addtogroup MatMultPacked
+  @{
+ */
+
+/**
+  @brief Packs the 16-bit fix-point matrix B for plp_mat_mult_packed_q16.
+  @param[in]  pSrcB     points to the matrix B of size NxO
+  @param[in]  N         height of the matrix B
+  @param[in]  O         width of the matrix B
+  @param[out] pPackedB  points to the packed matrix, of size PLP_MAT_PACK_B_I16_SIZE(N, O)
+  @return     none
+
+  The layout does not depend on the fix-point format, it is the same as for plp_mat_pack_b_i16.
+ */
+
+void plp_mat_pack_b_q16(const int16_t *__restrict__ pSrcB,
+                        uint32_t N,
+                        uint32_t O,
+                        int16_t *__restrict__ pPackedB) {
+    PLP_PROFILE_FUNCTION();
+
+    plp_mat_pack_b_i16(pSrcB, N, O, pPackedB);
+}
+
+/**
+  @} end of MatMultPacked group
+ */
@@ -0,0 +1,178 @@
+/* ----------------------------------------------------------------------
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_mult_requant_i8_xpulpv2.h
+ * Description:  Row pairs of the 8-bit matrix multiplication with requantization for XPULPV2
+ *
+ * $Date:        19. Oct 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __PLP_MAT_MULT_REQUANT_I8_XPULPV2_H__
+#define __PLP_MAT_MULT_REQUANT_I8_XPULPV2_H__
+
+#include "plp_math.h"
+
+HAL_CL_L1 static v4s plp_requant_mask0 = { 0, 1, 4, 5 };
+HAL_CL_L1 static v4s plp_requant_mask1 = { 2, 3, 6, 7 };
+HAL_CL_L1 static v4s plp_requant_mask2 = { 0, 2, 4, 6 };
+HAL_CL_L1 static v4s plp_requant_mask3 = { 1, 3, 5, 7 };
+
+/*
+ * Requantization parameters of one row of the output, loaded once per row.
+ */
+typedef struct {
+    int32_t bias;
+    int32_t mult;
+    uint32_t shift;
+    int32_t round;
+} plp_requant_row_i8;
+
+static inline void plp_requant_load_row_i8(const plp_requant_params_i8 *pParams,
+                                           uint32_t m,
+                                           plp_requant_row_i8 *pRow) {
+    pRow->bias = (pParams->pBias != NULL) ? pParams->pBias[m] : 0;
+    pRow->mult = pParams->pMult[m];
+    pRow->shift = pParams->pShift[m];
+    pRow->round = (1 << pRow->shift) >> 1;
+}
+
+static inline int8_t plp_requant_i8_xpulpv2(int32_t acc,
+                                            const plp_requant_row_i8 *pRow,
+                                            int32_t outMin,
+                                            int32_t outMax) {
+    int32_t val = ((acc + pRow->bias) * pRow->mult + pRow->round) >> pRow->shift;
+    return (int8_t)__MIN(__MAX(val, outMin), outMax);
+}
+
+/*
+ * Computes the rows m0 and m1 of the output, and stores them requantized to 8 bits. The columns
+ * of B are gathered four by four with shuffles, as in plp_mat_mult_i8s_xpulpv2, and the remaining
+ * N % 4 products and O % 4 columns are computed without SIMD. If only one row is left, m1 == m0
+ * and pC1 is NULL.
+ */
+static inline void plp_mat_mult_requant_i8_rows_xpulpv2(const int8_t *__restrict__ pSrcA,
+                                                        const int8_t *__restrict__ pSrcB,
+                                                        uint32_t N,
+                                                        uint32_t O,
+                                                        uint32_t strideA,
+                                                        uint32_t strideB,
+                                                        const plp_requant_params_i8 *pParams,
+                                                        uint32_t m0,
+                                                        uint32_t m1,
+                                                        int8_t *__restrict__ pC0,
+                                                        int8_t *__restrict__ pC1) {
+    const int8_t *pA0 = &pSrcA[m0 * strideA];
+    const int8_t *pA1 = &pSrcA[m1 * strideA];
+    int32_t outMin = pParams->outMin;
+    int32_t outMax = pParams->outMax;
+    plp_requant_row_i8 row0;
+    plp_requant_row_i8 row1;
+    uint32_t j; // loop counter for N
+    uint32_t k; // loop counter for O
+
+    plp_requant_load_row_i8(pParams, m0, &row0);
+    plp_requant_load_row_i8(pParams, m1, &row1);
+
+    for (k = 0; k < O / 4; k++) {
+        const int8_t *pB = &pSrcB[k * 4];
+        int32_t sum00 = 0;
+        int32_t sum01 = 0;
+        int32_t sum02 = 0;
+        int32_t sum03 = 0;
+        int32_t sum10 = 0;
+        int32_t sum11 = 0;
+        int32_t sum12 = 0;
+        int32_t sum13 = 0;
+
+        for (j = 0; j < N / 4; j++) {
+            v4s aVec0 = *((v4s *)&pA0[j * 4]);
+            v4s aVec1 = *((v4s *)&pA1[j * 4]);
+
+            v4s temp0 = *((v4s *)&pB[(j * 4) * strideB]);
+            v4s temp1 = *((v4s *)&pB[(j * 4 + 1) * strideB]);
+            v4s temp2 = *((v4s *)&pB[(j * 4 + 2) * strideB]);
+            v4s temp3 = *((v4s *)&pB[(j * 4 + 3) * strideB]);
+
+            v4s temp4 = __builtin_shuffle(temp0, temp1, plp_requant_mask0); // 0,1,4,5
+            v4s temp5 = __builtin_shuffle(temp2, temp3, plp_requant_mask0); // 8,9,12,13
+            v4s temp6 = __builtin_shuffle(temp0, temp1, plp_requant_mask1); // 2,3,6,7
+            v4s temp7 = __builtin_shuffle(temp2, temp3, plp_requant_mask1); // 10,11,14,15
+
+            v4s bVec0 = __builtin_shuffle(temp4, temp5, plp_requant_mask2); // 0,4,8,12
+            v4s bVec1 = __builtin_shuffle(temp4, temp5, plp_requant_mask3); // 1,5,9,13
+            v4s bVec2 = __builtin_shuffle(temp6, temp7, plp_requant_mask2); // 2,6,10,14
+            v4s bVec3 = __builtin_shuffle(temp6, temp7, plp_requant_mask3); // 3,7,11,15
+
+            sum00 = __SUMDOTP4(aVec0, bVec0, sum00);
+            sum01 = __SUMDOTP4(aVec0, bVec1, sum01);
+            sum02 = __SUMDOTP4(aVec0, bVec2, sum02);
+            sum03 = __SUMDOTP4(aVec0, bVec3, sum03);
+            sum10 = __SUMDOTP4(aVec1, bVec0, sum10);
+            sum11 = __SUMDOTP4(aVec1, bVec1, sum11);
+            sum12 = __SUMDOTP4(aVec1, bVec2, sum12);
+            sum13 = __SUMDOTP4(aVec1, bVec3, sum13);
+        }
+
+        // remaining N % 4 rows of B
+        for (j = j * 4; j < N; j++) {
+            int32_t a0 = pA0[j];
+            int32_t a1 = pA1[j];
+            const int8_t *pb = &pB[j * strideB];
+            sum00 += a0 * pb[0];
+            sum01 += a0 * pb[1];
+            sum02 += a0 * pb[2];
+            sum03 += a0 * pb[3];
+            sum10 += a1 * pb[0];
+            sum11 += a1 * pb[1];
+            sum12 += a1 * pb[2];
+            sum13 += a1 * pb[3];
+        }
+
+        pC0[k * 4] = plp_requant_i8_xpulpv2(sum00, &row0, outMin, outMax);
+        pC0[k * 4 + 1] = plp_requant_i8_xpulpv2(sum01, &row0, outMin, outMax);
+        pC0[k * 4 + 2] = plp_requant_i8_xpulpv2(sum02, &row0, outMin, outMax);
+        pC0[k * 4 + 3] = plp_requant_i8_xpulpv2(sum03, &row0, outMin, outMax);
+        if (pC1 != NULL) {
+            pC1[k * 4] = plp_requant_i8_xpulpv2(sum10, &row1, outMin, outMax);
+            pC1[k * 4 + 1] = plp_requant_i8_xpulpv2(sum11, &row1, outMin, outMax);
+            pC1[k * 4 + 2] = plp_requant_i8_xpulpv2(sum12, &row1, outMin, outMax);
+            pC1[k * 4 + 3] = plp_requant_i8_xpulpv2(sum13, &row1, outMin, outMax);
+        }
+    }
+
+    // remaining O % 4 columns
+    for (k = k * 4; k < O; k++) {
+        int32_t sum0 = 0;
+        int32_t sum1 = 0;
+        for (j = 0; j < N; j++) {
+            int32_t b = pSrcB[j * strideB + k];
+            sum0 += pA0[j] * b;
+            sum1 += pA1[j] * b;
+        }
+        pC0[k] = plp_requant_i8_xpulpv2(sum0, &row0, outMin, outMax);
+        if (pC1 != NULL) {
+            pC1[k] = plp_requant_i8_xpulpv2(sum1, &row1, outMin, outMax);
+        }
+    }
+}
+
+#endif // __PLP_MAT_MULT_REQUANT_I8_XPULPV2_H__
@@ -0,0 +1,87 @@
+/* ----------------------------------------------------------------------
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_mult_requant_i8p_xpulpv2.c
+ * Description:  Parallel 8-bit matrix multiplication with requantization kernel for XPULPV2
+ *
+ * $Date:        19. Oct 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+#include "plp_mat_mult_requant_i8_xpulpv2.h"
+
+/**
+  @ingroup MatMultRequant
+ */
+
+/**
+  @addtogroup MatMultRequantKernels
+  @{
+ */
+
+/**
+  @brief Parallel matrix multiplication of 8-bit integer matrices with requantization kernel for
+         XPULPV2 extension.
+  @param[in]  args  pointer to plp_mat_mult_requant_instance_i8 struct initialized by
+                    plp_mat_mult_requant_i8_parallel or plp_mat_mult_requant_stride_i8_parallel
+  @return     none
+
+  @par Parallelization
+  The pairs of output rows are distributed among the cores, such that each core loads the
+  requantization parameters only of its own rows.
+ */
+
+void plp_mat_mult_requant_i8p_xpulpv2(void *args) {
+
+    int core_id = hal_core_id();
+
+    plp_mat_mult_requant_instance_i8 *a = (plp_mat_mult_requant_instance_i8 *)args;
+
+    const int8_t *__restrict__ pSrcA = a->pSrcA;
+    const int8_t *__restrict__ pSrcB = a->pSrcB;
+    uint32_t M = a->M;
+    uint32_t N = a->N;
+    uint32_t O = a->O;
+    uint32_t strideA = a->strideA;
+    uint32_t strideB = a->strideB;
+    uint32_t strideC = a->strideC;
+    const plp_requant_params_i8 *pParams = a->pParams;
+    uint32_t nPE = a->nPE;
+    int8_t *__restrict__ pDstC = a->pDstC;
+
+    uint32_t m; // loop counter for M
+
+    for (m = core_id * 2; m < M; m += nPE * 2) {
+        if (m + 1 < M) {
+            plp_mat_mult_requant_i8_rows_xpulpv2(pSrcA, pSrcB, N, O, strideA, strideB, pParams, m,
+                                                 m + 1, &pDstC[m * strideC],
+                                                 &pDstC[(m + 1) * strideC]);
+        } else {
+            plp_mat_mult_requant_i8_rows_xpulpv2(pSrcA, pSrcB, N, O, strideA, strideB, pParams, m,
+                                                 m, &pDstC[m * strideC], NULL);
+        }
+    }
+}
+
+/**
+  @} end of MatMultRequantKernels group
+ */
@@ -0,0 +1,112 @@
+/* ----------------------------------------------------------------------
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_mult_requant_i8s_rv32im.c
+ * Description:  8-bit matrix multiplication with requantization kernel for RV32IM
+ *
+ * $Date:        19. Oct 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup MatMultRequant
+ */
+
+/**
+  @defgroup MatMultRequantKernels Matrix Multiplication with Requantization Kernels
+  This module contains the kernels for the 8-bit matrix multiplication with requantization. The
+  kernels work on strided matrices, the glue code of the contiguous matrices passes N, O and O as
+  strides.
+ */
+
+/**
+  @addtogroup MatMultRequantKernels
+  @{
+ */
+
+static inline int8_t plp_requant_i8_rv32im(int32_t acc,
+                                           int32_t mult,
+                                           uint32_t shift,
+                                           int32_t outMin,
+                                           int32_t outMax) {
+    int32_t val = (acc * mult + ((1 << shift) >> 1)) >> shift;
+    if (val < outMin) {
+        val = outMin;
+    }
+    if (val > outMax) {
+        val = outMax;
+    }
+    return (int8_t)val;
+}
+
+/**
+  @brief Matrix multiplication of 8-bit integer matrices with requantization kernel for RV32IM
+         extension.
+  @param[in]  pSrcA     points to the first input matrix
+  @param[in]  pSrcB     points to the second input matrix
+  @param[in]  M         height of the first input matrix
+  @param[in]  N         width of the first input matrix and hight of the second
+  @param[in]  O         width of the second input matrix
+  @param[in]  strideA   Stride of matrix A (elements between each row)
+  @param[in]  strideB   Stride of matrix B (elements between each row)
+  @param[in]  strideC   Stride of output matrix (elements between each row)
+  @param[in]  pParams   points to the requantization parameters
+  @param[out] pDstC     points to the output matrix
+  @return     none
+ */
+
+void plp_mat_mult_requant_i8s_rv32im(const int8_t *__restrict__ pSrcA,
+                                     const int8_t *__restrict__ pSrcB,
+                                     uint32_t M,
+                                     uint32_t N,
+                                     uint32_t O,
+                                     uint32_t strideA,
+                                     uint32_t strideB,
+                                     uint32_t strideC,
+                                     const plp_requant_params_i8 *pParams,
+                                     int8_t *__restrict__ pDstC) {
+
+    int32_t outMin = pParams->outMin;
+    int32_t outMax = pParams->outMax;
+    uint32_t m; // loop counter for M
+    uint32_t n; // loop counter for N
+    uint32_t o; // loop counter for O
+
+    for (m = 0; m < M; m++) {
+        int32_t bias = (pParams->pBias != NULL) ? pParams->pBias[m] : 0;
+        int32_t mult = pParams->pMult[m];
+        uint32_t shift = pParams->pShift[m];
+
+        for (o = 0; o < O; o++) {
+            int32_t sum = bias;
+            for (n = 0; n < N; n++) {
+                sum += (int32_t)pSrcA[m * strideA + n] * (int32_t)pSrcB[n * strideB + o];
+            }
+            pDstC[m * strideC + o] = plp_requant_i8_rv32im(sum, mult, shift, outMin, outMax);
+        }
+    }
+}
+
+/**
+  @} end of MatMultRequantKernels group
+ */
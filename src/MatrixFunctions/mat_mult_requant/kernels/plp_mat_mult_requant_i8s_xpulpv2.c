@@ -0,0 +1,87 @@
+/* ----------------------------------------------------------------------
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_mult_requant_i8s_xpulpv2.c
+ * Description:  8-bit matrix multiplication with requantization kernel for XPULPV2
+ *
+ * $Date:        19. Oct 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+#include "plp_mat_mult_requant_i8_xpulpv2.h"
+
+/**
+  @ingroup MatMultRequant
+ */
+
+/**
+  @addtogroup MatMultRequantKernels
+  @{
+ */
+
+/**
+  @brief Matrix multiplication of 8-bit integer matrices with requantization kernel for XPULPV2
+         extension.
+  @param[in]  pSrcA     points to the first input matrix
+  @param[in]  pSrcB     points to the second input matrix
+  @param[in]  M         height of the first input matrix
+  @param[in]  N         width of the first input matrix and hight of the second
+  @param[in]  O         width of the second input matrix
+  @param[in]  strideA   Stride of matrix A (elements between each row)
+  @param[in]  strideB   Stride of matrix B (elements between each row)
+  @param[in]  strideC   Stride of output matrix (elements between each row)
+  @param[in]  pParams   points to the requantization parameters
+  @param[out] pDstC     points to the output matrix
+  @return     none
+
+  @par Exploiting SIMD instructions
+  Two rows of the output are computed at once, with four dot products of four 8-bit values per
+  SIMD instruction. The 32-bit accumulators are requantized in registers and stored as 8-bit.
+ */
+
+void plp_mat_mult_requant_i8s_xpulpv2(const int8_t *__restrict__ pSrcA,
+                                      const int8_t *__restrict__ pSrcB,
+                                      uint32_t M,
+                                      uint32_t N,
+                                      uint32_t O,
+                                      uint32_t strideA,
+                                      uint32_t strideB,
+                                      uint32_t strideC,
+                                      const plp_requant_params_i8 *pParams,
+                                      int8_t *__restrict__ pDstC) {
+
+    uint32_t m; // loop counter for M
+
+    for (m = 0; m + 1 < M; m += 2) {
+        plp_mat_mult_requant_i8_rows_xpulpv2(pSrcA, pSrcB, N, O, strideA, strideB, pParams, m,
+                                             m + 1, &pDstC[m * strideC],
+                                             &pDstC[(m + 1) * strideC]);
+    }
+    if (m < M) {
+        plp_mat_mult_requant_i8_rows_xpulpv2(pSrcA, pSrcB, N, O, strideA, strideB, pParams, m, m,
+                                             &pDstC[m * strideC], NULL);
+    }
+}
+
+/**
+  @} end of MatMultRequantKernels group
+ */
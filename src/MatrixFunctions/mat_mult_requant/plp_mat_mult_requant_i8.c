@@ -0,0 +1,88 @@
+/* ----------------------------------------------------------------------
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_mult_requant_i8.c
+ * Description:  8-bit matrix multiplication with requantization glue code
+ *
+ * $Date:        19. Oct 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @defgroup MatMultRequant Matrix Multiplication with Requantization
+  Multiplies two 8-bit integer matrices and requantizes the 32-bit result to 8 bits in the same
+  pass, as needed by quantized dense layers. Each output value of row m is computed as
+
+      acc = pSrcA[m,0]*pSrcB[0,o] + ... + pSrcA[m,N-1]*pSrcB[N-1,o]
+      pDstC[m,o] = clamp(((acc + pBias[m]) * pMult[m] + 2^(pShift[m]-1)) >> pShift[m],
+                         outMin, outMax)
+
+  where the bias, the multiplier and the shift are given per row (i.e. per output channel, when
+  pSrcA holds the weights), see plp_requant_params_i8. The bias may be NULL. Setting outMin to 0
+  applies a ReLU, and outMax to the 8-bit equivalent of 6 additionally a ReLU6.
+
+  The products and the bias are accumulated in 32 bits, and (acc + pBias[m]) * pMult[m] must not
+  overflow 32 bits. Compared to plp_mat_mult_i8 followed by separate passes for the bias, the
+  scaling and the activation, this avoids the 32-bit intermediate output buffer.
+ */
+
+/**
+  @addtogroup MatMultRequant
+  @{
+ */
+
+/**
+  @brief Glue code for matrix multiplication of 8-bit integer matrices with requantization.
+  @param[in]  pSrcA     points to the first input matrix
+  @param[in]  pSrcB     points to the second input matrix
+  @param[in]  M         height of the first input matrix
+  @param[in]  N         width of the first input matrix and hight of the second
+  @param[in]  O         width of the second input matrix
+  @param[in]  pParams   points to the requantization parameters
+  @param[out] pDstC     points to the output matrix
+  @return     none
+ */
+
+void plp_mat_mult_requant_i8(const int8_t *__restrict__ pSrcA,
+                             const int8_t *__restrict__ pSrcB,
+                             uint32_t M,
+                             uint32_t N,
+                             uint32_t O,
+                             const plp_requant_params_i8 *pParams,
+                             int8_t *__restrict__ pDstC) {
+    PLP_PROFILE_FUNCTION();
+
+    if (hal_cluster_id() == ARCHI_FC_CID) {
+        plp_mat_mult_requant_i8s_rv32im(pSrcA, pSrcB, M, N, O, N, O, O, pParams, pDstC);
+    } else {
+        plp_mat_mult_requant_i8s_xpulpv2(pSrcA, pSrcB, M, N, O, N, O, O, pParams, pDstC);
+    }
+}
+
+/**
+  @} end of MatMultRequant group
+ */
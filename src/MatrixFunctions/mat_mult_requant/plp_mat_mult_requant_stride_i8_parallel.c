@@ -0,0 +1,102 @@
+/* ----------------------------------------------------------------------
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_mult_requant_stride_i8_parallel.c
+ * Description:  Parallel strided 8-bit matrix multiplication with requantization glue code
+ *
+ * $Date:        19. Oct 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+#include "plp_const_structs.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @addtogroup MatMultRequant
+  @{
+ */
+
+/**
+  @brief Glue code for parallel strided matrix multiplication of 8-bit integer matrices
+         with requantization.
+  @param[in]  pSrcA     points to the first input matrix
+  @param[in]  pSrcB     points to the second input matrix
+  @param[in]  M         height of the first input matrix
+  @param[in]  N         width of the first input matrix and hight of the second
+  @param[in]  O         width of the second input matrix
+  @param[in]  strideA   Stride of matrix A (elements between each row)
+  @param[in]  strideB   Stride of matrix B (elements between each row)
+  @param[in]  strideC   Stride of output matrix (elements between each row)
+  @param[in]  pParams   points to the requantization parameters
+  @param[in]  nPE       Number of cores to use (or PLP_NPE_AUTO)
+  @param[out] pDstC     points to the output matrix
+  @return     none
+ */
+
+void plp_mat_mult_requant_stride_i8_parallel(const int8_t *__restrict__ pSrcA,
+                                             const int8_t *__restrict__ pSrcB,
+                                             uint32_t M,
+                                             uint32_t N,
+                                             uint32_t O,
+                                             uint32_t strideA,
+                                             uint32_t strideB,
+                                             uint32_t strideC,
+                                             const plp_requant_params_i8 *pParams,
+                                             uint32_t nPE,
+                                             int8_t *__restrict__ pDstC) {
+    PLP_PROFILE_FUNCTION();
+
+    if (hal_cluster_id() == ARCHI_FC_CID) {
+        printf("parallel processing supported only for cluster side\n");
+        return;
+    } else {
+        if (nPE == PLP_NPE_AUTO) {
+            nPE = plp_npe_auto(&plp_npe_model_mat_mult_i8, M * N * O, (M + 1) / 2);
+            if (nPE == 1) {
+                plp_mat_mult_requant_i8s_xpulpv2(pSrcA, pSrcB, M, N, O, strideA, strideB, strideC,
+                                                 pParams, pDstC);
+                return;
+            }
+        }
+        plp_mat_mult_requant_instance_i8 args = {
+            .pSrcA = pSrcA,
+            .pSrcB = pSrcB,
+            .M = M,
+            .N = N,
+            .O = O,
+            .strideA = strideA,
+            .strideB = strideB,
+            .strideC = strideC,
+            .pParams = pParams,
+            .nPE = nPE,
+            .pDstC = pDstC
+        };
+        hal_cl_team_fork(nPE, plp_mat_mult_requant_i8p_xpulpv2, (void *)&args);
+    }
+}
+
+/**
+  @} end of MatMultRequant group
+ */
@@ -29,6 +29,7 @@
  */
 
 #include "plp_math.h"
+#include "plp_mat_small.h"
 
 /**
    @ingroup groupMatrix
@@ -48,6 +49,10 @@
   @param[in]  O         width of the second input matrix
   @param[out] pDstC     points to the output matrix
   @return     none
+
+  @par
+  The multiplications of 2x2, 3x3 and 4x4 matrices, and of these matrices with a vector, are
+  computed with the fixed-size kernels of plp_mat_small.h.
  */
 
 void plp_mat_mult_trans_f32(const float *__restrict__ pSrcA,
@@ -56,12 +61,15 @@ void plp_mat_mult_trans_f32(const float *__restrict__ pSrcA,
                             uint32_t N,
                             uint32_t O,
                             float *__restrict__ pDstC) {
+    PLP_PROFILE_FUNCTION();
 
     if (hal_cluster_id() == ARCHI_FC_CID) {
         printf("Floating point is supported only for cluster side\n");
         return;
     } else {
-        plp_mat_mult_trans_f32s_xpulpv2(pSrcA, pSrcB, M, N, O, pDstC);
+        if (!plp_mat_mult_trans_small_f32(pSrcA, pSrcB, M, N, O, pDstC)) {
+            plp_mat_mult_trans_f32s_xpulpv2(pSrcA, pSrcB, M, N, O, pDstC);
+        }
     }
 }
 
@@ -67,6 +67,7 @@ void plp_mat_mult_trans_q8(const int8_t *__restrict__ pSrcA,
                            uint32_t O,
                            uint32_t shift,
                            int8_t *__restrict__ pDstC) {
+    PLP_PROFILE_FUNCTION();
 
     if (hal_cluster_id() == ARCHI_FC_CID) {
         plp_mat_mult_trans_q8s_rv32im(pSrcA, pSrcB, M, N, O, shift, pDstC);
@@ -58,6 +58,7 @@ void plp_mat_scale_i8_parallel(const int8_t *__restrict__ pSrc,
                                int32_t shift,
                                uint32_t nPE,
                                int8_t *__restrict__ pDst) {
+    PLP_PROFILE_FUNCTION();
 
     if (hal_cluster_id() == ARCHI_FC_CID) {
         printf("parallel processing supported only for cluster side\n");
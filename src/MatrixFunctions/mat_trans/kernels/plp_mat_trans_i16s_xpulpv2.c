@@ -29,6 +29,7 @@
  */
 
 #include "plp_math.h"
+#include "plp_mat_trans_xpulpv2.h"
 
 /**
   @ingroup MatTrans
@@ -46,6 +47,10 @@
   @param[in]  N    Width of the input matrix and height of the output matrix
   @param[out] pDst Points to the output matrix of shape NxM
   @return     none
+
+  @par Exploiting SIMD instructions
+  The matrix is transposed in tiles of 2x2 values. Each tile is loaded as two 32-bit vectors,
+  transposed with shuffle instructions and stored as two 32-bit vectors.
  */
 
 void plp_mat_trans_i16s_xpulpv2(const int16_t *__restrict__ pSrc,
@@ -53,7 +58,7 @@ void plp_mat_trans_i16s_xpulpv2(const int16_t *__restrict__ pSrc,
                                 uint32_t N,
                                 int16_t *__restrict__ pDst) {
 
-#define BASIC_VERSION // if used don't forget to also use the undefine at end of file
+// #define BASIC_VERSION // if used don't forget to also use the undefine at end of file
 #ifdef BASIC_VERSION
 
     for (int m = 0; m < M; m++) {
@@ -64,7 +69,9 @@ void plp_mat_trans_i16s_xpulpv2(const int16_t *__restrict__ pSrc,
 
 #else
 
-    // TODO: Hackathon
+    for (uint32_t m = 0; m < M; m += 2) {
+        plp_mat_trans_rows_i16_xpulpv2(pSrc, M, N, m, pDst);
+    }
 
 #endif
 #undef BASIC_VERSION
@@ -29,6 +29,7 @@
  */
 
 #include "plp_math.h"
+#include "plp_mat_trans_xpulpv2.h"
 
 /**
   @ingroup MatTrans
@@ -58,7 +59,7 @@ void plp_mat_trans_i32p_xpulpv2(void *args) {
     uint32_t nPE = a->nPE;
     int32_t *__restrict__ pDst = a->pDst;
 
-#define BASIC_VERSION // if used don't forget to also use the undefine at end of file
+// #define BASIC_VERSION // if used don't forget to also use the undefine at end of file
 #ifdef BASIC_VERSION
 
     for (int m = core_id; m < M; m += nPE) {
@@ -69,7 +70,9 @@ void plp_mat_trans_i32p_xpulpv2(void *args) {
 
 #else
 
-    // TODO: Hackathon
+    for (uint32_t m = core_id * 4; m < M; m += nPE * 4) {
+        plp_mat_trans_rows_i32_xpulpv2(pSrc, M, N, m, pDst);
+    }
 
 #endif
 #undef BASIC_VERSION
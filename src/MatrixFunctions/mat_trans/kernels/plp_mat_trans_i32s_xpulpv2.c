@@ -29,6 +29,7 @@
  */
 
 #include "plp_math.h"
+#include "plp_mat_trans_xpulpv2.h"
 
 /**
   @ingroup MatTrans
@@ -53,7 +54,7 @@ void plp_mat_trans_i32s_xpulpv2(const int32_t *__restrict__ pSrc,
                                 uint32_t N,
                                 int32_t *__restrict__ pDst) {
 
-#define BASIC_VERSION // if used don't forget to also use the undefine at end of file
+// #define BASIC_VERSION // if used don't forget to also use the undefine at end of file
 #ifdef BASIC_VERSION
 
     for (int m = 0; m < M; m++) {
@@ -64,7 +65,9 @@ void plp_mat_trans_i32s_xpulpv2(const int32_t *__restrict__ pSrc,
 
 #else
 
-    // TODO: Hackathon
+    for (uint32_t m = 0; m < M; m += 4) {
+        plp_mat_trans_rows_i32_xpulpv2(pSrc, M, N, m, pDst);
+    }
 
 #endif
 #undef BASIC_VERSION
@@ -29,6 +29,7 @@
  */
 
 #include "plp_math.h"
+#include "plp_mat_trans_xpulpv2.h"
 
 /**
   @ingroup MatTrans
@@ -46,8 +47,8 @@
   @return     none
 
   @par Exploiting SIMD instructions
-  The 8 bit values are packed four each into 32 bit vectors and then the four dot products are
-  performed on 32 bit vectors, with 32 bit accumulator.
+  The matrix is transposed in tiles of 4x4 values, which are transposed in registers with shuffle
+  instructions. The groups of four rows of the input are distributed among the cores.
 */
 
 void plp_mat_trans_i8p_xpulpv2(void *args) {
@@ -62,7 +63,7 @@ void plp_mat_trans_i8p_xpulpv2(void *args) {
     uint32_t nPE = a->nPE;
     int8_t *__restrict__ pDst = a->pDst;
 
-#define BASIC_VERSION // if used don't forget to also use the undefine at end of file
+// #define BASIC_VERSION // if used don't forget to also use the undefine at end of file
 #ifdef BASIC_VERSION
 
     for (int m = core_id; m < M; m += nPE) {
@@ -73,7 +74,9 @@ void plp_mat_trans_i8p_xpulpv2(void *args) {
 
 #else
 
-    // TODO: Hackathon
+    for (uint32_t m = core_id * 4; m < M; m += nPE * 4) {
+        plp_mat_trans_rows_i8_xpulpv2(pSrc, M, N, m, pDst);
+    }
 
 #endif
 #undef BASIC_VERSION
@@ -0,0 +1,97 @@
+/* ----------------------------------------------------------------------
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_trans_inplace_i16s_xpulpv2.c
+ * Description:  In-place transpose of square 16-bit integer matrices kernel for XPULPV2
+ *
+ * $Date:        19. Oct 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+#include "plp_mat_trans_xpulpv2.h"
+
+/**
+  @ingroup MatTrans
+ */
+
+/**
+  @addtogroup MatTransKernels
+  @{
+ */
+
+/**
+  @brief In-place transpose of square 16-bit integer matrices kernel for XPULPV2 extension.
+  @param[in,out] pSrcDst Points to the square matrix of shape NxN, which is transposed in place
+  @param[in]     N       Height and width of the matrix
+  @return        none
+
+  @par Exploiting SIMD instructions
+  The matrix is processed in tiles of 2x2 values, which are transposed in registers with shuffle
+  instructions. The tiles on the diagonal are transposed in place, the other tiles are swapped
+  with their mirrored tile. The last N % 2 rows and columns are swapped element by element.
+ */
+
+void plp_mat_trans_inplace_i16s_xpulpv2(int16_t *__restrict__ pSrcDst, uint32_t N) {
+
+    uint32_t nTiles = N - (N % 2);
+    uint32_t m; // loop counter for the rows
+    uint32_t n; // loop counter for the columns
+    uint32_t i; // loop counter for the rows of a tile
+    v2s tile0[2];
+    v2s tile1[2];
+
+    for (m = 0; m < nTiles; m += 2) {
+        // tile on the diagonal
+        plp_mat_trans_tile_i16_xpulpv2(&pSrcDst[m * N + m], N, tile0);
+        plp_mat_trans_store_i16_xpulpv2(tile0, N, &pSrcDst[m * N + m]);
+
+        // swap the tiles right of the diagonal with the tiles below
+        for (n = m + 2; n < nTiles; n += 2) {
+            plp_mat_trans_tile_i16_xpulpv2(&pSrcDst[m * N + n], N, tile0);
+            plp_mat_trans_tile_i16_xpulpv2(&pSrcDst[n * N + m], N, tile1);
+            plp_mat_trans_store_i16_xpulpv2(tile0, N, &pSrcDst[n * N + m]);
+            plp_mat_trans_store_i16_xpulpv2(tile1, N, &pSrcDst[m * N + n]);
+        }
+
+        // remaining columns of these rows
+        for (i = m; i < m + 2; i++) {
+            for (n = nTiles; n < N; n++) {
+                int16_t temp = pSrcDst[i * N + n];
+                pSrcDst[i * N + n] = pSrcDst[n * N + i];
+                pSrcDst[n * N + i] = temp;
+            }
+        }
+    }
+
+    // remaining corner of the matrix
+    for (m = nTiles; m < N; m++) {
+        for (n = m + 1; n < N; n++) {
+            int16_t temp = pSrcDst[m * N + n];
+            pSrcDst[m * N + n] = pSrcDst[n * N + m];
+            pSrcDst[n * N + m] = temp;
+        }
+    }
+}
+
+/**
+   @} end of MatTransKernels group
+*/
@@ -0,0 +1,60 @@
+/* ----------------------------------------------------------------------
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_trans_inplace_i32s_rv32im.c
+ * Description:  In-place transpose of square 32-bit integer matrices kernel for RV32IM
+ *
+ * $Date:        19. Oct 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup MatTrans
+ */
+
+/**
+  @addtogroup MatTransKernels
+  @{
+ */
+
+/**
+  @brief In-place transpose of square 32-bit integer matrices kernel for RV32IM extension.
+  @param[in,out] pSrcDst Points to the square matrix of shape NxN, which is transposed in place
+  @param[in]     N       Height and width of the matrix
+  @return        none
+ */
+
+void plp_mat_trans_inplace_i32s_rv32im(int32_t *__restrict__ pSrcDst, uint32_t N) {
+
+    for (uint32_t m = 0; m < N; m++) {
+        for (uint32_t n = m + 1; n < N; n++) {
+            int32_t temp = pSrcDst[m * N + n];
+            pSrcDst[m * N + n] = pSrcDst[n * N + m];
+            pSrcDst[n * N + m] = temp;
+        }
+    }
+}
+
+/**
+   @} end of MatTransKernels group
+*/
@@ -0,0 +1,182 @@
+/* ----------------------------------------------------------------------
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_trans_xpulpv2.h
+ * Description:  Register tiles of the matrix transpose for XPULPV2
+ *
+ * $Date:        19. Oct 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __PLP_MAT_TRANS_XPULPV2_H__
+#define __PLP_MAT_TRANS_XPULPV2_H__
+
+#include "plp_math.h"
+
+/*
+ * Loads the 4x4 tile of 8-bit values at pSrc (with stride elements between the rows), and
+ * transposes it in registers: pOut[k] holds the column k of the tile.
+ */
+static inline void plp_mat_trans_tile_i8_xpulpv2(const int8_t *pSrc, uint32_t stride, v4s *pOut) {
+    v4s mask0 = { 0, 4, 1, 5 };
+    v4s mask1 = { 2, 6, 3, 7 };
+    v4s mask2 = { 0, 1, 4, 5 };
+    v4s mask3 = { 2, 3, 6, 7 };
+
+    v4s row0 = *((v4s *)&pSrc[0]);
+    v4s row1 = *((v4s *)&pSrc[stride]);
+    v4s row2 = *((v4s *)&pSrc[2 * stride]);
+    v4s row3 = *((v4s *)&pSrc[3 * stride]);
+
+    v4s temp0 = __builtin_shuffle(row0, row1, mask0); // a0 b0 a1 b1
+    v4s temp1 = __builtin_shuffle(row0, row1, mask1); // a2 b2 a3 b3
+    v4s temp2 = __builtin_shuffle(row2, row3, mask0); // c0 d0 c1 d1
+    v4s temp3 = __builtin_shuffle(row2, row3, mask1); // c2 d2 c3 d3
+
+    pOut[0] = __builtin_shuffle(temp0, temp2, mask2); // a0 b0 c0 d0
+    pOut[1] = __builtin_shuffle(temp0, temp2, mask3); // a1 b1 c1 d1
+    pOut[2] = __builtin_shuffle(temp1, temp3, mask2); // a2 b2 c2 d2
+    pOut[3] = __builtin_shuffle(temp1, temp3, mask3); // a3 b3 c3 d3
+}
+
+/*
+ * Stores the 4x4 tile of 8-bit values, as returned by plp_mat_trans_tile_i8_xpulpv2, at pDst.
+ */
+static inline void plp_mat_trans_store_i8_xpulpv2(const v4s *pTile, uint32_t stride, int8_t *pDst) {
+    *((v4s *)&pDst[0]) = pTile[0];
+    *((v4s *)&pDst[stride]) = pTile[1];
+    *((v4s *)&pDst[2 * stride]) = pTile[2];
+    *((v4s *)&pDst[3 * stride]) = pTile[3];
+}
+
+/*
+ * Loads the 2x2 tile of 16-bit values at pSrc, and transposes it in registers.
+ */
+static inline void plp_mat_trans_tile_i16_xpulpv2(const int16_t *pSrc, uint32_t stride, v2s *pOut) {
+    v2s mask0 = { 0, 2 };
+    v2s mask1 = { 1, 3 };
+
+    v2s row0 = *((v2s *)&pSrc[0]);
+    v2s row1 = *((v2s *)&pSrc[stride]);
+
+    pOut[0] = __builtin_shuffle(row0, row1, mask0); // a0 b0
+    pOut[1] = __builtin_shuffle(row0, row1, mask1); // a1 b1
+}
+
+static inline void plp_mat_trans_store_i16_xpulpv2(const v2s *pTile,
+                                                   uint32_t stride,
+                                                   int16_t *pDst) {
+    *((v2s *)&pDst[0]) = pTile[0];
+    *((v2s *)&pDst[stride]) = pTile[1];
+}
+
+/*
+ * Transposes the rows m to m + 3 of the MxN matrix pSrc into the columns m to m + 3 of pDst, with
+ * 4x4 tiles. The last N % 4 columns, or all columns if less than 4 rows are left, are copied
+ * element by element.
+ */
+static inline void plp_mat_trans_rows_i8_xpulpv2(const int8_t *__restrict__ pSrc,
+                                                 uint32_t M,
+                                                 uint32_t N,
+                                                 uint32_t m,
+                                                 int8_t *__restrict__ pDst) {
+    uint32_t mEnd = (m + 4 <= M) ? m + 4 : M;
+    uint32_t n = 0;
+    uint32_t i;
+    v4s tile[4];
+
+    if (mEnd - m == 4) {
+        for (n = 0; n + 4 <= N; n += 4) {
+            plp_mat_trans_tile_i8_xpulpv2(&pSrc[m * N + n], N, tile);
+            plp_mat_trans_store_i8_xpulpv2(tile, M, &pDst[n * M + m]);
+        }
+    }
+    for (; n < N; n++) {
+        for (i = m; i < mEnd; i++) {
+            pDst[n * M + i] = pSrc[i * N + n];
+        }
+    }
+}
+
+/*
+ * Transposes the rows m and m + 1 of the MxN matrix pSrc into the columns m and m + 1 of pDst,
+ * with 2x2 tiles.
+ */
+static inline void plp_mat_trans_rows_i16_xpulpv2(const int16_t *__restrict__ pSrc,
+                                                  uint32_t M,
+                                                  uint32_t N,
+                                                  uint32_t m,
+                                                  int16_t *__restrict__ pDst) {
+    uint32_t n = 0;
+    v2s tile[2];
+
+    if (m + 2 <= M) {
+        for (n = 0; n + 2 <= N; n += 2) {
+            plp_mat_trans_tile_i16_xpulpv2(&pSrc[m * N + n], N, tile);
+            plp_mat_trans_store_i16_xpulpv2(tile, M, &pDst[n * M + m]);
+        }
+        if (n < N) {
+            pDst[n * M + m] = pSrc[m * N + n];
+            pDst[n * M + m + 1] = pSrc[(m + 1) * N + n];
+        }
+    } else {
+        for (n = 0; n < N; n++) {
+            pDst[n * M + m] = pSrc[m * N + n];
+        }
+    }
+}
+
+/*
+ * Transposes the rows m to m + 3 of the MxN matrix pSrc into the columns m to m + 3 of pDst. The
+ * four values of each column are written next to each other in the output.
+ */
+static inline void plp_mat_trans_rows_i32_xpulpv2(const int32_t *__restrict__ pSrc,
+                                                  uint32_t M,
+                                                  uint32_t N,
+                                                  uint32_t m,
+                                                  int32_t *__restrict__ pDst) {
+    uint32_t mEnd = (m + 4 <= M) ? m + 4 : M;
+    uint32_t n;
+    uint32_t i;
+
+    if (mEnd - m == 4) {
+        const int32_t *pRow = &pSrc[m * N];
+        for (n = 0; n < N; n++) {
+            int32_t val0 = pRow[n];
+            int32_t val1 = pRow[N + n];
+            int32_t val2 = pRow[2 * N + n];
+            int32_t val3 = pRow[3 * N + n];
+            int32_t *pCol = &pDst[n * M + m];
+            pCol[0] = val0;
+            pCol[1] = val1;
+            pCol[2] = val2;
+            pCol[3] = val3;
+        }
+    } else {
+        for (n = 0; n < N; n++) {
+            for (i = m; i < mEnd; i++) {
+                pDst[n * M + i] = pSrc[i * N + n];
+            }
+        }
+    }
+}
+
+#endif // __PLP_MAT_TRANS_XPULPV2_H__
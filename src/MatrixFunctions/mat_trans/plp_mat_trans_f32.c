@@ -29,6 +29,7 @@
  */
 
 #include "plp_math.h"
+#include "plp_mat_small.h"
 
 /**
    @ingroup groupMatrix
@@ -48,18 +49,24 @@
   @return     none
 
   @par This function will use plp_mat_trans_i32s_xpulpv2 for its computation.
+
+  @par
+  The 2x2, 3x3 and 4x4 matrices are transposed with the fixed-size kernels of plp_mat_small.h.
  */
 
 void plp_mat_trans_f32(const float *__restrict__ pSrc,
                        uint32_t M,
                        uint32_t N,
                        float *__restrict__ pDst) {
+    PLP_PROFILE_FUNCTION();
 
     if (hal_cluster_id() == ARCHI_FC_CID) {
         printf("Floating point is supported only for cluster side\n");
         return;
     } else {
-        plp_mat_trans_i32s_xpulpv2((int32_t *)pSrc, M, N, (int32_t *)pDst);
+        if (!plp_mat_trans_small_f32(pSrc, M, N, pDst)) {
+            plp_mat_trans_i32s_xpulpv2((int32_t *)pSrc, M, N, (int32_t *)pDst);
+        }
     }
 }
 
@@ -29,6 +29,7 @@
  */
 
 #include "plp_math.h"
+#include "plp_mat_small.h"
 
 /**
   @ingroup groupMatrix
@@ -46,12 +47,20 @@
   @param[in]  N    Width of the input matrix and height of the output matrix
   @param[out] pDst Points to the output matrix of shape NxM
   @return     none
+
+  @par
+  The 2x2, 3x3 and 4x4 matrices are transposed with the fixed-size kernels of plp_mat_small.h.
  */
 
 void plp_mat_trans_i32(const int32_t *__restrict__ pSrc,
                        uint32_t M,
                        uint32_t N,
                        int32_t *__restrict__ pDst) {
+    PLP_PROFILE_FUNCTION();
+
+    if (plp_mat_trans_small_i32(pSrc, M, N, pDst)) {
+        return;
+    }
 
     if (hal_cluster_id() == ARCHI_FC_CID) {
         plp_mat_trans_i32s_rv32im(pSrc, M, N, pDst);
@@ -0,0 +1,70 @@
+/* ----------------------------------------------------------------------
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_vec_f32s_xpulpv2.c
+ * Description:  32-bit floating-point matrix-vector product kernel for XPULPV2
+ *
+ * $Date:        19. Oct 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+#include "plp_mat_vec_xpulpv2.h"
+
+/**
+  @ingroup MatVec
+ */
+
+/**
+  @addtogroup MatVecKernels
+  @{
+ */
+
+/**
+  @brief Matrix-vector multiplication of 32-bit floating-point matrices kernel for XPULPV2
+         extension.
+  @param[in]  pSrcA     points to the input matrix of shape MxN
+  @param[in]  pSrcX     points to the input vector of length N
+  @param[in]  M         height of the input matrix and length of the output vector
+  @param[in]  N         width of the input matrix and length of the input vector
+  @param[out] pDstY     points to the output vector of length M
+  @return     none
+ */
+
+void plp_mat_vec_f32s_xpulpv2(const float *__restrict__ pSrcA,
+                              const float *__restrict__ pSrcX,
+                              uint32_t M,
+                              uint32_t N,
+                              float *__restrict__ pDstY) {
+
+    uint32_t m; // loop counter
+
+    for (m = 0; m + 4 <= M; m += 4) {
+        plp_mat_vec_rows_f32_xpulpv2(&pSrcA[m * N], pSrcX, N, &pDstY[m]);
+    }
+    for (; m < M; m++) {
+        pDstY[m] = plp_mat_vec_row_f32_xpulpv2(&pSrcA[m * N], pSrcX, N);
+    }
+}
+
+/**
+  @} end of MatVecKernels group
+ */
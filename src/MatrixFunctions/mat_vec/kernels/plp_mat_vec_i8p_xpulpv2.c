@@ -0,0 +1,79 @@
+/* ----------------------------------------------------------------------
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_vec_i8p_xpulpv2.c
+ * Description:  parallel 8-bit integer matrix-vector product kernel for XPULPV2
+ *
+ * $Date:        19. Oct 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+#include "plp_mat_vec_xpulpv2.h"
+
+/**
+  @ingroup MatVec
+ */
+
+/**
+  @addtogroup MatVecKernels
+  @{
+ */
+
+/**
+  @brief Parallel matrix-vector multiplication of 8-bit integer matrices kernel for XPULPV2
+         extension.
+  @param[in]  args  pointer to plp_mat_vec_instance_i8 struct initialized by
+                    plp_mat_vec_i8_parallel
+  @return     none
+
+  @par Parallelization
+  The blocks of four rows of the matrix (i.e. four outputs) are distributed among the
+  cores, followed by the remaining M % 4 rows.
+ */
+
+void plp_mat_vec_i8p_xpulpv2(void *args) {
+
+    int core_id = hal_core_id();
+
+    plp_mat_vec_instance_i8 *a = (plp_mat_vec_instance_i8 *)args;
+
+    const int8_t *__restrict__ pSrcA = a->pSrcA;
+    const int8_t *__restrict__ pSrcX = a->pSrcX;
+    uint32_t M = a->M;
+    uint32_t N = a->N;
+    uint32_t nPE = a->nPE;
+    int32_t *__restrict__ pDstY = a->pDstY;
+
+    uint32_t M4 = M & ~3U; // outputs in blocks of four
+    uint32_t m;            // loop counter
+
+    for (m = core_id * 4; m < M4; m += nPE * 4) {
+        plp_mat_vec_rows_i8_xpulpv2(&pSrcA[m * N], pSrcX, N, &pDstY[m]);
+    }
+    for (m = M4 + core_id; m < M; m += nPE) {
+        pDstY[m] = plp_mat_vec_row_i8_xpulpv2(&pSrcA[m * N], pSrcX, N);
+    }
+}
+
+/**
+  @} end of MatVecKernels group
+ */
@@ -0,0 +1,213 @@
+/* ----------------------------------------------------------------------
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_vec_xpulpv2.h
+ * Description:  Blocks of rows of the matrix-vector product for XPULPV2
+ *
+ * $Date:        19. Oct 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __PLP_MAT_VEC_XPULPV2_H__
+#define __PLP_MAT_VEC_XPULPV2_H__
+
+#include "plp_math.h"
+
+/*
+ * The functions plp_mat_vec_rows_*_xpulpv2 compute the dot products of the four rows at pA (with
+ * N elements each) with the vector pX, and store them at pSum. Each element of pX is loaded once
+ * for the four rows. The functions plp_mat_vec_row_*_xpulpv2 return the dot product of a single
+ * row with pX.
+ */
+
+static inline void plp_mat_vec_rows_i32_xpulpv2(const int32_t *__restrict__ pA,
+                                                const int32_t *__restrict__ pX,
+                                                uint32_t N,
+                                                int32_t *__restrict__ pSum) {
+    const int32_t *pA0 = pA;
+    const int32_t *pA1 = pA + N;
+    const int32_t *pA2 = pA + 2 * N;
+    const int32_t *pA3 = pA + 3 * N;
+    int32_t sum0 = 0, sum1 = 0, sum2 = 0, sum3 = 0;
+    uint32_t n;
+
+    for (n = 0; n < N; n++) {
+        int32_t x = pX[n];
+        sum0 += pA0[n] * x;
+        sum1 += pA1[n] * x;
+        sum2 += pA2[n] * x;
+        sum3 += pA3[n] * x;
+    }
+
+    pSum[0] = sum0;
+    pSum[1] = sum1;
+    pSum[2] = sum2;
+    pSum[3] = sum3;
+}
+
+static inline int32_t plp_mat_vec_row_i32_xpulpv2(const int32_t *__restrict__ pA,
+                                                  const int32_t *__restrict__ pX,
+                                                  uint32_t N) {
+    int32_t sum = 0;
+    uint32_t n;
+
+    for (n = 0; n < N; n++) {
+        sum += pA[n] * pX[n];
+    }
+    return sum;
+}
+
+static inline void plp_mat_vec_rows_i16_xpulpv2(const int16_t *__restrict__ pA,
+                                                const int16_t *__restrict__ pX,
+                                                uint32_t N,
+                                                int32_t *__restrict__ pSum) {
+    const int16_t *pA0 = pA;
+    const int16_t *pA1 = pA + N;
+    const int16_t *pA2 = pA + 2 * N;
+    const int16_t *pA3 = pA + 3 * N;
+    int32_t sum0 = 0, sum1 = 0, sum2 = 0, sum3 = 0;
+    uint32_t N2 = N & ~1U;
+    uint32_t n;
+
+    for (n = 0; n < N2; n += 2) {
+        v2s x = *((v2s *)&pX[n]);
+        sum0 = __SUMDOTP2(*((v2s *)&pA0[n]), x, sum0);
+        sum1 = __SUMDOTP2(*((v2s *)&pA1[n]), x, sum1);
+        sum2 = __SUMDOTP2(*((v2s *)&pA2[n]), x, sum2);
+        sum3 = __SUMDOTP2(*((v2s *)&pA3[n]), x, sum3);
+    }
+    if (n < N) {
+        int32_t x = pX[n];
+        sum0 += pA0[n] * x;
+        sum1 += pA1[n] * x;
+        sum2 += pA2[n] * x;
+        sum3 += pA3[n] * x;
+    }
+
+    pSum[0] = sum0;
+    pSum[1] = sum1;
+    pSum[2] = sum2;
+    pSum[3] = sum3;
+}
+
+static inline int32_t plp_mat_vec_row_i16_xpulpv2(const int16_t *__restrict__ pA,
+                                                  const int16_t *__restrict__ pX,
+                                                  uint32_t N) {
+    int32_t sum = 0;
+    uint32_t N2 = N & ~1U;
+    uint32_t n;
+
+    for (n = 0; n < N2; n += 2) {
+        sum = __SUMDOTP2(*((v2s *)&pA[n]), *((v2s *)&pX[n]), sum);
+    }
+    if (n < N) {
+        sum += pA[n] * pX[n];
+    }
+    return sum;
+}
+
+static inline void plp_mat_vec_rows_i8_xpulpv2(const int8_t *__restrict__ pA,
+                                               const int8_t *__restrict__ pX,
+                                               uint32_t N,
+                                               int32_t *__restrict__ pSum) {
+    const int8_t *pA0 = pA;
+    const int8_t *pA1 = pA + N;
+    const int8_t *pA2 = pA + 2 * N;
+    const int8_t *pA3 = pA + 3 * N;
+    int32_t sum0 = 0, sum1 = 0, sum2 = 0, sum3 = 0;
+    uint32_t N4 = N & ~3U;
+    uint32_t n;
+
+    for (n = 0; n < N4; n += 4) {
+        v4s x = *((v4s *)&pX[n]);
+        sum0 = __SUMDOTP4(*((v4s *)&pA0[n]), x, sum0);
+        sum1 = __SUMDOTP4(*((v4s *)&pA1[n]), x, sum1);
+        sum2 = __SUMDOTP4(*((v4s *)&pA2[n]), x, sum2);
+        sum3 = __SUMDOTP4(*((v4s *)&pA3[n]), x, sum3);
+    }
+    for (; n < N; n++) {
+        int32_t x = pX[n];
+        sum0 += pA0[n] * x;
+        sum1 += pA1[n] * x;
+        sum2 += pA2[n] * x;
+        sum3 += pA3[n] * x;
+    }
+
+    pSum[0] = sum0;
+    pSum[1] = sum1;
+    pSum[2] = sum2;
+    pSum[3] = sum3;
+}
+
+static inline int32_t plp_mat_vec_row_i8_xpulpv2(const int8_t *__restrict__ pA,
+                                                 const int8_t *__restrict__ pX,
+                                                 uint32_t N) {
+    int32_t sum = 0;
+    uint32_t N4 = N & ~3U;
+    uint32_t n;
+
+    for (n = 0; n < N4; n += 4) {
+        sum = __SUMDOTP4(*((v4s *)&pA[n]), *((v4s *)&pX[n]), sum);
+    }
+    for (; n < N; n++) {
+        sum += pA[n] * pX[n];
+    }
+    return sum;
+}
+
+static inline void plp_mat_vec_rows_f32_xpulpv2(const float *__restrict__ pA,
+                                                const float *__restrict__ pX,
+                                                uint32_t N,
+                                                float *__restrict__ pSum) {
+    const float *pA0 = pA;
+    const float *pA1 = pA + N;
+    const float *pA2 = pA + 2 * N;
+    const float *pA3 = pA + 3 * N;
+    float sum0 = 0.0f, sum1 = 0.0f, sum2 = 0.0f, sum3 = 0.0f;
+    uint32_t n;
+
+    for (n = 0; n < N; n++) {
+        float x = pX[n];
+        sum0 += pA0[n] * x;
+        sum1 += pA1[n] * x;
+        sum2 += pA2[n] * x;
+        sum3 += pA3[n] * x;
+    }
+
+    pSum[0] = sum0;
+    pSum[1] = sum1;
+    pSum[2] = sum2;
+    pSum[3] = sum3;
+}
+
+static inline float plp_mat_vec_row_f32_xpulpv2(const float *__restrict__ pA,
+                                                const float *__restrict__ pX,
+                                                uint32_t N) {
+    float sum = 0.0f;
+    uint32_t n;
+
+    for (n = 0; n < N; n++) {
+        sum += pA[n] * pX[n];
+    }
+    return sum;
+}
+
+#endif // __PLP_MAT_VEC_XPULPV2_H__
@@ -0,0 +1,85 @@
+/* ----------------------------------------------------------------------
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_vec_i16_parallel.c
+ * Description:  parallel 16-bit integer matrix-vector product glue code
+ *
+ * $Date:        19. Oct 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+#include "plp_const_structs.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @addtogroup MatVec
+  @{
+ */
+
+/**
+  @brief Glue code for parallel matrix-vector multiplication of 16-bit integer matrices.
+  @param[in]  pSrcA     points to the input matrix of shape MxN
+  @param[in]  pSrcX     points to the input vector of length N
+  @param[in]  M         height of the input matrix and length of the output vector
+  @param[in]  N         width of the input matrix and length of the input vector
+  @param[in]  nPE       Number of cores to use (or PLP_NPE_AUTO)
+  @param[out] pDstY     points to the output vector of length M
+  @return     none
+ */
+
+void plp_mat_vec_i16_parallel(const int16_t *__restrict__ pSrcA,
+                              const int16_t *__restrict__ pSrcX,
+                              uint32_t M,
+                              uint32_t N,
+                              uint32_t nPE,
+                              int32_t *__restrict__ pDstY) {
+    PLP_PROFILE_FUNCTION();
+
+    if (hal_cluster_id() == ARCHI_FC_CID) {
+        printf("parallel processing supported only for cluster side\n");
+        return;
+    } else {
+        if (nPE == PLP_NPE_AUTO) {
+            nPE = plp_npe_auto(&plp_npe_model_mat_mult_i16, M * N, (M + 3) / 4);
+            if (nPE == 1) {
+                plp_mat_vec_i16s_xpulpv2(pSrcA, pSrcX, M, N, pDstY);
+                return;
+            }
+        }
+        plp_mat_vec_instance_i16 args = {
+            .pSrcA = pSrcA,
+            .pSrcX = pSrcX,
+            .M = M,
+            .N = N,
+            .nPE = nPE,
+            .pDstY = pDstY
+        };
+        hal_cl_team_fork(nPE, plp_mat_vec_i16p_xpulpv2, (void *)&args);
+    }
+}
+
+/**
+  @} end of MatVec group
+ */
@@ -0,0 +1,77 @@
+/* ----------------------------------------------------------------------
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_vec_i32.c
+ * Description:  32-bit integer matrix-vector product glue code
+ *
+ * $Date:        19. Oct 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @defgroup MatVec Matrix-Vector Multiplication
+  Computes the product y = A x of the MxN matrix A with the vector x of length N, as needed by
+  recurrent layers and Kalman filters. Compared to plp_mat_mult with O = 1, the kernels compute
+  four rows at a time with SIMD dot products along the rows, which loads every element of x once
+  for four outputs, and the parallel versions distribute these blocks of rows among the cores.
+
+  The integer versions accumulate in 32 bits and store 32-bit outputs. The fix-point versions
+  accumulate the products in 32 bits, and round the sum once by `shift` bits to the right.
+ */
+
+/**
+  @addtogroup MatVec
+  @{
+ */
+
+/**
+  @brief Glue code for matrix-vector multiplication of 32-bit integer matrices.
+  @param[in]  pSrcA     points to the input matrix of shape MxN
+  @param[in]  pSrcX     points to the input vector of length N
+  @param[in]  M         height of the input matrix and length of the output vector
+  @param[in]  N         width of the input matrix and length of the input vector
+  @param[out] pDstY     points to the output vector of length M
+  @return     none
+ */
+
+void plp_mat_vec_i32(const int32_t *__restrict__ pSrcA,
+                     const int32_t *__restrict__ pSrcX,
+                     uint32_t M,
+                     uint32_t N,
+                     int32_t *__restrict__ pDstY) {
+    PLP_PROFILE_FUNCTION();
+
+    if (hal_cluster_id() == ARCHI_FC_CID) {
+        plp_mat_vec_i32s_rv32im(pSrcA, pSrcX, M, N, pDstY);
+    } else {
+        plp_mat_vec_i32s_xpulpv2(pSrcA, pSrcX, M, N, pDstY);
+    }
+}
+
+/**
+  @} end of MatVec group
+ */
@@ -0,0 +1,79 @@
+/* ----------------------------------------------------------------------
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_vec_trans_i16p_xpulpv2.c
+ * Description:  parallel 16-bit integer transposed matrix-vector product kernel for XPULPV2
+ *
+ * $Date:        19. Oct 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+#include "plp_mat_vec_trans_xpulpv2.h"
+
+/**
+  @ingroup MatVecTrans
+ */
+
+/**
+  @addtogroup MatVecTransKernels
+  @{
+ */
+
+/**
+  @brief Parallel transposed matrix-vector multiplication of 16-bit integer matrices kernel for
+         XPULPV2 extension.
+  @param[in]  args  pointer to plp_mat_vec_instance_i16 struct initialized by
+                    plp_mat_vec_trans_i16_parallel
+  @return     none
+
+  @par Parallelization
+  The blocks of four columns of the matrix (i.e. four outputs) are distributed among the
+  cores, followed by the remaining N % 4 columns.
+ */
+
+void plp_mat_vec_trans_i16p_xpulpv2(void *args) {
+
+    int core_id = hal_core_id();
+
+    plp_mat_vec_instance_i16 *a = (plp_mat_vec_instance_i16 *)args;
+
+    const int16_t *__restrict__ pSrcA = a->pSrcA;
+    const int16_t *__restrict__ pSrcX = a->pSrcX;
+    uint32_t M = a->M;
+    uint32_t N = a->N;
+    uint32_t nPE = a->nPE;
+    int32_t *__restrict__ pDstY = a->pDstY;
+
+    uint32_t N4 = N & ~3U; // outputs in blocks of four
+    uint32_t n;            // loop counter
+
+    for (n = core_id * 4; n < N4; n += nPE * 4) {
+        plp_mat_vec_trans_cols_i16_xpulpv2(&pSrcA[n], pSrcX, M, N, &pDstY[n]);
+    }
+    for (n = N4 + core_id; n < N; n += nPE) {
+        pDstY[n] = plp_mat_vec_trans_col_i16_xpulpv2(&pSrcA[n], pSrcX, M, N);
+    }
+}
+
+/**
+  @} end of MatVecTransKernels group
+ */
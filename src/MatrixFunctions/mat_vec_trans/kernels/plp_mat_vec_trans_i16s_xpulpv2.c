@@ -0,0 +1,75 @@
+/* ----------------------------------------------------------------------
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_vec_trans_i16s_xpulpv2.c
+ * Description:  16-bit integer transposed matrix-vector product kernel for XPULPV2
+ *
+ * $Date:        19. Oct 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+#include "plp_mat_vec_trans_xpulpv2.h"
+
+/**
+  @ingroup MatVecTrans
+ */
+
+/**
+  @addtogroup MatVecTransKernels
+  @{
+ */
+
+/**
+  @brief Transposed matrix-vector multiplication of 16-bit integer matrices kernel for XPULPV2
+         extension.
+  @param[in]  pSrcA     points to the input matrix of shape MxN
+  @param[in]  pSrcX     points to the input vector of length M
+  @param[in]  M         height of the input matrix and length of the input vector
+  @param[in]  N         width of the input matrix and length of the output vector
+  @param[out] pDstY     points to the output vector of length N
+  @return     none
+
+  @par Exploiting SIMD instructions
+  Four columns are computed at a time. The 2x4 blocks of the matrix are loaded as 32 bit
+  vectors and shuffled such that each vector holds two values of the same column, which
+  are multiplied with two values of pSrcX with dot products, with 32 bit accumulators.
+ */
+
+void plp_mat_vec_trans_i16s_xpulpv2(const int16_t *__restrict__ pSrcA,
+                                    const int16_t *__restrict__ pSrcX,
+                                    uint32_t M,
+                                    uint32_t N,
+                                    int32_t *__restrict__ pDstY) {
+
+    uint32_t n; // loop counter
+
+    for (n = 0; n + 4 <= N; n += 4) {
+        plp_mat_vec_trans_cols_i16_xpulpv2(&pSrcA[n], pSrcX, M, N, &pDstY[n]);
+    }
+    for (; n < N; n++) {
+        pDstY[n] = plp_mat_vec_trans_col_i16_xpulpv2(&pSrcA[n], pSrcX, M, N);
+    }
+}
+
+/**
+  @} end of MatVecTransKernels group
+ */
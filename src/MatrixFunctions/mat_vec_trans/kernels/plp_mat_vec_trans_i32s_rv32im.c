@@ -0,0 +1,76 @@
+/* ----------------------------------------------------------------------
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_vec_trans_i32s_rv32im.c
+ * Description:  32-bit integer transposed matrix-vector product kernel for RV32IM
+ *
+ * $Date:        19. Oct 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup MatVecTrans
+ */
+
+/**
+  @defgroup MatVecTransKernels Transposed Matrix-Vector Multiplication Kernels
+  This module contains the kernels for the transposed matrix-vector multiplication.
+ */
+
+/**
+  @addtogroup MatVecTransKernels
+  @{
+ */
+
+/**
+  @brief Transposed matrix-vector multiplication of 32-bit integer matrices kernel for RV32IM
+         extension.
+  @param[in]  pSrcA     points to the input matrix of shape MxN
+  @param[in]  pSrcX     points to the input vector of length M
+  @param[in]  M         height of the input matrix and length of the input vector
+  @param[in]  N         width of the input matrix and length of the output vector
+  @param[out] pDstY     points to the output vector of length N
+  @return     none
+ */
+
+void plp_mat_vec_trans_i32s_rv32im(const int32_t *__restrict__ pSrcA,
+                                   const int32_t *__restrict__ pSrcX,
+                                   uint32_t M,
+                                   uint32_t N,
+                                   int32_t *__restrict__ pDstY) {
+
+    uint32_t m; // loop counter for M
+    uint32_t n; // loop counter for N
+
+    for (n = 0; n < N; n++) {
+        int32_t sum = 0;
+        for (m = 0; m < M; m++) {
+            sum += (int32_t)pSrcA[m * N + n] * (int32_t)pSrcX[m];
+        }
+        pDstY[n] = sum;
+    }
+}
+
+/**
+  @} end of MatVecTransKernels group
+ */
@@ -0,0 +1,87 @@
+/* ----------------------------------------------------------------------
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_vec_trans_q32p_xpulpv2.c
+ * Description:  parallel 32-bit fix-point transposed matrix-vector product kernel for XPULPV2
+ *
+ * $Date:        19. Oct 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+#include "plp_mat_vec_trans_xpulpv2.h"
+
+/**
+  @ingroup MatVecTrans
+ */
+
+/**
+  @addtogroup MatVecTransKernels
+  @{
+ */
+
+/**
+  @brief Parallel transposed matrix-vector multiplication of 32-bit fix-point matrices kernel for
+         XPULPV2 extension.
+  @param[in]  args  pointer to plp_mat_vec_instance_q32 struct initialized by
+                    plp_mat_vec_trans_q32_parallel
+  @return     none
+
+  @par Parallelization
+  The blocks of four columns of the matrix (i.e. four outputs) are distributed among the
+  cores, followed by the remaining N % 4 columns.
+ */
+
+void plp_mat_vec_trans_q32p_xpulpv2(void *args) {
+
+    int core_id = hal_core_id();
+
+    plp_mat_vec_instance_q32 *a = (plp_mat_vec_instance_q32 *)args;
+
+    const int32_t *__restrict__ pSrcA = a->pSrcA;
+    const int32_t *__restrict__ pSrcX = a->pSrcX;
+    uint32_t M = a->M;
+    uint32_t N = a->N;
+    uint32_t shift = a->shift;
+    uint32_t nPE = a->nPE;
+    int32_t *__restrict__ pDstY = a->pDstY;
+
+    uint32_t N4 = N & ~3U; // outputs in blocks of four
+    uint32_t n;            // loop counter
+    int32_t round = (1 << shift) >> 1;
+    int32_t acc[4];
+
+    for (n = core_id * 4; n < N4; n += nPE * 4) {
+        plp_mat_vec_trans_cols_i32_xpulpv2(&pSrcA[n], pSrcX, M, N, acc);
+        pDstY[n] = (acc[0] + round) >> shift;
+        pDstY[n + 1] = (acc[1] + round) >> shift;
+        pDstY[n + 2] = (acc[2] + round) >> shift;
+        pDstY[n + 3] = (acc[3] + round) >> shift;
+    }
+    for (n = N4 + core_id; n < N; n += nPE) {
+        acc[0] = plp_mat_vec_trans_col_i32_xpulpv2(&pSrcA[n], pSrcX, M, N);
+        pDstY[n] = (acc[0] + round) >> shift;
+    }
+}
+
+/**
+  @} end of MatVecTransKernels group
+ */
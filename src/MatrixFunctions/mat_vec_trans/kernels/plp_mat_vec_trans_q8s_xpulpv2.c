@@ -0,0 +1,84 @@
+/* ----------------------------------------------------------------------
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_vec_trans_q8s_xpulpv2.c
+ * Description:  8-bit fix-point transposed matrix-vector product kernel for XPULPV2
+ *
+ * $Date:        19. Oct 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+#include "plp_mat_vec_trans_xpulpv2.h"
+
+/**
+  @ingroup MatVecTrans
+ */
+
+/**
+  @addtogroup MatVecTransKernels
+  @{
+ */
+
+/**
+  @brief Transposed matrix-vector multiplication of 8-bit fix-point matrices kernel for XPULPV2
+         extension.
+  @param[in]  pSrcA     points to the input matrix of shape MxN
+  @param[in]  pSrcX     points to the input vector of length M
+  @param[in]  M         height of the input matrix and length of the input vector
+  @param[in]  N         width of the input matrix and length of the output vector
+  @param[in]  shift     Amount to shift the accumulated result to the right
+  @param[out] pDstY     points to the output vector of length N
+  @return     none
+
+  @par Exploiting SIMD instructions
+  Four columns are computed at a time. The 4x4 blocks of the matrix are loaded as 32 bit
+  vectors and shuffled such that each vector holds four values of the same column, which
+  are multiplied with four values of pSrcX with dot products, with 32 bit accumulators.
+ */
+
+void plp_mat_vec_trans_q8s_xpulpv2(const int8_t *__restrict__ pSrcA,
+                                   const int8_t *__restrict__ pSrcX,
+                                   uint32_t M,
+                                   uint32_t N,
+                                   uint32_t shift,
+                                   int8_t *__restrict__ pDstY) {
+
+    int32_t round = (1 << shift) >> 1;
+    int32_t acc[4];
+    uint32_t n; // loop counter
+
+    for (n = 0; n + 4 <= N; n += 4) {
+        plp_mat_vec_trans_cols_i8_xpulpv2(&pSrcA[n], pSrcX, M, N, acc);
+        pDstY[n] = (int8_t)((acc[0] + round) >> shift);
+        pDstY[n + 1] = (int8_t)((acc[1] + round) >> shift);
+        pDstY[n + 2] = (int8_t)((acc[2] + round) >> shift);
+        pDstY[n + 3] = (int8_t)((acc[3] + round) >> shift);
+    }
+    for (; n < N; n++) {
+        acc[0] = plp_mat_vec_trans_col_i8_xpulpv2(&pSrcA[n], pSrcX, M, N);
+        pDstY[n] = (int8_t)((acc[0] + round) >> shift);
+    }
+}
+
+/**
+  @} end of MatVecTransKernels group
+ */
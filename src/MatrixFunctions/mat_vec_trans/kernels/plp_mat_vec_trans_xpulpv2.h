@@ -0,0 +1,235 @@
+/* ----------------------------------------------------------------------
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_vec_trans_xpulpv2.h
+ * Description:  Blocks of columns of the transposed matrix-vector product
+ *
+ * $Date:        19. Oct 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __PLP_MAT_VEC_TRANS_XPULPV2_H__
+#define __PLP_MAT_VEC_TRANS_XPULPV2_H__
+
+#include "plp_math.h"
+
+/*
+ * The functions plp_mat_vec_trans_cols_*_xpulpv2 compute the dot products of the four columns at
+ * pA (with M elements each, and N elements between the rows) with the vector pX, and store them
+ * at pSum. The functions plp_mat_vec_trans_col_*_xpulpv2 return the dot product of a single column
+ * with pX.
+ */
+
+static inline void plp_mat_vec_trans_cols_i32_xpulpv2(const int32_t *__restrict__ pA,
+                                                      const int32_t *__restrict__ pX,
+                                                      uint32_t M,
+                                                      uint32_t N,
+                                                      int32_t *__restrict__ pSum) {
+    int32_t sum0 = 0, sum1 = 0, sum2 = 0, sum3 = 0;
+    uint32_t m;
+
+    for (m = 0; m < M; m++) {
+        const int32_t *pRow = &pA[m * N];
+        int32_t x = pX[m];
+        sum0 += pRow[0] * x;
+        sum1 += pRow[1] * x;
+        sum2 += pRow[2] * x;
+        sum3 += pRow[3] * x;
+    }
+
+    pSum[0] = sum0;
+    pSum[1] = sum1;
+    pSum[2] = sum2;
+    pSum[3] = sum3;
+}
+
+static inline int32_t plp_mat_vec_trans_col_i32_xpulpv2(const int32_t *__restrict__ pA,
+                                                        const int32_t *__restrict__ pX,
+                                                        uint32_t M,
+                                                        uint32_t N) {
+    int32_t sum = 0;
+    uint32_t m;
+
+    for (m = 0; m < M; m++) {
+        sum += pA[m * N] * pX[m];
+    }
+    return sum;
+}
+
+/*
+ * Two rows are processed at a time: the four columns of each row are loaded as two vectors, and
+ * shuffled into one vector per column, holding the values of both rows.
+ */
+static inline void plp_mat_vec_trans_cols_i16_xpulpv2(const int16_t *__restrict__ pA,
+                                                      const int16_t *__restrict__ pX,
+                                                      uint32_t M,
+                                                      uint32_t N,
+                                                      int32_t *__restrict__ pSum) {
+    v2s mask0 = { 0, 2 };
+    v2s mask1 = { 1, 3 };
+    int32_t sum0 = 0, sum1 = 0, sum2 = 0, sum3 = 0;
+    uint32_t M2 = M & ~1U;
+    uint32_t m;
+
+    for (m = 0; m < M2; m += 2) {
+        const int16_t *pRow0 = &pA[m * N];
+        const int16_t *pRow1 = pRow0 + N;
+        v2s x = *((v2s *)&pX[m]);
+
+        v2s a01 = *((v2s *)&pRow0[0]); // a0 a1
+        v2s a23 = *((v2s *)&pRow0[2]); // a2 a3
+        v2s b01 = *((v2s *)&pRow1[0]); // b0 b1
+        v2s b23 = *((v2s *)&pRow1[2]); // b2 b3
+
+        sum0 = __SUMDOTP2(__builtin_shuffle(a01, b01, mask0), x, sum0); // a0 b0
+        sum1 = __SUMDOTP2(__builtin_shuffle(a01, b01, mask1), x, sum1); // a1 b1
+        sum2 = __SUMDOTP2(__builtin_shuffle(a23, b23, mask0), x, sum2); // a2 b2
+        sum3 = __SUMDOTP2(__builtin_shuffle(a23, b23, mask1), x, sum3); // a3 b3
+    }
+    if (m < M) {
+        const int16_t *pRow = &pA[m * N];
+        int32_t x = pX[m];
+        sum0 += pRow[0] * x;
+        sum1 += pRow[1] * x;
+        sum2 += pRow[2] * x;
+        sum3 += pRow[3] * x;
+    }
+
+    pSum[0] = sum0;
+    pSum[1] = sum1;
+    pSum[2] = sum2;
+    pSum[3] = sum3;
+}
+
+static inline int32_t plp_mat_vec_trans_col_i16_xpulpv2(const int16_t *__restrict__ pA,
+                                                        const int16_t *__restrict__ pX,
+                                                        uint32_t M,
+                                                        uint32_t N) {
+    int32_t sum = 0;
+    uint32_t m;
+
+    for (m = 0; m < M; m++) {
+        sum += pA[m * N] * pX[m];
+    }
+    return sum;
+}
+
+/*
+ * Four rows are processed at a time: the 4x4 block is loaded as four vectors (one per row), and
+ * transposed with shuffles into one vector per column.
+ */
+static inline void plp_mat_vec_trans_cols_i8_xpulpv2(const int8_t *__restrict__ pA,
+                                                     const int8_t *__restrict__ pX,
+                                                     uint32_t M,
+                                                     uint32_t N,
+                                                     int32_t *__restrict__ pSum) {
+    v4s mask0 = { 0, 4, 1, 5 };
+    v4s mask1 = { 2, 6, 3, 7 };
+    v4s mask2 = { 0, 1, 4, 5 };
+    v4s mask3 = { 2, 3, 6, 7 };
+    int32_t sum0 = 0, sum1 = 0, sum2 = 0, sum3 = 0;
+    uint32_t M4 = M & ~3U;
+    uint32_t m;
+
+    for (m = 0; m < M4; m += 4) {
+        const int8_t *pRow = &pA[m * N];
+        v4s x = *((v4s *)&pX[m]);
+
+        v4s row0 = *((v4s *)&pRow[0]);
+        v4s row1 = *((v4s *)&pRow[N]);
+        v4s row2 = *((v4s *)&pRow[2 * N]);
+        v4s row3 = *((v4s *)&pRow[3 * N]);
+
+        v4s temp0 = __builtin_shuffle(row0, row1, mask0); // a0 b0 a1 b1
+        v4s temp1 = __builtin_shuffle(row0, row1, mask1); // a2 b2 a3 b3
+        v4s temp2 = __builtin_shuffle(row2, row3, mask0); // c0 d0 c1 d1
+        v4s temp3 = __builtin_shuffle(row2, row3, mask1); // c2 d2 c3 d3
+
+        sum0 = __SUMDOTP4(__builtin_shuffle(temp0, temp2, mask2), x, sum0); // a0 b0 c0 d0
+        sum1 = __SUMDOTP4(__builtin_shuffle(temp0, temp2, mask3), x, sum1); // a1 b1 c1 d1
+        sum2 = __SUMDOTP4(__builtin_shuffle(temp1, temp3, mask2), x, sum2); // a2 b2 c2 d2
+        sum3 = __SUMDOTP4(__builtin_shuffle(temp1, temp3, mask3), x, sum3); // a3 b3 c3 d3
+    }
+    for (; m < M; m++) {
+        const int8_t *pRow = &pA[m * N];
+        int32_t x = pX[m];
+        sum0 += pRow[0] * x;
+        sum1 += pRow[1] * x;
+        sum2 += pRow[2] * x;
+        sum3 += pRow[3] * x;
+    }
+
+    pSum[0] = sum0;
+    pSum[1] = sum1;
+    pSum[2] = sum2;
+    pSum[3] = sum3;
+}
+
+static inline int32_t plp_mat_vec_trans_col_i8_xpulpv2(const int8_t *__restrict__ pA,
+                                                       const int8_t *__restrict__ pX,
+                                                       uint32_t M,
+                                                       uint32_t N) {
+    int32_t sum = 0;
+    uint32_t m;
+
+    for (m = 0; m < M; m++) {
+        sum += pA[m * N] * pX[m];
+    }
+    return sum;
+}
+
+static inline void plp_mat_vec_trans_cols_f32_xpulpv2(const float *__restrict__ pA,
+                                                      const float *__restrict__ pX,
+                                                      uint32_t M,
+                                                      uint32_t N,
+                                                      float *__restrict__ pSum) {
+    float sum0 = 0.0f, sum1 = 0.0f, sum2 = 0.0f, sum3 = 0.0f;
+    uint32_t m;
+
+    for (m = 0; m < M; m++) {
+        const float *pRow = &pA[m * N];
+        float x = pX[m];
+        sum0 += pRow[0] * x;
+        sum1 += pRow[1] * x;
+        sum2 += pRow[2] * x;
+        sum3 += pRow[3] * x;
+    }
+
+    pSum[0] = sum0;
+    pSum[1] = sum1;
+    pSum[2] = sum2;
+    pSum[3] = sum3;
+}
+
+static inline float plp_mat_vec_trans_col_f32_xpulpv2(const float *__restrict__ pA,
+                                                      const float *__restrict__ pX,
+                                                      uint32_t M,
+                                                      uint32_t N) {
+    float sum = 0.0f;
+    uint32_t m;
+
+    for (m = 0; m < M; m++) {
+        sum += pA[m * N] * pX[m];
+    }
+    return sum;
+}
+
+#endif // __PLP_MAT_VEC_TRANS_XPULPV2_H__
@@ -0,0 +1,77 @@
+/* ----------------------------------------------------------------------
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_vec_trans_i32.c
+ * Description:  32-bit integer transposed matrix-vector product glue code
+ *
+ * $Date:        19. Oct 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @defgroup MatVecTrans Transposed Matrix-Vector Multiplication
+  Computes the product y = A^T x of the transposed MxN matrix A with the vector x of length M,
+  without transposing A in memory. The kernels compute four outputs (columns of A) at a time:
+  the 8- and 16-bit versions gather each column of a 4x4 or 2x4 block of A into one SIMD vector
+  with shuffles, and the parallel versions distribute these blocks of columns among the cores.
+
+  The integer versions accumulate in 32 bits and store 32-bit outputs. The fix-point versions
+  accumulate the products in 32 bits, and round the sum once by `shift` bits to the right.
+ */
+
+/**
+  @addtogroup MatVecTrans
+  @{
+ */
+
+/**
+  @brief Glue code for transposed matrix-vector multiplication of 32-bit integer matrices.
+  @param[in]  pSrcA     points to the input matrix of shape MxN
+  @param[in]  pSrcX     points to the input vector of length M
+  @param[in]  M         height of the input matrix and length of the input vector
+  @param[in]  N         width of the input matrix and length of the output vector
+  @param[out] pDstY     points to the output vector of length N
+  @return     none
+ */
+
+void plp_mat_vec_trans_i32(const int32_t *__restrict__ pSrcA,
+                           const int32_t *__restrict__ pSrcX,
+                           uint32_t M,
+                           uint32_t N,
+                           int32_t *__restrict__ pDstY) {
+    PLP_PROFILE_FUNCTION();
+
+    if (hal_cluster_id() == ARCHI_FC_CID) {
+        plp_mat_vec_trans_i32s_rv32im(pSrcA, pSrcX, M, N, pDstY);
+    } else {
+        plp_mat_vec_trans_i32s_xpulpv2(pSrcA, pSrcX, M, N, pDstY);
+    }
+}
+
+/**
+  @} end of MatVecTrans group
+ */
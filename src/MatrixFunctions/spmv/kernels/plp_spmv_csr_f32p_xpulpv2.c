@@ -0,0 +1,82 @@
+/* ----------------------------------------------------------------------
+ * Project:      PULP DSP Library
+ * Title:        plp_spmv_csr_f32p_xpulpv2.c
+ * Description:  parallel 32-bit floating-point sparse matrix-vector product kernel for XPULPV2
+ *
+ * $Date:        19. Oct 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+#include "plp_spmv_xpulpv2.h"
+
+/**
+  @ingroup SpMV
+ */
+
+/**
+  @addtogroup SpMVKernels
+  @{
+ */
+
+/**
+  @brief Parallel sparse matrix-vector multiplication of 32-bit floating-point matrices in CSR
+         format kernel for XPULPV2 extension.
+  @param[in]  args  pointer to plp_spmv_instance struct initialized by
+                    plp_spmv_csr_f32_parallel
+  @return     none
+
+  @par Parallelization
+  Every core computes a contiguous block of rows. The blocks are chosen such that they contain
+  about the same number of non-zero values plus rows (see plp_spmv_csr_split), not the same
+  number of rows.
+ */
+
+void plp_spmv_csr_f32p_xpulpv2(void *args) {
+
+    int core_id = hal_core_id();
+
+    plp_spmv_instance *a = (plp_spmv_instance *)args;
+
+    const plp_sparse_csr_f32 *__restrict__ S = (const plp_sparse_csr_f32 *)a->S;
+    const float *__restrict__ pSrc = (const float *)a->pSrc;
+    uint32_t nPE = a->nPE;
+    float *__restrict__ pDst = (float *)a->pDst;
+
+    const float *__restrict__ pValues = S->pValues;
+    const uint16_t *__restrict__ pColIdx = S->pColIdx;
+    const uint32_t *__restrict__ pRowPtr = S->pRowPtr;
+    uint32_t nRows = S->nRows;
+    uint32_t start = plp_spmv_csr_split(pRowPtr, nRows, core_id, nPE);
+    uint32_t end = plp_spmv_csr_split(pRowPtr, nRows, core_id + 1, nPE);
+    uint32_t r; // loop counter
+
+    for (r = start; r < end; r++) {
+        uint32_t k = pRowPtr[r];
+        float sum = plp_spmv_row_f32(&pValues[k], &pColIdx[k], pRowPtr[r + 1] - k, pSrc);
+        pDst[r] = sum;
+    }
+}
+
+/**
+  @} end of SpMVKernels group
+ */
@@ -0,0 +1,74 @@
+/* ----------------------------------------------------------------------
+ * Project:      PULP DSP Library
+ * Title:        plp_spmv_csr_f32s_xpulpv2.c
+ * Description:  32-bit floating-point sparse matrix-vector product (CSR) kernel for XPULPV2
+ *
+ * $Date:        19. Oct 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+#include "plp_spmv_xpulpv2.h"
+
+/**
+  @ingroup SpMV
+ */
+
+/**
+  @defgroup SpMVKernels Sparse Matrix-Vector Multiplication Kernels
+  This module contains the kernels for the sparse matrix-vector multiplication.
+ */
+
+/**
+  @addtogroup SpMVKernels
+  @{
+ */
+
+/**
+  @brief Sparse matrix-vector multiplication of 32-bit floating-point matrices in CSR format kernel
+         for XPULPV2 extension.
+  @param[in]  S         points to the sparse matrix of shape nRows x nCols in CSR format
+  @param[in]  pSrc      points to the input vector of length nCols
+  @param[out] pDst      points to the output vector of length nRows
+  @return     none
+ */
+
+void plp_spmv_csr_f32s_xpulpv2(const plp_sparse_csr_f32 *__restrict__ S,
+                               const float *__restrict__ pSrc,
+                               float *__restrict__ pDst) {
+
+    const float *__restrict__ pValues = S->pValues;
+    const uint16_t *__restrict__ pColIdx = S->pColIdx;
+    const uint32_t *__restrict__ pRowPtr = S->pRowPtr;
+    uint32_t nRows = S->nRows;
+    uint32_t r; // loop counter
+
+    for (r = 0; r < nRows; r++) {
+        uint32_t k = pRowPtr[r];
+        float sum = plp_spmv_row_f32(&pValues[k], &pColIdx[k], pRowPtr[r + 1] - k, pSrc);
+        pDst[r] = sum;
+    }
+}
+
+/**
+  @} end of SpMVKernels group
+ */
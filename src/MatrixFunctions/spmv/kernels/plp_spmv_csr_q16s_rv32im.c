@@ -0,0 +1,74 @@
+/* ----------------------------------------------------------------------
+ * Project:      PULP DSP Library
+ * Title:        plp_spmv_csr_q16s_rv32im.c
+ * Description:  16-bit fix-point sparse matrix-vector product (CSR) kernel for RV32IM
+ *
+ * $Date:        19. Oct 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup SpMV
+ */
+
+/**
+  @addtogroup SpMVKernels
+  @{
+ */
+
+/**
+  @brief Sparse matrix-vector multiplication of 16-bit fix-point matrices in CSR format kernel for
+         RV32IM extension.
+  @param[in]  S         points to the sparse matrix of shape nRows x nCols in CSR format
+  @param[in]  pSrc      points to the input vector of length nCols
+  @param[in]  shift     Amount to shift the accumulated result to the right
+  @param[out] pDst      points to the output vector of length nRows
+  @return     none
+ */
+
+void plp_spmv_csr_q16s_rv32im(const plp_sparse_csr_q16 *__restrict__ S,
+                              const int16_t *__restrict__ pSrc,
+                              uint32_t shift,
+                              int16_t *__restrict__ pDst) {
+
+    const int16_t *__restrict__ pValues = S->pValues;
+    const uint16_t *__restrict__ pColIdx = S->pColIdx;
+    const uint32_t *__restrict__ pRowPtr = S->pRowPtr;
+    uint32_t nRows = S->nRows;
+    int32_t round = (1 << shift) >> 1;
+    uint32_t r; // loop counter for the rows
+    uint32_t k; // loop counter for the values of a row
+
+    for (r = 0; r < nRows; r++) {
+        int32_t sum = 0;
+        for (k = pRowPtr[r]; k < pRowPtr[r + 1]; k++) {
+            sum += (int32_t)pValues[k] * (int32_t)pSrc[pColIdx[k]];
+        }
+        pDst[r] = (int16_t)((sum + round) >> shift);
+    }
+}
+
+/**
+  @} end of SpMVKernels group
+ */
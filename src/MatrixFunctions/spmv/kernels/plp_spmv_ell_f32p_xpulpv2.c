@@ -0,0 +1,77 @@
+/* ----------------------------------------------------------------------
+ * Project:      PULP DSP Library
+ * Title:        plp_spmv_ell_f32p_xpulpv2.c
+ * Description:  parallel 32-bit floating-point sparse matrix-vector product kernel for XPULPV2
+ *
+ * $Date:        19. Oct 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+#include "plp_spmv_xpulpv2.h"
+
+/**
+  @ingroup SpMV
+ */
+
+/**
+  @addtogroup SpMVKernels
+  @{
+ */
+
+/**
+  @brief Parallel sparse matrix-vector multiplication of 32-bit floating-point matrices in ELL
+         format kernel for XPULPV2 extension.
+  @param[in]  args  pointer to plp_spmv_instance struct initialized by
+                    plp_spmv_ell_f32_parallel
+  @return     none
+
+  @par Parallelization
+  The rows are distributed among the cores in an interleaved way, all rows have the same cost.
+ */
+
+void plp_spmv_ell_f32p_xpulpv2(void *args) {
+
+    int core_id = hal_core_id();
+
+    plp_spmv_instance *a = (plp_spmv_instance *)args;
+
+    const plp_sparse_ell_f32 *__restrict__ S = (const plp_sparse_ell_f32 *)a->S;
+    const float *__restrict__ pSrc = (const float *)a->pSrc;
+    uint32_t nPE = a->nPE;
+    float *__restrict__ pDst = (float *)a->pDst;
+
+    const float *__restrict__ pValues = S->pValues;
+    const uint16_t *__restrict__ pColIdx = S->pColIdx;
+    uint32_t nRows = S->nRows;
+    uint32_t width = S->width;
+    uint32_t r; // loop counter
+
+    for (r = core_id; r < nRows; r += nPE) {
+        float sum = plp_spmv_row_f32(&pValues[r * width], &pColIdx[r * width], width, pSrc);
+        pDst[r] = sum;
+    }
+}
+
+/**
+  @} end of SpMVKernels group
+ */
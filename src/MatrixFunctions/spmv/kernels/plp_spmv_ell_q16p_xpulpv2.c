@@ -0,0 +1,79 @@
+/* ----------------------------------------------------------------------
+ * Project:      PULP DSP Library
+ * Title:        plp_spmv_ell_q16p_xpulpv2.c
+ * Description:  parallel 16-bit fix-point sparse matrix-vector product kernel for XPULPV2
+ *
+ * $Date:        19. Oct 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+#include "plp_spmv_xpulpv2.h"
+
+/**
+  @ingroup SpMV
+ */
+
+/**
+  @addtogroup SpMVKernels
+  @{
+ */
+
+/**
+  @brief Parallel sparse matrix-vector multiplication of 16-bit fix-point matrices in ELL format
+         kernel for XPULPV2 extension.
+  @param[in]  args  pointer to plp_spmv_instance struct initialized by
+                    plp_spmv_ell_q16_parallel
+  @return     none
+
+  @par Parallelization
+  The rows are distributed among the cores in an interleaved way, all rows have the same cost.
+ */
+
+void plp_spmv_ell_q16p_xpulpv2(void *args) {
+
+    int core_id = hal_core_id();
+
+    plp_spmv_instance *a = (plp_spmv_instance *)args;
+
+    const plp_sparse_ell_q16 *__restrict__ S = (const plp_sparse_ell_q16 *)a->S;
+    const int16_t *__restrict__ pSrc = (const int16_t *)a->pSrc;
+    uint32_t shift = a->shift;
+    uint32_t nPE = a->nPE;
+    int16_t *__restrict__ pDst = (int16_t *)a->pDst;
+
+    const int16_t *__restrict__ pValues = S->pValues;
+    const uint16_t *__restrict__ pColIdx = S->pColIdx;
+    uint32_t nRows = S->nRows;
+    uint32_t width = S->width;
+    int32_t round = (1 << shift) >> 1;
+    uint32_t r; // loop counter
+
+    for (r = core_id; r < nRows; r += nPE) {
+        int32_t sum = plp_spmv_ell_row_i16(&pValues[r * width], &pColIdx[r * width], width, pSrc);
+        pDst[r] = (int16_t)((sum + round) >> shift);
+    }
+}
+
+/**
+  @} end of SpMVKernels group
+ */
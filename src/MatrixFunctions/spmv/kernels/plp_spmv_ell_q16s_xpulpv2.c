@@ -0,0 +1,75 @@
+/* ----------------------------------------------------------------------
+ * Project:      PULP DSP Library
+ * Title:        plp_spmv_ell_q16s_xpulpv2.c
+ * Description:  16-bit fix-point sparse matrix-vector product (ELL) kernel for XPULPV2
+ *
+ * $Date:        19. Oct 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+#include "plp_spmv_xpulpv2.h"
+
+/**
+  @ingroup SpMV
+ */
+
+/**
+  @addtogroup SpMVKernels
+  @{
+ */
+
+/**
+  @brief Sparse matrix-vector multiplication of 16-bit fix-point matrices in ELL format kernel for
+         XPULPV2 extension.
+  @param[in]  S         points to the sparse matrix of shape nRows x nCols in ELL format
+  @param[in]  pSrc      points to the input vector of length nCols
+  @param[in]  shift     Amount to shift the accumulated result to the right
+  @param[out] pDst      points to the output vector of length nRows
+  @return     none
+
+  @par SIMD
+  If the width of the matrix is a multiple of 2, the elements of x are gathered into pairs and
+  multiplied with two values at once (pValues must be word aligned).
+ */
+
+void plp_spmv_ell_q16s_xpulpv2(const plp_sparse_ell_q16 *__restrict__ S,
+                               const int16_t *__restrict__ pSrc,
+                               uint32_t shift,
+                               int16_t *__restrict__ pDst) {
+
+    const int16_t *__restrict__ pValues = S->pValues;
+    const uint16_t *__restrict__ pColIdx = S->pColIdx;
+    uint32_t nRows = S->nRows;
+    uint32_t width = S->width;
+    int32_t round = (1 << shift) >> 1;
+    uint32_t r; // loop counter
+
+    for (r = 0; r < nRows; r++) {
+        int32_t sum = plp_spmv_ell_row_i16(&pValues[r * width], &pColIdx[r * width], width, pSrc);
+        pDst[r] = (int16_t)((sum + round) >> shift);
+    }
+}
+
+/**
+  @} end of SpMVKernels group
+ */
@@ -0,0 +1,162 @@
+/* ----------------------------------------------------------------------
+ * Project:      PULP DSP Library
+ * Title:        plp_spmv_xpulpv2.h
+ * Description:  Row kernels and row split of the sparse matrix-vector multiplications
+ *
+ * $Date:        19. Oct 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __PLP_SPMV_XPULPV2_H__
+#define __PLP_SPMV_XPULPV2_H__
+
+#include "plp_math.h"
+
+/*
+ * First row of the CSR matrix computed by core_id, and last row + 1 of core_id - 1. The cost of a
+ * row is modeled as its number of non-zero values plus one for the loop overhead, and every core
+ * gets about total / nPE of the total cost. Since pRowPtr[r] + r is strictly increasing, the first
+ * row of a core is found with a binary search. core_id = nPE returns nRows.
+ */
+static inline uint32_t plp_spmv_csr_split(const uint32_t *pRowPtr,
+                                          uint32_t nRows,
+                                          uint32_t core_id,
+                                          uint32_t nPE) {
+    uint32_t total = pRowPtr[nRows] + nRows;
+    // core_id * total / nPE, without overflow in 32 bits
+    uint32_t target = (total / nPE) * core_id + ((total % nPE) * core_id) / nPE;
+    uint32_t lo = 0;
+    uint32_t hi = nRows;
+
+    while (lo < hi) {
+        uint32_t mid = (lo + hi) >> 1;
+        if (pRowPtr[mid] + mid < target) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    return lo;
+}
+
+/*
+ * Dot product of the len values of a sparse row with the elements of x at their columns. Two
+ * accumulators hide the latency of the loads of x, which depend on the loads of the columns.
+ */
+static inline float plp_spmv_row_f32(const float *__restrict__ pValues,
+                                     const uint16_t *__restrict__ pColIdx,
+                                     uint32_t len,
+                                     const float *__restrict__ pSrc) {
+    float sum0 = 0.0f;
+    float sum1 = 0.0f;
+    uint32_t k;
+
+    for (k = 0; k + 2 <= len; k += 2) {
+        sum0 += pValues[k] * pSrc[pColIdx[k]];
+        sum1 += pValues[k + 1] * pSrc[pColIdx[k + 1]];
+    }
+    if (k < len) {
+        sum0 += pValues[k] * pSrc[pColIdx[k]];
+    }
+    return sum0 + sum1;
+}
+
+static inline int32_t plp_spmv_row_i16(const int16_t *__restrict__ pValues,
+                                       const uint16_t *__restrict__ pColIdx,
+                                       uint32_t len,
+                                       const int16_t *__restrict__ pSrc) {
+    int32_t sum0 = 0;
+    int32_t sum1 = 0;
+    uint32_t k;
+
+    for (k = 0; k + 2 <= len; k += 2) {
+        sum0 += (int32_t)pValues[k] * (int32_t)pSrc[pColIdx[k]];
+        sum1 += (int32_t)pValues[k + 1] * (int32_t)pSrc[pColIdx[k + 1]];
+    }
+    if (k < len) {
+        sum0 += (int32_t)pValues[k] * (int32_t)pSrc[pColIdx[k]];
+    }
+    return sum0 + sum1;
+}
+
+static inline int32_t plp_spmv_row_i8(const int8_t *__restrict__ pValues,
+                                      const uint16_t *__restrict__ pColIdx,
+                                      uint32_t len,
+                                      const int8_t *__restrict__ pSrc) {
+    int32_t sum0 = 0;
+    int32_t sum1 = 0;
+    uint32_t k;
+
+    for (k = 0; k + 2 <= len; k += 2) {
+        sum0 += (int32_t)pValues[k] * (int32_t)pSrc[pColIdx[k]];
+        sum1 += (int32_t)pValues[k + 1] * (int32_t)pSrc[pColIdx[k + 1]];
+    }
+    if (k < len) {
+        sum0 += (int32_t)pValues[k] * (int32_t)pSrc[pColIdx[k]];
+    }
+    return sum0 + sum1;
+}
+
+/*
+ * Dot product of an ELL row of width values. If the rows are word aligned (even width), the
+ * elements of x are gathered into pairs and multiplied with a SIMD dot product.
+ */
+static inline int32_t plp_spmv_ell_row_i16(const int16_t *__restrict__ pValues,
+                                           const uint16_t *__restrict__ pColIdx,
+                                           uint32_t width,
+                                           const int16_t *__restrict__ pSrc) {
+    int32_t sum = 0;
+    uint32_t k;
+
+    if (width & 1) {
+        return plp_spmv_row_i16(pValues, pColIdx, width, pSrc);
+    }
+    for (k = 0; k < width; k += 2) {
+        v2s x = __PACK2(pSrc[pColIdx[k]], pSrc[pColIdx[k + 1]]);
+        sum = __SUMDOTP2(*((v2s *)&pValues[k]), x, sum);
+    }
+    return sum;
+}
+
+/*
+ * Dot product of an ELL row of width values. If the rows are word aligned (width multiple of 4),
+ * the elements of x are gathered into vectors of four and multiplied with a SIMD dot product.
+ */
+static inline int32_t plp_spmv_ell_row_i8(const int8_t *__restrict__ pValues,
+                                          const uint16_t *__restrict__ pColIdx,
+                                          uint32_t width,
+                                          const int8_t *__restrict__ pSrc) {
+    int32_t sum = 0;
+    uint32_t k;
+
+    if (width & 3) {
+        return plp_spmv_row_i8(pValues, pColIdx, width, pSrc);
+    }
+    for (k = 0; k < width; k += 4) {
+        v4s x = __PACK4(pSrc[pColIdx[k]], pSrc[pColIdx[k + 1]], pSrc[pColIdx[k + 2]],
+                        pSrc[pColIdx[k + 3]]);
+        sum = __SUMDOTP4(*((v4s *)&pValues[k]), x, sum);
+    }
+    return sum;
+}
+
+#endif // __PLP_SPMV_XPULPV2_H__
@@ -0,0 +1,88 @@
+/* ----------------------------------------------------------------------
+ * Project:      PULP DSP Library
+ * Title:        plp_spmv_csr_f32.c
+ * Description:  32-bit floating-point sparse matrix-vector product (CSR) glue code
+ *
+ * $Date:        19. Oct 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @defgroup SpMV Sparse Matrix-Vector Multiplication
+  Computes the product y = A x of a sparse MxN matrix A with the vector x of length N, e.g. for
+  pruned fully connected layers. Only the non-zero values of A are stored and multiplied, together
+  with their column index (16 bits, i.e. up to 65536 columns).
+
+  Two formats are supported. The compressed sparse row (CSR) format (plp_sparse_csr_f32) stores
+  the non-zero values row after row, and the index of the first value of every row. It is the most
+  compact format, also when the rows have very different numbers of non-zero values. The ELLPACK
+  (ELL) format (plp_sparse_ell_f32) stores the same number of values for every row, padded with
+  zeros. All rows then have the same length and alignment, which allows the fix-point kernels to
+  gather the elements of x into SIMD vectors and use the dot product instructions, at the cost of
+  the padding.
+
+  The parallel CSR functions split the rows among the cores such that every core gets about the
+  same number of non-zero values (plus one per row for the overhead of a row) instead of the same
+  number of rows, which keeps the cores busy when a few rows hold most of the non-zero values. The
+  boundaries are found with a binary search in the row pointers, without synchronization. The
+  parallel ELL functions distribute the rows, which all have the same cost, among the cores.
+
+  The fix-point versions accumulate the products in 32 bits and round the sum once by `shift` bits
+  to the right, as plp_mat_vec_q16.
+ */
+
+/**
+  @addtogroup SpMV
+  @{
+ */
+
+/**
+  @brief Glue code for sparse matrix-vector multiplication of 32-bit floating-point matrices in CSR
+         format.
+  @param[in]  S         points to the sparse matrix of shape nRows x nCols in CSR format
+  @param[in]  pSrc      points to the input vector of length nCols
+  @param[out] pDst      points to the output vector of length nRows
+  @return     none
+ */
+
+void plp_spmv_csr_f32(const plp_sparse_csr_f32 *__restrict__ S,
+                      const float *__restrict__ pSrc,
+                      float *__restrict__ pDst) {
+    PLP_PROFILE_FUNCTION();
+
+    if (hal_cluster_id() == ARCHI_FC_CID) {
+        printf("Floating point is supported only for cluster side\n");
+        return;
+    } else {
+        plp_spmv_csr_f32s_xpulpv2(S, pSrc, pDst);
+    }
+}
+
+/**
+  @} end of SpMV group
+ */
@@ -0,0 +1,73 @@
+/* ----------------------------------------------------------------------
+ * Project:      PULP DSP Library
+ * Title:        plp_spmv_csr_f32_parallel.c
+ * Description:  Parallel 32-bit floating-point sparse matrix-vector product (CSR) glue code
+ *
+ * $Date:        19. Oct 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @addtogroup SpMV
+  @{
+ */
+
+/**
+  @brief Glue code for parallel sparse matrix-vector multiplication of 32-bit floating-point
+         matrices in CSR format.
+  @param[in]  S         points to the sparse matrix of shape nRows x nCols in CSR format
+  @param[in]  pSrc      points to the input vector of length nCols
+  @param[in]  nPE       Number of cores to use
+  @param[out] pDst      points to the output vector of length nRows
+  @return     none
+ */
+
+void plp_spmv_csr_f32_parallel(const plp_sparse_csr_f32 *__restrict__ S,
+                               const float *__restrict__ pSrc,
+                               uint32_t nPE,
+                               float *__restrict__ pDst) {
+    PLP_PROFILE_FUNCTION();
+
+    if (hal_cluster_id() == ARCHI_FC_CID) {
+        printf("parallel processing supported only for cluster side\n");
+        return;
+    } else {
+        plp_spmv_instance args = {
+            .S = S,
+            .pSrc = pSrc,
+            .shift = 0,
+            .nPE = nPE,
+            .pDst = pDst
+        };
+        hal_cl_team_fork(nPE, plp_spmv_csr_f32p_xpulpv2, (void *)&args);
+    }
+}
+
+/**
+  @} end of SpMV group
+ */
@@ -0,0 +1,73 @@
+/* ----------------------------------------------------------------------
+ * Project:      PULP DSP Library
+ * Title:        plp_spmv_csr_q8.c
+ * Description:  8-bit fix-point sparse matrix-vector product (CSR) glue code
+ *
+ * $Date:        19. Oct 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @addtogroup SpMV
+  @{
+ */
+
+/**
+  @brief Glue code for sparse matrix-vector multiplication of 8-bit fix-point matrices in CSR
+         format.
+  @param[in]  S         points to the sparse matrix of shape nRows x nCols in CSR format
+  @param[in]  pSrc      points to the input vector of length nCols
+  @param[in]  shift     Amount to shift the accumulated result to the right
+  @param[out] pDst      points to the output vector of length nRows
+  @return     none
+
+  @par Fix-Point and Shifting
+  The result will be shifted by the parameter `shift` to the right (multiplied
+  by 2^-shift). Assume that matrix A is represented as pValues * 2^-x, and the vector
+  as pSrc * 2^-y. Then, the output is represented as pDst * 2^-(x + y - shift).
+
+  The products are accumulated in 32 bits and the sum is rounded once. Set the `shift`
+  parameter such that no overflow occurs.
+ */
+
+void plp_spmv_csr_q8(const plp_sparse_csr_q8 *__restrict__ S,
+                     const int8_t *__restrict__ pSrc,
+                     uint32_t shift,
+                     int8_t *__restrict__ pDst) {
+    PLP_PROFILE_FUNCTION();
+
+    if (hal_cluster_id() == ARCHI_FC_CID) {
+        plp_spmv_csr_q8s_rv32im(S, pSrc, shift, pDst);
+    } else {
+        plp_spmv_csr_q8s_xpulpv2(S, pSrc, shift, pDst);
+    }
+}
+
+/**
+  @} end of SpMV group
+ */
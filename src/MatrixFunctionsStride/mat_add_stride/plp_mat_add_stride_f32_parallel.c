@@ -62,6 +62,7 @@ void plp_mat_add_stride_f32_parallel(const float *__restrict__ pSrcA,
                                      uint32_t strideY,
                                      uint32_t nPE,
                                      float *__restrict__ pDst) {
+    PLP_PROFILE_FUNCTION();
 
     if (hal_cluster_id() == ARCHI_FC_CID) {
         printf("parallel and floating-point processing supported only for cluster side\n");
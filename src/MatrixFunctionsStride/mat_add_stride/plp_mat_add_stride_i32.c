@@ -60,6 +60,7 @@ void plp_mat_add_stride_i32(const int32_t *__restrict__ pSrcA,
                             uint32_t strideB,
                             uint32_t strideY,
                             int32_t *__restrict__ pDst) {
+    PLP_PROFILE_FUNCTION();
 
     if (hal_cluster_id() == ARCHI_FC_CID) {
         plp_mat_add_stride_i32s_rv32im(pSrcA, pSrcB, M, N, strideA, strideB, strideY, pDst);
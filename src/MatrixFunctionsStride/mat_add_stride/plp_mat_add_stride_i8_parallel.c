@@ -62,6 +62,7 @@ void plp_mat_add_stride_i8_parallel(const int8_t *__restrict__ pSrcA,
                                     uint32_t strideY,
                                     uint32_t nPE,
                                     int8_t *__restrict__ pDst) {
+    PLP_PROFILE_FUNCTION();
 
     if (hal_cluster_id() == ARCHI_FC_CID) {
         printf("parallel processing supported only for cluster side\n");
@@ -56,6 +56,7 @@ void plp_mat_copy_stride_f32(const float *__restrict__ pSrc,
                              uint32_t strideSrc,
                              uint32_t strideDst,
                              float *__restrict__ pDst) {
+    PLP_PROFILE_FUNCTION();
 
     if (hal_cluster_id() == ARCHI_FC_CID) {
         printf("Floating point is supported only for cluster side\n");
@@ -58,6 +58,7 @@ void plp_mat_copy_stride_f32_parallel(const float *__restrict__ pSrc,
                                       uint32_t strideDst,
                                       uint32_t nPE,
                                       float *__restrict__ pDst) {
+    PLP_PROFILE_FUNCTION();
 
     if (hal_cluster_id() == ARCHI_FC_CID) {
         printf("parallel and floating-point processing supported only for cluster side\n");
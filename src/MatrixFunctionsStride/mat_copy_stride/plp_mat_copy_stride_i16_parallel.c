@@ -58,6 +58,7 @@ void plp_mat_copy_stride_i16_parallel(const int16_t *__restrict__ pSrc,
                                       uint32_t strideDst,
                                       uint32_t nPE,
                                       int16_t *__restrict__ pDst) {
+    PLP_PROFILE_FUNCTION();
 
     if (hal_cluster_id() == ARCHI_FC_CID) {
         printf("parallel processing supported only for cluster side\n");
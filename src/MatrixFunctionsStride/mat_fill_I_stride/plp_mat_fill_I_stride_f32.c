@@ -48,6 +48,7 @@
  */
 
 void plp_mat_fill_I_stride_f32(uint32_t N, uint32_t stride, float *__restrict__ pDst) {
+    PLP_PROFILE_FUNCTION();
 
     if (hal_cluster_id() == ARCHI_FC_CID) {
         printf("Floating point is supported only for cluster side\n");
@@ -52,6 +52,7 @@ void plp_mat_fill_I_stride_i8_parallel(uint32_t N,
                                        uint32_t stride,
                                        uint32_t nPE,
                                        int8_t *__restrict__ pDst) {
+    PLP_PROFILE_FUNCTION();
 
     if (hal_cluster_id() == ARCHI_FC_CID) {
         printf("parallel processing supported only for cluster side\n");
@@ -55,6 +55,7 @@ void plp_mat_fill_stride_i32_parallel(uint32_t M,
                                       int32_t value,
                                       uint32_t nPE,
                                       int32_t *__restrict__ pDst) {
+    PLP_PROFILE_FUNCTION();
 
     if (hal_cluster_id() == ARCHI_FC_CID) {
         printf("parallel processing supported only for cluster side\n");
@@ -30,6 +30,7 @@
  */
 
 #include "plp_math.h"
+#include "plp_const_structs.h"
 
 /**
   @ingroup groupMatrixStride
@@ -50,7 +51,7 @@
   @param[in]  strideA Stride of input matrix A (elements between each row)
   @param[in]  strideB Stride of input matrix B (elements between each row)
   @param[in]  strideC Stride of output matrix C (Elements between each row)
-  @param[in]  nPE     Number of cores to use for computation
+  @param[in]  nPE     Number of cores to use for computation (or PLP_NPE_AUTO)
   @param[out] pDstC   Points to the output matrix of shape MxO
   @return     none
  */
@@ -65,11 +66,20 @@ void plp_mat_mult_cmplx_stride_f32_parallel(const float *__restrict__ pSrcA,
                                             uint32_t strideC,
                                             uint32_t nPE,
                                             float *__restrict__ pDstC) {
+    PLP_PROFILE_FUNCTION();
 
     if (hal_cluster_id() == ARCHI_FC_CID) {
         printf("parallel and floating-point processing supported only for cluster side\n");
         return;
     } else {
+        if (nPE == PLP_NPE_AUTO) {
+            nPE = plp_npe_auto(&plp_npe_model_mat_mult_f32, 4 * M * N * O, M);
+            if (nPE == 1) {
+                plp_mat_mult_cmplx_stride_f32s_xpulpv2(pSrcA, pSrcB, M, N, O, strideA, strideB,
+                                                       strideC, pDstC);
+                return;
+            }
+        }
         plp_mat_mult_cmplx_stride_instance_f32 args = { .pSrcA = pSrcA,
                                                         .pSrcB = pSrcB,
                                                         .M = M,
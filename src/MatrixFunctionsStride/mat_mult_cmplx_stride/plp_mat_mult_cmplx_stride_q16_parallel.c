@@ -29,6 +29,7 @@
  */
 
 #include "plp_math.h"
+#include "plp_const_structs.h"
 
 /**
   @ingroup groupMatrixStride
@@ -51,7 +52,7 @@
   @param[in]  strideB Stride of input matrix B (elements between each row)
   @param[in]  strideC Stride of output matrix C (Elements between each row)
   @param[in]  shift   Amount to shift the result of each multiplication ot the right
-  @param[in]  nPE     Number of cores to use for computation
+  @param[in]  nPE     Number of cores to use for computation (or PLP_NPE_AUTO)
   @param[out] pDstC   Points to the output matrix of shape MxO
   @return     none
 
@@ -76,11 +77,20 @@ void plp_mat_mult_cmplx_stride_q16_parallel(const int16_t *__restrict__ pSrcA,
                                             uint32_t shift,
                                             uint32_t nPE,
                                             int16_t *__restrict__ pDstC) {
+    PLP_PROFILE_FUNCTION();
 
     if (hal_cluster_id() == ARCHI_FC_CID) {
         printf("parallel processing supported only for cluster side\n");
         return;
     } else {
+        if (nPE == PLP_NPE_AUTO) {
+            nPE = plp_npe_auto(&plp_npe_model_mat_mult_q16, 4 * M * N * O, M);
+            if (nPE == 1) {
+                plp_mat_mult_cmplx_stride_q16s_xpulpv2(pSrcA, pSrcB, M, N, O, strideA, strideB,
+                                                       strideC, shift, pDstC);
+                return;
+            }
+        }
         plp_mat_mult_cmplx_stride_instance_q16 args = { .pSrcA = pSrcA,
                                                         .pSrcB = pSrcB,
                                                         .M = M,
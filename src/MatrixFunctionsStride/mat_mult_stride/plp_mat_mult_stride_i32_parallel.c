@@ -29,6 +29,7 @@
  */
 
 #include "plp_math.h"
+#include "plp_const_structs.h"
 
 /**
   @ingroup groupMatrixStride
@@ -49,7 +50,7 @@
   @param[in]  strideA   Stride of matrix A (elements between each row)
   @param[in]  strideB   Stride of matrix B (elements between each row)
   @param[in]  strideC   Stride of output matrix (elements between each row)
-  @param[in]  nPE       Number of cores to use
+  @param[in]  nPE       Number of cores to use (or PLP_NPE_AUTO)
   @param[out] pDstC     points to the output matrix
   @return        none
  */
@@ -64,11 +65,20 @@ void plp_mat_mult_stride_i32_parallel(const int32_t *__restrict__ pSrcA,
                                       uint32_t strideC,
                                       uint32_t nPE,
                                       int32_t *__restrict__ pDstC) {
+    PLP_PROFILE_FUNCTION();
 
     if (hal_cluster_id() == ARCHI_FC_CID) {
         printf("parallel processing supported only for cluster side\n");
         return;
     } else {
+        if (nPE == PLP_NPE_AUTO) {
+            nPE = plp_npe_auto(&plp_npe_model_mat_mult_i32, M * N * O, M);
+            if (nPE == 1) {
+                plp_mat_mult_stride_i32s_xpulpv2(pSrcA, pSrcB, M, N, O, strideA, strideB, strideC,
+                                                 pDstC);
+                return;
+            }
+        }
         plp_mat_mult_stride_instance_i32 args = { .pSrcA = pSrcA,
                                                   .pSrcB = pSrcB,
                                                   .M = M,
@@ -74,6 +74,7 @@ void plp_mat_mult_trans_cmplx_stride_q16(const int16_t *__restrict__ pSrcA,
                                          uint32_t strideC,
                                          uint32_t shift,
                                          int16_t *__restrict__ pDstC) {
+    PLP_PROFILE_FUNCTION();
 
     if (hal_cluster_id() == ARCHI_FC_CID) {
         plp_mat_mult_trans_cmplx_stride_q16s_rv32im(pSrcA, pSrcB, M, N, O, strideA, strideB,
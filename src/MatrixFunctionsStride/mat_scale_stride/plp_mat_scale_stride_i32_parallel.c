@@ -62,6 +62,7 @@ void plp_mat_scale_stride_i32_parallel(const int32_t *__restrict__ pSrc,
                                        int32_t shift,
                                        uint32_t nPE,
                                        int32_t *__restrict__ pDst) {
+    PLP_PROFILE_FUNCTION();
 
     if (hal_cluster_id() == ARCHI_FC_CID) {
         printf("parallel processing supported only for cluster side\n");
@@ -60,6 +60,7 @@ void plp_mat_scale_stride_i8(const int8_t *__restrict__ pSrc,
                              int8_t scaleFactor,
                              int32_t shift,
                              int8_t *__restrict__ pDst) {
+    PLP_PROFILE_FUNCTION();
 
     if (hal_cluster_id() == ARCHI_FC_CID) {
         plp_mat_scale_stride_i8s_rv32im(pSrc, M, N, strideSrc, strideDst, scaleFactor, shift, pDst);
@@ -52,6 +52,7 @@
  */
 
 void plp_max_i16(const int16_t *__restrict__ pSrc, uint32_t blockSize, int16_t *__restrict__ pRes) {
+    PLP_PROFILE_FUNCTION();
 
     if (hal_cluster_id() == ARCHI_FC_CID) {
         plp_max_i16s_rv32im(pSrc, blockSize, pRes);
@@ -53,6 +53,7 @@
 void plp_mean_i16(const int16_t *__restrict__ pSrc,
                   uint32_t blockSize,
                   int16_t *__restrict__ pRes) {
+    PLP_PROFILE_FUNCTION();
 
     if (hal_cluster_id() == ARCHI_FC_CID) {
         plp_mean_i16s_rv32im(pSrc, blockSize, pRes);
@@ -59,6 +59,7 @@
 void plp_mean_i32(const int32_t *__restrict__ pSrc,
                   uint32_t blockSize,
                   int32_t *__restrict__ pRes) {
+    PLP_PROFILE_FUNCTION();
 
     if (hal_cluster_id() == ARCHI_FC_CID) {
         plp_mean_i32s_rv32im(pSrc, blockSize, pRes);
@@ -51,6 +51,7 @@
  */
 
 void plp_min_i32(const int32_t *__restrict__ pSrc, uint32_t blockSize, int32_t *__restrict__ pRes) {
+    PLP_PROFILE_FUNCTION();
 
     if (hal_cluster_id() == ARCHI_FC_CID) {
         plp_min_i32s_rv32im(pSrc, blockSize, pRes);
@@ -73,6 +73,7 @@ void plp_rms_q16(const int16_t *__restrict__ pSrc,
                  uint32_t blockSize,
                  uint32_t fracBits,
                  int16_t *__restrict__ pRes) {
+    PLP_PROFILE_FUNCTION();
 
     if (hal_cluster_id() == ARCHI_FC_CID) {
         plp_rms_q16s_rv32im(pSrc, blockSize, fracBits, pRes);
@@ -54,6 +54,7 @@ void plp_var_q32(const int32_t *__restrict__ pSrc,
                  uint32_t blockSize,
                  uint32_t fracBits,
                  int32_t *__restrict__ pRes) {
+    PLP_PROFILE_FUNCTION();
 
     if (hal_cluster_id() == ARCHI_FC_CID) {
         plp_var_q32s_rv32im(pSrc, blockSize, fracBits, pRes);
@@ -53,6 +53,7 @@
 */
 
 void plp_copy_f32(float32_t *__restrict__ pSrc, float32_t *__restrict__ pDst, uint32_t blockSize) {
+    PLP_PROFILE_FUNCTION();
 
     uint32_t blkCnt; /* Loop counter */
 
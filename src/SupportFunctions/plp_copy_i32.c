@@ -79,6 +79,7 @@
 */
 
 void plp_copy_i32(int32_t *__restrict__ pSrc, int32_t *__restrict__ pDst, uint32_t blockSize) {
+    PLP_PROFILE_FUNCTION();
 
     uint32_t blkCnt; /* Loop counter */
 
@@ -0,0 +1,98 @@
+/* ----------------------------------------------------------------------
+ * Project:      PULP DSP Library
+ * Title:        plp_npe_auto.c
+ * Description:  Selection of the number of cores based on the problem size
+ *
+ * $Date:        19. Oct 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupSupport
+ */
+
+/**
+  @defgroup NpeAuto Automatic Core Count Selection
+  Parallel glue code accepting <code>nPE = PLP_NPE_AUTO</code> uses this function to choose the
+  number of cores from the problem size. Forking a team and joining it in the final barrier has a
+  fixed cost, which dominates for small problems. The cost model (see plp_npe_cost_model) compares
+  the single-core execution time with the parallel execution time, including the load imbalance
+  when the number of work items is not a multiple of the number of cores.
+
+  The parameters of the cost models are calibrated from the benchmark sweeps with the script
+  `test/mrWolf/npe_model.py`. Only the integer versions of plp_mat_mult are calibrated, the
+  fix-point and floating-point versions use the model of the integer version with the same word
+  size as an approximation (see plp_const_structs.c).
+ */
+
+/**
+  @addtogroup NpeAuto
+  @{
+ */
+
+/**
+  @brief      Selects the number of cores for a parallel kernel based on a cost model.
+  @param[in]  model   points to the cost model of the parallel kernel
+  @param[in]  nOps    number of operations (e.g. MACs) of the problem
+  @param[in]  nUnits  number of independent work items distributed over the cores
+  @return     number of cores to use, between 1 and hal_cl_nb_pe_cores()
+ */
+
+uint32_t plp_npe_auto(const plp_npe_cost_model *model, uint32_t nOps, uint32_t nUnits) {
+
+    uint32_t nPE = hal_cl_nb_pe_cores();
+    uint32_t unitsPerPE;
+    uint64_t serialCycles;
+
+    if (nUnits < nPE) {
+        nPE = nUnits;
+    }
+
+    if (nPE <= 1) {
+        return 1;
+    }
+
+    serialCycles = ((uint64_t)nOps * model->opCycles) >> 4;
+
+    /* Early exit: not even a perfect split over all cores can hide the fork overhead. */
+    if (serialCycles <= model->forkCycles) {
+        return 1;
+    }
+
+    /* Use the smallest number of cores achieving the same maximum number of units per core. */
+    unitsPerPE = (nUnits + nPE - 1) / nPE;
+    nPE = (nUnits + unitsPerPE - 1) / unitsPerPE;
+
+    /* Parallel execution pays off if the saved cycles are more than the fork overhead:
+     * serialCycles * (1 - unitsPerPE / nUnits) > forkCycles */
+    if (serialCycles * (nUnits - unitsPerPE) <= (uint64_t)model->forkCycles * nUnits) {
+        return 1;
+    }
+
+    return nPE;
+}
+
+/**
+  @} end of NpeAuto group
+ */
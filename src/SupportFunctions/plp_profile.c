@@ -0,0 +1,266 @@
+/* ----------------------------------------------------------------------
+ * Project:      PULP DSP Library
+ * Title:        plp_profile.c
+ * Description:  Per-function profiling of the glue code (PLP_PROFILE)
+ *
+ * $Date:        19. Oct 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+#ifdef PLP_PROFILE
+
+#include "string.h"
+
+/**
+  @ingroup groupSupport
+ */
+
+/**
+  @defgroup Profile Profiling
+  When the library is built with <code>-DPLP_PROFILE</code> (e.g. <code>make TFLAGS=-DPLP_PROFILE
+  all install</code>, and the application is compiled with the same flag), every glue function
+  records the number of calls, cycles, instructions and load stalls it spends, including its
+  kernels. The counters are accumulated per calling core. For the parallel glue functions, each
+  core additionally records the counters of the forked kernel, which exposes load imbalance.
+
+  The performance counters of each core are configured and started on the first profiled call and
+  are then free running, the profiling reads them at the beginning and at the end of each call.
+  The application must not reconfigure or reset the counters while profiling. Nested glue
+  functions are accounted to both, the inner and the outer function.
+
+  Without PLP_PROFILE, the instrumentation and these functions are not compiled at all.
+ */
+
+/**
+  @addtogroup Profile
+  @{
+ */
+
+#define PLP_PROFILE_FC PLP_PROFILE_NB_CORES
+
+static plp_profile_entry *plp_profile_head = NULL;
+static plp_profile_entry *plp_profile_current[PLP_PROFILE_NB_CORES + 1] = { NULL };
+static uint8_t plp_profile_started[PLP_PROFILE_NB_CORES + 1] = { 0 };
+
+typedef struct {
+    void (*entry)(void *);
+    void *arg;
+    plp_profile_entry *profile;
+} plp_profile_fork_args;
+
+static inline uint32_t plp_profile_slot(void) {
+    if (hal_cluster_id() == ARCHI_FC_CID) {
+        return PLP_PROFILE_FC;
+    }
+    return hal_core_id();
+}
+
+/* Starts the counters of the calling core, if they are not yet running. */
+static inline void plp_profile_start_counters(uint32_t slot) {
+    if (!plp_profile_started[slot]) {
+        hal_perf_t perf;
+        hal_perf_init(&perf);
+        hal_perf_conf(&perf,
+                      (1 << HAL_PERF_CYCLES) | (1 << HAL_PERF_INSTR) | (1 << HAL_PERF_LD_STALL));
+        hal_perf_reset(&perf);
+        hal_perf_start(&perf);
+        plp_profile_started[slot] = 1;
+    }
+}
+
+static inline void plp_profile_accumulate(plp_profile_counters *counters,
+                                          uint32_t cycles,
+                                          uint32_t instr,
+                                          uint32_t ldStall) {
+    counters->calls++;
+    counters->cycles += hal_perf_read(HAL_PERF_CYCLES) - cycles;
+    counters->instr += hal_perf_read(HAL_PERF_INSTR) - instr;
+    counters->ldStall += hal_perf_read(HAL_PERF_LD_STALL) - ldStall;
+}
+
+/* Links the entry into the profile table on its first call. */
+static void plp_profile_register(plp_profile_entry *entry, uint32_t slot) {
+    if (slot != PLP_PROFILE_FC) {
+        hal_team_critical_enter();
+    }
+    if (!entry->registered) {
+        entry->next = plp_profile_head;
+        plp_profile_head = entry;
+        entry->registered = 1;
+    }
+    if (slot != PLP_PROFILE_FC) {
+        hal_team_critical_exit();
+    }
+}
+
+/**
+   @brief      Starts the profiling of a glue function call (used by PLP_PROFILE_FUNCTION).
+   @param[in]  entry  points to the profile entry of the glue function
+   @return     counter values at the beginning of the call
+*/
+
+plp_profile_scope plp_profile_begin(plp_profile_entry *entry) {
+    uint32_t slot = plp_profile_slot();
+    plp_profile_scope scope;
+
+    if (!entry->registered) {
+        plp_profile_register(entry, slot);
+    }
+    plp_profile_start_counters(slot);
+
+    scope.entry = entry;
+    scope.parent = plp_profile_current[slot];
+    plp_profile_current[slot] = entry;
+
+    scope.cycles = hal_perf_read(HAL_PERF_CYCLES);
+    scope.instr = hal_perf_read(HAL_PERF_INSTR);
+    scope.ldStall = hal_perf_read(HAL_PERF_LD_STALL);
+    return scope;
+}
+
+/**
+   @brief      Ends the profiling of a glue function call (used by PLP_PROFILE_FUNCTION).
+   @param[in]  scope  points to the counter values at the beginning of the call
+   @return     none
+*/
+
+void plp_profile_end(plp_profile_scope *scope) {
+    uint32_t slot = plp_profile_slot();
+
+    plp_profile_accumulate(&scope->entry->core[slot], scope->cycles, scope->instr,
+                           scope->ldStall);
+    plp_profile_current[slot] = scope->parent;
+}
+
+static void plp_profile_fork_entry(void *arg) {
+    plp_profile_fork_args *args = (plp_profile_fork_args *)arg;
+    uint32_t core = hal_core_id();
+    uint32_t cycles, instr, ldStall;
+
+    plp_profile_start_counters(core);
+    cycles = hal_perf_read(HAL_PERF_CYCLES);
+    instr = hal_perf_read(HAL_PERF_INSTR);
+    ldStall = hal_perf_read(HAL_PERF_LD_STALL);
+
+    args->entry(args->arg);
+
+    plp_profile_accumulate(&args->profile->fork[core], cycles, instr, ldStall);
+}
+
+/**
+   @brief      Forks the team like hal_cl_team_fork, and records the counters of each core while
+               executing the kernel in the entry of the calling glue function.
+   @param[in]  nb_cores  number of cores
+   @param[in]  entry     kernel executed by each core
+   @param[in]  arg       argument of the kernel
+   @return     none
+*/
+
+void plp_profile_team_fork(int nb_cores, void (*entry)(void *), void *arg) {
+    plp_profile_fork_args args = { entry, arg, plp_profile_current[hal_core_id()] };
+
+    if (args.profile == NULL) {
+        hal_cl_team_fork_direct(nb_cores, entry, arg);
+    } else {
+        hal_cl_team_fork_direct(nb_cores, plp_profile_fork_entry, (void *)&args);
+    }
+}
+
+const plp_profile_entry *plp_profile_first(void) { return plp_profile_head; }
+
+const plp_profile_entry *plp_profile_find(const char *name) {
+    const plp_profile_entry *entry;
+
+    for (entry = plp_profile_head; entry != NULL; entry = entry->next) {
+        if (strcmp(entry->name, name) == 0) {
+            return entry;
+        }
+    }
+    return NULL;
+}
+
+void plp_profile_total(const plp_profile_entry *entry, plp_profile_counters *pRes) {
+    uint32_t i;
+
+    memset(pRes, 0, sizeof(plp_profile_counters));
+    for (i = 0; i <= PLP_PROFILE_NB_CORES; i++) {
+        pRes->calls += entry->core[i].calls;
+        pRes->cycles += entry->core[i].cycles;
+        pRes->instr += entry->core[i].instr;
+        pRes->ldStall += entry->core[i].ldStall;
+    }
+}
+
+void plp_profile_reset(void) {
+    plp_profile_entry *entry;
+
+    for (entry = plp_profile_head; entry != NULL; entry = entry->next) {
+        memset(entry->core, 0, sizeof(entry->core));
+        memset(entry->fork, 0, sizeof(entry->fork));
+    }
+}
+
+/* Prints one line of the table, the 64-bit counters are converted without printf support. */
+static void plp_profile_print_line(const char *name, const plp_profile_counters *counters) {
+    char buf[3][21];
+    uint64_t values[3] = { counters->cycles, counters->instr, counters->ldStall };
+    uint32_t i;
+
+    for (i = 0; i < 3; i++) {
+        char *p = &buf[i][20];
+        *p = '\0';
+        do {
+            *--p = '0' + (values[i] % 10);
+            values[i] /= 10;
+        } while (values[i]);
+        memmove(buf[i], p, &buf[i][21] - p);
+    }
+    printf("%-40s %8u %12s %12s %10s\n", name, (unsigned int)counters->calls, buf[0], buf[1],
+           buf[2]);
+}
+
+void plp_profile_dump(void) {
+    const plp_profile_entry *entry;
+    plp_profile_counters total;
+    char name[16];
+    uint32_t i;
+
+    printf("%-40s %8s %12s %12s %10s\n", "function", "calls", "cycles", "instr", "ld_stall");
+    for (entry = plp_profile_head; entry != NULL; entry = entry->next) {
+        plp_profile_total(entry, &total);
+        plp_profile_print_line(entry->name, &total);
+        for (i = 0; i < PLP_PROFILE_NB_CORES; i++) {
+            if (entry->fork[i].calls) {
+                sprintf(name, "  core %u", (unsigned int)i);
+                plp_profile_print_line(name, &entry->fork[i]);
+            }
+        }
+    }
+}
+
+/**
+  @} end of Profile group
+ */
+
+#endif
@@ -0,0 +1,307 @@
+/* ----------------------------------------------------------------------
+ * Project:      PULP DSP Library
+ * Title:        plp_cfft_bfp_q16p_xpulpv2.c
+ * Description:  Parallel 16-bit block-floating-point complex FFT for XPULPV2
+ *
+ * $Date:        19. Oct 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/*
+ * Parallel version of plp_cfft_bfp_q16s_xpulpv2, with the same scaling and rounding. The
+ * butterflies of each stage are split among the cores, and the maximum magnitudes found by the
+ * cores are combined through pRange, such that all cores apply the same shift to the next stage.
+ */
+
+#define MIN(x, y) (((x) < (y)) ? (x) : (y))
+#define MAX(x, y) (((x) > (y)) ? (x) : (y))
+
+#define PLP_CFFT_BFP_RADIX4_BITS 12
+#define PLP_CFFT_BFP_RADIX2_BITS 13
+
+/* Maximum magnitude of the values in vmax and vmin. */
+static inline int32_t plp_cfft_bfp_range_of(v2s vmax, v2s vmin) {
+    int32_t range = MAX(vmax[0], vmax[1]);
+
+    range = MAX(range, -vmin[0]);
+    return MAX(range, -vmin[1]);
+}
+
+/* Returns the shift such that range >> shift is smaller than 2^bits, negative for a left shift. */
+static inline int32_t plp_cfft_bfp_shift(int32_t range, int32_t bits) {
+    if (range == 0) {
+        return 0;
+    }
+    return (32 - __builtin_clz(range)) - bits;
+}
+
+/* Rounding offset of the shift, the first stage truncates, because it may get full-scale input. */
+static inline v2s plp_cfft_bfp_round(int32_t shift, uint32_t first) {
+    int16_t r = (first || shift == 0) ? 0 : 1 << (shift - 1);
+
+    return __PACK2(r, r);
+}
+
+/* (t.re + j t.im) * (cos - j sin) with rounding, with CoSi = (cos, sin) */
+static inline v2s plp_cfft_bfp_rot(v2s t, v2s CoSi) {
+    return __PACK2((int16_t)(__SUMDOTP2(t, CoSi, 1 << 14) >> 15),
+                   (int16_t)(__SUMDOTP2(__PACK2(t[1], -t[0]), CoSi, 1 << 14) >> 15));
+}
+
+/* Maximum magnitude of the values start <= i < end. */
+static int32_t plp_cfft_bfp_input_range(const v2s *x, uint32_t start, uint32_t end) {
+    v2s vmax = __PACK2(0, 0);
+    v2s vmin = __PACK2(0, 0);
+    uint32_t i;
+
+    for (i = start; i < end; i++) {
+        vmax = __MAX2(vmax, x[i]);
+        vmin = __MIN2(vmin, x[i]);
+    }
+    return plp_cfft_bfp_range_of(vmax, vmin);
+}
+
+/* Radix-2 stage on the butterflies start <= i < end, returns the range of the outputs. */
+static int32_t plp_cfft_bfp_radix2(
+    v2s *x, const int16_t *pCoef, uint32_t N, int32_t shift, uint32_t start, uint32_t end) {
+    uint32_t half = N >> 1;
+    v2s sh = __PACK2(shift, shift);
+    v2s vmax = __PACK2(0, 0);
+    v2s vmin = __PACK2(0, 0);
+    uint32_t i;
+
+    for (i = start; i < end; i++) {
+        v2s a = __SRA2(x[i], sh);
+        v2s b = __SRA2(x[i + half], sh);
+        v2s y0 = __ADD2(a, b);
+        v2s y1 = plp_cfft_bfp_rot(__SUB2(a, b), *(v2s *)&pCoef[2 * i]);
+
+        x[i] = y0;
+        x[i + half] = y1;
+        vmax = __MAX2(vmax, __MAX2(y0, y1));
+        vmin = __MIN2(vmin, __MIN2(y0, y1));
+    }
+    return plp_cfft_bfp_range_of(vmax, vmin);
+}
+
+/* Radix-4 stage on the groups of length L, on the butterflies jStart <= j < jEnd of the groups
+   gStart <= g < gEnd. Returns the range of the outputs. */
+static int32_t plp_cfft_bfp_radix4(v2s *x,
+                                   const int16_t *pCoef,
+                                   uint32_t N,
+                                   uint32_t L,
+                                   int32_t shift,
+                                   v2s rnd,
+                                   uint32_t jStart,
+                                   uint32_t jEnd,
+                                   uint32_t gStart,
+                                   uint32_t gEnd) {
+    uint32_t q = L >> 2;
+    uint32_t twStep = N / L;
+    v2s sh = __PACK2(shift, shift);
+    v2s vmax = __PACK2(0, 0);
+    v2s vmin = __PACK2(0, 0);
+    uint32_t j, g;
+
+    for (j = jStart; j < jEnd; j++) {
+        v2s CoSi1 = *(v2s *)&pCoef[2 * j * twStep];
+        v2s CoSi2 = *(v2s *)&pCoef[4 * j * twStep];
+        v2s CoSi3 = *(v2s *)&pCoef[6 * j * twStep];
+
+        for (g = gStart * L + j; g < gEnd * L; g += L) {
+            v2s a = __SRA2(__ADD2(x[g], rnd), sh);
+            v2s b = __SRA2(__ADD2(x[g + q], rnd), sh);
+            v2s c = __SRA2(__ADD2(x[g + 2 * q], rnd), sh);
+            v2s d = __SRA2(__ADD2(x[g + 3 * q], rnd), sh);
+            v2s apc = __ADD2(a, c);
+            v2s amc = __SUB2(a, c);
+            v2s bpd = __ADD2(b, d);
+            v2s bmd = __SUB2(b, d);
+            /* -j * (b - d) */
+            v2s u = __PACK2(bmd[1], -bmd[0]);
+            v2s y0 = __ADD2(apc, bpd);
+            v2s y1 = plp_cfft_bfp_rot(__ADD2(amc, u), CoSi1);
+            v2s y2 = plp_cfft_bfp_rot(__SUB2(apc, bpd), CoSi2);
+            v2s y3 = plp_cfft_bfp_rot(__SUB2(amc, u), CoSi3);
+
+            x[g] = y0;
+            x[g + q] = y2;
+            x[g + 2 * q] = y1;
+            x[g + 3 * q] = y3;
+            vmax = __MAX2(__MAX2(vmax, __MAX2(y0, y1)), __MAX2(y2, y3));
+            vmin = __MIN2(__MIN2(vmin, __MIN2(y0, y1)), __MIN2(y2, y3));
+        }
+    }
+    return plp_cfft_bfp_range_of(vmax, vmin);
+}
+
+/* Last radix-4 stage (L = 4) without twiddle factors, on the groups gStart <= g < gEnd. */
+static void plp_cfft_bfp_last_radix4(
+    v2s *x, int32_t shift, v2s rnd, uint32_t gStart, uint32_t gEnd) {
+    v2s sh = __PACK2(shift, shift);
+    uint32_t g;
+
+    for (g = 4 * gStart; g < 4 * gEnd; g += 4) {
+        v2s a = __SRA2(__ADD2(x[g], rnd), sh);
+        v2s b = __SRA2(__ADD2(x[g + 1], rnd), sh);
+        v2s c = __SRA2(__ADD2(x[g + 2], rnd), sh);
+        v2s d = __SRA2(__ADD2(x[g + 3], rnd), sh);
+        v2s apc = __ADD2(a, c);
+        v2s amc = __SUB2(a, c);
+        v2s bpd = __ADD2(b, d);
+        v2s bmd = __SUB2(b, d);
+        v2s u = __PACK2(bmd[1], -bmd[0]);
+
+        x[g] = __ADD2(apc, bpd);
+        x[g + 1] = __SUB2(apc, bpd);
+        x[g + 2] = __ADD2(amc, u);
+        x[g + 3] = __SUB2(amc, u);
+    }
+}
+
+/* Combines the ranges of all cores. The two halves of pRange are used alternately, such that a
+   core can not overwrite the range of a stage which is still read by the other cores. */
+static int32_t plp_cfft_bfp_reduce(
+    int32_t *pRange, int32_t range, uint32_t stage, uint32_t core_id, uint32_t nPE) {
+    int32_t *pSlot = &pRange[(stage & 1) * nPE];
+    uint32_t i;
+
+    pSlot[core_id] = range;
+    hal_team_barrier();
+    for (i = 0; i < nPE; i++) {
+        range = MAX(range, pSlot[i]);
+    }
+    return range;
+}
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup fft
+ * @{
+ */
+
+/**
+ * @brief      Parallel block-floating-point quantized 16 bit complex fast fourier transform for
+ *             XPULPV2
+ * @param[in]   args    points to the plp_cfft_bfp_instance_q16_parallel
+ * @return      none
+ */
+
+void plp_cfft_bfp_q16p_xpulpv2(void *args) {
+
+    plp_cfft_bfp_instance_q16_parallel *a = (plp_cfft_bfp_instance_q16_parallel *)args;
+    const plp_cfft_instance_q16 *S = a->S;
+    uint32_t nPE = a->nPE;
+    uint32_t core_id = hal_core_id() % nPE;
+
+    uint32_t N = S->fftLen;
+    const int16_t *pCoef = S->pTwiddle;
+    v2s *x = (v2s *)a->p1;
+    uint32_t radix2 = __builtin_ctz(N) & 1;
+    uint32_t chunk = (N + nPE - 1) / nPE;
+    uint32_t start = MIN(core_id * chunk, N);
+    uint32_t end = MIN(start + chunk, N);
+    uint32_t stage = 0;
+    int32_t range = plp_cfft_bfp_reduce(a->pRange, plp_cfft_bfp_input_range(x, start, end),
+                                        stage++, core_id, nPE);
+    int32_t shift = plp_cfft_bfp_shift(
+        range, radix2 ? PLP_CFFT_BFP_RADIX2_BITS : PLP_CFFT_BFP_RADIX4_BITS);
+    int32_t exponent = 0;
+    uint32_t first = 1;
+    uint32_t L = N;
+
+    /* small inputs are shifted left to use the headroom of the first stage */
+    if (shift < 0) {
+        v2s sh = __PACK2(-shift, -shift);
+        uint32_t i;
+
+        for (i = start; i < end; i++) {
+            x[i] = __SLL2(x[i], sh);
+        }
+        exponent = shift;
+        shift = 0;
+        hal_team_barrier();
+    }
+
+    if (radix2) {
+        chunk = ((N >> 1) + nPE - 1) / nPE;
+        start = MIN(core_id * chunk, N >> 1);
+        end = MIN(start + chunk, N >> 1);
+        range = plp_cfft_bfp_reduce(a->pRange, plp_cfft_bfp_radix2(x, pCoef, N, shift, start, end),
+                                    stage++, core_id, nPE);
+        exponent += shift;
+        first = 0;
+        L = N >> 1;
+    }
+
+    for (; L >= 4; L >>= 2) {
+        uint32_t q = L >> 2;
+        uint32_t nGroups = N / L;
+        v2s rnd;
+
+        if (!first) {
+            shift = MAX(plp_cfft_bfp_shift(range, PLP_CFFT_BFP_RADIX4_BITS), 0);
+        }
+        rnd = plp_cfft_bfp_round(shift, first);
+
+        if (L == 4) {
+            chunk = (nGroups + nPE - 1) / nPE;
+            start = MIN(core_id * chunk, nGroups);
+            plp_cfft_bfp_last_radix4(x, shift, rnd, start, MIN(start + chunk, nGroups));
+            hal_team_barrier();
+        } else {
+            if (q >= nPE) {
+                chunk = (q + nPE - 1) / nPE;
+                start = MIN(core_id * chunk, q);
+                range = plp_cfft_bfp_radix4(x, pCoef, N, L, shift, rnd, start,
+                                            MIN(start + chunk, q), 0, nGroups);
+            } else {
+                chunk = (nGroups + nPE - 1) / nPE;
+                start = MIN(core_id * chunk, nGroups);
+                range = plp_cfft_bfp_radix4(x, pCoef, N, L, shift, rnd, 0, q, start,
+                                            MIN(start + chunk, nGroups));
+            }
+            range = plp_cfft_bfp_reduce(a->pRange, range, stage++, core_id, nPE);
+        }
+        exponent += shift;
+        first = 0;
+    }
+
+    if (a->bitReverseFlag) {
+        plp_bitreversal_16p_xpulpv2((uint16_t *)a->p1, S->bitRevLength,
+                                    (const uint16_t *)S->pBitRevTable, nPE);
+        hal_team_barrier();
+    }
+
+    if (core_id == 0) {
+        *a->pExponent = exponent;
+    }
+}
+
+/**
+ * @} end of FFT group
+ */
@@ -0,0 +1,209 @@
+/* ----------------------------------------------------------------------
+ * Project:      PULP DSP Library
+ * Title:        plp_cfft_bfp_q16s_rv32im.c
+ * Description:  16-bit block-floating-point complex FFT for RV32IM
+ *
+ * $Date:        19. Oct 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/*
+ * Scalar version of plp_cfft_bfp_q16s_xpulpv2, with the same scaling and rounding, see
+ * plp_cfft_bfp_q16s_xpulpv2.c.
+ */
+
+#define MAX(x, y) (((x) > (y)) ? (x) : (y))
+
+#define PLP_CFFT_BFP_RADIX4_BITS 12
+#define PLP_CFFT_BFP_RADIX2_BITS 13
+
+/* Returns the shift such that range >> shift is smaller than 2^bits, negative for a left shift. */
+static inline int32_t plp_cfft_bfp_shift(int32_t range, int32_t bits) {
+    if (range == 0) {
+        return 0;
+    }
+    return (32 - __builtin_clz(range)) - bits;
+}
+
+/* Complex value as two int16, shifted right with rounding (not in the first stage). */
+typedef struct {
+    int16_t re;
+    int16_t im;
+} plp_cfft_bfp_cplx;
+
+static inline plp_cfft_bfp_cplx plp_cfft_bfp_load(const int16_t *p, int32_t shift, int32_t rnd) {
+    plp_cfft_bfp_cplx v;
+
+    v.re = (int16_t)(p[0] + rnd) >> shift;
+    v.im = (int16_t)(p[1] + rnd) >> shift;
+    return v;
+}
+
+/* Stores (t.re + j t.im) * (cos - j sin) with rounding, and updates the range. */
+static inline int32_t plp_cfft_bfp_store_rot(
+    int16_t *p, int16_t tRe, int16_t tIm, const int16_t *CoSi, int32_t range) {
+    p[0] = (int16_t)((tRe * CoSi[0] + tIm * CoSi[1] + (1 << 14)) >> 15);
+    p[1] = (int16_t)((tIm * CoSi[0] - tRe * CoSi[1] + (1 << 14)) >> 15);
+    range = MAX(range, MAX(p[0], -p[0]));
+    return MAX(range, MAX(p[1], -p[1]));
+}
+
+static inline int32_t plp_cfft_bfp_store(int16_t *p, int16_t re, int16_t im, int32_t range) {
+    p[0] = re;
+    p[1] = im;
+    range = MAX(range, MAX(re, -re));
+    return MAX(range, MAX(im, -im));
+}
+
+static int32_t plp_cfft_bfp_radix2(int16_t *x, const int16_t *pCoef, uint32_t N, int32_t shift) {
+    uint32_t half = N >> 1;
+    int32_t range = 0;
+    uint32_t i;
+
+    for (i = 0; i < half; i++) {
+        plp_cfft_bfp_cplx a = plp_cfft_bfp_load(&x[2 * i], shift, 0);
+        plp_cfft_bfp_cplx b = plp_cfft_bfp_load(&x[2 * (i + half)], shift, 0);
+
+        range = plp_cfft_bfp_store(&x[2 * i], a.re + b.re, a.im + b.im, range);
+        range = plp_cfft_bfp_store_rot(&x[2 * (i + half)], a.re - b.re, a.im - b.im,
+                                       &pCoef[2 * i], range);
+    }
+    return range;
+}
+
+/* Radix-4 stage on the groups of length L, with twiddle factors if L > 4, the outputs 1 and 2 are
+   swapped. Returns the range of the outputs. */
+static int32_t plp_cfft_bfp_radix4(
+    int16_t *x, const int16_t *pCoef, uint32_t N, uint32_t L, int32_t shift, int32_t rnd) {
+    uint32_t q = L >> 2;
+    uint32_t twStep = N / L;
+    int32_t range = 0;
+    uint32_t j, g;
+
+    for (j = 0; j < q; j++) {
+        for (g = j; g < N; g += L) {
+            plp_cfft_bfp_cplx a = plp_cfft_bfp_load(&x[2 * g], shift, rnd);
+            plp_cfft_bfp_cplx b = plp_cfft_bfp_load(&x[2 * (g + q)], shift, rnd);
+            plp_cfft_bfp_cplx c = plp_cfft_bfp_load(&x[2 * (g + 2 * q)], shift, rnd);
+            plp_cfft_bfp_cplx d = plp_cfft_bfp_load(&x[2 * (g + 3 * q)], shift, rnd);
+            int16_t apcRe = a.re + c.re, apcIm = a.im + c.im;
+            int16_t amcRe = a.re - c.re, amcIm = a.im - c.im;
+            int16_t bpdRe = b.re + d.re, bpdIm = b.im + d.im;
+            int16_t bmdRe = b.re - d.re, bmdIm = b.im - d.im;
+
+            range = plp_cfft_bfp_store(&x[2 * g], apcRe + bpdRe, apcIm + bpdIm, range);
+            if (L > 4) {
+                range = plp_cfft_bfp_store_rot(&x[2 * (g + q)], apcRe - bpdRe, apcIm - bpdIm,
+                                               &pCoef[4 * j * twStep], range);
+                range = plp_cfft_bfp_store_rot(&x[2 * (g + 2 * q)], amcRe + bmdIm, amcIm - bmdRe,
+                                               &pCoef[2 * j * twStep], range);
+                range = plp_cfft_bfp_store_rot(&x[2 * (g + 3 * q)], amcRe - bmdIm, amcIm + bmdRe,
+                                               &pCoef[6 * j * twStep], range);
+            } else {
+                range = plp_cfft_bfp_store(&x[2 * (g + 1)], apcRe - bpdRe, apcIm - bpdIm, range);
+                range = plp_cfft_bfp_store(&x[2 * (g + 2)], amcRe + bmdIm, amcIm - bmdRe, range);
+                range = plp_cfft_bfp_store(&x[2 * (g + 3)], amcRe - bmdIm, amcIm + bmdRe, range);
+            }
+        }
+    }
+    return range;
+}
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup fft
+ * @{
+ */
+
+/**
+ * @brief      Block-floating-point quantized 16 bit complex fast fourier transform for RV32IM
+ * @param[in]     S               points to an instance of the 16bit quantized CFFT structure
+ * @param[in,out] p1              points to the complex data buffer of size <code>2*fftLen</code>.
+ * Processing occurs in-place.
+ * @param[in]     bitReverseFlag  flag that enables (bitReverseFlag=1) of disables
+ * (bitReverseFlag=0) bit reversal of output.
+ * @param[out]    pExponent       points to the exponent of the output block
+ * @return        none
+ */
+
+void plp_cfft_bfp_q16s_rv32im(const plp_cfft_instance_q16 *S,
+                              int16_t *p1,
+                              uint8_t bitReverseFlag,
+                              int32_t *pExponent) {
+
+    uint32_t N = S->fftLen;
+    uint32_t radix2 = __builtin_ctz(N) & 1;
+    int32_t range = 0;
+    int32_t shift, exponent = 0;
+    uint32_t first = 1;
+    uint32_t L = N;
+    uint32_t i;
+
+    for (i = 0; i < 2 * N; i++) {
+        range = MAX(range, MAX(p1[i], -p1[i]));
+    }
+    shift = plp_cfft_bfp_shift(range,
+                               radix2 ? PLP_CFFT_BFP_RADIX2_BITS : PLP_CFFT_BFP_RADIX4_BITS);
+
+    /* small inputs are shifted left to use the headroom of the first stage */
+    if (shift < 0) {
+        for (i = 0; i < 2 * N; i++) {
+            p1[i] = p1[i] << -shift;
+        }
+        exponent = shift;
+        shift = 0;
+    }
+
+    if (radix2) {
+        range = plp_cfft_bfp_radix2(p1, S->pTwiddle, N, shift);
+        exponent += shift;
+        first = 0;
+        L = N >> 1;
+    }
+
+    for (; L >= 4; L >>= 2) {
+        int32_t rnd;
+
+        if (!first) {
+            shift = MAX(plp_cfft_bfp_shift(range, PLP_CFFT_BFP_RADIX4_BITS), 0);
+        }
+        rnd = (first || shift == 0) ? 0 : 1 << (shift - 1);
+        range = plp_cfft_bfp_radix4(p1, S->pTwiddle, N, L, shift, rnd);
+        exponent += shift;
+        first = 0;
+    }
+
+    if (bitReverseFlag)
+        plp_bitreversal_16s_rv32im((uint16_t *)p1, S->bitRevLength,
+                                   (const uint16_t *)S->pBitRevTable);
+
+    *pExponent = exponent;
+}
+
+/**
+ * @} end of FFT group
+ */
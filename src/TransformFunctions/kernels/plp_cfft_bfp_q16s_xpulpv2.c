@@ -0,0 +1,257 @@
+/* ----------------------------------------------------------------------
+ * Project:      PULP DSP Library
+ * Title:        plp_cfft_bfp_q16s_xpulpv2.c
+ * Description:  16-bit block-floating-point complex FFT for XPULPV2
+ *
+ * $Date:        19. Oct 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/*
+ * Block-floating-point radix-4 CFFT (decimation in frequency, in-place, bit reversed output like
+ * plp_cfft_q16s_xpulpv2, with a radix-2 first stage if log2(fftLen) is odd).
+ *
+ * Instead of scaling down every stage by its radix, each butterfly stage tracks the maximum
+ * magnitude of its outputs. The next stage shifts its inputs right only by as many bits as needed
+ * to keep them below 2^12 (2^13 for the radix-2 stage), which guarantees that the butterfly and
+ * the twiddle multiplication cannot overflow. Inputs with a small amplitude are first shifted left
+ * to use this headroom. The sum of all shifts is returned as the exponent of the block.
+ */
+
+#define MAX(x, y) (((x) > (y)) ? (x) : (y))
+
+#define PLP_CFFT_BFP_RADIX4_BITS 12
+#define PLP_CFFT_BFP_RADIX2_BITS 13
+
+/* Maximum magnitude of the values in vmax and vmin. */
+static inline int32_t plp_cfft_bfp_range_of(v2s vmax, v2s vmin) {
+    int32_t range = MAX(vmax[0], vmax[1]);
+
+    range = MAX(range, -vmin[0]);
+    return MAX(range, -vmin[1]);
+}
+
+/* Returns the shift such that range >> shift is smaller than 2^bits, negative for a left shift. */
+static inline int32_t plp_cfft_bfp_shift(int32_t range, int32_t bits) {
+    if (range == 0) {
+        return 0;
+    }
+    return (32 - __builtin_clz(range)) - bits;
+}
+
+/* Rounding offset of the shift, the first stage truncates, because it may get full-scale input. */
+static inline v2s plp_cfft_bfp_round(int32_t shift, uint32_t first) {
+    int16_t r = (first || shift == 0) ? 0 : 1 << (shift - 1);
+
+    return __PACK2(r, r);
+}
+
+/* (t.re + j t.im) * (cos - j sin) with rounding, with CoSi = (cos, sin) */
+static inline v2s plp_cfft_bfp_rot(v2s t, v2s CoSi) {
+    return __PACK2((int16_t)(__SUMDOTP2(t, CoSi, 1 << 14) >> 15),
+                   (int16_t)(__SUMDOTP2(__PACK2(t[1], -t[0]), CoSi, 1 << 14) >> 15));
+}
+
+static int32_t plp_cfft_bfp_input_range(const v2s *x, uint32_t N) {
+    v2s vmax = __PACK2(0, 0);
+    v2s vmin = __PACK2(0, 0);
+    uint32_t i;
+
+    for (i = 0; i < N; i++) {
+        vmax = __MAX2(vmax, x[i]);
+        vmin = __MIN2(vmin, x[i]);
+    }
+    return plp_cfft_bfp_range_of(vmax, vmin);
+}
+
+/* Radix-2 stage on the whole sequence, returns the range of the outputs. */
+static int32_t plp_cfft_bfp_radix2(v2s *x, const int16_t *pCoef, uint32_t N, int32_t shift) {
+    uint32_t half = N >> 1;
+    v2s sh = __PACK2(shift, shift);
+    v2s vmax = __PACK2(0, 0);
+    v2s vmin = __PACK2(0, 0);
+    uint32_t i;
+
+    for (i = 0; i < half; i++) {
+        v2s a = __SRA2(x[i], sh);
+        v2s b = __SRA2(x[i + half], sh);
+        v2s y0 = __ADD2(a, b);
+        v2s y1 = plp_cfft_bfp_rot(__SUB2(a, b), *(v2s *)&pCoef[2 * i]);
+
+        x[i] = y0;
+        x[i + half] = y1;
+        vmax = __MAX2(vmax, __MAX2(y0, y1));
+        vmin = __MIN2(vmin, __MIN2(y0, y1));
+    }
+    return plp_cfft_bfp_range_of(vmax, vmin);
+}
+
+/* Radix-4 stage on the groups of length L, returns the range of the outputs. The outputs 1 and 2
+   are swapped, such that the result is in bit reversed order. */
+static int32_t plp_cfft_bfp_radix4(v2s *x,
+                                   const int16_t *pCoef,
+                                   uint32_t N,
+                                   uint32_t L,
+                                   int32_t shift,
+                                   v2s rnd) {
+    uint32_t q = L >> 2;
+    uint32_t twStep = N / L;
+    v2s sh = __PACK2(shift, shift);
+    v2s vmax = __PACK2(0, 0);
+    v2s vmin = __PACK2(0, 0);
+    uint32_t j, g;
+
+    for (j = 0; j < q; j++) {
+        v2s CoSi1 = *(v2s *)&pCoef[2 * j * twStep];
+        v2s CoSi2 = *(v2s *)&pCoef[4 * j * twStep];
+        v2s CoSi3 = *(v2s *)&pCoef[6 * j * twStep];
+
+        for (g = j; g < N; g += L) {
+            v2s a = __SRA2(__ADD2(x[g], rnd), sh);
+            v2s b = __SRA2(__ADD2(x[g + q], rnd), sh);
+            v2s c = __SRA2(__ADD2(x[g + 2 * q], rnd), sh);
+            v2s d = __SRA2(__ADD2(x[g + 3 * q], rnd), sh);
+            v2s apc = __ADD2(a, c);
+            v2s amc = __SUB2(a, c);
+            v2s bpd = __ADD2(b, d);
+            v2s bmd = __SUB2(b, d);
+            /* -j * (b - d) */
+            v2s u = __PACK2(bmd[1], -bmd[0]);
+            v2s y0 = __ADD2(apc, bpd);
+            v2s y1 = plp_cfft_bfp_rot(__ADD2(amc, u), CoSi1);
+            v2s y2 = plp_cfft_bfp_rot(__SUB2(apc, bpd), CoSi2);
+            v2s y3 = plp_cfft_bfp_rot(__SUB2(amc, u), CoSi3);
+
+            x[g] = y0;
+            x[g + q] = y2;
+            x[g + 2 * q] = y1;
+            x[g + 3 * q] = y3;
+            vmax = __MAX2(__MAX2(vmax, __MAX2(y0, y1)), __MAX2(y2, y3));
+            vmin = __MIN2(__MIN2(vmin, __MIN2(y0, y1)), __MIN2(y2, y3));
+        }
+    }
+    return plp_cfft_bfp_range_of(vmax, vmin);
+}
+
+/* Last radix-4 stage (L = 4) without twiddle factors. */
+static void plp_cfft_bfp_last_radix4(v2s *x, uint32_t N, int32_t shift, v2s rnd) {
+    v2s sh = __PACK2(shift, shift);
+    uint32_t g;
+
+    for (g = 0; g < N; g += 4) {
+        v2s a = __SRA2(__ADD2(x[g], rnd), sh);
+        v2s b = __SRA2(__ADD2(x[g + 1], rnd), sh);
+        v2s c = __SRA2(__ADD2(x[g + 2], rnd), sh);
+        v2s d = __SRA2(__ADD2(x[g + 3], rnd), sh);
+        v2s apc = __ADD2(a, c);
+        v2s amc = __SUB2(a, c);
+        v2s bpd = __ADD2(b, d);
+        v2s bmd = __SUB2(b, d);
+        v2s u = __PACK2(bmd[1], -bmd[0]);
+
+        x[g] = __ADD2(apc, bpd);
+        x[g + 1] = __SUB2(apc, bpd);
+        x[g + 2] = __ADD2(amc, u);
+        x[g + 3] = __SUB2(amc, u);
+    }
+}
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup fft
+ * @{
+ */
+
+/**
+ * @brief      Block-floating-point quantized 16 bit complex fast fourier transform for XPULPV2
+ * @param[in]     S               points to an instance of the 16bit quantized CFFT structure
+ * @param[in,out] p1              points to the complex data buffer of size <code>2*fftLen</code>.
+ * Processing occurs in-place.
+ * @param[in]     bitReverseFlag  flag that enables (bitReverseFlag=1) of disables
+ * (bitReverseFlag=0) bit reversal of output.
+ * @param[out]    pExponent       points to the exponent of the output block
+ * @return        none
+ */
+
+void plp_cfft_bfp_q16s_xpulpv2(const plp_cfft_instance_q16 *S,
+                               int16_t *p1,
+                               uint8_t bitReverseFlag,
+                               int32_t *pExponent) {
+
+    uint32_t N = S->fftLen;
+    const int16_t *pCoef = S->pTwiddle;
+    v2s *x = (v2s *)p1;
+    uint32_t radix2 = __builtin_ctz(N) & 1;
+    int32_t range = plp_cfft_bfp_input_range(x, N);
+    int32_t shift = plp_cfft_bfp_shift(
+        range, radix2 ? PLP_CFFT_BFP_RADIX2_BITS : PLP_CFFT_BFP_RADIX4_BITS);
+    int32_t exponent = 0;
+    uint32_t first = 1;
+    uint32_t L = N;
+
+    /* small inputs are shifted left to use the headroom of the first stage */
+    if (shift < 0) {
+        v2s sh = __PACK2(-shift, -shift);
+        uint32_t i;
+
+        for (i = 0; i < N; i++) {
+            x[i] = __SLL2(x[i], sh);
+        }
+        exponent = shift;
+        shift = 0;
+    }
+
+    if (radix2) {
+        range = plp_cfft_bfp_radix2(x, pCoef, N, shift);
+        exponent += shift;
+        first = 0;
+        L = N >> 1;
+    }
+
+    for (; L >= 4; L >>= 2) {
+        if (!first) {
+            shift = MAX(plp_cfft_bfp_shift(range, PLP_CFFT_BFP_RADIX4_BITS), 0);
+        }
+        if (L > 4) {
+            range = plp_cfft_bfp_radix4(x, pCoef, N, L, shift, plp_cfft_bfp_round(shift, first));
+        } else {
+            plp_cfft_bfp_last_radix4(x, N, shift, plp_cfft_bfp_round(shift, first));
+        }
+        exponent += shift;
+        first = 0;
+    }
+
+    if (bitReverseFlag)
+        plp_bitreversal_16s_xpulpv2((uint16_t *)p1, S->bitRevLength,
+                                    (const uint16_t *)S->pBitRevTable);
+
+    *pExponent = exponent;
+}
+
+/**
+ * @} end of FFT group
+ */
@@ -29,6 +29,7 @@
  */
 
 #include "plp_math.h"
+#include "plp_tuning.h"
 
 static HAL_CL_L1 float32_t ROT_CONST = 0.707106781f;
 
@@ -83,6 +84,17 @@ static void plp_cfft_radix2_f32_xpulpv2_parallel(plp_fft_instance_f32_parallel *
 static void plp_cfft_radix4_f32_xpulpv2_parallel(plp_fft_instance_f32_parallel *arg);
 static void plp_cfft_radix8_f32_xpulpv2_parallel(plp_fft_instance_f32_parallel *arg);
 
+/* Returns the radix to use for the given FFT length. The tuned radix (see plp_tuning.h) is only used
+   if the number of stages is a multiple of its order, radix-2 works for every power of two. */
+static inline uint32_t plp_cfft_f32_radix(uint32_t radix, uint32_t FFTLength) {
+    uint32_t log2FFTLen = __builtin_ctz(FFTLength);
+
+    if ((radix == 8 && log2FFTLen % 3 == 0) || (radix == 4 && log2FFTLen % 2 == 0)) {
+        return radix;
+    }
+    return 2;
+}
+
 /**
   @ingroup fft
  */
@@ -94,7 +106,8 @@ static void plp_cfft_radix8_f32_xpulpv2_parallel(plp_fft_instance_f32_parallel *
   buffer must contain at least (2*FFTLen) float32 values, corresponding to
   FFTLen complex values in the form (real part, complex part).
   Input and output can refer to the same memory location (in-place computation).
-  The best algorithm is executed based on the val FFTLen.
+  The best algorithm is executed based on the val FFTLen, as selected by the
+  size-dispatch table in plp_tuning.h (generated by test/mrWolf/tune.py).
   Supported algorithms: radix-2, radix-4, radix-8
 */
 
@@ -113,19 +126,14 @@ static void plp_cfft_radix8_f32_xpulpv2_parallel(plp_fft_instance_f32_parallel *
 void plp_cfft_f32_xpulpv2(const plp_fft_instance_f32 *S,
                           const float32_t *pSrc,
                           float32_t *pDst) {
-    switch(S->FFTLength) {
-      case 64:
-      case 512:
+    switch (plp_cfft_f32_radix(PLP_TUNE_CFFT_F32_RADIX(S->FFTLength), S->FFTLength)) {
+      case 8:
           plp_cfft_radix8_f32_xpulpv2(S, pSrc, pDst);
           break;
-      case 16:
-      case 256:
-      case 1024:
+      case 4:
           plp_cfft_radix4_f32_xpulpv2(S, pSrc, pDst);
           break;
-      case 32:
-      case 128:
-      case 2048:
+      default:
           plp_cfft_radix2_f32_xpulpv2(S, pSrc, pDst);
           break;
     }
@@ -429,19 +437,15 @@ static void plp_cfft_radix8_f32_xpulpv2(const plp_fft_instance_f32 *S,
    @return      none
 */
 void plp_cfft_f32_xpulpv2_parallel(plp_fft_instance_f32_parallel *arg) {
-    switch(arg->S->FFTLength) {
-      case 64:
-      case 512:
+    switch (plp_cfft_f32_radix(PLP_TUNE_CFFT_F32_PARALLEL_RADIX(arg->S->FFTLength),
+                               arg->S->FFTLength)) {
+      case 8:
           plp_cfft_radix8_f32_xpulpv2_parallel(arg);
           break;
-      case 16:
-      case 256:
-      case 1024:
+      case 4:
           plp_cfft_radix4_f32_xpulpv2_parallel(arg);
           break;
-      case 32:
-      case 128:
-      case 2048:
+      default:
           plp_cfft_radix2_f32_xpulpv2_parallel(arg);
           break;
     }
@@ -502,6 +506,16 @@ void plp_cfft_radix2_f32_xpulpv2_parallel(plp_fft_instance_f32_parallel *arg) {
     while (dist > 1) {
         hal_team_barrier();
         step = dist << 1;
+        if (butt < nPE) {
+            // less groups than cores (e.g. FFTLength == 32 && nPE == 8): distribute all the
+            // butterflies of the stage
+            for (k = core_id; k < nbutterfly; k += nPE) {
+                j = k / dist;
+                d = k % dist;
+                process_butterfly_radix2((Complex_type_f32 *)pDst, (Complex_type_f32 *)pDst, butt * d,
+                                         j * step + d, dist, _tw_ptr);
+            }
+        }
         for (j = 0; j < butt / nPE; j++) {
             _in_ptr = _in_ptr = (Complex_type_f32 *)pDst;
             ;
@@ -633,6 +647,16 @@ void plp_cfft_radix4_f32_xpulpv2_parallel(plp_fft_instance_f32_parallel *arg) {
     while (dist > 1) {
         hal_team_barrier();
         step = dist << 2;
+        if (butt < nPE) {
+            // less groups than cores (e.g. FFTLength == 64 && nPE == 8): distribute all the
+            // butterflies of the stage
+            for (k = core_id; k < nbutterfly; k += nPE) {
+                j = k / dist;
+                d = k % dist;
+                process_butterfly_radix4((Complex_type_f32 *)pDst, (Complex_type_f32 *)pDst, butt * d,
+                                         j * step + d, dist, _tw_ptr);
+            }
+        }
         for (j = 0; j < butt / nPE; j++) {
             _in_ptr = (Complex_type_f32 *)pDst;
             for (d = 0; d < dist; d++) {
@@ -0,0 +1,303 @@
+/* ----------------------------------------------------------------------
+ * Project:      PULP DSP Library
+ * Title:        plp_cfft_stockham_f32_xpulpv2.c
+ * Description:  Floating-point Stockham (self-sorting) complex FFT for XPULPV2
+ *
+ * $Date:        19. Oct 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+#define MIN(x, y) (((x) < (y)) ? (x) : (y))
+
+/*
+ * Stockham autosort FFT (decimation in frequency). Every stage reads the sequence from one buffer
+ * and writes it to the other one in an order such that the output of the last stage is already in
+ * natural order, no bit reversal is needed. With n = N / s the length of the sub-transforms and
+ * m = n / 4, a radix-4 stage computes for all 0 <= p < m and 0 <= q < s:
+ *
+ *   a = x[q + s*p], b = x[q + s*(p+m)], c = x[q + s*(p+2m)], d = x[q + s*(p+3m)]
+ *   y[q + s*(4p)]   =            (a + c) +   (b + d)
+ *   y[q + s*(4p+1)] = W^(ps)   * ((a - c) - j*(b - d))
+ *   y[q + s*(4p+2)] = W^(2ps)  * ((a + c) -   (b + d))
+ *   y[q + s*(4p+3)] = W^(3ps)  * ((a - c) + j*(b - d))
+ *
+ * with W = exp(-2*pi*j/N), and then s = 4s. If log2(N) is odd, the last stage is a radix-2 stage
+ * (n = 2, without twiddles).
+ */
+
+/* Twiddle factor W^k for 0 <= k < 3N/4, the table only holds the first N/2 factors. */
+static inline Complex_type_f32 plp_stockham_twiddle_f32(const Complex_type_f32 *pTw,
+                                                        uint32_t k,
+                                                        uint32_t halfLen) {
+    Complex_type_f32 w;
+
+    if (k < halfLen) {
+        return pTw[k];
+    }
+    w.re = -pTw[k - halfLen].re;
+    w.im = -pTw[k - halfLen].im;
+    return w;
+}
+
+static inline Complex_type_f32 plp_stockham_mul_f32(Complex_type_f32 A, Complex_type_f32 B) {
+    Complex_type_f32 result;
+
+    result.re = A.re * B.re - A.im * B.im;
+    result.im = A.re * B.im + A.im * B.re;
+    return result;
+}
+
+/* Radix-4 stage on the butterflies pStart <= p < pEnd and qStart <= q < qEnd. */
+static void plp_stockham_radix4_f32(const Complex_type_f32 *x,
+                                    Complex_type_f32 *y,
+                                    const Complex_type_f32 *pTw,
+                                    uint32_t halfLen,
+                                    uint32_t m,
+                                    uint32_t s,
+                                    uint32_t pStart,
+                                    uint32_t pEnd,
+                                    uint32_t qStart,
+                                    uint32_t qEnd) {
+    uint32_t p, q;
+    uint32_t ms = m * s;
+
+    for (p = pStart; p < pEnd; p++) {
+        Complex_type_f32 w1 = plp_stockham_twiddle_f32(pTw, p * s, halfLen);
+        Complex_type_f32 w2 = plp_stockham_twiddle_f32(pTw, 2 * p * s, halfLen);
+        Complex_type_f32 w3 = plp_stockham_twiddle_f32(pTw, 3 * p * s, halfLen);
+        const Complex_type_f32 *px = &x[s * p];
+        Complex_type_f32 *py = &y[4 * s * p];
+
+        for (q = qStart; q < qEnd; q++) {
+            Complex_type_f32 a = px[q];
+            Complex_type_f32 b = px[q + ms];
+            Complex_type_f32 c = px[q + 2 * ms];
+            Complex_type_f32 d = px[q + 3 * ms];
+            Complex_type_f32 apc, amc, bpd, bmd, t;
+
+            apc.re = a.re + c.re;
+            apc.im = a.im + c.im;
+            amc.re = a.re - c.re;
+            amc.im = a.im - c.im;
+            bpd.re = b.re + d.re;
+            bpd.im = b.im + d.im;
+            bmd.re = b.re - d.re;
+            bmd.im = b.im - d.im;
+
+            py[q].re = apc.re + bpd.re;
+            py[q].im = apc.im + bpd.im;
+
+            t.re = amc.re + bmd.im;
+            t.im = amc.im - bmd.re;
+            py[q + s] = plp_stockham_mul_f32(t, w1);
+
+            t.re = apc.re - bpd.re;
+            t.im = apc.im - bpd.im;
+            py[q + 2 * s] = plp_stockham_mul_f32(t, w2);
+
+            t.re = amc.re - bmd.im;
+            t.im = amc.im + bmd.re;
+            py[q + 3 * s] = plp_stockham_mul_f32(t, w3);
+        }
+    }
+}
+
+/* Last radix-4 stage (m = 1), all twiddle factors are 1. */
+static void plp_stockham_last_radix4_f32(const Complex_type_f32 *x,
+                                         Complex_type_f32 *y,
+                                         uint32_t s,
+                                         uint32_t qStart,
+                                         uint32_t qEnd) {
+    uint32_t q;
+
+    for (q = qStart; q < qEnd; q++) {
+        Complex_type_f32 a = x[q];
+        Complex_type_f32 b = x[q + s];
+        Complex_type_f32 c = x[q + 2 * s];
+        Complex_type_f32 d = x[q + 3 * s];
+        float32_t apcRe = a.re + c.re, apcIm = a.im + c.im;
+        float32_t amcRe = a.re - c.re, amcIm = a.im - c.im;
+        float32_t bpdRe = b.re + d.re, bpdIm = b.im + d.im;
+        float32_t bmdRe = b.re - d.re, bmdIm = b.im - d.im;
+
+        y[q].re = apcRe + bpdRe;
+        y[q].im = apcIm + bpdIm;
+        y[q + s].re = amcRe + bmdIm;
+        y[q + s].im = amcIm - bmdRe;
+        y[q + 2 * s].re = apcRe - bpdRe;
+        y[q + 2 * s].im = apcIm - bpdIm;
+        y[q + 3 * s].re = amcRe - bmdIm;
+        y[q + 3 * s].im = amcIm + bmdRe;
+    }
+}
+
+/* Last radix-2 stage (n = 2), all twiddle factors are 1. */
+static void plp_stockham_last_radix2_f32(const Complex_type_f32 *x,
+                                         Complex_type_f32 *y,
+                                         uint32_t s,
+                                         uint32_t qStart,
+                                         uint32_t qEnd) {
+    uint32_t q;
+
+    for (q = qStart; q < qEnd; q++) {
+        Complex_type_f32 a = x[q];
+        Complex_type_f32 b = x[q + s];
+
+        y[q].re = a.re + b.re;
+        y[q].im = a.im + b.im;
+        y[q + s].re = a.re - b.re;
+        y[q + s].im = a.im - b.im;
+    }
+}
+
+/* Returns the buffer written by the first stage, such that the last stage writes to pDst. */
+static inline Complex_type_f32 *plp_stockham_first_dst_f32(uint32_t FFTLength,
+                                                           Complex_type_f32 *pBuf,
+                                                           Complex_type_f32 *pDst) {
+    uint32_t log2Len = __builtin_ctz(FFTLength);
+    uint32_t nStages = (log2Len == 0) ? 1 : (log2Len + 1) >> 1;
+
+    return (nStages & 1) ? pDst : pBuf;
+}
+
+/**
+  @ingroup fft
+ */
+
+/**
+  @addtogroup complexFFTKernels
+  @{
+ */
+
+/**
+   @brief  Floating-point Stockham FFT on complex input data for XPULPV2 extension.
+   @param[in]   S       points to an instance of the floating-point FFT structure
+   @param[in]   pSrc    points to the input buffer (complex data), it is not modified
+   @param[in]   pBuf    points to a temporary buffer of 2*FFTLength values
+   @param[out]  pDst    points to the output buffer (complex data, natural order)
+   @return      none
+*/
+
+void plp_cfft_stockham_f32_xpulpv2(const plp_fft_instance_f32 *S,
+                                   const float32_t *__restrict__ pSrc,
+                                   float32_t *__restrict__ pBuf,
+                                   float32_t *__restrict__ pDst) {
+
+    uint32_t N = S->FFTLength;
+    uint32_t halfLen = N >> 1;
+    const Complex_type_f32 *pTw = (const Complex_type_f32 *)S->pTwiddleFactors;
+    const Complex_type_f32 *x = (const Complex_type_f32 *)pSrc;
+    Complex_type_f32 *y =
+        plp_stockham_first_dst_f32(N, (Complex_type_f32 *)pBuf, (Complex_type_f32 *)pDst);
+    Complex_type_f32 *other = (y == (Complex_type_f32 *)pDst) ? (Complex_type_f32 *)pBuf
+                                                               : (Complex_type_f32 *)pDst;
+    uint32_t n = N;
+    uint32_t s = 1;
+
+    while (n > 4) {
+        uint32_t m = n >> 2;
+
+        plp_stockham_radix4_f32(x, y, pTw, halfLen, m, s, 0, m, 0, s);
+
+        x = y;
+        y = other;
+        other = (Complex_type_f32 *)x;
+        n = m;
+        s <<= 2;
+    }
+
+    if (n == 4) {
+        plp_stockham_last_radix4_f32(x, y, s, 0, s);
+    } else if (n == 2) {
+        plp_stockham_last_radix2_f32(x, y, s, 0, s);
+    } else {
+        /* N = 1 */
+        y[0] = x[0];
+    }
+}
+
+/**
+   @brief  Floating-point Stockham FFT on complex input data for XPULPV2 extension (parallel
+           version). The butterflies of each stage are split among the cores, along the
+           sub-transforms in the first stages and along the stride in the last stages.
+   @param[in]   arg       points to an instance of plp_fft_stockham_instance_f32_parallel
+   @return      none
+*/
+
+void plp_cfft_stockham_f32p_xpulpv2(void *arg) {
+
+    plp_fft_stockham_instance_f32_parallel *a = (plp_fft_stockham_instance_f32_parallel *)arg;
+    const plp_fft_instance_f32 *S = a->S;
+    uint32_t nPE = a->nPE;
+    uint32_t core_id = hal_core_id() % nPE;
+
+    uint32_t N = S->FFTLength;
+    uint32_t halfLen = N >> 1;
+    const Complex_type_f32 *pTw = (const Complex_type_f32 *)S->pTwiddleFactors;
+    const Complex_type_f32 *x = (const Complex_type_f32 *)a->pSrc;
+    Complex_type_f32 *y = plp_stockham_first_dst_f32(N, (Complex_type_f32 *)a->pBuf,
+                                                     (Complex_type_f32 *)a->pDst);
+    Complex_type_f32 *other = (y == (Complex_type_f32 *)a->pDst) ? (Complex_type_f32 *)a->pBuf
+                                                                  : (Complex_type_f32 *)a->pDst;
+    uint32_t n = N;
+    uint32_t s = 1;
+    uint32_t chunk;
+
+    while (n > 4) {
+        uint32_t m = n >> 2;
+
+        if (m >= nPE) {
+            chunk = (m + nPE - 1) / nPE;
+            plp_stockham_radix4_f32(x, y, pTw, halfLen, m, s, MIN(core_id * chunk, m),
+                                    MIN((core_id + 1) * chunk, m), 0, s);
+        } else {
+            chunk = (s + nPE - 1) / nPE;
+            plp_stockham_radix4_f32(x, y, pTw, halfLen, m, s, 0, m, MIN(core_id * chunk, s),
+                                    MIN((core_id + 1) * chunk, s));
+        }
+        hal_team_barrier();
+
+        x = y;
+        y = other;
+        other = (Complex_type_f32 *)x;
+        n = m;
+        s <<= 2;
+    }
+
+    chunk = (s + nPE - 1) / nPE;
+    if (n == 4) {
+        plp_stockham_last_radix4_f32(x, y, s, MIN(core_id * chunk, s),
+                                     MIN((core_id + 1) * chunk, s));
+    } else if (n == 2) {
+        plp_stockham_last_radix2_f32(x, y, s, MIN(core_id * chunk, s),
+                                     MIN((core_id + 1) * chunk, s));
+    } else if (core_id == 0) {
+        y[0] = x[0];
+    }
+    hal_team_barrier();
+}
+
+/**
+  @} end of complexFFTKernels group
+ */
@@ -0,0 +1,273 @@
+/* ----------------------------------------------------------------------
+ * Project:      PULP DSP Library
+ * Title:        plp_cfft_stockham_q16_xpulpv2.c
+ * Description:  16-bit fixed-point Stockham (self-sorting) complex FFT for XPULPV2
+ *
+ * $Date:        19. Oct 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+#define MIN(x, y) (((x) < (y)) ? (x) : (y))
+
+/*
+ * Stockham autosort FFT on Q1.15 data, see plp_cfft_stockham_f32_xpulpv2.c for the index scheme.
+ * Like plp_cfft_q16, the output is the spectrum divided by the FFT length. The inputs of each stage
+ * are shifted right before the butterfly: the first stage by one bit more than its radix, such that
+ * the twiddle multiplications of the middle stages never overflow, and the last stage (without
+ * twiddle factors) by one bit less to compensate. The shifts of all but the first stage are
+ * rounded, the truncation bias would otherwise accumulate in the bins close to DC. The first stage
+ * truncates, because adding the rounding offset to a full-scale input would overflow.
+ */
+
+/* Returns the right shift applied to the inputs of a stage. */
+static inline uint32_t plp_stockham_shift_q16(uint32_t log2Radix, uint32_t first, uint32_t last) {
+    if (first && last) {
+        return log2Radix;
+    }
+    if (first) {
+        return log2Radix + 1;
+    }
+    if (last) {
+        return log2Radix - 1;
+    }
+    return log2Radix;
+}
+
+/* Returns the rounding offset added before the shift of a stage. */
+static inline v2s plp_stockham_round_q16(uint32_t shift, uint32_t first) {
+    int16_t r = (first || shift == 0) ? 0 : 1 << (shift - 1);
+
+    return __PACK2(r, r);
+}
+
+/* (t.re + j t.im) * (cos - j sin) with rounding, with CoSi = (cos, sin). The twiddle table
+   contains -32768, so t is rotated instead of negating the sine. */
+static inline v2s plp_stockham_rot_q16(v2s t, v2s CoSi) {
+    return __PACK2((int16_t)(__SUMDOTP2(t, CoSi, 1 << 14) >> 15),
+                   (int16_t)(__SUMDOTP2(__PACK2(t[1], -t[0]), CoSi, 1 << 14) >> 15));
+}
+
+/* Radix-4 stage on the butterflies pStart <= p < pEnd and qStart <= q < qEnd. */
+static void plp_stockham_radix4_q16(const v2s *x,
+                                    v2s *y,
+                                    const int16_t *pCoef,
+                                    uint32_t m,
+                                    uint32_t s,
+                                    uint32_t shift,
+                                    uint32_t pStart,
+                                    uint32_t pEnd,
+                                    uint32_t qStart,
+                                    uint32_t qEnd) {
+    uint32_t p, q;
+    uint32_t ms = m * s;
+    v2s sh = __PACK2(shift, shift);
+    v2s rnd = plp_stockham_round_q16(shift, s == 1);
+
+    for (p = pStart; p < pEnd; p++) {
+        v2s CoSi1 = *(v2s *)&pCoef[2 * p * s];
+        v2s CoSi2 = *(v2s *)&pCoef[4 * p * s];
+        v2s CoSi3 = *(v2s *)&pCoef[6 * p * s];
+        const v2s *px = &x[s * p];
+        v2s *py = &y[4 * s * p];
+
+        for (q = qStart; q < qEnd; q++) {
+            v2s a = __SRA2(__ADD2(px[q], rnd), sh);
+            v2s b = __SRA2(__ADD2(px[q + ms], rnd), sh);
+            v2s c = __SRA2(__ADD2(px[q + 2 * ms], rnd), sh);
+            v2s d = __SRA2(__ADD2(px[q + 3 * ms], rnd), sh);
+            v2s apc = __ADD2(a, c);
+            v2s amc = __SUB2(a, c);
+            v2s bpd = __ADD2(b, d);
+            v2s bmd = __SUB2(b, d);
+            /* -j * (b - d) */
+            v2s u = __PACK2(bmd[1], -bmd[0]);
+
+            py[q] = __ADD2(apc, bpd);
+            py[q + s] = plp_stockham_rot_q16(__ADD2(amc, u), CoSi1);
+            py[q + 2 * s] = plp_stockham_rot_q16(__SUB2(apc, bpd), CoSi2);
+            py[q + 3 * s] = plp_stockham_rot_q16(__SUB2(amc, u), CoSi3);
+        }
+    }
+}
+
+/* Last radix-4 stage (m = 1), all twiddle factors are 1. */
+static void plp_stockham_last_radix4_q16(
+    const v2s *x, v2s *y, uint32_t s, uint32_t shift, uint32_t qStart, uint32_t qEnd) {
+    uint32_t q;
+    v2s sh = __PACK2(shift, shift);
+    v2s rnd = plp_stockham_round_q16(shift, s == 1);
+
+    for (q = qStart; q < qEnd; q++) {
+        v2s a = __SRA2(__ADD2(x[q], rnd), sh);
+        v2s b = __SRA2(__ADD2(x[q + s], rnd), sh);
+        v2s c = __SRA2(__ADD2(x[q + 2 * s], rnd), sh);
+        v2s d = __SRA2(__ADD2(x[q + 3 * s], rnd), sh);
+        v2s apc = __ADD2(a, c);
+        v2s amc = __SUB2(a, c);
+        v2s bpd = __ADD2(b, d);
+        v2s bmd = __SUB2(b, d);
+        v2s u = __PACK2(bmd[1], -bmd[0]);
+
+        y[q] = __ADD2(apc, bpd);
+        y[q + s] = __ADD2(amc, u);
+        y[q + 2 * s] = __SUB2(apc, bpd);
+        y[q + 3 * s] = __SUB2(amc, u);
+    }
+}
+
+/* Last radix-2 stage (n = 2), all twiddle factors are 1. */
+static void plp_stockham_last_radix2_q16(
+    const v2s *x, v2s *y, uint32_t s, uint32_t shift, uint32_t qStart, uint32_t qEnd) {
+    uint32_t q;
+    v2s sh = __PACK2(shift, shift);
+    v2s rnd = plp_stockham_round_q16(shift, s == 1);
+
+    for (q = qStart; q < qEnd; q++) {
+        v2s a = __SRA2(__ADD2(x[q], rnd), sh);
+        v2s b = __SRA2(__ADD2(x[q + s], rnd), sh);
+
+        y[q] = __ADD2(a, b);
+        y[q + s] = __SUB2(a, b);
+    }
+}
+
+/* Returns the buffer written by the first stage, such that the last stage writes to pDst. */
+static inline v2s *plp_stockham_first_dst_q16(uint32_t fftLen, v2s *pBuf, v2s *pDst) {
+    uint32_t log2Len = __builtin_ctz(fftLen);
+    uint32_t nStages = (log2Len + 1) >> 1;
+
+    return (nStages & 1) ? pDst : pBuf;
+}
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup fft
+ * @{
+ */
+
+/**
+ * @brief      Quantized 16 bit Stockham complex fast fourier transform for XPULPV2
+ * @param[in]  S       points to an instance of the 16bit quantized CFFT structure
+ * @param[in]  pSrc    points to the input buffer of size <code>2*fftLen</code>, it is not modified
+ * @param[in]  pBuf    points to a temporary buffer of size <code>2*fftLen</code>
+ * @param[out] pDst    points to the output buffer of size <code>2*fftLen</code>, in natural order
+ * @return     none
+ */
+
+void plp_cfft_stockham_q16s_xpulpv2(const plp_cfft_instance_q16 *S,
+                                    const int16_t *__restrict__ pSrc,
+                                    int16_t *__restrict__ pBuf,
+                                    int16_t *__restrict__ pDst) {
+
+    uint32_t N = S->fftLen;
+    const int16_t *pCoef = S->pTwiddle;
+    const v2s *x = (const v2s *)pSrc;
+    v2s *y = plp_stockham_first_dst_q16(N, (v2s *)pBuf, (v2s *)pDst);
+    v2s *other = (y == (v2s *)pDst) ? (v2s *)pBuf : (v2s *)pDst;
+    uint32_t n = N;
+    uint32_t s = 1;
+
+    while (n > 4) {
+        uint32_t m = n >> 2;
+
+        plp_stockham_radix4_q16(x, y, pCoef, m, s, plp_stockham_shift_q16(2, s == 1, 0), 0, m,
+                                0, s);
+
+        x = y;
+        y = other;
+        other = (v2s *)x;
+        n = m;
+        s <<= 2;
+    }
+
+    if (n == 4) {
+        plp_stockham_last_radix4_q16(x, y, s, plp_stockham_shift_q16(2, s == 1, 1), 0, s);
+    } else {
+        plp_stockham_last_radix2_q16(x, y, s, plp_stockham_shift_q16(1, s == 1, 1), 0, s);
+    }
+}
+
+/**
+ * @brief      Parallel quantized 16 bit Stockham complex fast fourier transform for XPULPV2. The
+ *             butterflies of each stage are split among the cores, along the sub-transforms in the
+ *             first stages and along the stride in the last stages.
+ * @param[in]  args    points to the plp_cfft_stockham_instance_q16_parallel
+ * @return     none
+ */
+
+void plp_cfft_stockham_q16p_xpulpv2(void *args) {
+
+    plp_cfft_stockham_instance_q16_parallel *a = (plp_cfft_stockham_instance_q16_parallel *)args;
+    const plp_cfft_instance_q16 *S = a->S;
+    uint32_t nPE = a->nPE;
+    uint32_t core_id = hal_core_id() % nPE;
+
+    uint32_t N = S->fftLen;
+    const int16_t *pCoef = S->pTwiddle;
+    const v2s *x = (const v2s *)a->pSrc;
+    v2s *y = plp_stockham_first_dst_q16(N, (v2s *)a->pBuf, (v2s *)a->pDst);
+    v2s *other = (y == (v2s *)a->pDst) ? (v2s *)a->pBuf : (v2s *)a->pDst;
+    uint32_t n = N;
+    uint32_t s = 1;
+    uint32_t chunk, shift;
+
+    while (n > 4) {
+        uint32_t m = n >> 2;
+
+        shift = plp_stockham_shift_q16(2, s == 1, 0);
+        if (m >= nPE) {
+            chunk = (m + nPE - 1) / nPE;
+            plp_stockham_radix4_q16(x, y, pCoef, m, s, shift, MIN(core_id * chunk, m),
+                                    MIN((core_id + 1) * chunk, m), 0, s);
+        } else {
+            chunk = (s + nPE - 1) / nPE;
+            plp_stockham_radix4_q16(x, y, pCoef, m, s, shift, 0, m, MIN(core_id * chunk, s),
+                                    MIN((core_id + 1) * chunk, s));
+        }
+        hal_team_barrier();
+
+        x = y;
+        y = other;
+        other = (v2s *)x;
+        n = m;
+        s <<= 2;
+    }
+
+    chunk = (s + nPE - 1) / nPE;
+    if (n == 4) {
+        plp_stockham_last_radix4_q16(x, y, s, plp_stockham_shift_q16(2, s == 1, 1),
+                                     MIN(core_id * chunk, s), MIN((core_id + 1) * chunk, s));
+    } else {
+        plp_stockham_last_radix2_q16(x, y, s, plp_stockham_shift_q16(1, s == 1, 1),
+                                     MIN(core_id * chunk, s), MIN((core_id + 1) * chunk, s));
+    }
+    hal_team_barrier();
+}
+
+/**
+ * @} end of FFT group
+ */
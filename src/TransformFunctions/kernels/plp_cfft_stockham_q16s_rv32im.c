@@ -0,0 +1,188 @@
+/* ----------------------------------------------------------------------
+ * Project:      PULP DSP Library
+ * Title:        plp_cfft_stockham_q16s_rv32im.c
+ * Description:  16-bit fixed-point Stockham (self-sorting) complex FFT for RV32IM
+ *
+ * $Date:        19. Oct 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/*
+ * Scalar version of plp_cfft_stockham_q16s_xpulpv2, with the same scaling and rounding, see
+ * plp_cfft_stockham_q16_xpulpv2.c.
+ */
+
+static inline uint32_t plp_stockham_shift_q16(uint32_t log2Radix, uint32_t first, uint32_t last) {
+    if (first && last) {
+        return log2Radix;
+    }
+    if (first) {
+        return log2Radix + 1;
+    }
+    if (last) {
+        return log2Radix - 1;
+    }
+    return log2Radix;
+}
+
+/* Rounded right shift, the first stage truncates. */
+static inline int16_t plp_stockham_scale_q16(int16_t x, uint32_t shift, uint32_t first) {
+    int32_t r = (first || shift == 0) ? 0 : 1 << (shift - 1);
+
+    return (int16_t)(x + r) >> shift;
+}
+
+/* Radix-4 stage, with twiddles if m > 1. */
+static void plp_stockham_radix4_q16_rv32im(const int16_t *x,
+                                           int16_t *y,
+                                           const int16_t *pCoef,
+                                           uint32_t m,
+                                           uint32_t s,
+                                           uint32_t shift) {
+    uint32_t p, q, k;
+    uint32_t ms = m * s;
+
+    for (p = 0; p < m; p++) {
+        const int16_t *px = &x[2 * s * p];
+        int16_t *py = &y[8 * s * p];
+
+        for (q = 0; q < s; q++) {
+            int16_t v[8];
+            int16_t apcRe, apcIm, amcRe, amcIm, bpdRe, bpdIm, bmdRe, bmdIm;
+            int16_t tRe[3], tIm[3];
+
+            /* a, b, c, d */
+            for (k = 0; k < 4; k++) {
+                v[2 * k] = plp_stockham_scale_q16(px[2 * (q + k * ms)], shift, s == 1);
+                v[2 * k + 1] = plp_stockham_scale_q16(px[2 * (q + k * ms) + 1], shift, s == 1);
+            }
+            apcRe = v[0] + v[4];
+            apcIm = v[1] + v[5];
+            amcRe = v[0] - v[4];
+            amcIm = v[1] - v[5];
+            bpdRe = v[2] + v[6];
+            bpdIm = v[3] + v[7];
+            bmdRe = v[2] - v[6];
+            bmdIm = v[3] - v[7];
+
+            py[2 * q] = apcRe + bpdRe;
+            py[2 * q + 1] = apcIm + bpdIm;
+
+            tRe[0] = amcRe + bmdIm;
+            tIm[0] = amcIm - bmdRe;
+            tRe[1] = apcRe - bpdRe;
+            tIm[1] = apcIm - bpdIm;
+            tRe[2] = amcRe - bmdIm;
+            tIm[2] = amcIm + bmdRe;
+
+            for (k = 0; k < 3; k++) {
+                int16_t *out = &py[2 * (q + (k + 1) * s)];
+
+                if (m > 1) {
+                    int32_t co = pCoef[2 * (k + 1) * p * s];
+                    int32_t si = pCoef[2 * (k + 1) * p * s + 1];
+
+                    out[0] = (int16_t)((tRe[k] * co + tIm[k] * si + (1 << 14)) >> 15);
+                    out[1] = (int16_t)((tIm[k] * co - tRe[k] * si + (1 << 14)) >> 15);
+                } else {
+                    out[0] = tRe[k];
+                    out[1] = tIm[k];
+                }
+            }
+        }
+    }
+}
+
+/* Last radix-2 stage (n = 2), all twiddle factors are 1. */
+static void plp_stockham_last_radix2_q16_rv32im(const int16_t *x,
+                                                int16_t *y,
+                                                uint32_t s,
+                                                uint32_t shift) {
+    uint32_t q;
+
+    for (q = 0; q < s; q++) {
+        int16_t aRe = plp_stockham_scale_q16(x[2 * q], shift, s == 1);
+        int16_t aIm = plp_stockham_scale_q16(x[2 * q + 1], shift, s == 1);
+        int16_t bRe = plp_stockham_scale_q16(x[2 * (q + s)], shift, s == 1);
+        int16_t bIm = plp_stockham_scale_q16(x[2 * (q + s) + 1], shift, s == 1);
+
+        y[2 * q] = aRe + bRe;
+        y[2 * q + 1] = aIm + bIm;
+        y[2 * (q + s)] = aRe - bRe;
+        y[2 * (q + s) + 1] = aIm - bIm;
+    }
+}
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup fft
+ * @{
+ */
+
+/**
+ * @brief      Quantized 16 bit Stockham complex fast fourier transform for RV32IM
+ * @param[in]  S       points to an instance of the 16bit quantized CFFT structure
+ * @param[in]  pSrc    points to the input buffer of size <code>2*fftLen</code>, it is not modified
+ * @param[in]  pBuf    points to a temporary buffer of size <code>2*fftLen</code>
+ * @param[out] pDst    points to the output buffer of size <code>2*fftLen</code>, in natural order
+ * @return     none
+ */
+
+void plp_cfft_stockham_q16s_rv32im(const plp_cfft_instance_q16 *S,
+                                   const int16_t *__restrict__ pSrc,
+                                   int16_t *__restrict__ pBuf,
+                                   int16_t *__restrict__ pDst) {
+
+    uint32_t N = S->fftLen;
+    uint32_t nStages = (__builtin_ctz(N) + 1) >> 1;
+    const int16_t *x = pSrc;
+    int16_t *y = (nStages & 1) ? pDst : pBuf;
+    int16_t *other = (nStages & 1) ? pBuf : pDst;
+    uint32_t n = N;
+    uint32_t s = 1;
+
+    while (n >= 4) {
+        uint32_t m = n >> 2;
+
+        plp_stockham_radix4_q16_rv32im(x, y, S->pTwiddle, m, s,
+                                       plp_stockham_shift_q16(2, s == 1, m == 1));
+
+        x = y;
+        y = other;
+        other = (int16_t *)x;
+        n = m;
+        s <<= 2;
+    }
+
+    if (n == 2) {
+        plp_stockham_last_radix2_q16_rv32im(x, y, s, plp_stockham_shift_q16(1, s == 1, 1));
+    }
+}
+
+/**
+ * @} end of FFT group
+ */
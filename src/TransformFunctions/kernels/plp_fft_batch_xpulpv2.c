@@ -0,0 +1,239 @@
+/* ----------------------------------------------------------------------
+ * Project:      PULP DSP Library
+ * Title:        plp_fft_batch_xpulpv2.c
+ * Description:  Batched FFTs for XPULPV2, one transform per core
+ *
+ * $Date:        19. Oct 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup fft
+ * @{
+ */
+
+/* Computes one transform of the batch from pSrc into pDst (pSrc == pDst for in-place FFTs). */
+typedef void (*plp_fft_batch_frame)(const plp_fft_batch_instance *a, void *pSrc, void *pDst);
+
+/*
+ * Distributes the transforms round-robin over the cores, without any barrier.
+ *
+ * With an L1 buffer, each core owns three slots of its part of the buffer, and each slot holds
+ * one input frame (followed by one output frame, unless the transform is in-place). While frame i
+ * is transformed, the DMA fetches frame i+1 and writes back frame i-1. Before fetching frame i+1
+ * into the slot of frame i-2, the write-back of frame i-2 must be complete.
+ */
+static void plp_fft_batch_run(const plp_fft_batch_instance *a,
+                              plp_fft_batch_frame frame,
+                              uint32_t size,
+                              uint32_t srcLen,
+                              uint32_t dstLen,
+                              int inPlace) {
+    uint32_t core_id = hal_core_id();
+    uint32_t nPE = a->nPE;
+    const uint8_t *pSrc = (const uint8_t *)a->pSrc;
+    uint8_t *pDst = (uint8_t *)a->pDst;
+    uint32_t srcStride = a->srcStride * size;
+    uint32_t dstStride = a->dstStride * size;
+    uint32_t srcBytes = srcLen * size;
+    uint32_t dstBytes = dstLen * size;
+    uint32_t slotBytes, n, i, t;
+    uint8_t *pSlots, *pIn, *pOut;
+    hal_cl_dma_cmd_t cmdIn, cmdOut[2];
+    uint8_t outPending[2] = { 0, 0 };
+
+    if (a->pBuf == NULL) {
+        for (t = core_id; t < a->count; t += nPE) {
+            frame(a, (void *)(pSrc + t * srcStride), pDst + t * dstStride);
+        }
+        return;
+    }
+
+    if (core_id >= a->count) {
+        return;
+    }
+
+    n = (a->count - core_id + nPE - 1) / nPE;
+    slotBytes = inPlace ? srcBytes : srcBytes + dstBytes;
+    pSlots = (uint8_t *)a->pBuf + core_id * 3 * slotBytes;
+
+    hal_cl_dma_cmd((uint32_t)(pSrc + core_id * srcStride), (uint32_t)pSlots, srcBytes,
+                   HAL_CL_DMA_DIR_EXT2LOC, 0, &cmdIn);
+
+    for (i = 0, t = core_id; i < n; i++, t += nPE) {
+        pIn = pSlots + (i % 3) * slotBytes;
+        pOut = inPlace ? pIn : pIn + srcBytes;
+
+        hal_cl_dma_cmd_wait(&cmdIn);
+
+        // the write-back of frame i-2 uses cmdOut[i & 1] and the slot of frame i+1
+        if (outPending[i & 1]) {
+            hal_cl_dma_cmd_wait(&cmdOut[i & 1]);
+            outPending[i & 1] = 0;
+        }
+        if (i + 1 < n) {
+            hal_cl_dma_cmd((uint32_t)(pSrc + (t + nPE) * srcStride),
+                           (uint32_t)(pSlots + ((i + 1) % 3) * slotBytes), srcBytes,
+                           HAL_CL_DMA_DIR_EXT2LOC, 0, &cmdIn);
+        }
+
+        frame(a, pIn, pOut);
+
+        hal_cl_dma_cmd((uint32_t)(pDst + t * dstStride), (uint32_t)pOut, dstBytes,
+                       HAL_CL_DMA_DIR_LOC2EXT, 0, &cmdOut[i & 1]);
+        outPending[i & 1] = 1;
+    }
+
+    for (i = 0; i < 2; i++) {
+        if (outPending[i]) {
+            hal_cl_dma_cmd_wait(&cmdOut[i]);
+        }
+    }
+}
+
+static void plp_cfft_batch_f32_frame(const plp_fft_batch_instance *a, void *pSrc, void *pDst) {
+    plp_cfft_f32_xpulpv2((const plp_fft_instance_f32 *)a->S, (const float32_t *)pSrc,
+                         (float32_t *)pDst);
+}
+
+static void plp_cfft_batch_q16_frame(const plp_fft_batch_instance *a, void *pSrc, void *pDst) {
+    plp_cfft_q16s_xpulpv2((const plp_cfft_instance_q16 *)a->S, (int16_t *)pDst, a->ifftFlag,
+                          a->bitReverseFlag, a->fracBits);
+}
+
+static void plp_cfft_batch_q32_frame(const plp_fft_batch_instance *a, void *pSrc, void *pDst) {
+    plp_cfft_q32s_xpulpv2((const plp_cfft_instance_q32 *)a->S, (int32_t *)pDst, a->ifftFlag,
+                          a->bitReverseFlag, a->fracBits);
+}
+
+/* plp_rfft_f32_xpulpv2 computes the bins 0 .. FFTLength / 2, the others follow from
+   X[N - k] = conj(X[k]). This holds only for the bins in natural order (bitReverseFlag = 1),
+   otherwise the output is left in bit-reversed order as plp_rfft_f32 returns it. */
+static void plp_rfft_batch_f32_frame(const plp_fft_batch_instance *a, void *pSrc, void *pDst) {
+    const plp_fft_instance_f32 *S = (const plp_fft_instance_f32 *)a->S;
+    uint32_t N = S->FFTLength;
+    float32_t *pOut = (float32_t *)pDst;
+    uint32_t k;
+
+    plp_rfft_f32_xpulpv2(S, (const float32_t *)pSrc, pOut);
+
+    if (!S->bitReverseFlag) {
+        return;
+    }
+
+    for (k = 1; k < N / 2; k++) {
+        pOut[2 * (N - k)] = pOut[2 * k];
+        pOut[2 * (N - k) + 1] = -pOut[2 * k + 1];
+    }
+}
+
+static void plp_rfft_batch_q16_frame(const plp_fft_batch_instance *a, void *pSrc, void *pDst) {
+    plp_rfft_q16s_xpulpv2((const plp_rfft_instance_q16 *)a->S, (const int16_t *)pSrc,
+                          (int16_t *)pDst);
+}
+
+static void plp_rfft_batch_q32_frame(const plp_fft_batch_instance *a, void *pSrc, void *pDst) {
+    plp_rfft_q32s_xpulpv2((const plp_rfft_instance_q32 *)a->S, (const int32_t *)pSrc,
+                          (int32_t *)pDst);
+}
+
+/**
+   @brief      Batched floating-point complex FFTs for XPULPV2, one transform per core
+   @param[in]  args  points to the plp_fft_batch_instance
+   @return     none
+*/
+void plp_cfft_batch_f32p_xpulpv2(void *args) {
+    plp_fft_batch_instance *a = (plp_fft_batch_instance *)args;
+    uint32_t len = 2 * ((const plp_fft_instance_f32 *)a->S)->FFTLength;
+
+    plp_fft_batch_run(a, plp_cfft_batch_f32_frame, sizeof(float32_t), len, len, 0);
+}
+
+/**
+   @brief      Batched 16-bit fixed-point complex FFTs for XPULPV2, one transform per core
+   @param[in]  args  points to the plp_fft_batch_instance
+   @return     none
+*/
+void plp_cfft_batch_q16p_xpulpv2(void *args) {
+    plp_fft_batch_instance *a = (plp_fft_batch_instance *)args;
+    uint32_t len = 2 * ((const plp_cfft_instance_q16 *)a->S)->fftLen;
+
+    plp_fft_batch_run(a, plp_cfft_batch_q16_frame, sizeof(int16_t), len, len, 1);
+}
+
+/**
+   @brief      Batched 32-bit fixed-point complex FFTs for XPULPV2, one transform per core
+   @param[in]  args  points to the plp_fft_batch_instance
+   @return     none
+*/
+void plp_cfft_batch_q32p_xpulpv2(void *args) {
+    plp_fft_batch_instance *a = (plp_fft_batch_instance *)args;
+    uint32_t len = 2 * ((const plp_cfft_instance_q32 *)a->S)->fftLen;
+
+    plp_fft_batch_run(a, plp_cfft_batch_q32_frame, sizeof(int32_t), len, len, 1);
+}
+
+/**
+   @brief      Batched floating-point real FFTs for XPULPV2, one transform per core
+   @param[in]  args  points to the plp_fft_batch_instance
+   @return     none
+*/
+void plp_rfft_batch_f32p_xpulpv2(void *args) {
+    plp_fft_batch_instance *a = (plp_fft_batch_instance *)args;
+    uint32_t len = ((const plp_fft_instance_f32 *)a->S)->FFTLength;
+
+    plp_fft_batch_run(a, plp_rfft_batch_f32_frame, sizeof(float32_t), len, 2 * len, 0);
+}
+
+/**
+   @brief      Batched 16-bit fixed-point real FFTs for XPULPV2, one transform per core
+   @param[in]  args  points to the plp_fft_batch_instance
+   @return     none
+*/
+void plp_rfft_batch_q16p_xpulpv2(void *args) {
+    plp_fft_batch_instance *a = (plp_fft_batch_instance *)args;
+    uint32_t len = ((const plp_rfft_instance_q16 *)a->S)->fftLenReal;
+
+    plp_fft_batch_run(a, plp_rfft_batch_q16_frame, sizeof(int16_t), len, len + 2, 0);
+}
+
+/**
+   @brief      Batched 32-bit fixed-point real FFTs for XPULPV2, one transform per core
+   @param[in]  args  points to the plp_fft_batch_instance
+   @return     none
+*/
+void plp_rfft_batch_q32p_xpulpv2(void *args) {
+    plp_fft_batch_instance *a = (plp_fft_batch_instance *)args;
+    uint32_t len = ((const plp_rfft_instance_q32 *)a->S)->fftLenReal;
+
+    plp_fft_batch_run(a, plp_rfft_batch_q32_frame, sizeof(int32_t), len, len + 2, 0);
+}
+
+/**
+ * @} end of FFT group
+ */
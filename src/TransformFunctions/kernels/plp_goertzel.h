@@ -0,0 +1,221 @@
+/* ----------------------------------------------------------------------
+ * Project:      PULP DSP Library
+ * Title:        plp_goertzel.h
+ * Description:  Goertzel recursions of one and two frequency bins
+ *
+ * $Date:        19. Oct 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __PLP_GOERTZEL_H__
+#define __PLP_GOERTZEL_H__
+
+#include "plp_math.h"
+
+/*
+ * All kernels run the recursion s[n] = x[n] + 2 cos(w) s[n-1] - s[n-2] over the block of N
+ * samples, and compute the bin as X = (cos(w) s[N-1] - s[N-2]) + j sin(w) s[N-1]. This is the
+ * output of one more step with x[N] = 0, i.e. sum_n x[n] e^(-j w (n - N)), which is the DFT bin k
+ * for w = 2 pi k / N.
+ */
+
+/*
+ * Product of the fix-point coefficient c with the state s, rounded by frac bits. The state needs
+ * more than 16 bits, hence the 64-bit product.
+ */
+static inline int32_t plp_goertzel_mul(int32_t c, int32_t s, uint32_t frac) {
+    return (int32_t)(((int64_t)c * s + (1 << (frac - 1))) >> frac);
+}
+
+/*
+ * Goertzel recursion of one bin over the block. c and s are the cosine and sine of the frequency.
+ * Stores the real and imaginary part of the bin.
+ */
+static inline void plp_goertzel_bin_f32(const float32_t *__restrict__ pSrc,
+                                        uint32_t blockSize,
+                                        float32_t c,
+                                        float32_t s,
+                                        float32_t *__restrict__ pDst) {
+    float32_t c2 = 2.0f * c;
+    float32_t s1 = 0.0f;
+    float32_t s2 = 0.0f;
+    uint32_t n;
+
+    for (n = 0; n < blockSize; n++) {
+        float32_t s0 = pSrc[n] + c2 * s1 - s2;
+        s2 = s1;
+        s1 = s0;
+    }
+    pDst[0] = c * s1 - s2;
+    pDst[1] = s * s1;
+}
+
+/*
+ * Goertzel recursions of the two bins (ca, sa) and (cb, sb), which share the loads of the samples
+ * and hide the latency of each other.
+ */
+static inline void plp_goertzel_bin2_f32(const float32_t *__restrict__ pSrc,
+                                         uint32_t blockSize,
+                                         float32_t ca,
+                                         float32_t sa,
+                                         float32_t cb,
+                                         float32_t sb,
+                                         float32_t *__restrict__ pDstA,
+                                         float32_t *__restrict__ pDstB) {
+    float32_t ca2 = 2.0f * ca;
+    float32_t cb2 = 2.0f * cb;
+    float32_t a1 = 0.0f;
+    float32_t a2 = 0.0f;
+    float32_t b1 = 0.0f;
+    float32_t b2 = 0.0f;
+    uint32_t n;
+
+    for (n = 0; n < blockSize; n++) {
+        float32_t x = pSrc[n];
+        float32_t a0 = x + ca2 * a1 - a2;
+        float32_t b0 = x + cb2 * b1 - b2;
+        a2 = a1;
+        a1 = a0;
+        b2 = b1;
+        b1 = b0;
+    }
+    pDstA[0] = ca * a1 - a2;
+    pDstA[1] = sa * a1;
+    pDstB[0] = cb * b1 - b2;
+    pDstB[1] = sb * b1;
+}
+
+/*
+ * Goertzel recursion of one bin over the block of Q1.15 samples, scaled by 2^-shift. c and s are
+ * the cosine and sine of the frequency in Q2.30. Stores the real and imaginary part of the bin.
+ */
+static inline void plp_goertzel_bin_q16(const int16_t *__restrict__ pSrc,
+                                        uint32_t blockSize,
+                                        uint32_t shift,
+                                        int32_t c,
+                                        int32_t s,
+                                        int32_t *__restrict__ pDst) {
+    int32_t s1 = 0;
+    int32_t s2 = 0;
+    uint32_t n;
+
+    for (n = 0; n < blockSize; n++) {
+        int32_t s0 = (pSrc[n] >> shift) + plp_goertzel_mul(c, s1, 29) - s2;
+        s2 = s1;
+        s1 = s0;
+    }
+    pDst[0] = plp_goertzel_mul(c, s1, 30) - s2;
+    pDst[1] = plp_goertzel_mul(s, s1, 30);
+}
+
+/*
+ * Goertzel recursions of the two bins (ca, sa) and (cb, sb), which share the loads of the samples
+ * and hide the latency of each other.
+ */
+static inline void plp_goertzel_bin2_q16(const int16_t *__restrict__ pSrc,
+                                         uint32_t blockSize,
+                                         uint32_t shift,
+                                         int32_t ca,
+                                         int32_t sa,
+                                         int32_t cb,
+                                         int32_t sb,
+                                         int32_t *__restrict__ pDstA,
+                                         int32_t *__restrict__ pDstB) {
+    int32_t a1 = 0;
+    int32_t a2 = 0;
+    int32_t b1 = 0;
+    int32_t b2 = 0;
+    uint32_t n;
+
+    for (n = 0; n < blockSize; n++) {
+        int32_t x = pSrc[n] >> shift;
+        int32_t a0 = x + plp_goertzel_mul(ca, a1, 29) - a2;
+        int32_t b0 = x + plp_goertzel_mul(cb, b1, 29) - b2;
+        a2 = a1;
+        a1 = a0;
+        b2 = b1;
+        b1 = b0;
+    }
+    pDstA[0] = plp_goertzel_mul(ca, a1, 30) - a2;
+    pDstA[1] = plp_goertzel_mul(sa, a1, 30);
+    pDstB[0] = plp_goertzel_mul(cb, b1, 30) - b2;
+    pDstB[1] = plp_goertzel_mul(sb, b1, 30);
+}
+
+/*
+ * Goertzel recursion of one bin over the block of Q1.31 samples, scaled by 2^-shift. c and s are
+ * the cosine and sine of the frequency in Q2.30. Stores the real and imaginary part of the bin.
+ */
+static inline void plp_goertzel_bin_q32(const int32_t *__restrict__ pSrc,
+                                        uint32_t blockSize,
+                                        uint32_t shift,
+                                        int32_t c,
+                                        int32_t s,
+                                        int32_t *__restrict__ pDst) {
+    int32_t s1 = 0;
+    int32_t s2 = 0;
+    uint32_t n;
+
+    for (n = 0; n < blockSize; n++) {
+        int32_t s0 = (pSrc[n] >> shift) + plp_goertzel_mul(c, s1, 29) - s2;
+        s2 = s1;
+        s1 = s0;
+    }
+    pDst[0] = plp_goertzel_mul(c, s1, 30) - s2;
+    pDst[1] = plp_goertzel_mul(s, s1, 30);
+}
+
+/*
+ * Goertzel recursions of the two bins (ca, sa) and (cb, sb), which share the loads of the samples
+ * and hide the latency of each other.
+ */
+static inline void plp_goertzel_bin2_q32(const int32_t *__restrict__ pSrc,
+                                         uint32_t blockSize,
+                                         uint32_t shift,
+                                         int32_t ca,
+                                         int32_t sa,
+                                         int32_t cb,
+                                         int32_t sb,
+                                         int32_t *__restrict__ pDstA,
+                                         int32_t *__restrict__ pDstB) {
+    int32_t a1 = 0;
+    int32_t a2 = 0;
+    int32_t b1 = 0;
+    int32_t b2 = 0;
+    uint32_t n;
+
+    for (n = 0; n < blockSize; n++) {
+        int32_t x = pSrc[n] >> shift;
+        int32_t a0 = x + plp_goertzel_mul(ca, a1, 29) - a2;
+        int32_t b0 = x + plp_goertzel_mul(cb, b1, 29) - b2;
+        a2 = a1;
+        a1 = a0;
+        b2 = b1;
+        b1 = b0;
+    }
+    pDstA[0] = plp_goertzel_mul(ca, a1, 30) - a2;
+    pDstA[1] = plp_goertzel_mul(sa, a1, 30);
+    pDstB[0] = plp_goertzel_mul(cb, b1, 30) - b2;
+    pDstB[1] = plp_goertzel_mul(sb, b1, 30);
+}
+
+#endif // __PLP_GOERTZEL_H__
@@ -0,0 +1,81 @@
+/* ----------------------------------------------------------------------
+ * Project:      PULP DSP Library
+ * Title:        plp_goertzel_q16p_xpulpv2.c
+ * Description:  parallel 16-bit fix-point Goertzel algorithm kernel for XPULPV2
+ *
+ * $Date:        19. Oct 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+#include "plp_goertzel.h"
+
+/**
+  @ingroup groupTransforms
+ */
+
+/**
+  @addtogroup goertzel
+  @{
+ */
+
+/**
+  @brief Parallel 16-bit fix-point Goertzel algorithm for XPULPV2 extension.
+  @param[in]  args  pointer to plp_goertzel_instance_parallel struct initialized by
+                    plp_goertzel_q16_parallel
+  @return     none
+
+  @par Parallelization
+  Core c computes the bins c, c + nPE, ... two at a time, without synchronization.
+ */
+
+void plp_goertzel_q16p_xpulpv2(void *args) {
+
+    int core_id = hal_core_id();
+
+    plp_goertzel_instance_parallel *a = (plp_goertzel_instance_parallel *)args;
+
+    const plp_goertzel_instance_q16 *S = (const plp_goertzel_instance_q16 *)a->S;
+    const int16_t *__restrict__ pSrc = (const int16_t *)a->pSrc;
+    uint32_t blockSize = a->blockSize;
+    uint32_t shift = a->shift;
+    uint32_t nPE = a->nPE;
+    int32_t *__restrict__ pDst = (int32_t *)a->pDst;
+
+    const int32_t *pCoeffs = S->pCoeffs;
+    uint32_t nBins = S->nBins;
+    uint32_t k; // loop counter for the bins
+
+    for (k = core_id; k + nPE < nBins; k += 2 * nPE) {
+        plp_goertzel_bin2_q16(pSrc, blockSize, shift, pCoeffs[2 * k], pCoeffs[2 * k + 1],
+                              pCoeffs[2 * (k + nPE)], pCoeffs[2 * (k + nPE) + 1], &pDst[2 * k],
+                              &pDst[2 * (k + nPE)]);
+    }
+    if (k < nBins) {
+        plp_goertzel_bin_q16(pSrc, blockSize, shift, pCoeffs[2 * k], pCoeffs[2 * k + 1],
+                             &pDst[2 * k]);
+    }
+}
+
+/**
+  @} end of goertzel group
+ */
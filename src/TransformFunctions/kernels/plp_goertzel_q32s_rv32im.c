@@ -0,0 +1,69 @@
+/* ----------------------------------------------------------------------
+ * Project:      PULP DSP Library
+ * Title:        plp_goertzel_q32s_rv32im.c
+ * Description:  32-bit fix-point Goertzel algorithm kernel for RV32IM
+ *
+ * $Date:        19. Oct 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+#include "plp_goertzel.h"
+
+/**
+  @ingroup groupTransforms
+ */
+
+/**
+  @addtogroup goertzel
+  @{
+ */
+
+/**
+  @brief 32-bit fix-point Goertzel algorithm for RV32IM extension.
+  @param[in]  S          points to the Goertzel instance
+  @param[in]  pSrc       points to the block of input samples
+  @param[in]  blockSize  number of samples
+  @param[in]  shift      Amount to shift the samples to the right
+  @param[out] pDst       points to the output, real and imaginary part of every bin
+  @return     none
+ */
+
+void plp_goertzel_q32s_rv32im(const plp_goertzel_instance_q32 *S,
+                              const int32_t *__restrict__ pSrc,
+                              uint32_t blockSize,
+                              uint32_t shift,
+                              int32_t *__restrict__ pDst) {
+
+    const int32_t *pCoeffs = S->pCoeffs;
+    uint32_t nBins = S->nBins;
+    uint32_t k; // loop counter for the bins
+
+    for (k = 0; k < nBins; k++) {
+        plp_goertzel_bin_q32(pSrc, blockSize, shift, pCoeffs[2 * k], pCoeffs[2 * k + 1],
+                             &pDst[2 * k]);
+    }
+}
+
+/**
+  @} end of goertzel group
+ */
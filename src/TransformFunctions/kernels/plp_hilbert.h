@@ -0,0 +1,169 @@
+/* ----------------------------------------------------------------------
+ * Project:      PULP DSP Library
+ * Title:        plp_hilbert.h
+ * Description:  Common functions of the Hilbert transform kernels
+ *
+ * $Date:        19. Oct 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __PLP_HILBERT_H__
+#define __PLP_HILBERT_H__
+
+#include "plp_math.h"
+
+/*
+ * Multiplies the bins k = 0, ..., N/2 of the output of plp_rfft_f32 with -j sgn(k), in place,
+ * which is the spectrum of the Hilbert transform: the bin a + jb becomes b - ja, and DC and
+ * Nyquist are cleared.
+ */
+static inline void plp_hilbert_rotate_f32(float32_t *pSpec, uint32_t N) {
+    uint32_t k;
+
+    for (k = 1; k < N / 2; k++) {
+        float32_t re = pSpec[2 * k];
+        pSpec[2 * k] = pSpec[2 * k + 1];
+        pSpec[2 * k + 1] = -re;
+    }
+    pSpec[0] = 0.0f;
+    pSpec[1] = 0.0f;
+    pSpec[N] = 0.0f;
+    pSpec[N + 1] = 0.0f;
+}
+
+/*
+ * Turns the spectrum Y of plp_cfft_q32 (all N bins) into the input of a second forward
+ * plp_cfft_q32, whose output is the Hilbert transform, in place. The bins are multiplied with
+ * -j sgn(k), DC and Nyquist are cleared, and the bins are stored in reversed order,
+ * H'[N - k] = H[k], since the forward FFT of the reversed spectrum is the inverse FFT without the
+ * factor 1/N.
+ */
+static inline void plp_hilbert_rotate_q32(int32_t *pSpec, uint32_t N) {
+    uint32_t k;
+
+    for (k = 1; k < N / 2; k++) {
+        int32_t ar = pSpec[2 * k];
+        int32_t ai = pSpec[2 * k + 1];
+        int32_t br = pSpec[2 * (N - k)];
+        int32_t bi = pSpec[2 * (N - k) + 1];
+        // H[k] = -j Y[k] goes to N - k, H[N - k] = j Y[N - k] goes to k
+        pSpec[2 * (N - k)] = ai;
+        pSpec[2 * (N - k) + 1] = -ar;
+        pSpec[2 * k] = -bi;
+        pSpec[2 * k + 1] = br;
+    }
+    pSpec[0] = 0;
+    pSpec[1] = 0;
+    pSpec[N] = 0;
+    pSpec[N + 1] = 0;
+}
+
+/*
+ * Rounded square root of v, bit by bit without multiplications.
+ */
+static inline uint32_t plp_hilbert_sqrt_u32(uint32_t v) {
+    uint32_t r = 0;
+    uint32_t b = 1U << 30;
+
+    while (b > v) {
+        b >>= 2;
+    }
+    while (b != 0) {
+        if (v >= r + b) {
+            v -= r + b;
+            r = (r >> 1) + b;
+        } else {
+            r >>= 1;
+        }
+        b >>= 2;
+    }
+    // v is the remainder of the floor, round up if the square root is above r + 1/2
+    return (v > r) ? r + 1 : r;
+}
+
+static inline int16_t plp_hilbert_sat_q16(int32_t x) {
+    return (int16_t)(x > 32767 ? 32767 : x < -32768 ? -32768 : x);
+}
+
+/*
+ * Rounds the sum of products in Q2.30 to Q1.15 and saturates it.
+ */
+static inline int16_t plp_hilbert_round_q16(int64_t sum) {
+    int64_t h = (sum + (1 << 14)) >> 15;
+    return (int16_t)(h > 32767 ? 32767 : h < -32768 ? -32768 : h);
+}
+
+/*
+ * Stores the sample n of the analytic signal x + jh in pDst and its magnitude in pEnv, both in
+ * Q1.15. Each of the outputs may be NULL. The magnitude saturates at 1.
+ */
+static inline void plp_hilbert_store_q16(int16_t x,
+                                         int16_t h,
+                                         uint32_t n,
+                                         int16_t *__restrict__ pDst,
+                                         int16_t *__restrict__ pEnv) {
+    if (pDst) {
+        pDst[2 * n] = x;
+        pDst[2 * n + 1] = h;
+    }
+    if (pEnv) {
+        uint32_t e = plp_hilbert_sqrt_u32((uint32_t)(x * x) + (uint32_t)(h * h));
+        pEnv[n] = (int16_t)(e > 32767 ? 32767 : e);
+    }
+}
+
+static inline void plp_hilbert_store_f32(float32_t x,
+                                         float32_t h,
+                                         uint32_t n,
+                                         float32_t *__restrict__ pDst,
+                                         float32_t *__restrict__ pEnv) {
+    if (pDst) {
+        pDst[2 * n] = x;
+        pDst[2 * n + 1] = h;
+    }
+    if (pEnv) {
+        pEnv[n] = sqrtf(x * x + h * h);
+    }
+}
+
+/*
+ * Converts the output of the second FFT to the Hilbert transform in Q1.15 and stores the analytic
+ * signal and/or the envelope of the N samples. The real part of the FFT output is h / N in Q1.31,
+ * i.e. h is rounded from pBuf[2 n] >> shift with shift = 16 - log2(N). The real part of the
+ * analytic signal is the input itself.
+ */
+static inline void plp_hilbert_output_q16(const int16_t *__restrict__ pSrc,
+                                          const int32_t *__restrict__ pBuf,
+                                          uint32_t N,
+                                          uint32_t shift,
+                                          int16_t *__restrict__ pDst,
+                                          int16_t *__restrict__ pEnv) {
+    int32_t round = 1 << (shift - 1);
+    uint32_t n;
+
+    for (n = 0; n < N; n++) {
+        int16_t h = plp_hilbert_sat_q16((pBuf[2 * n] + round) >> shift);
+        plp_hilbert_store_q16(pSrc[n], h, n, pDst, pEnv);
+    }
+}
+
+#endif // __PLP_HILBERT_H__
@@ -0,0 +1,78 @@
+/* ----------------------------------------------------------------------
+ * Project:      PULP DSP Library
+ * Title:        plp_hilbert_f32s_xpulpv2.c
+ * Description:  Floating-point Hilbert transform kernel for XPULPV2
+ *
+ * $Date:        19. Oct 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+#include "plp_hilbert.h"
+
+/**
+  @ingroup groupTransforms
+ */
+
+/**
+  @addtogroup hilbert
+  @{
+ */
+
+/**
+  @brief Floating-point analytic signal and envelope of a block for XPULPV2 extension.
+
+  The real FFT of the block is multiplied with -j sgn(k) in place and transformed back with
+  plp_rifft_f32_xpulpv2, which yields the Hilbert transform h. With pDst, h is written to the
+  second half of pDst and interleaved with the input from the beginning, which reads every h[n]
+  before it is overwritten. Without pDst, h is written to pEnv and replaced by the magnitude.
+
+  @param[in]  S     points to the floating-point FFT instance, with bitReverseFlag enabled
+  @param[in]  pSrc  points to the block of FFTLength real samples
+  @param[in]  pBuf  points to the temporary buffer of 2*FFTLength floats
+  @param[out] pDst  points to the analytic signal (FFTLength complex values), or NULL
+  @param[out] pEnv  points to the envelope (FFTLength values), or NULL
+  @return     none
+ */
+
+void plp_hilbert_f32s_xpulpv2(const plp_fft_instance_f32 *S,
+                              const float32_t *__restrict__ pSrc,
+                              float32_t *__restrict__ pBuf,
+                              float32_t *pDst,
+                              float32_t *pEnv) {
+
+    uint32_t N = S->FFTLength;
+    float32_t *pHil = pDst ? pDst + N : pEnv;
+    uint32_t n;
+
+    plp_rfft_f32_xpulpv2(S, pSrc, pBuf);
+    plp_hilbert_rotate_f32(pBuf, N);
+    plp_rifft_f32_xpulpv2(S, pBuf, pHil);
+
+    for (n = 0; n < N; n++) {
+        plp_hilbert_store_f32(pSrc[n], pHil[n], n, pDst, pEnv);
+    }
+}
+
+/**
+  @} end of hilbert group
+ */
@@ -0,0 +1,102 @@
+/* ----------------------------------------------------------------------
+ * Project:      PULP DSP Library
+ * Title:        plp_hilbert_fir_f32s_xpulpv2.c
+ * Description:  Floating-point FIR Hilbert transformer kernel for XPULPV2
+ *
+ * $Date:        19. Oct 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+#include "plp_hilbert.h"
+
+/**
+  @ingroup groupTransforms
+ */
+
+/**
+  @addtogroup hilbert
+  @{
+ */
+
+/**
+  @brief Floating-point FIR Hilbert transformer for XPULPV2 extension.
+
+  The output n is centered on the sample pSrc[n + D], with the delay D = 2*numPairs - 1. Each
+  coefficient multiplies the difference of the two samples at the distance 2m + 1 from the center.
+  Two outputs are computed per iteration, which share the loads of the coefficients.
+
+  @param[in]  pSrc      points to the input samples, including the 4*numPairs - 2 past samples
+  @param[in]  pCoeffs   points to the numPairs coefficients
+  @param[in]  numPairs  number of coefficients
+  @param[in]  blkSize   number of output samples
+  @param[out] pDst      points to the analytic signal (blkSize complex values), or NULL
+  @param[out] pEnv      points to the envelope (blkSize values), or NULL
+  @return     none
+ */
+
+void plp_hilbert_fir_f32s_xpulpv2(const float32_t *__restrict__ pSrc,
+                                  const float32_t *__restrict__ pCoeffs,
+                                  uint32_t numPairs,
+                                  uint32_t blkSize,
+                                  float32_t *__restrict__ pDst,
+                                  float32_t *__restrict__ pEnv) {
+
+    uint32_t D = 2 * numPairs - 1;
+    const float32_t *pl;
+    const float32_t *pr;
+    uint32_t n, m;
+
+    for (n = 0; n + 1 < blkSize; n += 2) {
+        float32_t h0 = 0.0f;
+        float32_t h1 = 0.0f;
+
+        pl = pSrc + n + D - 1;
+        pr = pSrc + n + D + 1;
+        for (m = 0; m < numPairs; m++) {
+            float32_t c = pCoeffs[m];
+            h0 += c * (pl[0] - pr[0]);
+            h1 += c * (pl[1] - pr[1]);
+            pl -= 2;
+            pr += 2;
+        }
+        plp_hilbert_store_f32(pSrc[n + D], h0, n, pDst, pEnv);
+        plp_hilbert_store_f32(pSrc[n + D + 1], h1, n + 1, pDst, pEnv);
+    }
+
+    if (n < blkSize) {
+        float32_t h0 = 0.0f;
+
+        pl = pSrc + n + D - 1;
+        pr = pSrc + n + D + 1;
+        for (m = 0; m < numPairs; m++) {
+            h0 += pCoeffs[m] * (pl[0] - pr[0]);
+            pl -= 2;
+            pr += 2;
+        }
+        plp_hilbert_store_f32(pSrc[n + D], h0, n, pDst, pEnv);
+    }
+}
+
+/**
+  @} end of hilbert group
+ */
@@ -0,0 +1,106 @@
+/* ----------------------------------------------------------------------
+ * Project:      PULP DSP Library
+ * Title:        plp_hilbert_fir_q16s_xpulpv2.c
+ * Description:  16-bit fix-point FIR Hilbert transformer kernel for XPULPV2
+ *
+ * $Date:        19. Oct 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+#include "plp_hilbert.h"
+
+/**
+  @ingroup groupTransforms
+ */
+
+/**
+  @addtogroup hilbert
+  @{
+ */
+
+/**
+  @brief 16-bit fix-point FIR Hilbert transformer for XPULPV2 extension.
+
+  The output n is centered on the sample pSrc[n + D], with the delay D = 2*numPairs - 1. Each
+  coefficient multiplies the difference of the two samples at the distance 2m + 1 from the center.
+  Each product fits into 32 bits, but their sum can exceed it for full-scale signals with sharp
+  edges once numPairs >= 12, hence the products are accumulated in Q2.30 with 64 bits, rounded
+  and saturated to Q1.15.
+  Two outputs are computed per iteration, which share the loads of the coefficients.
+
+  @param[in]  pSrc      points to the input samples in Q1.15, including the 4*numPairs - 2 past
+                        samples
+  @param[in]  pCoeffs   points to the numPairs coefficients in Q1.15
+  @param[in]  numPairs  number of coefficients
+  @param[in]  blkSize   number of output samples
+  @param[out] pDst      points to the analytic signal (blkSize complex values in Q1.15), or NULL
+  @param[out] pEnv      points to the envelope (blkSize values in Q1.15), or NULL
+  @return     none
+ */
+
+void plp_hilbert_fir_q16s_xpulpv2(const int16_t *__restrict__ pSrc,
+                                  const int16_t *__restrict__ pCoeffs,
+                                  uint32_t numPairs,
+                                  uint32_t blkSize,
+                                  int16_t *__restrict__ pDst,
+                                  int16_t *__restrict__ pEnv) {
+
+    uint32_t D = 2 * numPairs - 1;
+    const int16_t *pl;
+    const int16_t *pr;
+    uint32_t n, m;
+
+    for (n = 0; n + 1 < blkSize; n += 2) {
+        int64_t sum0 = 0;
+        int64_t sum1 = 0;
+
+        pl = pSrc + n + D - 1;
+        pr = pSrc + n + D + 1;
+        for (m = 0; m < numPairs; m++) {
+            int32_t c = pCoeffs[m];
+            sum0 += (int32_t)(c * (pl[0] - pr[0]));
+            sum1 += (int32_t)(c * (pl[1] - pr[1]));
+            pl -= 2;
+            pr += 2;
+        }
+        plp_hilbert_store_q16(pSrc[n + D], plp_hilbert_round_q16(sum0), n, pDst, pEnv);
+        plp_hilbert_store_q16(pSrc[n + D + 1], plp_hilbert_round_q16(sum1), n + 1, pDst, pEnv);
+    }
+
+    if (n < blkSize) {
+        int64_t sum0 = 0;
+
+        pl = pSrc + n + D - 1;
+        pr = pSrc + n + D + 1;
+        for (m = 0; m < numPairs; m++) {
+            sum0 += (int32_t)(pCoeffs[m] * (pl[0] - pr[0]));
+            pl -= 2;
+            pr += 2;
+        }
+        plp_hilbert_store_q16(pSrc[n + D], plp_hilbert_round_q16(sum0), n, pDst, pEnv);
+    }
+}
+
+/**
+  @} end of hilbert group
+ */
@@ -0,0 +1,84 @@
+/* ----------------------------------------------------------------------
+ * Project:      PULP DSP Library
+ * Title:        plp_hilbert_q16s_rv32im.c
+ * Description:  16-bit fix-point Hilbert transform kernel for RV32IM
+ *
+ * $Date:        19. Oct 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+#include "plp_hilbert.h"
+
+/**
+  @ingroup groupTransforms
+ */
+
+/**
+  @addtogroup hilbert
+  @{
+ */
+
+/**
+  @brief 16-bit fix-point analytic signal and envelope of a block for RV32IM extension.
+
+  The block is transformed in pBuf with plp_cfft_q32s_rv32im, rotated and reversed in place, and
+  transformed again, which yields h / N in Q1.31. The 32-bit FFTs keep at least 18 fractional bits
+  after the scaling by 1/N of both transforms.
+
+  @param[in]  S     points to the 32-bit CFFT instance of length N
+  @param[in]  pSrc  points to the block of N samples in Q1.15
+  @param[in]  pBuf  points to the temporary buffer of 2*N values
+  @param[out] pDst  points to the analytic signal (N complex values in Q1.15), or NULL
+  @param[out] pEnv  points to the envelope (N values in Q1.15), or NULL
+  @return     none
+ */
+
+void plp_hilbert_q16s_rv32im(const plp_cfft_instance_q32 *S,
+                             const int16_t *__restrict__ pSrc,
+                             int32_t *__restrict__ pBuf,
+                             int16_t *__restrict__ pDst,
+                             int16_t *__restrict__ pEnv) {
+
+    uint32_t N = S->fftLen;
+    uint32_t shift = 16;
+    uint32_t n;
+
+    for (n = N; n > 1; n >>= 1) {
+        shift--;
+    }
+
+    for (n = 0; n < N; n++) {
+        pBuf[2 * n] = (int32_t)pSrc[n] << 16;
+        pBuf[2 * n + 1] = 0;
+    }
+
+    plp_cfft_q32s_rv32im(S, pBuf, 0, 1, 31);
+    plp_hilbert_rotate_q32(pBuf, N);
+    plp_cfft_q32s_rv32im(S, pBuf, 0, 1, 31);
+
+    plp_hilbert_output_q16(pSrc, pBuf, N, shift, pDst, pEnv);
+}
+
+/**
+  @} end of hilbert group
+ */
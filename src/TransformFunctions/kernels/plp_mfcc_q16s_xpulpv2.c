@@ -0,0 +1,161 @@
+/* ----------------------------------------------------------------------
+ * Project:      PULP DSP Library
+ * Title:        plp_mfcc_q16s_xpulpv2.c
+ * Description:  Log mel energies of the 16-bit fixed-point MFCC for XPULPV2
+ *
+ * $Date:        19. Oct 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "plp_common_tables.h"
+#include "plp_math.h"
+
+/* ln(2) in Q1.15 */
+#define MFCC_LN2_Q16 22713
+
+/**
+  @ingroup groupTransforms
+ */
+
+/**
+   @addtogroup feature
+   @{
+*/
+
+static int16_t plp_mfcc_log_q16(uint64_t energy, int32_t exponent);
+
+/**
+   @brief       Log mel energies of the 16 bit fixed-point MFCC for XPULPV2 extension (steps 0 to
+                4 of plp_mfcc_q16).
+   @param[in]   SFFT        points to an instance of the 32 bit RFFT structure
+   @param[in]   filterBank  points to plp_triangular_filter_q16 instance
+   @param[in]   window      window in Q1.15 of size n_fft
+   @param[in]   pSrc        points to the input buffer (Q1.15, size n_fft)
+   @param[in]   pBuf        points to a buffer of size 4*n_fft+4, aligned to 4 bytes
+   @param[out]  pDst        points to the output buffer of size nFilters, may be the
+                            second half of pBuf (starting at pBuf + 2*n_fft + 4)
+   @return      none
+*/
+
+void plp_mfcc_q16s_xpulpv2(const plp_rfft_instance_q32 *SFFT,
+                           const plp_triangular_filter_q16 *filterBank,
+                           const int16_t *window,
+                           const int16_t *__restrict__ pSrc,
+                           int16_t *pBuf,
+                           int16_t *pDst) {
+    uint32_t n_fft = SFFT->fftLenReal;
+    int32_t *fft_out = (int32_t *)pBuf;
+    int32_t *fft_in = fft_out + n_fft + 2;
+    const int16_t *filter_start = filterBank->V;
+    int32_t prod, maxAbs = 0;
+    int32_t shift, exponent;
+    int32_t re, im;
+    v2s x, w;
+    uint64_t mag, energy;
+    uint32_t i, j;
+
+    // Step 0: windowing. The products in Q2.30 are shifted, such that the largest one uses the
+    // full range of the Q1.31 input of the FFT. Two samples are processed at a time.
+    for (i = 0; i < (n_fft >> 1); i++) {
+        x = ((const v2s *)pSrc)[i];
+        w = ((const v2s *)window)[i];
+        prod = x[0] * w[0];
+        maxAbs = __MAX(maxAbs, __ABS(prod));
+        prod = x[1] * w[1];
+        maxAbs = __MAX(maxAbs, __ABS(prod));
+    }
+    shift = (maxAbs == 0) ? 0 : __builtin_clz(maxAbs) - 1;
+    for (i = 0; i < (n_fft >> 1); i++) {
+        x = ((const v2s *)pSrc)[i];
+        w = ((const v2s *)window)[i];
+        fft_in[2 * i] = (x[0] * w[0]) << shift;
+        fft_in[2 * i + 1] = (x[1] * w[1]) << shift;
+    }
+
+    // Step 1: FFT, the output is the spectrum divided by n_fft in Q1.31
+    plp_rfft_q32s_xpulpv2(SFFT, fft_in, fft_out);
+
+    // Steps 2 to 4: squared magnitude, triangular filterbank and logarithm. The squared magnitude
+    // of the scaled spectrum in Q2.62 is rounded to 48 fractional bits. Since the scaled spectrum
+    // has at most the energy 1, the filterbank sum with 63 fractional bits fits into 64 bits. The
+    // energy of the unscaled spectrum of the windowed input is energy * 2^exponent.
+    exponent = 2 * (31 - __builtin_clz(n_fft)) - 2 * shift - 61;
+    for (i = 0; i < filterBank->nFilters; i++) {
+        const int32_t *bin = fft_out + 2 * filterBank->firstValue[i];
+        uint32_t length = filterBank->filterLength[i];
+        energy = 0;
+        for (j = 0; j < length; j++) {
+            re = bin[2 * j];
+            im = bin[2 * j + 1];
+            mag = ((uint64_t)((int64_t)re * re) + (uint64_t)((int64_t)im * im) + (1 << 13)) >> 14;
+            energy += mag * (uint16_t)filter_start[j];
+        }
+        filter_start += length;
+        pDst[i] = plp_mfcc_log_q16(energy, exponent);
+    }
+}
+
+/*
+ * Natural logarithm of energy * 2^exponent + 1e-6 in Q5.10, where 1e-6 is the offset of
+ * plp_mfcc_f32. The sum is normalized to m * 2^msb with m in [1, 2), log2(m) is interpolated
+ * linearly between the entries of log2Table_q16, indexed by the 5 bits after the leading one.
+ */
+
+static int16_t plp_mfcc_log_q16(uint64_t energy, int32_t exponent) {
+    int32_t e = -exponent - 20;
+    uint32_t hi, mant;
+    int32_t msb, idx, frac, lg;
+
+    // offset 1e-6 = 1.048576 * 2^-20, with 1.048576 = 68719 / 2^16. Since the exponent is at most
+    // -21, the offset is at least 2 in units of the energy. For very quiet frames, the energy is
+    // scaled down such that the offset fits into 64 bits.
+    if (e > 47) {
+        energy >>= e - 47;
+        exponent += e - 47;
+        e = 47;
+    }
+    energy += (e >= 16) ? ((uint64_t)68719 << (e - 16)) : (uint64_t)(68719 >> (16 - e));
+
+    hi = (uint32_t)(energy >> 32);
+    if (hi) {
+        msb = 63 - __builtin_clz(hi);
+        mant = (uint32_t)(energy >> (msb - 31));
+    } else {
+        msb = 31 - __builtin_clz((uint32_t)energy);
+        mant = (uint32_t)energy << (31 - msb);
+    }
+    idx = (mant >> 26) & 0x1F;
+    frac = (mant >> 10) & 0xFFFF;
+
+    // log2 in Q15, at least log2(1e-6) = -19.93
+    lg = ((msb + exponent) << 15) + log2Table_q16[idx] +
+         (((log2Table_q16[idx + 1] - log2Table_q16[idx]) * frac) >> 16);
+
+    // ln(x) = ln(2) log2(x), Q15 -> Q10
+    lg = ((lg >> 5) * MFCC_LN2_Q16 + (1 << 14)) >> 15;
+    return __CLIP(lg, 15);
+}
+
+/**
+   @} end of feature group
+*/
@@ -0,0 +1,82 @@
+/* ----------------------------------------------------------------------
+ * Project:      PULP DSP Library
+ * Title:        plp_overlap_add_f32_xpulpv2.c
+ * Description:  Floating-point overlap-add synthesis for XPULPV2
+ *
+ * $Date:        19. Oct 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup fft
+ */
+
+/**
+  @addtogroup overlapAdd
+  @{
+ */
+
+/**
+   @brief  Floating-point overlap-add synthesis for XPULPV2 extension.
+   @param[in]     pSrc      points to the frame of length frameLen
+   @param[in]     pWindow   points to the synthesis window of length frameLen, or NULL
+   @param[in]     frameLen  length of the frame
+   @param[in]     hopLen    number of samples between two frames, at most frameLen
+   @param[in,out] pBuf      points to the overlap buffer of length frameLen
+   @param[out]    pDst      points to the output buffer of length hopLen
+   @return        none
+*/
+void plp_overlap_add_f32_xpulpv2(const float32_t *__restrict__ pSrc,
+                                 const float32_t *__restrict__ pWindow,
+                                 uint32_t frameLen,
+                                 uint32_t hopLen,
+                                 float32_t *__restrict__ pBuf,
+                                 float32_t *__restrict__ pDst) {
+    uint32_t i;
+
+    // the first hopLen samples are complete, the others are moved to the front of the buffer
+    if (pWindow) {
+        for (i = 0; i < hopLen; i++) {
+            pDst[i] = pBuf[i] + pWindow[i] * pSrc[i];
+        }
+        for (i = hopLen; i < frameLen; i++) {
+            pBuf[i - hopLen] = pBuf[i] + pWindow[i] * pSrc[i];
+        }
+    } else {
+        for (i = 0; i < hopLen; i++) {
+            pDst[i] = pBuf[i] + pSrc[i];
+        }
+        for (i = hopLen; i < frameLen; i++) {
+            pBuf[i - hopLen] = pBuf[i] + pSrc[i];
+        }
+    }
+
+    for (i = frameLen - hopLen; i < frameLen; i++) {
+        pBuf[i] = 0.0f;
+    }
+}
+
+/**
+   @} end of overlapAdd group
+*/
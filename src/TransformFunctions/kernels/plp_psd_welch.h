@@ -0,0 +1,71 @@
+/* ----------------------------------------------------------------------
+ * Project:      PULP DSP Library
+ * Title:        plp_psd_welch.h
+ * Description:  Windowing and normalization of the 16-bit fix-point Welch PSD
+ *
+ * $Date:        19. Oct 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __PLP_PSD_WELCH_H__
+#define __PLP_PSD_WELCH_H__
+
+#include "plp_math.h"
+
+/*
+ * Multiplies the segment of N samples with the window, both in Q1.15, and rounds the products to
+ * Q1.15. Since the window is not negative, the products do not overflow.
+ */
+static inline void plp_psd_welch_window_q16(const int16_t *__restrict__ pSrc,
+                                            const int16_t *__restrict__ pWindow,
+                                            uint32_t N,
+                                            int16_t *__restrict__ pFrame) {
+    uint32_t n;
+
+    for (n = 0; n < N; n += 2) {
+        int32_t y0 = (pSrc[n] * pWindow[n] + (1 << 14)) >> 15;
+        int32_t y1 = (pSrc[n + 1] * pWindow[n + 1] + (1 << 14)) >> 15;
+        pFrame[n] = (int16_t)y0;
+        pFrame[n + 1] = (int16_t)y1;
+    }
+}
+
+/*
+ * PSD of bin k in Q17.15 from the sum acc of the squared magnitudes of the nSegments spectra, in
+ * Q2.30 and divided by N^2 (output of plp_rfft_q16). norm is N^2 / sum(w^2) in Q16.16. The bins
+ * between DC and Nyquist are doubled (one-sided PSD). The result saturates at 2^16.
+ */
+static inline int32_t plp_psd_welch_power_q16(uint64_t acc,
+                                              uint32_t nSegments,
+                                              uint32_t norm,
+                                              uint32_t k,
+                                              uint32_t N) {
+    uint64_t mean = acc / nSegments;
+    uint64_t p = (mean * norm) >> 31;
+
+    if (k > 0 && k < N / 2) {
+        p <<= 1;
+    }
+    return (p > 0x7FFFFFFF) ? 0x7FFFFFFF : (int32_t)p;
+}
+
+#endif // __PLP_PSD_WELCH_H__
@@ -0,0 +1,108 @@
+/* ----------------------------------------------------------------------
+ * Project:      PULP DSP Library
+ * Title:        plp_psd_welch_f32p_xpulpv2.c
+ * Description:  Floating-point Welch PSD kernel for XPULPV2
+ *
+ * $Date:        19. Oct 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupTransforms
+ */
+
+/**
+  @addtogroup psd
+  @{
+ */
+
+/**
+   @brief      Floating-point Welch power spectral density for XPULPV2 extension, the segments are
+               distributed over the cores.
+
+   Core c processes the segments c, c + nPE, ... Its part of pBuf holds the windowed segment
+   (FFTLength floats), the output of plp_rfft_f32_xpulpv2 (2*FFTLength floats) and its sum of the
+   squared magnitudes (FFTLength / 2 + 1 floats). After a barrier, the cores distribute the bins,
+   add up the sums of all cores and scale them to the PSD.
+
+   @param[in]  args  points to the plp_psd_welch_instance_f32_parallel
+   @return     none
+*/
+void plp_psd_welch_f32p_xpulpv2(void *args) {
+    plp_psd_welch_instance_f32_parallel *a = (plp_psd_welch_instance_f32_parallel *)args;
+    const plp_psd_welch_instance_f32 *S = a->S;
+    const float32_t *pWindow = S->pWindow;
+    uint32_t N = S->S->FFTLength;
+    uint32_t nBins = N / 2 + 1;
+    uint32_t hopLen = S->hopLen;
+    uint32_t nSegments = a->nSegments;
+    uint32_t core_id = hal_core_id();
+    uint32_t nPE = a->nPE;
+    float32_t *pFrame = a->pBuf + core_id * 4 * N;
+    float32_t *pSpec = pFrame + N;
+    float32_t *pAcc = pSpec + 2 * N;
+    float32_t scale = S->norm / (float32_t)nSegments;
+    uint32_t t, n, k, c;
+
+    for (k = 0; k < nBins; k++) {
+        pAcc[k] = 0.0f;
+    }
+
+    for (t = core_id; t < nSegments; t += nPE) {
+        const float32_t *pIn = a->pSrc + t * hopLen;
+
+        for (n = 0; n < N; n += 2) {
+            float32_t x0 = pIn[n];
+            float32_t x1 = pIn[n + 1];
+            pFrame[n] = x0 * pWindow[n];
+            pFrame[n + 1] = x1 * pWindow[n + 1];
+        }
+
+        plp_rfft_f32_xpulpv2(S->S, pFrame, pSpec);
+
+        for (k = 0; k < nBins; k++) {
+            float32_t re = pSpec[2 * k];
+            float32_t im = pSpec[2 * k + 1];
+            pAcc[k] += re * re + im * im;
+        }
+    }
+
+    hal_team_barrier();
+
+    // reduction, the bins between DC and Nyquist are doubled (one-sided PSD)
+    for (k = core_id; k < nBins; k += nPE) {
+        float32_t sum = 0.0f;
+        for (c = 0; c < nPE; c++) {
+            sum += a->pBuf[c * 4 * N + 3 * N + k];
+        }
+        if (k > 0 && k < N / 2) {
+            sum *= 2.0f;
+        }
+        a->pDst[k] = sum * scale;
+    }
+}
+
+/**
+   @} end of psd group
+*/
@@ -0,0 +1,97 @@
+/* ----------------------------------------------------------------------
+ * Project:      PULP DSP Library
+ * Title:        plp_psd_welch_q16p_xpulpv2.c
+ * Description:  16-bit fix-point Welch PSD kernel for XPULPV2
+ *
+ * $Date:        19. Oct 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+#include "plp_psd_welch.h"
+
+/**
+  @ingroup groupTransforms
+ */
+
+/**
+  @addtogroup psd
+  @{
+ */
+
+/**
+   @brief      16-bit fix-point Welch power spectral density for XPULPV2 extension, the segments
+               are distributed over the cores.
+
+   Core c processes the segments c, c + nPE, ... Its part of pBuf (4*FFTLength+8 values) holds its
+   sums of the squared magnitudes (FFTLength / 2 + 1 64-bit values), the windowed segment
+   (FFTLength values) and the output of plp_rfft_q16s_xpulpv2 (FFTLength + 2 values). After a
+   barrier, the cores distribute the bins, add up the sums of all cores and scale them to the PSD.
+
+   @param[in]  args  points to the plp_psd_welch_instance_q16_parallel
+   @return     none
+*/
+void plp_psd_welch_q16p_xpulpv2(void *args) {
+    plp_psd_welch_instance_q16_parallel *a = (plp_psd_welch_instance_q16_parallel *)args;
+    const plp_psd_welch_instance_q16 *S = a->S;
+    uint32_t N = S->S->fftLenReal;
+    uint32_t nBins = N / 2 + 1;
+    uint32_t hopLen = S->hopLen;
+    uint32_t nSegments = a->nSegments;
+    uint32_t core_id = hal_core_id();
+    uint32_t nPE = a->nPE;
+    uint32_t stride = 4 * N + 8;
+    uint64_t *pAcc = (uint64_t *)(a->pBuf + core_id * stride);
+    int16_t *pFrame = (int16_t *)(pAcc + nBins);
+    int16_t *pSpec = pFrame + N;
+    uint32_t t, k, c;
+
+    for (k = 0; k < nBins; k++) {
+        pAcc[k] = 0;
+    }
+
+    for (t = core_id; t < nSegments; t += nPE) {
+        plp_psd_welch_window_q16(a->pSrc + t * hopLen, S->pWindow, N, pFrame);
+
+        plp_rfft_q16s_xpulpv2(S->S, pFrame, pSpec);
+
+        // squared magnitude in Q2.30, at most 2^31
+        for (k = 0; k < nBins; k++) {
+            v2s x = ((v2s *)pSpec)[k];
+            pAcc[k] += (uint32_t)__DOTP2(x, x);
+        }
+    }
+
+    hal_team_barrier();
+
+    for (k = core_id; k < nBins; k += nPE) {
+        uint64_t sum = 0;
+        for (c = 0; c < nPE; c++) {
+            sum += ((uint64_t *)(a->pBuf + c * stride))[k];
+        }
+        a->pDst[k] = plp_psd_welch_power_q16(sum, nSegments, S->norm, k, N);
+    }
+}
+
+/**
+   @} end of psd group
+*/
@@ -0,0 +1,93 @@
+/* ----------------------------------------------------------------------
+ * Project:      PULP DSP Library
+ * Title:        plp_psd_welch_q16s_rv32im.c
+ * Description:  16-bit fix-point Welch PSD kernel for RV32IM
+ *
+ * $Date:        19. Oct 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+#include "plp_psd_welch.h"
+
+/**
+  @ingroup groupTransforms
+ */
+
+/**
+  @addtogroup psd
+  @{
+ */
+
+/**
+   @brief      16-bit fix-point Welch power spectral density for RV32IM extension.
+
+   pBuf holds the sums of the squared magnitudes (FFTLength / 2 + 1 64-bit values), followed by
+   the windowed segment (FFTLength values) and the output of plp_rfft_q16s_rv32im
+   (FFTLength + 2 values).
+
+   @param[in]  S          points to the Welch PSD instance
+   @param[in]  pSrc       points to the first sample of the first segment
+   @param[in]  nSegments  number of segments, at least 1
+   @param[in]  pBuf       points to the temporary buffer of 4*FFTLength+8 values, aligned to 8
+                          bytes
+   @param[out] pDst       points to the output of FFTLength / 2 + 1 bins in Q17.15
+   @return     none
+*/
+void plp_psd_welch_q16s_rv32im(const plp_psd_welch_instance_q16 *S,
+                               const int16_t *__restrict__ pSrc,
+                               uint32_t nSegments,
+                               int16_t *__restrict__ pBuf,
+                               int32_t *__restrict__ pDst) {
+    uint32_t N = S->S->fftLenReal;
+    uint32_t nBins = N / 2 + 1;
+    uint32_t hopLen = S->hopLen;
+    uint64_t *pAcc = (uint64_t *)pBuf;
+    int16_t *pFrame = (int16_t *)(pAcc + nBins);
+    int16_t *pSpec = pFrame + N;
+    uint32_t t, k;
+
+    for (k = 0; k < nBins; k++) {
+        pAcc[k] = 0;
+    }
+
+    for (t = 0; t < nSegments; t++) {
+        plp_psd_welch_window_q16(pSrc + t * hopLen, S->pWindow, N, pFrame);
+
+        plp_rfft_q16s_rv32im(S->S, pFrame, pSpec);
+
+        // squared magnitude in Q2.30, at most 2^31
+        for (k = 0; k < nBins; k++) {
+            int32_t re = pSpec[2 * k];
+            int32_t im = pSpec[2 * k + 1];
+            pAcc[k] += (uint32_t)(re * re) + (uint32_t)(im * im);
+        }
+    }
+
+    for (k = 0; k < nBins; k++) {
+        pDst[k] = plp_psd_welch_power_q16(pAcc[k], nSegments, S->norm, k, N);
+    }
+}
+
+/**
+   @} end of psd group
+*/
@@ -0,0 +1,110 @@
+/* ----------------------------------------------------------------------
+ * Project:      PULP DSP Library
+ * Title:        plp_rfft_q16p_xpulpv2.c
+ * Description:  Parallel 16-bit fixed-point FFT on real input data for XPULPV2
+ *
+ * $Date:        19. Oct 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup fft
+ * @{
+ */
+
+/**
+ * @brief      Parallel quantized 16 bit fast fourier transform on real input data for XPULPV2
+ * @param[in]  args    points to the plp_rfft_instance_q16_parallel
+ */
+
+void plp_rfft_q16p_xpulpv2(void *args) {
+    plp_rfft_instance_q16_parallel *a = (plp_rfft_instance_q16_parallel *)args;
+    const int16_t *pSrc = a->pSrc;
+    int16_t *pDst = a->pDst;
+    uint32_t nPE = a->nPE;
+    uint32_t n2 = a->S->fftLenReal >> 1;
+    const int16_t *pCoef = a->S->pTwiddleRFFT;
+    int core_id = hal_core_id();
+
+    uint32_t i, k, l;
+    v2s za, zb, s, d, h, CoSi;
+    int32_t ar, ai, er, ei, yr, yi;
+
+    /* the real input x[n] is the complex input z[n] = x[2n] + j x[2n+1] of length N/2 */
+    for (i = core_id; i < n2; i += nPE) {
+        ((v2s *)pDst)[i] = ((const v2s *)pSrc)[i];
+    }
+
+    hal_team_barrier();
+
+    plp_cfft_instance_q16_parallel cfft_args = { .S = (plp_cfft_instance_q16 *)a->S->pCfft,
+                                                 .p1 = pDst,
+                                                 .ifftFlag = 0,
+                                                 .bitReverseFlag = 1,
+                                                 .deciPoint = 15,
+                                                 .nPE = nPE };
+    plp_cfft_q16p_xpulpv2((void *)&cfft_args);
+
+    hal_team_barrier();
+
+    /* split, see plp_rfft_q16s_rv32im.c, each core processes the pairs (k, N/2-k) in-place */
+    if (core_id == 0) {
+        ar = pDst[0];
+        ai = pDst[1];
+        *((v2s *)&pDst[0]) = __PACK2((ar + ai) >> 1, 0);
+        *((v2s *)&pDst[2 * n2]) = __PACK2((ar - ai) >> 1, 0);
+    }
+
+    for (k = core_id + 1; k <= (n2 >> 1); k += nPE) {
+        l = n2 - k;
+
+        CoSi = *((v2s *)&pCoef[2 * k]);
+        za = __SRA2(*((v2s *)&pDst[2 * k]), ((v2s){ 1, 1 }));
+        zb = __SRA2(*((v2s *)&pDst[2 * l]), ((v2s){ 1, 1 }));
+
+        s = __ADD2(za, zb);
+        d = __SUB2(za, zb);
+
+        /* E = (s[0], d[1]), D / 2 = (d[0], s[1]) */
+        er = s[0];
+        ei = d[1];
+        h = __PACK2(d[0], s[1]);
+
+        yr = __DOTP2(h, CoSi) >> 15;
+        yi = __DOTP2(h, __PACK2(-CoSi[1], CoSi[0])) >> 15;
+
+        *((v2s *)&pDst[2 * k]) = __PACK2(__CLIP((er + yi) >> 1, 15), __CLIP((ei - yr) >> 1, 15));
+        *((v2s *)&pDst[2 * l]) = __PACK2(__CLIP((er - yi) >> 1, 15), __CLIP((-ei - yr) >> 1, 15));
+    }
+
+    hal_team_barrier();
+}
+
+/**
+ * @} end of FFT group
+ */
@@ -0,0 +1,118 @@
+/* ----------------------------------------------------------------------
+ * Project:      PULP DSP Library
+ * Title:        plp_rfft_q16s_rv32im.c
+ * Description:  16-bit fixed-point FFT on real input data for RV32IM
+ *
+ * $Date:        19. Oct 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup fft
+ * @{
+ */
+
+static void plp_rfft_split_q16(int16_t *pSrc, uint32_t n2, const int16_t *pCoef);
+
+/**
+ * @brief      Quantized 16 bit fast fourier transform on real input data for RV32IM
+ * @param[in]  S       points to an instance of the 16bit quantized RFFT structure
+ * @param[in]  pSrc    points to the real input buffer of size <code>fftLenReal</code>
+ * @param[out] pDst    points to the complex output buffer of size <code>fftLenReal+2</code>
+ */
+
+void plp_rfft_q16s_rv32im(const plp_rfft_instance_q16 *S,
+                          const int16_t *__restrict__ pSrc,
+                          int16_t *__restrict__ pDst) {
+    uint32_t n2 = S->fftLenReal >> 1;
+    uint32_t i;
+
+    /* the real input x[n] is the complex input z[n] = x[2n] + j x[2n+1] of length N/2 */
+    for (i = 0; i < n2; i++) {
+        ((int32_t *)pDst)[i] = ((const int32_t *)pSrc)[i];
+    }
+
+    plp_cfft_q16s_rv32im(S->pCfft, pDst, 0, 1, 15);
+
+    plp_rfft_split_q16(pDst, n2, S->pTwiddleRFFT);
+}
+
+/*
+ * Split of the complex spectrum Z[k] of length N/2 into the spectrum X[k] of the real sequence:
+ *
+ * A = Z[k], B = conj(Z[N/2-k]), W = exp(-j 2 pi k / N) = co - j si
+ * E = (A + B) / 2, Y = W (A - B) / 2
+ * X[k]       = (E - j Y) / 2
+ * X[N/2 - k] = conj(E + j Y) / 2
+ *
+ * The additional factor 1/2 keeps the scaling of the complex FFT, the output is X / N. The pairs
+ * (k, N/2-k) are processed together, such that the split can be done in-place.
+ */
+
+static void plp_rfft_split_q16(int16_t *pSrc, uint32_t n2, const int16_t *pCoef) {
+    uint32_t k, l;
+    int32_t ar, ai, br, bi, er, ei, hr, hi, yr, yi;
+    int32_t co, si;
+
+    ar = pSrc[0];
+    ai = pSrc[1];
+    pSrc[0] = (int16_t)((ar + ai) >> 1);
+    pSrc[1] = 0;
+    pSrc[2 * n2] = (int16_t)((ar - ai) >> 1);
+    pSrc[2 * n2 + 1] = 0;
+
+    for (k = 1; k <= (n2 >> 1); k++) {
+        l = n2 - k;
+
+        co = pCoef[2 * k];
+        si = pCoef[2 * k + 1];
+
+        ar = pSrc[2 * k] >> 1;
+        ai = pSrc[2 * k + 1] >> 1;
+        br = pSrc[2 * l] >> 1;
+        bi = pSrc[2 * l + 1] >> 1;
+
+        /* E = (er, ei), D / 2 = (hr, hi) */
+        er = ar + br;
+        ei = ai - bi;
+        hr = ar - br;
+        hi = ai + bi;
+
+        yr = (co * hr + si * hi) >> 15;
+        yi = (co * hi - si * hr) >> 15;
+
+        pSrc[2 * k] = (int16_t)__CLIP((er + yi) >> 1, 15);
+        pSrc[2 * k + 1] = (int16_t)__CLIP((ei - yr) >> 1, 15);
+        pSrc[2 * l] = (int16_t)__CLIP((er - yi) >> 1, 15);
+        pSrc[2 * l + 1] = (int16_t)__CLIP((-ei - yr) >> 1, 15);
+    }
+}
+
+/**
+ * @} end of FFT group
+ */
@@ -0,0 +1,105 @@
+/* ----------------------------------------------------------------------
+ * Project:      PULP DSP Library
+ * Title:        plp_rfft_q16s_xpulpv2.c
+ * Description:  16-bit fixed-point FFT on real input data for XPULPV2
+ *
+ * $Date:        19. Oct 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup fft
+ * @{
+ */
+
+static void plp_rfft_split_q16(int16_t *pSrc, uint32_t n2, const int16_t *pCoef);
+
+/**
+ * @brief      Quantized 16 bit fast fourier transform on real input data for XPULPV2
+ * @param[in]  S       points to an instance of the 16bit quantized RFFT structure
+ * @param[in]  pSrc    points to the real input buffer of size <code>fftLenReal</code>
+ * @param[out] pDst    points to the complex output buffer of size <code>fftLenReal+2</code>
+ */
+
+void plp_rfft_q16s_xpulpv2(const plp_rfft_instance_q16 *S,
+                           const int16_t *__restrict__ pSrc,
+                           int16_t *__restrict__ pDst) {
+    uint32_t n2 = S->fftLenReal >> 1;
+    uint32_t i;
+
+    /* the real input x[n] is the complex input z[n] = x[2n] + j x[2n+1] of length N/2 */
+    for (i = 0; i < n2; i++) {
+        ((v2s *)pDst)[i] = ((const v2s *)pSrc)[i];
+    }
+
+    plp_cfft_q16s_xpulpv2(S->pCfft, pDst, 0, 1, 15);
+
+    plp_rfft_split_q16(pDst, n2, S->pTwiddleRFFT);
+}
+
+/*
+ * Split of the complex spectrum Z[k] of length N/2 into the spectrum X[k] of the real sequence,
+ * see plp_rfft_q16s_rv32im.c. The split is bit-exact to the one of the RV32IM kernel.
+ */
+
+static void plp_rfft_split_q16(int16_t *pSrc, uint32_t n2, const int16_t *pCoef) {
+    uint32_t k, l;
+    v2s a, b, s, d, h, CoSi;
+    int32_t ar, ai, er, ei, yr, yi;
+
+    ar = pSrc[0];
+    ai = pSrc[1];
+    *((v2s *)&pSrc[0]) = __PACK2((ar + ai) >> 1, 0);
+    *((v2s *)&pSrc[2 * n2]) = __PACK2((ar - ai) >> 1, 0);
+
+    for (k = 1; k <= (n2 >> 1); k++) {
+        l = n2 - k;
+
+        CoSi = *((v2s *)&pCoef[2 * k]);
+        a = __SRA2(*((v2s *)&pSrc[2 * k]), ((v2s){ 1, 1 }));
+        b = __SRA2(*((v2s *)&pSrc[2 * l]), ((v2s){ 1, 1 }));
+
+        s = __ADD2(a, b);
+        d = __SUB2(a, b);
+
+        /* E = (s[0], d[1]), D / 2 = (d[0], s[1]) */
+        er = s[0];
+        ei = d[1];
+        h = __PACK2(d[0], s[1]);
+
+        yr = __DOTP2(h, CoSi) >> 15;
+        yi = __DOTP2(h, __PACK2(-CoSi[1], CoSi[0])) >> 15;
+
+        *((v2s *)&pSrc[2 * k]) = __PACK2(__CLIP((er + yi) >> 1, 15), __CLIP((ei - yr) >> 1, 15));
+        *((v2s *)&pSrc[2 * l]) = __PACK2(__CLIP((er - yi) >> 1, 15), __CLIP((-ei - yr) >> 1, 15));
+    }
+}
+
+/**
+ * @} end of FFT group
+ */
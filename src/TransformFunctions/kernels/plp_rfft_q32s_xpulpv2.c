@@ -0,0 +1,111 @@
+/* ----------------------------------------------------------------------
+ * Project:      PULP DSP Library
+ * Title:        plp_rfft_q32s_xpulpv2.c
+ * Description:  32-bit fixed-point FFT on real input data for XPULPV2
+ *
+ * $Date:        19. Oct 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup fft
+ * @{
+ */
+
+static void plp_rfft_split_q32(int32_t *pSrc, uint32_t n2, const int32_t *pCoef);
+
+/**
+ * @brief      Quantized 32 bit fast fourier transform on real input data for XPULPV2
+ * @param[in]  S       points to an instance of the 32bit quantized RFFT structure
+ * @param[in]  pSrc    points to the real input buffer of size <code>fftLenReal</code>
+ * @param[out] pDst    points to the complex output buffer of size <code>fftLenReal+2</code>
+ */
+
+void plp_rfft_q32s_xpulpv2(const plp_rfft_instance_q32 *S,
+                           const int32_t *__restrict__ pSrc,
+                           int32_t *__restrict__ pDst) {
+    uint32_t i;
+
+    /* the real input x[n] is the complex input z[n] = x[2n] + j x[2n+1] of length N/2 */
+    for (i = 0; i < S->fftLenReal; i++) {
+        pDst[i] = pSrc[i];
+    }
+
+    plp_cfft_q32s_xpulpv2(S->pCfft, pDst, 0, 1, 31);
+
+    plp_rfft_split_q32(pDst, S->fftLenReal >> 1, S->pTwiddleRFFT);
+}
+
+/*
+ * Split of the complex spectrum Z[k] of length N/2 into the spectrum X[k] of the real sequence,
+ * see plp_rfft_q32s_rv32im.c. The split is bit-exact to the one of the RV32IM kernel.
+ */
+
+static void plp_rfft_split_q32(int32_t *pSrc, uint32_t n2, const int32_t *pCoef) {
+    uint32_t k, l;
+    int32_t ar, ai, br, bi, er, ei, hr, hi, yr, yi;
+    int32_t co, si;
+
+    ar = pSrc[0];
+    ai = pSrc[1];
+    pSrc[0] = (ar >> 1) + (ai >> 1);
+    pSrc[1] = 0;
+    pSrc[2 * n2] = (ar >> 1) - (ai >> 1);
+    pSrc[2 * n2 + 1] = 0;
+
+    for (k = 1; k <= (n2 >> 1); k++) {
+        l = n2 - k;
+
+        co = pCoef[2 * k];
+        si = pCoef[2 * k + 1];
+
+        ar = pSrc[2 * k] >> 2;
+        ai = pSrc[2 * k + 1] >> 2;
+        br = pSrc[2 * l] >> 2;
+        bi = pSrc[2 * l + 1] >> 2;
+
+        /* E / 2 = (er, ei), D / 4 = (hr, hi) */
+        er = ar + br;
+        ei = ai - bi;
+        hr = ar - br;
+        hi = ai + bi;
+
+        /* Y / 2 */
+        yr = (int32_t)(((int64_t)co * hr + (int64_t)si * hi + 0x40000000LL) >> 31);
+        yi = (int32_t)(((int64_t)co * hi - (int64_t)si * hr + 0x40000000LL) >> 31);
+
+        pSrc[2 * k] = er + yi;
+        pSrc[2 * k + 1] = ei - yr;
+        pSrc[2 * l] = er - yi;
+        pSrc[2 * l + 1] = -ei - yr;
+    }
+}
+
+/**
+ * @} end of FFT group
+ */
@@ -0,0 +1,237 @@
+/* ----------------------------------------------------------------------
+ * Project:      PULP DSP Library
+ * Title:        plp_rifft_f32_xpulpv2.c
+ * Description:  Floating-point inverse FFT to real output data for XPULPV2
+ *
+ * $Date:        19. Oct 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+static inline uint32_t plp_rifft_bitrev(const plp_fft_instance_f32 *S, uint32_t n, uint32_t log2M);
+static inline Complex_type_f32 plp_rifft_pre(const Complex_type_f32 *pSrc,
+                                             const Complex_type_f32 *pTw,
+                                             uint32_t M,
+                                             uint32_t k);
+static inline void plp_rifft_butterfly(Complex_type_f32 *pBuf,
+                                       const Complex_type_f32 *pTw,
+                                       uint32_t b,
+                                       uint32_t dist,
+                                       uint32_t twStep);
+static inline void plp_rifft_post(const plp_fft_instance_f32 *S,
+                                  Complex_type_f32 *pBuf,
+                                  float32_t *pDst,
+                                  uint32_t n,
+                                  uint32_t log2M,
+                                  float32_t scale);
+
+/**
+  @ingroup fft
+ */
+
+/**
+  @defgroup realIFFTKernels Inverse FFT kernels to real output values
+  These kernels calculate the inverse of plp_rfft_f32. The input are the (FFTLen / 2 + 1) complex
+  values in natural order, as computed by plp_rfft_f32 with bitReverseFlag enabled, and the output
+  are FFTLen real values, including the normalization by 1/FFTLen.
+
+  The spectrum is combined into a complex sequence of length FFTLen / 2, whose inverse FFT contains
+  the even output samples in the real part and the odd output samples in the imaginary part. Thus,
+  the complex inverse FFT has only half the length of the output. It is computed as a forward
+  radix-2 FFT of the conjugate, using every other twiddle factor of the FFT instance.
+*/
+
+/**
+  @addtogroup realIFFTKernels
+  @{
+ */
+
+/**
+   @brief  Floating-point inverse FFT to real output data for XPULPV2 extension.
+   @param[in]   S       points to an instance of the floating-point FFT structure (the same as
+                        for plp_rfft_f32)
+   @param[in]   pSrc    points to the input buffer (complex data, FFTLen + 2 values)
+   @param[out]  pDst    points to the output buffer (real data, FFTLen values)
+   @return      none
+*/
+void plp_rifft_f32_xpulpv2(const plp_fft_instance_f32 *S,
+                           const float32_t *__restrict__ pSrc,
+                           float32_t *__restrict__ pDst) {
+
+    uint32_t M = S->FFTLength >> 1;
+    uint32_t log2M = 31 - __builtin_clz(M);
+    uint32_t k, b, dist, twStep;
+    float32_t scale = 1.0f / (float32_t)S->FFTLength;
+
+    const Complex_type_f32 *_in_ptr = (const Complex_type_f32 *)pSrc;
+    Complex_type_f32 *_buf_ptr = (Complex_type_f32 *)pDst;
+    const Complex_type_f32 *_tw_ptr = (const Complex_type_f32 *)S->pTwiddleFactors;
+
+    // combine the spectrum into the conjugate of the complex sequence of length M
+    for (k = 0; k < M; k++) {
+        _buf_ptr[k] = plp_rifft_pre(_in_ptr, _tw_ptr, M, k);
+    }
+
+    // radix-2 FFT of length M, the twiddle factors of length M are every other one of length 2*M
+    for (dist = M >> 1, twStep = 2; dist > 0; dist >>= 1, twStep <<= 1) {
+        for (b = 0; b < M / 2; b++) {
+            plp_rifft_butterfly(_buf_ptr, _tw_ptr, b, dist, twStep);
+        }
+    }
+
+    // bit reversal, conjugate and normalization
+    for (k = 0; k < M; k++) {
+        plp_rifft_post(S, _buf_ptr, pDst, k, log2M, scale);
+    }
+}
+
+/**
+   @brief  Floating-point inverse FFT to real output data for XPULPV2 extension (parallel version).
+   @param[in]   args     points to the plp_fft_instance_f32_parallel
+   @return      none
+*/
+void plp_rifft_f32_xpulpv2_parallel(void *args) {
+
+    plp_fft_instance_f32_parallel *arg = (plp_fft_instance_f32_parallel *)args;
+    const plp_fft_instance_f32 *S = arg->S;
+    const uint32_t nPE = arg->nPE;
+    float32_t *pDst = arg->pDst;
+
+    uint32_t M = S->FFTLength >> 1;
+    uint32_t log2M = 31 - __builtin_clz(M);
+    uint32_t k, b, dist, twStep;
+    float32_t scale = 1.0f / (float32_t)S->FFTLength;
+    int core_id = hal_core_id();
+
+    const Complex_type_f32 *_in_ptr = (const Complex_type_f32 *)arg->pSrc;
+    Complex_type_f32 *_buf_ptr = (Complex_type_f32 *)pDst;
+    const Complex_type_f32 *_tw_ptr = (const Complex_type_f32 *)S->pTwiddleFactors;
+
+    for (k = core_id; k < M; k += nPE) {
+        _buf_ptr[k] = plp_rifft_pre(_in_ptr, _tw_ptr, M, k);
+    }
+
+    for (dist = M >> 1, twStep = 2; dist > 0; dist >>= 1, twStep <<= 1) {
+        hal_team_barrier();
+        for (b = core_id; b < M / 2; b += nPE) {
+            plp_rifft_butterfly(_buf_ptr, _tw_ptr, b, dist, twStep);
+        }
+    }
+
+    hal_team_barrier();
+
+    for (k = core_id; k < M; k += nPE) {
+        plp_rifft_post(S, _buf_ptr, pDst, k, log2M, scale);
+    }
+
+    hal_team_barrier();
+}
+
+/**
+   @} end of realIFFTKernels group
+*/
+
+static inline uint32_t plp_rifft_bitrev(const plp_fft_instance_f32 *S, uint32_t n, uint32_t log2M) {
+    uint32_t rev = 0;
+    uint32_t i;
+
+    // the bit reversal of 2*n with log2M + 1 bits is the bit reversal of n with log2M bits
+    if (S->pBitReverseLUT) {
+        return S->pBitReverseLUT[2 * n];
+    }
+    for (i = 0; i < log2M; i++) {
+        rev = (rev << 1) | ((n >> i) & 1);
+    }
+    return rev;
+}
+
+/*
+ * With Y = conj(X[M-k]) and W = exp(-j 2 pi k / 2M), the DFTs of the even and odd output samples
+ * are E = (X[k] + Y) / 2 and O = (X[k] - Y) conj(W) / 2. The complex sequence is Z = E + j O, and
+ * the conjugate is returned (the factor 1/2 is part of the normalization).
+ */
+static inline Complex_type_f32 plp_rifft_pre(const Complex_type_f32 *pSrc,
+                                             const Complex_type_f32 *pTw,
+                                             uint32_t M,
+                                             uint32_t k) {
+    Complex_type_f32 x = pSrc[k];
+    Complex_type_f32 y = pSrc[M - k];
+    Complex_type_f32 w = pTw[k];
+    Complex_type_f32 result;
+
+    float32_t er = x.re + y.re;
+    float32_t ei = x.im - y.im;
+    float32_t dr = x.re - y.re;
+    float32_t di = x.im + y.im;
+
+    float32_t odr = dr * w.re + di * w.im;
+    float32_t odi = di * w.re - dr * w.im;
+
+    result.re = er - odi;
+    result.im = -(ei + odr);
+    return result;
+}
+
+static inline void plp_rifft_butterfly(Complex_type_f32 *pBuf,
+                                       const Complex_type_f32 *pTw,
+                                       uint32_t b,
+                                       uint32_t dist,
+                                       uint32_t twStep) {
+    uint32_t d = b & (dist - 1);
+    uint32_t i0 = ((b - d) << 1) + d;
+    uint32_t i1 = i0 + dist;
+
+    Complex_type_f32 a = pBuf[i0];
+    Complex_type_f32 c = pBuf[i1];
+    Complex_type_f32 w = pTw[d * twStep];
+    float32_t tr = a.re - c.re;
+    float32_t ti = a.im - c.im;
+
+    pBuf[i0].re = a.re + c.re;
+    pBuf[i0].im = a.im + c.im;
+    pBuf[i1].re = tr * w.re - ti * w.im;
+    pBuf[i1].im = tr * w.im + ti * w.re;
+}
+
+/*
+ * The FFT output is in bit-reversed order, n and its bit reversal are swapped by the one of them
+ * with the smaller index, such that the cores do not write to the same values.
+ */
+static inline void plp_rifft_post(const plp_fft_instance_f32 *S,
+                                  Complex_type_f32 *pBuf,
+                                  float32_t *pDst,
+                                  uint32_t n,
+                                  uint32_t log2M,
+                                  float32_t scale) {
+    uint32_t r = plp_rifft_bitrev(S, n, log2M);
+
+    if (r >= n) {
+        Complex_type_f32 fn = pBuf[n];
+        Complex_type_f32 fr = pBuf[r];
+
+        pDst[2 * n] = fr.re * scale;
+        pDst[2 * n + 1] = -fr.im * scale;
+        pDst[2 * r] = fn.re * scale;
+        pDst[2 * r + 1] = -fn.im * scale;
+    }
+}
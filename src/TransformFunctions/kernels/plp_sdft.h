@@ -0,0 +1,222 @@
+/* ----------------------------------------------------------------------
+ * Project:      PULP DSP Library
+ * Title:        plp_sdft.h
+ * Description:  Sliding DFT updates of one and two frequency bins
+ *
+ * $Date:        19. Oct 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __PLP_SDFT_H__
+#define __PLP_SDFT_H__
+
+#include "plp_math.h"
+
+/*
+ * All kernels update the state of bin k with Y += (x[n] - x[n-N]) e^(-j 2 pi k n / N), where
+ * n mod N is the position in the circular window. The samples are processed in chunks which do
+ * not wrap around the end of the window, such that x[n-N] is read from the window in order before
+ * x[n] overwrites it. m = k n mod N is the index of the twiddle factor.
+ */
+
+/*
+ * Updates the state pY of bin k with the chunk of len samples pSrc, which replace the samples pOld
+ * of the window, starting at the position pos.
+ */
+static inline void plp_sdft_update_f32(const float32_t *__restrict__ pSrc,
+                                       const float32_t *__restrict__ pOld,
+                                       uint32_t len,
+                                       uint32_t pos,
+                                       uint32_t N,
+                                       uint32_t k,
+                                       const float32_t *__restrict__ pTwiddles,
+                                       float32_t *__restrict__ pY) {
+    float32_t yr = pY[0];
+    float32_t yi = pY[1];
+    uint32_t m = (k * pos) % N;
+    uint32_t n;
+
+    for (n = 0; n < len; n++) {
+        float32_t d = pSrc[n] - pOld[n];
+        yr += d * pTwiddles[2 * m];
+        yi -= d * pTwiddles[2 * m + 1];
+        m += k;
+        if (m >= N) {
+            m -= N;
+        }
+    }
+    pY[0] = yr;
+    pY[1] = yi;
+}
+
+/*
+ * Updates the states pYa and pYb of the bins ka and kb, which share the loads of the samples and
+ * hide the latency of each other.
+ */
+static inline void plp_sdft_update2_f32(const float32_t *__restrict__ pSrc,
+                                        const float32_t *__restrict__ pOld,
+                                        uint32_t len,
+                                        uint32_t pos,
+                                        uint32_t N,
+                                        uint32_t ka,
+                                        uint32_t kb,
+                                        const float32_t *__restrict__ pTwiddles,
+                                        float32_t *__restrict__ pYa,
+                                        float32_t *__restrict__ pYb) {
+    float32_t ar = pYa[0];
+    float32_t ai = pYa[1];
+    float32_t br = pYb[0];
+    float32_t bi = pYb[1];
+    uint32_t ma = (ka * pos) % N;
+    uint32_t mb = (kb * pos) % N;
+    uint32_t n;
+
+    for (n = 0; n < len; n++) {
+        float32_t d = pSrc[n] - pOld[n];
+        ar += d * pTwiddles[2 * ma];
+        ai -= d * pTwiddles[2 * ma + 1];
+        br += d * pTwiddles[2 * mb];
+        bi -= d * pTwiddles[2 * mb + 1];
+        ma += ka;
+        if (ma >= N) {
+            ma -= N;
+        }
+        mb += kb;
+        if (mb >= N) {
+            mb -= N;
+        }
+    }
+    pYa[0] = ar;
+    pYa[1] = ai;
+    pYb[0] = br;
+    pYb[1] = bi;
+}
+
+/*
+ * Computes the bin X = Y e^(j 2 pi k pos / N) of the window which ends before the position pos.
+ */
+static inline void plp_sdft_bin_f32(const float32_t *__restrict__ pY,
+                                    uint32_t pos,
+                                    uint32_t N,
+                                    uint32_t k,
+                                    const float32_t *__restrict__ pTwiddles,
+                                    float32_t *__restrict__ pDst) {
+    uint32_t m = (k * pos) % N;
+    float32_t c = pTwiddles[2 * m];
+    float32_t s = pTwiddles[2 * m + 1];
+
+    pDst[0] = pY[0] * c - pY[1] * s;
+    pDst[1] = pY[0] * s + pY[1] * c;
+}
+
+/*
+ * Updates the state pY of bin k with the chunk of len Q1.15 samples. The products with the Q1.15
+ * twiddle factors are accumulated in Q2.30 without rounding, hence the state is exact.
+ */
+static inline void plp_sdft_update_q16(const int16_t *__restrict__ pSrc,
+                                       const int16_t *__restrict__ pOld,
+                                       uint32_t len,
+                                       uint32_t pos,
+                                       uint32_t N,
+                                       uint32_t k,
+                                       const int16_t *__restrict__ pTwiddles,
+                                       int64_t *__restrict__ pY) {
+    int64_t yr = pY[0];
+    int64_t yi = pY[1];
+    uint32_t m = (k * pos) % N;
+    uint32_t n;
+
+    for (n = 0; n < len; n++) {
+        int32_t d = pSrc[n] - pOld[n];
+        yr += d * pTwiddles[2 * m];
+        yi -= d * pTwiddles[2 * m + 1];
+        m += k;
+        if (m >= N) {
+            m -= N;
+        }
+    }
+    pY[0] = yr;
+    pY[1] = yi;
+}
+
+/*
+ * Updates the states pYa and pYb of the bins ka and kb, which share the loads of the samples and
+ * hide the latency of each other.
+ */
+static inline void plp_sdft_update2_q16(const int16_t *__restrict__ pSrc,
+                                        const int16_t *__restrict__ pOld,
+                                        uint32_t len,
+                                        uint32_t pos,
+                                        uint32_t N,
+                                        uint32_t ka,
+                                        uint32_t kb,
+                                        const int16_t *__restrict__ pTwiddles,
+                                        int64_t *__restrict__ pYa,
+                                        int64_t *__restrict__ pYb) {
+    int64_t ar = pYa[0];
+    int64_t ai = pYa[1];
+    int64_t br = pYb[0];
+    int64_t bi = pYb[1];
+    uint32_t ma = (ka * pos) % N;
+    uint32_t mb = (kb * pos) % N;
+    uint32_t n;
+
+    for (n = 0; n < len; n++) {
+        int32_t d = pSrc[n] - pOld[n];
+        ar += d * pTwiddles[2 * ma];
+        ai -= d * pTwiddles[2 * ma + 1];
+        br += d * pTwiddles[2 * mb];
+        bi -= d * pTwiddles[2 * mb + 1];
+        ma += ka;
+        if (ma >= N) {
+            ma -= N;
+        }
+        mb += kb;
+        if (mb >= N) {
+            mb -= N;
+        }
+    }
+    pYa[0] = ar;
+    pYa[1] = ai;
+    pYb[0] = br;
+    pYb[1] = bi;
+}
+
+/*
+ * Computes the bin X = Y e^(j 2 pi k pos / N) of the window which ends before the position pos,
+ * rounded from Q3.45 to Q1.15.
+ */
+static inline void plp_sdft_bin_q16(const int64_t *__restrict__ pY,
+                                    uint32_t pos,
+                                    uint32_t N,
+                                    uint32_t k,
+                                    const int16_t *__restrict__ pTwiddles,
+                                    int32_t *__restrict__ pDst) {
+    uint32_t m = (k * pos) % N;
+    int32_t c = pTwiddles[2 * m];
+    int32_t s = pTwiddles[2 * m + 1];
+
+    pDst[0] = (int32_t)((pY[0] * c - pY[1] * s + (1LL << 29)) >> 30);
+    pDst[1] = (int32_t)((pY[0] * s + pY[1] * c + (1LL << 29)) >> 30);
+}
+
+#endif // __PLP_SDFT_H__
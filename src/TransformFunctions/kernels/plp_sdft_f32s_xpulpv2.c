@@ -0,0 +1,103 @@
+/* ----------------------------------------------------------------------
+ * Project:      PULP DSP Library
+ * Title:        plp_sdft_f32s_xpulpv2.c
+ * Description:  Floating-point sliding DFT kernel for XPULPV2
+ *
+ * $Date:        19. Oct 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+#include "plp_sdft.h"
+
+/**
+  @ingroup groupTransforms
+ */
+
+/**
+  @addtogroup sdft
+  @{
+ */
+
+/**
+  @brief Floating-point sliding DFT for XPULPV2 extension.
+  @param[in,out] S          points to the sliding DFT instance
+  @param[in]     pSrc       points to the block of input samples
+  @param[in]     blockSize  number of samples
+  @param[out]    pDst       points to the output, real and imaginary part of every bin, or NULL
+  @return        none
+
+  The bins are updated two at a time, which shares the loads of the samples and hides the
+  latency of the accumulations.
+ */
+
+void plp_sdft_f32s_xpulpv2(plp_sdft_instance_f32 *S,
+                           const float32_t *__restrict__ pSrc,
+                           uint32_t blockSize,
+                           float32_t *__restrict__ pDst) {
+
+    uint32_t N = S->N;
+    uint32_t nBins = S->nBins;
+    const uint32_t *pBins = S->pBins;
+    const float32_t *pTwiddles = S->pTwiddles;
+    float32_t *pWindow = S->pWindow;
+    float32_t *pState = S->pState;
+    uint32_t pos = S->pos;
+    uint32_t k; // loop counter for the bins
+    uint32_t n; // loop counter for the samples
+
+    while (blockSize > 0) {
+        // chunk of samples up to the end of the circular window
+        uint32_t len = (N - pos < blockSize) ? N - pos : blockSize;
+
+        for (k = 0; k + 1 < nBins; k += 2) {
+            plp_sdft_update2_f32(pSrc, &pWindow[pos], len, pos, N, pBins[k], pBins[k + 1],
+                                 pTwiddles, &pState[2 * k], &pState[2 * (k + 1)]);
+        }
+        if (k < nBins) {
+            plp_sdft_update_f32(pSrc, &pWindow[pos], len, pos, N, pBins[k], pTwiddles,
+                                &pState[2 * k]);
+        }
+
+        for (n = 0; n < len; n++) {
+            pWindow[pos + n] = pSrc[n];
+        }
+
+        pSrc += len;
+        blockSize -= len;
+        pos += len;
+        if (pos == N) {
+            pos = 0;
+        }
+    }
+    S->pos = pos;
+
+    if (pDst != NULL) {
+        for (k = 0; k < nBins; k++) {
+            plp_sdft_bin_f32(&pState[2 * k], pos, N, pBins[k], pTwiddles, &pDst[2 * k]);
+        }
+    }
+}
+
+/**
+  @} end of sdft group
+ */
@@ -0,0 +1,96 @@
+/* ----------------------------------------------------------------------
+ * Project:      PULP DSP Library
+ * Title:        plp_sdft_q16s_rv32im.c
+ * Description:  16-bit fix-point sliding DFT kernel for RV32IM
+ *
+ * $Date:        19. Oct 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+#include "plp_sdft.h"
+
+/**
+  @ingroup groupTransforms
+ */
+
+/**
+  @addtogroup sdft
+  @{
+ */
+
+/**
+  @brief 16-bit fix-point sliding DFT for RV32IM extension.
+  @param[in,out] S          points to the sliding DFT instance
+  @param[in]     pSrc       points to the block of input samples in Q1.15 format
+  @param[in]     blockSize  number of samples
+  @param[out]    pDst       points to the output, real and imaginary part of every bin, or NULL
+  @return        none
+ */
+
+void plp_sdft_q16s_rv32im(plp_sdft_instance_q16 *S,
+                          const int16_t *__restrict__ pSrc,
+                          uint32_t blockSize,
+                          int32_t *__restrict__ pDst) {
+
+    uint32_t N = S->N;
+    uint32_t nBins = S->nBins;
+    const uint32_t *pBins = S->pBins;
+    const int16_t *pTwiddles = S->pTwiddles;
+    int16_t *pWindow = S->pWindow;
+    int64_t *pState = S->pState;
+    uint32_t pos = S->pos;
+    uint32_t k; // loop counter for the bins
+    uint32_t n; // loop counter for the samples
+
+    while (blockSize > 0) {
+        // chunk of samples up to the end of the circular window
+        uint32_t len = (N - pos < blockSize) ? N - pos : blockSize;
+
+        for (k = 0; k < nBins; k++) {
+            plp_sdft_update_q16(pSrc, &pWindow[pos], len, pos, N, pBins[k], pTwiddles,
+                                &pState[2 * k]);
+        }
+
+        for (n = 0; n < len; n++) {
+            pWindow[pos + n] = pSrc[n];
+        }
+
+        pSrc += len;
+        blockSize -= len;
+        pos += len;
+        if (pos == N) {
+            pos = 0;
+        }
+    }
+    S->pos = pos;
+
+    if (pDst != NULL) {
+        for (k = 0; k < nBins; k++) {
+            plp_sdft_bin_q16(&pState[2 * k], pos, N, pBins[k], pTwiddles, &pDst[2 * k]);
+        }
+    }
+}
+
+/**
+  @} end of sdft group
+ */
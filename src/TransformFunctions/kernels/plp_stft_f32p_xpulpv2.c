@@ -0,0 +1,118 @@
+/* ----------------------------------------------------------------------
+ * Project:      PULP DSP Library
+ * Title:        plp_stft_f32p_xpulpv2.c
+ * Description:  Parallel floating-point short-time Fourier transform for XPULPV2
+ *
+ * $Date:        19. Oct 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupTransforms
+ */
+
+/**
+  @addtogroup stft
+  @{
+ */
+
+/**
+   @brief      Floating-point short-time Fourier transform for XPULPV2 extension, the frames are
+               distributed over the cores.
+
+   Core c computes the frames c, c + nPE, ... without any barrier. It windows each frame from the
+   input into the first FFTLength floats of its part of pBuf, computes the real FFT into the
+   following 2*FFTLength floats with plp_rfft_f32_xpulpv2 and writes the first FFTLength / 2 + 1
+   bins to the output.
+
+   @param[in]  args  points to the plp_stft_instance_f32_parallel
+   @return     none
+*/
+void plp_stft_f32p_xpulpv2(void *args) {
+    plp_stft_instance_f32_parallel *a = (plp_stft_instance_f32_parallel *)args;
+    const plp_stft_instance_f32 *S = a->S;
+    const float32_t *pWindow = S->pWindow;
+    uint32_t N = S->S->FFTLength;
+    uint32_t nBins = N / 2 + 1;
+    uint32_t hopLen = S->hopLen;
+    plp_stft_output outType = S->outType;
+    uint32_t core_id = hal_core_id();
+    uint32_t nPE = a->nPE;
+    float32_t *pFrame = a->pBuf + core_id * 3 * N;
+    float32_t *pSpec = pFrame + N;
+    uint32_t t, n, k;
+
+    // complex values are two floats
+    uint32_t frameStride = S->frameStride;
+    uint32_t binStride = S->binStride;
+    if (outType == PLP_STFT_COMPLEX) {
+        frameStride *= 2;
+        binStride *= 2;
+    }
+
+    for (t = core_id; t < a->nFrames; t += nPE) {
+        const float32_t *pIn = a->pSrc + t * hopLen;
+        float32_t *pOut = a->pDst + t * frameStride;
+
+        for (n = 0; n < N; n += 2) {
+            float32_t x0 = pIn[n];
+            float32_t x1 = pIn[n + 1];
+            pFrame[n] = x0 * pWindow[n];
+            pFrame[n + 1] = x1 * pWindow[n + 1];
+        }
+
+        plp_rfft_f32_xpulpv2(S->S, pFrame, pSpec);
+
+        switch (outType) {
+        case PLP_STFT_COMPLEX:
+            for (k = 0; k < nBins; k++) {
+                pOut[0] = pSpec[2 * k];
+                pOut[1] = pSpec[2 * k + 1];
+                pOut += binStride;
+            }
+            break;
+        case PLP_STFT_MAGNITUDE:
+            for (k = 0; k < nBins; k++) {
+                float32_t re = pSpec[2 * k];
+                float32_t im = pSpec[2 * k + 1];
+                *pOut = sqrtf(re * re + im * im);
+                pOut += binStride;
+            }
+            break;
+        default:
+            for (k = 0; k < nBins; k++) {
+                float32_t re = pSpec[2 * k];
+                float32_t im = pSpec[2 * k + 1];
+                *pOut = re * re + im * im;
+                pOut += binStride;
+            }
+            break;
+        }
+    }
+}
+
+/**
+   @} end of stft group
+*/
@@ -0,0 +1,87 @@
+/* ----------------------------------------------------------------------
+ * Project:      PULP DSP Library
+ * Title:        plp_cfft_batch_f32.c
+ * Description:  Glue code for the batched floating-point complex FFT
+ *
+ * $Date:        19. Oct 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupTransforms
+ */
+
+/**
+   @addtogroup fft
+   @{
+*/
+
+/**
+   @brief Batch of floating-point FFTs on complex input data, one transform per core.
+
+   The parallel FFTs split a single transform across the cores and synchronize after every stage,
+   which dominates for small transforms. Here, every core computes whole transforms of the batch
+   (transform t on core t % nPE) without any barrier. With pBuf, each core prefetches its next
+   input frame into L1 with the DMA while it computes the current one, and writes the result back
+   to pDst in the background.
+
+   @param[in]   S       points to an instance of the floating-point FFT structure
+   @param[in]   pSrc    points to the first input frame (complex data)
+   @param[out]  pDst    points to the first output frame (complex data)
+   @param[in]   count   number of transforms
+   @param[in]   stride  distance between two frames in floats, at least 2*FFTLength
+   @param[in]   pBuf    points to an L1 buffer of 12*FFTLength*nPE floats for prefetching the
+                        frames with the DMA, or NULL to process the frames where they are
+   @param[in]   nPE     number of cores
+   @return      none
+*/
+void plp_cfft_batch_f32(const plp_fft_instance_f32 *S,
+                        const float32_t *pSrc,
+                        float32_t *pDst,
+                        uint32_t count,
+                        uint32_t stride,
+                        float32_t *pBuf,
+                        uint32_t nPE) {
+    PLP_PROFILE_FUNCTION();
+
+    if (hal_cluster_id() == ARCHI_FC_CID) {
+        printf("F extension is supported only for cluster side\n");
+        return;
+    }
+
+    plp_fft_batch_instance args = { .S = S,
+                                    .pSrc = pSrc,
+                                    .pDst = pDst,
+                                    .count = count,
+                                    .srcStride = stride,
+                                    .dstStride = stride,
+                                    .pBuf = pBuf,
+                                    .nPE = nPE };
+
+    hal_cl_team_fork(nPE, plp_cfft_batch_f32p_xpulpv2, (void *)&args);
+}
+
+/**
+   @} end of FFT group
+*/
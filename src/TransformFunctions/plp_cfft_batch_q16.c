@@ -0,0 +1,96 @@
+/* ----------------------------------------------------------------------
+ * Project:      PULP DSP Library
+ * Title:        plp_cfft_batch_q16.c
+ * Description:  Glue code for the batched 16-bit fixed-point complex FFT
+ *
+ * $Date:        19. Oct 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupTransforms
+ */
+
+/**
+   @addtogroup fft
+   @{
+*/
+
+/**
+   @brief Batch of 16-bit fixed-point in-place FFTs on complex data, one transform per core.
+
+   Every core computes whole transforms of the batch (transform t on core t % nPE) with
+   plp_cfft_q16s_xpulpv2, without any barrier. The output of each transform has the same format
+   as the one of plp_cfft_q16. With pBuf, each core prefetches its next frame into L1 with the DMA
+   while it computes the current one. On the fabric controller, the transforms are computed one
+   after the other and pBuf is not used.
+
+   @param[in]     S               points to an instance of the 16bit quantized CFFT structure
+   @param[in,out] p1              points to the first frame (complex data)
+   @param[in]     count           number of transforms
+   @param[in]     stride          distance between two frames in values, at least 2*fftLen
+   @param[in]     ifftFlag        flag that selects forward (ifftFlag=0) or inverse (ifftFlag=1)
+   @param[in]     bitReverseFlag  flag that enables (bitReverseFlag=1) the bit reversal of output
+   @param[in]     deciPoint       decimal point for right shift
+   @param[in]     pBuf            points to an L1 buffer of 6*fftLen*nPE values for prefetching
+                                  the frames with the DMA, or NULL to process the frames in place
+   @param[in]     nPE             number of cores
+   @return        none
+*/
+void plp_cfft_batch_q16(const plp_cfft_instance_q16 *S,
+                        int16_t *p1,
+                        uint32_t count,
+                        uint32_t stride,
+                        uint8_t ifftFlag,
+                        uint8_t bitReverseFlag,
+                        uint32_t deciPoint,
+                        int16_t *pBuf,
+                        uint32_t nPE) {
+    PLP_PROFILE_FUNCTION();
+
+    if (hal_cluster_id() == ARCHI_FC_CID) {
+        uint32_t t;
+        for (t = 0; t < count; t++) {
+            plp_cfft_q16s_rv32im(S, p1 + t * stride, ifftFlag, bitReverseFlag, deciPoint);
+        }
+    } else {
+        plp_fft_batch_instance args = { .S = S,
+                                        .pSrc = p1,
+                                        .pDst = p1,
+                                        .count = count,
+                                        .srcStride = stride,
+                                        .dstStride = stride,
+                                        .ifftFlag = ifftFlag,
+                                        .bitReverseFlag = bitReverseFlag,
+                                        .fracBits = deciPoint,
+                                        .pBuf = pBuf,
+                                        .nPE = nPE };
+
+        hal_cl_team_fork(nPE, plp_cfft_batch_q16p_xpulpv2, (void *)&args);
+    }
+}
+
+/**
+   @} end of FFT group
+*/
@@ -0,0 +1,72 @@
+/* ----------------------------------------------------------------------
+ * Project:      PULP DSP Library
+ * Title:        plp_cfft_bfp_q16.c
+ * Description:  16-bit block-floating-point complex FFT glue code
+ *
+ * $Date:        19. Oct 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup fft
+ * @{
+ */
+
+/**
+ * @brief      Glue code for the block-floating-point quantized 16 bit complex fast fourier
+ *             transform. Instead of scaling every stage down by its radix like plp_cfft_q16, each
+ *             stage tracks the maximum magnitude of its outputs and the next stage is only scaled
+ *             down if it could overflow. Low-amplitude inputs are scaled up to use the headroom.
+ *             The output X satisfies <code>spectrum = X * 2^(*pExponent)</code>, with X in the same
+ *             fixed-point format as the input. For comparison, plp_cfft_q16 always returns the
+ *             spectrum divided by fftLen, i.e. an exponent of log2(fftLen).
+ * @param[in]     S               points to an instance of the 16bit quantized CFFT structure
+ * @param[in,out] p1              points to the complex data buffer of size <code>2*fftLen</code>.
+ * Processing occurs in-place.
+ * @param[in]     bitReverseFlag  flag that enables (bitReverseFlag=1) of disables
+ * (bitReverseFlag=0) bit reversal of output.
+ * @param[out]    pExponent       points to the exponent of the output block
+ * @return        none
+ */
+
+void plp_cfft_bfp_q16(const plp_cfft_instance_q16 *S,
+                      int16_t *p1,
+                      uint8_t bitReverseFlag,
+                      int32_t *pExponent) {
+    PLP_PROFILE_FUNCTION();
+
+    if (hal_cluster_id() == ARCHI_FC_CID) {
+        plp_cfft_bfp_q16s_rv32im(S, p1, bitReverseFlag, pExponent);
+    } else {
+        plp_cfft_bfp_q16s_xpulpv2(S, p1, bitReverseFlag, pExponent);
+    }
+}
+
+/**
+ * @} end of FFT group
+ */
@@ -0,0 +1,80 @@
+/* ----------------------------------------------------------------------
+ * Project:      PULP DSP Library
+ * Title:        plp_cfft_bfp_q16_parallel.c
+ * Description:  Parallel 16-bit block-floating-point complex FFT glue code
+ *
+ * $Date:        19. Oct 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup fft
+ * @{
+ */
+
+/**
+ * @brief      Glue code for the parallel block-floating-point quantized 16 bit complex fast fourier
+ *             transform, see plp_cfft_bfp_q16.
+ * @param[in]     S               points to an instance of the 16bit quantized CFFT structure
+ * @param[in,out] p1              points to the complex data buffer of size <code>2*fftLen</code>.
+ * Processing occurs in-place.
+ * @param[in]     bitReverseFlag  flag that enables (bitReverseFlag=1) of disables
+ * (bitReverseFlag=0) bit reversal of output.
+ * @param[in]     nPE             number of cores to use
+ * @param[out]    pExponent       points to the exponent of the output block
+ * @return        none
+ */
+
+void plp_cfft_bfp_q16_parallel(const plp_cfft_instance_q16 *S,
+                               int16_t *p1,
+                               uint8_t bitReverseFlag,
+                               uint32_t nPE,
+                               int32_t *pExponent) {
+    PLP_PROFILE_FUNCTION();
+
+    if (hal_cluster_id() == ARCHI_FC_CID) {
+        printf("parallel processing supported only for cluster side\n");
+        return;
+    }
+
+    int32_t range[2 * nPE];
+    plp_cfft_bfp_instance_q16_parallel args = {
+        .S = S,
+        .p1 = p1,
+        .bitReverseFlag = bitReverseFlag,
+        .pExponent = pExponent,
+        .pRange = range,
+        .nPE = nPE,
+    };
+
+    hal_cl_team_fork(nPE, plp_cfft_bfp_q16p_xpulpv2, (void *)&args);
+}
+
+/**
+ * @} end of FFT group
+ */
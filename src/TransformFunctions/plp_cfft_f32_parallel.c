@@ -58,6 +58,7 @@ void plp_cfft_f32_parallel(const plp_fft_instance_f32 *S,
                            const float32_t *__restrict__ pSrc,
                            const uint32_t nPE,
                            float32_t *__restrict__ pDst) {
+    PLP_PROFILE_FUNCTION();
 
     if (hal_cluster_id() == ARCHI_FC_CID) {
         printf("Parallel processing supported only for cluster side\n");
@@ -56,6 +56,7 @@ void plp_cfft_q16(const plp_cfft_instance_q16 *S,
                   uint8_t ifftFlag,
                   uint8_t bitReverseFlag,
                   uint32_t deciPoint) {
+    PLP_PROFILE_FUNCTION();
 
     // if (deciPoint != 15) {
     //     printf("Only Q1.15 fixed point supported currently.\n");
@@ -71,6 +71,7 @@ void plp_cfft_q16_parallel(const plp_cfft_instance_q16 *S,
                            uint8_t bitReverseFlag,
                            uint32_t deciPoint,
                            uint32_t nPE){
+    PLP_PROFILE_FUNCTION();
 
 	if (hal_cluster_id() == ARCHI_FC_CID) {
         printf("parallel processing supported only for cluster side\n");
@@ -0,0 +1,71 @@
+/* ----------------------------------------------------------------------
+ * Project:      PULP DSP Library
+ * Title:        plp_cfft_stockham_q16_parallel.c
+ * Description:  Parallel 16-bit fixed-point Stockham complex FFT glue code
+ *
+ * $Date:        19. Oct 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup fft
+ * @{
+ */
+
+/**
+ * @brief      Glue code for the parallel quantized 16 bit Stockham complex fast fourier transform
+ * @param[in]  S       points to an instance of the 16bit quantized CFFT structure
+ * @param[in]  pSrc    points to the input buffer of size <code>2*fftLen</code>, it is not modified
+ * @param[in]  pBuf    points to a temporary buffer of size <code>2*fftLen</code>
+ * @param[in]  nPE     number of cores to use
+ * @param[out] pDst    points to the output buffer of size <code>2*fftLen</code>
+ * @return     none
+ */
+
+void plp_cfft_stockham_q16_parallel(const plp_cfft_instance_q16 *S,
+                                    const int16_t *__restrict__ pSrc,
+                                    int16_t *__restrict__ pBuf,
+                                    uint32_t nPE,
+                                    int16_t *__restrict__ pDst) {
+    PLP_PROFILE_FUNCTION();
+
+    if (hal_cluster_id() == ARCHI_FC_CID) {
+        printf("parallel processing supported only for cluster side\n");
+        return;
+    }
+
+    plp_cfft_stockham_instance_q16_parallel args = {
+        .S = S, .pSrc = pSrc, .pBuf = pBuf, .pDst = pDst, .nPE = nPE
+    };
+
+    hal_cl_team_fork(nPE, plp_cfft_stockham_q16p_xpulpv2, (void *)&args);
+}
+
+/**
+ * @} end of FFT group
+ */
@@ -73,42 +73,46 @@ void plp_dct2_f32_parallel(const plp_fft_instance_f32 *S,
 		  	   const uint32_t nPE,
                   	   float32_t *__restrict__ pBuf,
                   	   float32_t *__restrict__ pDst) {
+    PLP_PROFILE_FUNCTION();
 
-    // 1: reordering (moves input from pSrc to pDst)
     uint32_t N = S->FFTLength;
-    // write odd indices from Src into buffer
-    for (int i=0;i<N/2;i++){
-	pBuf[i] = pSrc[2*i + 1];
-    }
-    // squeeze remaining even indices closer together (decimate signal to odd indices) and write into Dst
-    for (int i=0;i<N/2;i++){
-	pDst[i] = pSrc[2*i];
-    }
-    // reverse and write saved odd indices into second half of Dst
-    for (int i=0;i<N/2;i++){
-	pDst[N/2+i] = pBuf[N/2-1-i];
+    float32_t scale = orthoNorm ? sqrtf(2.f / (float32_t)N) : 2.f;
+    float32_t re, im;
+    uint32_t i;
+
+    // 1: reordering (moves input from pSrc to pDst), v[i] = x[2i] and v[N-1-i] = x[2i+1]
+    if (pSrc != pDst) {
+        for (i = 0; i < N / 2; i++) {
+            pDst[i] = pSrc[2 * i];
+            pDst[N - 1 - i] = pSrc[2 * i + 1];
+        }
+    } else {
+        // in place: squeeze the even indices to the front and save the odd ones in the buffer,
+        // the even index 2i is read before index i is overwritten
+        for (i = 0; i < N / 2; i++) {
+            pBuf[i] = pSrc[2 * i + 1];
+            pDst[i] = pSrc[2 * i];
+        }
+        for (i = 0; i < N / 2; i++) {
+            pDst[N - 1 - i] = pBuf[i];
+        }
     }
-    // 2: RFFT of reordered sequence, result written into buffer
+    // 2: RFFT of reordered sequence, the first N/2+1 complex values are written into buffer
     plp_rfft_f32_parallel(S, pDst, nPE, pBuf);
-    // RFFT must be extended to all FFTLength complex coefficients,
-    // using X[k] = X*[-k] for real x[t]
-    for (int i=0;i<N/2-1;i++) {
-	pBuf[2*(N/2+1+i)] = pBuf[2*(N/2-1-i)];
-	pBuf[2*(N/2+1+i)+1] = (-1)*pBuf[2*(N/2-1-i)+1];
-    }
-    // 3: shift FFT in place in buffer
-    plp_cmplx_mult_cmplx_f32(pBuf, (float32_t*)pShift, pBuf, N);
-    // 4: take real part, moving from buffer to output
-    for (int i=0;i<N;i++){
-	pDst[i] = pBuf[2*i];
+    // 3: shift the FFT, take the real part and scale, in a single pass from buffer to output.
+    // The upper half of the spectrum follows from X[N-k] = X*[k] for real x[t]
+    pDst[0] = scale * pShift[0].re * pBuf[0];
+    for (i = 1; i <= N / 2; i++) {
+        re = pBuf[2 * i];
+        im = pBuf[2 * i + 1];
+        pDst[i] = scale * (pShift[i].re * re - pShift[i].im * im);
+        if (i < N / 2) {
+            pDst[N - i] = scale * (pShift[N - i].re * re + pShift[N - i].im * im);
+        }
     }
-    // 5: multiply by 2 or normalise in place in output buffer
     if (orthoNorm) {
-	pDst[0] *= M_SQRT1_2;
-	plp_scale_f32(pDst, sqrtf(2.f/(float32_t)N), pDst, N);
+        pDst[0] *= M_SQRT1_2;
     }
-    else
-    	plp_scale_f32(pDst, 2, pDst, N);
 }
 
 /**
@@ -0,0 +1,132 @@
+/* ----------------------------------------------------------------------
+ * Project:      PULP DSP Library
+ * Title:        plp_dct2_q16.c
+ * Description:  16-bit fixed-point DCT-II glue code
+ *
+ * $Date:        19. Oct 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup fft
+ * @{
+ */
+
+/**
+ * @brief      Glue code for the quantized 16 bit DCT-II on real input data.
+ *
+ * The input x is reordered into v = (x[0], x[2], ..., x[N-2], x[N-1], ..., x[3], x[1]), and v is
+ * transformed as a complex sequence of length N/2 with plp_cfft_q16 (Makhoul, "A Fast Cosine
+ * Transform in One and Two Dimensions", 1980). The spectrum V of v is then split from the complex
+ * spectrum and rotated: <code>pDst[k] = Re(exp(-j pi k / (2N)) V[k])</code>. The reordering and the
+ * split with the rotation are each done in a single pass.
+ *
+ * The output has the same fixed-point format as the input:
+ * <code>pDst[k] = 1/N sum_n pSrc[n] cos(pi k (2n+1) / (2N))</code>.
+ *
+ * @param[in]   S       points to an instance of the 16bit quantized DCT structure, use one of the
+ *                      constant instances plp_dct_sR_q16_len32 to plp_dct_sR_q16_len1024
+ * @param[in]   pSrc    points to the input buffer (real data) of size dctLen
+ * @param[in]   pBuf    points to a buffer of size dctLen, used for computation
+ * @param[out]  pDst    points to the output buffer (real data) of size dctLen, may be the same as
+ *                      pSrc
+ * @return      none
+ */
+
+void plp_dct2_q16(const plp_dct_instance_q16 *S,
+                  const int16_t *pSrc,
+                  int16_t *__restrict__ pBuf,
+                  int16_t *pDst) {
+    PLP_PROFILE_FUNCTION();
+
+    uint32_t N = S->dctLen;
+    uint32_t n2 = N >> 1;
+    const int16_t *pCoef = S->pTwiddleRFFT;
+    const int16_t *pRot = S->pTwiddleDCT;
+    int32_t ar, ai, br, bi, er, ei, hr, hi, yr, yi, xr, xi;
+    int32_t co, si;
+    uint32_t k, l;
+
+    /* v[n] = x[2n], v[N-1-n] = x[2n+1], the complex input is z[n] = v[2n] + j v[2n+1] */
+    for (k = 0; k < n2; k++) {
+        pBuf[k] = pSrc[2 * k];
+        pBuf[N - 1 - k] = pSrc[2 * k + 1];
+    }
+
+    plp_cfft_q16(S->pCfft, pBuf, 0, 1, 15);
+
+    /*
+     * Split of the complex spectrum Z (see plp_rfft_q16) into V[k] / N and V[N/2-k] / N, followed
+     * by the rotations T[k] = exp(-j pi k / (2N)) = pRot[4k] - j pRot[4k+1]:
+     * pDst[k] = Re(T[k] V[k]) and pDst[N-k] = -Im(T[k] V[k]).
+     */
+    ar = pBuf[0];
+    ai = pBuf[1];
+    pDst[0] = (int16_t)((ar + ai) >> 1);
+    pDst[n2] = (int16_t)((((ar - ai) >> 1) * pRot[2 * N] + (1 << 14)) >> 15);
+
+    for (k = 1; k <= (n2 >> 1); k++) {
+        l = n2 - k;
+
+        co = pCoef[2 * k];
+        si = pCoef[2 * k + 1];
+
+        ar = pBuf[2 * k] >> 1;
+        ai = pBuf[2 * k + 1] >> 1;
+        br = pBuf[2 * l] >> 1;
+        bi = pBuf[2 * l + 1] >> 1;
+
+        er = ar + br;
+        ei = ai - bi;
+        hr = ar - br;
+        hi = ai + bi;
+
+        yr = (co * hr + si * hi) >> 15;
+        yi = (co * hi - si * hr) >> 15;
+
+        /* V[k] */
+        xr = (er + yi) >> 1;
+        xi = (ei - yr) >> 1;
+        co = pRot[4 * k];
+        si = pRot[4 * k + 1];
+        pDst[k] = (int16_t)__CLIP((co * xr + si * xi + (1 << 14)) >> 15, 15);
+        pDst[N - k] = (int16_t)__CLIP((si * xr - co * xi + (1 << 14)) >> 15, 15);
+
+        /* V[N/2-k] */
+        xr = (er - yi) >> 1;
+        xi = (-ei - yr) >> 1;
+        co = pRot[4 * l];
+        si = pRot[4 * l + 1];
+        pDst[l] = (int16_t)__CLIP((co * xr + si * xi + (1 << 14)) >> 15, 15);
+        pDst[N - l] = (int16_t)__CLIP((si * xr - co * xi + (1 << 14)) >> 15, 15);
+    }
+}
+
+/**
+ * @} end of FFT group
+ */
@@ -0,0 +1,97 @@
+/* ----------------------------------------------------------------------
+ * Project:      PULP DSP Library
+ * Title:        plp_dct4_q32.c
+ * Description:  32-bit fixed-point DCT-IV glue code
+ *
+ * $Date:        19. Oct 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup fft
+ * @{
+ */
+
+/**
+ * @brief      Glue code for the quantized 32 bit DCT-IV on real input data.
+ *
+ * The input is folded into the complex sequence u[n] = (x[2n] + j x[N-1-2n]) exp(-j pi (4n+1) /
+ * (4N)) of length N/2, which is transformed with plp_cfft_q32. The output follows from the
+ * rotated spectrum c[k] = U[k] exp(-j pi k / N): <code>pDst[2k] = Re(c[k])</code> and
+ * <code>pDst[N-1-2k] = -Im(c[k])</code>. The DCT-IV is the core of the MDCT.
+ *
+ * The output has the same fixed-point format as the input:
+ * <code>pDst[k] = 1/N sum_n pSrc[n] cos(pi (n+1/2) (k+1/2) / N)</code>.
+ *
+ * @param[in]   S       points to an instance of the 32bit quantized DCT structure, use one of the
+ *                      constant instances plp_dct_sR_q32_len32 to plp_dct_sR_q32_len1024
+ * @param[in]   pSrc    points to the input buffer (real data) of size dctLen
+ * @param[in]   pBuf    points to a buffer of size dctLen, used for computation
+ * @param[out]  pDst    points to the output buffer (real data) of size dctLen, may be the same as
+ *                      pSrc
+ * @return      none
+ */
+
+void plp_dct4_q32(const plp_dct_instance_q32 *S,
+                  const int32_t *pSrc,
+                  int32_t *__restrict__ pBuf,
+                  int32_t *pDst) {
+    PLP_PROFILE_FUNCTION();
+
+    uint32_t N = S->dctLen;
+    uint32_t n2 = N >> 1;
+    const int32_t *pRot = S->pTwiddleDCT;
+    int32_t ar, ai, co, si;
+    uint32_t k;
+
+    /* pre-rotation with exp(-j pi (4n+1) / (4N)), the factor 1/2 keeps the scaling of the FFT */
+    for (k = 0; k < n2; k++) {
+        ar = pSrc[2 * k];
+        ai = pSrc[N - 1 - 2 * k];
+        co = pRot[8 * k + 2];
+        si = pRot[8 * k + 3];
+        pBuf[2 * k] = (int32_t)(((int64_t)co * ar + (int64_t)si * ai + 0x80000000LL) >> 32);
+        pBuf[2 * k + 1] = (int32_t)(((int64_t)co * ai - (int64_t)si * ar + 0x80000000LL) >> 32);
+    }
+
+    plp_cfft_q32(S->pCfft, pBuf, 0, 1, 31);
+
+    /* post-rotation with exp(-j pi k / N) */
+    for (k = 0; k < n2; k++) {
+        ar = pBuf[2 * k];
+        ai = pBuf[2 * k + 1];
+        co = pRot[8 * k];
+        si = pRot[8 * k + 1];
+        pDst[2 * k] = (int32_t)(((int64_t)co * ar + (int64_t)si * ai + 0x40000000LL) >> 31);
+        pDst[N - 1 - 2 * k] = (int32_t)(((int64_t)si * ar - (int64_t)co * ai + 0x40000000LL) >> 31);
+    }
+}
+
+/**
+ * @} end of FFT group
+ */
@@ -67,6 +67,7 @@ void plp_dwt_f32(const float32_t *__restrict__ pSrc,
                  plp_dwt_extension_mode mode,
                  float32_t *__restrict__ pDstA,
                  float32_t *__restrict__ pDstD) {
+    PLP_PROFILE_FUNCTION();
 
    if((mode == PLP_DWT_MODE_ANTIREFLECT || mode == PLP_DWT_MODE_REFLECT) && length <= 1){
       printf("F Cannot run [anti]reflect mode on length 1 signal.\n");
@@ -116,6 +117,7 @@ void plp_dwt_dec_f32(const float32_t *__restrict__ pSrc,
                      uint32_t level,
                      float32_t *__restrict__ pTemp,
                      float32_t *__restrict__ pDst){
+    PLP_PROFILE_FUNCTION();
    if((mode == PLP_DWT_MODE_ANTIREFLECT || mode == PLP_DWT_MODE_REFLECT) && length <= 1){
       printf("F Cannot run [anti]reflect mode on length 1 signal.\n");
       return;
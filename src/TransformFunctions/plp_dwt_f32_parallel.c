@@ -66,6 +66,7 @@ void plp_dwt_f32_parallel(const float32_t *__restrict__ pSrc,
                  uint32_t nPE,
                  float32_t *__restrict__ pDstA,
                  float32_t *__restrict__ pDstD) {
+    PLP_PROFILE_FUNCTION();
 
    if((mode == PLP_DWT_MODE_ANTIREFLECT || mode == PLP_DWT_MODE_REFLECT) && length <= 1){
       printf("F Cannot run [anti]reflect mode on length 1 signal.\n");
@@ -130,6 +131,7 @@ void plp_dwt_dec_f32_parallel(const float32_t *__restrict__ pSrc,
                      uint32_t nPE,
                      float32_t *__restrict__ pTemp,
                      float32_t *__restrict__ pDst){
+    PLP_PROFILE_FUNCTION();
    if((mode == PLP_DWT_MODE_ANTIREFLECT || mode == PLP_DWT_MODE_REFLECT) && length <= 1){
       printf("F Cannot run [anti]reflect mode on length 1 signal.\n");
       return;
@@ -66,6 +66,7 @@ void plp_dwt_q16_parallel(const int16_t *__restrict__ pSrc,
                  uint32_t nPE,
                  int16_t *__restrict__ pDstA,
                  int16_t *__restrict__ pDstD) {
+    PLP_PROFILE_FUNCTION();
 
    if((mode == PLP_DWT_MODE_ANTIREFLECT || mode == PLP_DWT_MODE_REFLECT) && length <= 1){
       printf("F Cannot run [anti]reflect mode on length 1 signal.\n");
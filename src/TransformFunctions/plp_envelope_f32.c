@@ -0,0 +1,72 @@
+/* ----------------------------------------------------------------------
+ * Project:      PULP DSP Library
+ * Title:        plp_envelope_f32.c
+ * Description:  Floating-point envelope detector glue code
+ *
+ * $Date:        19. Oct 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupTransforms
+ */
+
+/**
+  @addtogroup hilbert
+  @{
+ */
+
+/**
+  @brief Glue code for the floating-point envelope of a block, the magnitude of its analytic
+         signal.
+  @param[in]  S     points to the floating-point FFT instance of length N, e.g.
+                    plp_rfft_sR_f32_len512
+  @param[in]  pSrc  points to the block of N real samples
+  @param[in]  pBuf  points to the temporary buffer of 2*N floats
+  @param[out] pDst  points to the envelope of N values
+  @return     none
+ */
+
+void plp_envelope_f32(const plp_fft_instance_f32 *S,
+                      const float32_t *__restrict__ pSrc,
+                      float32_t *__restrict__ pBuf,
+                      float32_t *__restrict__ pDst) {
+    PLP_PROFILE_FUNCTION();
+
+    if (hal_cluster_id() == ARCHI_FC_CID) {
+        printf("Floating point is supported only for cluster side\n");
+        return;
+    }
+
+    // plp_rfft_f32 and plp_rifft_f32 need bitReverseFlag = 1, which the shipped instances
+    // plp_rfft_sR_f32_len* leave disabled
+    plp_fft_instance_f32 fft = *S;
+    fft.bitReverseFlag = 1;
+
+    plp_hilbert_f32s_xpulpv2(&fft, pSrc, pBuf, NULL, pDst);
+}
+
+/**
+  @} end of hilbert group
+ */
@@ -0,0 +1,92 @@
+/* ----------------------------------------------------------------------
+ * Project:      PULP DSP Library
+ * Title:        plp_goertzel_f32.c
+ * Description:  Floating-point Goertzel algorithm glue code
+ *
+ * $Date:        19. Oct 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupTransforms
+ */
+
+/**
+  @defgroup goertzel Goertzel algorithm
+  The Goertzel algorithm computes a few frequency bins of a block of N real samples, e.g. the
+  eight tones of DTMF or the harmonics of the power line, at a cost of N multiplications per bin
+  instead of a full FFT. For the frequency w = 2 pi f (f in cycles per sample), each bin runs the
+  recursion s[n] = x[n] + 2 cos(w) s[n-1] - s[n-2] over the block and computes
+
+      X = (cos(w) s[N-1] - s[N-2]) + j sin(w) s[N-1] = sum_n x[n] e^(-j w (n - N)).
+
+  For f = k / N, this is bin k of the DFT of the block (not scaled by 1/N, unlike the output of
+  plp_cfft_q16). For other frequencies, X has the magnitude of the DTFT at f and its phase is
+  rotated by w N. The output stores the real and imaginary part of every bin, e.g.
+  plp_cmplx_mag_squared_f32 gives the power for tone detection.
+
+  The frequencies do not need to be bins of the DFT of the block. plp_goertzel_init_f32 computes
+  cos(w) and sin(w) of every frequency with cosf and sinf, the fix-point versions round them to
+  Q2.30, in which cos(w) = 1 and -1 are exact. An error e of cos(w) moves the frequency of the
+  recursion by about e / sin(w), hence the low bins of long blocks are the least precise ones, in
+  particular in the floating-point version. The parallel functions distribute the bins among the
+  cores, and every core computes two bins at a time to share the loads of the samples.
+
+  The fix-point versions keep the state in 32 bits, and shift the samples by `shift` bits to the
+  right before the recursion. The state of a bin grows up to N / |sin(w)| times the largest sample
+  (N^2 / 2 for w = 0), set `shift` such that it does not overflow. The output is in the format of
+  the input, multiplied by 2^-shift.
+ */
+
+/**
+  @addtogroup goertzel
+  @{
+ */
+
+/**
+  @brief Glue code for the floating-point Goertzel algorithm.
+  @param[in]  S          points to the Goertzel instance
+  @param[in]  pSrc       points to the block of input samples
+  @param[in]  blockSize  number of samples
+  @param[out] pDst       points to the output, real and imaginary part of every bin
+  @return     none
+ */
+
+void plp_goertzel_f32(const plp_goertzel_instance_f32 *S,
+                      const float32_t *__restrict__ pSrc,
+                      uint32_t blockSize,
+                      float32_t *__restrict__ pDst) {
+    PLP_PROFILE_FUNCTION();
+
+    if (hal_cluster_id() == ARCHI_FC_CID) {
+        printf("Floating point is supported only for cluster side\n");
+        return;
+    } else {
+        plp_goertzel_f32s_xpulpv2(S, pSrc, blockSize, pDst);
+    }
+}
+
+/**
+  @} end of goertzel group
+ */
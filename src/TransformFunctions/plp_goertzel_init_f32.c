@@ -0,0 +1,75 @@
+/* ----------------------------------------------------------------------
+ * Project:      PULP DSP Library
+ * Title:        plp_goertzel_init_f32.c
+ * Description:  Initialization of the floating-point Goertzel algorithm
+ *
+ * $Date:        19. Oct 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupTransforms
+ */
+
+/**
+  @addtogroup goertzel
+  @{
+ */
+
+/**
+  @brief      Initializes the instance of the floating-point Goertzel algorithm and computes
+              the coefficients of the frequencies.
+  @param[out] S        points to the Goertzel instance
+  @param[in]  pFreqs   points to the frequencies in cycles per sample, in [0, 1)
+  @param[in]  nBins    number of frequencies
+  @param[out] pCoeffs  points to the buffer of 2*nBins coefficients, cos(w) and sin(w) of
+                       every frequency
+  @return     none
+
+  The frequency of bin k of an N-point DFT is k / N. The coefficients are computed with cosf and
+  sinf, since an error of the cosine shifts the frequency of the recursion by about
+  err / sin(w), which the interpolation in sinTable_f32 exceeds for low frequencies.
+ */
+
+void plp_goertzel_init_f32(plp_goertzel_instance_f32 *S,
+                           const float32_t *pFreqs,
+                           uint32_t nBins,
+                           float32_t *pCoeffs) {
+    PLP_PROFILE_FUNCTION();
+
+    uint32_t k;
+
+    for (k = 0; k < nBins; k++) {
+        float32_t w = 2.0f * 3.14159265f * pFreqs[k];
+        pCoeffs[2 * k] = cosf(w);
+        pCoeffs[2 * k + 1] = sinf(w);
+    }
+
+    S->nBins = nBins;
+    S->pCoeffs = pCoeffs;
+}
+
+/**
+  @} end of goertzel group
+ */
@@ -0,0 +1,82 @@
+/* ----------------------------------------------------------------------
+ * Project:      PULP DSP Library
+ * Title:        plp_goertzel_init_q16.c
+ * Description:  Initialization of the 16-bit fix-point Goertzel algorithm
+ *
+ * $Date:        19. Oct 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupTransforms
+ */
+
+/**
+  @addtogroup goertzel
+  @{
+ */
+
+/**
+  @brief      Initializes the instance of the 16-bit fix-point Goertzel algorithm and computes
+              the coefficients of the frequencies.
+  @param[out] S        points to the Goertzel instance
+  @param[in]  pFreqs   points to the frequencies in cycles per sample, in Q1.15 format in
+                       [0, 1)
+  @param[in]  nBins    number of frequencies
+  @param[out] pCoeffs  points to the buffer of 2*nBins coefficients, cos(w) and sin(w) of
+                       every frequency in Q2.30 format
+  @return     none
+
+  The frequency of bin k of an N-point DFT is k / N. An error e of cos(w) shifts the frequency of
+  the recursion by about e / sin(w), which for the low bins of long blocks is a large fraction of
+  the bin spacing already with the rounding error of Q1.15. The coefficients are therefore stored
+  in Q2.30, which also represents cos(w) = 1 and -1 exactly, and are computed with cos and sin in
+  double precision, since cosf does not reach this precision.
+ */
+
+static int32_t plp_goertzel_to_q30(double v) {
+    return (int32_t)(int64_t)(v * 1073741824.0 + (v < 0.0 ? -0.5 : 0.5));
+}
+
+void plp_goertzel_init_q16(plp_goertzel_instance_q16 *S,
+                           const int16_t *pFreqs,
+                           uint32_t nBins,
+                           int32_t *pCoeffs) {
+    PLP_PROFILE_FUNCTION();
+
+    uint32_t k;
+
+    for (k = 0; k < nBins; k++) {
+        double w = 2.0 * 3.14159265358979 * (double)pFreqs[k] / 32768.0;
+        pCoeffs[2 * k] = plp_goertzel_to_q30(cos(w));
+        pCoeffs[2 * k + 1] = plp_goertzel_to_q30(sin(w));
+    }
+
+    S->nBins = nBins;
+    S->pCoeffs = pCoeffs;
+}
+
+/**
+  @} end of goertzel group
+ */
@@ -0,0 +1,83 @@
+/* ----------------------------------------------------------------------
+ * Project:      PULP DSP Library
+ * Title:        plp_goertzel_q16_parallel.c
+ * Description:  Parallel 16-bit fix-point Goertzel algorithm glue code
+ *
+ * $Date:        19. Oct 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupTransforms
+ */
+
+/**
+  @addtogroup goertzel
+  @{
+ */
+
+/**
+  @brief Glue code for the parallel 16-bit fix-point Goertzel algorithm, the bins are
+         distributed among the cores.
+  @param[in]  S          points to the Goertzel instance
+  @param[in]  pSrc       points to the block of input samples
+  @param[in]  blockSize  number of samples
+  @param[in]  shift      Amount to shift the samples to the right
+  @param[in]  nPE        Number of cores to use
+  @param[out] pDst       points to the output, real and imaginary part of every bin
+  @return     none
+
+  @par Fix-Point and Shifting
+  The samples are shifted by `shift` bits to the right before the recursion, and the output is in
+  the format of the input, multiplied by 2^-shift. The 32-bit state grows up to N / |sin(w)| times
+  the largest sample, set `shift` such that it does not overflow.
+ */
+
+void plp_goertzel_q16_parallel(const plp_goertzel_instance_q16 *S,
+                               const int16_t *__restrict__ pSrc,
+                               uint32_t blockSize,
+                               uint32_t shift,
+                               uint32_t nPE,
+                               int32_t *__restrict__ pDst) {
+    PLP_PROFILE_FUNCTION();
+
+    if (hal_cluster_id() == ARCHI_FC_CID) {
+        printf("parallel processing supported only for cluster side\n");
+        return;
+    } else {
+        plp_goertzel_instance_parallel args = {
+            .S = S,
+            .pSrc = pSrc,
+            .blockSize = blockSize,
+            .shift = shift,
+            .nPE = nPE,
+            .pDst = pDst
+        };
+        hal_cl_team_fork(nPE, plp_goertzel_q16p_xpulpv2, (void *)&args);
+    }
+}
+
+/**
+  @} end of goertzel group
+ */
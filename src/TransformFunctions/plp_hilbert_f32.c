@@ -0,0 +1,103 @@
+/* ----------------------------------------------------------------------
+ * Project:      PULP DSP Library
+ * Title:        plp_hilbert_f32.c
+ * Description:  Floating-point Hilbert transform glue code
+ *
+ * $Date:        19. Oct 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupTransforms
+ */
+
+/**
+  @defgroup hilbert Hilbert transform
+  The analytic signal z = x + jh of a real signal x has the Hilbert transform h of x as imaginary
+  part, its spectrum is the one of x without the negative frequencies. The magnitude |z| is the
+  envelope of x, e.g. for the envelope analysis of bearing faults in vibration signals or the
+  demodulation of ultrasound echoes.
+
+  plp_hilbert_f32 and plp_hilbert_q16 compute the analytic signal of a block of N samples with
+  FFTs, i.e. the block is treated as one period of a periodic signal. plp_envelope_f32 and
+  plp_envelope_q16 compute its magnitude in the same pass, right after the inverse transform, with
+  sqrtf or an integer square root respectively, instead of a complex inverse FFT followed by
+  plp_cmplx_mag. The spectrum X of the block is multiplied with -j sgn(k), which is the spectrum of
+  h, and transformed back:
+  - The floating-point versions use plp_rfft_f32 and plp_rifft_f32, i.e. two real transforms
+    instead of two complex transforms of length N. They always enable the bit reversal of the
+    FFT, such that the shipped instances plp_rfft_sR_f32_len* can be used directly.
+  - The 16-bit fix-point versions compute both transforms with plp_cfft_q32 in a buffer of 32-bit
+    values, which keeps at least 18 fractional bits despite the scaling of the transforms. The
+    inverse transform is the forward transform of the reversed spectrum. The real part of the
+    analytic signal is the input itself.
+
+  For streams, plp_hilbert_fir_f32 and plp_hilbert_fir_q16 filter every block with an FIR Hilbert
+  transformer, with a latency of D = 2 numPairs - 1 samples instead of a whole block. The
+  coefficients are the ideal impulse response 2 / (pi j) for odd j and 0 for even j, |j| <= D,
+  multiplied with a Blackman window which vanishes at |j| = 2 numPairs. Since the impulse response
+  is odd and every other coefficient is zero, only the numPairs coefficients of j = 1, 3, ..., D
+  are stored and each multiplies the difference of two samples, which is 4 times fewer
+  multiplications than the FIR filter with 4 numPairs - 1 taps. The output is the analytic signal
+  delayed by D samples, x[n - D] + j h[n - D], or its magnitude. The gain of the transformer is
+  within 1% of 1 between about 0.55 / numPairs and 0.5 - 0.55 / numPairs cycles per sample.
+ */
+
+/**
+  @addtogroup hilbert
+  @{
+ */
+
+/**
+  @brief Glue code for the floating-point analytic signal of a block.
+  @param[in]  S     points to the floating-point FFT instance of length N, e.g.
+                    plp_rfft_sR_f32_len512
+  @param[in]  pSrc  points to the block of N real samples
+  @param[in]  pBuf  points to the temporary buffer of 2*N floats
+  @param[out] pDst  points to the analytic signal, N complex values (real and imaginary part)
+  @return     none
+ */
+
+void plp_hilbert_f32(const plp_fft_instance_f32 *S,
+                     const float32_t *__restrict__ pSrc,
+                     float32_t *__restrict__ pBuf,
+                     float32_t *__restrict__ pDst) {
+    PLP_PROFILE_FUNCTION();
+
+    if (hal_cluster_id() == ARCHI_FC_CID) {
+        printf("Floating point is supported only for cluster side\n");
+        return;
+    }
+
+    // plp_rfft_f32 and plp_rifft_f32 need bitReverseFlag = 1, which the shipped instances
+    // plp_rfft_sR_f32_len* leave disabled
+    plp_fft_instance_f32 fft = *S;
+    fft.bitReverseFlag = 1;
+
+    plp_hilbert_f32s_xpulpv2(&fft, pSrc, pBuf, pDst, NULL);
+}
+
+/**
+  @} end of hilbert group
+ */
@@ -0,0 +1,80 @@
+/* ----------------------------------------------------------------------
+ * Project:      PULP DSP Library
+ * Title:        plp_hilbert_fir_init_f32.c
+ * Description:  Floating-point FIR Hilbert transformer initialization
+ *
+ * $Date:        19. Oct 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupTransforms
+ */
+
+/**
+  @addtogroup hilbert
+  @{
+ */
+
+/**
+  @brief      Initializes the instance of the floating-point FIR Hilbert transformer, computes
+              the coefficients and clears the state.
+  @param[out] S         points to the FIR Hilbert transformer instance
+  @param[in]  numPairs  number of coefficients, the delay is 2*numPairs - 1 samples
+  @param[out] pCoeffs   points to the buffer of numPairs coefficients
+  @param[out] pState    points to the state buffer of 4*numPairs - 2 + blockSize samples, with the
+                        largest blockSize of plp_hilbert_fir_f32
+  @return     none
+
+  The coefficient m is 2 / (pi j) w[j] with j = 2m + 1 and the Blackman window
+  w[j] = 0.42 + 0.5 cos(2 pi j / (4 numPairs)) + 0.08 cos(4 pi j / (4 numPairs)).
+  The instances with the same numPairs can share the coefficients.
+ */
+
+void plp_hilbert_fir_init_f32(plp_hilbert_fir_instance_f32 *S,
+                              uint32_t numPairs,
+                              float32_t *pCoeffs,
+                              float32_t *pState) {
+    PLP_PROFILE_FUNCTION();
+
+    float32_t step = 2.0f * 3.14159265f / (float32_t)(4 * numPairs);
+    uint32_t m;
+
+    for (m = 0; m < numPairs; m++) {
+        float32_t j = (float32_t)(2 * m + 1);
+        float32_t w = 0.42f + 0.5f * cosf(step * j) + 0.08f * cosf(2.0f * step * j);
+        pCoeffs[m] = w * 2.0f / (3.14159265f * j);
+    }
+    for (m = 0; m < 4 * numPairs - 2; m++) {
+        pState[m] = 0.0f;
+    }
+
+    S->numPairs = numPairs;
+    S->pCoeffs = pCoeffs;
+    S->pState = pState;
+}
+
+/**
+  @} end of hilbert group
+ */
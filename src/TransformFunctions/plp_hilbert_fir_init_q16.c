@@ -0,0 +1,86 @@
+/* ----------------------------------------------------------------------
+ * Project:      PULP DSP Library
+ * Title:        plp_hilbert_fir_init_q16.c
+ * Description:  16-bit fix-point FIR Hilbert transformer initialization
+ *
+ * $Date:        19. Oct 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupTransforms
+ */
+
+/**
+  @addtogroup hilbert
+  @{
+ */
+
+/**
+  @brief      Initializes the instance of the 16-bit fix-point FIR Hilbert transformer, computes
+              the coefficients and clears the state.
+  @param[out] S         points to the FIR Hilbert transformer instance
+  @param[in]  numPairs  number of coefficients, the delay is 2*numPairs - 1 samples
+  @param[out] pCoeffs   points to the buffer of numPairs coefficients in Q1.15
+  @param[out] pState    points to the state buffer of 4*numPairs - 2 + blockSize samples, with the
+                        largest blockSize of plp_hilbert_fir_q16
+  @return     none
+
+  The coefficients are the ones of plp_hilbert_fir_init_f32 in Q1.15. The window is computed with
+  plp_cos_q16 without floating-point operations, such that the initialization can run on the
+  fabric controller.
+ */
+
+void plp_hilbert_fir_init_q16(plp_hilbert_fir_instance_q16 *S,
+                              uint32_t numPairs,
+                              int16_t *pCoeffs,
+                              int16_t *pState) {
+    PLP_PROFILE_FUNCTION();
+
+    uint32_t m;
+
+    for (m = 0; m < numPairs; m++) {
+        uint32_t j = 2 * m + 1;
+        // phase j / (4 numPairs) in Q1.15, cos1 and cos2 are the cosines of 2 pi and 4 pi times it
+        int16_t phi = (int16_t)((j << 15) / (4 * numPairs));
+        int32_t cos1 = plp_cos_q16(phi);
+        int32_t cos2 = plp_cos_q16((int16_t)((phi << 1) & 0x7FFF));
+        int32_t w = 13763 + (cos1 >> 1) + ((2621 * cos2 + (1 << 14)) >> 15);
+
+        w = (w < 0) ? 0 : (w > 0x7FFF) ? 0x7FFF : w;
+        // 2 / pi is 20861 in Q1.15
+        pCoeffs[m] = (int16_t)((w * 20861 / (int32_t)j + (1 << 14)) >> 15);
+    }
+    for (m = 0; m < 4 * numPairs - 2; m++) {
+        pState[m] = 0;
+    }
+
+    S->numPairs = numPairs;
+    S->pCoeffs = pCoeffs;
+    S->pState = pState;
+}
+
+/**
+  @} end of hilbert group
+ */
@@ -0,0 +1,81 @@
+/* ----------------------------------------------------------------------
+ * Project:      PULP DSP Library
+ * Title:        plp_hilbert_fir_q16.c
+ * Description:  16-bit fix-point FIR Hilbert transformer glue code
+ *
+ * $Date:        19. Oct 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupTransforms
+ */
+
+/**
+  @addtogroup hilbert
+  @{
+ */
+
+/**
+  @brief Glue code for the 16-bit fix-point FIR Hilbert transformer.
+  @param[in]  S          points to the FIR Hilbert transformer instance
+  @param[in]  pSrc       points to the block of input samples in Q1.15
+  @param[in]  blockSize  number of samples
+  @param[out] pDst       points to the analytic signal of the samples delayed by 2*numPairs - 1,
+                         blockSize complex values in Q1.15, or NULL
+  @param[out] pEnv       points to the envelope of the samples delayed by 2*numPairs - 1,
+                         blockSize values in Q1.15, or NULL
+  @return     none
+ */
+
+void plp_hilbert_fir_q16(const plp_hilbert_fir_instance_q16 *S,
+                         const int16_t *__restrict__ pSrc,
+                         uint32_t blockSize,
+                         int16_t *__restrict__ pDst,
+                         int16_t *__restrict__ pEnv) {
+    PLP_PROFILE_FUNCTION();
+
+    uint32_t numHist = 4 * S->numPairs - 2;
+    int16_t *pState = S->pState;
+    uint32_t i;
+
+    for (i = 0; i < blockSize; i++) {
+        pState[numHist + i] = pSrc[i];
+    }
+
+    if (hal_cluster_id() == ARCHI_FC_CID) {
+        plp_hilbert_fir_q16s_rv32im(pState, S->pCoeffs, S->numPairs, blockSize, pDst, pEnv);
+    } else {
+        plp_hilbert_fir_q16s_xpulpv2(pState, S->pCoeffs, S->numPairs, blockSize, pDst, pEnv);
+    }
+
+    // keep the last samples for the next block, copying forward is safe for the overlap
+    for (i = 0; i < numHist; i++) {
+        pState[i] = pState[blockSize + i];
+    }
+}
+
+/**
+  @} end of hilbert group
+ */
@@ -0,0 +1,69 @@
+/* ----------------------------------------------------------------------
+ * Project:      PULP DSP Library
+ * Title:        plp_hilbert_q16.c
+ * Description:  16-bit fix-point Hilbert transform glue code
+ *
+ * $Date:        19. Oct 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupTransforms
+ */
+
+/**
+  @addtogroup hilbert
+  @{
+ */
+
+/**
+  @brief Glue code for the 16-bit fix-point analytic signal of a block.
+  @param[in]  S     points to the 32-bit CFFT instance of length N, e.g. plp_cfft_sR_q32_len256
+  @param[in]  pSrc  points to the block of N samples in Q1.15
+  @param[in]  pBuf  points to the temporary buffer of 2*N values
+  @param[out] pDst  points to the analytic signal, N complex values (real and imaginary part) in
+                    Q1.15
+  @return     none
+
+  @par Fix-Point
+  The Hilbert transform saturates at 1, which only happens for signals close to full scale with
+  sharp edges, e.g. square waves.
+ */
+
+void plp_hilbert_q16(const plp_cfft_instance_q32 *S,
+                     const int16_t *__restrict__ pSrc,
+                     int32_t *__restrict__ pBuf,
+                     int16_t *__restrict__ pDst) {
+    PLP_PROFILE_FUNCTION();
+
+    if (hal_cluster_id() == ARCHI_FC_CID) {
+        plp_hilbert_q16s_rv32im(S, pSrc, pBuf, pDst, NULL);
+    } else {
+        plp_hilbert_q16s_xpulpv2(S, pSrc, pBuf, pDst, NULL);
+    }
+}
+
+/**
+  @} end of hilbert group
+ */
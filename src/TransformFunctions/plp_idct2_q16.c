@@ -0,0 +1,131 @@
+/* ----------------------------------------------------------------------
+ * Project:      PULP DSP Library
+ * Title:        plp_idct2_q16.c
+ * Description:  16-bit fixed-point inverse DCT-II glue code
+ *
+ * $Date:        19. Oct 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup fft
+ * @{
+ */
+
+/**
+ * @brief      Glue code for the quantized 16 bit inverse DCT-II (DCT-III) on real input data.
+ *
+ * Inverse of the steps of plp_dct2_q16: the spectrum V[k] = exp(j pi k / (2N)) (y[k] - j y[N-k])
+ * is merged into a complex spectrum of length N/2, which is inverted with plp_cfft_q16 (as the
+ * conjugate of the forward transform of the conjugate). The result is the sequence v, which is
+ * reordered into the output. Both, the merge and the reordering, are done in a single pass.
+ *
+ * The output has the same fixed-point format as the input:
+ * <code>pDst[n] = 1/N (pSrc[0]/2 + sum_{k>0} pSrc[k] cos(pi k (2n+1) / (2N)))</code>, such that
+ * plp_idct2_q16 of the output of plp_dct2_q16 is the original input divided by 2N.
+ *
+ * @param[in]   S       points to an instance of the 16bit quantized DCT structure, use one of the
+ *                      constant instances plp_dct_sR_q16_len32 to plp_dct_sR_q16_len1024
+ * @param[in]   pSrc    points to the input buffer (real data) of size dctLen
+ * @param[in]   pBuf    points to a buffer of size dctLen, used for computation
+ * @param[out]  pDst    points to the output buffer (real data) of size dctLen, may be the same as
+ *                      pSrc
+ * @return      none
+ */
+
+void plp_idct2_q16(const plp_dct_instance_q16 *S,
+                   const int16_t *pSrc,
+                   int16_t *__restrict__ pBuf,
+                   int16_t *pDst) {
+    PLP_PROFILE_FUNCTION();
+
+    uint32_t N = S->dctLen;
+    uint32_t n2 = N >> 1;
+    const int16_t *pCoef = S->pTwiddleRFFT;
+    const int16_t *pRot = S->pTwiddleDCT;
+    int32_t akr, aki, alr, ali, er, ei, hr, hi, gr, gi;
+    int32_t co, si;
+    uint32_t k, l;
+
+    /*
+     * V[k] = conj(T[k]) (y[k] - j y[N-k]) with T[k] = exp(-j pi k / (2N)). For the pairs
+     * (k, N/2-k), E = V[k] + conj(V[N/2-k]), H = V[k] - conj(V[N/2-k]) and G = conj(W[k]) H, the
+     * complex spectrum is Z[k] = (E + j G) / 2 and Z[N/2-k] = conj(E - j G) / 2. The input of the
+     * FFT is conj(Z) / 2, where the factor 1/2 keeps the scaling of the FFT. E and H are computed
+     * with a factor 1/4 for the headroom, the input of the FFT is saturated.
+     */
+    akr = pSrc[0];
+    alr = (pSrc[n2] * pRot[2 * N] + (1 << 14)) >> 15; /* sqrt(2) y[N/2] / 2 */
+    er = (akr + 2 * alr) >> 2;
+    hr = (akr - 2 * alr) >> 2;
+    pBuf[0] = (int16_t)__CLIP(er, 15);
+    pBuf[1] = (int16_t)__CLIP(-hr, 15);
+
+    for (k = 1; k <= (n2 >> 1); k++) {
+        l = n2 - k;
+
+        co = pRot[4 * k];
+        si = pRot[4 * k + 1];
+        akr = (co * pSrc[k] + si * pSrc[N - k]) >> 15;
+        aki = (si * pSrc[k] - co * pSrc[N - k]) >> 15;
+
+        co = pRot[4 * l];
+        si = pRot[4 * l + 1];
+        alr = (co * pSrc[l] + si * pSrc[N - l]) >> 15;
+        ali = (si * pSrc[l] - co * pSrc[N - l]) >> 15;
+
+        er = (akr + alr) >> 2;
+        ei = (aki - ali) >> 2;
+        hr = (akr - alr) >> 2;
+        hi = (aki + ali) >> 2;
+
+        co = pCoef[2 * k];
+        si = pCoef[2 * k + 1];
+        gr = (co * hr - si * hi) >> 15;
+        gi = (si * hr + co * hi) >> 15;
+
+        pBuf[2 * k] = (int16_t)__CLIP(er - gi, 15);
+        pBuf[2 * k + 1] = (int16_t)__CLIP(-ei - gr, 15);
+        pBuf[2 * l] = (int16_t)__CLIP(er + gi, 15);
+        pBuf[2 * l + 1] = (int16_t)__CLIP(ei - gr, 15);
+    }
+
+    plp_cfft_q16(S->pCfft, pBuf, 0, 1, 15);
+
+    /* v[2n] = Re(z[n]), v[2n+1] = -Im(z[n]), x[2n] = v[n] and x[2n+1] = v[N-1-n] */
+    for (k = 0; k < n2; k += 2) {
+        pDst[2 * k] = pBuf[k];
+        pDst[2 * k + 1] = (int16_t)__CLIP(-pBuf[N - 1 - k], 15);
+        pDst[2 * k + 2] = (int16_t)__CLIP(-pBuf[k + 1], 15);
+        pDst[2 * k + 3] = pBuf[N - 2 - k];
+    }
+}
+
+/**
+ * @} end of FFT group
+ */
@@ -0,0 +1,141 @@
+/* ----------------------------------------------------------------------
+ * Project:      PULP DSP Library
+ * Title:        plp_idct2_q32.c
+ * Description:  32-bit fixed-point inverse DCT-II glue code
+ *
+ * $Date:        19. Oct 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+static inline int32_t plp_idct2_sat_q32(int64_t x) {
+    if (x > 0x7FFFFFFFLL) {
+        return 0x7FFFFFFF;
+    } else if (x < -0x80000000LL) {
+        return (int32_t)0x80000000;
+    }
+    return (int32_t)x;
+}
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup fft
+ * @{
+ */
+
+/**
+ * @brief      Glue code for the quantized 32 bit inverse DCT-II (DCT-III) on real input data.
+ *
+ * Inverse of the steps of plp_dct2_q32: the spectrum V[k] = exp(j pi k / (2N)) (y[k] - j y[N-k])
+ * is merged into a complex spectrum of length N/2, which is inverted with plp_cfft_q32 (as the
+ * conjugate of the forward transform of the conjugate). The result is the sequence v, which is
+ * reordered into the output. Both, the merge and the reordering, are done in a single pass.
+ *
+ * The output has the same fixed-point format as the input:
+ * <code>pDst[n] = 1/N (pSrc[0]/2 + sum_{k>0} pSrc[k] cos(pi k (2n+1) / (2N)))</code>, such that
+ * plp_idct2_q32 of the output of plp_dct2_q32 is the original input divided by 2N.
+ *
+ * @param[in]   S       points to an instance of the 32bit quantized DCT structure, use one of the
+ *                      constant instances plp_dct_sR_q32_len32 to plp_dct_sR_q32_len1024
+ * @param[in]   pSrc    points to the input buffer (real data) of size dctLen
+ * @param[in]   pBuf    points to a buffer of size dctLen, used for computation
+ * @param[out]  pDst    points to the output buffer (real data) of size dctLen, may be the same as
+ *                      pSrc
+ * @return      none
+ */
+
+void plp_idct2_q32(const plp_dct_instance_q32 *S,
+                   const int32_t *pSrc,
+                   int32_t *__restrict__ pBuf,
+                   int32_t *pDst) {
+    PLP_PROFILE_FUNCTION();
+
+    uint32_t N = S->dctLen;
+    uint32_t n2 = N >> 1;
+    const int32_t *pCoef = S->pTwiddleRFFT;
+    const int32_t *pRot = S->pTwiddleDCT;
+    int32_t akr, aki, alr, ali, er, ei, hr, hi, gr, gi;
+    int32_t co, si;
+    uint32_t k, l;
+
+    /*
+     * V[k] = conj(T[k]) (y[k] - j y[N-k]) with T[k] = exp(-j pi k / (2N)). For the pairs
+     * (k, N/2-k), E = V[k] + conj(V[N/2-k]), H = V[k] - conj(V[N/2-k]) and G = conj(W[k]) H, the
+     * complex spectrum is Z[k] = (E + j G) / 2 and Z[N/2-k] = conj(E - j G) / 2. The input of the
+     * FFT is conj(Z) / 2, where the factor 1/2 keeps the scaling of the FFT. E and H are computed
+     * with a factor 1/4 for the headroom, the input of the FFT is saturated.
+     */
+    akr = pSrc[0];
+    /* sqrt(2) y[N/2] / 2 */
+    alr = (int32_t)(((int64_t)pSrc[n2] * pRot[2 * N] + 0x40000000LL) >> 31);
+    er = (akr >> 2) + (alr >> 1);
+    hr = (akr >> 2) - (alr >> 1);
+    pBuf[0] = er;
+    pBuf[1] = -hr;
+
+    for (k = 1; k <= (n2 >> 1); k++) {
+        l = n2 - k;
+
+        co = pRot[4 * k];
+        si = pRot[4 * k + 1];
+        akr = (int32_t)(((int64_t)co * pSrc[k] + (int64_t)si * pSrc[N - k]) >> 33);
+        aki = (int32_t)(((int64_t)si * pSrc[k] - (int64_t)co * pSrc[N - k]) >> 33);
+
+        co = pRot[4 * l];
+        si = pRot[4 * l + 1];
+        alr = (int32_t)(((int64_t)co * pSrc[l] + (int64_t)si * pSrc[N - l]) >> 33);
+        ali = (int32_t)(((int64_t)si * pSrc[l] - (int64_t)co * pSrc[N - l]) >> 33);
+
+        er = akr + alr;
+        ei = aki - ali;
+        hr = akr - alr;
+        hi = aki + ali;
+
+        co = pCoef[2 * k];
+        si = pCoef[2 * k + 1];
+        gr = (int32_t)(((int64_t)co * hr - (int64_t)si * hi + 0x40000000LL) >> 31);
+        gi = (int32_t)(((int64_t)si * hr + (int64_t)co * hi + 0x40000000LL) >> 31);
+
+        pBuf[2 * k] = plp_idct2_sat_q32((int64_t)er - gi);
+        pBuf[2 * k + 1] = plp_idct2_sat_q32(-(int64_t)ei - gr);
+        pBuf[2 * l] = plp_idct2_sat_q32((int64_t)er + gi);
+        pBuf[2 * l + 1] = plp_idct2_sat_q32((int64_t)ei - gr);
+    }
+
+    plp_cfft_q32(S->pCfft, pBuf, 0, 1, 31);
+
+    /* v[2n] = Re(z[n]), v[2n+1] = -Im(z[n]), x[2n] = v[n] and x[2n+1] = v[N-1-n] */
+    for (k = 0; k < n2; k += 2) {
+        pDst[2 * k] = pBuf[k];
+        pDst[2 * k + 1] = plp_idct2_sat_q32(-(int64_t)pBuf[N - 1 - k]);
+        pDst[2 * k + 2] = plp_idct2_sat_q32(-(int64_t)pBuf[k + 1]);
+        pDst[2 * k + 3] = pBuf[N - 2 - k];
+    }
+}
+
+/**
+ * @} end of FFT group
+ */
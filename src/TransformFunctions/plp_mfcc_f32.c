@@ -76,6 +76,7 @@ void plp_mfcc_f32(const plp_fft_instance_f32 *SFFT,
 		  const uint8_t *orthoNorm,
                   const float32_t *__restrict__ pSrc,
                   float32_t *__restrict__ pDst) {
+    PLP_PROFILE_FUNCTION();
 
 
 	// Step 0: Windowing. Stored in buffer space of pDst.
@@ -78,6 +78,7 @@ void plp_mfcc_f32_parallel(const plp_fft_instance_f32 *SFFT,
                   	   const float32_t *__restrict__ pSrc,
                   	   const uint32_t nPE,
                   	   float32_t *__restrict__ pDst) {
+    PLP_PROFILE_FUNCTION();
 
 	// Step 0: Windowing. Stored in buffer space of pDst.
 	uint32_t n_fft = SFFT->FFTLength;
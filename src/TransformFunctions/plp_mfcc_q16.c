@@ -0,0 +1,106 @@
+/* ----------------------------------------------------------------------
+ * Project:      PULP DSP Library
+ * Title:        plp_mfcc_q16.c
+ * Description:  Glue code for the 16-bit fixed-point MFCC
+ *
+ * $Date:        19. Oct 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupTransforms
+ */
+
+/**
+   @addtogroup feature
+   @{
+*/
+
+/**
+   @brief MFCC on real input data in 16 bit fixed-point.
+
+   The same steps as in plp_mfcc_f32 are computed without floating-point operations, such that the
+   feature extraction can run on the fabric controller:
+   - The input is windowed and normalized by a power of two, such that the largest sample uses the
+     full range of the 32 bit FFT input.
+   - plp_rfft_q32 computes the spectrum, of which the squared magnitude is computed with 64 bit
+     precision.
+   - The triangular filterbank accumulates the mel energies with 64 bit precision.
+   - The natural logarithm of the mel energies is computed from a table of log2 with linear
+     interpolation. The normalization of the input and the scaling of the FFT are compensated in
+     the logarithm, such that the log mel energies correspond to the unscaled FFT of the windowed
+     input, as in plp_mfcc_f32, including its offset of 1e-6.
+   - plp_dct2_q16 computes the DCT of the log mel energies.
+
+   The MFCCs are in Q5.10, and correspond to the ones of plp_mfcc_f32 without orthonormalization
+   divided by 2*n_mels: <code>pDst[k] = 1/n_mels sum_m ln(mel[m]) cos(pi k (2m+1) / (2 n_mels))
+   </code>. The log mel energies are saturated at 32, which can only happen for n_fft = 4096.
+
+   The FFT runs in 32 bit, since the rounding noise of plp_rfft_q16 lies only about 65 dB below
+   the strongest mel band and would raise the weak bands of tonal input, e.g. a pure tone, by
+   several nats.
+
+   @param[in]   SFFT        points to an instance of the 32 bit RFFT structure
+                            (fftLenReal = n_fft), e.g. plp_rfft_sR_q32_len512
+   @param[in]   SDCT        points to an instance of the 16 bit DCT structure
+                            (dctLen = n_mels), e.g. plp_dct_sR_q16_len32. n_mels must be at
+                            most n_fft/2.
+   @param[in]   filterBank  points to plp_triangular_filter_q16 instance with
+                            nFilters = n_mels
+   @param[in]   window      window in Q1.15 of size n_fft
+   @param[in]   pSrc        points to the input buffer (Q1.15, size n_fft)
+   @param[out]  pDst        points to the output buffer of length at least 4*n_fft+4,
+                            aligned to 4 bytes. pSrc and pDst must not overlap, the calculation
+                            can not be done in place. The MFCCs are returned in the first n_mels
+                            spots.
+   @return      none
+*/
+
+void plp_mfcc_q16(const plp_rfft_instance_q32 *SFFT,
+                  const plp_dct_instance_q16 *SDCT,
+                  const plp_triangular_filter_q16 *filterBank,
+                  const int16_t *window,
+                  const int16_t *__restrict__ pSrc,
+                  int16_t *__restrict__ pDst) {
+    PLP_PROFILE_FUNCTION();
+
+    uint32_t n_fft = SFFT->fftLenReal;
+    uint32_t n_mels = filterBank->nFilters;
+
+    // Steps 0 to 4: log mel energies, stored behind the RFFT output in pDst
+    int16_t *mel_logs = pDst + 2 * n_fft + 4;
+    if (hal_cluster_id() == ARCHI_FC_CID) {
+        plp_mfcc_q16s_rv32im(SFFT, filterBank, window, pSrc, pDst, mel_logs);
+    } else {
+        plp_mfcc_q16s_xpulpv2(SFFT, filterBank, window, pSrc, pDst, mel_logs);
+    }
+
+    // Step 5: DCT of log mels into the beginning of pDst
+    plp_dct2_q16(SDCT, mel_logs, mel_logs + n_mels, pDst);
+}
+
+/**
+   @} end of feature group
+*/
@@ -0,0 +1,81 @@
+/* ----------------------------------------------------------------------
+ * Project:      PULP DSP Library
+ * Title:        plp_overlap_add_f32.c
+ * Description:  Floating-point overlap-add synthesis glue code
+ *
+ * $Date:        19. Oct 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupTransforms
+ */
+
+/**
+  @defgroup overlapAdd Overlap-add synthesis
+  The overlap-add synthesis reconstructs a signal from consecutive frames, which are spaced by
+  hopLen samples, e.g. the output frames of plp_rifft_f32 in a short-time Fourier transform
+  resynthesis. The frames are optionally multiplied with a synthesis window and added into an
+  overlap buffer of frameLen samples. Each call completes and returns hopLen output samples.
+
+  The overlap buffer must be zero-initialized before the first frame. With an analysis window
+  w_a and a synthesis window w_s, the signal is reconstructed exactly if the sum of
+  w_a[n + m hopLen] w_s[n + m hopLen] over m is 1 for all n, e.g. for a periodic Hann analysis
+  window with hopLen = frameLen / 2 and without synthesis window.
+ */
+
+/**
+  @addtogroup overlapAdd
+  @{
+ */
+
+/**
+   @brief         Glue code for the floating-point overlap-add synthesis.
+   @param[in]     pSrc      points to the frame of length frameLen
+   @param[in]     pWindow   points to the synthesis window of length frameLen, or NULL
+   @param[in]     frameLen  length of the frame
+   @param[in]     hopLen    number of samples between two frames, at most frameLen
+   @param[in,out] pBuf      points to the overlap buffer of length frameLen
+   @param[out]    pDst      points to the output buffer of length hopLen
+   @return        none
+*/
+void plp_overlap_add_f32(const float32_t *__restrict__ pSrc,
+                         const float32_t *__restrict__ pWindow,
+                         uint32_t frameLen,
+                         uint32_t hopLen,
+                         float32_t *__restrict__ pBuf,
+                         float32_t *__restrict__ pDst) {
+    PLP_PROFILE_FUNCTION();
+
+    if (hal_cluster_id() == ARCHI_FC_CID) {
+        printf("F extension is supported only for cluster side\n");
+        return;
+    }
+
+    plp_overlap_add_f32_xpulpv2(pSrc, pWindow, frameLen, hopLen, pBuf, pDst);
+}
+
+/**
+   @} end of overlapAdd group
+*/
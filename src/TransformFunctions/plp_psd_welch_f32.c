@@ -0,0 +1,92 @@
+/* ----------------------------------------------------------------------
+ * Project:      PULP DSP Library
+ * Title:        plp_psd_welch_f32.c
+ * Description:  Floating-point Welch power spectral density glue code
+ *
+ * $Date:        19. Oct 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupTransforms
+ */
+
+/**
+  @addtogroup psd
+  @{
+ */
+
+/**
+   @brief         Floating-point Welch power spectral density of a buffer, the segments are
+                  distributed over the cores.
+   @param[in]     S       points to the Welch PSD instance
+   @param[in]     pSrc    points to the input samples
+   @param[in]     srcLen  number of input samples
+   @param[in]     pBuf    points to the temporary buffer of 4*FFTLength*nPE floats
+   @param[in]     nPE     number of cores
+   @param[out]    pDst    points to the output of FFTLength / 2 + 1 bins
+   @return        number of segments, (srcLen - FFTLength) / hopLen + 1, or 0 if
+                  srcLen < FFTLength (pDst is not written).
+*/
+uint32_t plp_psd_welch_f32(const plp_psd_welch_instance_f32 *S,
+                           const float32_t *__restrict__ pSrc,
+                           uint32_t srcLen,
+                           float32_t *__restrict__ pBuf,
+                           uint32_t nPE,
+                           float32_t *__restrict__ pDst) {
+    PLP_PROFILE_FUNCTION();
+
+    uint32_t N = S->S->FFTLength;
+
+    if (hal_cluster_id() == ARCHI_FC_CID) {
+        printf("F extension is supported only for cluster side\n");
+        return 0;
+    }
+
+    if (srcLen < N) {
+        return 0;
+    }
+
+    // plp_rfft_f32 returns the bins in natural order only with bitReverseFlag = 1, which the
+    // shipped instances plp_rfft_sR_f32_len* leave disabled
+    plp_fft_instance_f32 fft = *S->S;
+    fft.bitReverseFlag = 1;
+    plp_psd_welch_instance_f32 welch = *S;
+    welch.S = &fft;
+
+    plp_psd_welch_instance_f32_parallel args = { .S = &welch,
+                                                 .pSrc = pSrc,
+                                                 .nSegments = (srcLen - N) / S->hopLen + 1,
+                                                 .pBuf = pBuf,
+                                                 .nPE = nPE,
+                                                 .pDst = pDst };
+
+    hal_cl_team_fork(nPE, plp_psd_welch_f32p_xpulpv2, (void *)&args);
+
+    return args.nSegments;
+}
+
+/**
+   @} end of psd group
+*/
@@ -0,0 +1,122 @@
+/* ----------------------------------------------------------------------
+ * Project:      PULP DSP Library
+ * Title:        plp_psd_welch_init_f32.c
+ * Description:  Initialization of the floating-point Welch power spectral density
+ *
+ * $Date:        19. Oct 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupTransforms
+ */
+
+/**
+  @defgroup psd Power spectral density
+  The Welch method estimates the power spectral density (PSD) of a signal by averaging the
+  periodograms of overlapping segments. The signal is split into segments of FFTLength samples,
+  which overlap by `overlap` samples, i.e. start every FFTLength - overlap samples. Each segment
+  is multiplied with the window w, transformed with the real FFT and the squared magnitudes of
+  its FFTLength / 2 + 1 bins are accumulated. The one-sided PSD of bin k is
+
+      P[k] = c[k] / (K sum_n w[n]^2) sum_t |X_t[k]|^2,
+
+  with K segments and c[k] = 2 except for c[0] = c[FFTLength / 2] = 1. This is the density per
+  cycle per sample, the same as scipy.signal.welch with fs = 1 and detrend = False. Divide it by
+  the sampling rate for the density per Hz.
+
+  plp_psd_welch_f32 and plp_psd_welch_q16 process all whole segments of the input in one pass.
+  Every segment is windowed directly from the input into the temporary buffer and its squared
+  magnitudes are added to the sums right after the FFT, without storing the spectra. The segments
+  are distributed over the cores, each core accumulates its own sums, and the sums of all cores
+  are added up after a barrier.
+
+  The floating-point version computes the spectra with plp_rfft_f32 and always enables the bit
+  reversal of its output, such that the shipped instances plp_rfft_sR_f32_len* can be used
+  directly, whatever their bitReverseFlag.
+
+  The 16-bit fix-point version accumulates the squared magnitudes of the output of plp_rfft_q16
+  (the spectrum divided by FFTLength) in Q2.30 with 64 bits, and returns the PSD in Q17.15.
+ */
+
+/**
+  @addtogroup psd
+  @{
+ */
+
+/**
+   @brief         Initializes the instance of the floating-point Welch power spectral density and
+                  generates its window.
+   @param[out]    S           points to the Welch PSD instance
+   @param[in]     SFFT        points to the floating-point FFT instance (segment length), e.g.
+                              plp_rfft_sR_f32_len512
+   @param[in]     windowType  window of the segments (plp_window_type)
+   @param[out]    pWindow     points to the buffer of FFTLength floats for the window
+   @param[in]     overlap     number of samples shared by two consecutive segments, less than
+                              FFTLength (e.g. FFTLength / 2)
+   @return        none
+
+   @par Window
+   The windows are periodic, as the ones of plp_stft_init_f32.
+*/
+void plp_psd_welch_init_f32(plp_psd_welch_instance_f32 *S,
+                            const plp_fft_instance_f32 *SFFT,
+                            plp_window_type windowType,
+                            float32_t *pWindow,
+                            uint32_t overlap) {
+    PLP_PROFILE_FUNCTION();
+
+    uint32_t N = SFFT->FFTLength;
+    float32_t step = 2.0f * 3.14159265f / (float32_t)N;
+    float32_t energy = 0.0f;
+    uint32_t n;
+
+    for (n = 0; n < N; n++) {
+        float32_t phi = step * (float32_t)n;
+        switch (windowType) {
+        case PLP_WINDOW_HANN:
+            pWindow[n] = 0.5f - 0.5f * cosf(phi);
+            break;
+        case PLP_WINDOW_HAMMING:
+            pWindow[n] = 0.54f - 0.46f * cosf(phi);
+            break;
+        case PLP_WINDOW_BLACKMAN:
+            pWindow[n] = 0.42f - 0.5f * cosf(phi) + 0.08f * cosf(2.0f * phi);
+            break;
+        default:
+            pWindow[n] = 1.0f;
+            break;
+        }
+        energy += pWindow[n] * pWindow[n];
+    }
+
+    S->S = SFFT;
+    S->pWindow = pWindow;
+    S->hopLen = N - overlap;
+    S->norm = 1.0f / energy;
+}
+
+/**
+   @} end of psd group
+*/
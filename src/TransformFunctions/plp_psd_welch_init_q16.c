@@ -0,0 +1,103 @@
+/* ----------------------------------------------------------------------
+ * Project:      PULP DSP Library
+ * Title:        plp_psd_welch_init_q16.c
+ * Description:  Initialization of the 16-bit fix-point Welch power spectral density
+ *
+ * $Date:        19. Oct 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupTransforms
+ */
+
+/**
+  @addtogroup psd
+  @{
+ */
+
+/**
+   @brief         Initializes the instance of the 16-bit fix-point Welch power spectral density
+                  and generates its window.
+   @param[out]    S           points to the Welch PSD instance
+   @param[in]     SFFT        points to the 16-bit RFFT instance (segment length), e.g.
+                              plp_rfft_sR_q16_len256
+   @param[in]     windowType  window of the segments (plp_window_type)
+   @param[out]    pWindow     points to the buffer of fftLenReal values for the window in Q1.15
+   @param[in]     overlap     number of samples shared by two consecutive segments, less than
+                              fftLenReal (e.g. fftLenReal / 2)
+   @return        none
+
+   @par Window
+   The windows are periodic, as the ones of plp_stft_init_f32. They are computed with plp_cos_q16
+   without floating-point operations, such that the initialization can run on the fabric
+   controller.
+*/
+void plp_psd_welch_init_q16(plp_psd_welch_instance_q16 *S,
+                            const plp_rfft_instance_q16 *SFFT,
+                            plp_window_type windowType,
+                            int16_t *pWindow,
+                            uint32_t overlap) {
+    PLP_PROFILE_FUNCTION();
+
+    uint32_t N = SFFT->fftLenReal;
+    uint64_t energy = 0;
+    uint32_t n;
+
+    for (n = 0; n < N; n++) {
+        // phase n / N in Q1.15, cos1 = cos(2 pi n / N) and cos2 = cos(4 pi n / N)
+        int16_t phi = (int16_t)((n << 15) / N);
+        int32_t cos1 = plp_cos_q16(phi);
+        int32_t cos2 = plp_cos_q16((int16_t)((phi << 1) & 0x7FFF));
+        int32_t w;
+
+        switch (windowType) {
+        case PLP_WINDOW_HANN:
+            w = 16384 - (cos1 >> 1);
+            break;
+        case PLP_WINDOW_HAMMING:
+            w = 17695 - ((15073 * cos1 + (1 << 14)) >> 15);
+            break;
+        case PLP_WINDOW_BLACKMAN:
+            w = 13763 - (cos1 >> 1) + ((2621 * cos2 + (1 << 14)) >> 15);
+            break;
+        default:
+            w = 0x7FFF;
+            break;
+        }
+        w = (w < 0) ? 0 : (w > 0x7FFF) ? 0x7FFF : w;
+        pWindow[n] = (int16_t)w;
+        energy += (uint32_t)(w * w);
+    }
+
+    S->S = SFFT;
+    S->pWindow = pWindow;
+    S->hopLen = N - overlap;
+    // N^2 / sum(w^2) in Q16.16, the energy is in Q2.30
+    S->norm = (uint32_t)((((uint64_t)N * N) << 30) / (energy >> 16));
+}
+
+/**
+   @} end of psd group
+*/
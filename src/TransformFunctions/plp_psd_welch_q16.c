@@ -0,0 +1,94 @@
+/* ----------------------------------------------------------------------
+ * Project:      PULP DSP Library
+ * Title:        plp_psd_welch_q16.c
+ * Description:  16-bit fix-point Welch power spectral density glue code
+ *
+ * $Date:        19. Oct 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupTransforms
+ */
+
+/**
+  @addtogroup psd
+  @{
+ */
+
+/**
+   @brief         16-bit fix-point Welch power spectral density of a buffer. On the cluster, the
+                  segments are distributed over the cores.
+   @param[in]     S       points to the Welch PSD instance
+   @param[in]     pSrc    points to the input samples in Q1.15
+   @param[in]     srcLen  number of input samples
+   @param[in]     pBuf    points to the temporary buffer of (4*fftLenReal+8)*nPE values, aligned
+                          to 8 bytes (4*fftLenReal+8 values on the fabric controller)
+   @param[in]     nPE     number of cores, ignored on the fabric controller
+   @param[out]    pDst    points to the output of fftLenReal / 2 + 1 bins in Q17.15
+   @return        number of segments, (srcLen - fftLenReal) / hopLen + 1, or 0 if
+                  srcLen < fftLenReal (pDst is not written).
+
+   @par Fix-Point
+   The squared magnitudes of the spectra of plp_rfft_q16, i.e. divided by fftLenReal, are
+   accumulated in Q2.30 with 64 bits. Since the FFT rounds its output after every stage, the PSD
+   of a bin whose scaled spectrum is only a few hundred LSB (e.g. the noise floor) is accurate to a
+   few percent. Use the full range of the input for the best precision. The output saturates at
+   2^16.
+*/
+uint32_t plp_psd_welch_q16(const plp_psd_welch_instance_q16 *S,
+                           const int16_t *__restrict__ pSrc,
+                           uint32_t srcLen,
+                           int16_t *__restrict__ pBuf,
+                           uint32_t nPE,
+                           int32_t *__restrict__ pDst) {
+    PLP_PROFILE_FUNCTION();
+
+    uint32_t N = S->S->fftLenReal;
+
+    if (srcLen < N) {
+        return 0;
+    }
+
+    uint32_t nSegments = (srcLen - N) / S->hopLen + 1;
+
+    if (hal_cluster_id() == ARCHI_FC_CID) {
+        plp_psd_welch_q16s_rv32im(S, pSrc, nSegments, pBuf, pDst);
+    } else {
+        plp_psd_welch_instance_q16_parallel args = { .S = S,
+                                                     .pSrc = pSrc,
+                                                     .nSegments = nSegments,
+                                                     .pBuf = pBuf,
+                                                     .nPE = nPE,
+                                                     .pDst = pDst };
+
+        hal_cl_team_fork(nPE, plp_psd_welch_q16p_xpulpv2, (void *)&args);
+    }
+
+    return nSegments;
+}
+
+/**
+   @} end of psd group
+*/
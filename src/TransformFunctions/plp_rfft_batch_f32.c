@@ -0,0 +1,94 @@
+/* ----------------------------------------------------------------------
+ * Project:      PULP DSP Library
+ * Title:        plp_rfft_batch_f32.c
+ * Description:  Glue code for the batched floating-point real FFT
+ *
+ * $Date:        19. Oct 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupTransforms
+ */
+
+/**
+   @addtogroup fft
+   @{
+*/
+
+/**
+   @brief Batch of floating-point FFTs on real input data, one transform per core.
+
+   Every core computes whole transforms of the batch (transform t on core t % nPE) with
+   plp_rfft_f32_xpulpv2, without any barrier. With pBuf, each core prefetches its next input frame
+   into L1 with the DMA while it computes the current one, and writes the result back to pDst in
+   the background.
+
+   The full spectrum of FFTLength bins is returned in natural order only with bitReverseFlag = 1,
+   the upper half is then filled in with X[N - k] = conj(X[k]). The shipped instances
+   plp_rfft_sR_f32_len* have it disabled, the output is then left in bit-reversed order as
+   plp_rfft_f32 returns it.
+
+   @param[in]   S          points to an instance of the floating-point FFT structure, with
+                           bitReverseFlag = 1 for the output in natural order
+   @param[in]   pSrc       points to the first input frame (real data)
+   @param[out]  pDst       points to the first output frame (complex data, 2*FFTLength floats)
+   @param[in]   count      number of transforms
+   @param[in]   srcStride  distance between two input frames in floats, at least FFTLength
+   @param[in]   dstStride  distance between two output frames in floats, at least 2*FFTLength
+   @param[in]   pBuf       points to an L1 buffer of 9*FFTLength*nPE floats for prefetching the
+                           frames with the DMA, or NULL to process the frames where they are
+   @param[in]   nPE        number of cores
+   @return      none
+*/
+void plp_rfft_batch_f32(const plp_fft_instance_f32 *S,
+                        const float32_t *pSrc,
+                        float32_t *pDst,
+                        uint32_t count,
+                        uint32_t srcStride,
+                        uint32_t dstStride,
+                        float32_t *pBuf,
+                        uint32_t nPE) {
+    PLP_PROFILE_FUNCTION();
+
+    if (hal_cluster_id() == ARCHI_FC_CID) {
+        printf("F extension is supported only for cluster side\n");
+        return;
+    }
+
+    plp_fft_batch_instance args = { .S = S,
+                                    .pSrc = pSrc,
+                                    .pDst = pDst,
+                                    .count = count,
+                                    .srcStride = srcStride,
+                                    .dstStride = dstStride,
+                                    .pBuf = pBuf,
+                                    .nPE = nPE };
+
+    hal_cl_team_fork(nPE, plp_rfft_batch_f32p_xpulpv2, (void *)&args);
+}
+
+/**
+   @} end of FFT group
+*/
@@ -0,0 +1,91 @@
+/* ----------------------------------------------------------------------
+ * Project:      PULP DSP Library
+ * Title:        plp_rfft_batch_q32.c
+ * Description:  Glue code for the batched 32-bit fixed-point real FFT
+ *
+ * $Date:        19. Oct 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupTransforms
+ */
+
+/**
+   @addtogroup fft
+   @{
+*/
+
+/**
+   @brief Batch of 32-bit fixed-point FFTs on real input data, one transform per core.
+
+   Every core computes whole transforms of the batch (transform t on core t % nPE) with
+   plp_rfft_q32s_xpulpv2, without any barrier. The output of each transform has the same format
+   as the one of plp_rfft_q32. With pBuf, each core prefetches its next input frame into L1 with the
+   DMA while it computes the current one, and writes the result back to pDst in the background. On
+   the fabric controller, the transforms are computed one after the other and pBuf is not used.
+
+   @param[in]   S          points to an instance of the 32bit quantized RFFT structure
+   @param[in]   pSrc       points to the first input frame (real data)
+   @param[out]  pDst       points to the first output frame (complex data, fftLenReal+2 values)
+   @param[in]   count      number of transforms
+   @param[in]   srcStride  distance between two input frames in values, at least fftLenReal
+   @param[in]   dstStride  distance between two output frames in values, at least fftLenReal+2
+   @param[in]   pBuf       points to an L1 buffer of 3*(2*fftLenReal+2)*nPE values for prefetching
+                           the frames with the DMA, or NULL to process the frames where they are
+   @param[in]   nPE        number of cores
+   @return      none
+*/
+void plp_rfft_batch_q32(const plp_rfft_instance_q32 *S,
+                        const int32_t *pSrc,
+                        int32_t *pDst,
+                        uint32_t count,
+                        uint32_t srcStride,
+                        uint32_t dstStride,
+                        int32_t *pBuf,
+                        uint32_t nPE) {
+    PLP_PROFILE_FUNCTION();
+
+    if (hal_cluster_id() == ARCHI_FC_CID) {
+        uint32_t t;
+        for (t = 0; t < count; t++) {
+            plp_rfft_q32s_rv32im(S, pSrc + t * srcStride, pDst + t * dstStride);
+        }
+    } else {
+        plp_fft_batch_instance args = { .S = S,
+                                        .pSrc = pSrc,
+                                        .pDst = pDst,
+                                        .count = count,
+                                        .srcStride = srcStride,
+                                        .dstStride = dstStride,
+                                        .pBuf = pBuf,
+                                        .nPE = nPE };
+
+        hal_cl_team_fork(nPE, plp_rfft_batch_q32p_xpulpv2, (void *)&args);
+    }
+}
+
+/**
+   @} end of FFT group
+*/
@@ -0,0 +1,70 @@
+/* ----------------------------------------------------------------------
+ * Project:      PULP DSP Library
+ * Title:        plp_rifft_f32_parallel.c
+ * Description:  Parallel floating-point inverse FFT to real output data glue code
+ *
+ * $Date:        19. Oct 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupTransforms
+ */
+
+/**
+   @addtogroup fft
+   @{
+*/
+
+/**
+   @brief Floating-point inverse FFT to real output data (parallel version).
+   @param[in]   S       points to an instance of the floating-point FFT structure (the same as for
+                        plp_rfft_f32)
+   @param[in]   pSrc    points to the input buffer (complex data, FFTLength / 2 + 1 values in
+                        natural order, as computed by plp_rfft_f32 with bitReverseFlag enabled)
+   @param[in]   nPE     number of parallel processing units
+   @param[out]  pDst    points to the output buffer (real data, FFTLength values), pSrc and pDst
+                        must not overlap
+   @return      none
+*/
+void plp_rifft_f32_parallel(const plp_fft_instance_f32 *S,
+                            const float32_t *__restrict__ pSrc,
+                            const uint32_t nPE,
+                            float32_t *__restrict__ pDst) {
+    PLP_PROFILE_FUNCTION();
+
+    if (hal_cluster_id() == ARCHI_FC_CID) {
+        printf("Parallel processing supported only for cluster side\n");
+        return;
+    }
+
+    plp_fft_instance_f32_parallel arg =
+        (plp_fft_instance_f32_parallel){ (plp_fft_instance_f32 *)S, pSrc, nPE, pDst };
+
+    hal_cl_team_fork(nPE, plp_rifft_f32_xpulpv2_parallel, (void *)&arg);
+}
+
+/**
+   @} end of FFT group
+*/
@@ -0,0 +1,86 @@
+/* ----------------------------------------------------------------------
+ * Project:      PULP DSP Library
+ * Title:        plp_sdft_f32.c
+ * Description:  Floating-point sliding DFT glue code
+ *
+ * $Date:        19. Oct 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupTransforms
+ */
+
+/**
+  @defgroup sdft Sliding DFT
+  The sliding DFT keeps a few bins of the N-point DFT of the last N samples of a stream up to
+  date, at a cost of one complex multiply-accumulate per sample and bin. This suits tone
+  detectors which need the bins at every sample or every few samples, e.g. ultrasonic beacons,
+  where a new Goertzel algorithm or FFT over the window would cost N times more.
+
+  The functions use the modulated sliding DFT: the state of bin k is
+  Y = sum_n x[n] e^(-j 2 pi k n / N) over the samples n in the window, which is updated with
+  Y += (x[n] - x[n-N]) e^(-j 2 pi k n / N) for every new sample, and the output is the bin
+  X = Y e^(j 2 pi k (n + 1) / N) of the window ending with x[n]. Unlike the sliding DFT with the
+  recursion X = (X + x[n] - x[n-N]) e^(j 2 pi k / N), the rounding errors are not multiplied by
+  the twiddle factor at every step, so the state does not drift away. The fix-point version keeps
+  the state exact in 64 bits, hence it never drifts.
+
+  plp_sdft_init_f32 computes the N twiddle factors by interpolation in the sine table, and
+  clears the window and the state. Every call of plp_sdft_f32 feeds a block of samples of any
+  length and stores the bins after the last sample (the output can be skipped with pDst = NULL).
+  The output stores the real and imaginary part of every bin, not scaled by 1/N.
+ */
+
+/**
+  @addtogroup sdft
+  @{
+ */
+
+/**
+  @brief Glue code for the floating-point sliding DFT.
+  @param[in,out] S          points to the sliding DFT instance
+  @param[in]     pSrc       points to the block of input samples
+  @param[in]     blockSize  number of samples
+  @param[out]    pDst       points to the output, real and imaginary part of every bin, or NULL
+  @return        none
+ */
+
+void plp_sdft_f32(plp_sdft_instance_f32 *S,
+                  const float32_t *__restrict__ pSrc,
+                  uint32_t blockSize,
+                  float32_t *__restrict__ pDst) {
+    PLP_PROFILE_FUNCTION();
+
+    if (hal_cluster_id() == ARCHI_FC_CID) {
+        printf("Floating point is supported only for cluster side\n");
+        return;
+    } else {
+        plp_sdft_f32s_xpulpv2(S, pSrc, blockSize, pDst);
+    }
+}
+
+/**
+  @} end of sdft group
+ */
@@ -0,0 +1,88 @@
+/* ----------------------------------------------------------------------
+ * Project:      PULP DSP Library
+ * Title:        plp_sdft_init_f32.c
+ * Description:  Initialization of the floating-point sliding DFT
+ *
+ * $Date:        19. Oct 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupTransforms
+ */
+
+/**
+  @addtogroup sdft
+  @{
+ */
+
+/**
+  @brief      Initializes the instance of the floating-point sliding DFT, computes the twiddle
+              factors and clears the window and the state of the bins.
+  @param[out] S          points to the sliding DFT instance
+  @param[in]  N          length of the window
+  @param[in]  pBins      points to the indices of the bins, in [0, N)
+  @param[in]  nBins      number of bins
+  @param[out] pTwiddles  points to the buffer of 2*N twiddle factors
+  @param[out] pWindow    points to the buffer of N samples
+  @param[out] pState     points to the buffer of 2*nBins state variables
+  @return     none
+
+  The twiddle factors are interpolated in sinTable_f32 (via plp_cos_f32 and plp_sin_f32, i.e. on
+  the cluster side). The instances with the same N can share the twiddle factors.
+ */
+
+void plp_sdft_init_f32(plp_sdft_instance_f32 *S,
+                       uint32_t N,
+                       const uint32_t *pBins,
+                       uint32_t nBins,
+                       float32_t *pTwiddles,
+                       float32_t *pWindow,
+                       float32_t *pState) {
+    PLP_PROFILE_FUNCTION();
+
+    uint32_t m;
+
+    for (m = 0; m < N; m++) {
+        float32_t w = 2.0f * 3.14159265f * (float32_t)m / (float32_t)N;
+        pTwiddles[2 * m] = plp_cos_f32(w);
+        pTwiddles[2 * m + 1] = plp_sin_f32(w);
+        pWindow[m] = 0.0f;
+    }
+    for (m = 0; m < 2 * nBins; m++) {
+        pState[m] = 0.0f;
+    }
+
+    S->N = N;
+    S->nBins = nBins;
+    S->pBins = pBins;
+    S->pTwiddles = pTwiddles;
+    S->pWindow = pWindow;
+    S->pState = pState;
+    S->pos = 0;
+}
+
+/**
+  @} end of sdft group
+ */
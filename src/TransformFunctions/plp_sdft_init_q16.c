@@ -0,0 +1,88 @@
+/* ----------------------------------------------------------------------
+ * Project:      PULP DSP Library
+ * Title:        plp_sdft_init_q16.c
+ * Description:  Initialization of the 16-bit fix-point sliding DFT
+ *
+ * $Date:        19. Oct 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupTransforms
+ */
+
+/**
+  @addtogroup sdft
+  @{
+ */
+
+/**
+  @brief      Initializes the instance of the 16-bit fix-point sliding DFT, computes the twiddle
+              factors and clears the window and the state of the bins.
+  @param[out] S          points to the sliding DFT instance
+  @param[in]  N          length of the window
+  @param[in]  pBins      points to the indices of the bins, in [0, N)
+  @param[in]  nBins      number of bins
+  @param[out] pTwiddles  points to the buffer of 2*N twiddle factors in Q1.15 format
+  @param[out] pWindow    points to the buffer of N samples
+  @param[out] pState     points to the buffer of 2*nBins state variables
+  @return     none
+
+  The twiddle factors are interpolated in sinTable_q16 via plp_cos_q16 and plp_sin_q16. The
+  instances with the same N can share the twiddle factors.
+ */
+
+void plp_sdft_init_q16(plp_sdft_instance_q16 *S,
+                       uint32_t N,
+                       const uint32_t *pBins,
+                       uint32_t nBins,
+                       int16_t *pTwiddles,
+                       int16_t *pWindow,
+                       int64_t *pState) {
+    PLP_PROFILE_FUNCTION();
+
+    uint32_t m;
+
+    for (m = 0; m < N; m++) {
+        int16_t f = (int16_t)((m << 15) / N);
+        pTwiddles[2 * m] = plp_cos_q16(f);
+        pTwiddles[2 * m + 1] = plp_sin_q16(f);
+        pWindow[m] = 0;
+    }
+    for (m = 0; m < 2 * nBins; m++) {
+        pState[m] = 0;
+    }
+
+    S->N = N;
+    S->nBins = nBins;
+    S->pBins = pBins;
+    S->pTwiddles = pTwiddles;
+    S->pWindow = pWindow;
+    S->pState = pState;
+    S->pos = 0;
+}
+
+/**
+  @} end of sdft group
+ */
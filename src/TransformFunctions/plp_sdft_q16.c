@@ -0,0 +1,69 @@
+/* ----------------------------------------------------------------------
+ * Project:      PULP DSP Library
+ * Title:        plp_sdft_q16.c
+ * Description:  16-bit fix-point sliding DFT glue code
+ *
+ * $Date:        19. Oct 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupTransforms
+ */
+
+/**
+  @addtogroup sdft
+  @{
+ */
+
+/**
+  @brief Glue code for the 16-bit fix-point sliding DFT.
+  @param[in,out] S          points to the sliding DFT instance
+  @param[in]     pSrc       points to the block of input samples in Q1.15 format
+  @param[in]     blockSize  number of samples
+  @param[out]    pDst       points to the output, real and imaginary part of every bin, or NULL
+  @return        none
+
+  @par Fix-Point
+  The state keeps the exact sum of the products of the samples with the Q1.15 twiddle factors in
+  Q2.30 format (64 bits). The output is in Q1.15 format, i.e. in the format of the input, and can
+  grow up to N times the largest sample.
+ */
+
+void plp_sdft_q16(plp_sdft_instance_q16 *S,
+                  const int16_t *__restrict__ pSrc,
+                  uint32_t blockSize,
+                  int32_t *__restrict__ pDst) {
+    PLP_PROFILE_FUNCTION();
+
+    if (hal_cluster_id() == ARCHI_FC_CID) {
+        plp_sdft_q16s_rv32im(S, pSrc, blockSize, pDst);
+    } else {
+        plp_sdft_q16s_xpulpv2(S, pSrc, blockSize, pDst);
+    }
+}
+
+/**
+  @} end of sdft group
+ */
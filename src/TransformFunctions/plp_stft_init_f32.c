@@ -0,0 +1,123 @@
+/* ----------------------------------------------------------------------
+ * Project:      PULP DSP Library
+ * Title:        plp_stft_init_f32.c
+ * Description:  Initialization of the floating-point short-time Fourier transform
+ *
+ * $Date:        19. Oct 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupTransforms
+ */
+
+/**
+  @defgroup stft Short-time Fourier transform
+  The short-time Fourier transform (STFT) splits a signal into frames of FFTLength samples, which
+  start every hopLen samples. It multiplies each frame with an analysis window and computes the
+  FFTLength / 2 + 1 frequency bins of its real FFT. The output of a bin is either the complex
+  value, its magnitude or its power. The bins are computed with plp_rfft_f32, whose bit reversal
+  plp_stft_f32 always enables, such that the shipped instances plp_rfft_sR_f32_len* can be used
+  directly, whatever their bitReverseFlag.
+
+  The output is a time-frequency matrix. Bin k of frame t is stored at output value
+  t * frameStride + k * binStride, where a complex value counts as one value (two floats). With
+  frameStride = FFTLength / 2 + 1 and binStride = 1, the frames are stored one after another
+  (spectrogram rows). With frameStride = 1 and binStride = F, each frequency bin is a row of up
+  to F frames.
+
+  plp_stft_f32 processes as many whole frames as fit into the input buffer and returns their
+  number. The frames are distributed over the cores, and each core windows its frames directly
+  from the input into its part of the temporary buffer, without copying the signal. For a stream,
+  the caller keeps the samples from pSrc + frames * hopLen onwards and prepends them to the next
+  chunk, and advances pDst by frames * frameStride output values.
+ */
+
+/**
+  @addtogroup stft
+  @{
+ */
+
+/**
+   @brief         Initializes the instance of the floating-point short-time Fourier transform and
+                  generates its analysis window.
+   @param[out]    S            points to the STFT instance
+   @param[in]     SFFT         points to the floating-point FFT instance (frame length), e.g.
+                               plp_rfft_sR_f32_len512
+   @param[in]     windowType   analysis window (plp_window_type)
+   @param[out]    pWindow      points to the buffer of FFTLength floats for the window
+   @param[in]     hopLen       number of samples between two frames, at least 1
+   @param[in]     outType      output of each frequency bin (plp_stft_output)
+   @param[in]     frameStride  distance between two frames in the output, in output values
+   @param[in]     binStride    distance between two frequency bins in the output, in output values
+   @return        none
+
+   @par Window
+   The windows are periodic, e.g. the Hann window is w[n] = 0.5 - 0.5 cos(2 pi n / FFTLength),
+   the same as hannWindow_f32_len512 for FFTLength = 512.
+*/
+void plp_stft_init_f32(plp_stft_instance_f32 *S,
+                       const plp_fft_instance_f32 *SFFT,
+                       plp_window_type windowType,
+                       float32_t *pWindow,
+                       uint32_t hopLen,
+                       plp_stft_output outType,
+                       uint32_t frameStride,
+                       uint32_t binStride) {
+    PLP_PROFILE_FUNCTION();
+
+    uint32_t N = SFFT->FFTLength;
+    float32_t step = 2.0f * 3.14159265f / (float32_t)N;
+    uint32_t n;
+
+    for (n = 0; n < N; n++) {
+        float32_t phi = step * (float32_t)n;
+        switch (windowType) {
+        case PLP_WINDOW_HANN:
+            pWindow[n] = 0.5f - 0.5f * cosf(phi);
+            break;
+        case PLP_WINDOW_HAMMING:
+            pWindow[n] = 0.54f - 0.46f * cosf(phi);
+            break;
+        case PLP_WINDOW_BLACKMAN:
+            pWindow[n] = 0.42f - 0.5f * cosf(phi) + 0.08f * cosf(2.0f * phi);
+            break;
+        default:
+            pWindow[n] = 1.0f;
+            break;
+        }
+    }
+
+    S->S = SFFT;
+    S->pWindow = pWindow;
+    S->hopLen = hopLen;
+    S->outType = outType;
+    S->frameStride = frameStride;
+    S->binStride = binStride;
+}
+
+/**
+   @} end of stft group
+*/
@@ -2,7 +2,10 @@
 
 import os
 import re
+import sys
+import time
 import argparse
+import subprocess
 from collections import namedtuple
 
 
@@ -14,24 +17,39 @@ def main():
     parser_view = subparsers.add_parser('view', help='View a single bench file')
     parser_view.add_argument('-b', '--bench-file', type=str, help='Benchmark CSV file to be read. If unspecified, take the most recent.')
     parser_view.add_argument('-f', '--function', type=str, help='Regex to only show the specified function.')
-    parser_view.add_argument('-d', '--device', type=str, help='Filter to only show the given device')
+    parser_view.add_argument('-d', '--device', type=str, help='Filter to only show the given device (ibex, riscy or riscy-parallel)')
+
+    parser_run = subparsers.add_parser('run', help='Run the benchmarks of all test folders into a single bench file',
+                                       description='Run the benchmarks of all test folders with a test_lib/testset.cfg into a single bench file.',
+                                       epilog='Folders without a testset, which are never benchmarked: ' +
+                                       '; '.join('{} ({})'.format(k, v) for k, v in EXCLUDED_TESTS.items()))
+    parser_run.add_argument('-t', '--test', type=str, help='Regex to only run the matching test folders')
+    parser_run.add_argument('-o', '--output', type=str, help='Benchmark CSV file to write. If unspecified, use bench_[DATE]_[TIME].csv')
+    parser_run.add_argument('-j', '--threads', type=int, default=1, help='Number of threads passed to plptest')
 
     parser_cmp = subparsers.add_parser('compare', help='Compare multiple bench files')
     parser_cmp.add_argument('-n', '--new-bench-file', type=str, help='Benchmark CSV file to be read. If unspecified, take the most recent.')
     parser_cmp.add_argument('-o', '--old-bench-file', type=str, help='Benchmark CSV file to compare to.', required=True)
     parser_cmp.add_argument('-f', '--function', type=str, help='Regex to only show the specified function')
-    parser_cmp.add_argument('-d', '--device', type=str, help='Filter to only show the given device')
+    parser_cmp.add_argument('-d', '--device', type=str, help='Filter to only show the given device (ibex, riscy or riscy-parallel)')
+    parser_cmp.add_argument('-t', '--threshold', type=float, help='Fail if the metric of any run increases by more than the given percentage')
+    parser_cmp.add_argument('-m', '--metric', type=str, default='cycles', choices=GATED_METRICS, help='Metric checked against the threshold (default: cycles)')
+    parser_cmp.add_argument('--fail-missing', action='store_true', help='Also fail if a run of the old bench file is missing in the new one')
+    parser_cmp.add_argument('-r', '--rename-old', type=str, nargs=2, metavar=('PATTERN', 'REPL'), help='Only use the runs of the old bench file whose function matches the regex PATTERN, renamed with re.sub(PATTERN, REPL), e.g. to compare two variants of a function in the same bench file')
 
     parser_score = subparsers.add_parser('score', help='compute a socre based on the imporvement of the benchmark')
     parser_score.add_argument('-n', '--new-bench-file', type=str, help='Benchmark CSV file to be read. If unspecified, take the most recent.')
     parser_score.add_argument('-o', '--old-bench-file', type=str, help='Benchmark CSV file to compare to.', required=True)
+    parser_score.add_argument('-r', '--rename-old', type=str, nargs=2, metavar=('PATTERN', 'REPL'), help='Only use the runs of the old bench file whose function matches the regex PATTERN, renamed with re.sub(PATTERN, REPL)')
 
     args = parser.parse_args()
 
     if args.command == 'view':
         view(args)
+    elif args.command == 'run':
+        sys.exit(run(args))
     elif args.command == "compare":
-        compare(args)
+        sys.exit(compare(args))
     elif args.command == "score":
         score(args)
 
@@ -51,6 +69,43 @@ def view(args):
     print_runs(runs)
 
 
+def run(args):
+    """ Run subcommand """
+    cwd = os.path.dirname(os.path.realpath(__file__))
+    if args.output is None:
+        bench_file = os.path.join(cwd, "bench_{}.csv".format(time.strftime("%Y-%m-%d_%H:%M:%S")))
+    else:
+        bench_file = os.path.abspath(args.output)
+
+    # every folder with a test_lib/testset.cfg is a test of the pulp_dsp_test.py framework
+    test_re = re.compile(args.test) if args.test else re.compile(".*")
+    tests = sorted(f for f in os.listdir(cwd)
+                   if os.path.isfile(os.path.join(cwd, f, "test_lib", "testset.cfg"))
+                   and f != "test_template" and test_re.search(f))
+
+    # a new folder without a testset would silently be left out of the benchmark
+    for f in sorted(os.listdir(cwd)):
+        if (os.path.isdir(os.path.join(cwd, f, "test_lib")) and f not in tests
+                and f not in EXCLUDED_TESTS and test_re.search(f)
+                and not os.path.isfile(os.path.join(cwd, f, "test_lib", "testset.cfg"))):
+            print("bench: skipping {}, it has no test_lib/testset.cfg".format(f))
+
+    env = dict(os.environ, PLP_BENCH_FILE=bench_file)
+    failed = []
+    for test in tests:
+        print("bench: {}".format(test))
+        result = subprocess.run(["plptest", "--threads", str(args.threads)], env=env,
+                                cwd=os.path.join(cwd, test, "test_lib"))
+        if result.returncode != 0:
+            failed.append(test)
+
+    print("bench: results written to {}".format(bench_file))
+    if failed:
+        print("bench: no results for the failing tests in: {}".format(", ".join(failed)))
+        return 1
+    return 0
+
+
 def compare(args):
     """ Compare subcommand """
     if args.new_bench_file is None:
@@ -62,7 +117,7 @@ def compare(args):
 
     # read the runs
     new_runs = read_bench(new_bench_file)
-    old_runs = read_bench(old_bench_file)
+    old_runs = rename_runs(read_bench(old_bench_file), args.rename_old)
 
     # filter
     new_runs = filter_runs(new_runs, args.function, args.device)
@@ -76,6 +131,51 @@ def compare(args):
     # print comparison
     print_comparison(new_runs, old_runs)
 
+    # check for regressions
+    if args.threshold is None:
+        return 0
+
+    failed = False
+    regressions = find_regressions(new_runs, old_runs, args.metric, args.threshold)
+    for run_new, run_old in regressions:
+        print("REGRESSION: {} {} {}: {} {} -> {} ({:+.2f}%)".format(
+            run_new.name, run_new.device, run_new.dimension, args.metric,
+            getattr(run_old, args.metric), getattr(run_new, args.metric),
+            relative_change(getattr(run_new, args.metric), getattr(run_old, args.metric)) * 100))
+        failed = True
+
+    if args.fail_missing:
+        all_old_runs = filter_runs(rename_runs(read_bench(old_bench_file), args.rename_old),
+                                   args.function, args.device)
+        for run in find_missing(new_runs, all_old_runs):
+            print("MISSING: {} {} {}".format(run.name, run.device, run.dimension))
+            failed = True
+
+    if failed:
+        return 1
+    print("No {} regression above {}% in {} runs".format(args.metric, args.threshold, len(new_runs)))
+    return 0
+
+
+def find_regressions(new_runs, old_runs, metric, threshold):
+    """ returns all pairs (new, old) of matched runs, for which the metric increased by more than
+    threshold percent """
+    return [(run_new, run_old) for run_new, run_old in zip(new_runs, old_runs)
+            if relative_change(getattr(run_new, metric), getattr(run_old, metric)) * 100 > threshold]
+
+
+def find_missing(new_runs, old_runs):
+    """ returns all runs of old_runs, which have no matching run in new_runs """
+    new_keys = set(run_sort_key(run) for run in new_runs)
+    return [run for run in old_runs if run_sort_key(run) not in new_keys]
+
+
+def relative_change(new, old):
+    """ returns the relative change from old to new """
+    if old == 0:
+        return 0.0 if new == 0 else float("inf")
+    return (new - old) / old
+
 
 def score(args):
     """ score the benchmark files """
@@ -87,7 +187,7 @@ def score(args):
     old_bench_file = args.old_bench_file
 
     new_runs = read_bench(new_bench_file)
-    old_runs = read_bench(old_bench_file)
+    old_runs = rename_runs(read_bench(old_bench_file), args.rename_old)
 
     new_runs, old_runs = match_two_runs(new_runs, old_runs)
 
@@ -124,12 +224,19 @@ def get_most_recent_bench_filename():
     cwd = os.path.dirname(os.path.realpath(__file__))
     bench_files = [f for f in os.listdir(cwd) if bench_re.search(f)]
     bench_files = sorted(bench_files, reverse=True)
-    return bench_files[0]
+    return os.path.join(cwd, bench_files[0])
 
 
 HEADER = ["name", "device", "dimension", "cycles", "instructions", "ipc", "imiss", "ld_stall",
           "tcdm_cont", "ops", "mpc"]
 Run = namedtuple("Run", HEADER)
+# metrics, for which an increase is a regression
+GATED_METRICS = ["cycles", "instructions", "imiss", "ld_stall", "tcdm_cont"]
+# test folders without a testset.cfg, which 'run' skips
+EXCLUDED_TESTS = {
+    "fft": "Makefile tests of plp_rfft_f32, benchmarked by rfft",
+    "mat_fma": "stand-alone FMA kernels, which are not part of the library",
+}
 
 
 def read_bench(bench_file):
@@ -153,7 +260,24 @@ def filter_runs(runs, function, device):
     """ returns a list of runs that only contain runs matching with function and device """
     function_re = re.compile(function) if function else re.compile(".*")
     device_re = re.compile(device) if device else re.compile(".*")
-    return [r for r in runs if function_re.search(r.name) and device_re.search(r.device)]
+    return [r for r in runs if function_re.search(r.name) and device_re.search(run_device(r))]
+
+
+def rename_runs(runs, rename):
+    """ returns the runs whose name matches the pattern, renamed with the replacement (rename is
+    a tuple (pattern, replacement), or None to return all runs unchanged) """
+    if rename is None:
+        return runs
+    pattern = re.compile(rename[0])
+    runs = [r._replace(name=pattern.sub(rename[1], r.name)) for r in runs if pattern.search(r.name)]
+    return sorted(runs, key=run_sort_key)
+
+
+def run_device(run):
+    """ returns the device of the run, where parallel runs on riscy are called riscy-parallel """
+    if run.name.endswith("_parallel"):
+        return "{}-parallel".format(run.device)
+    return run.device
 
 
 def match_two_runs(runs_a, runs_b):
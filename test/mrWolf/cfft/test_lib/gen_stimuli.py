@@ -0,0 +1,140 @@
+#!/usr/bin/env python3
+
+import numpy as np
+
+
+####################
+# generate_stimuli #
+####################
+
+
+def generate_stimuli(arg, env):
+    """
+    Function to generate the stimuli
+
+    Arguments
+    ---------
+    arg: Argument for which to generate stimuli (either Argument or ArrayArgument)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    """
+    # name = arg.name
+    # if name == "srcA":
+    #     # generate and return stimuli for srcA
+    # if name == "srcB":
+    #     # generate and return stimuli for srcB
+    # ...
+
+
+##################
+# compute_result #
+##################
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.ctype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+    if 'amplitude' in env:
+        # block-floating-point transform (testset_bfp.cfg), the output is the spectrum scaled by
+        # 2^-exponent
+        src = inputs['p1'].value.astype(np.int64)
+        exponent = bfp_q16_exponent(src[0::2], src[1::2])
+        if result_parameter.general_name() == 'pExponent':
+            return np.array([exponent], dtype=np.int32)
+        spectrum = np.fft.fft(src[0::2] + 1j * src[1::2]) / 2.0**exponent
+        result = np.round(np.stack([spectrum.real, spectrum.imag], axis=1).flatten())
+        return np.clip(result, -32768, 32767).astype(np.int16)
+    elif result_parameter.ctype == 'float':
+        # input and output are interleaved (real, imag)
+        src = inputs['pSrc'].value.astype(np.float64)
+        spectrum = np.fft.fft(src[0::2] + 1j * src[1::2])
+        result = np.stack([spectrum.real, spectrum.imag], axis=1).flatten().astype(np.float32)
+    elif result_parameter.ctype in ('int16_t', 'int32_t'):
+        # fixed-point transform (in-place p1, or pSrc for the Stockham version), the output is the
+        # spectrum divided by len
+        src = inputs['p1' if 'p1' in inputs else 'pSrc'].value.astype(np.float64)
+        spectrum = np.fft.fft(src[0::2] + 1j * src[1::2]) / env['len']
+        result = np.round(np.stack([spectrum.real, spectrum.imag], axis=1).flatten())
+        info = np.iinfo(result_parameter.ctype[:-2])
+        result = np.clip(result, info.min, info.max).astype(result_parameter.ctype[:-2])
+    else:
+        raise RuntimeError("Unrecognized result type: %s" % result_parameter.ctype)
+
+    return result
+
+
+def bfp_q16_exponent(re, im):
+    """
+    Bit-exact model of the scaling of plp_cfft_bfp_q16, returns the exponent of the output block.
+    re, im: real and imaginary part of the input (int64 arrays)
+    """
+    n = len(re)
+    k = np.arange(3 * n // 4)
+    # twiddle factors of plp_common_tables.c
+    co = np.clip(np.floor(np.cos(2 * np.pi * k / n) * 32768), -32768, 32767).astype(np.int64)
+    si = np.clip(np.floor(np.sin(2 * np.pi * k / n) * 32768), -32768, 32767).astype(np.int64)
+
+    def rot(t_re, t_im, idx):
+        return ((t_re * co[idx] + t_im * si[idx] + (1 << 14)) >> 15,
+                (t_im * co[idx] - t_re * si[idx] + (1 << 14)) >> 15)
+
+    def get_shift(r, bits):
+        return int(r).bit_length() - bits if r else 0
+
+    def value_range(*parts):
+        return max(int(np.max(np.abs(p))) for p in parts)
+
+    re, im = re.copy(), im.copy()
+    radix2 = int(np.log2(n)) % 2
+    shift = get_shift(value_range(re, im), 13 if radix2 else 12)
+    exponent = 0
+    if shift < 0:
+        re, im = re << -shift, im << -shift
+        exponent, shift = shift, 0
+
+    length, first = n, True
+    if radix2:
+        half = n // 2
+        a_re, a_im, b_re, b_im = re[:half] >> shift, im[:half] >> shift, re[half:] >> shift, \
+            im[half:] >> shift
+        r_re, r_im = rot(a_re - b_re, a_im - b_im, np.arange(half))
+        re = np.concatenate([a_re + b_re, r_re])
+        im = np.concatenate([a_im + b_im, r_im])
+        exponent += shift
+        length, first = half, False
+
+    while length >= 4:
+        if not first:
+            shift = max(get_shift(value_range(re, im), 12), 0)
+        rnd = 0 if first or shift == 0 else 1 << (shift - 1)
+        q = length // 4
+        # rows: groups of the stage, columns: quarter of the group, index j inside the quarter
+        x_re = (re.reshape(-1, 4, q) + rnd) >> shift
+        x_im = (im.reshape(-1, 4, q) + rnd) >> shift
+        a, b, c, d = [(x_re[:, i, :], x_im[:, i, :]) for i in range(4)]
+        apc = (a[0] + c[0], a[1] + c[1])
+        amc = (a[0] - c[0], a[1] - c[1])
+        bpd = (b[0] + d[0], b[1] + d[1])
+        bmd = (b[0] - d[0], b[1] - d[1])
+        y = [(apc[0] + bpd[0], apc[1] + bpd[1]),
+             (apc[0] - bpd[0], apc[1] - bpd[1]),
+             (amc[0] + bmd[1], amc[1] - bmd[0]),
+             (amc[0] - bmd[1], amc[1] + bmd[0])]
+        if length > 4:
+            j = np.arange(q) * (n // length)
+            y[1] = rot(*y[1], 2 * j)
+            y[2] = rot(*y[2], j)
+            y[3] = rot(*y[3], 3 * j)
+        re = np.stack([v[0] for v in y], axis=1).flatten()
+        im = np.stack([v[1] for v in y], axis=1).flatten()
+        exponent += shift
+        length, first = length // 4, False
+
+    return exponent
@@ -0,0 +1,60 @@
+#!/usr/bin/env python3
+
+import numpy as np
+
+
+####################
+# generate_stimuli #
+####################
+
+
+def generate_stimuli(arg, env):
+    """
+    Function to generate the stimuli
+
+    Arguments
+    ---------
+    arg: Argument for which to generate stimuli (either Argument or ArrayArgument)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    """
+    pass
+
+
+##################
+# compute_result #
+##################
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.ctype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+    # all transforms keep the fixed-point format of the input, with a factor 1/len
+    x = inputs['pSrc'].value.astype(np.float64)
+    length = env['len']
+    n = np.arange(length)
+    if env['dct_type'] == 2:
+        # DCT-II: y[k] = 1/N sum_n x[n] cos(pi k (2n+1) / (2N))
+        result = np.cos(np.pi * np.outer(n, 2 * n + 1) / (2 * length)) @ x / length
+    elif env['dct_type'] == 3:
+        # inverse DCT-II: x[n] = 1/N (y[0]/2 + sum_{k>0} y[k] cos(pi k (2n+1) / (2N)))
+        y = x.copy()
+        y[0] /= 2
+        result = np.cos(np.pi * np.outer(2 * n + 1, n) / (2 * length)) @ y / length
+    else:
+        # DCT-IV: y[k] = 1/N sum_n x[n] cos(pi (2k+1) (2n+1) / (4N))
+        result = np.cos(np.pi * np.outer(2 * n + 1, 2 * n + 1) / (4 * length)) @ x / length
+
+    if result_parameter.ctype == 'int16_t':
+        return np.clip(np.round(result), -2**15, 2**15 - 1).astype(np.int16)
+    elif result_parameter.ctype == 'int32_t':
+        return np.clip(np.round(result), -2**31, 2**31 - 1).astype(np.int32)
+    else:
+        raise RuntimeError("Unrecognized result type: %s" % result_parameter.ctype)
@@ -0,0 +1,69 @@
+#!/usr/bin/env python3
+
+import numpy as np
+
+
+####################
+# generate_stimuli #
+####################
+
+
+def generate_stimuli(arg, env):
+    """
+    Function to generate the stimuli
+
+    Arguments
+    ---------
+    arg: Argument for which to generate stimuli (either Argument or ArrayArgument)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    """
+    # name = arg.name
+    # if name == "srcA":
+    #     # generate and return stimuli for srcA
+    # if name == "srcB":
+    #     # generate and return stimuli for srcB
+    # ...
+
+
+##################
+# compute_result #
+##################
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.ctype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+    count = env['count']
+    if 'p1' in inputs:
+        # in-place fixed-point complex FFT, the output is the spectrum divided by len
+        src = inputs['p1'].value.astype(np.float64).reshape(count, -1)
+        spectrum = np.fft.fft(src[:, 0::2] + 1j * src[:, 1::2]) / env['len']
+    elif 'srcStride' in inputs:
+        src = inputs['pSrc'].value.astype(np.float64).reshape(count, -1)
+        if result_parameter.ctype == 'float':
+            # full spectrum of the real input
+            spectrum = np.fft.fft(src)
+        else:
+            # first len/2+1 values, divided by len
+            spectrum = np.fft.rfft(src) / env['len']
+    else:
+        src = inputs['pSrc'].value.astype(np.float64).reshape(count, -1)
+        spectrum = np.fft.fft(src[:, 0::2] + 1j * src[:, 1::2])
+
+    # frames of interleaved (real, imag) values
+    result = np.stack([spectrum.real, spectrum.imag], axis=2).flatten()
+    if result_parameter.ctype == 'float':
+        return result.astype(np.float32)
+    elif result_parameter.ctype in ('int16_t', 'int32_t'):
+        info = np.iinfo(result_parameter.ctype[:-2])
+        return np.clip(np.round(result), info.min, info.max).astype(result_parameter.ctype[:-2])
+    else:
+        raise RuntimeError("Unrecognized result type: %s" % result_parameter.ctype)
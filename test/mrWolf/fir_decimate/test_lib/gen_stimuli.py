@@ -0,0 +1,62 @@
+#!/usr/bin/env python3
+
+import numpy as np
+
+
+####################
+# generate_stimuli #
+####################
+
+
+def generate_stimuli(arg, env):
+    """
+    Function to generate the stimuli
+
+    Arguments
+    ---------
+    arg: Argument for which to generate stimuli (either Argument or ArrayArgument)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    """
+    pass
+
+
+##################
+# compute_result #
+##################
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.ctype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+    # the coefficients are stored in time-reversed order, the state starts with zeros before the
+    # block pPrev, whose outputs are dropped
+    h = inputs['coeffs'].value[::-1]
+    n_prev = len(inputs['pPrev'].value)
+    src = np.concatenate([inputs['pPrev'].value, inputs['pSrc'].value])
+    M = env['M']
+
+    if result_parameter.ctype == 'float':
+        y = np.convolve(src.astype(np.float64), h.astype(np.float64))[:len(src):M]
+        return y[n_prev // M:].astype(np.float32)
+    elif result_parameter.ctype == 'int16_t':
+        y = np.convolve(src.astype(np.int64), h.astype(np.int64))[:len(src):M]
+        y = (y[n_prev // M:] + (1 << (fix_point - 1))) >> fix_point
+        return np.clip(y, -2**15, 2**15 - 1).astype(np.int16)
+    elif result_parameter.ctype == 'int32_t':
+        # every product is rounded separately
+        y = np.zeros(len(src) // M, dtype=np.int64)
+        for m in range(len(y)):
+            for k in range(len(h)):
+                if m * M - k >= 0:
+                    y[m] += (int(src[m * M - k]) * int(h[k]) + (1 << (fix_point - 1))) >> fix_point
+        return y[n_prev // M:].astype(np.int32)
+    else:
+        raise RuntimeError("Unrecognized result type: %s" % result_parameter.ctype)
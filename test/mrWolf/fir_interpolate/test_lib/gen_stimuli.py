@@ -0,0 +1,73 @@
+#!/usr/bin/env python3
+
+import numpy as np
+
+
+####################
+# generate_stimuli #
+####################
+
+
+def generate_stimuli(arg, env):
+    """
+    Function to generate the stimuli
+
+    Arguments
+    ---------
+    arg: Argument for which to generate stimuli (either Argument or ArrayArgument)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    """
+    pass
+
+
+##################
+# compute_result #
+##################
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.ctype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+    # rebuild the prototype filter from the time-reversed polyphase filters, the state starts with
+    # zeros before the block pPrev, whose outputs are dropped
+    L, P = env['L'], env['phaseLength']
+    pc = inputs['coeffs'].value
+    h = np.zeros(L * P, dtype=pc.dtype)
+    for p in range(L):
+        for j in range(P):
+            h[p + j * L] = pc[p * P + P - 1 - j]
+    n_prev = len(inputs['pPrev'].value)
+    src = np.concatenate([inputs['pPrev'].value, inputs['pSrc'].value])
+    outLen = len(src) * L
+
+    if result_parameter.ctype == 'float':
+        up = np.zeros(outLen)
+        up[::L] = src
+        y = np.convolve(up, h.astype(np.float64))[:outLen]
+        return y[n_prev * L:].astype(np.float32)
+    elif result_parameter.ctype == 'int16_t':
+        up = np.zeros(outLen, dtype=np.int64)
+        up[::L] = src
+        y = np.convolve(up, h.astype(np.int64))[:outLen]
+        y = (y[n_prev * L:] + (1 << (fix_point - 1))) >> fix_point
+        return np.clip(y, -2**15, 2**15 - 1).astype(np.int16)
+    elif result_parameter.ctype == 'int32_t':
+        # every product is rounded separately
+        y = np.zeros(outLen, dtype=np.int64)
+        for n in range(len(src)):
+            for p in range(L):
+                for j in range(P):
+                    if n - j >= 0:
+                        y[n * L + p] += (int(src[n - j]) * int(h[p + j * L]) +
+                                         (1 << (fix_point - 1))) >> fix_point
+        return y[n_prev * L:].astype(np.int32)
+    else:
+        raise RuntimeError("Unrecognized result type: %s" % result_parameter.ctype)
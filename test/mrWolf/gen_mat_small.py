@@ -0,0 +1,390 @@
+#! /usr/bin/python3
+
+"""
+Generator of include/plp_mat_small.h, the fixed-size (2x2, 3x3 and 4x4) matrix kernels.
+
+The kernels are static inline functions without any loop, such that a call with a known size
+compiles to straight-line code. The multiplications keep the summation order and the rounding of
+the generic kernels (plp_mat_mult_*s_*), hence their results are bit-exact. The header also
+contains the size dispatchers used by the glue code, which call the fixed-size kernel if the
+dimensions match one of them.
+
+Run this script after changing it, and commit the regenerated header.
+"""
+
+import os
+import time
+import textwrap
+import argparse
+
+ROOT_DIR = os.path.abspath(os.path.join(os.path.dirname(os.path.realpath(__file__)), "../.."))
+HEADER_FILE = os.path.join(ROOT_DIR, "include", "plp_mat_small.h")
+
+# sizes (M, N, O) of the multiplications, the matrix-vector products (O = 1) are only generated for
+# the non-transposed multiplication, since the transposed vector has the same layout
+MULT_SIZES = [(2, 2, 2), (3, 3, 3), (4, 4, 4), (2, 2, 1), (3, 3, 1), (4, 4, 1)]
+SQUARE_SIZES = [2, 3, 4]
+
+# name: type suffix, ctype: C type, desc: description for the documentation, fix: fixed-point
+MULT_TYPES = [
+    dict(name="i32", ctype="int32_t", desc="32-bit integer", fix=False),
+    dict(name="q32", ctype="int32_t", desc="32-bit fixed-point", fix=True),
+    dict(name="q16", ctype="int16_t", desc="16-bit fixed-point", fix=True),
+    dict(name="f32", ctype="float", desc="32-bit floating-point", fix=False),
+]
+TRANS_TYPES = [
+    dict(name="i32", ctype="int32_t", desc="32-bit integer (and fixed-point)"),
+    dict(name="i16", ctype="int16_t", desc="16-bit integer (and fixed-point)"),
+    dict(name="f32", ctype="float", desc="32-bit floating-point"),
+]
+
+HEADER_TEMPLATE = """\
+/* ----------------------------------------------------------------------
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_small.h
+ * Description:  Fixed-size matrix kernels (2x2, 3x3 and 4x4)
+ *
+ * $Date:        {date}
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * This file is generated by test/mrWolf/gen_mat_small.py, do not edit it by hand.
+ */
+
+#ifndef __PLP_MAT_SMALL_H__
+#define __PLP_MAT_SMALL_H__
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @defgroup MatSmall Fixed-size Matrix Operations
+  Fully unrolled kernels for the multiplication, transposition, inversion and determinant of 2x2,
+  3x3 and 4x4 matrices, e.g. for rotations and quaternions. At these sizes, the loop setup and the
+  remainder handling of the generic kernels cost more than the arithmetic. The kernels are static
+  inline functions of this header, include it to call them directly with a known size, e.g.
+  plp_mat_mult_3x3x1_f32 to rotate a vector.
+
+  The glue code of plp_mat_mult, plp_mat_mult_trans, plp_mat_trans and plp_mat_inv uses the
+  dispatchers at the end of this header (e.g. plp_mat_mult_small_f32), which call the fixed-size
+  kernel when the dimensions match one of them. The multiplications compute the same sums in the
+  same order as the generic kernels, the fixed-point versions round and shift every product like
+  plp_mat_mult_q32. The inversion uses the adjugate matrix instead of Gauss-Jordan elimination.
+
+  The kernels can be used on the fabric controller and on the cluster. The inputs and the output
+  must not overlap, except for the transposition and the inversion, which read all the inputs
+  first.
+ */
+
+/**
+  @addtogroup MatSmall
+  @{{
+ */
+{body}
+/**
+  @}} end of MatSmall group
+ */
+
+#endif // __PLP_MAT_SMALL_H__
+"""
+
+
+def wrap_sum(lhs, terms, indent=4, prefix="", last=";"):
+    """ Assignment of the sum of terms to lhs, wrapped at 100 columns """
+    first = " " * indent + lhs + " = " + prefix
+    cont = " " * len(first)
+    lines = []
+    cur = first
+    for i, term in enumerate(terms):
+        piece = term + (" + " if i < len(terms) - 1 else last)
+        if len(cur + piece.rstrip()) > 100 and cur != first:
+            lines.append(cur.rstrip())
+            cur = cont
+        cur += piece
+    lines.append(cur)
+    return "\n".join(lines) + "\n"
+
+
+def signature(ret, name, args):
+    head = "static inline {} {}(".format(ret, name)
+    return head + (",\n" + " " * len(head)).join(args) + ") {\n"
+
+
+def doc(brief, params, ret="none"):
+    out = "\n/**\n  @brief      {}\n".format("\n              ".join(textwrap.wrap(brief, 86)))
+    width = max(len(p[1]) for p in params)
+    for direction, name, text in params:
+        out += "  {:<11} {:<{w}}  {}\n".format("@param[{}]".format(direction), name, text,
+                                              w=width)
+    out += "  @return     {}\n */\n\n".format(ret)
+    return out
+
+
+def mult(t, size, trans):
+    m, n, o = size
+    base = "plp_mat_mult_trans" if trans else "plp_mat_mult"
+    name = "{}_{}x{}x{}_{}".format(base, m, n, o, t["name"])
+    ct = t["ctype"]
+    what = "matrix transposed matrix multiplication" if trans else "matrix multiplication"
+    b_shape = "{}x{}".format(o, n) if trans else "{}x{}".format(n, o)
+    params = [("in", "pSrcA", "points to the first input matrix ({}x{})".format(m, n)),
+              ("in", "pSrcB", "points to the second input matrix ({}){}".format(
+                  b_shape, ", which is transposed" if trans else ""))]
+    if t["fix"]:
+        params.append(("in", "shift", "amount of bits to shift the products to the right"))
+    params.append(("out", "pDstC", "points to the output matrix ({}x{})".format(m, o)))
+    out = doc("{}x{}x{} {} of {} matrices.".format(m, n, o, what, t["desc"]), params)
+    args = ["const {} *__restrict__ pSrcA".format(ct), "const {} *__restrict__ pSrcB".format(ct)]
+    if t["fix"]:
+        args.append("uint32_t shift")
+    args.append("{} *__restrict__ pDstC".format(ct))
+    out += signature("void", name, args)
+    if t["fix"]:
+        out += "    int32_t round = (1 << shift) >> 1;\n\n"
+    for i in range(m):
+        for k in range(o):
+            terms = []
+            for j in range(n):
+                b = k * n + j if trans else j * o + k
+                if t["name"] == "q16":
+                    prod = "(int32_t)pSrcA[{}] * pSrcB[{}]".format(i * n + j, b)
+                else:
+                    prod = "pSrcA[{}] * pSrcB[{}]".format(i * n + j, b)
+                terms.append("((" + prod + " + round) >> shift)" if t["fix"] else prod)
+            if t["name"] == "q16":
+                out += wrap_sum("pDstC[{}]".format(i * o + k), terms, prefix="(int16_t)(",
+                                last=");")
+            else:
+                out += wrap_sum("pDstC[{}]".format(i * o + k), terms)
+    out += "}\n"
+    return out
+
+
+def trans(t, n):
+    name = "plp_mat_trans_{}x{}_{}".format(n, n, t["name"])
+    ct = t["ctype"]
+    out = doc("{}x{} matrix transposition of {} matrices.".format(n, n, t["desc"]),
+              [("in", "pSrc", "points to the input matrix, may be equal to pDst"),
+               ("out", "pDst", "points to the output matrix")])
+    out += signature("void", name, ["const {} *pSrc".format(ct), "{} *pDst".format(ct)])
+    out += load_matrix(ct, n)
+    out += "\n"
+    for i in range(n):
+        for j in range(n):
+            out += "    pDst[{}] = a{}{};\n".format(i * n + j, j, i)
+    out += "}\n"
+    return out
+
+
+def load_matrix(ct, n):
+    out = ""
+    for i in range(n):
+        for j in range(n):
+            out += "    {} a{}{} = pSrc[{}];\n".format(ct, i, j, i * n + j)
+    return out
+
+
+# Determinant and adjugate of the square matrices, with the elements aij (row i, column j) loaded
+# into local variables. DET defines det, ADJ maps the output index to the adjugate element.
+DET = {
+    2: "    float det = a00 * a11 - a01 * a10;\n",
+    3: ("    float c00 = a11 * a22 - a12 * a21;\n"
+        "    float c01 = a12 * a20 - a10 * a22;\n"
+        "    float c02 = a10 * a21 - a11 * a20;\n"
+        "    float det = a00 * c00 + a01 * c01 + a02 * c02;\n"),
+    # Laplace expansion along the 2x2 minors of the first two rows (s) and the last two rows (c)
+    4: ("    float s0 = a00 * a11 - a10 * a01;\n"
+        "    float s1 = a00 * a12 - a10 * a02;\n"
+        "    float s2 = a00 * a13 - a10 * a03;\n"
+        "    float s3 = a01 * a12 - a11 * a02;\n"
+        "    float s4 = a01 * a13 - a11 * a03;\n"
+        "    float s5 = a02 * a13 - a12 * a03;\n"
+        "    float c5 = a22 * a33 - a32 * a23;\n"
+        "    float c4 = a21 * a33 - a31 * a23;\n"
+        "    float c3 = a21 * a32 - a31 * a22;\n"
+        "    float c2 = a20 * a33 - a30 * a23;\n"
+        "    float c1 = a20 * a32 - a30 * a22;\n"
+        "    float c0 = a20 * a31 - a30 * a21;\n"
+        "    float det = s0 * c5 - s1 * c4 + s2 * c3 + s3 * c2 - s4 * c1 + s5 * c0;\n"),
+}
+ADJ = {
+    2: ["a11", "-a01", "-a10", "a00"],
+    3: ["c00", "a02 * a21 - a01 * a22", "a01 * a12 - a02 * a11",
+        "c01", "a00 * a22 - a02 * a20", "a02 * a10 - a00 * a12",
+        "c02", "a01 * a20 - a00 * a21", "a00 * a11 - a01 * a10"],
+    4: ["a11 * c5 - a12 * c4 + a13 * c3", "-a01 * c5 + a02 * c4 - a03 * c3",
+        "a31 * s5 - a32 * s4 + a33 * s3", "-a21 * s5 + a22 * s4 - a23 * s3",
+        "-a10 * c5 + a12 * c2 - a13 * c1", "a00 * c5 - a02 * c2 + a03 * c1",
+        "-a30 * s5 + a32 * s2 - a33 * s1", "a20 * s5 - a22 * s2 + a23 * s1",
+        "a10 * c4 - a11 * c2 + a13 * c0", "-a00 * c4 + a01 * c2 - a03 * c0",
+        "a30 * s4 - a31 * s2 + a33 * s0", "-a20 * s4 + a21 * s2 - a23 * s0",
+        "-a10 * c3 + a11 * c1 - a12 * c0", "a00 * c3 - a01 * c1 + a02 * c0",
+        "-a30 * s3 + a31 * s1 - a32 * s0", "a20 * s3 - a21 * s1 + a22 * s0"],
+}
+
+
+def det(n):
+    name = "plp_mat_det_{}x{}_f32".format(n, n)
+    out = doc("Determinant of a {}x{} 32-bit floating-point matrix.".format(n, n),
+              [("in", "pSrc", "points to the input matrix")], ret="determinant of the matrix")
+    out += signature("float", name, ["const float *pSrc"])
+    out += load_matrix("float", n)
+    out += "\n" + DET[n] + "\n    return det;\n}\n"
+    return out
+
+
+def inv(n):
+    name = "plp_mat_inv_{}x{}_f32".format(n, n)
+    out = doc("{}x{} matrix inversion of 32-bit floating-point matrices.".format(n, n),
+              [("in", "pSrc", "points to the input matrix, may be equal to pDst"),
+               ("out", "pDst", "points to the output matrix")],
+              ret="0: Success, 1: Matrix is singular (pDst is not modified)")
+    out += signature("int", name, ["const float *pSrc", "float *pDst"])
+    out += load_matrix("float", n)
+    out += "\n" + DET[n]
+    out += "\n    if (det == 0.0f) {\n        return 1;\n    }\n\n"
+    out += "    float invDet = 1.0f / det;\n\n"
+    for i, adj in enumerate(ADJ[n]):
+        term = "(" + adj + ")" if " " in adj else adj
+        out += "    pDst[{}] = {} * invDet;\n".format(i, term)
+    out += "    return 0;\n}\n"
+    return out
+
+
+def dispatch_mult(t, trans):
+    base = "plp_mat_mult_trans" if trans else "plp_mat_mult"
+    ct = t["ctype"]
+    shift = ", shift" if t["fix"] else ""
+    params = [("in", "pSrcA", "points to the first input matrix (MxN)"),
+              ("in", "pSrcB", "points to the second input matrix ({})".format(
+                  "OxN, transposed" if trans else "NxO")),
+              ("in", "M", "height of the first input matrix and of the output"),
+              ("in", "N", "width of the first input matrix"),
+              ("in", "O", "width of the output")]
+    if t["fix"]:
+        params.append(("in", "shift", "amount of bits to shift the products to the right"))
+    params.append(("out", "pDstC", "points to the output matrix (MxO)"))
+    out = doc("Calls the fixed-size kernel of {} if MxNxO is one of the generated sizes.".format(
+        base), params, ret="1 if the output has been computed, 0 if the size is not supported")
+    args = ["const {} *__restrict__ pSrcA".format(ct), "const {} *__restrict__ pSrcB".format(ct),
+            "uint32_t M", "uint32_t N", "uint32_t O"]
+    if t["fix"]:
+        args.append("uint32_t shift")
+    args.append("{} *__restrict__ pDstC".format(ct))
+    out += signature("int", "{}_small_{}".format(base, t["name"]), args)
+    for k, (m, n, o) in enumerate(MULT_SIZES):
+        # a transposed vector (1xN) has the same layout as the vector (Nx1)
+        kernel = base if o > 1 else "plp_mat_mult"
+        out += "    {} (M == {} && N == {} && O == {}) {{\n".format(
+            "if" if k == 0 else "} else if", m, n, o)
+        out += "        {}_{}x{}x{}_{}(pSrcA, pSrcB{}, pDstC);\n".format(
+            kernel, m, n, o, t["name"], shift)
+    out += "    } else {\n        return 0;\n    }\n    return 1;\n}\n"
+    return out
+
+
+def dispatch_trans(t):
+    ct = t["ctype"]
+    out = doc("Calls the fixed-size kernel of plp_mat_trans if MxN is one of the generated sizes.",
+              [("in", "pSrc", "points to the input matrix (MxN)"),
+               ("in", "M", "height of the input matrix"),
+               ("in", "N", "width of the input matrix"),
+               ("out", "pDst", "points to the output matrix (NxM)")],
+              ret="1 if the output has been computed, 0 if the size is not supported")
+    out += signature("int", "plp_mat_trans_small_{}".format(t["name"]),
+                     ["const {} *pSrc".format(ct), "uint32_t M", "uint32_t N",
+                      "{} *pDst".format(ct)])
+    for k, n in enumerate(SQUARE_SIZES):
+        out += "    {} (M == {} && N == {}) {{\n".format("if" if k == 0 else "} else if", n, n)
+        out += "        plp_mat_trans_{}x{}_{}(pSrc, pDst);\n".format(n, n, t["name"])
+    out += "    } else {\n        return 0;\n    }\n    return 1;\n}\n"
+    return out
+
+
+def dispatch_inv():
+    out = doc("Calls the fixed-size kernel of plp_mat_inv if NxN is one of the generated sizes.",
+              [("in", "pSrc", "points to the input matrix"),
+               ("in", "N", "width and height of the matrices"),
+               ("out", "pDst", "points to the output matrix")],
+              ret="0: Success, 1: Matrix is singular, 2: size not supported")
+    out += signature("int", "plp_mat_inv_small_f32",
+                     ["const float *pSrc", "uint32_t N", "float *pDst"])
+    for k, n in enumerate(SQUARE_SIZES):
+        out += "    {} (N == {}) {{\n".format("if" if k == 0 else "} else if", n)
+        out += "        return plp_mat_inv_{}x{}_f32(pSrc, pDst);\n".format(n, n)
+    out += "    } else {\n        return 2;\n    }\n}\n"
+    return out
+
+
+def generate():
+    body = ""
+    for t in MULT_TYPES:
+        for size in MULT_SIZES:
+            body += mult(t, size, False)
+        for size in MULT_SIZES:
+            if size[2] > 1:
+                body += mult(t, size, True)
+    for t in TRANS_TYPES:
+        for n in SQUARE_SIZES:
+            body += trans(t, n)
+    for n in SQUARE_SIZES:
+        body += det(n)
+    for n in SQUARE_SIZES:
+        body += inv(n)
+    for t in MULT_TYPES:
+        body += dispatch_mult(t, False)
+        body += dispatch_mult(t, True)
+    for t in TRANS_TYPES:
+        body += dispatch_trans(t)
+    body += dispatch_inv()
+    return body
+
+
+def read_date(output):
+    """ keep the date of the existing header, such that regenerating it is reproducible """
+    if os.path.isfile(output):
+        with open(output, "r") as f:
+            for line in f.readlines():
+                if line.startswith(" * $Date:"):
+                    return line.split(":", 1)[1].strip()
+    return time.strftime("%d. %b %Y")
+
+
+def main():
+    """ Main Function """
+    parser = argparse.ArgumentParser(prog='gen_mat_small',
+                                     description='Generate the fixed-size matrix kernels')
+    parser.add_argument('-o', '--output', type=str, default=HEADER_FILE,
+                        help='Header file to write (default: include/plp_mat_small.h)')
+    args = parser.parse_args()
+
+    date = read_date(args.output)
+    with open(args.output, "w") as f:
+        f.write(HEADER_TEMPLATE.format(date=date, body=generate()))
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,128 @@
+#!/usr/bin/env python3
+
+import numpy as np
+
+
+##################
+# compute_result #
+##################
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.ctype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+    if 'twiddles' in inputs:
+        return sliding_dft(result_parameter, inputs, env)
+    return goertzel(result_parameter, inputs, env, fix_point)
+
+
+def goertzel(result_parameter, inputs, env, fix_point):
+    """ Bins of the DFT of the block, the fix-point samples are shifted by fix_point """
+    x = inputs['pSrc'].value
+    if result_parameter.ctype != 'float':
+        x = x.astype(np.int64) >> fix_point
+    spectrum = np.fft.fft(x.astype(np.float64))[goertzel_bins(env)]
+    result = np.stack([spectrum.real, spectrum.imag], axis=1).flatten()
+    if result_parameter.ctype == 'float':
+        return result.astype(np.float32)
+    return np.round(result).astype(np.int32)
+
+
+def sliding_dft(result_parameter, inputs, env):
+    """
+    Bins of the DFT of the last len_n samples (the window starts with zeros), rotated with the
+    twiddle factors of the test as the modulated sliding DFT. The fix-point state is exact.
+    """
+    n, length = env['len_n'], env['len']
+    x = inputs['pSrc'].value.astype(np.int64 if result_parameter.ctype != 'float' else np.float64)
+    tw = inputs['twiddles'].value.reshape(-1, 2)
+    window = range(max(0, length - n), length)
+    result = []
+
+    for k in inputs['bins'].value:
+        k = int(k)
+        p = (k * length) % n
+        if result_parameter.ctype == 'float':
+            w = tw.astype(np.float64)
+            yr = sum(x[i] * w[(k * i) % n, 0] for i in window)
+            yi = -sum(x[i] * w[(k * i) % n, 1] for i in window)
+            result += [yr * w[p, 0] - yi * w[p, 1], yr * w[p, 1] + yi * w[p, 0]]
+        else:
+            w = tw.astype(np.int64)
+            yr = sum(int(x[i]) * int(w[(k * i) % n, 0]) for i in window)
+            yi = -sum(int(x[i]) * int(w[(k * i) % n, 1]) for i in window)
+            c, s = int(w[p, 0]), int(w[p, 1])
+            result += [(yr * c - yi * s + (1 << 29)) >> 30, (yr * s + yi * c + (1 << 29)) >> 30]
+    if result_parameter.ctype == 'float':
+        return np.array(result, dtype=np.float32)
+    return np.array(result, dtype=np.int32)
+
+
+def to_fix(values, version):
+    """ Converts the values in [-1, 1] to Q1.15 or Q1.31, saturating 1 """
+    bits = 15 if version.startswith('q16') else 31
+    return np.clip(np.round(values * 2**bits), -2**bits, 2**bits - 1).astype(np.int64)
+
+
+def goertzel_bins(env):
+    """
+    Bins of the Goertzel test, the first ones are 0 (cos(w) = 1) and len / 2 (cos(w) = -1), followed
+    by the lowest bins, whose frequency is the most sensitive to the precision of cos(w)
+    """
+    n = env['len']
+    bins = [0, n // 2, 1, 2, 3, n // 8, 3 * n // 8 + 1, 7 * n // 8 + 1]
+    return np.array(bins[:env['n_bins']])
+
+
+def goertzel_freqs(env, version):
+    """ Frequencies of the bins in cycles per sample, exact in Q1.15 and Q1.31 """
+    freqs = goertzel_bins(env) / env['len']
+    if version.startswith('f'):
+        return freqs.astype(np.float32)
+    return to_fix(freqs, version)
+
+
+def sdft_bins(env):
+    """ Bins of the sliding DFT, including the first and the last one """
+    n = env['len_n']
+    return np.array([1, n // 4, n // 2, n - 1][:env['n_bins']])
+
+
+def sdft_twiddles(env, version):
+    """ cos(2 pi m / N) and sin(2 pi m / N) """
+    w = 2 * np.pi * np.arange(env['len_n']) / env['len_n']
+    twiddles = np.stack([np.cos(w), np.sin(w)], axis=1).flatten()
+    if version.startswith('f'):
+        return twiddles.astype(np.float32)
+    return to_fix(twiddles, version)
+
+
+def random_samples(env, version):
+    """
+    Random samples, which are small enough for the 32-bit state of the Goertzel algorithm in the
+    q32 version (shifted by 4 bits)
+    """
+    length = env['len']
+    if version.startswith('f'):
+        return np.random.uniform(-1, 1, size=length).astype(np.float32)
+    if version.startswith('q32'):
+        return np.random.randint(-2**22, 2**22, size=length)
+    return np.random.randint(-2**15, 2**15, size=length)
+
+
+def goertzel_samples(env, version):
+    """
+    Random samples, the floating-point ones are scaled by 8/len such that the rounding errors of
+    the recursion stay below the absolute tolerance of 1e-4 also for the small parts of the bins
+    """
+    if version.startswith('f'):
+        return (random_samples(env, version) * 8 / env['len']).astype(np.float32)
+    return random_samples(env, version)
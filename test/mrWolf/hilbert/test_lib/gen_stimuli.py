@@ -0,0 +1,108 @@
+#!/usr/bin/env python3
+
+import numpy as np
+
+
+##################
+# compute_result #
+##################
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.ctype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+    is_float = result_parameter.ctype == 'float'
+    if 'pPrev' in inputs:
+        x, h = hilbert_fir(inputs, env, is_float)
+    else:
+        x, h = hilbert_fft(inputs, is_float)
+
+    if result_parameter.name.endswith('pEnv'):
+        if is_float:
+            return np.hypot(x, h).astype(np.float32)
+        return np.minimum(np.round(np.hypot(x, h)), 2**15 - 1).astype(np.int16)
+    result = np.stack([x, h], axis=1).flatten()
+    return result.astype(np.float32 if is_float else np.int16)
+
+
+def hilbert_fft(inputs, is_float):
+    """ analytic signal of the block (one period of a periodic signal) """
+    x = inputs['pSrc'].value.astype(np.float64)
+    n = len(x)
+    gain = np.zeros(n)
+    gain[0], gain[n // 2], gain[1:n // 2] = 1, 1, 2
+    h = np.fft.ifft(np.fft.fft(x) * gain).imag
+    if is_float:
+        return x, h
+    # the real part is the input, the Hilbert transform is rounded
+    return x, np.clip(np.round(h), -2**15, 2**15 - 1)
+
+
+def hilbert_fir(inputs, env, is_float):
+    """
+    FIR Hilbert transformer with the coefficients of plp_hilbert_fir_init_*, which filters the block
+    pPrev and then the block pSrc, starting with zeros in the state. Returns the output of pSrc.
+    """
+    dtype = np.float64 if is_float else np.int64
+    x = np.concatenate([inputs['pPrev'].value, inputs['pSrc'].value]).astype(dtype)
+    coeffs = fir_coeffs(env, 'f32' if is_float else 'q16').astype(dtype)
+    delay = 2 * env['n_pairs'] - 1
+    padded = np.concatenate([np.zeros(2 * delay, dtype=dtype), x])
+    h = []
+    for n in range(len(x)):
+        center = n + delay
+        h.append(sum(c * (padded[center - j] - padded[center + j])
+                     for c, j in zip(coeffs, range(1, 2 * delay, 2))))
+    h = np.array(h)
+    if not is_float:
+        h = np.clip((h + (1 << 14)) >> 15, -2**15, 2**15 - 1)
+    n_prev = len(inputs['pPrev'].value)
+    return padded[delay + n_prev:delay + len(x)], h[n_prev:]
+
+
+def make_signal(env, version):
+    """ amplitude modulated tone with noise, the tone is periodic in blocks of len samples """
+    n = np.arange(env['len'])
+    k = int(0.15 * env['len'])
+    signal = 0.45 * (1 + 0.6 * np.cos(2 * np.pi * 3 * n / env['len']))
+    signal *= np.sin(2 * np.pi * k * n / env['len'] + 0.3)
+    signal += np.random.uniform(-0.05, 0.05, size=env['len'])
+    if version == 'f32':
+        return signal.astype(np.float32)
+    return np.round(signal * 2**15).astype(np.int16)
+
+
+def previous_block(env, version):
+    """ tone with noise, filtered before the tested block """
+    n = np.arange(env['len_prev'])
+    signal = 0.7 * np.sin(2 * np.pi * 0.11 * n + 0.5)
+    signal += np.random.uniform(-0.05, 0.05, size=env['len_prev'])
+    if version == 'f32':
+        return signal.astype(np.float32)
+    return np.round(signal * 2**15).astype(np.int16)
+
+
+def square_wave(env, version):
+    """ full-scale square wave with a period of 128 samples, its steps span all taps """
+    signal = np.where(np.arange(env['len']) % 128 < 64, 1.0, -1.0)
+    if version == 'f32':
+        return signal.astype(np.float32)
+    return np.where(signal > 0, 2**15 - 1, -2**15).astype(np.int16)
+
+
+def fir_coeffs(env, version):
+    """ windowed coefficients as computed by plp_hilbert_fir_init_* """
+    j = 2 * np.arange(env['n_pairs']) + 1
+    phase = 2 * np.pi * j / (4 * env['n_pairs'])
+    coeffs = (0.42 + 0.5 * np.cos(phase) + 0.08 * np.cos(2 * phase)) * 2 / (np.pi * j)
+    if version == 'f32':
+        return coeffs.astype(np.float32)
+    return np.round(coeffs * 2**15).astype(np.int16)
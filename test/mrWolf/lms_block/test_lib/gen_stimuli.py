@@ -0,0 +1,74 @@
+#!/usr/bin/env python3
+
+import numpy as np
+
+
+####################
+# generate_stimuli #
+####################
+
+
+def generate_stimuli(arg, env):
+    """
+    Function to generate the stimuli
+
+    Arguments
+    ---------
+    arg: Argument for which to generate stimuli (either Argument or ArrayArgument)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    """
+    pass
+
+
+##################
+# compute_result #
+##################
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.ctype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+    # all outputs of the block use the initial coefficients (in time-reversed order), the state
+    # starts with zeros
+    num_taps = env['numTaps']
+    coeffs = inputs['coeffs'].value
+    ref = inputs['pRef'].value
+    ctype = result_parameter.ctype
+
+    if ctype == 'float':
+        state = np.concatenate([np.zeros(num_taps - 1), inputs['pSrc'].value.astype(np.float64)])
+        out = np.array([np.dot(coeffs.astype(np.float64), state[n:n + num_taps])
+                        for n in range(len(ref))])
+        err = ref - out
+        res = out if result_parameter.general_name() == 'pOut' else err
+        return res.astype(np.float32)
+
+    state = [0] * (num_taps - 1) + [int(v) for v in inputs['pSrc'].value]
+    coeffs = [int(v) for v in coeffs]
+    rnd = 1 << (fix_point - 1)
+    out, err = [], []
+    for n in range(len(ref)):
+        x = state[n:n + num_taps]
+        if ctype == 'int16_t':
+            y = sat16((sum(c * v for c, v in zip(coeffs, x)) + rnd) >> fix_point)
+            e = sat16(int(ref[n]) - y)
+        else:
+            y = sum((c * v + rnd) >> fix_point for c, v in zip(coeffs, x))
+            e = int(ref[n]) - y
+        out.append(y)
+        err.append(e)
+
+    dtype = np.int16 if ctype == 'int16_t' else np.int32
+    return np.array(out if result_parameter.general_name() == 'pOut' else err, dtype=dtype)
+
+
+def sat16(x):
+    return max(-2**15, min(2**15 - 1, x))
@@ -0,0 +1,57 @@
+#!/usr/bin/env python3
+
+import numpy as np
+
+
+##################
+# compute_result #
+##################
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.ctype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+    op = env['op']
+    count = env['count']
+
+    if op == 'inv':
+        n = env['len_n']
+        a = inputs['pSrc'].value.reshape((count, n, n))
+        if "return_value" in result_parameter.name:
+            return 0
+        return np.linalg.inv(a).reshape(-1).astype(np.float32)
+
+    is_float = result_parameter.ctype == 'float'
+    dtype = np.float32 if is_float else np.int64
+    m, n = env['len_m'], env['len_n']
+
+    if op == 'add':
+        a = inputs['srcA'].value.astype(dtype).reshape((count, m, n))
+        b = inputs['srcB'].value.astype(dtype).reshape((-1, m, n))
+        result = a + b
+    else:
+        o = env['len_o']
+        a = inputs['srcA'].value.astype(dtype).reshape((count, m, n))
+        if op == 'mult_trans':
+            b = np.swapaxes(inputs['srcB'].value.astype(dtype).reshape((-1, o, n)), 1, 2)
+        else:
+            b = inputs['srcB'].value.astype(dtype).reshape((-1, n, o))
+        result = np.matmul(a, b)
+
+    if is_float:
+        return result.reshape(-1).astype(np.float32)
+    # the products are accumulated in 32 bits, with wrap-around
+    return wrap32(result).reshape(-1).astype(np.int32)
+
+
+def wrap32(x):
+    """ Wraps the integers x around to 32 bits, as the 32-bit accumulator """
+    return (x + 2**31) % 2**32 - 2**31
@@ -95,7 +95,7 @@ for i in sizes:
 	version8p_perf.append(output8p[5]/output8p[1])
 
 f = open("performance.csv", "w+")
-f.write ('n,32,32p,16,16p,8,fc_32,fc_16,fc_8\n')
+f.write ('n,32,32p,16,16p,8,8p,fc_32,fc_16,fc_8\n')
 
 for i,n in enumerate(sizes):
 	f.write(str(n))
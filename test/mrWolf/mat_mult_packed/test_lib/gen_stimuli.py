@@ -0,0 +1,76 @@
+#!/usr/bin/env python3
+
+import numpy as np
+
+
+##################
+# compute_result #
+##################
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.ctype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+    if 'srcB' in inputs:
+        # plp_mat_pack_b
+        bits = 8 if inputs['srcB'].ctype == 'int8_t' else 16
+        b = inputs['srcB'].value.reshape((env['len_n'], env['len_o']))
+        return pack_b(b, bits)
+
+    bits = 8 if inputs['srcA'].ctype == 'int8_t' else 16
+    a = inputs['srcA'].value.astype(np.int64).reshape((env['len_m'], env['len_n']))
+    b = unpack_b(inputs['packedB'].value, bits, env['len_n'], env['len_o'])
+    result = np.matmul(a, b).reshape((env['len_res'], ))
+    if fix_point is not None:
+        # the products are accumulated exactly, and the sum is rounded once
+        dtype = np.int8 if result_parameter.ctype == "int8_t" else np.int16
+        result = ((result + (1 << (fix_point - 1))) >> fix_point).astype(dtype)
+    else:
+        result = result.astype(np.int32)
+    return result
+
+
+###############
+# Packed data #
+###############
+
+
+def block_size(bits):
+    """ Number of rows and columns of a block in the packed layout """
+    return 4 if bits == 8 else 2
+
+
+def packed_length(env, version):
+    """ Number of elements of the packed matrix (PLP_MAT_PACK_B_I8_SIZE or _I16_SIZE) """
+    blk = block_size(8 if version.startswith(('i8', 'q8')) else 16)
+    return blk * blk * ((env['len_n'] + blk - 1) // blk) * ((env['len_o'] + blk - 1) // blk)
+
+
+def pack_b(b, bits):
+    """ Packs the matrix b (N x O) into the layout of plp_mat_pack_b """
+    blk = block_size(bits)
+    n, o = b.shape
+    n_blocks = (n + blk - 1) // blk
+    o_blocks = (o + blk - 1) // blk
+    padded = np.zeros((n_blocks * blk, o_blocks * blk), dtype=b.dtype)
+    padded[:n, :o] = b
+    # [column block][row group][column in block][row in group]
+    packed = padded.reshape((n_blocks, blk, o_blocks, blk)).transpose((2, 0, 3, 1))
+    return packed.flatten()
+
+
+def unpack_b(packed, bits, n, o):
+    """ Inverse of pack_b """
+    blk = block_size(bits)
+    n_blocks = (n + blk - 1) // blk
+    o_blocks = (o + blk - 1) // blk
+    padded = packed.astype(np.int64).reshape((o_blocks, n_blocks, blk, blk)).transpose((1, 3, 0, 2))
+    return padded.reshape((n_blocks * blk, o_blocks * blk))[:n, :o]
@@ -0,0 +1,40 @@
+#!/usr/bin/env python3
+
+import numpy as np
+
+
+##################
+# compute_result #
+##################
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.ctype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+    M = env['len_m']
+    N = env['len_n']
+    O = env['len_o']
+    stride_a = env.get('strideA', N)
+    stride_b = env.get('strideB', O)
+    stride_c = env.get('strideC', O)
+
+    a = inputs['srcA'].value.astype(np.int64).reshape((M, stride_a))[:, :N]
+    b = inputs['srcB'].value.astype(np.int64).reshape((N, stride_b))[:, :O]
+    bias = inputs['bias'].value.astype(np.int64).reshape((M, 1))
+    mult = inputs['mult'].value.astype(np.int64).reshape((M, 1))
+    shift = inputs['shift'].value.astype(np.int64).reshape((M, 1))
+    out_min = 0 if env['relu'] else -128
+
+    acc = np.matmul(a, b) + bias
+    val = (acc * mult + ((1 << shift) >> 1)) >> shift
+    result = np.zeros((M, stride_c), dtype=np.int8)
+    result[:, :O] = np.clip(val, out_min, 127)
+    return result.reshape((env['len_res'], ))
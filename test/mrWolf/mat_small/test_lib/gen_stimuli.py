@@ -0,0 +1,61 @@
+#!/usr/bin/env python3
+
+import numpy as np
+
+
+##################
+# compute_result #
+##################
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.ctype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+    op = env['op']
+
+    if op == 'inv':
+        n = env['len_n']
+        if "return_value" in result_parameter.name:
+            return 0
+        return np.linalg.inv(inputs['pSrc'].value.reshape((n, n))).reshape(-1).astype(np.float32)
+
+    if op == 'trans':
+        n = env['len_n']
+        return inputs['pSrc'].value.reshape((n, n)).T.reshape(-1)
+
+    m, n, o = env['len_m'], env['len_n'], env['len_o']
+    ctype = result_parameter.ctype
+    if ctype == 'float':
+        a = inputs['srcA'].value.astype(np.float32).reshape((m, n))
+        b = inputs['srcB'].value.astype(np.float32)
+        b = b.reshape((o, n)).T if op == 'mult_trans' else b.reshape((n, o))
+        # the products are summed in the order of the kernels
+        result = np.zeros((m, o), dtype=np.float32)
+        for k in range(n):
+            result = (result + np.outer(a[:, k], b[k, :]).astype(np.float32)).astype(np.float32)
+        return result.reshape(-1)
+
+    a = inputs['srcA'].value.astype(np.int64).reshape((m, n))
+    b = inputs['srcB'].value.astype(np.int64)
+    b = b.reshape((o, n)).T if op == 'mult_trans' else b.reshape((n, o))
+    if fix_point is None:
+        return wrap32(np.matmul(a, b)).reshape(-1).astype(np.int32)
+
+    # every product is rounded and shifted, the products and the sum wrap around to 32 bits
+    products = wrap32(a[:, :, None] * b[None, :, :])
+    result = wrap32(np.sum(wrap32(products + (1 << (fix_point - 1))) >> fix_point, axis=1))
+    dtype = np.int16 if ctype == "int16_t" else np.int32
+    return result.reshape(-1).astype(dtype)
+
+
+def wrap32(x):
+    """ Wraps the integers x around to 32 bits, as the 32-bit registers """
+    return (x + 2**31) % 2**32 - 2**31
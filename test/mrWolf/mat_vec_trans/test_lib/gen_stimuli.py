@@ -0,0 +1,42 @@
+#!/usr/bin/env python3
+
+import numpy as np
+
+
+##################
+# compute_result #
+##################
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.ctype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+    if result_parameter.ctype == 'float':
+        a = inputs['srcA'].value.astype(np.float32).reshape((env['len_m'], env['len_n']))
+        x = inputs['srcX'].value.astype(np.float32)
+        return np.matmul(a.T, x).astype(np.float32)
+
+    # the products are accumulated in 32 bits, with wrap-around
+    a = inputs['srcA'].value.astype(np.int64).reshape((env['len_m'], env['len_n']))
+    x = inputs['srcX'].value.astype(np.int64)
+    result = wrap32(np.matmul(a.T, x))
+    if fix_point is None:
+        return result.astype(np.int32)
+
+    # the sum is rounded once
+    ctype = result_parameter.ctype
+    dtype = np.int8 if ctype == "int8_t" else np.int16 if ctype == "int16_t" else np.int32
+    return (wrap32(result + ((1 << fix_point) >> 1)) >> fix_point).astype(dtype)
+
+
+def wrap32(x):
+    """ Wraps the integers x around to 32 bits, as the 32-bit accumulator """
+    return (x + 2**31) % 2**32 - 2**31
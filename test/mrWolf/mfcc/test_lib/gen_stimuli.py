@@ -0,0 +1,73 @@
+#!/usr/bin/env python3
+
+import numpy as np
+
+
+####################
+# generate_stimuli #
+####################
+
+
+def generate_stimuli(arg, env):
+    """
+    Function to generate the stimuli
+
+    Arguments
+    ---------
+    arg: Argument for which to generate stimuli (either Argument or ArrayArgument)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    """
+    pass
+
+
+##################
+# compute_result #
+##################
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.ctype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+    # reference with the same steps as plp_mfcc_f32, on the unscaled spectrum of the windowed input
+    x = inputs['pSrc'].value.astype(np.float64) / 2**15
+    window = inputs['window'].value.astype(np.float64) / 2**15
+    mag = np.abs(np.fft.rfft(x * window)) ** 2
+
+    coefficients = inputs['V'].value.astype(np.float64) / 2**15
+    first = inputs['firstValue'].value
+    length = inputs['filterLength'].value
+    offsets = np.concatenate([[0], np.cumsum(length)])
+    n_mels = len(first)
+    mels = np.array([np.dot(mag[first[m]:first[m] + length[m]],
+                            coefficients[offsets[m]:offsets[m + 1]]) for m in range(n_mels)])
+    mel_logs = np.log(mels + 1e-6)
+
+    # DCT-II of plp_dct2_q16, i.e. divided by n_mels, in Q5.10
+    m = np.arange(n_mels)
+    mfcc = np.cos(np.pi * np.outer(m, 2 * m + 1) / (2 * n_mels)) @ mel_logs / n_mels
+    result = mfcc * 2**10
+
+    if result_parameter.ctype == 'int16_t':
+        return np.clip(np.round(result), -2**15, 2**15 - 1).astype(np.int16)
+    else:
+        raise RuntimeError("Unrecognized result type: %s" % result_parameter.ctype)
+
+
+def make_signal(env, version):
+    """
+    White noise (signal 0), or a pure tone of 1100 Hz at 16 kHz (signal 1), whose weak mel bands
+    lie far below the strongest one
+    """
+    n = np.arange(env['len'])
+    if env['signal'] == 0:
+        return np.random.randint(-2**15, 2**15, size=env['len']).astype(np.int16)
+    signal = 0.9 * np.sin(2 * np.pi * 1100 / 16000 * n + 0.3)
+    return np.round(signal * 2**15).astype(np.int16)
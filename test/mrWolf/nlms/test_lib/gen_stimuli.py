@@ -0,0 +1,96 @@
+#!/usr/bin/env python3
+
+import numpy as np
+
+MU = 0.5
+DELTA = 1 << 10
+
+####################
+# generate_stimuli #
+####################
+
+
+def generate_stimuli(arg, env):
+    """
+    Function to generate the stimuli
+
+    Arguments
+    ---------
+    arg: Argument for which to generate stimuli (either Argument or ArrayArgument)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    """
+    pass
+
+
+##################
+# compute_result #
+##################
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.ctype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+    out, err = nlms(inputs['pSrc'].value, inputs['pRef'].value, env['numTaps'],
+                   result_parameter.ctype, fix_point)
+    return out if result_parameter.general_name() == 'pOut' else err
+
+
+def nlms(src, ref, num_taps, ctype, fix_point):
+    """
+    Simulates the NLMS filter like the RV32IM kernels, starting with zero coefficients and state. The
+    coefficients are in time-reversed order, such that the output is a dot product with the state.
+    """
+    if ctype == 'float':
+        state = np.concatenate([np.zeros(num_taps - 1), src.astype(np.float64)])
+        coeffs = np.zeros(num_taps)
+        out = np.zeros(len(src))
+        err = np.zeros(len(src))
+        for n in range(len(src)):
+            x = state[n:n + num_taps]
+            out[n] = np.dot(coeffs, x)
+            err[n] = ref[n] - out[n]
+            coeffs += MU * err[n] * x / (1e-6 + np.dot(x, x))
+        return out.astype(np.float32), err.astype(np.float32)
+
+    out, err = nlms_fixed([int(v) for v in src], [int(v) for v in ref], num_taps,
+                         ctype == 'int16_t', fix_point)
+    dtype = np.int16 if ctype == 'int16_t' else np.int32
+    return np.array(out, dtype=dtype), np.array(err, dtype=dtype)
+
+
+def nlms_fixed(src, ref, num_taps, saturate, fix_point):
+    """ fixed-point NLMS on python integers, saturate is True for q16 """
+    sat = sat16 if saturate else (lambda v: v)
+    mu = int(round(MU * 2**fix_point))
+    rnd = 1 << (fix_point - 1)
+    state = [0] * (num_taps - 1) + src
+    coeffs = [0] * num_taps
+    out, err = [], []
+    for n in range(len(src)):
+        x = state[n:n + num_taps]
+        if saturate:
+            y = sat16((sum(c * v for c, v in zip(coeffs, x)) + rnd) >> fix_point)
+        else:
+            y = sum((c * v + rnd) >> fix_point for c, v in zip(coeffs, x))
+        e = sat(ref[n] - y)
+        out.append(y)
+        err.append(e)
+        # step size normalized by the energy, C divisions truncate towards zero
+        energy = sum((v * v) >> fix_point for v in x)
+        alpha = abs(mu * e) // (energy + (1 if saturate else DELTA)) * (1 if mu * e >= 0 else -1)
+        if saturate:
+            alpha = sat16(alpha)
+        coeffs = [sat(c + ((alpha * v + rnd) >> fix_point)) for c, v in zip(coeffs, x)]
+    return out, err
+
+
+def sat16(x):
+    return max(-2**15, min(2**15 - 1, x))
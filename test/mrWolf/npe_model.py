@@ -0,0 +1,95 @@
+#! /usr/bin/python3
+
+import re
+import argparse
+from collections import defaultdict
+
+
+def main():
+    """ Main Function """
+    parser = argparse.ArgumentParser(prog='npe_model',
+                                     description='Calibrate the cost models used by PLP_NPE_AUTO')
+    parser.add_argument('bench_file', type=str,
+                        help='Benchmark CSV file (bench_*.csv written by pulp_dsp_test.py, or a '
+                             'legacy performance.csv sweep with columns n,32,32p,16,16p,...)')
+    parser.add_argument('-c', '--cores', type=int, default=8,
+                        help='Number of cores used in the parallel runs (ParallelArgument value)')
+    parser.add_argument('-f', '--function', type=str, default='plp_mat_mult',
+                        help='Function name, used for legacy sweeps and for naming the models')
+    args = parser.parse_args()
+
+    with open(args.bench_file, "r") as f:
+        lines = [l.strip() for l in f.readlines() if l.strip()]
+
+    if lines[0].startswith("n,"):
+        pairs = read_legacy_sweep(lines, args.function)
+    else:
+        pairs = read_bench(lines)
+
+    for name in sorted(pairs.keys()):
+        op_cycles, fork_cycles = fit(pairs[name], args.cores)
+        print("const plp_npe_cost_model plp_npe_model_{} = {{ {}, {} }};".format(
+            name[len("plp_"):], int(round(op_cycles * 16)), int(round(fork_cycles))))
+
+
+def read_bench(lines):
+    """
+    Reads a benchmark file of pulp_dsp_test.py and returns a dict, mapping the function name to a
+    list of tuples (ops, serial cycles, parallel cycles) of the same dimension on riscy.
+    """
+    header = lines[0].split(",")
+    assert header[:4] == ["name", "device", "dimension", "cycles"]
+    ops_idx = header.index("ops")
+    serial = {}
+    parallel = {}
+    for line in lines[1:]:
+        parts = [p.strip() for p in line.split(",")]
+        if parts[1] != "riscy":
+            continue
+        name = parts[0]
+        key_dict = parallel if name.endswith("_parallel") else serial
+        name = re.sub("_parallel$", "", name)
+        key_dict[(name, parts[2])] = (int(parts[ops_idx]), int(parts[3]))
+    pairs = defaultdict(list)
+    for key, (ops, cycles) in serial.items():
+        if key in parallel and ops > 0:
+            pairs[key[0]].append((ops, cycles, parallel[key][1]))
+    return pairs
+
+
+def read_legacy_sweep(lines, function):
+    """
+    Reads a legacy sweep (like mat_mul/test_fct/performance.csv), which stores ops/cycle of square
+    problems of size n, and returns the same structure as read_bench.
+    """
+    header = lines[0].split(",")
+    pairs = defaultdict(list)
+    for line in lines[1:]:
+        values = dict(zip(header, line.split(",")))
+        n = int(values["n"])
+        ops = n * n * n
+        for bits in ["32", "16", "8"]:
+            if bits in values and bits + "p" in values:
+                pairs["{}_i{}".format(function, bits)].append(
+                    (ops, ops / float(values[bits]), ops / float(values[bits + "p"])))
+    return pairs
+
+
+def fit(pairs, cores):
+    """
+    Fits the cost model to a list of (ops, serial cycles, parallel cycles). The fork overhead is the
+    smallest number of parallel cycles exceeding an ideal split of the serial cycles (larger values
+    are caused by load imbalance, which the runtime model accounts for separately). The cycles per
+    operation are the median measured in the region where the decision matters, i.e. up to 16 times
+    the fork overhead.
+    """
+    fork_cycles = max(min(t_par - t_ser / cores for _, t_ser, t_par in pairs), 0)
+    region = [(ops, t_ser) for ops, t_ser, _ in pairs if t_ser <= 16 * fork_cycles]
+    if not region:
+        region = [(ops, t_ser) for ops, t_ser, _ in pairs]
+    op_cycles = sorted(t_ser / ops for ops, t_ser in region)
+    return op_cycles[len(op_cycles) // 2], fork_cycles
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,57 @@
+#!/usr/bin/env python3
+
+import numpy as np
+
+
+##################
+# compute_result #
+##################
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.ctype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+    n, hop, n_segments = env['len'], env['hop'], env['n_segments']
+    if result_parameter.name.endswith('return_value'):
+        return np.uint32(n_segments)
+
+    # one-sided PSD as scipy.signal.welch(fs=1, detrend=False), with the Hann window of the init
+    is_float = result_parameter.ctype == 'float'
+    src = inputs['pSrc'].value.astype(np.float64)
+    window = hann_window(env, 'f32' if is_float else 'q16').astype(np.float64)
+    if not is_float:
+        src, window = src / 2**15, window / 2**15
+    segments = np.stack([src[t * hop:t * hop + n] for t in range(n_segments)])
+    power = np.mean(np.abs(np.fft.rfft(segments * window)) ** 2, axis=0) / np.sum(window ** 2)
+    power[1:n // 2] *= 2
+
+    if is_float:
+        return power.astype(np.float32)
+    return np.minimum(np.round(power * 2**15), 2**31 - 1).astype(np.int32)
+
+
+def hann_window(env, version):
+    """ periodic Hann window, as generated by plp_psd_welch_init_* with PLP_WINDOW_HANN """
+    n = np.arange(env['len'])
+    window = 0.5 - 0.5 * np.cos(2 * np.pi * n / env['len'])
+    if version == 'f32':
+        return window.astype(np.float32)
+    return np.minimum(np.round(window * 2**15), 2**15 - 1).astype(np.int16)
+
+
+def make_signal(env, version):
+    """ tone between two bins with noise, which covers a large dynamic range of the PSD """
+    t = np.arange(env['src_len'])
+    signal = 0.5 * np.sin(2 * np.pi * 5.3 * t / env['len'] + 0.4)
+    signal += np.random.uniform(-0.45, 0.45, size=env['src_len'])
+    if version == 'f32':
+        return signal.astype(np.float32)
+    return np.round(signal * 2**15).astype(np.int16)
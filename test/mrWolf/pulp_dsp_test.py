@@ -133,6 +133,10 @@ class Argument(object):
             return np.int16
         if self.ctype == "int32_t":
             return np.int32
+        if self.ctype == "uint16_t":
+            return np.uint16
+        if self.ctype == "uint32_t":
+            return np.uint32
         if self.ctype == "float":
             return np.float32
         raise RuntimeError("Unknown type: %s" % self.ctype)
@@ -165,7 +169,7 @@ class Argument(object):
         """ Interpret the type of self.value and generate the stimuli """
         if callable(self.value):
             self.value = call_dynamic_function(self.value, env, version, device)
-        if self.value == GENERATE_STIMULI:
+        if isinstance(self.value, str) and self.value == GENERATE_STIMULI:
             self.value = call_dynamic_function(gen_stimuli, env, version, device, argument=self)
         if isinstance(self.value, str):
             self.value = env[self.value]
@@ -295,7 +299,7 @@ class ArrayArgument(Argument):
         dtype = self.get_dtype()
         if callable(self.value):
             self.value = call_dynamic_function(self.value, env, version, device)
-        if self.value == GENERATE_STIMULI:
+        if isinstance(self.value, str) and self.value == GENERATE_STIMULI:
             self.value = call_dynamic_function(gen_stimuli, env, version, device, variable=self)
         if isinstance(self.value, str):
             self.value = env[self.value]
@@ -342,7 +346,7 @@ class ArrayArgument(Argument):
 class OutputArgument(ArrayArgument):
     """Output Array Argument"""
     def __init__(self, name, ctype, length, use_l1=None, tolerance=0, in_function=True,
-                 skip_check=False):
+                 skip_check=False, check_length=None):
         """
         name: name of the argument
         ctype: String, one of the following:
@@ -363,10 +367,14 @@ class OutputArgument(ArrayArgument):
         in_function: Boolean, if True, add this argument to the function signature. Set this to
                      False, and use CustomArgument to create struts.
         skip_check: Boolean, if True, the output is not checked.
+        check_length: Number of elements at the beginning of the array which are checked, same
+                      options as length. If None, the entire array is checked. Use this, if the
+                      rest of the array is used as buffer by the function.
         """
         super(OutputArgument, self).__init__(name, ctype, length, 0, use_l1, in_function)
         self.tolerance = tolerance
         self.skip_check = skip_check
+        self.check_length = check_length
 
     def reference_name(self):
         return self.name + "__reference"
@@ -383,8 +391,16 @@ class OutputArgument(ArrayArgument):
         """
         if callable(self.tolerance):
             self.tolerance = call_dynamic_function(self.tolerance, env, version, device)
+        if callable(self.check_length):
+            self.check_length = call_dynamic_function(self.check_length, env, version, device)
+        if isinstance(self.check_length, str):
+            self.check_length = env[self.check_length]
         return super(OutputArgument, self).apply(env, var_type, version, use_l1, idx, device)
 
+    def checked_length(self):
+        """ returns the number of elements which are checked """
+        return self.length if self.check_length is None else self.check_length
+
     def check_str(self, target):
         """ returns the string to check the result """
         if self.skip_check:
@@ -403,7 +419,7 @@ class OutputArgument(ArrayArgument):
                 }}
             }}
             """
-        ).format(len=self.length,
+        ).format(len=self.checked_length(),
                  check_str=check_str,
                  name=self.general_name(),
                  acq=self.name,
@@ -416,7 +432,7 @@ class OutputArgument(ArrayArgument):
             return ""
 
         reference = gen_function(self)
-        return declare_array(self.reference_name(), self.ctype, self.length, reference)
+        return declare_array(self.reference_name(), self.ctype, self.checked_length(), reference)
 
     def estimate_memory(self):
         """ returns an estimate of the number of bytes in L2 for this argument """
@@ -591,7 +607,7 @@ class CustomArgument(Argument):
     externally defined variable, struct or array. But it can also be used to create a struct with
     fields, which may point to other arguments.
     """
-    def __init__(self, name, value, as_ptr=False, deref=False, in_function=True):
+    def __init__(self, name, value, as_ptr=False, deref=False, in_function=True, setup=None):
         """
         name: Name of the argument (in the initialization and function declaration)
         value: Function, which should return a string for initializing the CustomVariable.
@@ -615,10 +631,15 @@ class CustomArgument(Argument):
                is passed without dereferencing it.
         in_function: Boolean, if True, add this argument to the function signature. Set this to
                      False, and use CustomArgument to create struts.
+        setup: None, or a function with the same arguments as value, which returns C statements.
+               They are executed before every call of the function-under-test, outside of the
+               measured section, e.g. to set up a struct with the init function of the library or
+               to feed previous blocks into a stateful function.
         """
         super(CustomArgument, self).__init__(name, None, value, None, in_function)
         self.as_ptr = as_ptr
         self.deref = deref
+        self.setup = setup
         assert not (self.as_ptr and self.deref)
 
     def apply(self, env, var_type, version, use_l1, idx, device):
@@ -631,8 +652,17 @@ class CustomArgument(Argument):
         self.name = arg_name(self.name)
         self.value = call_dynamic_function(self.value, env, version, device, use_l1=use_l1,
                                            arg_name=arg_name)
+        if self.setup is not None:
+            self.setup = call_dynamic_function(self.setup, env, version, device, use_l1=use_l1,
+                                               arg_name=arg_name)
         return self
 
+    def do_bench_setup_str(self):
+        """ returns the string for setup in do_bench function """
+        if self.setup is None:
+            return None
+        return dedent(self.setup).strip()
+
     def arg_str(self):
         """ Returns the string to show for funciton argument """
         if not self.in_function:
@@ -879,9 +909,9 @@ class AggregatedTest(object):
         if version.startswith('q') and version.endswith('parallel'):
             arguments = arguments
 
-        # check fixpoint stuff
+        # check fixpoint stuff, functions with a fixed format (like the FFTs) have no decimal point
         if version.startswith('q'):
-            assert len([arg for arg in arguments if isinstance(arg, FixPointArgument)]) == 1
+            assert len([arg for arg in arguments if isinstance(arg, FixPointArgument)]) <= 1
 
         # generate all aggregated tests
         self.cases = [
@@ -1315,8 +1345,10 @@ def parse_output(output):
     return cases, None
 
 
-BENCHMARK_FILE = os.path.join(os.path.dirname(os.path.realpath(__file__)),
-                              "bench_{}.csv".format(time.strftime("%Y-%m-%d_%H:%M:%S")))
+# The environment variable PLP_BENCH_FILE collects the results of several test runs in one file
+BENCHMARK_FILE = os.environ.get("PLP_BENCH_FILE") or os.path.join(
+    os.path.dirname(os.path.realpath(__file__)),
+    "bench_{}.csv".format(time.strftime("%Y-%m-%d_%H:%M:%S")))
 
 
 def bench_output(performance, test_obj, test_case):
@@ -1397,7 +1429,8 @@ def ctype_mem_size(ctype):
 
 def declare_scalar(name, ctype, value):
     """ returns a string to declare and initialize a scalar value """
-    assert isinstance(value, (int, float, np.int8, np.int16, np.int32, np.float32))
+    assert isinstance(value, (int, float, np.int8, np.int16, np.int32, np.uint16, np.uint32,
+                             np.float32))
     if ctype == "float":
         # We want to write the floating point as hex representation to the header file (and not
         # as a decimal "string"). Then, we want to typecast it to a float. One way is to get the
@@ -1417,14 +1450,16 @@ def declare_array(name, ctype, length, arr):
         values_str = ", ".join([fmt_float(x) for x in arr])
         # We store float values in their hex representation. This way, we do not use the
         # inaccurate decimal "string" representation, and we guarantee that the data is the
-        # exact same as when computeing the expected result.
+        # exact same as when computeing the expected result. The name is a macro (and not a
+        # pointer variable), such that it is an address constant, which can be used to initialize
+        # structs (e.g. FFT instances in CustomArgument).
         return dedent(
             """\
             HAL_L2 uint32_t {name}__int[{len}] = {{
             {content}
             }};
 
-            float* {name} = (float*)((void*){name}__int);
+            #define {name} ((float*)((void*){name}__int))
             """
         ).format(name=name, len=length, content=indent("\n".join(wrap(values_str, 96)), "    "))
     else:
@@ -1450,7 +1485,7 @@ def tolerance_check_str(acq, exp, tolerance, ctype, indent, target):
         # In case of float: add a tiny absolute offset of 0.0001
         return dedent(
             """\
-            {indent}float __tol = ABS({tol:E} * (float){exp} + 0.0001);
+            {indent}float __tol = ABS({tol:E} * (float){exp}) + 0.0001;
             {indent}if (!({acq} >= ({ty})({exp} - __tol) &&
             {indent}      {acq} <= ({ty})({exp} + __tol))) {{\
             """
@@ -1467,11 +1502,9 @@ def tolerance_check_str(acq, exp, tolerance, ctype, indent, target):
                 """\
                 {indent}{ty} __tol_t = ABS({exp} / {tol_fraction}) + 1;
                 {indent}if (!(({exp} < {type_min} + __tol_t &&
-                {indent}       ({acq} <= {exp} + __tol_t ||
-                {indent}        {acq} >= {exp} - __tol_t)) ||
+                {indent}       {acq} <= {exp} + __tol_t) ||
                 {indent}      ({exp} > {type_max} - __tol_t &&
-                {indent}       ({acq} >= {exp} - __tol_t ||
-                {indent}        {acq} <= {exp} + __tol_t)) ||
+                {indent}       {acq} >= {exp} - __tol_t) ||
                 {indent}      ({exp} >= {type_min} + __tol_t &&
                 {indent}       {exp} <= {type_max} - __tol_t &&
                 {indent}       ({acq} >= {exp} - __tol_t &&
@@ -1486,11 +1519,9 @@ def tolerance_check_str(acq, exp, tolerance, ctype, indent, target):
                 {indent}float __tol = ABS({tol:E} * (float){exp});
                 {indent}{ty} __tol_t = ({ty})(__tol + 0.999);
                 {indent}if (!(({exp} < {type_min} + __tol_t &&
-                {indent}       ({acq} <= {exp} + __tol_t ||
-                {indent}        {acq} >= {exp} - __tol_t)) ||
+                {indent}       {acq} <= {exp} + __tol_t) ||
                 {indent}      ({exp} > {type_max} - __tol_t &&
-                {indent}       ({acq} >= {exp} - __tol_t ||
-                {indent}        {acq} <= {exp} + __tol_t)) ||
+                {indent}       {acq} >= {exp} - __tol_t) ||
                 {indent}      ({exp} >= {type_min} + __tol_t &&
                 {indent}       {exp} <= {type_max} - __tol_t &&
                 {indent}       ({acq} >= {exp} - __tol_t &&
@@ -1505,11 +1536,9 @@ def tolerance_check_str(acq, exp, tolerance, ctype, indent, target):
                 """\
                 {indent}{ty} __tol_t = {tol};
                 {indent}if (!(({exp} < {type_min} + __tol_t &&
-                {indent}       ({acq} <= {exp} + __tol_t ||
-                {indent}        {acq} >= {exp} - __tol_t)) ||
+                {indent}       {acq} <= {exp} + __tol_t) ||
                 {indent}      ({exp} > {type_max} - __tol_t &&
-                {indent}       ({acq} >= {exp} - __tol_t ||
-                {indent}        {acq} <= {exp} + __tol_t)) ||
+                {indent}       {acq} >= {exp} - __tol_t) ||
                 {indent}      ({exp} >= {type_min} + __tol_t &&
                 {indent}       {exp} <= {type_max} - __tol_t &&
                 {indent}       ({acq} >= {exp} - __tol_t &&
@@ -1522,11 +1551,9 @@ def tolerance_check_str(acq, exp, tolerance, ctype, indent, target):
                 """\
                 {indent}{ty} __tol_t = {tol};
                 {indent}if (!(({exp} < {type_min} + __tol_t &&
-                {indent}       ({acq} <= {exp} + __tol_t ||
-                {indent}        {acq} >= {exp} - __tol_t)) ||
+                {indent}       {acq} <= {exp} + __tol_t) ||
                 {indent}      ({exp} > {type_max} - __tol_t &&
-                {indent}       ({acq} >= {exp} - __tol_t ||
-                {indent}        {acq} <= {exp} + __tol_t)) ||
+                {indent}       {acq} >= {exp} - __tol_t) ||
                 {indent}      ({exp} >= {type_min} + __tol_t &&
                 {indent}       {exp} <= {type_max} - __tol_t &&
                 {indent}       ({acq} >= {exp} - __tol_t &&
@@ -1604,8 +1631,9 @@ def call_dynamic_function(f, env, version, device, arg_name=None, argument=None,
             'use_l1': (argument, "use_l1: bool"),
         })
 
-    # __code__.co_varnames returns the list of argument names of the function
-    arg_list = f.__code__.co_varnames
+    # __code__.co_varnames starts with the argument names of the function, followed by its local
+    # variables
+    arg_list = f.__code__.co_varnames[:f.__code__.co_argcount]
 
     if not set(arg_list).issubset(possible_args.keys()):
         valid_options = "\n".join(["{:11} -> {}".format(k, v[1]) for k, v in sorted(
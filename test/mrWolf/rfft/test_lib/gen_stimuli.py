@@ -3,6 +3,23 @@
 import numpy as np
 
 
+####################
+# generate_stimuli #
+####################
+
+
+def generate_stimuli(arg, env):
+    """
+    Function to generate the stimuli
+
+    Arguments
+    ---------
+    arg: Argument for which to generate stimuli (either Argument or ArrayArgument)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    """
+    pass
+
+
 ##################
 # compute_result #
 ##################
@@ -19,48 +36,21 @@ def compute_result(result_parameter, inputs, env, fix_point):
     env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
     fix_point: None (if no fixpoint is used) or decimal point
     """
-    if result_parameter.ctype == 'int32_t':
-        raise RuntimeError("Int not implemented")
-        
-        # if fix_point is None or fix_point == 0:
-            
-        # else:
-            
-    elif result_parameter.ctype == 'float':
-        a = inputs['pSrc'].value.astype(np.float32)
-        result = np.array(np.fft.rfft(a), dtype=np.float32)
+    x = inputs['pSrc'].value.astype(np.float64)
+    if result_parameter.ctype == 'float':
+        # first len/2+1 values of the unscaled spectrum
+        spectrum = np.fft.rfft(x)
     else:
-        raise RuntimeError("Unrecognized result type: %s" % result_parameter.ctype)
-
-    return result
-
-
-######################
-# Fixpoint Functions #
-######################
-
-
-def q_sat(x):
-    if x > 2**31 - 1:
-        return x - 2**32
-    elif x < -2**31:
-        return x + 2**32
+        # the output keeps the scaling of the complex FFT, i.e. it is the spectrum divided by len,
+        # and contains the first len/2+1 complex values
+        spectrum = np.fft.rfft(x) / env['len']
+    result = np.stack([spectrum.real, spectrum.imag], axis=1).flatten()
+
+    if result_parameter.ctype == 'float':
+        return result.astype(np.float32)
+    elif result_parameter.ctype == 'int16_t':
+        return np.clip(np.round(result), -2**15, 2**15 - 1).astype(np.int16)
+    elif result_parameter.ctype == 'int32_t':
+        return np.clip(np.round(result), -2**31, 2**31 - 1).astype(np.int32)
     else:
-        return x
-
-
-def q_add(a, b):
-    return q_sat(a + b)
-
-
-def q_sub(a, b):
-    return q_sat(a - b)
-
-
-def q_mul(a, b, p):
-    return q_roundnorm(a * b, p)
-
-
-def q_roundnorm(a, p):
-    rounding = 1 << (p - 1)
-    return q_sat((a + rounding) >> p)
+        raise RuntimeError("Unrecognized result type: %s" % result_parameter.ctype)
@@ -0,0 +1,78 @@
+#!/usr/bin/env python3
+
+import numpy as np
+
+
+##################
+# compute_result #
+##################
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.ctype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+    is_float = result_parameter.ctype == 'float'
+    dtype = np.float32 if is_float else np.int64
+
+    # dense matrix A, the padding of the ELL format adds zeros
+    m, n = env['len_m'], env['len_n']
+    values = inputs['values'].value.astype(dtype)
+    col_idx = inputs['colIdx'].value.astype(np.int64)
+    if 'rowPtr' in inputs:
+        row_ptr = inputs['rowPtr'].value.astype(np.int64)
+        rows = np.repeat(np.arange(m), np.diff(row_ptr))
+    else:
+        rows = np.repeat(np.arange(m), env['width'])
+    a = np.zeros((m, n), dtype=dtype)
+    np.add.at(a, (rows, col_idx), values)
+    x = inputs['srcX'].value.astype(dtype)
+
+    if is_float:
+        return np.matmul(a, x).astype(np.float32)
+
+    # the products are accumulated in 32 bits, with wrap-around, and the sum is rounded once
+    result = wrap32(np.matmul(a, x))
+    ctype = result_parameter.ctype
+    dtype = np.int8 if ctype == "int8_t" else np.int16
+    return (wrap32(result + ((1 << fix_point) >> 1)) >> fix_point).astype(dtype)
+
+
+def wrap32(x):
+    """ Wraps the integers x around to 32 bits, as the 32-bit accumulator """
+    return (x + 2**31) % 2**32 - 2**31
+
+
+def sparse_rows(env):
+    """
+    Sorted columns of the non-zero values of every row. The pattern only depends on the sweep
+    variables, such that all arrays of a test describe the same matrix. With skew=1, the first
+    eighth of the rows holds most of the non-zero values, which checks the load balancing of the
+    parallel CSR kernels.
+    """
+    m, n, density = env['len_m'], env['len_n'], env['density'] / 100
+    rng = np.random.RandomState(((m * 131 + n) * 131 + env['density']) * 2 + env['skew'])
+    rows = []
+    for r in range(m):
+        p = density
+        if env['skew']:
+            p = min(1.0, 4 * density) if r < max(1, m // 8) else density / 4
+        rows.append(np.sort(rng.choice(n, rng.binomial(n, p), replace=False)))
+    if sum(len(cols) for cols in rows) == 0:
+        rows[0] = np.array([rng.randint(n)])
+    return rows
+
+
+def random_values(version, length):
+    """ Random values of the data type of the version """
+    if version.startswith('f'):
+        return np.random.uniform(-1, 1, size=length).astype(np.float32)
+    bits = 8 if version.startswith('q8') else 16
+    return np.random.randint(-2**(bits - 1), 2**(bits - 1), size=length)
@@ -0,0 +1,71 @@
+#!/usr/bin/env python3
+
+import numpy as np
+
+
+####################
+# generate_stimuli #
+####################
+
+
+def generate_stimuli(arg, env):
+    """
+    Function to generate the stimuli
+
+    Arguments
+    ---------
+    arg: Argument for which to generate stimuli (either Argument or ArrayArgument)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    """
+    # name = arg.name
+    # if name == "srcA":
+    #     # generate and return stimuli for srcA
+    # if name == "srcB":
+    #     # generate and return stimuli for srcB
+    # ...
+
+
+##################
+# compute_result #
+##################
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.ctype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+    n_frames = env['n_frames']
+    if result_parameter.name.endswith('return_value'):
+        return np.uint32(n_frames)
+
+    src = inputs['pSrc'].value.astype(np.float64)
+    window = make_window(env)
+    frames = np.stack([src[t * env['hop']:t * env['hop'] + env['len']] for t in range(n_frames)])
+    spectrum = np.fft.rfft(frames * window)
+
+    if env['out_type'] == 0:
+        result = np.stack([spectrum.real, spectrum.imag], axis=2)
+    elif env['out_type'] == 1:
+        result = np.abs(spectrum)
+    else:
+        result = np.abs(spectrum) ** 2
+
+    # layout 1 stores the frequency bins one after the other
+    if env['layout'] == 1:
+        result = np.swapaxes(result, 0, 1)
+    return result.flatten().astype(np.float32)
+
+
+def make_window(env):
+    """ periodic window of plp_stft_init_f32, PLP_WINDOW_HANN or PLP_WINDOW_BLACKMAN """
+    phi = 2 * np.pi * np.arange(env['len']) / env['len']
+    if env['window_type'] == 1:
+        return 0.5 - 0.5 * np.cos(phi)
+    return 0.42 - 0.5 * np.cos(phi) + 0.08 * np.cos(2 * phi)
@@ -0,0 +1,315 @@
+#! /usr/bin/python3
+
+"""
+Offline auto-tuner for the kernel variants which are selected at runtime.
+
+Each tunable is a macro in include/plp_tuning.h, which maps a problem size to the variant used by
+the glue code or the kernel. Defining PLP_TUNE_FORCE_<MACRO>=<variant> when building the library
+forces a single variant for all sizes. The command 'run' rebuilds the library once per variant,
+runs the corresponding test folder (pulp_dsp_test.py) on the simulator, and stores the benchmark
+file as tune/<tunable>_<variant>.csv. The command 'emit' reads these files, chooses the fastest
+variant for every measured size, and writes the header with the resulting size buckets. Tunables
+without measurements keep their default table.
+"""
+
+import os
+import re
+import time
+import argparse
+import textwrap
+import subprocess
+from collections import namedtuple, defaultdict
+
+ROOT_DIR = os.path.abspath(os.path.join(os.path.dirname(os.path.realpath(__file__)), "../.."))
+TEST_DIR = os.path.dirname(os.path.realpath(__file__))
+TUNE_DIR = os.path.join(TEST_DIR, "tune")
+HEADER_FILE = os.path.join(ROOT_DIR, "include", "plp_tuning.h")
+
+# name:     name of the tunable, used for the result files
+# macro:    name of the dispatch macro in plp_tuning.h
+# doc:      description in the header
+# folder:   test folder used for benchmarking
+# function: regex on the benchmarked function names which are affected by this tunable
+# size:     function mapping the dimension dict of a benchmark to the size used for dispatching
+# variants: list of variants to sweep
+# valid:    function (variant, size) -> bool, if the variant is supported for the given size
+# default:  list of (max size, variant), the last bucket extends to infinity
+Tunable = namedtuple("Tunable", ["name", "macro", "doc", "folder", "function", "size", "variants",
+                                 "valid", "default"])
+
+CFFT_F32_RADIX_DEFAULT = [(8, 2), (16, 4), (32, 2), (64, 8), (128, 2), (256, 4), (512, 8),
+                          (1024, 4), (None, 2)]
+
+TUNABLES = [
+    Tunable(name="cfft_f32_radix",
+            macro="PLP_TUNE_CFFT_F32_RADIX",
+            doc="Radix of plp_cfft_f32 (2, 4 or 8) depending on the FFT length",
+            folder="cfft",
+            function=r"^plp_cfft_f32$",
+            size=lambda dim: dim["len"],
+            variants=[2, 4, 8],
+            valid=lambda v, n: (n.bit_length() - 1) % {2: 1, 4: 2, 8: 3}[v] == 0,
+            default=CFFT_F32_RADIX_DEFAULT),
+    Tunable(name="cfft_f32_parallel_radix",
+            macro="PLP_TUNE_CFFT_F32_PARALLEL_RADIX",
+            doc="Radix of plp_cfft_f32_parallel (2, 4 or 8) depending on the FFT length",
+            folder="cfft",
+            function=r"^plp_cfft_f32_parallel$",
+            size=lambda dim: dim["len"],
+            variants=[2, 4, 8],
+            valid=lambda v, n: (n.bit_length() - 1) % {2: 1, 4: 2, 8: 3}[v] == 0,
+            default=CFFT_F32_RADIX_DEFAULT),
+    Tunable(name="conv_parallel_ola",
+            macro="PLP_TUNE_CONV_PARALLEL_OLA",
+            doc="Combination of the partial results of plp_conv_*_parallel depending on the output "
+                "length: 1 for parallel overlap-adding, 0 for sequential adding",
+            folder="conv",
+            function=r"^plp_conv_i(8|16|32)_parallel$",
+            size=lambda dim: dim["len_a"] + dim["len_b"] - 1,
+            variants=[0, 1],
+            valid=lambda v, n: True,
+            default=[(None, 1)]),
+]
+
+
+def main():
+    """ Main Function """
+    parser = argparse.ArgumentParser(prog='tune',
+                                     description='Tune the runtime dispatch of kernel variants')
+    subparsers = parser.add_subparsers(dest='command')
+    parser_run = subparsers.add_parser('run', help='Benchmark all variants on the simulator')
+    parser_run.add_argument('-t', '--tunable', type=str, action='append',
+                            help='Name of the tunable to run (default: all)')
+    parser_run.add_argument('--no-emit', action='store_true',
+                            help='Do not regenerate the header after the run')
+
+    parser_emit = subparsers.add_parser('emit', help='Generate the dispatch header')
+    parser_emit.add_argument('-o', '--output', type=str, default=HEADER_FILE,
+                             help='Header file to write (default: include/plp_tuning.h)')
+
+    parser_show = subparsers.add_parser('show', help='Show the measured size buckets')
+
+    args = parser.parse_args()
+
+    if args.command == 'run':
+        run(args)
+    elif args.command == 'emit':
+        emit(args.output)
+    elif args.command == 'show':
+        show()
+    else:
+        parser.print_help()
+
+
+def run(args):
+    """ Run subcommand """
+    names = args.tunable or [t.name for t in TUNABLES]
+    tunables = [t for t in TUNABLES if t.name in names]
+    assert len(tunables) == len(names), "Unknown tunable in {}".format(names)
+
+    os.makedirs(TUNE_DIR, exist_ok=True)
+    for tunable in tunables:
+        for variant in tunable.variants:
+            tflags = "-D{}={}".format(force_macro(tunable), variant)
+            print("tune: {} = {}".format(tunable.name, variant))
+            if not run_variant(tunable.folder, tflags, result_file(tunable, variant)):
+                print("tune: no benchmark for {} = {}, some tests failed".format(tunable.name,
+                                                                                  variant))
+
+    # restore the library without any forced variant
+    build_library("")
+
+    if not args.no_emit:
+        emit(HEADER_FILE)
+
+
+def run_variant(folder, tflags, bench_file):
+    """
+    Builds and installs the library with the given flags, and runs all tests of the folder. The
+    benchmark is written to bench_file. Returns False if no benchmark was written, because some
+    tests did not pass.
+    """
+    build_library(tflags)
+    if os.path.isfile(bench_file):
+        os.remove(bench_file)
+    env = dict(os.environ, TFLAGS=tflags, PLP_BENCH_FILE=bench_file)
+    subprocess.run(["plptest", "--threads", "1"], env=env, check=False,
+                   cwd=os.path.join(TEST_DIR, folder, "test_lib"))
+    return os.path.isfile(bench_file)
+
+
+def build_library(tflags):
+    """ Rebuilds and installs the library with the given TFLAGS """
+    env = dict(os.environ, TFLAGS=tflags)
+    subprocess.run(["make", "clean", "all", "install"], env=env, check=True, cwd=ROOT_DIR)
+
+
+def force_macro(tunable):
+    return tunable.macro.replace("PLP_TUNE_", "PLP_TUNE_FORCE_", 1)
+
+
+def result_file(tunable, variant):
+    return os.path.join(TUNE_DIR, "{}_{}.csv".format(tunable.name, variant))
+
+
+def read_cycles(tunable, variant):
+    """
+    Reads the result file of a variant, and returns a dict mapping the size to the total number of
+    cycles on riscy, summed over all matching functions and dimensions of the same size.
+    """
+    filename = result_file(tunable, variant)
+    if not os.path.isfile(filename):
+        return None
+    function_re = re.compile(tunable.function)
+    cycles = defaultdict(int)
+    with open(filename, "r") as f:
+        lines = iter(f.readlines())
+        header = next(lines).strip().split(",")
+        for line in lines:
+            values = dict(zip(header, line.strip().split(",")))
+            if values["device"] != "riscy" or not function_re.search(values["name"]):
+                continue
+            dim = dict((k.strip(), int(v)) for k, v in (d.split("=")
+                                                         for d in values["dimension"].split(";")))
+            cycles[tunable.size(dim)] += int(values["cycles"])
+    return cycles
+
+
+def measure_buckets(tunable):
+    """
+    Returns the size buckets [(max size, variant), ...] with the fastest variant for each measured
+    size, or None if no measurements exist. Adjacent buckets with the same variant are merged and
+    the last bucket extends to infinity.
+    """
+    results = {}
+    for variant in tunable.variants:
+        cycles = read_cycles(tunable, variant)
+        if cycles:
+            results[variant] = cycles
+    if not results:
+        return None
+
+    sizes = sorted(set(n for cycles in results.values() for n in cycles))
+    buckets = []
+    for n in sizes:
+        candidates = [(cycles[n], v) for v, cycles in results.items()
+                      if n in cycles and tunable.valid(v, n)]
+        if not candidates:
+            continue
+        best = min(candidates)[1]
+        if buckets and buckets[-1][1] == best:
+            buckets[-1] = (n, best)
+        else:
+            buckets.append((n, best))
+    buckets[-1] = (None, buckets[-1][1])
+    return buckets
+
+
+def show():
+    """ Show subcommand """
+    for tunable in TUNABLES:
+        buckets = measure_buckets(tunable)
+        source = "measured"
+        if buckets is None:
+            buckets, source = tunable.default, "default"
+        print("{} ({}):".format(tunable.name, source))
+        for n, variant in buckets:
+            print("    {:>10}: {}".format("<= {}".format(n) if n is not None else "else", variant))
+
+
+def bucket_expr(buckets):
+    """ Returns the C expression of the buckets as a function of the size n, one bucket per line """
+    if len(buckets) == 1:
+        return "({})".format(buckets[0][1])
+    lines = ["    ((n) <= {} ? {} :".format(*buckets[0])]
+    lines += ["     (n) <= {} ? {} :".format(n, variant) for n, variant in buckets[1:-1]]
+    width = max(len(l) for l in lines) + 1
+    return "\\\n" + "".join(l.ljust(width) + "\\\n" for l in lines) + \
+        "     {})".format(buckets[-1][1])
+
+
+HEADER_TEMPLATE = """\
+/* ----------------------------------------------------------------------
+ * Project:      PULP DSP Library
+ * Title:        plp_tuning.h
+ * Description:  Size-dispatch table of the kernel variants
+ *
+ * $Date:        {date}
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * This file is generated by test/mrWolf/tune.py, do not edit it by hand. Each macro maps the
+ * problem size n to the fastest variant measured on the simulator. Define
+ * PLP_TUNE_FORCE_<name>=<variant> when building the library to use a single variant for all sizes.
+ */
+
+#ifndef __PLP_TUNING_H__
+#define __PLP_TUNING_H__
+
+#if defined(PLP_CONV_SEQUENTIALADDING) && !defined(PLP_TUNE_FORCE_CONV_PARALLEL_OLA)
+#define PLP_TUNE_FORCE_CONV_PARALLEL_OLA 0
+#endif
+{macros}
+#endif // __PLP_TUNING_H__
+"""
+
+MACRO_TEMPLATE = """
+/* {doc} */
+#ifdef {force}
+#define {macro}(n) ({force})
+#else
+#define {macro}(n) {expr}
+#endif
+"""
+
+
+def emit(output):
+    """ Emit subcommand: write the header """
+    macros = []
+    for tunable in TUNABLES:
+        buckets = measure_buckets(tunable)
+        source = "measured"
+        if buckets is None:
+            buckets, source = tunable.default, "default"
+        doc = "\n   ".join(textwrap.wrap("{} ({})".format(tunable.doc, source), 95))
+        macros.append(MACRO_TEMPLATE.format(doc=doc,
+                                            force=force_macro(tunable), macro=tunable.macro,
+                                            expr=bucket_expr(buckets)))
+
+    date = read_date(output)
+    with open(output, "w") as f:
+        f.write(HEADER_TEMPLATE.format(date=date, macros="".join(macros)))
+
+
+def read_date(output):
+    """ keep the date of the existing header, such that regenerating it is reproducible """
+    if os.path.isfile(output):
+        with open(output, "r") as f:
+            for line in f.readlines():
+                if line.startswith(" * $Date:"):
+                    return line.split(":", 1)[1].strip()
+    return time.strftime("%d. %b %Y")
+
+
+if __name__ == '__main__':
+    main()